@@ -0,0 +1,105 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+// Load balanced bound propagation of the MIP heuristics
+// (mip_heuristics/presolve/load_balanced_bounds_presolve_kernels.cuh): one launch of the CUDA graph
+// of the constraint activities, and one of the graph of the variable bound updates
+
+#include "kernel_bench_utils.cuh"
+
+#include <mip_heuristics/presolve/load_balanced_bounds_presolve.cuh>
+#include <mip_heuristics/problem/load_balanced_problem.cuh>
+
+namespace {
+
+using namespace kernel_bench;
+
+struct bounds_presolve_t {
+  explicit bounds_presolve_t(mip_context_t& ctx)
+    : lb_problem(ctx.problem), presolve(lb_problem, ctx.solver.context)
+  {
+    ctx.handle.sync_stream();
+  }
+
+  detail::load_balanced_problem_t<int, double> lb_problem;
+  detail::load_balanced_bounds_presolve_t<int, double> presolve;
+};
+
+// The graphs exchange the "bounds changed" flag with the host, the launches are synchronized
+void run_activity(nvbench::state& state, mip_context_t& ctx)
+{
+  bounds_presolve_t prs(ctx);
+  const auto& pb = prs.lb_problem;
+  // Each nonzero reads its coefficient, its variable and the bounds of the variable, each row its
+  // offset and bounds and writes its min and max activity
+  state.add_element_count(pb.nnz, "NNZ");
+  state.add_global_memory_reads<uint8_t>(
+    size_t(pb.nnz) * (sizeof(double) + sizeof(int) + 2 * sizeof(double)) +
+      size_t(pb.n_constraints) * (sizeof(int) + 2 * sizeof(double)),
+    "Matrix + bounds");
+  state.add_global_memory_writes<double>(2 * size_t(pb.n_constraints), "Slack");
+  time_on_handle_stream(state, ctx.handle);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    prs.presolve.calculate_constraint_slack(&ctx.handle);
+  });
+}
+
+void run_bounds_update(nvbench::state& state, mip_context_t& ctx)
+{
+  bounds_presolve_t prs(ctx);
+  prs.presolve.calculate_constraint_slack(&ctx.handle);
+  ctx.handle.sync_stream();
+  const auto& pb = prs.lb_problem;
+  // Each nonzero of the transpose reads its coefficient, its constraint and the slack of the
+  // constraint, each variable its offset, type and bounds and writes its bounds
+  state.add_element_count(pb.nnz, "NNZ");
+  state.add_global_memory_reads<uint8_t>(
+    size_t(pb.nnz) * (sizeof(double) + sizeof(int) + 2 * sizeof(double)) +
+      size_t(pb.n_variables) * (sizeof(int) + sizeof(var_t) + 2 * sizeof(double)),
+    "Matrix + slack");
+  state.add_global_memory_writes<double>(2 * size_t(pb.n_variables), "Bounds");
+  time_on_handle_stream(state, ctx.handle);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    prs.presolve.update_bounds_from_slack(&ctx.handle);
+  });
+}
+
+void bounds_activity(nvbench::state& state)
+{
+  run_activity(state, *make_synthetic_mip_context(state));
+}
+
+void bounds_activity_instance(nvbench::state& state)
+{
+  auto ctx = make_instance_mip_context(state);
+  if (ctx) { run_activity(state, *ctx); }
+}
+
+void bounds_update(nvbench::state& state)
+{
+  run_bounds_update(state, *make_synthetic_mip_context(state));
+}
+
+void bounds_update_instance(nvbench::state& state)
+{
+  auto ctx = make_instance_mip_context(state);
+  if (ctx) { run_bounds_update(state, *ctx); }
+}
+
+}  // namespace
+
+NVBENCH_BENCH(bounds_activity)
+  .add_int64_power_of_two_axis("Rows", nvbench::range(14, 20, 2))
+  .add_int64_axis("NnzPerRow", {4, 32});
+
+NVBENCH_BENCH(bounds_activity_instance).add_string_axis("Instance", instance_axis);
+
+NVBENCH_BENCH(bounds_update)
+  .add_int64_power_of_two_axis("Rows", nvbench::range(14, 20, 2))
+  .add_int64_axis("NnzPerRow", {4, 32});
+
+NVBENCH_BENCH(bounds_update_instance).add_string_axis("Instance", instance_axis);
@@ -0,0 +1,77 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+// Feasibility jump (mip_heuristics/feasibility_jump/feasibility_jump_kernels.cu): a fixed number of
+// iterations of move evaluation, selection and update from the same start. The moves of an
+// iteration depend on the constraints that the previous one touched, so that there is no fixed
+// byte count per iteration and only the iteration throughput is reported.
+
+#include "kernel_bench_utils.cuh"
+
+#include <mip_heuristics/feasibility_jump/feasibility_jump.cuh>
+#include <mip_heuristics/solution/solution.cuh>
+
+#include <thrust/fill.h>
+
+#include <limits>
+
+namespace {
+
+using namespace kernel_bench;
+
+void run_fj(nvbench::state& state, mip_context_t& ctx)
+{
+  const auto iterations = state.get_int64("Iterations");
+  detail::fj_settings_t fj_settings;
+  fj_settings.seed                   = 42;
+  fj_settings.mode                   = detail::fj_mode_t::EXIT_NON_IMPROVING;
+  fj_settings.time_limit             = 3600.;
+  fj_settings.iteration_limit        = iterations;
+  fj_settings.n_of_minimums_for_exit = std::numeric_limits<int>::max();
+  fj_settings.update_weights         = true;
+  fj_settings.feasibility_run        = false;
+
+  detail::solution_t<int, double> solution(*ctx.solver.context.problem_ptr);
+  detail::fj_t<int, double> fj(ctx.solver.context, fj_settings);
+  auto stream = solution.handle_ptr->get_stream();
+
+  state.add_element_count(iterations, "Iterations");
+  time_on_handle_stream(state, *solution.handle_ptr);
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch&, auto& timer) {
+               // Every sample starts from the clamped zero assignment with unit weights
+               thrust::fill(solution.handle_ptr->get_thrust_policy(),
+                            solution.assignment.begin(),
+                            solution.assignment.end(),
+                            0.0);
+               solution.clamp_within_bounds();
+               fj.reset_weights(stream, 1.);
+               solution.handle_ptr->sync_stream();
+               timer.start();
+               fj.solve(solution);
+               timer.stop();
+             });
+}
+
+void fj_iterations(nvbench::state& state) { run_fj(state, *make_synthetic_mip_context(state)); }
+
+void fj_iterations_instance(nvbench::state& state)
+{
+  auto ctx = make_instance_mip_context(state);
+  if (ctx) { run_fj(state, *ctx); }
+}
+
+}  // namespace
+
+NVBENCH_BENCH(fj_iterations)
+  .add_int64_power_of_two_axis("Rows", nvbench::range(12, 18, 2))
+  .add_int64_axis("NnzPerRow", {8})
+  .add_int64_axis("Iterations", {1000});
+
+NVBENCH_BENCH(fj_iterations_instance)
+  .add_string_axis("Instance", instance_axis)
+  .add_int64_axis("Iterations", {1000});
@@ -0,0 +1,189 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/mip/solver_settings.hpp>
+#include <cuopt/linear_programming/pdlp/pdlp_hyper_params.cuh>
+#include <cuopt/linear_programming/solve.hpp>
+#include <mip_heuristics/problem/problem.cuh>
+#include <mip_heuristics/solver.cuh>
+#include <mps_parser/mps_data_model.hpp>
+#include <mps_parser/parser.hpp>
+#include <pdlp/initial_scaling_strategy/initial_scaling.cuh>
+#include <utilities/timer.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/linalg/detail/cublas_wrappers.hpp>
+#include <raft/sparse/detail/cusparse_wrappers.h>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Shared inputs of the kernel microbenchmarks. Every kernel has a benchmark on a synthetic input
+// generated with a fixed seed, so that two builds time the same data, and a "<name>_instance"
+// benchmark on an instance file given on the command line with -a Instance=<path>, which is
+// skipped when no path is given.
+namespace kernel_bench {
+
+using namespace cuopt::linear_programming;
+
+// Values of the "Instance" string axis, "" stands for no instance
+inline const std::vector<std::string> instance_axis{""};
+
+// Path of the instance of the state, skips the state when there is none
+inline bool get_instance_path(nvbench::state& state, std::string& path)
+{
+  path = state.get_string("Instance");
+  if (path.empty()) {
+    state.skip("No instance, pass -a Instance=<path>");
+    return false;
+  }
+  return true;
+}
+
+// Kernels of the benchmarks run on the stream of the handle, nvbench times that stream
+inline void time_on_handle_stream(nvbench::state& state, const raft::handle_t& handle)
+{
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(handle.get_stream().value()));
+}
+
+/**
+ * Random MIP with n_rows ranged constraints of nnz_per_row distinct variables each. The variables
+ * are in [0, 10] and the given fraction of them is integer. The coefficients are in [-1, 1] and
+ * the rows are [-nnz_per_row, nnz_per_row], so that bound propagation tightens a part of the
+ * bounds at every pass.
+ */
+inline cuopt::mps_parser::mps_data_model_t<int, double> make_synthetic_mip(int n_rows,
+                                                                           int n_cols,
+                                                                           int nnz_per_row,
+                                                                           double integer_ratio,
+                                                                           uint64_t seed = 42)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_int_distribution<int> col_dist(0, n_cols - 1);
+  std::uniform_real_distribution<double> coef_dist(-1., 1.);
+  std::uniform_real_distribution<double> unit_dist(0., 1.);
+  nnz_per_row = std::min(nnz_per_row, n_cols);
+
+  std::vector<int> offsets{0};
+  std::vector<int> indices;
+  std::vector<double> values;
+  std::vector<int> row;
+  for (int i = 0; i < n_rows; ++i) {
+    row.clear();
+    while (int(row.size()) < nnz_per_row) {
+      int col = col_dist(rng);
+      if (std::find(row.begin(), row.end(), col) == row.end()) { row.push_back(col); }
+    }
+    std::sort(row.begin(), row.end());
+    for (int col : row) {
+      indices.push_back(col);
+      values.push_back(coef_dist(rng));
+    }
+    offsets.push_back(indices.size());
+  }
+
+  std::vector<double> row_lb(n_rows, -double(nnz_per_row));
+  std::vector<double> row_ub(n_rows, double(nnz_per_row));
+  std::vector<double> var_lb(n_cols, 0.);
+  std::vector<double> var_ub(n_cols, 10.);
+  std::vector<double> objective(n_cols);
+  std::vector<char> types(n_cols);
+  for (int j = 0; j < n_cols; ++j) {
+    objective[j] = coef_dist(rng);
+    types[j]     = unit_dist(rng) < integer_ratio ? 'I' : 'C';
+  }
+
+  cuopt::mps_parser::mps_data_model_t<int, double> model;
+  model.set_csr_constraint_matrix(
+    values.data(), values.size(), indices.data(), indices.size(), offsets.data(), offsets.size());
+  model.set_constraint_lower_bounds(row_lb.data(), n_rows);
+  model.set_constraint_upper_bounds(row_ub.data(), n_rows);
+  model.set_variable_lower_bounds(var_lb.data(), n_cols);
+  model.set_variable_upper_bounds(var_ub.data(), n_cols);
+  model.set_objective_coefficients(objective.data(), n_cols);
+  model.set_variable_types(types);
+  return model;
+}
+
+// raft handle with the pointer mode of the solvers, the scalars of their cuBLAS / cuSPARSE calls
+// are on the device
+struct bench_handle_t : raft::handle_t {
+  bench_handle_t()
+  {
+    RAFT_CUBLAS_TRY(raft::linalg::detail::cublassetpointermode(
+      get_cublas_handle(), CUBLAS_POINTER_MODE_DEVICE, get_stream()));
+    RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsesetpointermode(
+      get_cusparse_handle(), CUSPARSE_POINTER_MODE_DEVICE, get_stream()));
+  }
+};
+
+/**
+ * Preprocessed MIP problem and solver context, as the MIP solver builds them before running its
+ * heuristics. Not movable, the problem and the context keep pointers to the members.
+ */
+struct mip_context_t {
+  explicit mip_context_t(const cuopt::mps_parser::mps_data_model_t<int, double>& model)
+    : op_problem(mps_data_model_to_optimization_problem(&handle, model)),
+      problem(op_problem),
+      scaling(&handle,
+              preprocessed(problem),
+              10,
+              1.0,
+              problem.reverse_coefficients,
+              problem.reverse_offsets,
+              problem.reverse_constraints,
+              nullptr,
+              hyper_params,
+              true),
+      solver(problem, settings, scaling, cuopt::timer_t(0))
+  {
+    handle.sync_stream();
+  }
+  mip_context_t(const mip_context_t&)            = delete;
+  mip_context_t& operator=(const mip_context_t&) = delete;
+
+  bench_handle_t handle{};
+  optimization_problem_t<int, double> op_problem;
+  detail::problem_t<int, double> problem;
+  mip_solver_settings_t<int, double> settings{};
+  pdlp_hyper_params::pdlp_hyper_params_t hyper_params{};
+  detail::pdlp_initial_scaling_strategy_t<int, double> scaling;
+  detail::mip_solver_t<int, double> solver;
+
+ private:
+  static detail::problem_t<int, double>& preprocessed(detail::problem_t<int, double>& problem)
+  {
+    problem.preprocess_problem();
+    return problem;
+  }
+};
+
+// Context of the synthetic MIP of the "Rows" and "NnzPerRow" axes
+inline std::unique_ptr<mip_context_t> make_synthetic_mip_context(nvbench::state& state)
+{
+  const int n_rows = state.get_int64("Rows");
+  return std::make_unique<mip_context_t>(
+    make_synthetic_mip(n_rows, n_rows, state.get_int64("NnzPerRow"), 0.5));
+}
+
+// Context of the MPS instance of the state, nullptr when the state is skipped
+inline std::unique_ptr<mip_context_t> make_instance_mip_context(nvbench::state& state)
+{
+  std::string path;
+  if (!get_instance_path(state, path)) { return nullptr; }
+  return std::make_unique<mip_context_t>(cuopt::mps_parser::parse_mps<int, double>(path, false));
+}
+
+}  // namespace kernel_bench
@@ -0,0 +1,144 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+// Insertion move evaluation of the routing local search (routing/local_search/
+// compute_insertions.cu) on the routes of a short solve. Every order is evaluated at every position
+// of the compatible routes, which are staged in shared memory, so that the throughput is reported
+// in evaluated positions rather than in bytes.
+
+#include "kernel_bench_utils.cuh"
+
+#include "../routing/cuopt/routing_instance_reader.hpp"
+
+#include <cuopt/routing/data_model_view.hpp>
+#include <cuopt/routing/solve.hpp>
+#include <cuopt/routing/solver_settings.hpp>
+
+#include <routing/adapters/solution_adapter.cuh>
+#include <routing/local_search/compute_insertions.cuh>
+#include <routing/local_search/local_search.cuh>
+#include <routing/problem/problem.cuh>
+#include <routing/routing_helpers.cuh>
+#include <routing/solution/solution.cuh>
+#include <utilities/copy_helpers.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+namespace {
+
+namespace routing = cuopt::routing;
+
+// Random capacitated instance of n_locations around the depot, with a fixed seed
+routing_instance_t make_synthetic_cvrp(int n_locations, uint64_t seed = 42)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<float> coord_dist(0.f, 100.f);
+  std::uniform_int_distribution<int> demand_dist(1, 10);
+  routing_instance_t instance;
+  int total_demand = 0;
+  for (int i = 0; i < n_locations; ++i) {
+    const int demand = i == 0 ? 0 : demand_dist(rng);
+    total_demand += demand;
+    instance.add_location(
+      coord_dist(rng), coord_dist(rng), demand, 0, std::numeric_limits<int>::max(), 0);
+  }
+  instance.n_locations = n_locations;
+  instance.n_vehicles  = std::max(n_locations / 10, 1);
+  instance.capacity.assign(instance.n_vehicles, int(1.2 * total_demand / instance.n_vehicles) + 10);
+  return instance;
+}
+
+template <routing::request_t REQUEST>
+void run_insertions(nvbench::state& state,
+                    const raft::handle_t& handle,
+                    const routing::data_model_view_t<int, float>& data_model)
+{
+  // A short solve gives routes of a realistic length and load
+  routing::solver_settings_t<int, float> settings;
+  settings.set_time_limit(state.get_float64("SolveTime"));
+  auto assignment = routing::solve(data_model, settings);
+  handle.sync_stream();
+  if (assignment.get_status() != routing::solution_status_t::SUCCESS) {
+    state.skip("No routes found");
+    return;
+  }
+
+  routing::detail::problem_t<int, float> problem(data_model, settings);
+  routing::detail::solution_handle_t<int, float> sol_handle(problem.handle_ptr->get_stream());
+  routing::detail::solution_t<int, float, REQUEST> sol(problem, 0, &sol_handle);
+  routing::detail::get_solution_from_assignment(sol, assignment, problem);
+  routing::detail::local_search_t<int, float, REQUEST> ls(&sol_handle,
+                                                          problem.get_num_orders(),
+                                                          problem.get_fleet_size(),
+                                                          problem.order_info.depot_included_,
+                                                          problem.viables);
+  ls.set_active_weights(routing::detail::default_weights, true);
+  sol_handle.sync_stream();
+
+  const size_t n_orders = problem.get_num_orders();
+  state.add_element_count(n_orders * (n_orders + sol.n_routes), "Positions");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    ls.move_candidates.reset(&sol_handle);
+    ls.calculate_route_compatibility(sol);
+    routing::detail::find_insertions<int, float, REQUEST>(
+      sol, ls.move_candidates, routing::detail::search_type_t::IMPROVE);
+    sol_handle.sync_stream();
+  });
+}
+
+void run_instance(nvbench::state& state, const routing_instance_t& instance)
+{
+  raft::handle_t handle;
+  auto stream      = handle.get_stream();
+  auto cost_matrix = cuopt::device_copy(instance.build_cost_matrix(), stream);
+  auto demand      = cuopt::device_copy(instance.demand, stream);
+  auto capacity    = cuopt::device_copy(instance.capacity, stream);
+  auto earliest    = cuopt::device_copy(instance.earliest, stream);
+  auto latest      = cuopt::device_copy(instance.latest, stream);
+  auto service     = cuopt::device_copy(instance.service, stream);
+  auto pickups     = cuopt::device_copy(instance.pickup_indices, stream);
+  auto deliveries  = cuopt::device_copy(instance.delivery_indices, stream);
+
+  routing::data_model_view_t<int, float> data_model(
+    &handle, instance.n_locations, instance.n_vehicles, instance.n_locations);
+  data_model.add_cost_matrix(cost_matrix.data());
+  data_model.add_capacity_dimension("demand", demand.data(), capacity.data());
+  if (instance.has_time_windows) {
+    data_model.set_order_time_windows(earliest.data(), latest.data());
+    data_model.set_order_service_times(service.data());
+  }
+  if (instance.pickup_indices.empty()) {
+    run_insertions<routing::request_t::VRP>(state, handle, data_model);
+  } else {
+    data_model.set_pickup_delivery_pairs(pickups.data(), deliveries.data());
+    run_insertions<routing::request_t::PDP>(state, handle, data_model);
+  }
+}
+
+void route_insertions(nvbench::state& state)
+{
+  run_instance(state, make_synthetic_cvrp(state.get_int64("Locations")));
+}
+
+// Solomon, Homberger, Li & Lim or CVRPLIB file, as read by solve_routing
+void route_insertions_instance(nvbench::state& state)
+{
+  std::string path;
+  if (kernel_bench::get_instance_path(state, path)) {
+    run_instance(state, read_routing_instance(path));
+  }
+}
+
+}  // namespace
+
+NVBENCH_BENCH(route_insertions)
+  .add_int64_axis("Locations", {101, 401, 1001})
+  .add_float64_axis("SolveTime", {2.});
+
+NVBENCH_BENCH(route_insertions_instance)
+  .add_string_axis("Instance", kernel_bench::instance_axis)
+  .add_float64_axis("SolveTime", {2.});
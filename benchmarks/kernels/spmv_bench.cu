@@ -0,0 +1,248 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+// cuSPARSE SpMV and SpMM of PDLP (pdlp/cusparse_view.cu): A x and A^T y with the CSR ALG2 of the
+// PDHG steps, and the batch products of batch PDLP with one column per climber
+
+#include "kernel_bench_utils.cuh"
+
+#include <pdlp/cusparse_view.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+
+#include <numeric>
+
+namespace {
+
+using namespace kernel_bench;
+
+struct host_csr_t {
+  int n_rows;
+  int n_cols;
+  std::vector<int> offsets;
+  std::vector<int> indices;
+  std::vector<double> values;
+};
+
+host_csr_t constraint_matrix(const cuopt::mps_parser::mps_data_model_t<int, double>& model)
+{
+  return {model.get_n_constraints(),
+          model.get_n_variables(),
+          model.get_constraint_matrix_offsets(),
+          model.get_constraint_matrix_indices(),
+          model.get_constraint_matrix_values()};
+}
+
+host_csr_t transpose(const host_csr_t& A)
+{
+  host_csr_t A_T{A.n_cols, A.n_rows, std::vector<int>(A.n_cols + 1, 0), {}, {}};
+  for (int col : A.indices) {
+    ++A_T.offsets[col + 1];
+  }
+  std::partial_sum(A_T.offsets.begin(), A_T.offsets.end(), A_T.offsets.begin());
+  A_T.indices.resize(A.indices.size());
+  A_T.values.resize(A.values.size());
+  std::vector<int> next(A_T.offsets.begin(), A_T.offsets.end() - 1);
+  for (int i = 0; i < A.n_rows; ++i) {
+    for (int k = A.offsets[i]; k < A.offsets[i + 1]; ++k) {
+      const int pos    = next[A.indices[k]]++;
+      A_T.indices[pos] = i;
+      A_T.values[pos]  = A.values[k];
+    }
+  }
+  return A_T;
+}
+
+// Device copy of a CSR matrix with its cuSPARSE descriptor
+struct device_csr_t {
+  device_csr_t(const host_csr_t& A, rmm::cuda_stream_view stream)
+    : n_rows(A.n_rows),
+      n_cols(A.n_cols),
+      offsets(cuopt::device_copy(A.offsets, stream)),
+      indices(cuopt::device_copy(A.indices, stream)),
+      values(cuopt::device_copy(A.values, stream))
+  {
+    descr.create(n_rows, n_cols, values.size(), offsets.data(), indices.data(), values.data());
+  }
+
+  // Bytes of the matrix, each entry is read once per product
+  size_t bytes() const
+  {
+    return values.size() * (sizeof(double) + sizeof(int)) + offsets.size() * sizeof(int);
+  }
+
+  int n_rows;
+  int n_cols;
+  rmm::device_uvector<int> offsets;
+  rmm::device_uvector<int> indices;
+  rmm::device_uvector<double> values;
+  detail::cusparse_sp_mat_descr_wrapper_t<int, double> descr;
+};
+
+// y = A x, the dense operands are counted once: x is gathered through the cache
+void run_spmv(nvbench::state& state, const host_csr_t& host_A)
+{
+  bench_handle_t handle;
+  auto stream = handle.get_stream();
+  device_csr_t A(host_A, stream);
+  rmm::device_uvector<double> x(A.n_cols, stream);
+  rmm::device_uvector<double> y(A.n_rows, stream);
+  thrust::fill(handle.get_thrust_policy(), x.begin(), x.end(), 1.0);
+  rmm::device_scalar<double> alpha(1.0, stream);
+  rmm::device_scalar<double> beta(0.0, stream);
+  detail::cusparse_dn_vec_descr_wrapper_t<double> x_descr;
+  detail::cusparse_dn_vec_descr_wrapper_t<double> y_descr;
+  x_descr.create(x.size(), x.data());
+  y_descr.create(y.size(), y.data());
+
+  auto cusparse      = handle.get_cusparse_handle();
+  size_t buffer_size = 0;
+  RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmv_buffersize(cusparse,
+                                                                   CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                                   alpha.data(),
+                                                                   A.descr,
+                                                                   x_descr,
+                                                                   beta.data(),
+                                                                   y_descr,
+                                                                   CUSPARSE_SPMV_CSR_ALG2,
+                                                                   &buffer_size,
+                                                                   stream));
+  rmm::device_uvector<uint8_t> buffer(buffer_size, stream);
+  handle.sync_stream();
+
+  state.add_element_count(A.values.size(), "NNZ");
+  state.add_global_memory_reads<uint8_t>(A.bytes() + x.size() * sizeof(double), "Matrix + x");
+  state.add_global_memory_writes<double>(y.size(), "y");
+  time_on_handle_stream(state, handle);
+  state.exec([&](nvbench::launch&) {
+    RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmv(cusparse,
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         alpha.data(),
+                                                         A.descr,
+                                                         x_descr,
+                                                         beta.data(),
+                                                         y_descr,
+                                                         CUSPARSE_SPMV_CSR_ALG2,
+                                                         (double*)buffer.data(),
+                                                         stream));
+  });
+}
+
+// Y = A X with X and Y row major, as the batch PDLP solutions of the climbers
+void run_spmm(nvbench::state& state, const host_csr_t& host_A)
+{
+  const auto batch_size = state.get_int64("BatchSize");
+  bench_handle_t handle;
+  auto stream = handle.get_stream();
+  device_csr_t A(host_A, stream);
+  rmm::device_uvector<double> X(size_t(A.n_cols) * batch_size, stream);
+  rmm::device_uvector<double> Y(size_t(A.n_rows) * batch_size, stream);
+  thrust::fill(handle.get_thrust_policy(), X.begin(), X.end(), 1.0);
+  rmm::device_scalar<double> alpha(1.0, stream);
+  rmm::device_scalar<double> beta(0.0, stream);
+  detail::cusparse_dn_mat_descr_wrapper_t<double> X_descr;
+  detail::cusparse_dn_mat_descr_wrapper_t<double> Y_descr;
+  X_descr.create(A.n_cols, batch_size, batch_size, X.data(), CUSPARSE_ORDER_ROW);
+  Y_descr.create(A.n_rows, batch_size, batch_size, Y.data(), CUSPARSE_ORDER_ROW);
+
+  auto cusparse      = handle.get_cusparse_handle();
+  size_t buffer_size = 0;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm_bufferSize(cusparse,
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  alpha.data(),
+                                                  A.descr,
+                                                  X_descr,
+                                                  beta.data(),
+                                                  Y_descr,
+                                                  CUSPARSE_SPMM_CSR_ALG2,
+                                                  &buffer_size,
+                                                  stream));
+  rmm::device_uvector<uint8_t> buffer(buffer_size, stream);
+  handle.sync_stream();
+
+  state.add_element_count(A.values.size() * batch_size, "NNZ x BatchSize");
+  state.add_global_memory_reads<uint8_t>(A.bytes() + X.size() * sizeof(double), "Matrix + X");
+  state.add_global_memory_writes<double>(Y.size(), "Y");
+  time_on_handle_stream(state, handle);
+  state.exec([&](nvbench::launch&) {
+    RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmm(cusparse,
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         alpha.data(),
+                                                         A.descr,
+                                                         X_descr,
+                                                         beta.data(),
+                                                         Y_descr,
+                                                         CUSPARSE_SPMM_CSR_ALG2,
+                                                         (double*)buffer.data(),
+                                                         stream));
+  });
+}
+
+// A or A^T of the "Transpose" axis
+host_csr_t operand(nvbench::state& state, host_csr_t A)
+{
+  return state.get_int64("Transpose") ? transpose(A) : A;
+}
+
+host_csr_t synthetic_matrix(nvbench::state& state)
+{
+  const int n_rows = state.get_int64("Rows");
+  return constraint_matrix(make_synthetic_mip(n_rows, n_rows, state.get_int64("NnzPerRow"), 0.));
+}
+
+bool instance_matrix(nvbench::state& state, host_csr_t& A)
+{
+  std::string path;
+  if (!get_instance_path(state, path)) { return false; }
+  A = constraint_matrix(cuopt::mps_parser::parse_mps<int, double>(path, false));
+  return true;
+}
+
+void spmv(nvbench::state& state) { run_spmv(state, operand(state, synthetic_matrix(state))); }
+
+void spmv_instance(nvbench::state& state)
+{
+  host_csr_t A;
+  if (instance_matrix(state, A)) { run_spmv(state, operand(state, std::move(A))); }
+}
+
+void spmm(nvbench::state& state) { run_spmm(state, operand(state, synthetic_matrix(state))); }
+
+void spmm_instance(nvbench::state& state)
+{
+  host_csr_t A;
+  if (instance_matrix(state, A)) { run_spmm(state, operand(state, std::move(A))); }
+}
+
+}  // namespace
+
+NVBENCH_BENCH(spmv)
+  .add_int64_power_of_two_axis("Rows", nvbench::range(16, 22, 2))
+  .add_int64_axis("NnzPerRow", {4, 16, 64})
+  .add_int64_axis("Transpose", {0, 1});
+
+NVBENCH_BENCH(spmv_instance)
+  .add_string_axis("Instance", instance_axis)
+  .add_int64_axis("Transpose", {0, 1});
+
+NVBENCH_BENCH(spmm)
+  .add_int64_power_of_two_axis("Rows", nvbench::range(16, 20, 2))
+  .add_int64_axis("NnzPerRow", {16})
+  .add_int64_axis("Transpose", {0, 1})
+  .add_int64_power_of_two_axis("BatchSize", nvbench::range(2, 6, 2));
+
+NVBENCH_BENCH(spmm_instance)
+  .add_string_axis("Instance", instance_axis)
+  .add_int64_axis("Transpose", {0, 1})
+  .add_int64_power_of_two_axis("BatchSize", nvbench::range(2, 6, 2));
@@ -0,0 +1,156 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+// Triangular solves of the dual simplex basis factors (dual_simplex/triangle_solve.cpp), dense and
+// with a sparse right-hand side. They run on the host: nvbench's bandwidth columns compare with
+// the device peak, so that the throughput is reported in nonzeros of the factor per second.
+
+#include <dual_simplex/sparse_matrix.hpp>
+#include <dual_simplex/sparse_vector.hpp>
+#include <dual_simplex/triangle_solve.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+
+namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+
+/**
+ * Random unit triangular factor of n columns with nnz_per_col off-diagonal entries each, with the
+ * layout of the LU factors: the diagonal is the first entry of a column of L and the last of U.
+ */
+dual_simplex::csc_matrix_t<int, double> make_triangular(int n,
+                                                        int nnz_per_col,
+                                                        bool lower,
+                                                        uint64_t seed = 42)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> value_dist(-1., 1.);
+  dual_simplex::csc_matrix_t<int, double> G(n, n, 0);
+  std::vector<int> rows;
+  for (int j = 0; j < n; ++j) {
+    G.col_start[j] = G.i.size();
+    // Off-diagonal entries are below the diagonal in L and above it in U
+    const int lo = lower ? j + 1 : 0;
+    const int hi = lower ? n - 1 : j - 1;
+    rows.clear();
+    if (lo <= hi) {
+      std::uniform_int_distribution<int> row_dist(lo, hi);
+      const int count = std::min(nnz_per_col, hi - lo + 1);
+      while (int(rows.size()) < count) {
+        const int row = row_dist(rng);
+        if (std::find(rows.begin(), rows.end(), row) == rows.end()) { rows.push_back(row); }
+      }
+      std::sort(rows.begin(), rows.end());
+    }
+    if (lower) {
+      G.i.push_back(j);
+      G.x.push_back(1.);
+    }
+    for (int row : rows) {
+      G.i.push_back(row);
+      G.x.push_back(value_dist(rng) / nnz_per_col);
+    }
+    if (!lower) {
+      G.i.push_back(j);
+      G.x.push_back(1.);
+    }
+  }
+  G.col_start[n] = G.i.size();
+  G.nz_max       = G.i.size();
+  return G;
+}
+
+void triangle_solve_dense(nvbench::state& state)
+{
+  const int n      = state.get_int64("Columns");
+  const bool lower = state.get_int64("Lower");
+  const auto G     = make_triangular(n, state.get_int64("NnzPerCol"), lower);
+  std::vector<double> x(n);
+  double work_estimate = 0.;
+
+  state.add_element_count(G.i.size(), "NNZ");
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch&, auto& timer) {
+               std::fill(x.begin(), x.end(), 1.);
+               timer.start();
+               if (lower) {
+                 dual_simplex::lower_triangular_solve(G, x, work_estimate);
+               } else {
+                 dual_simplex::upper_triangular_solve(G, x, work_estimate);
+               }
+               timer.stop();
+             });
+}
+
+// Hypersparse solve of the simplex iterations, the right-hand side has RhsNnz random entries and
+// the solve visits the columns of its reach only
+void triangle_solve_sparse(nvbench::state& state)
+{
+  const int n      = state.get_int64("Columns");
+  const bool lower = state.get_int64("Lower");
+  const auto G     = make_triangular(n, state.get_int64("NnzPerCol"), lower);
+  const int rhs_nz = std::min<int>(state.get_int64("RhsNnz"), n);
+
+  std::mt19937_64 rng(7);
+  std::vector<int> rhs_rows(n);
+  std::iota(rhs_rows.begin(), rhs_rows.end(), 0);
+  std::shuffle(rhs_rows.begin(), rhs_rows.end(), rng);
+  dual_simplex::sparse_vector_t<int, double> b(n, rhs_nz);
+  for (int k = 0; k < rhs_nz; ++k) {
+    b.i[k] = rhs_rows[k];
+    b.x[k] = 1.;
+  }
+
+  const std::optional<std::vector<int>> pinv;
+  std::vector<int> xi(2 * n);
+  std::vector<char> marked(n, 0);
+  std::vector<double> x(n, 0.);
+  double work_estimate = 0.;
+  auto solve           = [&]() {
+    if (lower) {
+      return dual_simplex::sparse_triangle_solve<int, double, true>(
+        b, pinv, xi, G, marked, x.data(), work_estimate);
+    }
+    return dual_simplex::sparse_triangle_solve<int, double, false>(
+      b, pinv, xi, G, marked, x.data(), work_estimate);
+  };
+
+  // The nonzeros of the reached columns are the ones the solve reads
+  const int top   = solve();
+  size_t reach_nz = 0;
+  for (int p = top; p < n; ++p) {
+    reach_nz += G.col_start[xi[p] + 1] - G.col_start[xi[p]];
+  }
+  state.add_element_count(reach_nz, "NNZ reached");
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch&, auto& timer) {
+               timer.start();
+               solve();
+               timer.stop();
+             });
+}
+
+}  // namespace
+
+NVBENCH_BENCH(triangle_solve_dense)
+  .add_int64_power_of_two_axis("Columns", nvbench::range(14, 20, 2))
+  .add_int64_axis("NnzPerCol", {2, 8})
+  .add_int64_axis("Lower", {1, 0});
+
+NVBENCH_BENCH(triangle_solve_sparse)
+  .add_int64_power_of_two_axis("Columns", nvbench::range(14, 20, 2))
+  .add_int64_axis("NnzPerCol", {2})
+  .add_int64_axis("RhsNnz", {1, 16, 256})
+  .add_int64_axis("Lower", {1, 0});
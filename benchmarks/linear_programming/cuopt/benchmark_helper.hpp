@@ -88,13 +88,16 @@ void fill_pdlp_hyper_params(
     {"restart_k_p", &params.restart_k_p},
     {"restart_k_i", &params.restart_k_i},
     {"restart_k_d", &params.restart_k_d},
-    {"restart_i_smooth", &params.restart_i_smooth}};
+    {"restart_i_smooth", &params.restart_i_smooth},
+    {"speculative_step_size_ratio", &params.speculative_step_size_ratio}};
 
   std::map<std::string, int*> int_settings = {
     {"default_l_inf_ruiz_iterations", &params.default_l_inf_ruiz_iterations},
     {"major_iteration", &params.major_iteration},
     {"min_iteration_restart", &params.min_iteration_restart},
     {"restart_strategy", &params.restart_strategy},
+    {"mixed_precision_stall_checks", &params.mixed_precision_stall_checks},
+    {"speculative_step_size_candidates", &params.speculative_step_size_candidates},
   };
 
   std::map<std::string, bool*> bool_settings = {
@@ -119,7 +122,9 @@ void fill_pdlp_hyper_params(
     {"bound_objective_rescaling", &params.bound_objective_rescaling},
     {"use_reflected_primal_dual", &params.use_reflected_primal_dual},
     {"use_fixed_point_error", &params.use_fixed_point_error},
-    {"use_conditional_major", &params.use_conditional_major}};
+    {"use_conditional_major", &params.use_conditional_major},
+    {"use_fused_spmv_projection", &params.use_fused_spmv_projection},
+    {"use_mixed_precision_spmv", &params.use_mixed_precision_spmv}};
 
   while (std::getline(file, line)) {
     std::istringstream iss(line);
@@ -0,0 +1,175 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/utilities/internals.hpp>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// One benchmark run written as a single line JSON object. The runs of a suite are appended to the
+// same JSON lines file, which benchmarks/linear_programming/utils/compare_benchmarks.py reads
+class benchmark_record_t {
+ public:
+  template <typename T>
+  void add(const std::string& key, const T& value)
+  {
+    std::ostringstream ss;
+    if constexpr (std::is_same_v<T, bool>) {
+      ss << (value ? "true" : "false");
+    } else if constexpr (std::is_integral_v<T>) {
+      ss << value;
+    } else if constexpr (std::is_floating_point_v<T>) {
+      // JSON has no representation for infinities and NaNs
+      if (std::isfinite(value)) {
+        ss << std::setprecision(17) << value;
+      } else {
+        ss << "null";
+      }
+    } else {
+      ss << quote(std::string(value));
+    }
+    fields_.emplace_back(key, ss.str());
+  }
+
+  std::string to_json() const
+  {
+    std::string json = "{";
+    for (size_t i = 0; i < fields_.size(); ++i) {
+      if (i > 0) { json += ", "; }
+      json += quote(fields_[i].first) + ": " + fields_[i].second;
+    }
+    return json + "}";
+  }
+
+  // The file is locked while the line is written, the MIP benchmark runs one process per GPU
+  bool append_to(const std::string& file_path) const
+  {
+    int fd = open(file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) { return false; }
+    flock(fd, LOCK_EX);
+    const std::string line = to_json() + "\n";
+    bool written           = write(fd, line.data(), line.size()) == ssize_t(line.size());
+    flock(fd, LOCK_UN);
+    close(fd);
+    return written;
+  }
+
+ private:
+  static std::string quote(const std::string& str)
+  {
+    std::string quoted = "\"";
+    for (char c : str) {
+      if (c == '"' || c == '\\') {
+        quoted += '\\';
+        quoted += c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        char escaped[8];
+        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        quoted += escaped;
+      } else {
+        quoted += c;
+      }
+    }
+    return quoted + "\"";
+  }
+
+  std::vector<std::pair<std::string, std::string>> fields_;
+};
+
+// Peak resident set size of the process in bytes
+inline size_t peak_host_memory_bytes()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  // ru_maxrss is in kilobytes on Linux
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+}
+
+// Records the time, objective and bound of every incumbent reported during a MIP solve so that the
+// primal-dual integral of the run can be computed
+class incumbent_trace_t : public cuopt::internals::get_solution_callback_t {
+ public:
+  struct event_t {
+    double time;
+    double objective;
+    double bound;
+  };
+
+  incumbent_trace_t() : start_(std::chrono::steady_clock::now()) {}
+
+  void get_solution(void*, void* objective_value, void* solution_bound, void*) override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back({elapsed(),
+                       *static_cast<double*>(objective_value),
+                       *static_cast<double*>(solution_bound)});
+  }
+
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+  }
+
+  size_t n_incumbents() const { return events_.size(); }
+
+  // Time of the first incumbent, NaN if none was found
+  double time_to_first_incumbent() const
+  {
+    return events_.empty() ? std::numeric_limits<double>::quiet_NaN() : events_.front().time;
+  }
+
+  /**
+   * Primal-dual integral [Berthold 2013] over [0, end_time]: the integral of the gap function,
+   * which is 1 until an incumbent is found or while the objective and bound have opposite signs
+   * and |objective - bound| / max(|objective|, |bound|) otherwise. The bound is only known at the
+   * incumbents and is held until the next one, which overestimates the integral when the bound
+   * improves between two incumbents.
+   */
+  double primal_dual_integral(double end_time) const
+  {
+    double integral  = 0.;
+    double prev_time = 0.;
+    double prev_gap  = 1.;
+    for (const auto& event : events_) {
+      const double time = std::min(event.time, end_time);
+      integral += prev_gap * (time - prev_time);
+      prev_time = time;
+      prev_gap  = gap(event.objective, event.bound);
+    }
+    return integral + prev_gap * std::max(end_time - prev_time, 0.);
+  }
+
+  static double gap(double objective, double bound)
+  {
+    if (!std::isfinite(objective) || !std::isfinite(bound)) { return 1.; }
+    if (objective == bound) { return 0.; }
+    if (objective * bound < 0) { return 1.; }
+    return std::min(std::abs(objective - bound) / std::max(std::abs(objective), std::abs(bound)),
+                    1.);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::chrono::steady_clock::time_point start_;
+  std::vector<event_t> events_;
+};
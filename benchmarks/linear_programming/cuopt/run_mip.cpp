@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
+#include "benchmark_record.hpp"
 #include "initial_solution_reader.hpp"
 #include "mip_test_instances.hpp"
 
@@ -21,6 +22,7 @@
 #include <rmm/mr/limiting_resource_adaptor.hpp>
 #include <rmm/mr/logging_resource_adaptor.hpp>
 #include <rmm/mr/pool_memory_resource.hpp>
+#include <rmm/mr/statistics_resource_adaptor.hpp>
 #include <rmm/mr/tracking_resource_adaptor.hpp>
 
 #include <rmm/mr/owning_wrapper.hpp>
@@ -150,7 +152,11 @@ int run_single_file(std::string file_path,
                     int reliability_branching,
                     double time_limit,
                     double work_limit,
-                    bool deterministic)
+                    bool deterministic,
+                    int seed,
+                    std::optional<std::string> json_output,
+                    int node_limit,
+                    cuopt::linear_programming::benchmark_info_t* benchmark_info_out)
 {
   const raft::handle_t handle_{};
   cuopt::linear_programming::mip_solver_settings_t<int, double> settings;
@@ -209,11 +215,23 @@ int run_single_file(std::string file_path,
   settings.tolerances.absolute_tolerance = 1e-6;
   settings.presolver                     = cuopt::linear_programming::presolver_t::Default;
   settings.reliability_branching         = reliability_branching;
-  settings.seed                          = 42;
+  settings.seed                          = seed;
+  if (node_limit >= 0) { settings.node_limit = node_limit; }
   cuopt::linear_programming::benchmark_info_t benchmark_info;
   settings.benchmark_info_ptr = &benchmark_info;
-  auto start_run_solver       = std::chrono::high_resolution_clock::now();
+  // The incumbents are traced and the allocations counted only when the run is recorded
+  incumbent_trace_t incumbent_trace;
+  auto* upstream_mr = rmm::mr::get_current_device_resource();
+  std::optional<rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>> stats_mr;
+  if (json_output.has_value()) {
+    settings.set_mip_callback(&incumbent_trace);
+    stats_mr.emplace(upstream_mr);
+    rmm::mr::set_current_device_resource(&stats_mr.value());
+  }
+  auto start_run_solver = std::chrono::high_resolution_clock::now();
   auto solution = cuopt::linear_programming::solve_mip(&handle_, mps_data_model, settings);
+
+  const double wall_time = incumbent_trace.elapsed();
   CUOPT_LOG_INFO(
     "first obj: %f last improvement of best feasible: %f last improvement after recombination: %f",
     benchmark_info.objective_of_initial_population,
@@ -249,6 +267,31 @@ int run_single_file(std::string file_path,
      << "\n";
   write_to_output_file(out_dir, base_filename, device, n_gpus, batch_id, ss.str());
   CUOPT_LOG_INFO("Results written to the file %s", base_filename.c_str());
+  if (json_output.has_value()) {
+    benchmark_record_t record;
+    record.add("instance", std::filesystem::path(base_filename).stem().string());
+    record.add("problem_type", "MIP");
+    record.add("seed", seed);
+    record.add("status", solution.get_termination_status_string());
+    record.add("objective", sol_found ? obj_val : std::numeric_limits<double>::quiet_NaN());
+    record.add("bound", solution.get_solution_bound());
+    record.add("mip_gap", mip_gap);
+    record.add("wall_time", wall_time);
+    record.add("solve_time", solution.get_total_solve_time());
+    record.add("presolve_time", solution.get_presolve_time());
+    record.add("time_to_first_incumbent", incumbent_trace.time_to_first_incumbent());
+    record.add("incumbents", incumbent_trace.n_incumbents());
+    record.add("primal_dual_integral", incumbent_trace.primal_dual_integral(wall_time));
+    record.add("nodes", solution.get_num_nodes());
+    record.add("simplex_iterations", solution.get_num_simplex_iterations());
+    record.add("peak_device_memory", stats_mr->get_bytes_counter().peak);
+    record.add("peak_host_memory", peak_host_memory_bytes());
+    if (!record.append_to(json_output.value())) {
+      CUOPT_LOG_ERROR("Could not write the benchmark record to %s", json_output.value().c_str());
+    }
+    rmm::mr::set_current_device_resource(upstream_mr);
+  }
+  if (benchmark_info_out != nullptr) { *benchmark_info_out = benchmark_info; }
   return sol_found;
 }
 
@@ -265,7 +308,10 @@ void run_single_file_mp(std::string file_path,
                         int reliability_branching,
                         double time_limit,
                         double work_limit,
-                        bool deterministic)
+                        bool deterministic,
+                        int seed,
+                        std::optional<std::string> json_output,
+                        int node_limit)
 {
   std::cout << "running file " << file_path << " on gpu : " << device << std::endl;
   auto memory_resource = make_async();
@@ -283,12 +329,84 @@ void run_single_file_mp(std::string file_path,
                                   reliability_branching,
                                   time_limit,
                                   work_limit,
-                                  deterministic);
+                                  deterministic,
+                                  seed,
+                                  json_output,
+                                  node_limit,
+                                  nullptr);
   // this is a bad design to communicate the result but better than adding complexity of IPC or
   // pipes
   exit(sol_found);
 }
 
+// Sweeps the number of CPU threads (1, 2, 4, ..., max_threads) on every instance with a fixed node
+// limit, to see where the tree search stops scaling. Each row reports the nodes per second per
+// thread, the time the threads were blocked on the shared branch and bound locks and the idle time
+// of the workers
+void run_thread_scaling(const std::vector<std::string>& paths,
+                        const std::string& out_dir,
+                        int max_threads,
+                        int node_limit,
+                        bool log_to_console,
+                        int reliability_branching,
+                        double time_limit,
+                        int seed)
+{
+  std::vector<int> thread_counts;
+  for (int n_threads = 1; n_threads < max_threads; n_threads *= 2) {
+    thread_counts.push_back(n_threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  std::stringstream ss;
+  ss << "instance,threads,nodes,tree_search_time,nodes_per_sec_per_thread,upper_bound_wait,"
+        "heuristic_queue_wait,original_lp_wait,contended_locks,mean_worker_idle,max_worker_idle\n";
+  for (const auto& path : paths) {
+    std::string instance = std::filesystem::path(path).stem().string();
+    for (int n_threads : thread_counts) {
+      cuopt::linear_programming::benchmark_info_t info;
+      run_single_file(path,
+                      0,
+                      0,
+                      1,
+                      out_dir,
+                      std::nullopt,
+                      false,
+                      n_threads,
+                      false,
+                      log_to_console,
+                      reliability_branching,
+                      time_limit,
+                      std::numeric_limits<double>::infinity(),
+                      false,
+                      seed,
+                      std::nullopt,
+                      node_limit,
+                      &info);
+      double nodes_per_sec_per_thread =
+        info.tree_search_time > 0 ? info.tree_search_nodes / info.tree_search_time / n_threads : 0;
+      double total_idle = 0;
+      double max_idle   = 0;
+      for (double idle : info.worker_idle_time) {
+        total_idle += idle;
+        max_idle = std::max(max_idle, idle);
+      }
+      double mean_idle =
+        info.worker_idle_time.empty() ? 0 : total_idle / info.worker_idle_time.size();
+      ss << std::fixed << std::setprecision(4) << instance << "," << n_threads << ","
+         << info.tree_search_nodes << "," << info.tree_search_time << ","
+         << nodes_per_sec_per_thread << "," << info.upper_bound_lock_wait_time << ","
+         << info.heuristic_queue_lock_wait_time << "," << info.original_lp_lock_wait_time << ","
+         << info.num_contended_locks << "," << mean_idle << "," << max_idle << "\n";
+    }
+  }
+  std::cout << ss.str();
+  if (out_dir != "") {
+    std::ofstream outfile(out_dir + "/thread_scaling.csv");
+    outfile << ss.str();
+  }
+}
+
 void return_gpu_to_the_queue(std::unordered_map<pid_t, int>& pid_gpu_map,
                              std::unordered_map<pid_t, std::string>& pid_file_map,
                              std::queue<int>& gpu_queue)
@@ -381,6 +499,25 @@ int main(int argc, char* argv[])
     .default_value(false)
     .implicit_value(true);
 
+  program.add_argument("--seed").help("random seed").scan<'i', int>().default_value(42);
+
+  program.add_argument("--node-limit")
+    .help("maximum number of branch and bound nodes, -1 for no limit")
+    .scan<'i', int>()
+    .default_value(-1);
+
+  program.add_argument("--thread-scaling")
+    .help(
+      "sweep the number of CPU threads 1, 2, 4, ... up to the given value on the instances of the "
+      "path (or the selected ones) and report the branch and bound scaling and lock contention")
+    .scan<'i', int>()
+    .default_value(0);
+
+  program.add_argument("--json-output")
+    .help(
+      "path of a JSON lines file to which one record per instance is appended (wall time, "
+      "primal-dual integral, nodes, peak memory)");
+
   // Parse arguments
   try {
     program.parse_args(argc, argv);
@@ -412,6 +549,11 @@ int main(int argc, char* argv[])
   bool track_allocations    = program.get<std::string>("--track-allocations")[0] == 't';
   int reliability_branching = program.get<int>("--reliability-branching");
   bool deterministic        = program.get<bool>("--determinism");
+  int seed                  = program.get<int>("--seed");
+  int node_limit            = program.get<int>("--node-limit");
+  int thread_scaling        = program.get<int>("--thread-scaling");
+  std::optional<std::string> json_output;
+  if (program.is_used("--json-output")) { json_output = program.get<std::string>("--json-output"); }
 
   if (num_cpu_threads < 0) { num_cpu_threads = omp_get_max_threads() / n_gpus; }
 
@@ -431,7 +573,30 @@ int main(int argc, char* argv[])
     initial_solution_file = program.get<std::string>("--initial-solution-path");
   }
 
-  if (run_dir) {
+  if (thread_scaling > 0) {
+    std::vector<std::string> paths;
+    if (run_selected) {
+      for (const auto& instance : instances) {
+        paths.push_back(path + "/" + instance);
+      }
+    } else if (run_dir) {
+      for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        paths.push_back(entry.path());
+      }
+    } else {
+      paths.push_back(path);
+    }
+    auto memory_resource = make_async();
+    rmm::mr::set_current_device_resource(memory_resource.get());
+    run_thread_scaling(paths,
+                       out_dir,
+                       thread_scaling,
+                       node_limit,
+                       log_to_console,
+                       reliability_branching,
+                       time_limit,
+                       seed);
+  } else if (run_dir) {
     std::queue<std::string> task_queue;
     std::queue<int> gpu_queue;
     std::unordered_map<pid_t, int> pid_gpu_map;
@@ -502,7 +667,10 @@ int main(int argc, char* argv[])
                                reliability_branching,
                                time_limit,
                                work_limit,
-                               deterministic);
+                               deterministic,
+                               seed,
+                               json_output,
+                               node_limit);
           } else if (sys_pid < 0) {
             std::cerr << "Fork failed!" << std::endl;
             exit(1);
@@ -545,7 +713,11 @@ int main(int argc, char* argv[])
                     reliability_branching,
                     time_limit,
                     work_limit,
-                    deterministic);
+                    deterministic,
+                    seed,
+                    json_output,
+                    node_limit,
+                    nullptr);
   }
 
   return 0;
@@ -17,14 +17,18 @@
 
 #include <argparse/argparse.hpp>
 
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <filesystem>
 #include <stdexcept>
 #include <string>
 
 #include <rmm/mr/pool_memory_resource.hpp>
+#include <rmm/mr/statistics_resource_adaptor.hpp>
 
 #include "benchmark_helper.hpp"
+#include "benchmark_record.hpp"
 
 static void parse_arguments(argparse::ArgumentParser& program)
 {
@@ -75,7 +79,117 @@ static void parse_arguments(argparse::ArgumentParser& program)
     .default_value("Default")
     .choices("None", "Papilo", "PSLP", "Default");
 
+  program.add_argument("--fused-spmv-projection")
+    .help(
+      "Use the fused SpMV + projection kernel instead of cuSPARSE SpMV for PDHG steps. 0: "
+      "disabled (default), 1: enabled")
+    .default_value(0)
+    .scan<'i', int>()
+    .choices(0, 1);
+
+  program.add_argument("--report-bandwidth")
+    .help(
+      "Print the estimated memory bandwidth reached by the PDHG steps. 0: disabled (default), 1: "
+      "enabled")
+    .default_value(0)
+    .scan<'i', int>()
+    .choices(0, 1);
+
   program.add_argument("--solution-path").help("Path where solution file will be generated");
+
+  program.add_argument("--repetitions")
+    .help("Number of times the problem is solved, each solve is recorded separately")
+    .default_value(1)
+    .scan<'i', int>();
+
+  program.add_argument("--json-output")
+    .help(
+      "Path of a JSON lines file to which one record per solve is appended (wall time, "
+      "iterations, phase timings, peak memory)");
+}
+
+// Estimated number of bytes moved from global memory by one reflected PDHG step (A_t @ y, primal
+// projection, A @ x, dual projection) for both the cuSPARSE and the fused SpMV + projection paths.
+// The fused path avoids writing then re-reading the SpMV output before the projection.
+// Gathers on the dense vector are counted once per nonzero, which is an upper bound
+static double pdhg_step_bytes(int n_variables, int n_constraints, int nnz, bool fused)
+{
+  const double f = sizeof(double);
+  const double i = sizeof(int);
+  // Two SpMVs each reading values, column indices, row offsets and gathering x
+  const double spmv_bytes = 2.0 * (nnz * (2.0 * f + i)) + (n_variables + n_constraints + 2) * i;
+  // Primal projection: primal, objective, bounds (2 values) in, potential next, slack, reflected
+  // out. Dual projection: dual, lower, upper in, potential next, reflected out
+  const double projection_bytes = n_variables * (4.0 + 3.0) * f + n_constraints * (3.0 + 2.0) * f;
+  // SpMV outputs are always written, the cuSPARSE path reads them back in the projections
+  const double spmv_output_bytes = (n_variables + n_constraints) * f * (fused ? 1.0 : 2.0);
+  return spmv_bytes + projection_bytes + spmv_output_bytes;
+}
+
+static void report_pdhg_bandwidth(
+  const cuopt::mps_parser::mps_data_model_t<int, double>& op_problem,
+  const cuopt::linear_programming::optimization_problem_solution_t<int, double>& solution,
+  bool fused)
+{
+  const auto info         = solution.get_additional_termination_information();
+  const double solve_time = info.solve_time;
+  const double pdhg_steps = info.total_number_of_attempted_steps;
+  const double step_bytes = pdhg_step_bytes(
+    op_problem.get_n_variables(), op_problem.get_n_constraints(), op_problem.get_nnz(), fused);
+  if (!info.solved_by_pdlp || pdhg_steps <= 0 || !(solve_time > 0)) {
+    std::cout << "PDHG bandwidth: not available (problem not solved by PDLP)" << std::endl;
+    return;
+  }
+  // Solve time also contains restarts and termination checks, the value is a lower bound
+  std::cout << "PDHG bandwidth (" << (fused ? "fused SpMV + projection" : "cuSPARSE")
+            << "): " << pdhg_steps << " steps, " << step_bytes / 1e6 << " MB/step, "
+            << step_bytes * pdhg_steps / solve_time / 1e9 << " GB/s, "
+            << solve_time / pdhg_steps * 1e6 << " us/step" << std::endl;
+}
+
+// Taken before main, so that the first solve also accounts for the library and the CUDA startup
+static const auto process_start = std::chrono::steady_clock::now();
+
+static void record_solve(
+  const std::string& file_path,
+  const cuopt::linear_programming::pdlp_solver_settings_t<int, double>& settings,
+  const cuopt::linear_programming::optimization_problem_solution_t<int, double>& solution,
+  int repetition,
+  double wall_time,
+  size_t peak_device_memory,
+  const std::string& json_output)
+{
+  const auto info = solution.get_additional_termination_information();
+  benchmark_record_t record;
+  record.add("instance", std::filesystem::path(file_path).stem().string());
+  record.add("problem_type", "LP");
+  record.add("method", static_cast<int>(settings.method));
+  record.add("repetition", repetition);
+  record.add("status", solution.get_termination_status_string());
+  record.add("objective", solution.get_objective_value());
+  record.add("wall_time", wall_time);
+  if (repetition == 0) {
+    // The first solve pays for the creation of the context and the loading of the kernels
+    record.add("time_to_first_solve",
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - process_start)
+                 .count());
+    const char* module_loading = std::getenv("CUDA_MODULE_LOADING");
+    record.add("module_loading",
+               std::string(module_loading != nullptr ? module_loading : "default"));
+  }
+  record.add("solve_time", info.solve_time);
+  record.add("iterations", info.number_of_steps_taken);
+  record.add("pdhg_steps", info.total_number_of_attempted_steps);
+  record.add("solved_by_pdlp", info.solved_by_pdlp);
+  record.add("pdhg_step_time", info.pdhg_step_time);
+  record.add("step_size_time", info.step_size_time);
+  record.add("restart_time", info.restart_time);
+  record.add("termination_check_time", info.termination_check_time);
+  record.add("peak_device_memory", peak_device_memory);
+  record.add("peak_host_memory", peak_host_memory_bytes());
+  if (!record.append_to(json_output)) {
+    std::cerr << "Could not write the benchmark record to " << json_output << std::endl;
+  }
 }
 
 static cuopt::linear_programming::presolver_t string_to_presolver(const std::string& presolver)
@@ -144,6 +258,12 @@ int main(int argc, char* argv[])
     fill_pdlp_hyper_params(pdlp_hyper_params_path, settings.hyper_params);
     use_pdlp_solver_mode = false;
   }
+  if (program.is_used("--fused-spmv-projection")) {
+    settings.hyper_params.use_fused_spmv_projection = program.get<int>("--fused-spmv-projection");
+  }
+
+  const bool write_json = program.is_used("--json-output");
+  if (write_json) { settings.collect_phase_timings = true; }
 
   // Setup up RMM memory pool
   auto memory_resource = make_pool();
@@ -153,18 +273,46 @@ int main(int argc, char* argv[])
   const raft::handle_t handle_{};
 
   // Parse MPS file
+  const std::string path = program.get<std::string>("--path");
   cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
-    cuopt::mps_parser::parse_mps<int, double>(program.get<std::string>("--path"));
+    cuopt::mps_parser::parse_mps<int, double>(path);
+
+  const int repetitions = std::max(program.get<int>("--repetitions"), 1);
+  for (int repetition = 0; repetition < repetitions; ++repetition) {
+    // The allocations statistics are scoped to one solve, so that the peak is the one of that solve
+    rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> stats_mr(
+      memory_resource.get());
+    rmm::mr::set_current_device_resource(&stats_mr);
 
-  // Solve LP problem
-  bool problem_checking = true;
-  cuopt::linear_programming::optimization_problem_solution_t<int, double> solution =
-    cuopt::linear_programming::solve_lp(
-      &handle_, op_problem, settings, problem_checking, use_pdlp_solver_mode);
+    // Solve LP problem
+    bool problem_checking = true;
+    auto start_solve      = std::chrono::steady_clock::now();
+    cuopt::linear_programming::optimization_problem_solution_t<int, double> solution =
+      cuopt::linear_programming::solve_lp(
+        &handle_, op_problem, settings, problem_checking, use_pdlp_solver_mode);
+    handle_.sync_stream();
+    const double wall_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_solve).count();
 
-  // Write solution to file if requested
-  if (program.is_used("--solution-path"))
-    solution.write_to_file(program.get<std::string>("--solution-path"), handle_.get_stream());
+    if (program.get<int>("--report-bandwidth")) {
+      report_pdhg_bandwidth(op_problem, solution, settings.hyper_params.use_fused_spmv_projection);
+    }
+    if (write_json) {
+      record_solve(path,
+                   settings,
+                   solution,
+                   repetition,
+                   wall_time,
+                   stats_mr.get_bytes_counter().peak,
+                   program.get<std::string>("--json-output"));
+    }
+
+    // Write solution to file if requested
+    if (program.is_used("--solution-path") && repetition == repetitions - 1) {
+      solution.write_to_file(program.get<std::string>("--solution-path"), handle_.get_stream());
+    }
+    rmm::mr::set_current_device_resource(memory_resource.get());
+  }
 
   return 0;
 }
@@ -19,11 +19,12 @@ echo "Download done"
 export CUDA_MODULE_LOADING=EAGER
 
 # Benchmark all instances (cuOpt needs to be compiled first, you can compile in LP only mode and you should turn on BUILD_LP_BENCHMARKS)
+# Additional arguments are forwarded to solve_LP, e.g. to compare modes: ./benchmark_lp_mittelmann.sh --pdlp-solver-mode Stable2
 for instance in ${CUOPT_HOME}/benchmarks/linear_programming/datasets/*/ ; do
     # Will generate the solver log for each instance. Could addtionally generate the solution file by uncommenting the --solution-path
     instance_name=$(basename $instance)
     echo "Parsing ${instance_name}.mps then solving"
-    ${CUOPT_HOME}/cpp/build/solve_LP --path ${CUOPT_HOME}/benchmarks/linear_programming/datasets/${instance_name}/${instance_name}.mps --time-limit 3600 # --solution-path $CUOPT_HOME/benchmarks/linear_programming/datasets/$instance.sol
+    ${CUOPT_HOME}/cpp/build/solve_LP --path ${CUOPT_HOME}/benchmarks/linear_programming/datasets/${instance_name}/${instance_name}.mps --time-limit 3600 "$@" # --solution-path $CUOPT_HOME/benchmarks/linear_programming/datasets/$instance.sol
 done
 
 echo "Benchmark done"
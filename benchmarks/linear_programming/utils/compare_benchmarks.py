@@ -0,0 +1,179 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+# Compares two JSON lines result files written by solve_LP / solve_MIP with
+# --json-output (see run_benchmark_suite.py), for example of a baseline and a
+# candidate build, using shifted geometric means over the instances.
+#
+# The repetitions and seeds of an instance are averaged first. An instance that
+# is not solved to optimality, or that is missing from one of the files, counts
+# with the time limit as its time, so that both builds are measured over the
+# same instances.
+
+import argparse
+import json
+import math
+from collections import defaultdict
+
+# Shifts of the geometric means, they limit the weight of the easy instances
+SHIFTS = {
+    "wall_time": 10.0,
+    "solve_time": 10.0,
+    "time_to_first_solve": 1.0,
+    "primal_dual_integral": 10.0,
+    "iterations": 100.0,
+    "nodes": 100.0,
+    "simplex_iterations": 100.0,
+    "peak_device_memory": float(2**20),
+    "peak_host_memory": float(2**20),
+}
+
+TIME_METRICS = ["wall_time", "solve_time", "primal_dual_integral"]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        prog="compare_benchmarks",
+        description="Compare two benchmark result files with shifted "
+        "geometric means",
+    )
+    parser.add_argument("baseline", type=str, help="Baseline JSON lines file")
+    parser.add_argument(
+        "candidate", type=str, help="Candidate JSON lines file"
+    )
+    parser.add_argument(
+        "-time-limit",
+        type=float,
+        default=3600.0,
+        help="Time of the unsolved instances, should be the time limit of "
+        "the runs",
+    )
+    parser.add_argument(
+        "-metrics",
+        type=str,
+        nargs="+",
+        default=list(SHIFTS.keys()),
+        help="Metrics to compare",
+    )
+    parser.add_argument(
+        "-top",
+        type=int,
+        default=10,
+        help="Number of instances with the largest wall time changes to list",
+    )
+    return parser.parse_args()
+
+
+def load_results(path):
+    # instance -> list of records, one per repetition or seed
+    results = defaultdict(list)
+    with open(path) as fp:
+        for line in fp:
+            line = line.strip()
+            if line:
+                record = json.loads(line)
+                results[record["instance"]].append(record)
+    return results
+
+
+def is_solved(record):
+    return record.get("status") == "Optimal"
+
+
+def instance_value(records, metric, time_limit):
+    # Mean over the repetitions and seeds, None if the metric is not recorded
+    values = []
+    for record in records:
+        value = record.get(metric)
+        if metric in TIME_METRICS and not is_solved(record):
+            # The integral of an unsolved run is kept, it is still meaningful
+            if metric != "primal_dual_integral" or value is None:
+                value = time_limit
+        if value is not None:
+            values.append(float(value))
+    if not values:
+        return None
+    return sum(values) / len(values)
+
+
+def shifted_geometric_mean(values, shift):
+    if not values:
+        return float("nan")
+    log_sum = sum(math.log(max(value + shift, 1e-300)) for value in values)
+    return math.exp(log_sum / len(values)) - shift
+
+
+def solved_count(results, instances):
+    return sum(
+        1
+        for name in instances
+        if results.get(name) and all(is_solved(r) for r in results[name])
+    )
+
+
+def main():
+    args = parse_args()
+    baseline = load_results(args.baseline)
+    candidate = load_results(args.candidate)
+    instances = sorted(set(baseline.keys()) | set(candidate.keys()))
+    missing = {"status": "Missing"}
+
+    print(f"Instances: {len(instances)}")
+    print(
+        "Solved: baseline "
+        f"{solved_count(baseline, instances)}, candidate "
+        f"{solved_count(candidate, instances)}"
+    )
+    print()
+    print(
+        f"{'metric':<24}{'baseline':>16}{'candidate':>16}{'ratio':>10}"
+        f"{'instances':>11}"
+    )
+    for metric in args.metrics:
+        shift = SHIFTS.get(metric, 1.0)
+        base_values, cand_values = [], []
+        for name in instances:
+            base_records = baseline.get(name, [missing])
+            cand_records = candidate.get(name, [missing])
+            base = instance_value(base_records, metric, args.time_limit)
+            cand = instance_value(cand_records, metric, args.time_limit)
+            # Only the instances for which both builds recorded the metric
+            if base is None or cand is None:
+                continue
+            base_values.append(base)
+            cand_values.append(cand)
+        if not base_values:
+            continue
+        base_sgm = shifted_geometric_mean(base_values, shift)
+        cand_sgm = shifted_geometric_mean(cand_values, shift)
+        ratio = cand_sgm / base_sgm if base_sgm != 0 else float("nan")
+        print(
+            f"{metric:<24}{base_sgm:>16.4g}{cand_sgm:>16.4g}{ratio:>10.3f}"
+            f"{len(base_values):>11}"
+        )
+
+    if args.top > 0:
+        changes = []
+        for name in instances:
+            base = instance_value(
+                baseline.get(name, [missing]), "wall_time", args.time_limit
+            )
+            cand = instance_value(
+                candidate.get(name, [missing]), "wall_time", args.time_limit
+            )
+            if base is None or cand is None:
+                continue
+            shift = SHIFTS["wall_time"]
+            changes.append(((cand + shift) / (base + shift), name, base, cand))
+        changes.sort(key=lambda change: abs(math.log(change[0])), reverse=True)
+        print()
+        print(
+            f"Largest wall time changes (shifted ratio, shift "
+            f"{SHIFTS['wall_time']:g}s):"
+        )
+        for ratio, name, base, cand in changes[: args.top]:
+            print(f"  {name:<30}{base:>12.3f}{cand:>12.3f}{ratio:>10.3f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,193 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+# Runs a named LP or MIP benchmark suite with cuOpt and appends one JSON record
+# per solve to a JSON lines file. Two result files, for example of two builds,
+# are compared with compare_benchmarks.py.
+#
+# LP suites are the Mittelmann sets of get_datasets.py, they are downloaded if
+# needed and solved with solve_LP (BUILD_LP_BENCHMARKS). MIP suites are
+# directories of MPS files, for instance the MIPLIB 2017 benchmark set, solved
+# with solve_MIP (BUILD_MIP_BENCHMARKS) once per seed.
+
+import argparse
+import json
+import os
+import subprocess
+
+import get_datasets
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+CUOPT_HOME = os.path.abspath(os.path.join(SCRIPT_DIR, "..", "..", ".."))
+
+LP_SUITES = dict(
+    {"mittelmann-lp": get_datasets.LPFeasibleMittelmannSet},
+    **get_datasets.MittelmannInstances["benchmarks"],
+)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        prog="run_benchmark_suite",
+        description="Run an LP or MIP benchmark suite and record the results "
+        "as JSON lines",
+    )
+    parser.add_argument(
+        "-suite",
+        type=str,
+        required=True,
+        help="Name of the LP suite ("
+        + ", ".join(LP_SUITES.keys())
+        + ") or 'mip' to solve all the MPS files of -instances-dir",
+    )
+    parser.add_argument(
+        "-instances-dir",
+        type=str,
+        default=os.path.join(
+            CUOPT_HOME, "benchmarks", "linear_programming", "datasets"
+        ),
+        help="Directory where the LP instances are downloaded, or directory "
+        "of the MPS files of a MIP suite",
+    )
+    parser.add_argument(
+        "-output",
+        type=str,
+        required=True,
+        help="JSON lines file to which the records are appended",
+    )
+    parser.add_argument(
+        "-binary",
+        type=str,
+        default=None,
+        help="Benchmark binary, cpp/build/solve_LP or cpp/build/solve_MIP "
+        "by default",
+    )
+    parser.add_argument(
+        "-time-limit",
+        type=float,
+        default=3600.0,
+        help="Time limit of each solve in seconds",
+    )
+    parser.add_argument(
+        "-repetitions",
+        type=int,
+        default=1,
+        help="Number of solves of each LP instance",
+    )
+    parser.add_argument(
+        "-seeds",
+        type=int,
+        nargs="+",
+        default=[42],
+        help="Seeds of the MIP runs, each instance is solved once per seed",
+    )
+    parser.add_argument(
+        "-n-gpus",
+        type=int,
+        default=1,
+        help="Number of GPUs the MIP instances are spread over",
+    )
+    parser.add_argument(
+        "-module-loading",
+        type=str,
+        default="EAGER",
+        choices=["EAGER", "LAZY"],
+        help="CUDA_MODULE_LOADING of the runs, LAZY loads each kernel at its "
+        "first launch and shortens the time to the first solve",
+    )
+    parser.add_argument(
+        "extra_args",
+        nargs=argparse.REMAINDER,
+        help="Arguments forwarded to the benchmark binary, after '--'",
+    )
+    args = parser.parse_args()
+    if args.extra_args and args.extra_args[0] == "--":
+        args.extra_args = args.extra_args[1:]
+    if args.suite != "mip" and args.suite not in LP_SUITES:
+        parser.error(f"Unknown suite {args.suite}")
+    return args
+
+
+def append_failure(output, instance, problem_type, returncode):
+    # A crash writes no record, keep a trace of it so that the comparison
+    # counts the instance as unsolved
+    with open(output, "a") as fp:
+        record = {
+            "instance": instance,
+            "problem_type": problem_type,
+            "status": "Crashed",
+            "returncode": returncode,
+        }
+        fp.write(json.dumps(record) + "\n")
+
+
+def run_lp_suite(args):
+    binary = args.binary or os.path.join(
+        CUOPT_HOME, "cpp", "build", "solve_LP"
+    )
+    os.makedirs(args.instances_dir, exist_ok=True)
+    for name in LP_SUITES[args.suite]:
+        get_datasets.download_dataset(name, args.instances_dir)
+        path = os.path.join(args.instances_dir, name, f"{name}.mps")
+        if not os.path.exists(path):
+            print(f"{path} not found. Skipping...")
+            continue
+        cmd = [
+            binary,
+            "--path",
+            path,
+            "--time-limit",
+            str(args.time_limit),
+            "--repetitions",
+            str(args.repetitions),
+            "--json-output",
+            args.output,
+        ] + args.extra_args
+        print(f"Solving {name}")
+        result = subprocess.run(cmd)
+        if result.returncode != 0:
+            append_failure(args.output, name, "LP", result.returncode)
+
+
+def run_mip_suite(args):
+    binary = args.binary or os.path.join(
+        CUOPT_HOME, "cpp", "build", "solve_MIP"
+    )
+    for seed in args.seeds:
+        out_dir = os.path.join(
+            os.path.dirname(os.path.abspath(args.output)), f"seed_{seed}"
+        )
+        os.makedirs(out_dir, exist_ok=True)
+        cmd = [
+            binary,
+            "--path",
+            args.instances_dir,
+            "--run-dir",
+            "t",
+            "--n-gpus",
+            str(args.n_gpus),
+            "--out-dir",
+            out_dir,
+            "--time-limit",
+            str(args.time_limit),
+            "--seed",
+            str(seed),
+            "--json-output",
+            args.output,
+        ] + args.extra_args
+        print(f"Solving {args.instances_dir} with seed {seed}")
+        subprocess.run(cmd)
+
+
+def main():
+    args = parse_args()
+    # EAGER module loading by default to simulate real-life condition
+    os.environ["CUDA_MODULE_LOADING"] = args.module_loading
+    if args.suite == "mip":
+        run_mip_suite(args)
+    else:
+        run_lp_suite(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,166 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+# Summarizes a branch-and-bound trace written with the mip_trace_file setting
+# (see cpp/src/branch_and_bound/bb_trace.hpp): the node throughput overall and
+# per worker, the progress of the global bounds over time, the time the workers
+# spent in plunges and dives against the time they sat in the pool, and the
+# records dropped because a ring buffer was full.
+
+import argparse
+import struct
+import sys
+from collections import defaultdict
+
+HEADER = struct.Struct("<8sII")
+RECORD = struct.Struct("<ddihbb")
+FORMAT_VERSION = 1
+
+NODE_KINDS = {
+    0: "branched",
+    1: "fathomed",
+    2: "integer",
+    3: "infeasible",
+    4: "numerical",
+}
+WORKER_START = 5
+WORKER_STOP = 6
+LOWER_BOUND = 7
+UPPER_BOUND = 8
+DROPPED = 9
+
+STRATEGIES = {
+    -1: "-",
+    0: "best first",
+    1: "pseudocost diving",
+    2: "line search diving",
+    3: "guided diving",
+    4: "coefficient diving",
+}
+
+
+def read_trace(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit(f"{path}: too short for a trace")
+    magic, version, record_size = HEADER.unpack_from(data, 0)
+    if magic != b"CUOPTBBT":
+        sys.exit(f"{path}: not a branch-and-bound trace")
+    if version != FORMAT_VERSION or record_size != RECORD.size:
+        sys.exit(
+            f"{path}: unsupported trace version {version} "
+            f"with records of {record_size} bytes"
+        )
+    # A trace cut short, e.g., by a crash, may end with part of a record
+    body = data[HEADER.size :]
+    body = body[: len(body) // RECORD.size * RECORD.size]
+    records = list(RECORD.iter_unpack(body))
+    # The rings are drained one after the other, so that the file is only
+    # ordered by time within a ring
+    records.sort(key=lambda r: r[0])
+    return records
+
+
+def print_bounds(records, samples):
+    bounds = [r for r in records if r[4] in (LOWER_BOUND, UPPER_BOUND)]
+    if not bounds:
+        return
+    print("\nBound progress")
+    print(f"  {'time':>10}  {'lower bound':>16}  {'upper bound':>16}  {'gap':>8}")
+    lower = float("-inf")
+    upper = float("inf")
+    rows = []
+    for time, value, _, _, kind, _ in bounds:
+        if kind == LOWER_BOUND:
+            lower = value
+        else:
+            upper = value
+        rows.append((time, lower, upper))
+    # Keep about the requested number of rows, always the last one
+    step = max(1, len(rows) // samples)
+    for k, (time, lower, upper) in enumerate(rows):
+        if k % step != 0 and k != len(rows) - 1:
+            continue
+        gap = "-"
+        if upper != float("inf") and lower != float("-inf"):
+            gap = f"{abs(upper - lower) / max(abs(upper), 1e-10):.2%}"
+        print(f"  {time:10.3f}  {lower:16.8g}  {upper:16.8g}  {gap:>8}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("trace", help="trace file written by the solver")
+    parser.add_argument(
+        "--samples",
+        type=int,
+        default=20,
+        help="number of rows of the bound progress table",
+    )
+    args = parser.parse_args()
+
+    records = read_trace(args.trace)
+    if not records:
+        print("The trace is empty")
+        return
+    duration = records[-1][0]
+
+    node_counts = defaultdict(int)
+    worker_nodes = defaultdict(int)
+    strategy_nodes = defaultdict(int)
+    busy = defaultdict(float)
+    started = {}
+    dropped = 0
+    for time, value, node_id, worker_id, kind, strategy in records:
+        if kind in NODE_KINDS:
+            node_counts[kind] += 1
+            worker_nodes[worker_id] += 1
+            strategy_nodes[strategy] += 1
+        elif kind == WORKER_START:
+            started[worker_id] = time
+        elif kind == WORKER_STOP and worker_id in started:
+            busy[worker_id] += time - started.pop(worker_id)
+        elif kind == DROPPED:
+            dropped += int(value)
+    # Workers still busy when the trace closed
+    for worker_id, time in started.items():
+        busy[worker_id] += duration - time
+
+    total_nodes = sum(node_counts.values())
+    print(f"Trace of {duration:.3f} s, {len(records)} records")
+    print(
+        f"Nodes: {total_nodes}, {total_nodes / max(duration, 1e-9):.1f} per second"
+    )
+    for kind, name in NODE_KINDS.items():
+        if node_counts[kind] > 0:
+            print(f"  {name:>12}: {node_counts[kind]}")
+    if strategy_nodes:
+        print("\nNodes per search strategy")
+        for strategy, count in sorted(strategy_nodes.items()):
+            name = STRATEGIES.get(strategy, str(strategy))
+            print(f"  {name:>20}: {count}")
+
+    workers = sorted(set(worker_nodes) | set(busy))
+    if workers:
+        print("\nWorkers")
+        print(f"  {'worker':>6}  {'nodes':>10}  {'nodes/s':>10}  {'busy':>8}  {'idle':>8}")
+        for worker_id in workers:
+            time_busy = min(busy[worker_id], duration)
+            print(
+                f"  {worker_id:6d}  {worker_nodes[worker_id]:10d}"
+                f"  {worker_nodes[worker_id] / max(time_busy, 1e-9):10.1f}"
+                f"  {time_busy / max(duration, 1e-9):8.1%}"
+                f"  {1 - time_busy / max(duration, 1e-9):8.1%}"
+            )
+
+    print_bounds(records, args.samples)
+
+    if dropped > 0:
+        print(
+            f"\nWarning: {dropped} records were dropped, the statistics above "
+            f"undercount the search"
+        )
+
+
+if __name__ == "__main__":
+    main()
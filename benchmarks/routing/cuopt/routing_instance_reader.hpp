@@ -0,0 +1,171 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Host data of a routing instance. Location 0 is the depot, every location is an order so that
+// the depot is order 0 as in the routing tests
+struct routing_instance_t {
+  int n_locations{0};
+  int n_vehicles{0};
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<int> demand;
+  std::vector<int> capacity;
+  std::vector<int> earliest;
+  std::vector<int> latest;
+  std::vector<int> service;
+  std::vector<int> pickup_indices;
+  std::vector<int> delivery_indices;
+  bool has_time_windows{false};
+
+  void add_location(float cx, float cy, int d, int ready, int due, int service_time)
+  {
+    x.push_back(cx);
+    y.push_back(cy);
+    demand.push_back(d);
+    earliest.push_back(ready);
+    latest.push_back(due);
+    service.push_back(service_time);
+  }
+
+  std::vector<float> build_cost_matrix() const
+  {
+    std::vector<float> matrix((size_t)n_locations * n_locations);
+    for (int i = 0; i < n_locations; ++i) {
+      for (int j = 0; j < n_locations; ++j) {
+        matrix[(size_t)i * n_locations + j] = std::hypot(double(x[i] - x[j]), double(y[i] - y[j]));
+      }
+    }
+    return matrix;
+  }
+};
+
+// Reference of an instance, as the lines "relative/path,cost,vehicles" of datasets/ref
+struct routing_reference_t {
+  std::string path;
+  double cost;
+  int vehicles;
+};
+
+inline std::vector<routing_reference_t> read_routing_references(const std::string& ref_file)
+{
+  std::ifstream file(ref_file);
+  if (!file.is_open()) { throw std::runtime_error("Cannot open reference file " + ref_file); }
+  std::vector<routing_reference_t> refs;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string path, cost, vehicles;
+    if (!std::getline(ss, path, ',') || !std::getline(ss, cost, ',') ||
+        !std::getline(ss, vehicles, ',')) {
+      continue;
+    }
+    refs.push_back({path, std::stod(cost), std::stoi(vehicles)});
+  }
+  return refs;
+}
+
+// CVRPLIB format: header of "KEY : value" lines, then the NODE_COORD_SECTION and DEMAND_SECTION.
+// The files have no fleet size, it is left large enough for the solver to minimize it
+inline void read_cvrp(std::ifstream& file, routing_instance_t& instance)
+{
+  std::string line;
+  int capacity = 0;
+  while (std::getline(file, line) && line.find("NODE_COORD_SECTION") == std::string::npos) {
+    const auto colon = line.find(':');
+    if (colon == std::string::npos) { continue; }
+    std::stringstream key(line.substr(0, colon));
+    std::string token;
+    key >> token;
+    if (token == "CAPACITY") { capacity = std::stoi(line.substr(colon + 1)); }
+    if (token == "DIMENSION") { instance.n_locations = std::stoi(line.substr(colon + 1)); }
+  }
+  instance.n_vehicles = instance.n_locations / 5;
+  instance.capacity.assign(instance.n_vehicles, capacity);
+  for (int i = 0; i < instance.n_locations; ++i) {
+    int id;
+    float cx, cy;
+    file >> id >> cx >> cy;
+    instance.add_location(cx, cy, 0, 0, std::numeric_limits<int>::max(), 0);
+  }
+  std::string section;
+  file >> section;
+  for (int i = 0; i < instance.n_locations; ++i) {
+    int id;
+    file >> id >> instance.demand[i];
+  }
+}
+
+// Solomon and Homberger format: name, vehicle section with the fleet size and the capacity, then
+// one "id x y demand ready due service" line per location
+inline void read_cvrptw(std::ifstream& file, routing_instance_t& instance)
+{
+  std::string line;
+  for (int i = 0; i < 4; ++i) {
+    std::getline(file, line);
+  }
+  int capacity;
+  file >> instance.n_vehicles >> capacity;
+  instance.capacity.assign(instance.n_vehicles, capacity);
+  for (int i = 0; i < 4; ++i) {
+    std::getline(file, line);
+  }
+  int id, demand, ready, due, service;
+  float cx, cy;
+  while (file >> id >> cx >> cy >> demand >> ready >> due >> service) {
+    instance.add_location(cx, cy, demand, ready, due, service);
+  }
+  instance.n_locations      = instance.x.size();
+  instance.has_time_windows = true;
+}
+
+// Li & Lim format: fleet size, capacity and speed, then one
+// "id x y demand ready due service pickup delivery" line per location. A pickup has the index of
+// its delivery and a delivery the index of its pickup
+inline void read_pdptw(std::ifstream& file, routing_instance_t& instance)
+{
+  int capacity, speed;
+  file >> instance.n_vehicles >> capacity >> speed;
+  instance.capacity.assign(instance.n_vehicles, capacity);
+  int id, demand, ready, due, service, pickup, delivery;
+  float cx, cy;
+  while (file >> id >> cx >> cy >> demand >> ready >> due >> service >> pickup >> delivery) {
+    if (pickup == 0 && delivery != 0) {
+      instance.pickup_indices.push_back(id);
+      instance.delivery_indices.push_back(delivery);
+    }
+    instance.add_location(cx, cy, demand, ready, due, service);
+  }
+  instance.n_locations      = instance.x.size();
+  instance.has_time_windows = true;
+}
+
+inline routing_instance_t read_routing_instance(const std::string& path)
+{
+  std::ifstream file(path);
+  if (!file.is_open()) { throw std::runtime_error("Cannot open instance file " + path); }
+  routing_instance_t instance;
+  if (path.find(".vrp") != std::string::npos) {
+    read_cvrp(file, instance);
+  } else if (path.find(".pdptw") != std::string::npos) {
+    read_pdptw(file, instance);
+  } else {
+    read_cvrptw(file, instance);
+  }
+  if (instance.n_locations == 0) { throw std::runtime_error("Empty instance file " + path); }
+  return instance;
+}
@@ -0,0 +1,202 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/routing/assignment.hpp>
+#include <cuopt/routing/data_model_view.hpp>
+#include <cuopt/routing/solve.hpp>
+#include <cuopt/routing/solver_settings.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/cuda_async_memory_resource.hpp>
+#include <rmm/mr/statistics_resource_adaptor.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "routing_instance_reader.hpp"
+
+static void parse_arguments(argparse::ArgumentParser& program)
+{
+  program.add_argument("--ref-file")
+    .help("reference file of the suite, as datasets/ref/solomon_100.txt, homberger.txt, "
+          "l2_pickup.txt or cvrp.txt")
+    .required();
+
+  program.add_argument("--dataset-root")
+    .help("directory the instance paths of the reference file are relative to")
+    .default_value(std::string("datasets"));
+
+  program.add_argument("--time-limits")
+    .help("comma separated time budgets in seconds, every instance is solved once per budget")
+    .default_value(std::string("10,60"));
+
+  program.add_argument("--max-instances")
+    .help("number of instances of the reference file to run, all of them if negative")
+    .default_value(-1)
+    .scan<'i', int>();
+
+  program.add_argument("--output")
+    .help("path of the csv file the results are appended to")
+    .default_value(std::string("routing_benchmark.csv"));
+}
+
+static std::vector<double> parse_time_limits(const std::string& time_limits)
+{
+  std::vector<double> ret;
+  std::stringstream ss(time_limits);
+  std::string token;
+  while (std::getline(ss, token, ',')) {
+    ret.push_back(std::stod(token));
+  }
+  if (ret.empty()) { throw std::runtime_error("No time limit given"); }
+  return ret;
+}
+
+template <typename T>
+static rmm::device_uvector<T> to_device(const std::vector<T>& h_vec, rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<T> d_vec(h_vec.size(), stream);
+  raft::copy(d_vec.data(), h_vec.data(), h_vec.size(), stream);
+  return d_vec;
+}
+
+struct run_result_t {
+  bool success;
+  int vehicles;
+  double cost;
+  double solve_time;
+  size_t peak_memory;
+};
+
+// The device data of the instance and the statistics of its allocations are scoped to one solve,
+// so that the peak memory is the one of that solve
+static run_result_t run_instance(const routing_instance_t& instance,
+                                 double time_limit,
+                                 rmm::mr::device_memory_resource* upstream)
+{
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> stats_mr(upstream);
+  rmm::mr::set_current_device_resource(&stats_mr);
+
+  run_result_t result{};
+  {
+    const raft::handle_t handle{};
+    auto stream = handle.get_stream();
+
+    auto cost_matrix = to_device(instance.build_cost_matrix(), stream);
+    auto demand      = to_device(instance.demand, stream);
+    auto capacity    = to_device(instance.capacity, stream);
+    auto earliest    = to_device(instance.earliest, stream);
+    auto latest      = to_device(instance.latest, stream);
+    auto service     = to_device(instance.service, stream);
+    auto pickups     = to_device(instance.pickup_indices, stream);
+    auto deliveries  = to_device(instance.delivery_indices, stream);
+
+    cuopt::routing::data_model_view_t<int, float> data_model(
+      &handle, instance.n_locations, instance.n_vehicles, instance.n_locations);
+    data_model.add_cost_matrix(cost_matrix.data());
+    data_model.add_capacity_dimension("demand", demand.data(), capacity.data());
+    if (instance.has_time_windows) {
+      data_model.set_order_time_windows(earliest.data(), latest.data());
+      data_model.set_order_service_times(service.data());
+    }
+    if (!instance.pickup_indices.empty()) {
+      data_model.set_pickup_delivery_pairs(pickups.data(), deliveries.data());
+    }
+
+    cuopt::routing::solver_settings_t<int, float> settings;
+    settings.set_time_limit(time_limit);
+
+    handle.sync_stream();
+    auto start    = std::chrono::steady_clock::now();
+    auto solution = cuopt::routing::solve(data_model, settings);
+    handle.sync_stream();
+    result.solve_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    result.success = solution.get_status() == cuopt::routing::solution_status_t::SUCCESS;
+    if (result.success) {
+      result.vehicles = solution.get_vehicle_count();
+      result.cost     = solution.get_total_objective();
+    }
+  }
+  result.peak_memory = stats_mr.get_bytes_counter().peak;
+  rmm::mr::set_current_device_resource(upstream);
+  return result;
+}
+
+// The checked builds (build.sh -a) keep the assertions and the runtime checks of the device code,
+// the build column tells their results apart from the release ones in a shared output file
+#ifdef ASSERT_MODE
+constexpr const char* build_flavor = "checked";
+#else
+constexpr const char* build_flavor = "release";
+#endif
+
+int main(int argc, char* argv[])
+{
+  argparse::ArgumentParser program("solve_routing");
+  parse_arguments(program);
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  const auto refs          = read_routing_references(program.get<std::string>("--ref-file"));
+  const auto time_limits   = parse_time_limits(program.get<std::string>("--time-limits"));
+  const auto dataset_root  = std::filesystem::path(program.get<std::string>("--dataset-root"));
+  const int max_instances  = program.get<int>("--max-instances");
+  const auto output        = program.get<std::string>("--output");
+  const bool write_header  = !std::filesystem::exists(output);
+  const size_t n_instances = max_instances < 0 ? refs.size()
+                                               : std::min<size_t>(refs.size(), max_instances);
+
+  std::ofstream out(output, std::ios::app);
+  if (write_header) {
+    out << "instance,time_limit,status,vehicles,cost,ref_vehicles,ref_cost,gap_percent,solve_time,"
+           "peak_memory_mib,build\n";
+  }
+
+  // the stream ordered pool keeps the allocations of consecutive solves from hitting the driver
+  auto memory_resource = std::make_shared<rmm::mr::cuda_async_memory_resource>();
+  rmm::mr::set_current_device_resource(memory_resource.get());
+
+  for (size_t i = 0; i < n_instances; ++i) {
+    const auto& ref = refs[i];
+    auto instance   = read_routing_instance((dataset_root / ref.path).string());
+    for (auto time_limit : time_limits) {
+      auto result        = run_instance(instance, time_limit, memory_resource.get());
+      const double gap   = result.success ? (result.cost - ref.cost) / ref.cost * 100. : -1.;
+      const double peak  = result.peak_memory / (1024. * 1024.);
+      const char* status = result.success ? "SUCCESS" : "FAIL";
+      out << ref.path << "," << time_limit << "," << status << "," << result.vehicles << ","
+          << result.cost << "," << ref.vehicles << "," << ref.cost << "," << gap << ","
+          << result.solve_time << "," << peak << "," << build_flavor << std::endl;
+      std::cout << ref.path << " time_limit: " << time_limit << " status: " << status
+                << " vehicles: " << result.vehicles << "/" << ref.vehicles
+                << " cost: " << result.cost << "/" << ref.cost << " gap: " << gap << "%"
+                << " peak memory: " << peak << " MiB"
+                << " build: " << build_flavor << std::endl;
+    }
+  }
+  return 0;
+}
@@ -42,6 +42,7 @@ EXCLUDE_ARGS=(
   --exclude "libcurand.so.*"
   --exclude "libcusolver.so.*"
   --exclude "libcusparse.so.*"
+  --exclude "libnccl.so.*"
   --exclude "libcuopt.so"
   --exclude "libmps_parser.so"
   --exclude "librapids_logger.so"
@@ -0,0 +1,58 @@
+# cmake-format: off
+# SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+# cmake-format: on
+
+# FindNCCL.cmake - Find NCCL (NVIDIA Collective Communications Library)
+#
+# This module defines the following variables:
+#   NCCL_FOUND        - True if NCCL is found
+#   NCCL_INCLUDE_DIRS - NCCL include directories
+#   NCCL_LIBRARIES    - NCCL libraries
+#   NCCL::nccl        - Imported target for NCCL
+
+find_path(NCCL_INCLUDE_DIR
+  NAMES nccl.h
+  HINTS
+    $ENV{NCCL_DIR}/include
+    $ENV{CONDA_PREFIX}/include
+  PATHS
+    ${CUDAToolkit_INCLUDE_DIRS}
+    /usr/include
+    /usr/local/include
+)
+
+find_library(NCCL_LIBRARY
+  NAMES nccl
+  HINTS
+    $ENV{NCCL_DIR}/lib
+    $ENV{CONDA_PREFIX}/lib
+  PATHS
+    ${CUDAToolkit_LIBRARY_DIR}
+    /usr/lib
+    /usr/lib64
+    /usr/lib/x86_64-linux-gnu
+    /usr/lib/aarch64-linux-gnu
+    /usr/local/lib
+    /usr/local/lib64
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(NCCL
+  REQUIRED_VARS NCCL_INCLUDE_DIR NCCL_LIBRARY
+)
+
+if(NCCL_FOUND)
+  set(NCCL_INCLUDE_DIRS ${NCCL_INCLUDE_DIR})
+  set(NCCL_LIBRARIES ${NCCL_LIBRARY})
+endif()
+
+if(NCCL_FOUND AND NOT TARGET NCCL::nccl)
+  add_library(NCCL::nccl UNKNOWN IMPORTED)
+  set_target_properties(NCCL::nccl PROPERTIES
+    IMPORTED_LOCATION "${NCCL_LIBRARY}"
+    INTERFACE_INCLUDE_DIRECTORIES "${NCCL_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(NCCL_INCLUDE_DIR NCCL_LIBRARY)
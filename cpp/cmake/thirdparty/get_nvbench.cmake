@@ -0,0 +1,11 @@
+# cmake-format: off
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+# cmake-format: on
+
+function(find_and_configure_nvbench)
+    include(${rapids-cmake-dir}/cpm/nvbench.cmake)
+    rapids_cpm_nvbench()
+endfunction()
+
+find_and_configure_nvbench()
@@ -32,15 +32,18 @@
 #define CUOPT_DUAL_INFEASIBLE_TOLERANCE       "dual_infeasible_tolerance"
 #define CUOPT_ITERATION_LIMIT                 "iteration_limit"
 #define CUOPT_TIME_LIMIT                      "time_limit"
+#define CUOPT_DEVICE_MEMORY_LIMIT             "device_memory_limit"
 #define CUOPT_WORK_LIMIT                      "work_limit"
 #define CUOPT_PDLP_SOLVER_MODE                "pdlp_solver_mode"
 #define CUOPT_METHOD                          "method"
 #define CUOPT_PER_CONSTRAINT_RESIDUAL         "per_constraint_residual"
 #define CUOPT_SAVE_BEST_PRIMAL_SO_FAR         "save_best_primal_so_far"
 #define CUOPT_FIRST_PRIMAL_FEASIBLE           "first_primal_feasible"
+#define CUOPT_COLLECT_PHASE_TIMINGS           "collect_phase_timings"
 #define CUOPT_LOG_FILE                        "log_file"
 #define CUOPT_LOG_TO_CONSOLE                  "log_to_console"
 #define CUOPT_CROSSOVER                       "crossover"
+#define CUOPT_LATENCY_MODE                    "latency_mode"
 #define CUOPT_FOLDING                         "folding"
 #define CUOPT_AUGMENTED                       "augmented"
 #define CUOPT_DUALIZE                         "dualize"
@@ -48,6 +51,10 @@
 #define CUOPT_BARRIER_DUAL_INITIAL_POINT      "barrier_dual_initial_point"
 #define CUOPT_ELIMINATE_DENSE_COLUMNS         "eliminate_dense_columns"
 #define CUOPT_CUDSS_DETERMINISTIC             "cudss_deterministic"
+#define CUOPT_BARRIER_HYBRID_MEMORY           "barrier_hybrid_memory"
+#define CUOPT_BARRIER_PCG                     "barrier_pcg"
+#define CUOPT_BARRIER_PCG_TOLERANCE           "barrier_pcg_tolerance"
+#define CUOPT_BARRIER_MIXED_PRECISION         "barrier_mixed_precision"
 #define CUOPT_PRESOLVE                        "presolve"
 #define CUOPT_DUAL_POSTSOLVE                  "dual_postsolve"
 #define CUOPT_MIP_DETERMINISM_MODE            "mip_determinism_mode"
@@ -64,12 +71,25 @@
 #define CUOPT_MIP_MIXED_INTEGER_ROUNDING_CUTS "mip_mixed_integer_rounding_cuts"
 #define CUOPT_MIP_MIXED_INTEGER_GOMORY_CUTS   "mip_mixed_integer_gomory_cuts"
 #define CUOPT_MIP_KNAPSACK_CUTS               "mip_knapsack_cuts"
+#define CUOPT_MIP_CLIQUE_CUTS                 "mip_clique_cuts"
+#define CUOPT_MIP_FLOW_COVER_CUTS             "mip_flow_cover_cuts"
+#define CUOPT_MIP_NODE_CUT_DEPTH              "mip_node_cut_depth"
 #define CUOPT_MIP_STRONG_CHVATAL_GOMORY_CUTS  "mip_strong_chvatal_gomory_cuts"
 #define CUOPT_MIP_REDUCED_COST_STRENGTHENING  "mip_reduced_cost_strengthening"
+#define CUOPT_MIP_SYMMETRY                    "mip_symmetry"
+#define CUOPT_MIP_CONFLICT_ANALYSIS           "mip_conflict_analysis"
 #define CUOPT_MIP_CUT_CHANGE_THRESHOLD        "mip_cut_change_threshold"
 #define CUOPT_MIP_CUT_MIN_ORTHOGONALITY       "mip_cut_min_orthogonality"
 #define CUOPT_MIP_BATCH_PDLP_STRONG_BRANCHING "mip_batch_pdlp_strong_branching"
+#define CUOPT_MIP_NODE_MEMORY_LIMIT           "mip_node_memory_limit"
+#define CUOPT_MIP_CHECKPOINT_FILE             "mip_checkpoint_file"
+#define CUOPT_MIP_CHECKPOINT_INTERVAL         "mip_checkpoint_interval"
+#define CUOPT_MIP_CHECKPOINT_SPLIT            "mip_checkpoint_split"
+#define CUOPT_MIP_PRESOLVE_CACHE_FILE         "mip_presolve_cache_file"
+#define CUOPT_MIP_TRACE_FILE                  "mip_trace_file"
+#define CUOPT_MIP_WORK_UNIT_CALIBRATION_FILE  "mip_work_unit_calibration_file"
 #define CUOPT_SOLUTION_FILE                   "solution_file"
+#define CUOPT_WARM_START_CACHE_DIR            "warm_start_cache_dir"
 #define CUOPT_NUM_CPU_THREADS                 "num_cpu_threads"
 #define CUOPT_NUM_GPUS                        "num_gpus"
 #define CUOPT_USER_PROBLEM_FILE               "user_problem_file"
@@ -124,9 +144,11 @@
 #define CUOPT_METHOD_PDLP         1
 #define CUOPT_METHOD_DUAL_SIMPLEX 2
 #define CUOPT_METHOD_BARRIER      3
+#define CUOPT_METHOD_AUTOMATIC    4
 
 /* @brief File format constants for problem I/O */
-#define CUOPT_FILE_FORMAT_MPS 0
+#define CUOPT_FILE_FORMAT_MPS    0
+#define CUOPT_FILE_FORMAT_BINARY 1
 
 /* @brief Status codes constants */
 #define CUOPT_SUCCESS          0
@@ -141,5 +163,6 @@
 #define CUOPT_PRESOLVE_OFF     0
 #define CUOPT_PRESOLVE_PAPILO  1
 #define CUOPT_PRESOLVE_PSLP    2
+#define CUOPT_PRESOLVE_GPU     3
 
 #endif  // CUOPT_CONSTANTS_H
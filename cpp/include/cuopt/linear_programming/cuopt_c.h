@@ -37,6 +37,14 @@ typedef void* cuOptSolverSettings;
  */
 typedef void* cuOptSolution;
 
+/**
+ * @brief A ``cuOptSolverContext`` object holds the GPU resources reused across many solves: the
+ * library handles and a memory pool that stays warm between solves. It is created by
+ * ``cuOptCreateSolverContext`` and made current with ``cuOptSetSolverContext``. It should be
+ * destroyed using ``cuOptDestroySolverContext``.
+ */
+typedef void* cuOptSolverContext;
+
 #if CUOPT_INSTANTIATE_FLOAT
 
 /**
@@ -100,9 +108,10 @@ cuopt_int_t cuOptGetVersion(cuopt_int_t* version_major,
                             cuopt_int_t* version_patch);
 
 /**
- * @brief Read an optimization problem from an MPS file.
+ * @brief Read an optimization problem from an MPS file, or from a binary problem file written
+ * with CUOPT_FILE_FORMAT_BINARY. The format is detected from the content of the file.
  *
- * @param[in] filename - The path to the MPS file.
+ * @param[in] filename - The path to the MPS or binary problem file.
  *
  * @param[out] problem_ptr - A pointer to a cuOptOptimizationProblem. On output
  *  the problem will be created and initialized with the data from the MPS file
@@ -116,7 +125,8 @@ cuopt_int_t cuOptReadProblem(const char* filename, cuOptOptimizationProblem* pro
  *
  * @param[in] problem - The optimization problem to write.
  * @param[in] filename - The path to the output file.
- * @param[in] format - The file format to use. Currently only CUOPT_FILE_FORMAT_MPS is supported.
+ * @param[in] format - The file format to use, CUOPT_FILE_FORMAT_MPS or CUOPT_FILE_FORMAT_BINARY.
+ *  The binary format stores the problem arrays as is, it is read back without any parsing.
  *
  * @return A status code indicating success or failure. Returns CUOPT_INVALID_ARGUMENT
  *         if an unsupported format is specified.
@@ -406,6 +416,130 @@ cuopt_int_t cuOptCreateQuadraticRangedProblem(
   const cuopt_float_t* variable_upper_bounds,
   cuOptOptimizationProblem* problem_ptr);
 
+/** @brief Create an optimization problem from arrays in device memory
+ *
+ * Same as ``cuOptCreateProblem``, except that every array is a pointer to device memory. The
+ * arrays are copied from the device without going through the host, after the work already
+ * queued on the given stream. They can be released once the function returns.
+ *
+ * @param[in] num_constraints The number of constraints
+ * @param[in] num_variables The number of variables
+ * @param[in] objective_sense The objective sense (CUOPT_MINIMIZE or CUOPT_MAXIMIZE)
+ * @param[in] objective_offset An offset to add to the linear objective
+ * @param[in] objective_coefficients A device pointer to an array of type cuopt_float_t of size
+ *            num_variables containing the coefficients of the linear objective
+ * @param[in] constraint_matrix_row_offsets A device pointer to an array of type cuopt_int_t of
+ *            size num_constraints + 1 containing the row offsets of the constraint matrix
+ * @param[in] constraint_matrix_column_indices A device pointer to an array of type cuopt_int_t
+ *            of size constraint_matrix_row_offsets[num_constraints] containing the column
+ *            indices of the non-zero elements of the constraint matrix
+ * @param[in] constraint_matrix_coefficent_values A device pointer to an array of type
+ *            cuopt_float_t of size constraint_matrix_row_offsets[num_constraints] containing
+ *            the values of the non-zero elements of the constraint matrix
+ * @param[in] constraint_sense A device pointer to an array of type char of size
+ *            num_constraints containing the sense of the constraints (CUOPT_LESS_THAN,
+ *            CUOPT_GREATER_THAN, or CUOPT_EQUAL)
+ * @param[in] rhs A device pointer to an array of type cuopt_float_t of size num_constraints
+ *            containing the right-hand side of the constraints
+ * @param[in] lower_bounds A device pointer to an array of type cuopt_float_t of size
+ *            num_variables containing the lower bounds of the variables
+ * @param[in] upper_bounds A device pointer to an array of type cuopt_float_t of size
+ *            num_variables containing the upper bounds of the variables
+ * @param[in] variable_types A device pointer to an array of type char of size num_variables
+ *            containing the types of the variables (CUOPT_CONTINUOUS or CUOPT_INTEGER)
+ * @param[in] stream The cudaStream_t the arrays are produced on, NULL for the default stream
+ * @param[out] problem_ptr Pointer to store the created optimization problem
+ * @return CUOPT_SUCCESS if successful, CUOPT_INVALID_ARGUMENT if a pointer is NULL or the
+ *         arrays could not be read from the device, CUOPT_OUT_OF_MEMORY if the device memory
+ *         for the problem could not be allocated
+ */
+cuopt_int_t cuOptCreateProblemFromDevice(cuopt_int_t num_constraints,
+                                         cuopt_int_t num_variables,
+                                         cuopt_int_t objective_sense,
+                                         cuopt_float_t objective_offset,
+                                         const cuopt_float_t* objective_coefficients,
+                                         const cuopt_int_t* constraint_matrix_row_offsets,
+                                         const cuopt_int_t* constraint_matrix_column_indices,
+                                         const cuopt_float_t* constraint_matrix_coefficent_values,
+                                         const char* constraint_sense,
+                                         const cuopt_float_t* rhs,
+                                         const cuopt_float_t* lower_bounds,
+                                         const cuopt_float_t* upper_bounds,
+                                         const char* variable_types,
+                                         void* stream,
+                                         cuOptOptimizationProblem* problem_ptr);
+
+/** @brief Create a ranged optimization problem from arrays in device memory
+ *
+ * Same as ``cuOptCreateRangedProblem``, except that every array is a pointer to device memory.
+ * The arrays are copied from the device without going through the host, after the work already
+ * queued on the given stream. They can be released once the function returns.
+ *
+ * @param[in] num_constraints - The number of constraints.
+ *
+ * @param[in] num_variables - The number of variables.
+ *
+ * @param[in] objective_sense - The objective sense (CUOPT_MINIMIZE for
+ *  minimization or CUOPT_MAXIMIZE for maximization)
+ *
+ * @param[in] objective_offset - An offset to add to the linear objective.
+ *
+ * @param[in] objective_coefficients - A device pointer to an array of type cuopt_float_t
+ *  of size num_variables containing the coefficients of the linear objective.
+ *
+ * @param[in] constraint_matrix_row_offsets - A device pointer to an array of type
+ *  cuopt_int_t of size num_constraints + 1 containing the row offsets of the constraint matrix.
+ *
+ * @param[in] constraint_matrix_column_indices - A device pointer to an array of type
+ *  cuopt_int_t of size constraint_matrix_row_offsets[num_constraints] containing
+ *  the column indices of the non-zero elements of the constraint matrix.
+ *
+ * @param[in] constraint_matrix_coefficients - A device pointer to an array of type
+ *  cuopt_float_t of size constraint_matrix_row_offsets[num_constraints] containing
+ *  the values of the non-zero elements of the constraint matrix.
+ *
+ * @param[in] constraint_lower_bounds - A device pointer to an array of type
+ *  cuopt_float_t of size num_constraints containing the lower bounds of the constraints.
+ *
+ * @param[in] constraint_upper_bounds - A device pointer to an array of type
+ *  cuopt_float_t of size num_constraints containing the upper bounds of the constraints.
+ *
+ * @param[in] variable_lower_bounds - A device pointer to an array of type
+ *  cuopt_float_t of size num_variables containing the lower bounds of the variables.
+ *
+ * @param[in] variable_upper_bounds - A device pointer to an array of type
+ *  cuopt_float_t of size num_variables containing the upper bounds of the variables.
+ *
+ * @param[in] variable_types - A device pointer to an array of type char of size
+ *  num_variables containing the types of the variables (CUOPT_CONTINUOUS or
+ *  CUOPT_INTEGER).
+ *
+ * @param[in] stream - The cudaStream_t the arrays are produced on, NULL for the default
+ *  stream.
+ *
+ * @param[out] problem_ptr - A pointer to a cuOptOptimizationProblem.
+ * On output the problem will be created and initialized with the provided data.
+ *
+ * @return CUOPT_SUCCESS on success, CUOPT_INVALID_ARGUMENT if a pointer is NULL or the arrays
+ *  could not be read from the device, CUOPT_OUT_OF_MEMORY if the device memory for the problem
+ *  could not be allocated.
+ */
+cuopt_int_t cuOptCreateRangedProblemFromDevice(cuopt_int_t num_constraints,
+                                               cuopt_int_t num_variables,
+                                               cuopt_int_t objective_sense,
+                                               cuopt_float_t objective_offset,
+                                               const cuopt_float_t* objective_coefficients,
+                                               const cuopt_int_t* constraint_matrix_row_offsets,
+                                               const cuopt_int_t* constraint_matrix_column_indices,
+                                               const cuopt_float_t* constraint_matrix_coefficients,
+                                               const cuopt_float_t* constraint_lower_bounds,
+                                               const cuopt_float_t* constraint_upper_bounds,
+                                               const cuopt_float_t* variable_lower_bounds,
+                                               const cuopt_float_t* variable_upper_bounds,
+                                               const char* variable_types,
+                                               void* stream,
+                                               cuOptOptimizationProblem* problem_ptr);
+
 /** @brief Destroy an optimization problem
  *
  * @param[in, out] problem_ptr - A pointer to a cuOptOptimizationProblem. On
@@ -591,6 +725,146 @@ cuopt_int_t cuOptGetVariableUpperBounds(cuOptOptimizationProblem problem,
  */
 cuopt_int_t cuOptGetVariableTypes(cuOptOptimizationProblem problem, char* variable_types_ptr);
 
+/** @brief Set some of the objective coefficients of an optimization problem in place.
+ *
+ * The next ``cuOptSolve`` of a modified problem starts from the solution of the previous solve
+ * of the problem, unless the solver settings provide an initial solution. For a MIP, only a
+ * feasible solution of the previous solve is used.
+ *
+ * @param[in] problem - The optimization problem.
+ *
+ * @param[in] num_entries - The number of coefficients to set.
+ *
+ * @param[in] variable_indices - A pointer to an array of type cuopt_int_t of size num_entries
+ *  containing the indices of the variables whose coefficient is set.
+ *
+ * @param[in] objective_coefficients - A pointer to an array of type cuopt_float_t of size
+ *  num_entries containing the new coefficients.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptSetObjectiveCoefficients(cuOptOptimizationProblem problem,
+                                          cuopt_int_t num_entries,
+                                          const cuopt_int_t* variable_indices,
+                                          const cuopt_float_t* objective_coefficients);
+
+/** @brief Set the bounds of some of the variables of an optimization problem in place.
+ *
+ * The next ``cuOptSolve`` of a modified problem starts from the solution of the previous solve
+ * of the problem, unless the solver settings provide an initial solution. For a MIP, only a
+ * feasible solution of the previous solve is used.
+ *
+ * @param[in] problem - The optimization problem.
+ *
+ * @param[in] num_entries - The number of variables whose bounds are set.
+ *
+ * @param[in] variable_indices - A pointer to an array of type cuopt_int_t of size num_entries
+ *  containing the indices of the variables.
+ *
+ * @param[in] lower_bounds - A pointer to an array of type cuopt_float_t of size num_entries
+ *  containing the new lower bounds of the variables.
+ *
+ * @param[in] upper_bounds - A pointer to an array of type cuopt_float_t of size num_entries
+ *  containing the new upper bounds of the variables.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptSetVariableBounds(cuOptOptimizationProblem problem,
+                                   cuopt_int_t num_entries,
+                                   const cuopt_int_t* variable_indices,
+                                   const cuopt_float_t* lower_bounds,
+                                   const cuopt_float_t* upper_bounds);
+
+/** @brief Set the bounds of some of the constraints of a ranged optimization problem in place.
+ *
+ * The problem must have constraint lower and upper bounds, as created by
+ * ``cuOptCreateRangedProblem``. The next ``cuOptSolve`` of a modified problem starts from the
+ * solution of the previous solve of the problem, unless the solver settings provide an initial
+ * solution. For a MIP, only a feasible solution of the previous solve is used.
+ *
+ * @param[in] problem - The optimization problem.
+ *
+ * @param[in] num_entries - The number of constraints whose bounds are set.
+ *
+ * @param[in] constraint_indices - A pointer to an array of type cuopt_int_t of size num_entries
+ *  containing the indices of the constraints.
+ *
+ * @param[in] lower_bounds - A pointer to an array of type cuopt_float_t of size num_entries
+ *  containing the new lower bounds of the constraints.
+ *
+ * @param[in] upper_bounds - A pointer to an array of type cuopt_float_t of size num_entries
+ *  containing the new upper bounds of the constraints.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptSetConstraintBounds(cuOptOptimizationProblem problem,
+                                     cuopt_int_t num_entries,
+                                     const cuopt_int_t* constraint_indices,
+                                     const cuopt_float_t* lower_bounds,
+                                     const cuopt_float_t* upper_bounds);
+
+/** @brief Set some of the right-hand side entries of an optimization problem in place.
+ *
+ * The problem must have a right-hand side, as created by ``cuOptCreateProblem``. The next
+ * ``cuOptSolve`` of a modified problem starts from the solution of the previous solve of the
+ * problem, unless the solver settings provide an initial solution. For a MIP, only a feasible
+ * solution of the previous solve is used.
+ *
+ * @param[in] problem - The optimization problem.
+ *
+ * @param[in] num_entries - The number of right-hand side entries to set.
+ *
+ * @param[in] constraint_indices - A pointer to an array of type cuopt_int_t of size num_entries
+ *  containing the indices of the constraints.
+ *
+ * @param[in] rhs - A pointer to an array of type cuopt_float_t of size num_entries containing
+ *  the new right-hand side entries.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptSetConstraintRightHandSide(cuOptOptimizationProblem problem,
+                                            cuopt_int_t num_entries,
+                                            const cuopt_int_t* constraint_indices,
+                                            const cuopt_float_t* rhs);
+
+/** @brief Create a solver context on the current device.
+ *
+ * @details The context installs a stream ordered memory pool as the memory resource of the
+ * current device until it is destroyed. The pool keeps the memory it grew to between solves
+ * instead of releasing it to the device. The contexts of a device share its pool, which is
+ * installed by the first of them and removed when the last of them is destroyed, in any order.
+ *
+ * @param[out] context_ptr - A pointer to a cuOptSolverContext object. On output
+ * the context will be created.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptCreateSolverContext(cuOptSolverContext* context_ptr);
+
+/** @brief Destroy a solver context.
+ *
+ * @details The problems created while the context was current, and the solutions of their
+ * solves, must be destroyed before it: their device memory comes from the pool of the context.
+ * When it is the last context of the device, the memory resource the device had before the first
+ * of them was created is restored, unless another resource was installed in the meantime.
+ *
+ * @param[in, out] context_ptr - A pointer to a cuOptSolverContext object. On output
+ * the context will be destroyed and the pointer will be set to NULL.
+ */
+void cuOptDestroySolverContext(cuOptSolverContext* context_ptr);
+
+/** @brief Set the solver context of the calling thread.
+ *
+ * @details The problems created afterwards on this thread, and their solves, use the library
+ * handles of the context instead of creating their own. A context must not be used by several
+ * threads at the same time.
+ *
+ * @param[in] context - The context to use, or NULL to go back to one set of handles per problem.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptSetSolverContext(cuOptSolverContext context);
+
 /** @brief Create a solver settings object.
  *
  * @param[out] settings_ptr - A pointer to a cuOptSolverSettings object. On output
@@ -900,6 +1174,23 @@ cuopt_int_t cuOptGetErrorString(cuOptSolution solution,
  */
 cuopt_int_t cuOptGetPrimalSolution(cuOptSolution solution, cuopt_float_t* solution_values);
 
+/**
+ * @brief Get the solution of an optimization problem into device memory.
+ *
+ * @param[in] solution - The solution object.
+ *
+ * @param[in, out] solution_values - A device pointer to an array of type cuopt_float_t of size
+ * num_variables that will contain the solution values.
+ *
+ * @param[in] stream - The cudaStream_t the copy is ordered on, NULL for the default stream. The
+ * function returns without waiting for the copy, which is complete once the stream is.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptGetPrimalSolutionToDevice(cuOptSolution solution,
+                                           cuopt_float_t* solution_values,
+                                           void* stream);
+
 /** @brief Get the objective value of an optimization problem.
  *
  * @param[in] solution - The solution object.
@@ -921,6 +1212,30 @@ cuopt_int_t cuOptGetObjectiveValue(cuOptSolution solution, cuopt_float_t* object
  */
 cuopt_int_t cuOptGetSolveTime(cuOptSolution solution, cuopt_float_t* solve_time_ptr);
 
+/** @brief Get the GPU time spent in each phase of PDLP.
+ *
+ * @note Only available for LP solutions solved with the CUOPT_COLLECT_PHASE_TIMINGS parameter set,
+ * all times are 0 otherwise.
+ *
+ * @param[in] solution - The solution object.
+ *
+ * @param[in,out] pdhg_step_time_ptr - A pointer to a cuopt_float_t that will contain the time in
+ * seconds spent in the PDHG steps (SpMVs and projections).
+ * @param[in,out] step_size_time_ptr - A pointer to a cuopt_float_t that will contain the time in
+ * seconds spent computing adaptive step sizes.
+ * @param[in,out] restart_time_ptr - A pointer to a cuopt_float_t that will contain the time in
+ * seconds spent in restarts.
+ * @param[in,out] termination_check_time_ptr - A pointer to a cuopt_float_t that will contain the
+ * time in seconds spent in termination checks.
+ *
+ * @return A status code indicating success or failure.
+ */
+cuopt_int_t cuOptGetPDLPPhaseTimes(cuOptSolution solution,
+                                   cuopt_float_t* pdhg_step_time_ptr,
+                                   cuopt_float_t* step_size_time_ptr,
+                                   cuopt_float_t* restart_time_ptr,
+                                   cuopt_float_t* termination_check_time_ptr);
+
 /** @brief Get the relative MIP gap of an optimization problem.
  *
  * @param[in] solution - The solution object.
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include <cuopt/linear_programming/constants.h>
@@ -24,6 +25,15 @@ struct benchmark_info_t {
   double last_improvement_of_best_feasible    = 0;
   double last_improvement_after_recombination = 0;
   double objective_of_initial_population      = std::numeric_limits<double>::max();
+  // Scaling of the branch and bound tree search: its wall time and nodes, the time the threads
+  // were blocked on the incumbent, heuristic queue and LP locks, and the idle time of each worker
+  double tree_search_time               = 0;
+  int64_t tree_search_nodes             = 0;
+  double upper_bound_lock_wait_time     = 0;
+  double heuristic_queue_lock_wait_time = 0;
+  double original_lp_lock_wait_time     = 0;
+  int64_t num_contended_locks           = 0;
+  std::vector<double> worker_idle_time;
 };
 
 // Forward declare solver_settings_t for friend class
@@ -87,23 +97,40 @@ class mip_solver_settings_t {
   f_t work_limit                = std::numeric_limits<f_t>::infinity();
   i_t node_limit                = std::numeric_limits<i_t>::max();
   bool heuristics_only          = false;
+  // Favor the end to end time of small solves: presolve is skipped when it is not expected to
+  // reduce the problem and the heuristics run with a small population and short phases
+  bool latency_mode             = false;
   i_t reliability_branching     = -1;
   i_t num_cpu_threads           = -1;  // -1 means use default number of threads in branch and bound
   i_t max_cut_passes            = 10;  // number of cut passes to make
   i_t mir_cuts                  = -1;
   i_t mixed_integer_gomory_cuts = -1;
   i_t knapsack_cuts             = -1;
+  i_t clique_cuts               = -1;
+  i_t flow_cover_cuts           = -1;
+  i_t node_cut_depth            = 0;  // depth up to which cuts are separated at the nodes
   i_t strong_chvatal_gomory_cuts      = -1;
   i_t reduced_cost_strengthening      = -1;
+  i_t symmetry                        = -1;
+  i_t conflict_analysis               = -1;
   f_t cut_change_threshold            = 1e-3;
   f_t cut_min_orthogonality           = 0.5;
   i_t mip_batch_pdlp_strong_branching = 0;
+  f_t node_memory_limit               = std::numeric_limits<f_t>::infinity();  // in MB
+  f_t device_memory_limit             = std::numeric_limits<f_t>::infinity();  // in MB, per device
+  f_t checkpoint_interval             = 600;  // seconds between checkpoints
+  i_t checkpoint_split                = 1;    // parts the final checkpoint is split into
   i_t num_gpus                        = 1;
   bool log_to_console                 = true;
 
   std::string log_file;
   std::string sol_file;
   std::string user_problem_file;
+  std::string checkpoint_file;
+  std::string presolve_cache_file;
+  std::string warm_start_cache_dir;
+  std::string trace_file;
+  std::string work_unit_calibration_file;
 
   /** Initial primal solutions */
   std::vector<std::shared_ptr<rmm::device_uvector<f_t>>> initial_solutions;
@@ -69,6 +69,7 @@ class mip_solution_t : public base_solution_t {
   f_t get_max_int_violation() const;
   f_t get_max_variable_bound_violation() const;
   solver_stats_t<i_t, f_t> get_stats() const;
+  solver_stats_t<i_t, f_t>& get_stats();
   i_t get_num_nodes() const;
   i_t get_num_simplex_iterations() const;
   const std::vector<std::string>& get_variable_names() const;
@@ -22,6 +22,10 @@ struct solver_stats_t {
     if (this == &other) { return *this; }
     total_solve_time = other.total_solve_time;
     presolve_time    = other.presolve_time;
+    setup_time       = other.setup_time;
+    preprocess_time  = other.preprocess_time;
+    search_time      = other.search_time;
+    postsolve_time   = other.postsolve_time;
     solution_bound.store(other.solution_bound.load(std::memory_order_relaxed),
                          std::memory_order_relaxed);
     num_nodes              = other.num_nodes;
@@ -35,6 +39,13 @@ struct solver_stats_t {
 
   f_t total_solve_time = 0.;
   f_t presolve_time    = 0.;
+  // Latency breakdown of the solve in seconds: checks and copies of the input before presolve,
+  // scaling and preprocessing of the presolved problem, heuristics and branch and bound, and the
+  // mapping of the solution back to the original problem
+  f_t setup_time      = 0.;
+  f_t preprocess_time = 0.;
+  f_t search_time     = 0.;
+  f_t postsolve_time  = 0.;
   std::atomic<f_t> solution_bound;
   i_t num_nodes              = 0;
   i_t num_simplex_iterations = 0;
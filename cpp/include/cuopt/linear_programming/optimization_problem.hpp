@@ -242,6 +242,47 @@ class optimization_problem_t {
    */
   const std::vector<f_t>& get_quadratic_objective_values() const;
 
+  /**
+   * @brief Set the quadratic objective in factored form Q = F^T * F, with F in CSR format.
+   *
+   * @note The objective function is x^T * F^T * F * x + c^T * x. F has one column per variable
+   * and any number of rows, for example the factor loadings and the square root of the specific
+   * risks of a portfolio model. Q is never formed and each product Q * x costs two sparse
+   * products with F, which keeps large dense risk models tractable. Only PDLP solves problems with
+   * a factored quadratic objective. It can't be combined with set_quadratic_objective_matrix.
+   *
+   * @param[in] F_values Values of the CSR representation of the factor
+   * @param size_values Size of the F_values array
+   * @param[in] F_indices Indices of the CSR representation of the factor
+   * @param size_indices Size of the F_indices array
+   * @param[in] F_offsets Offsets of the CSR representation of the factor
+   * @param size_offsets Size of the F_offsets array, the number of rows of F plus one
+   */
+  void set_quadratic_objective_factor(const f_t* F_values,
+                                      i_t size_values,
+                                      const i_t* F_indices,
+                                      i_t size_indices,
+                                      const i_t* F_offsets,
+                                      i_t size_offsets);
+
+  /**
+   * @brief Get the quadratic objective factor offsets
+   * @return const reference to the F_offsets vector
+   */
+  const std::vector<i_t>& get_quadratic_objective_factor_offsets() const;
+
+  /**
+   * @brief Get the quadratic objective factor indices
+   * @return const reference to the F_indices vector
+   */
+  const std::vector<i_t>& get_quadratic_objective_factor_indices() const;
+
+  /**
+   * @brief Get the quadratic objective factor values
+   * @return const reference to the F_values vector
+   */
+  const std::vector<f_t>& get_quadratic_objective_factor_values() const;
+
   /**
    * @brief Set the variables (x) lower bounds.
    * @note Setting before calling the solver is optional, default value for all
@@ -357,6 +398,13 @@ class optimization_problem_t {
    */
   void write_to_mps(const std::string& mps_file_path);
 
+  /**
+   * @brief Write the problem to a cuOpt binary problem file, which is read back without parsing
+   *
+   * @param[in] binary_file_path Path to the binary file to write
+   */
+  void write_to_binary(const std::string& binary_file_path);
+
   /* Print scaling information */
   void print_scaling_information() const;
 
@@ -398,6 +446,7 @@ class optimization_problem_t {
   const std::vector<std::string>& get_row_names() const;
 
   bool has_quadratic_objective() const;
+  bool has_factored_quadratic_objective() const;
 
   /**
    * @brief Gets the device-side view (with raw pointers), for ease of access
@@ -406,6 +455,7 @@ class optimization_problem_t {
   view_t view() const;
 
  private:
+  void write_to_file(const std::string& file_path, bool binary);
   void add_row_related_vars_to_row(std::vector<i_t>& indices,
                                    std::vector<f_t>& values,
                                    std::vector<i_t>& A_offsets,
@@ -445,6 +495,10 @@ class optimization_problem_t {
   std::vector<i_t> Q_offsets_;
   std::vector<i_t> Q_indices_;
   std::vector<f_t> Q_values_;
+  /** Factor F of the quadratic objective in CSR format (for x^T * F^T * F * x term) */
+  std::vector<i_t> F_offsets_;
+  std::vector<i_t> F_indices_;
+  std::vector<f_t> F_values_;
 
   /** lower bounds of the variables (primal part) */
   rmm::device_uvector<f_t> variable_lower_bounds_;
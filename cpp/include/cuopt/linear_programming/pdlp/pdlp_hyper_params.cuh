@@ -53,6 +53,21 @@ struct pdlp_hyper_params_t {
   double restart_k_d                                              = 0.0;
   double restart_i_smooth                                         = 0.3;
   bool use_conditional_major                                      = true;
+  // Only used in non-batch reflected mode: replaces cuSPARSE SpMV + projection by a single
+  // custom CSR kernel to limit the number of passes over the primal and dual vectors
+  bool use_fused_spmv_projection = false;
+  // Only used in non-batch reflected mode with double precision: PDHG steps read an FP32 copy of
+  // the constraint matrix (accumulating in FP64) while restart and termination checks stay in FP64
+  // Falls back to the FP64 matrix once the fixed point error stops decreasing for
+  // mixed_precision_stall_checks consecutive checks, so it also requires use_fixed_point_error
+  bool use_mixed_precision_spmv    = false;
+  int mixed_precision_stall_checks = 3;
+  // Only used with the adaptive step size strategy outside batch mode and for LPs: after a
+  // rejected step, the next trial takes the steps of this many candidate step sizes at once, each
+  // speculative_step_size_ratio times the previous one, and accepts the largest valid one. Their
+  // A x and A^T y are each one SpMM, so a trial still reads the matrix twice. 1 retries serially
+  int speculative_step_size_candidates = 1;
+  double speculative_step_size_ratio   = 0.5;
 };
 
 // TODO most likely we want to get rid of pdlp_solver_mode and just have prebuilt
@@ -39,6 +39,11 @@ struct pdlp_warm_start_data_t {
   f_t last_restart_kkt_score_{-1};
   f_t sum_solution_weight_{-1};
   i_t iterations_since_last_restart_{-1};
+  // Cumulative Ruiz / Pock-Chambolle scaling of the (presolved) problem, can be handed back through
+  // set_initial_scaling_vectors to skip the scaling passes on a structurally identical problem.
+  // Empty when not exported (batch mode or built from a view)
+  rmm::device_uvector<f_t> variable_scaling_{0, rmm::cuda_stream_default};
+  rmm::device_uvector<f_t> constraint_scaling_{0, rmm::cuda_stream_default};
 
   // Constructor when building it in the solution object
   pdlp_warm_start_data_t(rmm::device_uvector<f_t>& current_primal_solution,
@@ -68,6 +73,8 @@ struct pdlp_warm_start_data_t {
 
   // Copy constructor for when copying the solver_settings object in the PDLP object
   pdlp_warm_start_data_t(const pdlp_warm_start_data_t<i_t, f_t>& other);
+  // Move constructor, hands the device buffers over without any copy
+  pdlp_warm_start_data_t(pdlp_warm_start_data_t<i_t, f_t>&& other) = default;
   pdlp_warm_start_data_t& operator=(pdlp_warm_start_data_t&& other) = default;
 
  private:
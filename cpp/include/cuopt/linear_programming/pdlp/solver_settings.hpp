@@ -11,6 +11,7 @@
 #include <cuopt/linear_programming/pdlp/pdlp_hyper_params.cuh>
 #include <cuopt/linear_programming/pdlp/pdlp_warm_start_data.hpp>
 #include <cuopt/linear_programming/utilities/internals.hpp>
+#include <memory>
 #include <optional>
 #include <raft/core/device_span.hpp>
 #include <rmm/device_uvector.hpp>
@@ -28,7 +29,9 @@ class solver_settings_t;
  * operate.
  *
  * Stable3: Best overall mode from experiments; balances speed and convergence
- * success. If you want to use the legacy version, use Stable2.
+ * success. Runs the reflected Halpern PDHG with a fixed point residual restart
+ * schedule and a PID controlled primal weight (cuPDLPx). If you want to use the
+ * legacy version, use Stable2.
  * Methodical1: Usually leads to slower individual steps but fewer are needed to
  * converge. It uses from 1.3x up to 1.7x times more memory.
  * Fast1: Less convergence success but usually yields the highest speed
@@ -59,7 +62,8 @@ enum method_t : int {
   Concurrent  = CUOPT_METHOD_CONCURRENT,
   PDLP        = CUOPT_METHOD_PDLP,
   DualSimplex = CUOPT_METHOD_DUAL_SIMPLEX,
-  Barrier     = CUOPT_METHOD_BARRIER
+  Barrier     = CUOPT_METHOD_BARRIER,
+  Automatic   = CUOPT_METHOD_AUTOMATIC
 };
 
 template <typename i_t, typename f_t>
@@ -118,6 +122,27 @@ class pdlp_solver_settings_t {
                                  i_t size,
                                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+  /**
+   * @brief Set the initial scaling vectors, skipping the Ruiz and Pock-Chambolle scaling passes.
+   *
+   * @note Meant to be used with the `variable_scaling_` and `constraint_scaling_` vectors exported
+   * in the pdlp warm start data of a previous solve of a structurally identical problem (same
+   * constraint matrix). Sizes not matching the problem fed to PDLP fall back to computing the
+   * scaling.
+   *
+   * @param[in] variable_scaling Device or host memory pointer to a floating point array of size
+   * primal_size. cuOpt copies this data.
+   * @param primal_size Size of the variable_scaling array.
+   * @param[in] constraint_scaling Device or host memory pointer to a floating point array of size
+   * dual_size. cuOpt copies this data.
+   * @param dual_size Size of the constraint_scaling array.
+   */
+  void set_initial_scaling_vectors(const f_t* variable_scaling,
+                                   i_t primal_size,
+                                   const f_t* constraint_scaling,
+                                   i_t dual_size,
+                                   rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
   /** TODO batch mode: tmp
    * @brief Set an initial step size.
    *
@@ -137,6 +162,9 @@ class pdlp_solver_settings_t {
    * previous solution
    *
    * @note Interface for the C++ side. Only Stable2 and Fast1 are supported.
+   * @note The device buffers of pdlp_warm_start_data_view are moved into the settings and left
+   * empty: no copy is made, neither host nor device. Copies of the settings (including the ones
+   * made internally by the solver) share the same warm start data.
    *
    * @param pdlp_warm_start_data_view Pdlp warm start data from your solution
    * object to warm start from
@@ -150,6 +178,13 @@ class pdlp_solver_settings_t {
                                   rmm::device_uvector<i_t>{0, rmm::cuda_stream_default},
                                 const rmm::device_uvector<i_t>& constraint_mapping =
                                   rmm::device_uvector<i_t>{0, rmm::cuda_stream_default});
+  // Same but explicitly transferring ownership, e.g.
+  // set_pdlp_warm_start_data(std::move(solution.get_pdlp_warm_start_data()))
+  void set_pdlp_warm_start_data(pdlp_warm_start_data_t<i_t, f_t>&& pdlp_warm_start_data,
+                                const rmm::device_uvector<i_t>& var_mapping =
+                                  rmm::device_uvector<i_t>{0, rmm::cuda_stream_default},
+                                const rmm::device_uvector<i_t>& constraint_mapping =
+                                  rmm::device_uvector<i_t>{0, rmm::cuda_stream_default});
 
   // Same but for the Cython interface
   void set_pdlp_warm_start_data(const f_t* current_primal_solution,
@@ -190,6 +225,11 @@ class pdlp_solver_settings_t {
   bool has_initial_primal_solution() const;
   bool has_initial_dual_solution() const;
 
+  const rmm::device_uvector<f_t>& get_initial_variable_scaling() const;
+  const rmm::device_uvector<f_t>& get_initial_constraint_scaling() const;
+
+  bool has_initial_scaling_vectors() const;
+
   struct tolerances_t {
     f_t absolute_dual_tolerance     = 1.0e-4;
     f_t relative_dual_tolerance     = 1.0e-4;
@@ -210,14 +250,22 @@ class pdlp_solver_settings_t {
   bool strict_infeasibility{false};
   i_t iteration_limit{std::numeric_limits<i_t>::max()};
   double time_limit{std::numeric_limits<double>::infinity()};
+  // MB of device memory the solve may allocate through RMM. Shared by the solves running at the
+  // same time on a device, the first of them sets it
+  f_t device_memory_limit{std::numeric_limits<f_t>::infinity()};
   pdlp_solver_mode_t pdlp_solver_mode{pdlp_solver_mode_t::Stable3};
   bool log_to_console{true};
   std::string log_file{""};
   std::string sol_file{""};
   std::string user_problem_file{""};
+  std::string warm_start_cache_dir{""};
   bool per_constraint_residual{false};
   bool crossover{false};
   bool cudss_deterministic{false};
+  bool barrier_hybrid_memory{false};
+  bool barrier_pcg{false};
+  f_t barrier_pcg_tolerance{1e-8};
+  bool barrier_mixed_precision{false};
   i_t folding{-1};
   i_t augmented{-1};
   i_t dualize{-1};
@@ -226,7 +274,12 @@ class pdlp_solver_settings_t {
   bool eliminate_dense_columns{true};
   bool save_best_primal_so_far{false};
   bool first_primal_feasible{false};
+  // Accumulate GPU time per PDLP phase with CUDA events, reported in the solution object
+  bool collect_phase_timings{false};
   presolver_t presolver{presolver_t::Default};
+  // Favor the end to end time of small solves: presolve is skipped when it is not expected to
+  // reduce the problem
+  bool latency_mode{false};
   bool dual_postsolve{true};
   int num_gpus{1};
   method_t method{method_t::Concurrent};
@@ -247,14 +300,18 @@ class pdlp_solver_settings_t {
   std::shared_ptr<rmm::device_uvector<f_t>> initial_primal_solution_;
   /** Initial dual solution */
   std::shared_ptr<rmm::device_uvector<f_t>> initial_dual_solution_;
+  /** Initial variable and constraint scaling vectors */
+  std::shared_ptr<rmm::device_uvector<f_t>> initial_variable_scaling_;
+  std::shared_ptr<rmm::device_uvector<f_t>> initial_constraint_scaling_;
   /** Initial step size */
   // TODO batch mode: tmp
   std::optional<f_t> initial_step_size_;
   /** Initial primal weight */
   // TODO batch mode: tmp
   std::optional<f_t> initial_primal_weight_;
-  // For the C++ interface
-  pdlp_warm_start_data_t<i_t, f_t> pdlp_warm_start_data_;
+  // For the C++ interface, shared so that copying the settings doesn't duplicate the device buffers
+  std::shared_ptr<pdlp_warm_start_data_t<i_t, f_t>> pdlp_warm_start_data_{
+    std::make_shared<pdlp_warm_start_data_t<i_t, f_t>>()};
   // For the Cython interface
   pdlp_warm_start_data_view_t<i_t, f_t> pdlp_warm_start_data_view_;
 
@@ -88,6 +88,17 @@ class optimization_problem_solution_t : public base_solution_t {
     /** Solve time in seconds */
     double solve_time{std::numeric_limits<double>::signaling_NaN()};
 
+    /** GPU time in seconds spent in each phase of the PDLP loop, only filled if
+     * collect_phase_timings is set */
+    /** PDHG step: SpMVs, projections and primal/dual updates */
+    double pdhg_step_time{0};
+    /** Adaptive step size computation */
+    double step_size_time{0};
+    /** Restart, fixed point error and Halpern update */
+    double restart_time{0};
+    /** Convergence, infeasibility and termination checks */
+    double termination_check_time{0};
+
     /** Whether the problem was solved by PDLP or Dual Simplex */
     bool solved_by_pdlp{false};
   };
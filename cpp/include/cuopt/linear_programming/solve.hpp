@@ -16,6 +16,7 @@
 #include <cuopt/linear_programming/utilities/internals.hpp>
 
 #include <mps_parser/mps_data_model.hpp>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -108,6 +109,42 @@ optimization_problem_solution_t<i_t, f_t> batch_pdlp_solve(
   const std::vector<f_t>& root_soln_x,
   pdlp_solver_settings_t<i_t, f_t> const& settings = pdlp_solver_settings_t<i_t, f_t>{});
 
+/**
+ * @brief One linear program of a sequence sharing the constraint matrix of a base problem.
+ * Host vectors, an empty vector keeps the value of the base problem.
+ */
+template <typename i_t, typename f_t>
+struct lp_variant_t {
+  std::vector<f_t> objective_coefficients;
+  std::vector<f_t> constraint_lower_bounds;
+  std::vector<f_t> constraint_upper_bounds;
+  std::vector<f_t> variable_lower_bounds;
+  std::vector<f_t> variable_upper_bounds;
+};
+
+/**
+ * @brief Solve a sequence of linear programs sharing the same constraint matrix.
+ * @note The matrix stays on the device in op_problem, only the vectors of each variant are
+ * uploaded. With method PDLP and no presolve, each solve reuses the scaling vectors of the previous
+ * variant instead of computing them, and is warm started from its primal and dual solutions, step
+ * size and primal weight. The matrix descriptors are still set up again by each solve.
+ * op_problem is restored to its original vectors on return, also when a solve throws.
+ *
+ * @tparam i_t Data type of indexes
+ * @tparam f_t Data type of the variables and their weights in the equations
+ *
+ * @param[in] op_problem  An optimization_problem_t<i_t, f_t> object with the base linear program
+ * @param[in] variants  Objective and bound changes, one entry per linear program to solve
+ * @param[in] on_solution  Called with the variant index and its solution as soon as it is solved
+ * @param[in] settings  A pdlp_solver_settings_t<i_t, f_t> object used for every solve
+ */
+template <typename i_t, typename f_t>
+void solve_lp_sequence(
+  optimization_problem_t<i_t, f_t>& op_problem,
+  const std::vector<lp_variant_t<i_t, f_t>>& variants,
+  const std::function<void(size_t, optimization_problem_solution_t<i_t, f_t>&)>& on_solution,
+  pdlp_solver_settings_t<i_t, f_t> const& settings = pdlp_solver_settings_t<i_t, f_t>{});
+
 /**
  * @brief Mixed integer programming solve function.
  *
@@ -139,6 +176,28 @@ mip_solution_t<i_t, f_t> solve_mip(
   const cuopt::mps_parser::mps_data_model_t<i_t, f_t>& mps_data_model,
   mip_solver_settings_t<i_t, f_t> const& settings = mip_solver_settings_t<i_t, f_t>{});
 
+/**
+ * @brief Solve many independent mixed integer programs, several at a time on the current device.
+ * @note Meant for large batches of small problems. The problems are spread over a pool of worker
+ * threads, each with its own stream reused for all the problems it takes, and the CPU threads are
+ * split between the problems solved at the same time. The logger is configured once for the
+ * batch. The settings apply to every problem, the time limit is per problem.
+ *
+ * @tparam i_t Data type of indexes
+ * @tparam f_t Data type of the variables and their weights in the equations
+ *
+ * @param[in] problems  The problems to solve
+ * @param[in] on_solution  Called with the problem index and its solution as soon as it is solved,
+ * from the worker threads and possibly concurrently. The solution lives on the stream of the
+ * worker and is destroyed when the call returns.
+ * @param[in] settings  A mip_solver_settings_t<i_t, f_t> object used for every solve
+ */
+template <typename i_t, typename f_t>
+void solve_mip_batch(
+  const std::vector<const cuopt::mps_parser::mps_data_model_t<i_t, f_t>*>& problems,
+  const std::function<void(size_t, mip_solution_t<i_t, f_t>&)>& on_solution,
+  mip_solver_settings_t<i_t, f_t> const& settings = mip_solver_settings_t<i_t, f_t>{});
+
 template <typename i_t, typename f_t>
 optimization_problem_t<i_t, f_t> mps_data_model_to_optimization_problem(
   raft::handle_t const* handle_ptr,
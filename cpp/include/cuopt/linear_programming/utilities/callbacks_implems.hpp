@@ -32,6 +32,9 @@ class default_get_solution_callback_t : public get_solution_callback_t {
                     void* solution_bound,
                     void* user_data) override
   {
+    // Called from solver threads, the solve releases the GIL
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+
     PyObject* numpy_matrix = get_numpy_array(data, n_variables);
     PyObject* numpy_array  = get_numpy_array(objective_value, 1);
     PyObject* numpy_bound  = get_numpy_array(solution_bound, 1);
@@ -46,7 +49,13 @@ class default_get_solution_callback_t : public get_solution_callback_t {
     Py_DECREF(numpy_matrix);
     Py_DECREF(numpy_array);
     Py_DECREF(numpy_bound);
-    if (res != nullptr) { Py_DECREF(res); }
+    if (res != nullptr) {
+      Py_DECREF(res);
+    } else {
+      // The error must not stay set on the thread state of the solver thread
+      PyErr_Print();
+    }
+    PyGILState_Release(gil_state);
   }
 
   PyObject* pyCallbackClass;
@@ -69,6 +78,9 @@ class default_set_solution_callback_t : public set_solution_callback_t {
                     void* solution_bound,
                     void* user_data) override
   {
+    // Called from solver threads, the solve releases the GIL
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+
     PyObject* numpy_matrix = get_numpy_array(data, n_variables);
     PyObject* numpy_array  = get_numpy_array(objective_value, 1);
     PyObject* numpy_bound  = get_numpy_array(solution_bound, 1);
@@ -83,7 +95,13 @@ class default_set_solution_callback_t : public set_solution_callback_t {
     Py_DECREF(numpy_matrix);
     Py_DECREF(numpy_array);
     Py_DECREF(numpy_bound);
-    if (res != nullptr) { Py_DECREF(res); }
+    if (res != nullptr) {
+      Py_DECREF(res);
+    } else {
+      // The error must not stay set on the thread state of the solver thread
+      PyErr_Print();
+    }
+    PyGILState_Release(gil_state);
   }
 
   PyObject* pyCallbackClass;
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -12,6 +12,8 @@
 #include <cuopt/linear_programming/pdlp/solver_solution.hpp>
 #include <cuopt/linear_programming/solver_settings.hpp>
 #include <cuopt/linear_programming/utilities/internals.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mps_parser/data_model_view.hpp>
 #include <raft/core/handle.hpp>
@@ -90,6 +92,47 @@ struct solver_ret_t {
   // possibly add dual simplex return structure
 };
 
+/**
+ * @brief Flat layout of a problem, written once by a producer into a single host buffer, typically
+ * a shared memory segment, and solved without deserialization
+ *
+ * The buffer starts with this header. Each section is an array stored at offsets[s] bytes from the
+ * start of the buffer, aligned on the size of its elements, with sizes[s] elements: 8 byte floats
+ * for the values and bounds, 4 byte integers for the indices and offsets, 1 byte characters for
+ * the row and variable types. An empty section has a size of 0. Variable and row names are not
+ * part of the layout.
+ */
+enum class flat_problem_section_t : int {
+  constraint_matrix_values = 0,
+  constraint_matrix_indices,
+  constraint_matrix_offsets,
+  constraint_bounds,
+  objective_coefficients,
+  variable_lower_bounds,
+  variable_upper_bounds,
+  constraint_lower_bounds,
+  constraint_upper_bounds,
+  row_types,
+  variable_types,
+  quadratic_objective_values,
+  quadratic_objective_indices,
+  quadratic_objective_offsets,
+  n_sections
+};
+
+constexpr char flat_problem_magic[8]   = {'C', 'U', 'O', 'P', 'T', 'F', 'L', 'T'};
+constexpr uint32_t flat_problem_version = 1;
+
+struct flat_problem_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t maximize;
+  double objective_scaling_factor;
+  double objective_offset;
+  uint64_t offsets[static_cast<int>(flat_problem_section_t::n_sections)];
+  uint64_t sizes[static_cast<int>(flat_problem_section_t::n_sections)];
+};
+
 // Wrapper for solve to expose the API to cython.
 
 std::unique_ptr<solver_ret_t> call_solve(cuopt::mps_parser::data_model_view_t<int, double>*,
@@ -97,6 +140,22 @@ std::unique_ptr<solver_ret_t> call_solve(cuopt::mps_parser::data_model_view_t<in
                                          unsigned int flags = cudaStreamNonBlocking,
                                          bool is_batch_mode = false);
 
+/**
+ * @brief Solves a problem stored in the flat layout of flat_problem_header_t
+ *
+ * The arrays are read in place: the only copy is the one to the device. Large buffers are
+ * registered as pinned memory while they are copied, so the transfer goes straight from the buffer
+ * instead of through the staging memory of the driver.
+ *
+ * @param buffer Host buffer holding the header and the sections, it must outlive the call
+ * @param buffer_size Size of the buffer in bytes
+ * @throws cuopt::logic_error if the buffer is not a valid flat problem
+ */
+std::unique_ptr<solver_ret_t> call_solve_flat(const void* buffer,
+                                              std::size_t buffer_size,
+                                              linear_programming::solver_settings_t<int, double>*,
+                                              unsigned int flags = cudaStreamNonBlocking);
+
 std::pair<std::vector<std::unique_ptr<solver_ret_t>>, double> call_batch_solve(
   std::vector<cuopt::mps_parser::data_model_view_t<int, double>*>,
   linear_programming::solver_settings_t<int, double>*);
@@ -120,6 +120,7 @@ struct parameter_info_t<std::string> {
  * None: No presolver.
  * Papilo: Use the Papilo presolver.
  * PSLP: Use the PSLP presolver.
+ * GPU: Use the GPU presolver (LP only): fixed variables, empty rows and columns.
  *
  * @note Default presolver is None.
  */
@@ -127,7 +128,8 @@ enum presolver_t : int {
   Default = CUOPT_PRESOLVE_DEFAULT,
   None    = CUOPT_PRESOLVE_OFF,
   Papilo  = CUOPT_PRESOLVE_PAPILO,
-  PSLP    = CUOPT_PRESOLVE_PSLP
+  PSLP    = CUOPT_PRESOLVE_PSLP,
+  GPU     = CUOPT_PRESOLVE_GPU
 };
 
 }  // namespace linear_programming
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -10,8 +10,10 @@
 #include <cuopt/error.hpp>
 #include <cuopt/routing/routing_structures.hpp>
 #include <fstream>
+#include <map>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -120,6 +122,14 @@ class assignment_t {
    */
   double get_runtime() const noexcept;
 
+  /**
+   * @brief Returns the wall time of each phase of the problem setup, from the
+   * copies of the fleet and order data to the setup kernels. The phases
+   * include their device work.
+   * @return Map of the setup phase names to their times in seconds.
+   */
+  const std::map<std::string, double>& get_setup_times() const noexcept;
+
   /**
    * @brief Returns the route as a vector of locations. One entry per stop in
    * this vector.
@@ -221,6 +231,11 @@ class assignment_t {
    * @param status Solution status
    */
   void set_status(solution_status_t status);
+  /**
+   * @brief Set the setup times to the assignment object
+   * @param setup_times Wall time of each setup phase in seconds
+   */
+  void set_setup_times(std::map<std::string, double> setup_times);
   /**
    * @brief Get status
    * @return Solution status
@@ -243,6 +258,7 @@ class assignment_t {
   rmm::device_uvector<i_t> unserviced_nodes_;
   rmm::device_uvector<i_t> accepted_{};
   double timer{};
+  std::map<std::string, double> setup_times_{};
   i_t vehicle_count_{0};
   solution_status_t status_{solution_status_t::EMPTY};
   std::string solution_string_;
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -24,6 +24,8 @@ enum class dataset_distribution_t { CLUSTERED = 0, RANDOM, RANDOM_CLUSTERED };
  * @brief Container for dataset parameters.
  * @note Current generator provides a number of orders equal to
  * the number of locations so only n_locations is specified.
+ * n_vehicles defaults to one vehicle per order when zero. With pickup_delivery, the orders
+ * besides the depot are paired into pickup and delivery requests.
  * @tparam i_t Integer type. Needs to be int (32bit) at the moment. Please open
  * an issue if other type are needed.
  * @tparam f_t Floating point type. Needs to be float (32bit) at the moment.
@@ -49,6 +51,8 @@ struct dataset_params_t {
   f_t center_box_min{};
   f_t center_box_max{n_locations / 2.f};
   i_t seed{};
+  i_t n_vehicles{0};
+  bool pickup_delivery{false};
 };
 
 }  // namespace generator
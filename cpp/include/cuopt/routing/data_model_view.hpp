@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -96,6 +96,129 @@ class data_model_view_t {
    */
   void add_transit_time_matrix(f_t const* matrix, uint8_t vehicle_type = 0);
 
+  /**
+   * @brief Set time dependent transit times for all locations (depot
+   * included). The transit time of an arc is given for a small number of
+   * departure times, the bucket start times, and is linearly interpolated in
+   * between. It is constant before the first and after the last bucket start
+   * time. The values of an arc must satisfy the FIFO property: departing
+   * later never arrives earlier, so the arrival time can decrease by at most
+   * the time elapsed between two consecutive bucket start times. All the time
+   * dependent matrices must have the same number of buckets. They take
+   * precedence over the matrices set by add_transit_time_matrix and
+   * add_candidate_transit_time_matrix for the same vehicle type.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   * @param[in] matrices device memory pointer of size num_locations_ *
+   * num_locations_ * n_time_buckets. The values of an arc are contiguous: the
+   * transit time from i to j departing at the start of bucket b is at
+   * (i * num_locations_ + j) * n_time_buckets + b. cuOpt does not own or copy
+   * this data.
+   * @param[in] bucket_start_times device memory pointer of size
+   * n_time_buckets, the strictly increasing departure times of the buckets.
+   * cuOpt does not own or copy this data.
+   * @param[in] n_time_buckets number of time buckets.
+   * @param[in] vehicle_type Identifier of the vehicle.
+   */
+  void add_transit_time_matrix(f_t const* matrices,
+                               f_t const* bucket_start_times,
+                               i_t n_time_buckets,
+                               uint8_t vehicle_type = 0);
+
+  /**
+   * @brief Set the matrices of a vehicle type as an affine function of the
+   * matrices of another vehicle type instead of storing them. The cost between
+   * two distinct locations is cost_scale times the cost of the base vehicle
+   * type plus cost_offset, and the transit time is time_scale times the transit
+   * time of the base vehicle type plus time_offset. It models the vehicle types
+   * that only differ by a speed factor or a per unit cost with a single copy of
+   * the matrices on the device. A cost matrix set by add_cost_matrix or
+   * add_candidate_cost_matrix for the same vehicle type takes precedence.
+   * @note Not supported with time dependent transit times.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   * @param[in] base_vehicle_type Identifier of the vehicle whose matrices are
+   * scaled, its cost matrix must be set by add_cost_matrix or
+   * add_candidate_cost_matrix.
+   * @param[in] cost_scale factor applied to the costs of the base vehicle type.
+   * @param[in] cost_offset cost added to every arc.
+   * @param[in] time_scale factor applied to the transit times of the base
+   * vehicle type.
+   * @param[in] time_offset transit time added to every arc.
+   * @param[in] vehicle_type Identifier of the vehicle.
+   */
+  void add_scaled_matrices(uint8_t base_vehicle_type,
+                           f_t cost_scale,
+                           f_t cost_offset,
+                           f_t time_scale,
+                           f_t time_offset,
+                           uint8_t vehicle_type);
+
+  /**
+   * @brief Set the coordinates of all locations (depot included). They are
+   * used to complete the candidate matrices set by add_candidate_cost_matrix
+   * and add_candidate_transit_time_matrix.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   * @param[in] x_coordinates device memory pointer to the x coordinates of
+   * size num_locations_. cuOpt does not own or copy this data.
+   * @param[in] y_coordinates device memory pointer to the y coordinates of
+   * size num_locations_. cuOpt does not own or copy this data.
+   */
+  void set_location_coordinates(f_t const* x_coordinates, f_t const* y_coordinates);
+
+  /**
+   * @brief Set the costs of a vehicle type as a candidate graph instead of a
+   * dense matrix. Each location lists its n_neighbors nearest locations along
+   * with the exact costs to them. The costs between any other pair of
+   * locations are the euclidean distance between their coordinates times
+   * fallback_factor, see set_location_coordinates. The neighborhood moves
+   * only consider pairs of orders that are connected in the candidate graph.
+   * A cost matrix set by add_cost_matrix for the same vehicle type takes
+   * precedence.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   * @param[in] neighbors device memory pointer of size num_locations_ *
+   * n_neighbors, row i holds the neighbors of location i. Entries can be -1
+   * for locations with fewer neighbors. cuOpt does not own or copy this data.
+   * @param[in] costs device memory pointer of size num_locations_ *
+   * n_neighbors, the cost from location i to each of its neighbors. cuOpt
+   * does not own or copy this data.
+   * @param[in] n_neighbors number of neighbors of each location.
+   * @param[in] fallback_factor factor applied to the euclidean distance of
+   * the pairs that are not in the candidate graph.
+   * @param[in] vehicle_type Identifier of the vehicle.
+   */
+  void add_candidate_cost_matrix(i_t const* neighbors,
+                                 f_t const* costs,
+                                 i_t n_neighbors,
+                                 f_t fallback_factor  = 1,
+                                 uint8_t vehicle_type = 0);
+
+  /**
+   * @brief Set the transit times of a vehicle type as a candidate graph
+   * instead of a dense matrix, see add_candidate_cost_matrix. A transit time
+   * matrix set by add_transit_time_matrix for the same vehicle type takes
+   * precedence.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   * @param[in] neighbors device memory pointer of size num_locations_ *
+   * n_neighbors, row i holds the neighbors of location i. cuOpt does not own
+   * or copy this data.
+   * @param[in] transit_times device memory pointer of size num_locations_ *
+   * n_neighbors, the transit time from location i to each of its neighbors.
+   * cuOpt does not own or copy this data.
+   * @param[in] n_neighbors number of neighbors of each location.
+   * @param[in] fallback_factor factor applied to the euclidean distance of
+   * the pairs that are not in the candidate graph.
+   * @param[in] vehicle_type Identifier of the vehicle.
+   */
+  void add_candidate_transit_time_matrix(i_t const* neighbors,
+                                         f_t const* transit_times,
+                                         i_t n_neighbors,
+                                         f_t fallback_factor  = 1,
+                                         uint8_t vehicle_type = 0);
+
   void add_initial_solutions(i_t const* vehicle_ids,
                              i_t const* routes,
                              node_type_t const* types,
@@ -412,6 +535,47 @@ class data_model_view_t {
    */
   std::unordered_map<uint8_t, f_t const*> get_transit_time_matrices() const noexcept;
 
+  /**
+   * @brief Get all time dependent transit time matrices
+   * @return A map of vehicle types to time dependent transit time matrices
+   */
+  const std::unordered_map<uint8_t, detail::time_dependent_matrix_t<i_t, f_t>>&
+  get_time_dependent_transit_time_matrices() const noexcept;
+
+  /**
+   * @brief Get the location coordinates
+   * @return A pair of device pointers to the x and y coordinates
+   */
+  std::pair<f_t const*, f_t const*> get_location_coordinates() const noexcept;
+
+  /**
+   * @brief Get the candidate cost matrices
+   * @return A map of vehicle types to candidate cost matrices
+   */
+  const std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>>&
+  get_candidate_cost_matrices() const noexcept;
+
+  /**
+   * @brief Get the candidate transit time matrices
+   * @return A map of vehicle types to candidate transit time matrices
+   */
+  const std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>>&
+  get_candidate_transit_time_matrices() const noexcept;
+
+  /**
+   * @brief Get the vehicle types whose matrices are scaled from another type
+   * @return A map of vehicle types to scaled matrices
+   */
+  const std::unordered_map<uint8_t, detail::scaled_matrix_t<i_t, f_t>>& get_scaled_matrices()
+    const noexcept;
+
+  /**
+   * @brief Check whether the costs of a vehicle type are set, either as a
+   * dense matrix, as a candidate matrix or scaled from another vehicle type
+   * @return true if the costs are set
+   */
+  bool has_cost_matrix(uint8_t vehicle_type) const noexcept;
+
   std::tuple<raft::device_span<i_t const>,
              raft::device_span<i_t const>,
              raft::device_span<node_type_t const>,
@@ -605,6 +769,15 @@ class data_model_view_t {
    */
   raft::handle_t const* get_handle_ptr() const noexcept;
 
+  /**
+   * @brief Use the GPU resources of another raft handle, e.g. to solve a copy of
+   * the model on another device. The arrays of the model must be accessible
+   * from the device of the handle.
+   *
+   * @param[in] handle_ptr Handle object
+   */
+  void set_handle_ptr(raft::handle_t const* handle_ptr);
+
  private:
   raft::handle_t const* handle_ptr_{nullptr};
   i_t num_locations_{};
@@ -614,6 +787,14 @@ class data_model_view_t {
   raft::device_span<uint8_t const> vehicle_types_;
   std::unordered_map<uint8_t, f_t const*> cost_matrices_{};
   std::unordered_map<uint8_t, f_t const*> transit_time_matrices_{};
+  std::unordered_map<uint8_t, detail::time_dependent_matrix_t<i_t, f_t>>
+    time_dependent_transit_time_matrices_{};
+  f_t const* x_coordinates_{nullptr};
+  f_t const* y_coordinates_{nullptr};
+  std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>> candidate_cost_matrices_{};
+  std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>>
+    candidate_transit_time_matrices_{};
+  std::unordered_map<uint8_t, detail::scaled_matrix_t<i_t, f_t>> scaled_matrices_{};
   i_t const* order_locations_{nullptr};
   i_t const* break_locations_{nullptr};
   i_t n_break_locations_{};
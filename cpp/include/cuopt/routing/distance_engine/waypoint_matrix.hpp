@@ -16,6 +16,10 @@
 
 namespace cuopt {
 namespace distance_engine {
+namespace detail {
+template <typename i_t, typename f_t>
+class shortest_paths_t;
+}
 
 /**
  * @brief A waypoint matrix.
@@ -150,14 +154,7 @@ class waypoint_matrix_t {
                                    f_t const* weights);
 
  private:
-  std::vector<f_t> mpsp(i_t const* target_locations, i_t n_target_locations);
-  template <typename pm_t>
-  void dijkstra(pm_t& predecessor_matrix,
-                std::vector<f_t>& cost_matrix,
-                i_t src,
-                i_t const* target_locations,
-                i_t n_target_locations,
-                i_t id_src);
+  void mpsp(f_t* d_cost_matrix, i_t const* target_locations, i_t n_target_locations);
   std::vector<f_t> _compute_shortest_path_costs(i_t const* target_locations,
                                                 i_t n_target_locations,
                                                 f_t const* weights);
@@ -177,6 +174,8 @@ class waypoint_matrix_t {
   bool is_int16_{false};
   std::vector<std::vector<int32_t>> predecessor_matrix32_{};
   std::vector<std::vector<uint16_t>> predecessor_matrix16_{};
+  // Device copy of the graph, kept for the next queries
+  std::shared_ptr<detail::shortest_paths_t<i_t, f_t>> shortest_paths_{};
 };
 }  // namespace distance_engine
 }  // namespace cuopt
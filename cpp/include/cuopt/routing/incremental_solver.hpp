@@ -0,0 +1,76 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/routing/assignment.hpp>
+#include <cuopt/routing/data_model_view.hpp>
+#include <cuopt/routing/solver_settings.hpp>
+
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+
+/**
+ * @brief Solves a sequence of related models, e.g. the successive re-plans of
+ * a dynamic dispatch. The best solutions of each solve are kept and translated
+ * to the next model as its initial solutions, so that every re-plan continues
+ * from the previous population instead of starting from scratch.
+ *
+ * Orders are matched between the models through persistent order ids and
+ * vehicles through their index in the fleet. The orders that are no longer in
+ * the model are removed from the kept routes, the new ones are appended to the
+ * shortest routes and placed by the solver. Served stops are modeled by
+ * removing them from the next model and updating the start location and
+ * earliest time of their vehicle.
+ *
+ * @tparam i_t Integer type. int (32bit) is expected at the moment.
+ * @tparam f_t Floating point type. float (32bit) is expected at the moment.
+ */
+template <typename i_t, typename f_t>
+class incremental_solver_t {
+ public:
+  incremental_solver_t(solver_settings_t<i_t, f_t> const& settings = solver_settings_t<i_t, f_t>{},
+                       i_t max_kept_solutions                      = 10);
+
+  /**
+   * @brief Solves the model starting from the solutions kept by the previous
+   * call. Initial solutions added to the model take precedence over the kept
+   * ones.
+   *
+   * @param[in] data_model The model of the re-plan
+   * @param[in] order_ids Host vector of size num_orders giving a persistent id
+   * to each order. The id of the depot order, if any, is ignored.
+   * @return assignment_t owning container for the solver output.
+   */
+  assignment_t<i_t> solve(data_model_view_t<i_t, f_t> const& data_model,
+                          std::vector<i_t> const& order_ids);
+
+  /**
+   * @brief Return the number of solutions kept for the next call
+   */
+  i_t get_num_kept_solutions() const noexcept;
+
+  /**
+   * @brief Forget the kept solutions, the next call solves from scratch
+   */
+  void clear() noexcept;
+
+ private:
+  struct kept_route_t {
+    i_t vehicle_id;
+    std::vector<i_t> order_ids;
+  };
+
+  solver_settings_t<i_t, f_t> settings_;
+  i_t max_kept_solutions_;
+  std::vector<std::vector<kept_route_t>> kept_solutions_;
+};
+
+}  // namespace routing
+}  // namespace cuopt
@@ -0,0 +1,94 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+
+/**
+ * @brief A device cost or transit time matrix filled from host memory one block of rows at a time.
+ *
+ * Large matrices do not need to be materialized on the host: the rows can be read from a file,
+ * decompressed or computed block by block and handed over as they come. Each block is copied to a
+ * pinned staging buffer and uploaded asynchronously on the stream of the handle, so the host can
+ * prepare the next block, or the rest of the data model, while the previous one is transferred.
+ *
+ * The matrix can be passed to data_model_view_t::add_cost_matrix or add_transit_time_matrix
+ * before the upload is over: the copies are ordered on the handle stream before the solve as long
+ * as the data model uses the same handle. The matrix must outlive the solve.
+ *
+ * @tparam i_t Integer type. int (32bit) is expected at the moment.
+ * @tparam f_t Floating point type. float (32bit) is expected at the moment.
+ */
+template <typename i_t, typename f_t>
+class matrix_stream_t {
+ public:
+  /**
+   * @brief Allocate a num_locations x num_locations device matrix
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   *
+   * @param[in] handle_ptr Library handle (RAFT) containing hardware resources information.
+   * @param num_locations Number of locations, the size of the square matrix
+   * @param max_block_rows Number of rows of each staging buffer. Larger blocks are split.
+   */
+  matrix_stream_t(raft::handle_t const* handle_ptr, i_t num_locations, i_t max_block_rows = 256);
+  ~matrix_stream_t();
+
+  matrix_stream_t(const matrix_stream_t&)            = delete;
+  matrix_stream_t& operator=(const matrix_stream_t&) = delete;
+
+  /**
+   * @brief Upload the rows [first_row, first_row + n_rows) of the matrix
+   *
+   * The call returns once the rows are staged, the host memory can be reused right away.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   *
+   * @param[in] rows Host memory pointer of size n_rows x num_locations, in row major order.
+   * @param first_row Index of the first row of the block
+   * @param n_rows Number of rows of the block
+   */
+  void add_rows(f_t const* rows, i_t first_row, i_t n_rows);
+
+  /**
+   * @brief Return true when every row of the matrix has been added
+   */
+  bool is_complete() const noexcept;
+
+  /**
+   * @brief Return the device pointer of the matrix, in row major order
+   */
+  f_t const* data() const noexcept;
+
+  i_t get_num_locations() const noexcept;
+
+ private:
+  raft::handle_t const* handle_ptr_{nullptr};
+  i_t num_locations_{0};
+  i_t max_block_rows_{0};
+  rmm::device_uvector<f_t> matrix_;
+  // Two staging buffers: one is filled while the other is uploaded
+  std::array<f_t*, 2> staging_{};
+  std::array<cudaEvent_t, 2> uploaded_{};
+  int next_staging_{0};
+  std::vector<bool> added_rows_;
+  i_t n_added_rows_{0};
+};
+
+}  // namespace routing
+}  // namespace cuopt
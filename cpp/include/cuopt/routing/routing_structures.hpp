@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -102,6 +102,71 @@ class capacity_t {
   i_t const* vehicle_capacities_{nullptr};
 };
 
+template <typename i_t, typename f_t>
+class candidate_matrix_t {
+ public:
+  candidate_matrix_t(i_t const* neighbors, f_t const* values, i_t n_neighbors, f_t fallback_factor)
+    : neighbors_(neighbors),
+      values_(values),
+      n_neighbors_(n_neighbors),
+      fallback_factor_(fallback_factor)
+  {
+  }
+  i_t const* get_neighbors() const { return neighbors_; }
+  f_t const* get_values() const { return values_; }
+  i_t get_n_neighbors() const { return n_neighbors_; }
+  f_t get_fallback_factor() const { return fallback_factor_; }
+
+ private:
+  i_t const* neighbors_{nullptr};
+  f_t const* values_{nullptr};
+  i_t n_neighbors_{0};
+  f_t fallback_factor_{1};
+};
+
+template <typename i_t, typename f_t>
+class time_dependent_matrix_t {
+ public:
+  time_dependent_matrix_t(f_t const* values, f_t const* bucket_start_times, i_t n_time_buckets)
+    : values_(values), bucket_start_times_(bucket_start_times), n_time_buckets_(n_time_buckets)
+  {
+  }
+  f_t const* get_values() const { return values_; }
+  f_t const* get_bucket_start_times() const { return bucket_start_times_; }
+  i_t get_n_time_buckets() const { return n_time_buckets_; }
+
+ private:
+  f_t const* values_{nullptr};
+  f_t const* bucket_start_times_{nullptr};
+  i_t n_time_buckets_{0};
+};
+
+template <typename i_t, typename f_t>
+class scaled_matrix_t {
+ public:
+  scaled_matrix_t(
+    uint8_t base_vehicle_type, f_t cost_scale, f_t cost_offset, f_t time_scale, f_t time_offset)
+    : base_vehicle_type_(base_vehicle_type),
+      cost_scale_(cost_scale),
+      cost_offset_(cost_offset),
+      time_scale_(time_scale),
+      time_offset_(time_offset)
+  {
+  }
+  uint8_t get_base_vehicle_type() const { return base_vehicle_type_; }
+  f_t get_cost_scale() const { return cost_scale_; }
+  f_t get_cost_offset() const { return cost_offset_; }
+  f_t get_time_scale() const { return time_scale_; }
+  f_t get_time_offset() const { return time_offset_; }
+
+ private:
+  uint8_t base_vehicle_type_{0};
+  f_t cost_scale_{1};
+  f_t cost_offset_{0};
+  f_t time_scale_{1};
+  f_t time_offset_{0};
+};
+
 // internal
 template <typename i_t, typename f_t>
 class order_time_window_t {
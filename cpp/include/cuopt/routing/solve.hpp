@@ -10,6 +10,9 @@
 #include <cuopt/routing/assignment.hpp>
 #include <cuopt/routing/data_model_view.hpp>
 #include <cuopt/routing/solver_settings.hpp>
+
+#include <vector>
+
 namespace cuopt {
 namespace routing {
 
@@ -26,5 +29,25 @@ template <typename i_t, typename f_t>
 assignment_t<i_t> solve(
   data_model_view_t<i_t, f_t> const& data_model,
   solver_settings_t<i_t, f_t> const& settings = solver_settings_t<i_t, f_t>{});
+
+/**
+ * @brief Solves many independent models concurrently on the device, e.g. a
+ * large number of small instances. Each model is solved by its own host thread
+ * on a separate non-blocking stream, so that the solves overlap on the device
+ * instead of running one after the other.
+ *
+ * Each model should have its own handle. The streams of the handles are
+ * restored and the returned assignments are associated with them.
+ *
+ * @tparam i_t
+ * @tparam f_t
+ * @param[in] data_models  input data models of type data_model_view_type
+ * @param[in] settings     solver settings of type solver_settings_t, shared by all the solves
+ * @return std::vector<assignment_t<i_t>> one owning container per model, in the same order
+ */
+template <typename i_t, typename f_t>
+std::vector<assignment_t<i_t>> batch_solve(
+  std::vector<data_model_view_t<i_t, f_t>*> const& data_models,
+  solver_settings_t<i_t, f_t> const& settings = solver_settings_t<i_t, f_t>{});
 }  // namespace routing
 }  // namespace cuopt
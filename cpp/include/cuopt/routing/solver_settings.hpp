@@ -1,14 +1,16 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #pragma once
 
+#include <cuopt/routing/assignment.hpp>
 #include <cuopt/routing/routing_structures.hpp>
 #include <fstream>
+#include <functional>
 #include <limits>
 #include <ostream>
 
@@ -56,13 +58,80 @@ class solver_settings_t {
   /**
    * @brief This is an experimental developer feature that allows displaying
    * internal best results to a given file in a csv format.
-   * @note Quality of the solution might be impacted.
+   * @note The file is written by a background thread, every interval seconds
+   * in which the best solution improved.
    *
    * @param[in] file_path Absolute path of output file.
    * @param[in] interval Dumping interval as seconds.
    */
   void dump_best_results(const std::string& file_path, i_t interval);
 
+  /**
+   * @brief Set a callback receiving each new best solution found by the solver.
+   *
+   * @note The callback runs on a background thread with a host snapshot of the
+   * solution, so the solver never waits for it. The solutions found while it
+   * runs are coalesced, only the latest one is passed next. The snapshot lists
+   * the served orders and breaks of each route, without depots, and has no
+   * arrival stamps.
+   *
+   * @param[in] callback Called with the solution and its cost, which includes
+   * the penalties of infeasible solutions.
+   */
+  void set_incumbent_callback(
+    std::function<void(const host_assignment_t<i_t>&, double)> callback);
+
+  /**
+   * @brief Store the cost and transit time matrices in half precision on the
+   * device, with a scale per matrix, to halve their memory footprint on large
+   * instances.
+   * @note The cost matrices are rounded to nearest and the transit time
+   * matrices are rounded up, so time window feasibility is kept with the exact
+   * times. The reported cost objective is recomputed with the exact matrices,
+   * the other reported values use the rounded ones.
+   *
+   * @param[in] half_precision True to store the matrices in half precision
+   */
+  void set_half_precision_matrices(bool half_precision);
+
+  /**
+   * @brief Solve concurrent islands on up to num_gpus devices, the current
+   * device and the ones that can access its memory. The islands periodically
+   * exchange their best solutions and the best one found by any island is
+   * returned.
+   * @note Each island uses the whole time limit. The model arrays are read
+   * from the other devices through peer access.
+   *
+   * @param[in] num_gpus Maximum number of devices to use, 1 by default
+   */
+  void set_num_gpus(i_t num_gpus);
+
+  /**
+   * @brief Run a host local search on num_cpu_threads threads alongside the
+   * device search. Each thread takes the best solutions published by the
+   * device islands, improves them with 2-opt, relocate and or-opt moves and
+   * publishes the improved ones back.
+   * @note Only used for problems without pickup and delivery pairs and
+   * without breaks.
+   *
+   * @param[in] num_cpu_threads Number of host threads, 0 by default
+   */
+  void set_num_cpu_threads(i_t num_cpu_threads);
+
+  /**
+   * @brief Split very large problems into geographic clusters of about
+   * cluster_size orders, solve the clusters concurrently as independent
+   * problems with their share of the fleet, then improve the merged routes on
+   * the full problem for the rest of the time limit.
+   * @note Only used for problems without pickup and delivery pairs, breaks,
+   * vehicle types, order or vehicle locations, prizes, precedence, vehicle
+   * order matches and initial solutions. The full problem is solved instead
+   * if a cluster cannot be solved.
+   *
+   * @param[in] cluster_size Number of orders per cluster, 0 (disabled) by default
+   */
+  void set_decomposition_cluster_size(i_t cluster_size);
+
   /**
    * @brief Return set solving time
    * @return Solving time set in seconds
@@ -79,6 +148,26 @@ class solver_settings_t {
    */
   bool get_error_logging_mode() const noexcept;
 
+  /**
+   * @brief Return true if the matrices are stored in half precision
+   */
+  bool get_half_precision_matrices() const noexcept;
+
+  /**
+   * @brief Return the maximum number of devices to solve on
+   */
+  i_t get_num_gpus() const noexcept;
+
+  /**
+   * @brief Return the number of host local search threads
+   */
+  i_t get_num_cpu_threads() const noexcept;
+
+  /**
+   * @brief Return the number of orders per cluster of the decomposition, 0 if disabled
+   */
+  i_t get_decomposition_cluster_size() const noexcept;
+
   /**
    * @brief Get the dump best results information
    *
@@ -86,12 +175,23 @@ class solver_settings_t {
    */
   std::tuple<i_t, bool, std::string> get_dump_best_results() const noexcept;
 
+  /**
+   * @brief Get the incumbent callback, empty when none was set
+   */
+  const std::function<void(const host_assignment_t<i_t>&, double)>& get_incumbent_callback()
+    const noexcept;
+
   bool enable_verbose_mode_{false};
   bool log_errors_{false};
   f_t time_limit_{std::numeric_limits<f_t>::max()};
   i_t dump_interval_{std::numeric_limits<i_t>::max()};
   bool dump_best_results_{false};
+  bool half_precision_matrices_{false};
+  i_t num_gpus_{1};
+  i_t num_cpu_threads_{0};
+  i_t decomposition_cluster_size_{0};
   std::string best_result_file_name_;
+  std::function<void(const host_assignment_t<i_t>&, double)> incumbent_callback_;
 };
 
 }  // namespace routing
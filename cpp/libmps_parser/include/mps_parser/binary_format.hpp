@@ -0,0 +1,50 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <mps_parser/data_model_view.hpp>
+#include <mps_parser/mps_data_model.hpp>
+
+#include <string>
+
+namespace cuopt::mps_parser {
+
+/**
+ * @brief Writes the problem to a cuOpt binary problem file
+ *
+ * The file is a versioned container of the raw problem arrays (CSR constraint matrix, bounds,
+ * types, objective, quadratic objective, initial solutions) and of the optional names. Each array
+ * starts on a 64 bytes boundary so that it can be copied as is from a mapping of the file, the
+ * file is only meant to be read back on a host with the same endianness.
+ *
+ * @param[in] problem The problem data model view to write
+ * @param[in] file_path Path to the binary file to write
+ */
+template <typename i_t, typename f_t>
+void write_binary(const data_model_view_t<i_t, f_t>& problem, const std::string& file_path);
+
+/**
+ * @brief Reads a problem written by `write_binary`
+ *
+ * The file is mapped read only and its arrays are copied into the data model without any
+ * parsing. The integer and floating point sizes must be the ones the file was written with.
+ *
+ * @param[in] file_path Path to the binary file
+ * @return mps_data_model_t The problem stored in the file
+ */
+template <typename i_t, typename f_t>
+mps_data_model_t<i_t, f_t> parse_binary(const std::string& file_path);
+
+/**
+ * @brief Whether the file starts with the magic of a cuOpt binary problem file
+ *
+ * @param[in] file_path Path to the file
+ */
+bool is_binary_problem_file(const std::string& file_path);
+
+}  // namespace cuopt::mps_parser
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -29,10 +29,13 @@ namespace cuopt::mps_parser {
  *
  * @param[in] mps_file_path Path to MPS/QPSfile.
  * @param[in] fixed_mps_format If MPS/QPS file should be parsed as fixed, false by default
+ * @param[in] keep_names If the row and variable names should be stored in the returned problem,
+ * true by default. Without them the names are only used to resolve the references of the file.
  * @return mps_data_model_t A fully formed LP/QP problem which represents the given file
  */
 template <typename i_t, typename f_t>
 mps_data_model_t<i_t, f_t> parse_mps(const std::string& mps_file_path,
-                                     bool fixed_mps_format = false);
+                                     bool fixed_mps_format = false,
+                                     bool keep_names       = true);
 
 }  // namespace cuopt::mps_parser
@@ -0,0 +1,120 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cuopt::mps_parser {
+
+/**
+ * @brief Output file of the MPS writers
+ *
+ * The text is compressed on the fly when the path ends with .gz or .bz2, like the compressed
+ * files the parser reads.
+ */
+class mps_output_t {
+ public:
+  /**
+   * @brief Opens the file for writing
+   *
+   * @param[in] path Path of the file, a .gz or .bz2 extension selects the compression
+   */
+  explicit mps_output_t(const std::string& path);
+  ~mps_output_t();
+
+  void write(std::string_view text);
+
+  /**
+   * @brief Flushes and closes the file, errors that the destructor would ignore are thrown
+   */
+  void close();
+
+ private:
+  struct impl_t;
+  std::unique_ptr<impl_t> impl_;
+};
+
+/**
+ * @brief Appends the text of the value, floating point values with max_digits10 significant
+ * digits like the iostream writers did, so that they read back to the same value
+ */
+template <typename T>
+void append_number(std::string& buffer, T value)
+{
+  char text[64];
+  std::to_chars_result result;
+  if constexpr (std::is_floating_point_v<T>) {
+    result = std::to_chars(text,
+                           text + sizeof(text),
+                           value,
+                           std::chars_format::general,
+                           std::numeric_limits<T>::max_digits10);
+  } else {
+    result = std::to_chars(text, text + sizeof(text), value);
+  }
+  buffer.append(text, result.ptr);
+}
+
+/**
+ * @brief Formats the items [0, n_items) on several threads and writes them in item order
+ *
+ * format_item(i, buffer) appends the text of the item i to buffer. The items are formatted by
+ * blocks in a buffer per thread, the buffers of a round are written before the next round so that
+ * the memory stays bounded on large models.
+ */
+template <typename format_t>
+void write_in_chunks(mps_output_t& out, size_t n_items, const format_t& format_item)
+{
+  constexpr size_t block_size = size_t{1} << 14;
+  const size_t n_blocks       = (n_items + block_size - 1) / block_size;
+  const size_t n_threads =
+    std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(n_blocks, 1));
+
+  std::vector<std::string> buffers(n_threads);
+  std::vector<std::exception_ptr> errors(n_threads);
+  auto format_block = [&](size_t block, size_t t) {
+    try {
+      buffers[t].clear();
+      const size_t end = std::min(n_items, (block + 1) * block_size);
+      for (size_t i = block * block_size; i < end; ++i) {
+        format_item(i, buffers[t]);
+      }
+    } catch (...) {
+      errors[t] = std::current_exception();
+    }
+  };
+
+  for (size_t round = 0; round < n_blocks; round += n_threads) {
+    const size_t n_round = std::min(n_threads, n_blocks - round);
+    std::vector<std::thread> threads;
+    threads.reserve(n_round - 1);
+    for (size_t t = 1; t < n_round; ++t) {
+      threads.emplace_back(format_block, round + t, t);
+    }
+    format_block(round, 0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (size_t t = 0; t < n_round; ++t) {
+      if (errors[t]) { std::rethrow_exception(errors[t]); }
+      out.write(buffers[t]);
+    }
+  }
+}
+
+}  // namespace cuopt::mps_parser
@@ -0,0 +1,343 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <mps_parser/binary_format.hpp>
+
+#include <mps_parser.hpp>
+#include <utilities/error.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace cuopt::mps_parser {
+
+namespace {
+
+constexpr char binary_magic[8] = {'C', 'U', 'O', 'P', 'T', 'B', 'I', 'N'};
+// version of the layout, bumped when the meaning of an existing section changes
+constexpr uint32_t binary_version = 1;
+// sections start on this alignment so that they can be used in place from a mapping of the file
+constexpr uint64_t section_alignment = 64;
+
+// Ids of the sections, new sections get new ids so that older readers skip them
+enum section_id_t : uint32_t {
+  constraint_matrix_values_id = 0,
+  constraint_matrix_indices_id,
+  constraint_matrix_offsets_id,
+  constraint_bounds_id,
+  objective_coefficients_id,
+  variable_lower_bounds_id,
+  variable_upper_bounds_id,
+  variable_types_id,
+  row_types_id,
+  constraint_lower_bounds_id,
+  constraint_upper_bounds_id,
+  quadratic_objective_values_id,
+  quadratic_objective_indices_id,
+  quadratic_objective_offsets_id,
+  initial_primal_solution_id,
+  initial_dual_solution_id,
+  problem_name_id,
+  objective_name_id,
+  variable_names_id,
+  row_names_id,
+  n_section_ids
+};
+
+struct binary_header_t {
+  char magic[8];
+  uint32_t version;
+  uint8_t int_size;
+  uint8_t float_size;
+  uint8_t maximize;
+  uint8_t reserved;
+  double objective_scaling_factor;
+  double objective_offset;
+  uint64_t n_sections;
+};
+
+// Entry of the section table which follows the header, empty sections are not stored
+struct section_entry_t {
+  uint32_t id;
+  uint32_t element_size;
+  uint64_t offset;
+  uint64_t count;
+};
+
+uint64_t align_section(uint64_t offset)
+{
+  return (offset + section_alignment - 1) / section_alignment * section_alignment;
+}
+
+// Names are stored back to back, each one followed by a null character
+std::vector<char> join_names(const std::vector<std::string>& names)
+{
+  std::vector<char> joined;
+  for (const auto& name : names) {
+    joined.insert(joined.end(), name.begin(), name.end());
+    joined.push_back('\0');
+  }
+  return joined;
+}
+
+std::vector<std::string> split_names(span<char const> joined)
+{
+  std::vector<std::string> names;
+  std::string_view remaining(joined.data(), joined.size());
+  while (!remaining.empty()) {
+    const auto end = std::min(remaining.find('\0'), remaining.size());
+    names.emplace_back(remaining.substr(0, end));
+    remaining.remove_prefix(std::min(end + 1, remaining.size()));
+  }
+  return names;
+}
+
+template <typename T, typename i_t>
+span<T const> get_section(std::string_view data,
+                          const std::vector<const section_entry_t*>& sections,
+                          section_id_t id)
+{
+  const section_entry_t* entry = sections[id];
+  if (entry == nullptr) { return span<T const>{}; }
+  mps_parser_expects(entry->element_size == sizeof(T),
+                     error_type_t::ValidationError,
+                     "Bad element size %u of section %u in binary problem file!",
+                     entry->element_size,
+                     entry->id);
+  mps_parser_expects(entry->count <= static_cast<uint64_t>(std::numeric_limits<i_t>::max()),
+                     error_type_t::ValidationError,
+                     "Section %u of binary problem file is too large for the index type!",
+                     entry->id);
+  // A corrupted table must not lead to reads outside of the file or through misaligned pointers
+  mps_parser_expects(entry->offset <= data.size() &&
+                       entry->count <= (data.size() - entry->offset) / sizeof(T),
+                     error_type_t::ValidationError,
+                     "Section %u of binary problem file is out of the file bounds!",
+                     entry->id);
+  const char* section_data = data.data() + entry->offset;
+  mps_parser_expects(reinterpret_cast<std::uintptr_t>(section_data) % alignof(T) == 0,
+                     error_type_t::ValidationError,
+                     "Section %u of binary problem file is misaligned!",
+                     entry->id);
+  return span<T const>(reinterpret_cast<T const*>(section_data), entry->count);
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+void write_binary(const data_model_view_t<i_t, f_t>& problem, const std::string& file_path)
+{
+  struct section_t {
+    section_entry_t entry;
+    const void* data;
+  };
+  std::vector<section_t> sections;
+  auto add_section = [&sections](section_id_t id, const auto* data, size_t count) {
+    if (count == 0) { return; }
+    sections.push_back({{id, sizeof(*data), 0, count}, data});
+  };
+  auto add_span = [&add_section](section_id_t id, auto values) {
+    add_section(id, values.data(), values.size());
+  };
+
+  add_span(constraint_matrix_values_id, problem.get_constraint_matrix_values());
+  add_span(constraint_matrix_indices_id, problem.get_constraint_matrix_indices());
+  add_span(constraint_matrix_offsets_id, problem.get_constraint_matrix_offsets());
+  add_span(constraint_bounds_id, problem.get_constraint_bounds());
+  add_span(objective_coefficients_id, problem.get_objective_coefficients());
+  add_span(variable_lower_bounds_id, problem.get_variable_lower_bounds());
+  add_span(variable_upper_bounds_id, problem.get_variable_upper_bounds());
+  add_span(variable_types_id, problem.get_variable_types());
+  add_span(row_types_id, problem.get_row_types());
+  add_span(constraint_lower_bounds_id, problem.get_constraint_lower_bounds());
+  add_span(constraint_upper_bounds_id, problem.get_constraint_upper_bounds());
+  add_span(quadratic_objective_values_id, problem.get_quadratic_objective_values());
+  add_span(quadratic_objective_indices_id, problem.get_quadratic_objective_indices());
+  add_span(quadratic_objective_offsets_id, problem.get_quadratic_objective_offsets());
+  add_span(initial_primal_solution_id, problem.get_initial_primal_solution());
+  add_span(initial_dual_solution_id, problem.get_initial_dual_solution());
+  const auto problem_name   = problem.get_problem_name();
+  const auto objective_name = problem.get_objective_name();
+  const auto variable_names = join_names(problem.get_variable_names());
+  const auto row_names      = join_names(problem.get_row_names());
+  add_section(problem_name_id, problem_name.data(), problem_name.size());
+  add_section(objective_name_id, objective_name.data(), objective_name.size());
+  add_section(variable_names_id, variable_names.data(), variable_names.size());
+  add_section(row_names_id, row_names.data(), row_names.size());
+
+  binary_header_t header{};
+  std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+  header.version                  = binary_version;
+  header.int_size                 = sizeof(i_t);
+  header.float_size               = sizeof(f_t);
+  header.maximize                 = problem.get_sense();
+  header.objective_scaling_factor = problem.get_objective_scaling_factor();
+  header.objective_offset         = problem.get_objective_offset();
+  header.n_sections               = sections.size();
+
+  std::vector<section_entry_t> table;
+  uint64_t offset = sizeof(header) + sections.size() * sizeof(section_entry_t);
+  for (auto& section : sections) {
+    section.entry.offset = align_section(offset);
+    offset               = section.entry.offset + section.entry.element_size * section.entry.count;
+    table.push_back(section.entry);
+  }
+
+  std::ofstream file(file_path, std::ios::binary);
+  mps_parser_expects(file.is_open(),
+                     error_type_t::ValidationError,
+                     "Error creating output binary problem file! Given path: %s",
+                     file_path.c_str());
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(section_entry_t));
+  uint64_t written = sizeof(header) + table.size() * sizeof(section_entry_t);
+  const char padding[section_alignment]{};
+  for (const auto& section : sections) {
+    const uint64_t size = section.entry.element_size * section.entry.count;
+    file.write(padding, section.entry.offset - written);
+    file.write(static_cast<const char*>(section.data), size);
+    written = section.entry.offset + size;
+  }
+  mps_parser_expects(file.good(),
+                     error_type_t::ValidationError,
+                     "Error writing binary problem file! Given path: %s",
+                     file_path.c_str());
+}
+
+template <typename i_t, typename f_t>
+mps_data_model_t<i_t, f_t> parse_binary(const std::string& file_path)
+{
+  mps_file_buffer_t buffer(file_path);
+  const auto data = buffer.view();
+
+  binary_header_t header;
+  mps_parser_expects(
+    data.size() >= sizeof(header) && std::memcmp(data.data(), binary_magic, 8) == 0,
+    error_type_t::ValidationError,
+    "Not a binary problem file! Given path: %s",
+    file_path.c_str());
+  std::memcpy(&header, data.data(), sizeof(header));
+  mps_parser_expects(header.version <= binary_version,
+                     error_type_t::ValidationError,
+                     "Binary problem file version %u is newer than the supported version %u!",
+                     header.version,
+                     binary_version);
+  mps_parser_expects(header.int_size == sizeof(i_t) && header.float_size == sizeof(f_t),
+                     error_type_t::ValidationError,
+                     "Binary problem file has %d bytes integers and %d bytes floats, expected %d "
+                     "and %d! Given path: %s",
+                     header.int_size,
+                     header.float_size,
+                     static_cast<int>(sizeof(i_t)),
+                     static_cast<int>(sizeof(f_t)),
+                     file_path.c_str());
+  mps_parser_expects(
+    header.n_sections <= (data.size() - sizeof(header)) / sizeof(section_entry_t),
+    error_type_t::ValidationError,
+    "Truncated binary problem file! Given path: %s",
+    file_path.c_str());
+
+  std::vector<section_entry_t> table(header.n_sections);
+  std::memcpy(table.data(), data.data() + sizeof(header), table.size() * sizeof(section_entry_t));
+  std::vector<const section_entry_t*> sections(n_section_ids, nullptr);
+  for (const auto& entry : table) {
+    mps_parser_expects(entry.element_size > 0 && entry.offset <= data.size() &&
+                         entry.count <= (data.size() - entry.offset) / entry.element_size,
+                       error_type_t::ValidationError,
+                       "Truncated binary problem file! Given path: %s",
+                       file_path.c_str());
+    if (entry.id < n_section_ids) { sections[entry.id] = &entry; }
+  }
+  auto f_section = [&](section_id_t id) { return get_section<f_t, i_t>(data, sections, id); };
+  auto i_section = [&](section_id_t id) { return get_section<i_t, i_t>(data, sections, id); };
+  auto c_section = [&](section_id_t id) { return get_section<char, i_t>(data, sections, id); };
+
+  mps_data_model_t<i_t, f_t> problem;
+  problem.set_maximize(header.maximize);
+  problem.set_objective_scaling_factor(header.objective_scaling_factor);
+  problem.set_objective_offset(header.objective_offset);
+
+  const auto A         = f_section(constraint_matrix_values_id);
+  const auto A_indices = i_section(constraint_matrix_indices_id);
+  const auto A_offsets = i_section(constraint_matrix_offsets_id);
+  if (A_offsets.size() > 0) {
+    problem.set_csr_constraint_matrix(
+      A.data(), A.size(), A_indices.data(), A_indices.size(), A_offsets.data(), A_offsets.size());
+  }
+  const auto Q         = f_section(quadratic_objective_values_id);
+  const auto Q_indices = i_section(quadratic_objective_indices_id);
+  const auto Q_offsets = i_section(quadratic_objective_offsets_id);
+  if (Q_offsets.size() > 0) {
+    problem.set_quadratic_objective_matrix(
+      Q.data(), Q.size(), Q_indices.data(), Q_indices.size(), Q_offsets.data(), Q_offsets.size());
+  }
+
+  const auto b = f_section(constraint_bounds_id);
+  if (b.size() > 0) { problem.set_constraint_bounds(b.data(), b.size()); }
+  const auto c = f_section(objective_coefficients_id);
+  if (c.size() > 0) { problem.set_objective_coefficients(c.data(), c.size()); }
+  const auto variable_lower_bounds = f_section(variable_lower_bounds_id);
+  const auto variable_upper_bounds = f_section(variable_upper_bounds_id);
+  problem.set_variable_lower_bounds(variable_lower_bounds.data(), variable_lower_bounds.size());
+  problem.set_variable_upper_bounds(variable_upper_bounds.data(), variable_upper_bounds.size());
+  const auto constraint_lower_bounds = f_section(constraint_lower_bounds_id);
+  const auto constraint_upper_bounds = f_section(constraint_upper_bounds_id);
+  if (constraint_lower_bounds.size() > 0) {
+    problem.set_constraint_lower_bounds(constraint_lower_bounds.data(),
+                                        constraint_lower_bounds.size());
+  }
+  problem.set_constraint_upper_bounds(constraint_upper_bounds.data(),
+                                      constraint_upper_bounds.size());
+  const auto variable_types = c_section(variable_types_id);
+  problem.set_variable_types(
+    std::vector<char>(variable_types.data(), variable_types.data() + variable_types.size()));
+  const auto row_types = c_section(row_types_id);
+  if (row_types.size() > 0) { problem.set_row_types(row_types.data(), row_types.size()); }
+  const auto initial_primal_solution = f_section(initial_primal_solution_id);
+  if (initial_primal_solution.size() > 0) {
+    problem.set_initial_primal_solution(initial_primal_solution.data(),
+                                        initial_primal_solution.size());
+  }
+  const auto initial_dual_solution = f_section(initial_dual_solution_id);
+  if (initial_dual_solution.size() > 0) {
+    problem.set_initial_dual_solution(initial_dual_solution.data(), initial_dual_solution.size());
+  }
+
+  const auto problem_name   = c_section(problem_name_id);
+  const auto objective_name = c_section(objective_name_id);
+  problem.set_problem_name(std::string(problem_name.data(), problem_name.size()));
+  problem.set_objective_name(std::string(objective_name.data(), objective_name.size()));
+  problem.set_variable_names(split_names(c_section(variable_names_id)));
+  problem.set_row_names(split_names(c_section(row_names_id)));
+  return problem;
+}
+
+bool is_binary_problem_file(const std::string& file_path)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  char magic[sizeof(binary_magic)]{};
+  file.read(magic, sizeof(magic));
+  return file.good() && std::memcmp(magic, binary_magic, sizeof(magic)) == 0;
+}
+
+template void write_binary<int, float>(const data_model_view_t<int, float>& problem,
+                                       const std::string& file_path);
+template void write_binary<int, double>(const data_model_view_t<int, double>& problem,
+                                        const std::string& file_path);
+template mps_data_model_t<int, float> parse_binary<int, float>(const std::string& file_path);
+template mps_data_model_t<int, double> parse_binary<int, double>(const std::string& file_path);
+template void write_binary<int64_t, double>(const data_model_view_t<int64_t, double>& problem,
+                                            const std::string& file_path);
+template mps_data_model_t<int64_t, double> parse_binary<int64_t, double>(
+  const std::string& file_path);
+
+}  // namespace cuopt::mps_parser
@@ -0,0 +1,221 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <mps_parser/utilities/chunked_output.hpp>
+
+#include <utilities/error.hpp>
+
+#include <cstdio>
+#include <functional>
+
+#ifdef MPS_PARSER_WITH_BZIP2
+#include <bzlib.h>
+#endif  // MPS_PARSER_WITH_BZIP2
+
+#ifdef MPS_PARSER_WITH_ZLIB
+#include <zlib.h>
+#endif  // MPS_PARSER_WITH_ZLIB
+
+#if defined(MPS_PARSER_WITH_BZIP2) || defined(MPS_PARSER_WITH_ZLIB)
+#include <dlfcn.h>
+#endif  // MPS_PARSER_WITH_BZIP2 || MPS_PARSER_WITH_ZLIB
+
+namespace cuopt::mps_parser {
+
+namespace {
+
+// the compressors take int sized lengths
+constexpr size_t max_write_size = size_t{1} << 30;
+
+[[maybe_unused]] bool has_extension(const std::string& path, const std::string& extension)
+{
+  return path.size() > extension.size() &&
+         path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+#if defined(MPS_PARSER_WITH_BZIP2) || defined(MPS_PARSER_WITH_ZLIB)
+struct DlCloseDeleter {
+  void operator()(void* handle) { dlclose(handle); }
+};
+#endif  // MPS_PARSER_WITH_BZIP2 || MPS_PARSER_WITH_ZLIB
+
+}  // end namespace
+
+struct mps_output_t::impl_t {
+  std::string path;
+  FILE* fp{nullptr};
+  std::function<void(std::string_view)> write;
+  // flushes the compressor, the file itself is closed after it
+  std::function<void()> finish;
+  bool closed{false};
+#if defined(MPS_PARSER_WITH_BZIP2) || defined(MPS_PARSER_WITH_ZLIB)
+  std::unique_ptr<void, DlCloseDeleter> library;
+#endif  // MPS_PARSER_WITH_BZIP2 || MPS_PARSER_WITH_ZLIB
+
+  ~impl_t()
+  {
+    if (fp != nullptr) { fclose(fp); }
+  }
+
+  void open_file()
+  {
+    fp = fopen(path.c_str(), "wb");
+    mps_parser_expects(fp != nullptr,
+                       error_type_t::ValidationError,
+                       "Error creating output MPS file! Given path: %s",
+                       path.c_str());
+    setvbuf(fp, nullptr, _IOFBF, size_t{1} << 20);
+  }
+
+  void open_plain()
+  {
+    open_file();
+    write = [this](std::string_view text) {
+      mps_parser_expects(fwrite(text.data(), 1, text.size(), fp) == text.size(),
+                         error_type_t::ValidationError,
+                         "Error writing MPS file! Given path: %s",
+                         path.c_str());
+    };
+    finish = [] {};
+  }
+
+#ifdef MPS_PARSER_WITH_ZLIB
+  void open_gz()
+  {
+    library.reset(dlopen("libz.so.1", RTLD_LAZY));
+    mps_parser_expects(library != nullptr,
+                       error_type_t::ValidationError,
+                       "Could not write .mps.gz file since libz.so was not found. Given path: %s",
+                       path.c_str());
+    auto gzopen_fn    = reinterpret_cast<decltype(&gzopen)>(dlsym(library.get(), "gzopen"));
+    auto gzbuffer_fn  = reinterpret_cast<decltype(&gzbuffer)>(dlsym(library.get(), "gzbuffer"));
+    auto gzwrite_fn   = reinterpret_cast<decltype(&gzwrite)>(dlsym(library.get(), "gzwrite"));
+    auto gzclose_w_fn = reinterpret_cast<decltype(&gzclose_w)>(dlsym(library.get(), "gzclose_w"));
+    mps_parser_expects(gzopen_fn != nullptr && gzbuffer_fn != nullptr && gzwrite_fn != nullptr &&
+                         gzclose_w_fn != nullptr,
+                       error_type_t::ValidationError,
+                       "Error loading zlib! Library version might be incompatible. Given path: %s",
+                       path.c_str());
+    gzFile gz = gzopen_fn(path.c_str(), "wb");
+    mps_parser_expects(gz != nullptr,
+                       error_type_t::ValidationError,
+                       "Error creating output MPS file! Given path: %s",
+                       path.c_str());
+    gzbuffer_fn(gz, 1 << 20);  // 1 MiB
+    write = [this, gz, gzwrite_fn](std::string_view text) {
+      for (size_t done = 0; done < text.size(); done += max_write_size) {
+        const unsigned size = std::min(max_write_size, text.size() - done);
+        mps_parser_expects(gzwrite_fn(gz, text.data() + done, size) == static_cast<int>(size),
+                           error_type_t::ValidationError,
+                           "Error in zlib compression of MPS file! Given path: %s",
+                           path.c_str());
+      }
+    };
+    finish = [this, gz, gzclose_w_fn] {
+      mps_parser_expects(gzclose_w_fn(gz) == Z_OK,
+                         error_type_t::ValidationError,
+                         "Error closing gz file! Given path: %s",
+                         path.c_str());
+    };
+  }
+#endif  // MPS_PARSER_WITH_ZLIB
+
+#ifdef MPS_PARSER_WITH_BZIP2
+  void open_bz2()
+  {
+    library.reset(dlopen("libbz2.so", RTLD_LAZY));
+    mps_parser_expects(library != nullptr,
+                       error_type_t::ValidationError,
+                       "Could not write .mps.bz2 file since libbz2.so was not found. Given "
+                       "path: %s",
+                       path.c_str());
+    auto open_fn = reinterpret_cast<decltype(&BZ2_bzWriteOpen)>(
+      dlsym(library.get(), "BZ2_bzWriteOpen"));
+    auto write_fn = reinterpret_cast<decltype(&BZ2_bzWrite)>(dlsym(library.get(), "BZ2_bzWrite"));
+    auto close_fn = reinterpret_cast<decltype(&BZ2_bzWriteClose)>(
+      dlsym(library.get(), "BZ2_bzWriteClose"));
+    mps_parser_expects(open_fn != nullptr && write_fn != nullptr && close_fn != nullptr,
+                       error_type_t::ValidationError,
+                       "Error loading libbz2! Library version might be incompatible. Given "
+                       "path: %s",
+                       path.c_str());
+    open_file();
+    int bzerror  = BZ_OK;
+    BZFILE* bzfp = open_fn(&bzerror, fp, 9, 0, 0);
+    mps_parser_expects(bzerror == BZ_OK,
+                       error_type_t::ValidationError,
+                       "Could not open bzip2 compressed file! Given path: %s",
+                       path.c_str());
+    write = [this, bzfp, write_fn](std::string_view text) {
+      for (size_t done = 0; done < text.size(); done += max_write_size) {
+        const int size = std::min(max_write_size, text.size() - done);
+        int bzerror    = BZ_OK;
+        write_fn(&bzerror, bzfp, const_cast<char*>(text.data() + done), size);
+        mps_parser_expects(bzerror == BZ_OK,
+                           error_type_t::ValidationError,
+                           "Error in bzip2 compression of MPS file! Given path: %s",
+                           path.c_str());
+      }
+    };
+    finish = [this, bzfp, close_fn] {
+      int bzerror = BZ_OK;
+      close_fn(&bzerror, bzfp, 0, nullptr, nullptr);
+      mps_parser_expects(bzerror == BZ_OK,
+                         error_type_t::ValidationError,
+                         "Error closing bzip2 file! Given path: %s",
+                         path.c_str());
+    };
+  }
+#endif  // MPS_PARSER_WITH_BZIP2
+
+  void close()
+  {
+    if (closed) { return; }
+    closed = true;
+    finish();
+    if (fp != nullptr) {
+      const int err = fclose(fp);
+      fp            = nullptr;
+      mps_parser_expects(err == 0,
+                         error_type_t::ValidationError,
+                         "Error closing MPS file! Given path: %s",
+                         path.c_str());
+    }
+  }
+};
+
+mps_output_t::mps_output_t(const std::string& path) : impl_(std::make_unique<impl_t>())
+{
+  impl_->path = path;
+#ifdef MPS_PARSER_WITH_ZLIB
+  if (has_extension(path, ".gz")) {
+    impl_->open_gz();
+    return;
+  }
+#endif  // MPS_PARSER_WITH_ZLIB
+#ifdef MPS_PARSER_WITH_BZIP2
+  if (has_extension(path, ".bz2")) {
+    impl_->open_bz2();
+    return;
+  }
+#endif  // MPS_PARSER_WITH_BZIP2
+  impl_->open_plain();
+}
+
+mps_output_t::~mps_output_t()
+{
+  try {
+    impl_->close();
+  } catch (...) {
+  }
+}
+
+void mps_output_t::write(std::string_view text) { impl_->write(text); }
+
+void mps_output_t::close() { impl_->close(); }
+
+}  // namespace cuopt::mps_parser
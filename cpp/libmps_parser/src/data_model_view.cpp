@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -351,4 +351,7 @@ template class data_model_view_t<int, float>;
 
 template class data_model_view_t<int, double>;
 
+// 64-bit indices for the problems of more than 2^31 nonzeros solved with PDLP
+template class data_model_view_t<int64_t, double>;
+
 }  // namespace cuopt::mps_parser
@@ -13,12 +13,16 @@
 #include <cctype>
 #include <cmath>
 #include <cstring>
+#include <exception>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 
 #ifdef MPS_PARSER_WITH_BZIP2
 #include <bzlib.h>
@@ -28,6 +32,11 @@
 #include <zlib.h>
 #endif  // MPS_PARSER_WITH_ZLIB
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #if defined(MPS_PARSER_WITH_BZIP2) || defined(MPS_PARSER_WITH_ZLIB)
 #include <dlfcn.h>
 #endif  // MPS_PARSER_WITH_BZIP2 || MPS_PARSER_WITH_ZLIB
@@ -44,6 +53,44 @@ struct FcloseDeleter {
       fclose(fp) == 0, error_type_t::ValidationError, "Error closing MPS file!");
   }
 };
+
+#if defined(MPS_PARSER_WITH_BZIP2) || defined(MPS_PARSER_WITH_ZLIB)
+// 16MiB
+constexpr size_t decompression_window_size = size_t{1} << 24;
+
+/* Reads decompressed data by fixed size windows until read returns 0, then joins them into a null
+ * terminated buffer reserved once the size is known. Each window is released as soon as it is
+ * copied, so that the peak memory stays close to the decompressed size instead of the multiple
+ * of it left by the reallocations of a growing buffer.
+ */
+template <typename read_t>
+std::vector<char> read_decompressed_windows(read_t&& read)
+{
+  std::vector<std::vector<char>> windows;
+  size_t size = 0;
+  size_t filled;
+  do {
+    auto& window = windows.emplace_back(decompression_window_size);
+    filled       = 0;
+    size_t bytes_read;
+    while (filled < window.size() &&
+           (bytes_read = read(window.data() + filled, window.size() - filled)) > 0) {
+      filled += bytes_read;
+    }
+    window.resize(filled);
+    size += filled;
+  } while (filled == decompression_window_size);
+
+  std::vector<char> buf;
+  buf.reserve(size + 1);
+  for (auto& window : windows) {
+    buf.insert(buf.end(), window.begin(), window.end());
+    std::vector<char>().swap(window);
+  }
+  buf.push_back('\0');
+  return buf;
+}
+#endif  // MPS_PARSER_WITH_BZIP2 || MPS_PARSER_WITH_ZLIB
 }  // end namespace
 
 #ifdef MPS_PARSER_WITH_BZIP2
@@ -106,16 +153,11 @@ std::vector<char> bz2_file_to_string(const std::string& file)
                      "Could not open bzip2 compressed file! Given path: %s",
                      file.c_str());
 
-  std::vector<char> buf;
-  const size_t readbufsize = 1ull << 24;  // 16MiB - just a guess.
-  std::vector<char> readbuf(readbufsize);
-  while (bzerror == BZ_OK) {
-    const size_t bytes_read = BZ2_bzRead(&bzerror, bzfile.get(), readbuf.data(), readbuf.size());
-    if (bzerror == BZ_OK || bzerror == BZ_STREAM_END) {
-      buf.insert(buf.end(), begin(readbuf), begin(readbuf) + bytes_read);
-    }
-  }
-  buf.push_back('\0');
+  auto buf = read_decompressed_windows([&](char* window, size_t size) -> size_t {
+    if (bzerror != BZ_OK) { return 0; }
+    const int bytes_read = BZ2_bzRead(&bzerror, bzfile.get(), window, size);
+    return bzerror == BZ_OK || bzerror == BZ_STREAM_END ? bytes_read : 0;
+  });
   mps_parser_expects(bzerror == BZ_STREAM_END,
                      error_type_t::ValidationError,
                      "Error in bzip2 decompression of MPS file! Given path: %s",
@@ -181,19 +223,14 @@ std::vector<char> zlib_file_to_string(const std::string& file)
                      error_type_t::ValidationError,
                      "Could not set zlib internal buffer size for decompression! Given path: %s",
                      file.c_str());
-  std::vector<char> buf;
-  const size_t readbufsize = 1ull << 24;  // 16MiB
-  std::vector<char> readbuf(readbufsize);
-  int bytes_read = -1;
-  while (bytes_read != 0) {
-    bytes_read = gzread(gzfp.get(), readbuf.data(), readbuf.size());
-    if (bytes_read > 0) { buf.insert(buf.end(), begin(readbuf), begin(readbuf) + bytes_read); }
+  auto buf = read_decompressed_windows([&](char* window, size_t size) -> size_t {
+    const int bytes_read = gzread(gzfp.get(), window, size);
     if (bytes_read < 0) {
       gzerror(gzfp.get(), &zlib_status);
-      break;
+      return 0;
     }
-  }
-  buf.push_back('\0');
+    return bytes_read;
+  });
   mps_parser_expects(zlib_status == Z_OK,
                      error_type_t::ValidationError,
                      "Error in zlib decompression of MPS file! Given path: %s",
@@ -205,6 +242,46 @@ std::vector<char> zlib_file_to_string(const std::string& file)
 
 namespace cuopt::mps_parser {
 
+mps_file_buffer_t::mps_file_buffer_t(const std::string& file)
+{
+  const int fd = open(file.c_str(), O_RDONLY);
+  mps_parser_expects(fd != -1,
+                     error_type_t::ValidationError,
+                     "Error opening MPS file! Given path: %s",
+                     file.c_str());
+  struct stat file_stat;
+  const bool stat_ok = fstat(fd, &file_stat) == 0;
+  // empty files are not mapped, the parser reports them
+  if (stat_ok && file_stat.st_size > 0) {
+    mapping_size_ = file_stat.st_size;
+    mapping_      = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping_ == MAP_FAILED) { mapping_ = nullptr; }
+  }
+  // the mapping stays valid once the file is closed
+  close(fd);
+  mps_parser_expects(stat_ok,
+                     error_type_t::ValidationError,
+                     "File browsing MPS file! Given path: %s",
+                     file.c_str());
+  mps_parser_expects(mapping_ != nullptr || mapping_size_ == 0,
+                     error_type_t::ValidationError,
+                     "Error reading MPS file! Given path: %s",
+                     file.c_str());
+}
+
+mps_file_buffer_t::~mps_file_buffer_t()
+{
+  if (mapping_ != nullptr) { munmap(mapping_, mapping_size_); }
+}
+
+std::string_view mps_file_buffer_t::view() const
+{
+  if (mapping_ != nullptr) {
+    return std::string_view(static_cast<const char*>(mapping_), mapping_size_);
+  }
+  return std::string_view(data_.data(), data_.size());
+}
+
 template <typename i_t>
 std::string_view get_next_string(std::string_view line, i_t& pos, i_t& end)
 {
@@ -272,53 +349,12 @@ ObjSenseType convert_to_obj_sense(const std::string& str)
 template <typename i_t, typename f_t>
 void mps_parser_t<i_t, f_t>::fill_problem(mps_data_model_t<i_t, f_t>& problem)
 {
-  {
-    std::vector<i_t> h_offsets{}, h_indices{};
-    std::vector<f_t> h_values{};
-
-    h_offsets.push_back(0);
-    for (i_t i = 0; i < (i_t)A_indices.size(); ++i) {
-      i_t off = h_offsets.size() > 0 ? h_offsets[h_offsets.size() - 1] : 0;
-      for (const auto& idx_itr : A_indices[i]) {
-        h_indices.push_back(idx_itr);
-      }
-      for (const auto& val_itr : A_values[i]) {
-        h_values.push_back(val_itr);
-      }
-      off += A_indices[i].size();
-      h_offsets.push_back(off);
-    }
-
-    problem.set_csr_constraint_matrix(h_values.data(),
-                                      h_values.size(),
-                                      h_indices.data(),
-                                      h_indices.size(),
-                                      h_offsets.data(),
-                                      h_offsets.size());
-
-    mps_parser_expects(A_indices.size() + 1 == h_offsets.size(),
-                       error_type_t::ValidationError,
-                       "The row indexing vector for the constraint matrix was not constructed "
-                       "successfully. Should be size %zu, but was size %zu",
-                       A_indices.size() + 1,
-                       h_offsets.size());
-    mps_parser_expects(
-      h_indices.size() == h_values.size(),
-      error_type_t::ValidationError,
-      "The nonzero value vector or the column indexing vector for the constraint "
-      "matrix was not constructed "
-      "successfully. Should be the same size but nonzeroes were of size %zu and column "
-      "indexing vector of size %zu ",
-      h_indices.size(),
-      h_values.size());
-    mps_parser_expects(
-      h_offsets[h_offsets.size() - 1] == (i_t)h_values.size(),
-      error_type_t::ValidationError,
-      "The last row offset for the constraint matrix is not equal to the size of the "
-      "nonzero vector. Nonzero has size %zu but the last offset is %d.",
-      h_values.size(),
-      h_offsets[h_offsets.size() - 1]);
-  }
+  problem.set_csr_constraint_matrix(A_values.data(),
+                                    A_values.size(),
+                                    A_indices.data(),
+                                    A_indices.size(),
+                                    A_offsets.data(),
+                                    A_offsets.size());
 
   // Set b & c
   problem.set_constraint_bounds(b_values.data(), b_values.size());
@@ -434,9 +470,11 @@ void mps_parser_t<i_t, f_t>::fill_problem(mps_data_model_t<i_t, f_t>& problem)
 
   problem.set_problem_name(problem_name);
   problem.set_objective_name(objective_name);
-  problem.set_variable_names(std::move(var_names));
+  if (keep_names) {
+    problem.set_variable_names(std::move(var_names));
+    problem.set_row_names(std::move(row_names));
+  }
   problem.set_variable_types(std::move(var_types));
-  problem.set_row_names(std::move(row_names));
   problem.set_maximize(maximize);
 
   // Helper function to build CSR format using double transpose (O(m+n+nnz) instead of
@@ -500,7 +538,7 @@ void mps_parser_t<i_t, f_t>::fill_problem(mps_data_model_t<i_t, f_t>& problem)
   if (!quadobj_entries.empty()) {
     // Convert quadratic objective entries to CSR format using double transpose
     // QUADOBJ stores upper triangular elements, so we expand to full symmetric matrix
-    i_t num_vars    = static_cast<i_t>(var_names.size());
+    i_t num_vars    = static_cast<i_t>(var_types.size());
     auto csr_result = build_csr_via_transpose(quadobj_entries, num_vars, num_vars, true);
 
     // Use optimized double transpose method - O(m+n+nnz) instead of O(nnz*log(nnz))
@@ -513,7 +551,7 @@ void mps_parser_t<i_t, f_t>::fill_problem(mps_data_model_t<i_t, f_t>& problem)
   } else if (!qmatrix_entries.empty()) {
     // Convert quadratic objective entries to CSR format using double transpose
     // QMATRIX stores full symmetric matrix
-    i_t num_vars    = static_cast<i_t>(var_names.size());
+    i_t num_vars    = static_cast<i_t>(var_types.size());
     auto csr_result = build_csr_via_transpose(qmatrix_entries, num_vars, num_vars, false);
 
     // Use optimized double transpose method - O(m+n+nnz) instead of O(nnz*log(nnz))
@@ -527,70 +565,76 @@ void mps_parser_t<i_t, f_t>::fill_problem(mps_data_model_t<i_t, f_t>& problem)
 }
 
 template <typename i_t, typename f_t>
-std::vector<char> mps_parser_t<i_t, f_t>::file_to_string(const std::string& file)
+void mps_parser_t<i_t, f_t>::build_csr_matrix()
+{
+  // raft::common::nvtx::range fun_scope("build csr matrix");
+
+  const size_t n_rows = row_types.size();
+  const size_t nnz    = csc_row_indices.size();
+  csc_offsets.emplace_back(nnz);
+
+  // Counting sort of the entries by row, the columns of a row stay in the order they were read
+  A_offsets.assign(n_rows + 1, 0);
+  for (const auto row : csc_row_indices) {
+    ++A_offsets[row + 1];
+  }
+  std::partial_sum(A_offsets.begin(), A_offsets.end(), A_offsets.begin());
+  A_indices.resize(nnz);
+  A_values.resize(nnz);
+  std::vector<i_t> row_ends(A_offsets.begin(), A_offsets.end() - 1);
+  for (size_t col = 0; col + 1 < csc_offsets.size(); ++col) {
+    for (i_t entry = csc_offsets[col]; entry < csc_offsets[col + 1]; ++entry) {
+      const i_t pos  = row_ends[csc_row_indices[entry]]++;
+      A_indices[pos] = col;
+      A_values[pos]  = csc_values[entry];
+    }
+  }
+
+  std::vector<i_t>().swap(csc_offsets);
+  std::vector<i_t>().swap(csc_row_indices);
+  std::vector<f_t>().swap(csc_values);
+}
+
+template <typename i_t, typename f_t>
+mps_file_buffer_t mps_parser_t<i_t, f_t>::file_to_string(const std::string& file)
 {
   // raft::common::nvtx::range fun_scope("file to string");
 
 #ifdef MPS_PARSER_WITH_BZIP2
   if (file.size() > 4 && file.substr(file.size() - 4, 4) == ".bz2") {
-    return bz2_file_to_string(file);
+    return mps_file_buffer_t(bz2_file_to_string(file));
   }
 #endif  // MPS_PARSER_WITH_BZIP2
 
 #ifdef MPS_PARSER_WITH_ZLIB
   if (file.size() > 3 && file.substr(file.size() - 3, 3) == ".gz") {
-    return zlib_file_to_string(file);
+    return mps_file_buffer_t(zlib_file_to_string(file));
   }
 #endif  // MPS_PARSER_WITH_ZLIB
 
-  // Faster than using C++ I/O
-  FILE* fp = fopen(file.c_str(), "r");
-  mps_parser_expects(fp != nullptr,
-                     error_type_t::ValidationError,
-                     "Error opening MPS file! Given path: %s",
-                     mps_file.c_str());
-
-  mps_parser_expects(fseek(fp, 0L, SEEK_END) == 0,
-                     error_type_t::ValidationError,
-                     "File browsing MPS file! Given path: %s",
-                     mps_file.c_str());
-  const long bufsize = ftell(fp);
-  mps_parser_expects(bufsize != -1L,
-                     error_type_t::ValidationError,
-                     "File browsing MPS file! Given path: %s",
-                     mps_file.c_str());
-  std::vector<char> buf(bufsize + 1);
-  rewind(fp);
-
-  mps_parser_expects(fread(buf.data(), sizeof(char), bufsize, fp) == bufsize,
-                     error_type_t::ValidationError,
-                     "Error reading MPS file! Given path: %s",
-                     mps_file.c_str());
-  buf[bufsize] = '\0';
-
-  mps_parser_expects(fclose(fp) == 0,
-                     error_type_t::ValidationError,
-                     "Error closing MPS file! Given path: %s",
-                     mps_file.c_str());
-
-  return buf;
+  // Uncompressed files are parsed in place from a read only mapping
+  return mps_file_buffer_t(file);
 }
 
 template <typename i_t, typename f_t>
-void mps_parser_t<i_t, f_t>::parse_string(char* buf)
+void mps_parser_t<i_t, f_t>::parse_string(std::string_view buf)
 {
   // raft::common::nvtx::range fun_scope("parse string");
 
-  // Faster than C++ std::get_line
-  char* c_line   = strtok(buf, "\n");
-  bool skip_line = false;
+  // the parsing stops at a null character, as the end of a decompressed buffer
+  buf = buf.substr(0, buf.find('\0'));
+  // Faster than C++ std::get_line. The buffer is read only, lines are views between line returns
+  size_t line_begin = buf.find_first_not_of('\n');
+  bool skip_line    = false;
 
-  mps_parser_expects(c_line != nullptr,
+  mps_parser_expects(line_begin != std::string_view::npos,
                      error_type_t::ValidationError,
                      "Error parsing MPS file! No line return found (\"\\n\")");
 
-  do {
-    std::string_view line(c_line);
+  for (size_t next_line; line_begin != std::string_view::npos;
+       line_begin = buf.find_first_not_of('\n', next_line)) {
+    next_line             = std::min(buf.find('\n', line_begin), buf.size());
+    std::string_view line = buf.substr(line_begin, next_line - line_begin);
     // ignore empty lines and comments
     if (line.empty() || line[0] == '*' || line[0] == '$' || line[0] == '\n' || line[0] == '\r') {
       continue;
@@ -630,11 +674,10 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
         inside_objsense_ = false;
         inside_ranges_   = false;
         inside_objname_  = false;
-        A_indices.resize(row_names.size());
-        A_values.resize(row_names.size());
-        b_values.resize(row_names.size());
+        b_values.resize(row_types.size());
         // Needed if not all rows are mentioned in RHS
         std::fill(b_values.begin(), b_values.end(), f_t(0));
+        next_line = parse_columns_section(buf, next_line);
       } else if (line.find("RHS", 0, 3) == 0) {
         encountered_sections.insert("RHS");
         inside_rows_     = false;
@@ -653,8 +696,8 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
         inside_objsense_ = false;
         inside_ranges_   = false;
         inside_objname_  = false;
-        variable_lower_bounds.resize(var_names.size());
-        variable_upper_bounds.resize(var_names.size());
+        variable_lower_bounds.resize(var_types.size());
+        variable_upper_bounds.resize(var_types.size());
         std::fill(variable_lower_bounds.begin(), variable_lower_bounds.end(), f_t(0));
         std::fill(variable_upper_bounds.begin(),
                   variable_upper_bounds.end(),
@@ -768,7 +811,7 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
                          "Ended up at a bad parser state! Line=%s",
                          std::string(line).c_str());
     }
-  } while ((c_line = strtok(nullptr, "\n")) != nullptr);
+  }
   mps_parser_expects(!objective_name.empty(), error_type_t::ValidationError, "No objective found!");
 
   mps_parser_expects(
@@ -779,6 +822,13 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
   mps_parser_expects(
     encountered_sections.count("RHS"), error_type_t::ValidationError, "RHS section is missing");
 
+  build_csr_matrix();
+  // the names are all resolved, the maps point into the buffer which is released after parsing
+  row_names_map           = {};
+  var_names_map           = {};
+  ignored_objective_names = {};
+  last_var_name_          = {};
+
   // Those sections are mandatory according to the MPS format specification, however some test cases
   // rely on their absence Emit a warning in this case
   if (!encountered_sections.count("NAME")) { printf("NAME section is missing"); }
@@ -786,21 +836,21 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
 
   if (variable_upper_bounds.size() == 0)  // No variables bounds given, add the default values
   {
-    variable_lower_bounds.resize(var_names.size());
-    variable_upper_bounds.resize(var_names.size());
+    variable_lower_bounds.resize(var_types.size());
+    variable_upper_bounds.resize(var_types.size());
     std::fill(variable_lower_bounds.begin(), variable_lower_bounds.end(), f_t(0));
     std::fill(variable_upper_bounds.begin(),
               variable_upper_bounds.end(),
               +std::numeric_limits<f_t>::infinity());
   }
   mps_parser_expects(variable_lower_bounds.size() == variable_upper_bounds.size() &&
-                       variable_upper_bounds.size() == var_names.size(),
+                       variable_upper_bounds.size() == var_types.size(),
                      error_type_t::ValidationError,
                      "MPS Parser Internal Error - Please contact cuOpt team");
 
   // Set all integer variables with bounds unspecified to [0, 1]
   // Also bounds sanity check
-  for (i_t i = 0; i < var_names.size(); ++i) {
+  for (i_t i = 0; i < var_types.size(); ++i) {
     if (!bounds_defined_for_var_id.count(i) && var_types[i] == 'I') {
       variable_lower_bounds[i] = 0;
       variable_upper_bounds[i] = 1;
@@ -817,14 +867,19 @@ void mps_parser_t<i_t, f_t>::parse_string(char* buf)
 template <typename i_t, typename f_t>
 mps_parser_t<i_t, f_t>::mps_parser_t(mps_data_model_t<i_t, f_t>& problem,
                                      const std::string& file,
-                                     bool _fixed_mps_format)
-  : mps_file{file}, fixed_mps_format(_fixed_mps_format)
+                                     bool _fixed_mps_format,
+                                     bool _keep_names,
+                                     size_t _columns_chunk_size)
+  : mps_file{file},
+    fixed_mps_format(_fixed_mps_format),
+    keep_names(_keep_names),
+    columns_chunk_size(_columns_chunk_size)
 {
   // raft::common::nvtx::range fun_scope("mps parser");
 
-  std::vector<char> buf = file_to_string(file);
+  auto buf = file_to_string(file);
 
-  parse_string(buf.data());
+  parse_string(buf.view());
 
   fill_problem(problem);
 }
@@ -835,18 +890,19 @@ void mps_parser_t<i_t, f_t>::parse_rows(std::string_view line)
   // raft::common::nvtx::range fun_scope("parse rows");
 
   RowType type;
-  std::string name;
+  // the name is kept as a view of the file buffer, which outlives the name maps
+  std::string_view name;
 
   if (fixed_mps_format) {
     type = static_cast<RowType>(line[1]);
     name = trim(line.substr(4, 8));  // max of 8 chars allowed
   } else {
-    std::stringstream ss{std::string(line)};
-    char read_word;
-    ss >> read_word;
-    type = static_cast<RowType>(read_word);
-
-    ss >> name;
+    const auto type_pos = line.find_first_not_of(" \t\r");
+    if (type_pos == std::string_view::npos) return;
+    type    = static_cast<RowType>(line[type_pos]);
+    i_t pos = 0;
+    i_t end = type_pos + 1;
+    name    = trim(get_next_string(line, pos, end));
   }
   if (type == Objective) {
     // Keep only the first name or OBJNAME since it was set before
@@ -863,19 +919,18 @@ void mps_parser_t<i_t, f_t>::parse_rows(std::string_view line)
   mps_parser_expects(row_names_map.find(name) == row_names_map.end(),
                      error_type_t::ValidationError,
                      "Duplicate row named '%s' found! line=%s",
-                     name.c_str(),
+                     std::string(name).c_str(),
                      std::string(line).c_str());
-  auto n_rows = row_names.size();
-  row_names.push_back(name);
+  auto n_rows = row_types.size();
+  if (keep_names) { row_names.emplace_back(name); }
   row_names_map.insert(std::make_pair(name, n_rows));
   row_types.push_back(type);
 }
 
 template <typename i_t, typename f_t>
-i_t mps_parser_t<i_t, f_t>::parse_column_var_name(std::string_view line)
+std::pair<std::string_view, i_t> mps_parser_t<i_t, f_t>::read_column_var_name(
+  std::string_view line) const
 {
-  // raft::common::nvtx::range fun_scope("parse columns var name");
-
   std::string_view var_name;
   i_t pos;
   if (fixed_mps_format) {
@@ -891,77 +946,63 @@ i_t mps_parser_t<i_t, f_t>::parse_column_var_name(std::string_view line)
     var_name    = get_next_string(line, pos, end_var);
     pos         = end_var;
   }
-  if (line.find("\'MARKER\'") != std::string::npos) {
-    if (line.find("INTORG") != std::string::npos) {
-      mps_parser_expects(!inside_intcapture_,
-                         error_type_t::ValidationError,
-                         "Cannot capture an int section while already capturing an int section");
-      inside_intcapture_ = true;
-    }
-    if (line.find("INTEND") != std::string::npos) {
-      mps_parser_expects(inside_intcapture_,
-                         error_type_t::ValidationError,
-                         "Cannot stop int capture when a previous capture is not started");
-      inside_intcapture_ = false;
-    }
-    return -1;
+  return std::pair(var_name, pos);
+}
+
+template <typename i_t, typename f_t>
+void mps_parser_t<i_t, f_t>::parse_marker(std::string_view line)
+{
+  if (line.find("INTORG") != std::string::npos) {
+    mps_parser_expects(!inside_intcapture_,
+                       error_type_t::ValidationError,
+                       "Cannot capture an int section while already capturing an int section");
+    inside_intcapture_ = true;
   }
-  char var_type = inside_intcapture_ ? 'I' : 'C';
-  if (!var_names.empty()) {
-    const auto& last = var_names.back();
-    if (last != var_name) {
-      mps_parser_expects(var_names_map.find(std::string(var_name)) == var_names_map.end(),
-                         error_type_t::ValidationError,
-                         "All rows for the column (%s) should occur contiguously! line=%s",
-                         std::string(var_name).c_str(),
-                         std::string(line).c_str());
-      var_names.emplace_back(var_name);
-      var_types.emplace_back(var_type);
-      var_names_map.insert(std::make_pair(std::string(var_name), var_names.size() - 1));
-      c_values.emplace_back(f_t(0));
-    }
-  } else {
-    var_names.emplace_back(var_name);
-    var_types.emplace_back(var_type);
-    var_names_map.insert(std::make_pair(var_name, var_names.size() - 1));
-    c_values.emplace_back(f_t(0));
+  if (line.find("INTEND") != std::string::npos) {
+    mps_parser_expects(inside_intcapture_,
+                       error_type_t::ValidationError,
+                       "Cannot stop int capture when a previous capture is not started");
+    inside_intcapture_ = false;
   }
-  return pos;
 }
 
 template <typename i_t, typename f_t>
-void mps_parser_t<i_t, f_t>::parse_column_row_and_value(std::string_view line, i_t pos)
+i_t mps_parser_t<i_t, f_t>::insert_column(std::string_view line, std::string_view var_name)
 {
-  // raft::common::nvtx::range fun_scope("parse column row and value");
-
-  auto var_id = var_names.size() - 1;
-
-  if (fixed_mps_format) {
-    pos = read_row_and_value(line, pos, var_id);
-    if (pos == -1) return;
-    pos = 39;
-  } else {
-    pos = read_row_and_value(line, pos, var_id);
-    if (pos == -1) return;
+  char var_type = inside_intcapture_ ? 'I' : 'C';
+  if (var_types.empty() || last_var_name_ != var_name) {
+    mps_parser_expects(var_names_map.find(var_name) == var_names_map.end(),
+                       error_type_t::ValidationError,
+                       "All rows for the column (%s) should occur contiguously! line=%s",
+                       std::string(var_name).c_str(),
+                       std::string(line).c_str());
+    if (keep_names) { var_names.emplace_back(var_name); }
+    var_types.emplace_back(var_type);
+    var_names_map.insert(std::make_pair(var_name, var_types.size() - 1));
+    c_values.emplace_back(f_t(0));
+    csc_offsets.emplace_back(csc_row_indices.size());
+    last_var_name_ = var_name;
   }
-
-  if (line.find_last_not_of(" \r\t\n") > pos) { read_row_and_value(line, pos, var_id); }
+  return var_types.size() - 1;
 }
 
 template <typename i_t, typename f_t>
-void mps_parser_t<i_t, f_t>::parse_columns(std::string_view line)
+i_t mps_parser_t<i_t, f_t>::parse_column_var_name(std::string_view line)
 {
-  // raft::common::nvtx::range fun_scope("parse columns");
-
-  i_t pos;
-  if ((pos = parse_column_var_name(line)) == -1) return;
+  // raft::common::nvtx::range fun_scope("parse columns var name");
 
-  parse_column_row_and_value(line, pos);
+  auto [var_name, pos] = read_column_var_name(line);
+  if (line.find("\'MARKER\'") != std::string::npos) {
+    parse_marker(line);
+    return -1;
+  }
+  insert_column(line, var_name);
+  return pos;
 }
 
 template <typename i_t, typename f_t>
 std::tuple<std::string_view, std::string_view, i_t> mps_parser_t<i_t, f_t>::parse_row_name_and_num(
-  std::string_view line, i_t start)
+  std::string_view line, i_t start) const
 {
   // raft::common::nvtx::range fun_scope("parse_row_name_and_num");
 
@@ -981,18 +1022,23 @@ std::tuple<std::string_view, std::string_view, i_t> mps_parser_t<i_t, f_t>::pars
 
   return std::tuple(row_name, num, start);
 }
+
+// Row id of a COLUMNS value, or one of these for the objective rows
+constexpr int objective_row_id = -1;
+constexpr int ignored_row_id   = -2;
+
 template <typename i_t, typename f_t>
-void mps_parser_t<i_t, f_t>::insert_row_name_and_value(std::string_view line,
-                                                       std::string_view row_name,
-                                                       std::string_view num,
-                                                       i_t var_id)
+std::pair<i_t, f_t> mps_parser_t<i_t, f_t>::find_row_and_value(std::string_view line,
+                                                               std::string_view row_name,
+                                                               std::string_view num) const
 {
-  // raft::common::nvtx::range fun_scope("insert_row_name_and_value");
   static_assert(std::is_same_v<f_t, float> || std::is_same_v<f_t, double>,
                 "f_t must be float or double");
 
   // Value for an ignored objective, can just skip it
-  if (ignored_objective_names.find(std::string(row_name)) != ignored_objective_names.end()) return;
+  if (ignored_objective_names.find(row_name) != ignored_objective_names.end()) {
+    return std::pair(ignored_row_id, f_t(0));
+  }
 
   f_t val;
   mps_parser_no_except(
@@ -1004,34 +1050,191 @@ void mps_parser_t<i_t, f_t>::insert_row_name_and_value(std::string_view line,
     std::string(row_name).c_str(),
     std::string(line).c_str(),
     std::string(num).c_str());
-  if (row_name == objective_name) {
-    c_values[var_id] = val;
-    return;
-  }
-  auto itr = row_names_map.find(std::string(row_name));
+  if (row_name == objective_name) { return std::pair(objective_row_id, val); }
+  auto itr = row_names_map.find(row_name);
   mps_parser_expects(itr != row_names_map.end(),
                      error_type_t::ValidationError,
                      "Bad row name found '%s' in COLUMNS! line=%s",
                      std::string(row_name).c_str(),
                      std::string(line).c_str());
-  auto row_id = itr->second;
-  A_indices[row_id].emplace_back(var_id);
-  A_values[row_id].emplace_back(val);
+  return std::pair(itr->second, val);
+}
+
+template <typename i_t, typename f_t>
+void mps_parser_t<i_t, f_t>::insert_row_name_and_value(std::string_view line,
+                                                       std::string_view row_name,
+                                                       std::string_view num,
+                                                       i_t var_id)
+{
+  // raft::common::nvtx::range fun_scope("insert_row_name_and_value");
+
+  auto [row_id, val] = find_row_and_value(line, row_name, num);
+  if (row_id == ignored_row_id) return;
+  if (row_id == objective_row_id) {
+    c_values[var_id] = val;
+    return;
+  }
+  csc_row_indices.emplace_back(row_id);
+  csc_values.emplace_back(val);
 }
 
 template <typename i_t, typename f_t>
-i_t mps_parser_t<i_t, f_t>::read_row_and_value(std::string_view line, i_t start, i_t var_id)
+template <typename insert_t>
+i_t mps_parser_t<i_t, f_t>::read_row_and_value(std::string_view line,
+                                               i_t start,
+                                               insert_t&& insert) const
 {
   // raft::common::nvtx::range fun_scope("read_row_and_value");
 
   auto [row_name, num, end] = parse_row_name_and_num(line, start);
   if (row_name.empty()) return -1;
 
-  insert_row_name_and_value(line, row_name, num, var_id);
+  insert(row_name, num);
 
   return end;
 }
 
+template <typename i_t, typename f_t>
+template <typename insert_t>
+void mps_parser_t<i_t, f_t>::parse_column_row_and_value(std::string_view line,
+                                                        i_t pos,
+                                                        insert_t&& insert) const
+{
+  // raft::common::nvtx::range fun_scope("parse column row and value");
+
+  if (fixed_mps_format) {
+    pos = read_row_and_value(line, pos, insert);
+    if (pos == -1) return;
+    pos = 39;
+  } else {
+    pos = read_row_and_value(line, pos, insert);
+    if (pos == -1) return;
+  }
+
+  if (line.find_last_not_of(" \r\t\n") > pos) { read_row_and_value(line, pos, insert); }
+}
+
+template <typename i_t, typename f_t>
+void mps_parser_t<i_t, f_t>::parse_columns(std::string_view line)
+{
+  // raft::common::nvtx::range fun_scope("parse columns");
+
+  i_t pos;
+  if ((pos = parse_column_var_name(line)) == -1) return;
+
+  const i_t var_id = var_types.size() - 1;
+  parse_column_row_and_value(line, pos, [&](std::string_view row_name, std::string_view num) {
+    insert_row_name_and_value(line, row_name, num, var_id);
+  });
+}
+
+template <typename i_t, typename f_t>
+size_t mps_parser_t<i_t, f_t>::parse_columns_section(std::string_view buf, size_t begin)
+{
+  // raft::common::nvtx::range fun_scope("parse columns section");
+
+  // the section ends at the next line which is neither a column nor a comment
+  size_t end = begin;
+  while (end < buf.size() && (buf[end] == ' ' || buf[end] == '*' || buf[end] == '$' ||
+                              buf[end] == '\n' || buf[end] == '\r')) {
+    end = std::min(buf.find('\n', end), buf.size() - 1) + 1;
+  }
+
+  const size_t size     = end - begin;
+  const size_t n_chunks = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                           size / std::max<size_t>(1, columns_chunk_size));
+  if (n_chunks < 2) { return begin; }
+
+  // The rows are all known, each chunk only reads the row names while it parses its lines
+  std::vector<columns_chunk_t> chunks(n_chunks);
+  std::vector<std::thread> threads;
+  threads.reserve(n_chunks);
+  size_t chunk_begin = begin;
+  for (size_t i = 0; i < n_chunks; ++i) {
+    // chunks end after a line return so that no line is split
+    size_t chunk_end = std::max(chunk_begin, begin + size * (i + 1) / n_chunks);
+    while (chunk_end < end && buf[chunk_end - 1] != '\n') {
+      ++chunk_end;
+    }
+    auto chunk = buf.substr(chunk_begin, chunk_end - chunk_begin);
+    threads.emplace_back([this, chunk, &out = chunks[i]] { parse_columns_chunk(chunk, out); });
+    chunk_begin = chunk_end;
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& chunk : chunks) {
+    merge_columns_chunk(chunk);
+    if (chunk.error) { std::rethrow_exception(chunk.error); }
+  }
+  return end;
+}
+
+template <typename i_t, typename f_t>
+void mps_parser_t<i_t, f_t>::parse_columns_chunk(std::string_view chunk,
+                                                 columns_chunk_t& out) const
+{
+  try {
+    size_t line_begin = 0;
+    while (line_begin < chunk.size()) {
+      auto line_end = chunk.find('\n', line_begin);
+      if (line_end == std::string_view::npos) { line_end = chunk.size(); }
+      std::string_view line = chunk.substr(line_begin, line_end - line_begin);
+      line_begin            = line_end + 1;
+      // ignore empty lines and comments
+      if (line.empty() || line[0] == '*' || line[0] == '$' || line[0] == '\r') { continue; }
+
+      auto [var_name, pos] = read_column_var_name(line);
+      const size_t entry   = out.entry_rows.size();
+      if (line.find("\'MARKER\'") != std::string::npos) {
+        out.columns.push_back({line, var_name, true, false, f_t(0), entry});
+        continue;
+      }
+      if (out.columns.empty() || out.columns.back().is_marker ||
+          out.columns.back().name != var_name) {
+        out.columns.push_back({line, var_name, false, false, f_t(0), entry});
+      }
+      auto& column = out.columns.back();
+      parse_column_row_and_value(line, pos, [&](std::string_view row_name, std::string_view num) {
+        auto [row_id, val] = find_row_and_value(line, row_name, num);
+        if (row_id == objective_row_id) {
+          column.has_objective = true;
+          column.objective     = val;
+        } else if (row_id != ignored_row_id) {
+          out.entry_rows.push_back(row_id);
+          out.entry_values.push_back(val);
+        }
+      });
+    }
+  } catch (...) {
+    out.error = std::current_exception();
+  }
+}
+
+template <typename i_t, typename f_t>
+void mps_parser_t<i_t, f_t>::merge_columns_chunk(const columns_chunk_t& chunk)
+{
+  for (size_t i = 0; i < chunk.columns.size(); ++i) {
+    const auto& column = chunk.columns[i];
+    if (column.is_marker) {
+      parse_marker(column.line);
+      continue;
+    }
+    // a column split between two chunks continues the last one
+    const i_t var_id = insert_column(column.line, column.name);
+    if (column.has_objective) { c_values[var_id] = column.objective; }
+    const size_t last_entry = i + 1 < chunk.columns.size() ? chunk.columns[i + 1].first_entry
+                                                           : chunk.entry_rows.size();
+    csc_row_indices.insert(csc_row_indices.end(),
+                           chunk.entry_rows.begin() + column.first_entry,
+                           chunk.entry_rows.begin() + last_entry);
+    csc_values.insert(csc_values.end(),
+                      chunk.entry_values.begin() + column.first_entry,
+                      chunk.entry_values.begin() + last_entry);
+  }
+}
+
 template <typename i_t, typename f_t>
 void mps_parser_t<i_t, f_t>::parse_rhs(std::string_view line)
 {
@@ -1051,7 +1254,7 @@ void mps_parser_t<i_t, f_t>::parse_rhs(std::string_view line)
     // get the first field (which may or may not be the RHS name)
     i_t first_field_start = 0;
     auto first_field      = get_next_string(line, first_field_start, pos);
-    if (first_field == objective_name || row_names_map.count(std::string(first_field))) {
+    if (first_field == objective_name || row_names_map.count(first_field)) {
       // first field corresponds to a row name, therefore we can assume that there is no RHS name
       // field. Reset pos.
       pos = 0;
@@ -1097,7 +1300,7 @@ i_t mps_parser_t<i_t, f_t>::read_rhs_row_and_value(std::string_view line, i_t st
     // line with what the MPS writer does
     objective_offset_value = -val;
   } else {
-    auto itr = row_names_map.find(std::string(row_name));
+    auto itr = row_names_map.find(row_name);
     mps_parser_expects(itr != row_names_map.end(),
                        error_type_t::ValidationError,
                        "Bad row name found '%s' in RHS! line=%s",
@@ -1144,7 +1347,7 @@ void mps_parser_t<i_t, f_t>::parse_bounds(std::string_view line)
     // a bound name. This is the case for some older MPS files following the SIF format.
     // c.f.
     // https://citeseerx.ist.psu.edu/document?repid=rep1&type=pdf&doi=4dd23bcc5afe4c19a5d21c5be86e2aea2b426beb
-    if (var_names_map.count(std::string(bound_name))) {
+    if (var_names_map.count(bound_name)) {
       var_name = bound_name;
       // go back to before the second field is read
       pos = pos_after_first_field;
@@ -1154,17 +1357,17 @@ void mps_parser_t<i_t, f_t>::parse_bounds(std::string_view line)
     if (var_name[0] == '$') return;
   }
 
-  auto itr = var_names_map.find(std::string(var_name));
+  auto itr = var_names_map.find(var_name);
   // Define a var in bounds
   // Has no impact on objective function but is not an error in itself
   if (itr == var_names_map.end()) {
-    var_names.emplace_back(var_name);
-    var_names_map.insert(std::make_pair(std::string(var_name), var_names.size() - 1));
+    if (keep_names) { var_names.emplace_back(var_name); }
+    var_names_map.insert(std::make_pair(var_name, var_types.size()));
     c_values.emplace_back(f_t(0));
     variable_lower_bounds.emplace_back(0);
     variable_upper_bounds.emplace_back(+std::numeric_limits<f_t>::infinity());
     var_types.resize(var_types.size() + 1);
-    itr = var_names_map.find(std::string(var_name));
+    itr = var_names_map.find(var_name);
   }
   i_t var_id = itr->second;
 
@@ -1197,7 +1400,7 @@ i_t mps_parser_t<i_t, f_t>::insert_range_value(std::string_view line, bool skip_
     value = get_numerical_bound<true>(line, end);
   }
 
-  auto itr = row_names_map.find(std::string(row_name));
+  auto itr = row_names_map.find(row_name);
   mps_parser_expects(itr != row_names_map.end(),
                      error_type_t::ValidationError,
                      "Bad row name found '%s' in RANGES! line=%s",
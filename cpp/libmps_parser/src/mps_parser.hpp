@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -10,8 +10,12 @@
 #include <mps_parser/mps_data_model.hpp>
 
 #include <stdarg.h>
+#include <exception>
 #include <limits>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -52,6 +56,31 @@ enum ObjSenseType {
   Maximize,
 };  // enum ObjSenseType
 
+/**
+ * @brief Contents of an MPS file, either decompressed in memory or mapped read only from an
+ *        uncompressed file so that its pages are shared through the page cache
+ */
+class mps_file_buffer_t {
+ public:
+  explicit mps_file_buffer_t(std::vector<char>&& data) : data_(std::move(data)) {}
+  /**
+   * @brief Maps the whole file read only
+   *
+   * @param[in] file Path to the uncompressed MPS file
+   */
+  explicit mps_file_buffer_t(const std::string& file);
+  ~mps_file_buffer_t();
+  mps_file_buffer_t(const mps_file_buffer_t&)            = delete;
+  mps_file_buffer_t& operator=(const mps_file_buffer_t&) = delete;
+
+  std::string_view view() const;
+
+ private:
+  std::vector<char> data_{};
+  void* mapping_{nullptr};
+  size_t mapping_size_{0};
+};  // class mps_file_buffer_t
+
 /**
  * @brief Main parser class for MPS files
  *
@@ -71,15 +100,28 @@ class mps_parser_t {
    * @param[in] file Path to the MPS file to be parsed
    * @param[in] fixed_mps_format Bool which describes whether the MPS file is in fixed format or
    * not. Default is true.
+   * @param[in] keep_names Whether the row and variable names are kept once their references are
+   * resolved. Default is true.
+   * @param[in] columns_chunk_size Minimum size in bytes of the chunks of the COLUMNS section which
+   * are parsed on their own thread. Default is 8 MiB.
    */
   mps_parser_t(mps_data_model_t<i_t, f_t>& problem,
                const std::string& file,
-               bool fixed_mps_format = true);
+               bool fixed_mps_format     = true,
+               bool keep_names           = true,
+               size_t columns_chunk_size = default_columns_chunk_size);
+
+  // COLUMNS sections smaller than two chunks are parsed on the calling thread
+  static constexpr size_t default_columns_chunk_size = size_t{8} << 20;
 
   /** path to the mps file being parsed */
   std::string mps_file{};
   /** whether the MPS file is in fixed format or not */
   bool fixed_mps_format;
+  /** whether `row_names` and `var_names` are filled and passed to the problem */
+  bool keep_names;
+  /** minimum size in bytes of the chunks of the COLUMNS section parsed on their own thread */
+  size_t columns_chunk_size;
   /** name of the problem as found in the MPS file */
   std::string problem_name{};
   /** names of each of the rows (aka constraints or objective) in the LP */
@@ -92,10 +134,12 @@ class mps_parser_t {
   std::vector<std::string> var_names{};
   /** types of variables 'I' or 'C' */
   std::vector<char> var_types{};
-  /** every variable that is part of each row */
-  std::vector<std::vector<i_t>> A_indices{};
-  /** values of the constraint matrix A */
-  std::vector<std::vector<f_t>> A_values{};
+  /** CSR offsets of the rows of the constraint matrix A */
+  std::vector<i_t> A_offsets{};
+  /** every variable that is part of each row, row after row */
+  std::vector<i_t> A_indices{};
+  /** values of the constraint matrix A, row after row */
+  std::vector<f_t> A_values{};
   /** values of the RHS of the constraints */
   std::vector<f_t> b_values{};
   /** weights used in the objective */
@@ -131,31 +175,69 @@ class mps_parser_t {
   bool inside_quadobj_{false};
   bool inside_qmatrix_{false};
   std::unordered_set<std::string> encountered_sections{};
-  std::unordered_map<std::string, i_t> row_names_map{};
-  std::unordered_map<std::string, i_t> var_names_map{};
-  std::unordered_set<std::string> ignored_objective_names{};
+  // The names are looked up as views of the file buffer, so the maps are released at the end of
+  // `parse_string`, before the buffer is
+  std::unordered_map<std::string_view, i_t> row_names_map{};
+  std::unordered_map<std::string_view, i_t> var_names_map{};
+  std::unordered_set<std::string_view> ignored_objective_names{};
+  std::string_view last_var_name_{};
   std::unordered_set<i_t> bounds_defined_for_var_id{};
+  // A is read column by column as the COLUMNS section orders it, then transposed to CSR
+  std::vector<i_t> csc_offsets{};
+  std::vector<i_t> csc_row_indices{};
+  std::vector<f_t> csc_values{};
   static constexpr f_t unset_range_value = std::numeric_limits<f_t>::infinity();
+  /* COLUMNS lines of a line aligned chunk of the section, parsed on their own thread. The columns
+   * are numbered and the markers applied when the chunks are merged in the file order
+   */
+  struct columns_chunk_t {
+    struct column_t {
+      // first line of the column in the chunk, or the marker line
+      std::string_view line;
+      std::string_view name;
+      bool is_marker;
+      bool has_objective;
+      f_t objective;
+      size_t first_entry;
+    };
+    std::vector<column_t> columns{};
+    std::vector<i_t> entry_rows{};
+    std::vector<f_t> entry_values{};
+    // error of the first bad line, the columns before it are still merged
+    std::exception_ptr error{};
+  };
 
-  /* Reads an MPS input file into a buffer.
+  /* Reads an MPS input file into a buffer, uncompressed files are mapped instead of read.
    *
    * If the file has a .gz or .bz2 suffix and zlib or libbzip2 are installed, respectively,
    * the function directly reads and decompresses the compressed MPS file.
    */
-  std::vector<char> file_to_string(const std::string& file);
+  mps_file_buffer_t file_to_string(const std::string& file);
   void fill_problem(mps_data_model_t<i_t, f_t>& problem);
-  void parse_string(char* buf);
+  void build_csr_matrix();
+  void parse_string(std::string_view buf);
   void parse_rows(std::string_view line);
   void parse_columns(std::string_view line);
+  size_t parse_columns_section(std::string_view buf, size_t begin);
+  void parse_columns_chunk(std::string_view chunk, columns_chunk_t& out) const;
+  void merge_columns_chunk(const columns_chunk_t& chunk);
   i_t parse_column_var_name(std::string_view line);
+  std::pair<std::string_view, i_t> read_column_var_name(std::string_view line) const;
+  void parse_marker(std::string_view line);
+  i_t insert_column(std::string_view line, std::string_view var_name);
   std::tuple<std::string_view, std::string_view, i_t> parse_row_name_and_num(std::string_view line,
-                                                                             i_t start);
+                                                                             i_t start) const;
+  std::pair<i_t, f_t> find_row_and_value(std::string_view line,
+                                         std::string_view row_name,
+                                         std::string_view num) const;
   void insert_row_name_and_value(std::string_view line,
                                  std::string_view row_name,
                                  std::string_view num,
                                  i_t var_id);
-  void parse_column_row_and_value(std::string_view line, i_t pos);
-  i_t read_row_and_value(std::string_view line, i_t start, i_t var_id);
+  template <typename insert_t>
+  void parse_column_row_and_value(std::string_view line, i_t pos, insert_t&& insert) const;
+  template <typename insert_t>
+  i_t read_row_and_value(std::string_view line, i_t start, insert_t&& insert) const;
   void parse_rhs(std::string_view line);
   template <bool bounds_or_ranges = false, int fixed_length = 12>
   f_t get_numerical_bound(std::string_view line, i_t& start);
@@ -8,14 +8,13 @@
 #include <mps_parser/mps_writer.hpp>
 
 #include <mps_parser/data_model_view.hpp>
+#include <mps_parser/utilities/chunked_output.hpp>
 #include <utilities/error.hpp>
 
 #include <cmath>
-#include <fstream>
-#include <iomanip>
-#include <iostream>
 #include <limits>
-#include <map>
+#include <string>
+#include <vector>
 
 namespace cuopt::mps_parser {
 
@@ -27,13 +26,6 @@ mps_writer_t<i_t, f_t>::mps_writer_t(const data_model_view_t<i_t, f_t>& problem)
 template <typename i_t, typename f_t>
 void mps_writer_t<i_t, f_t>::write(const std::string& mps_file_path)
 {
-  std::ofstream mps_file(mps_file_path);
-
-  mps_parser_expects(mps_file.is_open(),
-                     error_type_t::ValidationError,
-                     "Error creating output MPS file! Given path: %s",
-                     mps_file_path.c_str());
-
   i_t n_variables = problem_.get_variable_lower_bounds().size();
   i_t n_constraints;
   if (problem_.get_constraint_bounds().size() > 0)
@@ -109,105 +101,121 @@ void mps_writer_t<i_t, f_t>::write(const std::string& mps_file_path)
       constraint_upper_bounds.data());
   }
 
-  // save coefficients with full precision
-  mps_file << std::setprecision(std::numeric_limits<f_t>::max_digits10);
+  const std::string objective_name =
+    problem_.get_objective_name().empty() ? "OBJ" : problem_.get_objective_name();
+  const auto& row_names = problem_.get_row_names();
+  const auto& var_names = problem_.get_variable_names();
+  auto append_row_name  = [&](std::string& buffer, size_t i) {
+    if (i < row_names.size()) {
+      buffer += row_names[i];
+    } else {
+      buffer += 'R';
+      append_number(buffer, i);
+    }
+  };
+  auto append_col_name = [&](std::string& buffer, size_t j) {
+    if (j < var_names.size()) {
+      buffer += var_names[j];
+    } else {
+      buffer += 'C';
+      append_number(buffer, j);
+    }
+  };
+
+  // The sections are formatted in parallel chunks, coefficients are written with max_digits10
+  // significant digits as the iostream writer did
+  mps_output_t mps_file(mps_file_path);
+  std::string header;
 
   // NAME section
-  mps_file << "NAME          " << problem_.get_problem_name() << "\n";
+  header += "NAME          " + problem_.get_problem_name() + "\n";
 
-  if (problem_.get_sense()) { mps_file << "OBJSENSE\n MAXIMIZE\n"; }
+  if (problem_.get_sense()) { header += "OBJSENSE\n MAXIMIZE\n"; }
 
   // ROWS section
-  mps_file << "ROWS\n";
-  mps_file << " N  "
-           << (problem_.get_objective_name().empty() ? "OBJ" : problem_.get_objective_name())
-           << "\n";
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    std::string row_name =
-      i < problem_.get_row_names().size() ? problem_.get_row_names()[i] : "R" + std::to_string(i);
+  header += "ROWS\n";
+  header += " N  " + objective_name + "\n";
+  mps_file.write(header);
+  write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
     char type = 'L';
     if (constraint_lower_bounds[i] == constraint_upper_bounds[i])
       type = 'E';
     else if (std::isinf(constraint_upper_bounds[i]))
       type = 'G';
-    mps_file << " " << type << "  " << row_name << "\n";
-  }
+    buffer += ' ';
+    buffer += type;
+    buffer += "  ";
+    append_row_name(buffer, i);
+    buffer += '\n';
+  });
 
   // COLUMNS section
-  mps_file << "COLUMNS\n";
+  mps_file.write("COLUMNS\n");
 
-  // Keep a single integer section marker by going over constraints twice and writing out
-  // integral/nonintegral nonzeros ordered map
-  std::vector<bool> var_in_constraint(n_variables, false);
-  std::map<i_t, std::vector<std::pair<i_t, f_t>>> integral_col_nnzs;
-  std::map<i_t, std::vector<std::pair<i_t, f_t>>> continuous_col_nnzs;
-  for (size_t row_id = 0; row_id < (size_t)n_constraints; row_id++) {
-    for (size_t k = (size_t)constraint_matrix_offsets[row_id];
-         k < (size_t)constraint_matrix_offsets[row_id + 1];
-         k++) {
-      size_t var = (size_t)constraint_matrix_indices[k];
-      if (variable_types[var] == 'I') {
-        integral_col_nnzs[var].emplace_back(row_id, constraint_matrix_values[k]);
-      } else {
-        continuous_col_nnzs[var].emplace_back(row_id, constraint_matrix_values[k]);
-      }
-      var_in_constraint[var] = true;
-    }
+  // Column major copy of the matrix, the rows of a column stay in increasing order
+  std::vector<size_t> col_offsets(n_variables + 1, 0);
+  for (size_t k = 0; k < constraint_matrix_indices.size(); k++) {
+    col_offsets[constraint_matrix_indices[k] + 1]++;
   }
-
-  // Record and explicitely declared variables not contained in any constraint.
-  std::vector<i_t> orphan_continuous_vars;
-  std::vector<i_t> orphan_integer_vars;
-  for (i_t var = 0; var < n_variables; ++var) {
-    if (!var_in_constraint[var]) {
-      if (variable_types[var] == 'I') {
-        orphan_integer_vars.push_back(var);
-      } else {
-        orphan_continuous_vars.push_back(var);
+  for (size_t j = 0; j < (size_t)n_variables; j++) {
+    col_offsets[j + 1] += col_offsets[j];
+  }
+  std::vector<i_t> col_rows(constraint_matrix_indices.size());
+  std::vector<f_t> col_values(constraint_matrix_indices.size());
+  {
+    std::vector<size_t> position(col_offsets.begin(), col_offsets.end() - 1);
+    for (size_t row_id = 0; row_id < (size_t)n_constraints; row_id++) {
+      for (size_t k = (size_t)constraint_matrix_offsets[row_id];
+           k < (size_t)constraint_matrix_offsets[row_id + 1];
+           k++) {
+        const size_t p = position[constraint_matrix_indices[k]]++;
+        col_rows[p]    = row_id;
+        col_values[p]  = constraint_matrix_values[k];
       }
     }
   }
 
+  // Keep a single integer section marker by going over the variables twice. The variables not
+  // contained in any constraint come first in each section
   for (size_t is_integral = 0; is_integral < 2; is_integral++) {
-    auto& col_map     = is_integral ? integral_col_nnzs : continuous_col_nnzs;
-    auto& orphan_vars = is_integral ? orphan_integer_vars : orphan_continuous_vars;
-    if (is_integral) mps_file << "    MARK0001  'MARKER'                 'INTORG'\n";
-    for (auto& var_id : orphan_vars) {
-      std::string col_name = var_id < problem_.get_variable_names().size()
-                               ? problem_.get_variable_names()[var_id]
-                               : "C" + std::to_string(var_id);
-      // Write that column even if it is orphan as has a zero objective coefficient.
-      // Some tools require variables to be declared in "COLUMNS" before any "BOUNDS" statements.
-      mps_file << "    " << col_name << " "
-               << (problem_.get_objective_name().empty() ? "OBJ" : problem_.get_objective_name())
-               << " " << objective_coefficients[var_id] << "\n";
+    std::vector<i_t> section_vars;
+    for (size_t pass = 0; pass < 2; pass++) {
+      for (i_t var = 0; var < n_variables; ++var) {
+        const bool orphan = col_offsets[var] == col_offsets[var + 1];
+        if ((variable_types[var] == 'I') == (is_integral == 1) && orphan == (pass == 0)) {
+          section_vars.push_back(var);
+        }
+      }
     }
-    for (auto& [var_id, nnzs] : col_map) {
-      std::string col_name = var_id < problem_.get_variable_names().size()
-                               ? problem_.get_variable_names()[var_id]
-                               : "C" + std::to_string(var_id);
-      for (auto& nnz : nnzs) {
-        std::string row_name = nnz.first < problem_.get_row_names().size()
-                                 ? problem_.get_row_names()[nnz.first]
-                                 : "R" + std::to_string(nnz.first);
-        mps_file << "    " << col_name << " " << row_name << " " << nnz.second << "\n";
+    if (is_integral) mps_file.write("    MARK0001  'MARKER'                 'INTORG'\n");
+    write_in_chunks(mps_file, section_vars.size(), [&](size_t i, std::string& buffer) {
+      const i_t var_id  = section_vars[i];
+      const bool orphan = col_offsets[var_id] == col_offsets[var_id + 1];
+      for (size_t k = col_offsets[var_id]; k < col_offsets[var_id + 1]; k++) {
+        buffer += "    ";
+        append_col_name(buffer, var_id);
+        buffer += ' ';
+        append_row_name(buffer, col_rows[k]);
+        buffer += ' ';
+        append_number(buffer, col_values[k]);
+        buffer += '\n';
       }
-      // Write objective coefficients
-      if (objective_coefficients[var_id] != 0.0) {
-        mps_file << "    " << col_name << " "
-                 << (problem_.get_objective_name().empty() ? "OBJ" : problem_.get_objective_name())
-                 << " " << objective_coefficients[var_id] << "\n";
+      // Write that column even if it is orphan as has a zero objective coefficient.
+      // Some tools require variables to be declared in "COLUMNS" before any "BOUNDS" statements.
+      if (orphan || objective_coefficients[var_id] != 0.0) {
+        buffer += "    ";
+        append_col_name(buffer, var_id);
+        buffer += ' ' + objective_name + ' ';
+        append_number(buffer, objective_coefficients[var_id]);
+        buffer += '\n';
       }
-    }
-    if (is_integral) mps_file << "    MARK0001  'MARKER'                 'INTEND'\n";
+    });
+    if (is_integral) mps_file.write("    MARK0001  'MARKER'                 'INTEND'\n");
   }
 
   // RHS section
-  mps_file << "RHS\n";
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    std::string row_name =
-      i < problem_.get_row_names().size() ? problem_.get_row_names()[i] : "R" + std::to_string(i);
-
+  mps_file.write("RHS\n");
+  write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
     f_t rhs;
     if (constraint_bounds.size() > 0)
       rhs = constraint_bounds[i];
@@ -220,71 +228,93 @@ void mps_writer_t<i_t, f_t>::write(const std::string& mps_file_path)
     }
 
     if (std::isfinite(rhs) && rhs != 0.0) {
-      mps_file << "    RHS1      " << row_name << " " << rhs << "\n";
+      buffer += "    RHS1      ";
+      append_row_name(buffer, i);
+      buffer += ' ';
+      append_number(buffer, rhs);
+      buffer += '\n';
     }
-  }
+  });
   if (std::isfinite(problem_.get_objective_offset()) && problem_.get_objective_offset() != 0.0) {
-    mps_file << "    RHS1      "
-             << (problem_.get_objective_name().empty() ? "OBJ" : problem_.get_objective_name())
-             << " " << -problem_.get_objective_offset() << "\n";
+    std::string offset = "    RHS1      " + objective_name + " ";
+    append_number(offset, -problem_.get_objective_offset());
+    mps_file.write(offset + "\n");
   }
 
   // RANGES section if needed
+  auto is_range = [&](size_t i) {
+    return constraint_lower_bounds[i] != -std::numeric_limits<f_t>::infinity() &&
+           constraint_upper_bounds[i] != std::numeric_limits<f_t>::infinity() &&
+           constraint_lower_bounds[i] != constraint_upper_bounds[i];
+  };
   bool has_ranges = false;
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    if (constraint_lower_bounds[i] != -std::numeric_limits<f_t>::infinity() &&
-        constraint_upper_bounds[i] != std::numeric_limits<f_t>::infinity() &&
-        constraint_lower_bounds[i] != constraint_upper_bounds[i]) {
-      if (!has_ranges) {
-        mps_file << "RANGES\n";
-        has_ranges = true;
-      }
-      std::string row_name = "R" + std::to_string(i);
-      mps_file << "    RNG1      " << row_name << " "
-               << (constraint_upper_bounds[i] - constraint_lower_bounds[i]) << "\n";
-    }
+  for (size_t i = 0; i < (size_t)n_constraints && !has_ranges; i++) {
+    has_ranges = is_range(i);
+  }
+  if (has_ranges) {
+    mps_file.write("RANGES\n");
+    write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
+      if (!is_range(i)) { return; }
+      buffer += "    RNG1      R";
+      append_number(buffer, i);
+      buffer += ' ';
+      append_number(buffer, constraint_upper_bounds[i] - constraint_lower_bounds[i]);
+      buffer += '\n';
+    });
   }
 
   // BOUNDS section
-  mps_file << "BOUNDS\n";
-  for (size_t j = 0; j < (size_t)n_variables; j++) {
-    std::string col_name        = j < problem_.get_variable_names().size()
-                                    ? problem_.get_variable_names()[j]
-                                    : "C" + std::to_string(j);
-    std::string lower_bound_str = variable_types[j] == 'I' ? "LI" : "LO";
-    std::string upper_bound_str = variable_types[j] == 'I' ? "UI" : "UP";
+  mps_file.write("BOUNDS\n");
+  write_in_chunks(mps_file, n_variables, [&](size_t j, std::string& buffer) {
+    const char* lower_bound_str = variable_types[j] == 'I' ? " LI BOUND1    " : " LO BOUND1    ";
+    const char* upper_bound_str = variable_types[j] == 'I' ? " UI BOUND1    " : " UP BOUND1    ";
 
     if (variable_lower_bounds[j] == -std::numeric_limits<f_t>::infinity() &&
         variable_upper_bounds[j] == std::numeric_limits<f_t>::infinity()) {
-      mps_file << " FR BOUND1    " << col_name << "\n";
+      buffer += " FR BOUND1    ";
+      append_col_name(buffer, j);
+      buffer += '\n';
     }
     // Ambiguity exists in the spec about the case where upper_bound == 0 and lower_bound == 0, and
     // only UP is specified. Handle fixed variables explicitely to avoid this pitfall.
     else if (variable_lower_bounds[j] == variable_upper_bounds[j]) {
-      mps_file << " FX BOUND1    " << col_name << " " << variable_lower_bounds[j] << "\n";
+      buffer += " FX BOUND1    ";
+      append_col_name(buffer, j);
+      buffer += ' ';
+      append_number(buffer, variable_lower_bounds[j]);
+      buffer += '\n';
     } else {
       if (variable_lower_bounds[j] != 0.0) {
         if (variable_lower_bounds[j] == -std::numeric_limits<f_t>::infinity()) {
-          mps_file << " MI BOUND1    " << col_name << "\n";
+          buffer += " MI BOUND1    ";
+          append_col_name(buffer, j);
+          buffer += '\n';
         } else {
-          mps_file << " " << lower_bound_str << " BOUND1    " << col_name << " "
-                   << variable_lower_bounds[j] << "\n";
+          buffer += lower_bound_str;
+          append_col_name(buffer, j);
+          buffer += ' ';
+          append_number(buffer, variable_lower_bounds[j]);
+          buffer += '\n';
         }
       }
       // Integer variables get different default bounds compared to continuous variables
       if (variable_upper_bounds[j] != std::numeric_limits<f_t>::infinity() ||
           variable_types[j] == 'I') {
-        mps_file << " " << upper_bound_str << " BOUND1    " << col_name << " "
-                 << variable_upper_bounds[j] << "\n";
+        buffer += upper_bound_str;
+        append_col_name(buffer, j);
+        buffer += ' ';
+        append_number(buffer, variable_upper_bounds[j]);
+        buffer += '\n';
       }
     }
-  }
+  });
 
-  mps_file << "ENDATA\n";
+  mps_file.write("ENDATA\n");
   mps_file.close();
 }
 
 template class mps_writer_t<int, float>;
 template class mps_writer_t<int, double>;
+template class mps_writer_t<int64_t, double>;
 
 }  // namespace cuopt::mps_parser
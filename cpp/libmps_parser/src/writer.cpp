@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -22,5 +22,7 @@ template void write_mps<int, float>(const data_model_view_t<int, float>& problem
                                     const std::string& mps_file_path);
 template void write_mps<int, double>(const data_model_view_t<int, double>& problem,
                                      const std::string& mps_file_path);
+template void write_mps<int64_t, double>(const data_model_view_t<int64_t, double>& problem,
+                                         const std::string& mps_file_path);
 
 }  // namespace cuopt::mps_parser
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,12 +8,19 @@
 #include <utilities/common_utils.hpp>
 
 #include <mps_parser.hpp>
+#include <mps_parser/binary_format.hpp>
+#include <mps_parser/data_model_view.hpp>
 #include <mps_parser/parser.hpp>
+#include <mps_parser/writer.hpp>
 
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -43,6 +50,85 @@ bool file_exists(const std::string& file)
   return std::filesystem::exists(rel_file);
 }
 
+// View over the arrays of a parsed problem, as the solver hands it to the writers
+data_model_view_t<int, double> make_view(const mps_data_model_t<int, double>& problem)
+{
+  data_model_view_t<int, double> view;
+  view.set_maximize(problem.get_sense());
+  view.set_csr_constraint_matrix(problem.get_constraint_matrix_values().data(),
+                                 problem.get_constraint_matrix_values().size(),
+                                 problem.get_constraint_matrix_indices().data(),
+                                 problem.get_constraint_matrix_indices().size(),
+                                 problem.get_constraint_matrix_offsets().data(),
+                                 problem.get_constraint_matrix_offsets().size());
+  if (!problem.get_constraint_bounds().empty()) {
+    view.set_constraint_bounds(problem.get_constraint_bounds().data(),
+                               problem.get_constraint_bounds().size());
+  }
+  view.set_objective_coefficients(problem.get_objective_coefficients().data(),
+                                  problem.get_objective_coefficients().size());
+  view.set_objective_scaling_factor(problem.get_objective_scaling_factor());
+  view.set_objective_offset(problem.get_objective_offset());
+  view.set_variable_lower_bounds(problem.get_variable_lower_bounds().data(),
+                                 problem.get_variable_lower_bounds().size());
+  view.set_variable_upper_bounds(problem.get_variable_upper_bounds().data(),
+                                 problem.get_variable_upper_bounds().size());
+  if (!problem.get_variable_types().empty()) {
+    view.set_variable_types(problem.get_variable_types().data(),
+                            problem.get_variable_types().size());
+  }
+  if (!problem.get_row_types().empty()) {
+    view.set_row_types(problem.get_row_types().data(), problem.get_row_types().size());
+  }
+  view.set_constraint_lower_bounds(problem.get_constraint_lower_bounds().data(),
+                                   problem.get_constraint_lower_bounds().size());
+  view.set_constraint_upper_bounds(problem.get_constraint_upper_bounds().data(),
+                                   problem.get_constraint_upper_bounds().size());
+  view.set_objective_name(problem.get_objective_name());
+  view.set_problem_name(problem.get_problem_name());
+  view.set_variable_names(problem.get_variable_names());
+  view.set_row_names(problem.get_row_names());
+  if (!problem.get_quadratic_objective_offsets().empty()) {
+    view.set_quadratic_objective_matrix(problem.get_quadratic_objective_values().data(),
+                                        problem.get_quadratic_objective_values().size(),
+                                        problem.get_quadratic_objective_indices().data(),
+                                        problem.get_quadratic_objective_indices().size(),
+                                        problem.get_quadratic_objective_offsets().data(),
+                                        problem.get_quadratic_objective_offsets().size());
+  }
+  return view;
+}
+
+// Values are compared exactly, the writers must not lose any precision
+void expect_same_problem(const mps_data_model_t<int, double>& expected,
+                         const mps_data_model_t<int, double>& actual)
+{
+  EXPECT_EQ(expected.get_problem_name(), actual.get_problem_name());
+  EXPECT_EQ(expected.get_objective_name(), actual.get_objective_name());
+  EXPECT_EQ(expected.get_sense(), actual.get_sense());
+  EXPECT_EQ(expected.get_objective_scaling_factor(), actual.get_objective_scaling_factor());
+  EXPECT_EQ(expected.get_objective_offset(), actual.get_objective_offset());
+  EXPECT_EQ(expected.get_constraint_matrix_values(), actual.get_constraint_matrix_values());
+  EXPECT_EQ(expected.get_constraint_matrix_indices(), actual.get_constraint_matrix_indices());
+  EXPECT_EQ(expected.get_constraint_matrix_offsets(), actual.get_constraint_matrix_offsets());
+  EXPECT_EQ(expected.get_objective_coefficients(), actual.get_objective_coefficients());
+  EXPECT_EQ(expected.get_variable_lower_bounds(), actual.get_variable_lower_bounds());
+  EXPECT_EQ(expected.get_variable_upper_bounds(), actual.get_variable_upper_bounds());
+  EXPECT_EQ(expected.get_variable_types(), actual.get_variable_types());
+  EXPECT_EQ(expected.get_constraint_lower_bounds(), actual.get_constraint_lower_bounds());
+  EXPECT_EQ(expected.get_constraint_upper_bounds(), actual.get_constraint_upper_bounds());
+  EXPECT_EQ(expected.get_variable_names(), actual.get_variable_names());
+  EXPECT_EQ(expected.get_row_names(), actual.get_row_names());
+  EXPECT_EQ(expected.get_quadratic_objective_values(), actual.get_quadratic_objective_values());
+  EXPECT_EQ(expected.get_quadratic_objective_indices(), actual.get_quadratic_objective_indices());
+  EXPECT_EQ(expected.get_quadratic_objective_offsets(), actual.get_quadratic_objective_offsets());
+}
+
+std::string temp_file_path(const std::string& name)
+{
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
 TEST(mps_parser, bad_mps_files)
 {
   std::stringstream ss;
@@ -70,20 +156,20 @@ TEST(mps_parser, good_mps_file_1)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -106,20 +192,20 @@ TEST(mps_parser, good_mps_file_clrf)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -142,20 +228,20 @@ TEST(mps_parser, good_mps_free_file_clrf)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -178,18 +264,18 @@ TEST(mps_parser, good_mps_file_comments)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(1), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(1), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(1), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(1), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -224,20 +310,20 @@ TEST(mps_parser, good_mps_file_2)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VA R1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -260,20 +346,20 @@ TEST(mps_parser_free_format, free_format_mps_file_1)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -313,14 +399,14 @@ TEST(mps_bounds, up_low_bounds)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("x", mps.var_names[0]);
   EXPECT_EQ("y", mps.var_names[1]);
-  ASSERT_EQ(int(1), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(1), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(1., mps.A_values[0][0]);
-  EXPECT_EQ(1., mps.A_values[0][1]);
+  ASSERT_EQ(int(1), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(1), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(1., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(1., mps.A_values[mps.A_offsets[0] + 1]);
   ASSERT_EQ(int(1), mps.b_values.size());
   EXPECT_EQ(3., mps.b_values[0]);
   ASSERT_EQ(int(2), mps.c_values.size());
@@ -579,20 +665,20 @@ TEST(mps_parser, good_mps_file_mip_1)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(8000., mps.A_values[0][0]);
-  EXPECT_EQ(4000., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(15., mps.A_values[1][0]);
-  EXPECT_EQ(30., mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(8000., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4000., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(15., mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(30., mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(40000., mps.b_values[0]);
   EXPECT_EQ(200., mps.b_values[1]);
@@ -624,20 +710,20 @@ TEST(mps_parser, good_mps_file_mip_no_marker)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(8000., mps.A_values[0][0]);
-  EXPECT_EQ(4000., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(15., mps.A_values[1][0]);
-  EXPECT_EQ(30., mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(8000., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4000., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(15., mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(30., mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(40000., mps.b_values[0]);
   EXPECT_EQ(200., mps.b_values[1]);
@@ -669,20 +755,20 @@ TEST(mps_parser, good_mps_file_no_bounds)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(8000., mps.A_values[0][0]);
-  EXPECT_EQ(4000., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(15., mps.A_values[1][0]);
-  EXPECT_EQ(30., mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(8000., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4000., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(15., mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(30., mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(40000., mps.b_values[0]);
   EXPECT_EQ(200., mps.b_values[1]);
@@ -715,20 +801,20 @@ TEST(mps_parser, good_mps_file_partial_bounds)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(8000., mps.A_values[0][0]);
-  EXPECT_EQ(4000., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(15., mps.A_values[1][0]);
-  EXPECT_EQ(30., mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(8000., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4000., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(15., mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(30., mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(40000., mps.b_values[0]);
   EXPECT_EQ(200., mps.b_values[1]);
@@ -762,20 +848,20 @@ TEST(mps_parser, good_mps_file_bzip2_compressed)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -800,20 +886,20 @@ TEST(mps_parser, good_mps_file_zlib_compressed)
   ASSERT_EQ(int(2), mps.var_names.size());
   EXPECT_EQ("VAR1", mps.var_names[0]);
   EXPECT_EQ("VAR2", mps.var_names[1]);
-  ASSERT_EQ(int(2), mps.A_indices.size());
-  ASSERT_EQ(int(2), mps.A_indices[0].size());
-  EXPECT_EQ(int(0), mps.A_indices[0][0]);
-  EXPECT_EQ(int(1), mps.A_indices[0][1]);
-  ASSERT_EQ(int(2), mps.A_indices[1].size());
-  EXPECT_EQ(int(0), mps.A_indices[1][0]);
-  EXPECT_EQ(int(1), mps.A_indices[1][1]);
-  ASSERT_EQ(int(2), mps.A_values.size());
-  ASSERT_EQ(int(2), mps.A_values[0].size());
-  EXPECT_EQ(3., mps.A_values[0][0]);
-  EXPECT_EQ(4., mps.A_values[0][1]);
-  ASSERT_EQ(int(2), mps.A_values[1].size());
-  EXPECT_EQ(2.7, mps.A_values[1][0]);
-  EXPECT_EQ(10.1, mps.A_values[1][1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(int(0), mps.A_indices[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(int(1), mps.A_indices[mps.A_offsets[1] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets.size() - 1);
+  ASSERT_EQ(int(2), mps.A_offsets[1] - mps.A_offsets[0]);
+  EXPECT_EQ(3., mps.A_values[mps.A_offsets[0] + 0]);
+  EXPECT_EQ(4., mps.A_values[mps.A_offsets[0] + 1]);
+  ASSERT_EQ(int(2), mps.A_offsets[2] - mps.A_offsets[1]);
+  EXPECT_EQ(2.7, mps.A_values[mps.A_offsets[1] + 0]);
+  EXPECT_EQ(10.1, mps.A_values[mps.A_offsets[1] + 1]);
   ASSERT_EQ(int(2), mps.b_values.size());
   EXPECT_EQ(5.4, mps.b_values[0]);
   EXPECT_EQ(4.9, mps.b_values[1]);
@@ -892,4 +978,238 @@ TEST(qps_parser, test_qps_files)
   }
 }
 
+void expect_same_parse(const mps_parser_t<int, double>& expected,
+                       const mps_parser_t<int, double>& actual)
+{
+  EXPECT_EQ(expected.row_names, actual.row_names);
+  EXPECT_EQ(expected.row_types, actual.row_types);
+  EXPECT_EQ(expected.var_names, actual.var_names);
+  EXPECT_EQ(expected.var_types, actual.var_types);
+  EXPECT_EQ(expected.A_offsets, actual.A_offsets);
+  EXPECT_EQ(expected.A_indices, actual.A_indices);
+  EXPECT_EQ(expected.A_values, actual.A_values);
+  EXPECT_EQ(expected.b_values, actual.b_values);
+  EXPECT_EQ(expected.c_values, actual.c_values);
+  EXPECT_EQ(expected.variable_lower_bounds, actual.variable_lower_bounds);
+  EXPECT_EQ(expected.variable_upper_bounds, actual.variable_upper_bounds);
+}
+
+TEST(mps_parser, columns_in_chunks)
+{
+  // A tiny chunk size splits the COLUMNS section into one chunk per hardware thread, so the
+  // chunked path is only taken on machines with several threads
+  const auto& root = cuopt::test::get_rapids_dataset_root_dir();
+  for (const auto& file : {"linear_programming/afiro_original.mps",
+                           "linear_programming/good-mps-1-comments.mps",
+                           "mixed_integer_programming/good-mip-mps-1.mps",
+                           "mixed_integer_programming/good-mip-mps-1-no-mark.mps"}) {
+    mps_data_model_t<int, double> sequential_problem;
+    mps_data_model_t<int, double> chunked_problem;
+    mps_parser_t<int, double> sequential{sequential_problem, root + "/" + file, false};
+    mps_parser_t<int, double> chunked{chunked_problem, root + "/" + file, false, true, 64};
+    expect_same_parse(sequential, chunked);
+  }
+
+  // Errors in any chunk are reported as the sequential parse reports them
+  for (int i = 1; i <= 15; ++i) {
+    const auto file = root + "/linear_programming/bad-mps-" + std::to_string(i) + ".mps";
+    if (!std::filesystem::exists(file)) { continue; }
+    std::string sequential_error;
+    std::string chunked_error;
+    try {
+      mps_data_model_t<int, double> problem;
+      mps_parser_t<int, double> mps{problem, file};
+    } catch (const std::logic_error& e) {
+      sequential_error = e.what();
+    }
+    try {
+      mps_data_model_t<int, double> problem;
+      mps_parser_t<int, double> mps{problem, file, true, true, 1};
+    } catch (const std::logic_error& e) {
+      chunked_error = e.what();
+    }
+    EXPECT_EQ(sequential_error, chunked_error) << file;
+  }
+}
+
+TEST(mps_parser, mapped_file)
+{
+  const auto file =
+    cuopt::test::get_rapids_dataset_root_dir() + "/linear_programming/good-mps-1.mps";
+  std::string content;
+  {
+    std::ifstream stream(file, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+  {
+    mps_file_buffer_t buffer(file);
+    EXPECT_EQ(content, buffer.view());
+  }
+
+  // The mapping is not null terminated, the last line must not be read past the end of the file
+  const auto path = temp_file_path("no_last_line_return.mps");
+  {
+    std::ofstream stream(path, std::ios::binary);
+    stream << content.substr(0, content.find_last_not_of("\r\n") + 1);
+  }
+  mps_data_model_t<int, double> problem;
+  expect_same_parse(read_from_mps("linear_programming/good-mps-1.mps"),
+                    mps_parser_t<int, double>{problem, path});
+  std::filesystem::remove(path);
+
+  const auto empty_path = temp_file_path("empty.mps");
+  std::ofstream(empty_path).close();
+  {
+    mps_file_buffer_t buffer(empty_path);
+    EXPECT_TRUE(buffer.view().empty());
+  }
+  EXPECT_THROW((parse_mps<int, double>(empty_path)), std::logic_error);
+  std::filesystem::remove(empty_path);
+
+  EXPECT_THROW(mps_file_buffer_t(temp_file_path("missing.mps")), std::logic_error);
+}
+
+TEST(mps_parser, without_names)
+{
+  const auto& root = cuopt::test::get_rapids_dataset_root_dir();
+  for (const auto& file : {"linear_programming/good-mps-1.mps",
+                           "linear_programming/good-mps-free-ranges.mps",
+                           "mixed_integer_programming/good-mip-mps-1.mps"}) {
+    const auto with_names    = parse_mps<int, double>(root + "/" + file, false);
+    const auto without_names = parse_mps<int, double>(root + "/" + file, false, false);
+    EXPECT_TRUE(without_names.get_variable_names().empty());
+    EXPECT_TRUE(without_names.get_row_names().empty());
+    EXPECT_EQ(with_names.get_problem_name(), without_names.get_problem_name());
+    EXPECT_EQ(with_names.get_n_variables(), without_names.get_n_variables());
+    EXPECT_EQ(with_names.get_n_constraints(), without_names.get_n_constraints());
+    EXPECT_EQ(with_names.get_constraint_matrix_values(),
+              without_names.get_constraint_matrix_values());
+    EXPECT_EQ(with_names.get_constraint_matrix_indices(),
+              without_names.get_constraint_matrix_indices());
+    EXPECT_EQ(with_names.get_constraint_matrix_offsets(),
+              without_names.get_constraint_matrix_offsets());
+    EXPECT_EQ(with_names.get_objective_coefficients(), without_names.get_objective_coefficients());
+    EXPECT_EQ(with_names.get_variable_lower_bounds(), without_names.get_variable_lower_bounds());
+    EXPECT_EQ(with_names.get_variable_upper_bounds(), without_names.get_variable_upper_bounds());
+    EXPECT_EQ(with_names.get_variable_types(), without_names.get_variable_types());
+    EXPECT_EQ(with_names.get_constraint_lower_bounds(),
+              without_names.get_constraint_lower_bounds());
+    EXPECT_EQ(with_names.get_constraint_upper_bounds(),
+              without_names.get_constraint_upper_bounds());
+  }
+}
+
+TEST(binary_format, write_parse_round_trip)
+{
+  for (const auto& file : {"linear_programming/good-mps-1.mps",
+                           "mixed_integer_programming/good-mip-mps-1.mps",
+                           "quadratic_programming/QP_Test_1.qps"}) {
+    if (!file_exists(file)) { continue; }
+    const auto problem =
+      parse_mps<int, double>(cuopt::test::get_rapids_dataset_root_dir() + "/" + file, false);
+    const auto path = temp_file_path("round_trip.cuoptbin");
+    write_binary(make_view(problem), path);
+    EXPECT_TRUE(is_binary_problem_file(path));
+    expect_same_problem(problem, parse_binary<int, double>(path));
+    std::filesystem::remove(path);
+  }
+}
+
+TEST(binary_format, corrupted_file)
+{
+  const auto problem = parse_mps<int, double>(
+    cuopt::test::get_rapids_dataset_root_dir() + "/linear_programming/good-mps-1.mps", false);
+  const auto path = temp_file_path("corrupted.cuoptbin");
+  write_binary(make_view(problem), path);
+  std::string content;
+  {
+    std::ifstream file(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  auto write_content = [&path](const std::string& data) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), data.size());
+  };
+  // The section table follows the 40 bytes header, the first entry holds the matrix values
+  constexpr size_t first_entry_offset = 40 + 8;
+  uint64_t section_offset;
+  std::memcpy(&section_offset, content.data() + first_entry_offset, sizeof(section_offset));
+
+  write_content(content.substr(0, content.size() / 2));
+  EXPECT_THROW((parse_binary<int, double>(path)), std::logic_error);
+
+  auto misaligned     = content;
+  uint64_t bad_offset = section_offset + 4;
+  std::memcpy(misaligned.data() + first_entry_offset, &bad_offset, sizeof(bad_offset));
+  write_content(misaligned);
+  EXPECT_THROW((parse_binary<int, double>(path)), std::logic_error);
+
+  auto out_of_bounds = content;
+  bad_offset         = content.size();
+  std::memcpy(out_of_bounds.data() + first_entry_offset, &bad_offset, sizeof(bad_offset));
+  write_content(out_of_bounds);
+  EXPECT_THROW((parse_binary<int, double>(path)), std::logic_error);
+
+  std::filesystem::remove(path);
+}
+
+// The MPS writer does not write quadratic objectives, only linear problems are checked
+void expect_mps_writer_round_trip(const std::string& extension)
+{
+  for (const auto& file : {"linear_programming/good-mps-1.mps",
+                           "linear_programming/afiro_original.mps",
+                           "mixed_integer_programming/good-mip-mps-1.mps"}) {
+    if (!file_exists(file)) { continue; }
+    const auto problem =
+      parse_mps<int, double>(cuopt::test::get_rapids_dataset_root_dir() + "/" + file, false);
+    const auto path = temp_file_path("round_trip.mps" + extension);
+    write_mps(make_view(problem), path);
+    expect_same_problem(problem, parse_mps<int, double>(path, false));
+    std::filesystem::remove(path);
+  }
+
+  // Values which need all of their digits to read back exactly
+  const std::vector<double> values{0.1, 2.7000000000000002, 1.0 / 3.0, 1e-17, 123456789.123456789};
+  const std::vector<int> indices{0, 1, 2, 3, 4};
+  const std::vector<int> offsets{0, 5};
+  const std::vector<double> lower_bounds{-1.0 / 7.0, 0, 0, 0, 0};
+  const std::vector<double> upper_bounds{2.0 / 3.0, 1e30, 5.5, 0.30000000000000004, 1};
+  const std::vector<double> constraint_lower_bounds{-std::numeric_limits<double>::infinity()};
+  const std::vector<double> constraint_upper_bounds{0.7};
+  const std::vector<char> variable_types(values.size(), 'C');
+  data_model_view_t<int, double> view;
+  view.set_csr_constraint_matrix(values.data(),
+                                 values.size(),
+                                 indices.data(),
+                                 indices.size(),
+                                 offsets.data(),
+                                 offsets.size());
+  view.set_objective_coefficients(values.data(), values.size());
+  view.set_variable_lower_bounds(lower_bounds.data(), lower_bounds.size());
+  view.set_variable_upper_bounds(upper_bounds.data(), upper_bounds.size());
+  view.set_variable_types(variable_types.data(), variable_types.size());
+  view.set_constraint_lower_bounds(constraint_lower_bounds.data(), constraint_lower_bounds.size());
+  view.set_constraint_upper_bounds(constraint_upper_bounds.data(), constraint_upper_bounds.size());
+  const auto path = temp_file_path("digits.mps" + extension);
+  write_mps(view, path);
+  const auto parsed = parse_mps<int, double>(path, false);
+  EXPECT_EQ(values, parsed.get_constraint_matrix_values());
+  EXPECT_EQ(values, parsed.get_objective_coefficients());
+  EXPECT_EQ(lower_bounds, parsed.get_variable_lower_bounds());
+  EXPECT_EQ(upper_bounds, parsed.get_variable_upper_bounds());
+  EXPECT_EQ(constraint_lower_bounds, parsed.get_constraint_lower_bounds());
+  EXPECT_EQ(constraint_upper_bounds, parsed.get_constraint_upper_bounds());
+  std::filesystem::remove(path);
+}
+
+TEST(mps_writer, round_trip) { expect_mps_writer_round_trip(""); }
+
+#ifdef MPS_PARSER_WITH_ZLIB
+TEST(mps_writer, round_trip_zlib_compressed) { expect_mps_writer_round_trip(".gz"); }
+#endif
+
+#ifdef MPS_PARSER_WITH_BZIP2
+TEST(mps_writer, round_trip_bzip2_compressed) { expect_mps_writer_round_trip(".bz2"); }
+#endif
+
 }  // namespace cuopt::mps_parser
@@ -14,6 +14,7 @@
 #include <barrier/dense_vector.hpp>
 #include <barrier/device_sparse_matrix.cuh>
 #include <barrier/iterative_refinement.hpp>
+#include <barrier/pcg_solver.cuh>
 #include <barrier/sparse_cholesky.cuh>
 #include <barrier/sparse_matrix_kernels.cuh>
 
@@ -31,6 +32,7 @@
 
 #include <utilities/copy_helpers.hpp>
 #include <utilities/cuda_helpers.cuh>
+#include <utilities/instrumentation.hpp>
 #include <utilities/macros.cuh>
 
 #include <numeric>
@@ -319,6 +321,16 @@ class iteration_data_t {
       use_augmented   = !Q_diagonal;
     }
 
+    // PCG needs the symmetric positive definite ADAT system
+    if (settings.barrier_pcg) {
+      if (has_Q && !Q_diagonal) {
+        settings.log.printf("Barrier PCG does not support a non-diagonal Q, using cuDSS\n");
+      } else if (use_augmented) {
+        use_augmented   = false;
+        n_dense_columns = 0;
+      }
+    }
+
     if (use_augmented) {
       settings.log.printf("Linear system               : augmented\n");
     } else {
@@ -398,8 +410,13 @@ class iteration_data_t {
 
     if (settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1) { return; }
     i_t factorization_size = use_augmented ? lp.num_rows + lp.num_cols : lp.num_rows;
-    chol =
-      std::make_unique<sparse_cholesky_cudss_t<i_t, f_t>>(handle_ptr, settings, factorization_size);
+    if (settings.barrier_pcg && !use_augmented) {
+      chol =
+        std::make_unique<sparse_pcg_solver_t<i_t, f_t>>(handle_ptr, settings, factorization_size);
+    } else {
+      chol = std::make_unique<sparse_cholesky_cudss_t<i_t, f_t>>(
+        handle_ptr, settings, factorization_size);
+    }
     chol->set_positive_definite(false);
     if (settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1) { return; }
     // Perform symbolic analysis
@@ -1277,6 +1294,9 @@ class iteration_data_t {
 #endif
 
     // Forward pass again to pick up the dense columns
+    // In hybrid memory mode every factor nonzero is moved between host and device, so columns are
+    // treated as dense at a lower share of the fill
+    const f_t dense_fill_ratio = settings.cudss_hybrid_memory ? 0.002 : 0.01;
     columns_to_remove.reserve(n);
     f_t total_nz_estimate = cumulative_nonzeros[n - 1];
     for (i_t k = 1; k < n; k++) {
@@ -1285,7 +1305,7 @@ class iteration_data_t {
       f_t delta_nz_j  = std::max(static_cast<f_t>(col_nz * col_nz),
                                 cumulative_nonzeros[k] - cumulative_nonzeros[k - 1]);
       const f_t ratio = delta_nz_j / total_nz_estimate;
-      if (ratio > .01) {
+      if (ratio > dense_fill_ratio) {
 #ifdef DEBUG
         settings.log.printf(
           "Column: nz %10d cumulative nz %6.2e estimated delta nz %6.2e percent %.2f col %6d\n",
@@ -3551,7 +3571,8 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
     const i_t iteration_limit = settings.iteration_limit;
 
     while (iter < iteration_limit) {
-      raft::common::nvtx::range fun_scope("Barrier: iteration");
+      CUOPT_NVTX_RANGE(barrier, "iteration");
+      CUOPT_COUNTER_ADD("barrier.iterations", 1);
 
       if (toc(start_time) > settings.time_limit) {
         settings.log.printf("Barrier time limit exceeded\n");
@@ -3795,6 +3816,7 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
 template class barrier_solver_t<int, double>;
 template class sparse_cholesky_base_t<int, double>;
 template class sparse_cholesky_cudss_t<int, double>;
+template class sparse_pcg_solver_t<int, double>;
 template class iteration_data_t<int, double>;
 template class barrier_solver_settings_t<int, double>;
 #endif
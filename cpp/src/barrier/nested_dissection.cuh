@@ -0,0 +1,284 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <barrier/device_sparse_matrix.cuh>
+
+#include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Nested dissection ordering of a symmetric sparsity pattern computed on the GPU
+//
+// Every part of the current level is split at once. A breadth first search from a pseudo
+// peripheral vertex of each part gives its level structure, the median level is the separator,
+// and its vertices without a neighbor in the next level move to the lower half. The searches of
+// all the parts share one frontier, so a level of the dissection costs O(nnz) work per search
+// level instead of one search per part. The dissection stops when the parts are about leaf_size
+// vertices; the separators are ordered after the parts they split
+namespace nested_dissection {
+
+template <typename i_t>
+__global__ void expand_frontier(const i_t* row_start,
+                                const i_t* col,
+                                const i_t* part,
+                                i_t* dist,
+                                const i_t* frontier,
+                                i_t frontier_size,
+                                i_t* next_frontier,
+                                i_t* next_size,
+                                i_t level)
+{
+  const i_t k = blockIdx.x * blockDim.x + threadIdx.x;
+  if (k >= frontier_size) { return; }
+  const i_t v = frontier[k];
+  const i_t p = part[v];
+  for (i_t e = row_start[v]; e < row_start[v + 1]; ++e) {
+    const i_t u = col[e];
+    if (u == v || part[u] != p) { continue; }
+    if (atomicCAS(&dist[u], i_t{-1}, level + 1) == -1) {
+      next_frontier[atomicAdd(next_size, i_t{1})] = u;
+    }
+  }
+}
+
+// Breadth first search from the roots inside the parts. Returns the number of levels
+template <typename i_t, typename f_t>
+i_t search(const device_csr_matrix_t<i_t, f_t>& A,
+           const rmm::device_uvector<i_t>& part,
+           rmm::device_uvector<i_t>& frontier,
+           i_t num_roots,
+           rmm::device_uvector<i_t>& next_frontier,
+           rmm::device_uvector<i_t>& dist,
+           rmm::cuda_stream_view stream)
+{
+  constexpr i_t block_size = 256;
+  rmm::device_scalar<i_t> next_size(0, stream);
+  thrust::fill(rmm::exec_policy(stream), dist.begin(), dist.end(), -1);
+  thrust::for_each(rmm::exec_policy(stream),
+                   frontier.begin(),
+                   frontier.begin() + num_roots,
+                   [dist = dist.data()] __device__(i_t v) { dist[v] = 0; });
+  i_t frontier_size = num_roots;
+  i_t level         = 0;
+  while (frontier_size > 0) {
+    next_size.set_value_to_zero_async(stream);
+    const i_t grid = (frontier_size + block_size - 1) / block_size;
+    expand_frontier<i_t><<<grid, block_size, 0, stream>>>(A.row_start.data(),
+                                                          A.j.data(),
+                                                          part.data(),
+                                                          dist.data(),
+                                                          frontier.data(),
+                                                          frontier_size,
+                                                          next_frontier.data(),
+                                                          next_size.data(),
+                                                          level);
+    RAFT_CUDA_TRY(cudaPeekAtLastError());
+    frontier_size = next_size.value(stream);
+    std::swap(frontier, next_frontier);
+    level++;
+  }
+  return level;
+}
+
+// Collects the vertices of part_key, one per part with a vertex, as the roots of a search
+template <typename i_t>
+i_t select_roots(const rmm::device_uvector<uint64_t>& part_key,
+                 i_t num_parts,
+                 rmm::device_uvector<i_t>& roots,
+                 rmm::cuda_stream_view stream)
+{
+  rmm::device_scalar<i_t> num_roots(0, stream);
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(num_parts),
+                   [part_key  = part_key.data(),
+                    roots     = roots.data(),
+                    num_roots = num_roots.data()] __device__(i_t p) {
+                     const uint64_t key = part_key[p];
+                     if (key != ~0ull) {
+                       roots[atomicAdd(num_roots, i_t{1})] = static_cast<i_t>(key & 0xffffffffull);
+                     }
+                   });
+  return num_roots.value(stream);
+}
+
+}  // namespace nested_dissection
+
+// Returns false when the ordering could not be computed, perm[k] is the vertex eliminated k-th
+template <typename i_t, typename f_t>
+bool gpu_nested_dissection(const device_csr_matrix_t<i_t, f_t>& A,
+                           i_t leaf_size,
+                           std::atomic<int>* halt,
+                           std::vector<int>& perm,
+                           rmm::cuda_stream_view stream)
+{
+  raft::common::nvtx::range fun_scope("Barrier: GPU nested dissection");
+  using namespace nested_dissection;
+  const i_t n = A.m;
+  if (n <= 0) { return false; }
+  i_t depth = 0;
+  while (depth < 24 && (static_cast<int64_t>(leaf_size) << depth) < n) {
+    depth++;
+  }
+  const i_t num_leaves = i_t{1} << depth;
+
+  rmm::device_uvector<i_t> part(n, stream);
+  rmm::device_uvector<i_t> new_part(n, stream);
+  rmm::device_uvector<i_t> dist(n, stream);
+  rmm::device_uvector<i_t> frontier(n, stream);
+  rmm::device_uvector<i_t> next_frontier(n, stream);
+  rmm::device_uvector<uint64_t> order_key(n, stream);
+  rmm::device_uvector<uint64_t> part_key(num_leaves, stream);
+  rmm::device_uvector<uint64_t> level_key(n, stream);
+  rmm::device_uvector<i_t> split_level(num_leaves, stream);
+  thrust::fill(rmm::exec_policy(stream), part.begin(), part.end(), 0);
+
+  for (i_t d = 0; d < depth; ++d) {
+    if (halt != nullptr && *halt == 1) { return false; }
+    const i_t num_parts = i_t{1} << d;
+
+    // Roots: the vertex of smallest index of each part, then the farthest vertex from it
+    thrust::fill(rmm::exec_policy(stream), part_key.begin(), part_key.begin() + num_parts, ~0ull);
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(n),
+                     [part = part.data(), part_key = part_key.data()] __device__(i_t v) {
+                       if (part[v] >= 0) {
+                         atomicMin(reinterpret_cast<unsigned long long*>(&part_key[part[v]]),
+                                   static_cast<unsigned long long>(v));
+                       }
+                     });
+    i_t num_roots = select_roots(part_key, num_parts, frontier, stream);
+    search(A, part, frontier, num_roots, next_frontier, dist, stream);
+
+    thrust::fill(rmm::exec_policy(stream), part_key.begin(), part_key.begin() + num_parts, ~0ull);
+    thrust::for_each(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<i_t>(0),
+      thrust::make_counting_iterator<i_t>(n),
+      [part = part.data(), dist = dist.data(), part_key = part_key.data()] __device__(i_t v) {
+        if (part[v] >= 0 && dist[v] >= 0) {
+          // The farthest vertex has the smallest key
+          const uint64_t key = (static_cast<uint64_t>(INT_MAX - dist[v]) << 32) | v;
+          atomicMin(reinterpret_cast<unsigned long long*>(&part_key[part[v]]),
+                    static_cast<unsigned long long>(key));
+        }
+      });
+    num_roots = select_roots(part_key, num_parts, frontier, stream);
+    search(A, part, frontier, num_roots, next_frontier, dist, stream);
+
+    // The median level of each part splits it, the unreached vertices sort last
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<i_t>(0),
+                      thrust::make_counting_iterator<i_t>(n),
+                      level_key.begin(),
+                      [part = part.data(), dist = dist.data()] __device__(i_t v) {
+                        if (part[v] < 0) { return ~0ull; }
+                        const uint32_t level = dist[v] >= 0 ? dist[v] : INT_MAX;
+                        return (static_cast<uint64_t>(part[v]) << 32) | level;
+                      });
+    thrust::sort(rmm::exec_policy(stream), level_key.begin(), level_key.end());
+    thrust::for_each(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<i_t>(0),
+      thrust::make_counting_iterator<i_t>(num_parts),
+      [level_key   = level_key.data(),
+       n,
+       split_level = split_level.data()] __device__(i_t p) {
+        const uint64_t* begin = thrust::lower_bound(
+          thrust::seq, level_key, level_key + n, static_cast<uint64_t>(p) << 32);
+        const uint64_t* end = thrust::lower_bound(
+          thrust::seq, level_key, level_key + n, static_cast<uint64_t>(p + 1) << 32);
+        split_level[p] =
+          end > begin ? static_cast<i_t>(begin[(end - begin) / 2] & 0xffffffffull) : INT_MAX;
+      });
+
+    // Lower half 2p, upper half 2p + 1, separator ordered after both
+    const i_t levels_below = depth - d;
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(n),
+                     [row_start   = A.row_start.data(),
+                      col         = A.j.data(),
+                      part        = part.data(),
+                      new_part    = new_part.data(),
+                      dist        = dist.data(),
+                      split_level = split_level.data(),
+                      order_key   = order_key.data(),
+                      levels_below] __device__(i_t v) {
+                       const i_t p = part[v];
+                       if (p < 0) {
+                         new_part[v] = -1;
+                         return;
+                       }
+                       const i_t s     = split_level[p];
+                       const i_t level = dist[v];
+                       if (level < 0 || level > s) {
+                         new_part[v] = 2 * p + 1;
+                         return;
+                       }
+                       bool separates = false;
+                       if (level == s) {
+                         for (i_t e = row_start[v]; e < row_start[v + 1]; ++e) {
+                           const i_t u = col[e];
+                           if (part[u] == p && dist[u] == s + 1) {
+                             separates = true;
+                             break;
+                           }
+                         }
+                       }
+                       if (separates) {
+                         new_part[v] = -1;
+                         // After the leaves of the part, and after the deeper separators that
+                         // end at the same leaf
+                         const uint64_t range_end = static_cast<uint64_t>(p + 1) << levels_below;
+                         order_key[v]             = (range_end << 8) | levels_below;
+                       } else {
+                         new_part[v] = 2 * p;
+                       }
+                     });
+    std::swap(part, new_part);
+  }
+
+  // The vertices left in the leaves are ordered by leaf, then by index
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n),
+                   [part = part.data(), order_key = order_key.data()] __device__(i_t v) {
+                     if (part[v] >= 0) { order_key[v] = static_cast<uint64_t>(part[v] + 1) << 8; }
+                   });
+  rmm::device_uvector<i_t> d_perm(n, stream);
+  thrust::sequence(rmm::exec_policy(stream), d_perm.begin(), d_perm.end());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), order_key.begin(), order_key.end(), d_perm.begin());
+  perm.resize(n);
+  raft::copy(perm.data(), d_perm.data(), n, stream);
+  stream.synchronize();
+  return true;
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex
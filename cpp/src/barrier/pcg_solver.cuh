@@ -0,0 +1,256 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <barrier/dense_vector.hpp>
+#include <barrier/device_sparse_matrix.cuh>
+#include <barrier/sparse_cholesky.cuh>
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/types.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/inner_product.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cmath>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Device kernels of the PCG solver below, kept as free functions so their lambdas are not defined
+// inside private member functions
+
+// inv_diagonal = 1 / diag(A), 1 where the diagonal is not positive
+template <typename i_t, typename f_t>
+void pcg_inverse_diagonal(const device_csr_matrix_t<i_t, f_t>& A,
+                          f_t* inv_diagonal,
+                          i_t n,
+                          rmm::cuda_stream_view stream)
+{
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n),
+                   [row_start = A.row_start.data(),
+                    j         = A.j.data(),
+                    values    = A.x.data(),
+                    inv_diagonal] __device__(i_t row) {
+                     f_t diagonal = 0.0;
+                     for (i_t p = row_start[row]; p < row_start[row + 1]; ++p) {
+                       if (j[p] == row) { diagonal += values[p]; }
+                     }
+                     inv_diagonal[row] = diagonal > 0.0 ? 1.0 / diagonal : 1.0;
+                   });
+}
+
+// y = A x, one thread per row
+template <typename i_t, typename f_t>
+void pcg_csr_multiply(
+  const device_csr_matrix_t<i_t, f_t>& A, const f_t* x, f_t* y, i_t n, rmm::cuda_stream_view stream)
+{
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n),
+                   [row_start = A.row_start.data(),
+                    j         = A.j.data(),
+                    values    = A.x.data(),
+                    x,
+                    y] __device__(i_t row) {
+                     f_t sum = 0.0;
+                     for (i_t p = row_start[row]; p < row_start[row + 1]; ++p) {
+                       sum += values[p] * x[j[p]];
+                     }
+                     y[row] = sum;
+                   });
+}
+
+// y += alpha x
+template <typename i_t, typename f_t>
+void pcg_axpy(f_t alpha, const f_t* x, f_t* y, i_t n, rmm::cuda_stream_view stream)
+{
+  thrust::transform(rmm::exec_policy(stream),
+                    x,
+                    x + n,
+                    y,
+                    y,
+                    [alpha] __device__(f_t xi, f_t yi) { return yi + alpha * xi; });
+}
+
+// y = x + beta y
+template <typename i_t, typename f_t>
+void pcg_xpby(const f_t* x, f_t beta, f_t* y, i_t n, rmm::cuda_stream_view stream)
+{
+  thrust::transform(rmm::exec_policy(stream),
+                    x,
+                    x + n,
+                    y,
+                    y,
+                    [beta] __device__(f_t xi, f_t yi) { return xi + beta * yi; });
+}
+
+// z = r .* scale
+template <typename i_t, typename f_t>
+void pcg_scale(const f_t* r, const f_t* scale, f_t* z, i_t n, rmm::cuda_stream_view stream)
+{
+  thrust::transform(rmm::exec_policy(stream),
+                    r,
+                    r + n,
+                    scale,
+                    z,
+                    [] __device__(f_t ri, f_t si) { return ri * si; });
+}
+
+// Matrix-free stand-in for the cuDSS Cholesky on the normal equations ADAT
+// Nothing is factorized: factorize only builds a Jacobi preconditioner from the diagonal and solve
+// runs preconditioned conjugate gradient with the current ADAT, entirely on the GPU. Memory stays
+// at the size of ADAT, with none of the Cholesky fill-in, at the price of inexact directions
+// Only valid for the symmetric positive definite ADAT system, not for the augmented system
+template <typename i_t, typename f_t>
+class sparse_pcg_solver_t : public sparse_cholesky_base_t<i_t, f_t> {
+ public:
+  sparse_pcg_solver_t(raft::handle_t const* handle_ptr,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      i_t size)
+    : handle_ptr_(handle_ptr),
+      settings_(settings),
+      n_(size),
+      inv_diagonal_(size, handle_ptr->get_stream()),
+      r_(size, handle_ptr->get_stream()),
+      z_(size, handle_ptr->get_stream()),
+      p_(size, handle_ptr->get_stream()),
+      Ap_(size, handle_ptr->get_stream())
+  {
+    settings_.log.printf("Linear solver               : PCG (Jacobi preconditioner)\n");
+  }
+
+  i_t analyze(const csc_matrix_t<i_t, f_t>& A_in) override { return -1; }
+  i_t factorize(const csc_matrix_t<i_t, f_t>& A_in) override { return -1; }
+
+  i_t analyze(device_csr_matrix_t<i_t, f_t>& A_in) override
+  {
+    if (A_in.m != n_) {
+      settings_.log.printf("PCG analyze input does not match size %d != %d\n", A_in.m, n_);
+      return -1;
+    }
+    return 0;
+  }
+
+  i_t factorize(device_csr_matrix_t<i_t, f_t>& A_in) override
+  {
+    raft::common::nvtx::range fun_scope("Barrier: PCG preconditioner");
+    if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+      return CONCURRENT_HALT_RETURN;
+    }
+    A_ = &A_in;
+    pcg_inverse_diagonal<i_t, f_t>(A_in, inv_diagonal_.data(), n_, stream());
+    RAFT_CHECK_CUDA(stream());
+    return 0;
+  }
+
+  i_t solve(const dense_vector_t<i_t, f_t>& b, dense_vector_t<i_t, f_t>& x) override
+  {
+    rmm::device_uvector<f_t> d_b(n_, stream());
+    rmm::device_uvector<f_t> d_x(n_, stream());
+    raft::copy(d_b.data(), b.data(), n_, stream());
+    i_t status = solve(d_b, d_x);
+    x.resize(n_);
+    raft::copy(x.data(), d_x.data(), n_, stream());
+    stream().synchronize();
+    return status;
+  }
+
+  // Solves ADAT x = b from x = 0 until the residual is below the relative tolerance
+  i_t solve(rmm::device_uvector<f_t>& b, rmm::device_uvector<f_t>& x) override
+  {
+    raft::common::nvtx::range fun_scope("Barrier: PCG solve");
+    if (A_ == nullptr) { return -1; }
+    auto policy = rmm::exec_policy(stream());
+    x.resize(n_, stream());
+    thrust::fill(policy, x.begin(), x.end(), f_t(0));
+
+    // r = b, z = M^-1 r, p = z
+    raft::copy(r_.data(), b.data(), n_, stream());
+    apply_preconditioner();
+    raft::copy(p_.data(), z_.data(), n_, stream());
+
+    const f_t norm_b = std::sqrt(dot(b, b));
+    if (norm_b == 0.0) { return 0; }
+    const f_t tolerance = settings_.barrier_pcg_tolerance * norm_b;
+    f_t rz              = dot(r_, z_);
+    f_t norm_r          = norm_b;
+    i_t iter            = 0;
+    const i_t max_iter  = settings_.barrier_pcg_iteration_limit;
+    while (norm_r > tolerance && iter < max_iter) {
+      if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+        return CONCURRENT_HALT_RETURN;
+      }
+      adat_multiply(p_, Ap_);
+      const f_t pAp = dot(p_, Ap_);
+      if (!(pAp > 0.0)) { break; }
+      const f_t alpha = rz / pAp;
+      // x += alpha p, r -= alpha Ap
+      axpy(alpha, p_, x);
+      axpy(-alpha, Ap_, r_);
+      norm_r = std::sqrt(dot(r_, r_));
+      apply_preconditioner();
+      const f_t rz_new = dot(r_, z_);
+      const f_t beta   = rz_new / rz;
+      rz               = rz_new;
+      // p = z + beta p
+      pcg_xpby<i_t, f_t>(z_.data(), beta, p_.data(), n_, stream());
+      iter++;
+    }
+    settings_.log.debug("PCG iterations %d relative residual %.2e\n", iter, norm_r / norm_b);
+    return 0;
+  }
+
+  void set_positive_definite(bool positive_definite) override {}
+
+ private:
+  rmm::cuda_stream_view stream() const { return handle_ptr_->get_stream(); }
+
+  f_t dot(const rmm::device_uvector<f_t>& a, const rmm::device_uvector<f_t>& b) const
+  {
+    return thrust::inner_product(
+      rmm::exec_policy(stream()), a.begin(), a.begin() + n_, b.begin(), f_t(0));
+  }
+
+  void axpy(f_t alpha, const rmm::device_uvector<f_t>& x, rmm::device_uvector<f_t>& y) const
+  {
+    pcg_axpy<i_t, f_t>(alpha, x.data(), y.data(), n_, stream());
+  }
+
+  void apply_preconditioner()
+  {
+    pcg_scale<i_t, f_t>(r_.data(), inv_diagonal_.data(), z_.data(), n_, stream());
+  }
+
+  void adat_multiply(const rmm::device_uvector<f_t>& x, rmm::device_uvector<f_t>& y) const
+  {
+    pcg_csr_multiply<i_t, f_t>(*A_, x.data(), y.data(), n_, stream());
+  }
+
+  raft::handle_t const* handle_ptr_;
+  const simplex_solver_settings_t<i_t, f_t>& settings_;
+  i_t n_;
+  const device_csr_matrix_t<i_t, f_t>* A_{nullptr};
+  rmm::device_uvector<f_t> inv_diagonal_;
+  rmm::device_uvector<f_t> r_;
+  rmm::device_uvector<f_t> z_;
+  rmm::device_uvector<f_t> p_;
+  rmm::device_uvector<f_t> Ap_;
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
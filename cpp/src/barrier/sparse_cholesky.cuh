@@ -8,6 +8,8 @@
 
 #include <barrier/dense_vector.hpp>
 #include <barrier/device_sparse_matrix.cuh>
+#include <barrier/iterative_refinement.hpp>
+#include <barrier/nested_dissection.cuh>
 
 #include <dual_simplex/simplex_solver_settings.hpp>
 #include <dual_simplex/sparse_matrix.hpp>
@@ -15,9 +17,29 @@
 
 #include <cuda_runtime.h>
 #include <utilities/driver_helpers.cuh>
+#include <utilities/hashing.hpp>
+#include <utilities/scope_guard.hpp>
 
 #include <raft/core/nvtx.hpp>
 
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
 #include "cudss.h"
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -131,6 +153,187 @@ std::size_t compute_hash(const f_t* arr, size_t size)
   return seed;
 }
 
+template <typename i_t>
+uint64_t position_dependent_hash(const i_t* entries, i_t size, rmm::cuda_stream_view stream)
+{
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(size),
+    [entries] __device__(i_t k) -> uint64_t {
+      return (static_cast<uint64_t>(detail::compute_hash(k)) << 32) ^
+             detail::compute_hash(entries[k]);
+    },
+    uint64_t{0},
+    thrust::plus<uint64_t>{});
+}
+
+// Hash of the sparsity pattern (row_start and column indices) of a device CSR matrix, computed on
+// the GPU so the pattern never leaves the device
+template <typename i_t, typename f_t>
+uint64_t sparsity_pattern_hash(const device_csr_matrix_t<i_t, f_t>& A, i_t nnz)
+{
+  auto stream                = A.row_start.stream();
+  const uint64_t row_hash    = position_dependent_hash(A.row_start.data(), A.m + 1, stream);
+  const uint64_t column_hash = position_dependent_hash(A.j.data(), nnz, stream);
+  return row_hash ^ (column_hash * 0x9e3779b97f4a7c15ull);
+}
+
+// Fill-reducing orderings computed by cuDSS, shared by every barrier solve of the process
+// Barrier solves on matrices with the same sparsity pattern (MIP re-solves, rolling horizon LPs)
+// reuse the ordering instead of running the reordering phase again. A hash collision only costs
+// fill-in: any permutation gives a correct factorization
+//
+// The solves of a batch of LPs with the same structure start together, so the first one to miss
+// computes the ordering while the others wait for it instead of running the reordering too
+class cudss_ordering_cache_t {
+ public:
+  struct key_t {
+    uint64_t pattern_hash;
+    int64_t n;
+    int64_t nnz;
+    int algorithm;  // 0 cuDSS default, 1 AMD, 2 GPU nested dissection
+    bool operator==(const key_t& other) const
+    {
+      return pattern_hash == other.pattern_hash && n == other.n && nnz == other.nnz &&
+             algorithm == other.algorithm;
+    }
+  };
+
+  enum class lookup_t {
+    hit,   // ordering holds the cached ordering
+    miss,  // the caller computes the ordering of key and must then call insert or abandon
+    busy   // another solve still computes it, the caller computes its own without caching it
+  };
+
+  // Waits for another solve computing the ordering of key until halt is set, at most
+  // max_ordering_wait seconds or time_limit when sooner
+  static lookup_t find(const key_t& key,
+                       std::vector<int>& ordering,
+                       const std::atomic<int>* halt,
+                       double time_limit)
+  {
+    constexpr auto poll_interval = std::chrono::milliseconds(100);
+    const double max_wait        = std::min(time_limit, max_ordering_wait);
+    std::unique_lock<std::mutex> lock(mutex());
+    auto& in_progress = pending();
+    auto computed     = [&] {
+      return std::find(in_progress.begin(), in_progress.end(), key) == in_progress.end();
+    };
+    const double start_wait = tic();
+    while (!ready().wait_for(lock, poll_interval, computed)) {
+      if ((halt != nullptr && *halt == 1) || toc(start_wait) > max_wait) {
+        return lookup_t::busy;
+      }
+    }
+    auto& cache = entries();
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+      if (it->first == key) {
+        ordering = it->second;
+        // Most recently used first
+        cache.splice(cache.begin(), cache, it);
+        return lookup_t::hit;
+      }
+    }
+    in_progress.push_back(key);
+    return lookup_t::miss;
+  }
+
+  static void insert(const key_t& key, std::vector<int> ordering)
+  {
+    {
+      std::lock_guard<std::mutex> guard(mutex());
+      auto& cache = entries();
+      cache.emplace_front(key, std::move(ordering));
+      if (cache.size() > max_entries) { cache.pop_back(); }
+      remove_pending(key);
+    }
+    ready().notify_all();
+  }
+
+  // The ordering of key could not be computed, e.g., the solve was halted: the next waiting solve
+  // computes it
+  static void abandon(const key_t& key)
+  {
+    {
+      std::lock_guard<std::mutex> guard(mutex());
+      remove_pending(key);
+    }
+    ready().notify_all();
+  }
+
+ private:
+  static constexpr size_t max_entries = 8;
+  // Past this wait, computing the ordering again is cheaper than the risk of waiting on a stuck
+  // solve
+  static constexpr double max_ordering_wait = 30.0;
+
+  static void remove_pending(const key_t& key)
+  {
+    auto& in_progress = pending();
+    auto it           = std::find(in_progress.begin(), in_progress.end(), key);
+    if (it != in_progress.end()) { in_progress.erase(it); }
+  }
+
+  static std::condition_variable& ready()
+  {
+    static std::condition_variable ordering_ready;
+    return ordering_ready;
+  }
+
+  // Keys whose ordering is being computed
+  static std::vector<key_t>& pending()
+  {
+    static std::vector<key_t> in_progress;
+    return in_progress;
+  }
+
+  static std::mutex& mutex()
+  {
+    static std::mutex cache_mutex;
+    return cache_mutex;
+  }
+
+  static std::list<std::pair<key_t, std::vector<int>>>& entries()
+  {
+    static std::list<std::pair<key_t, std::vector<int>>> cache;
+    return cache;
+  }
+};
+
+// Copies a device array to another floating point precision
+template <typename from_t, typename to_t>
+void convert_precision(const from_t* in, to_t* out, size_t size, cudaStream_t stream)
+{
+  thrust::transform(rmm::exec_policy(stream), in, in + size, out, [] __device__(from_t value) {
+    return static_cast<to_t>(value);
+  });
+}
+
+// y = alpha * A * x + beta * y for a square device CSR matrix, one thread per row
+template <typename i_t, typename f_t>
+void cholesky_csr_multiply(f_t alpha,
+                           const device_csr_matrix_t<i_t, f_t>& A,
+                           const f_t* x,
+                           f_t beta,
+                           f_t* y,
+                           cudaStream_t stream)
+{
+  const i_t* row_start = A.row_start.data();
+  const i_t* j         = A.j.data();
+  const f_t* values    = A.x.data();
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(A.m),
+                   [row_start, j, values, x, y, alpha, beta] __device__(i_t row) {
+                     f_t sum = 0.0;
+                     for (i_t p = row_start[row]; p < row_start[row + 1]; ++p) {
+                       sum += values[p] * x[j[p]];
+                     }
+                     y[row] = alpha * sum + beta * y[row];
+                   });
+}
+
 template <typename i_t, typename f_t>
 class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
  public:
@@ -143,6 +346,9 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       first_factor(true),
       positive_definite(true),
       A_created(false),
+      mixed_precision(settings.barrier_mixed_precision && std::is_same_v<f_t, double>),
+      fp64_requested(false),
+      factored_matrix(nullptr),
       settings_(settings),
       stream(handle_ptr->get_stream())
   {
@@ -239,10 +445,15 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
                reinterpret_cast<decltype(::cuGetErrorString)*>(cuGetErrorString_func));
     }
 
-    auto cudss_device_idx   = handle_ptr_->get_device();
-    auto cudss_device_count = 1;
-    CUDSS_CALL_AND_CHECK_EXIT(
-      cudssCreateMg(&handle, cudss_device_count, &cudss_device_idx), status, "cudssCreateMg");
+    std::vector<int> cudss_device_ids = settings_.barrier_device_ids;
+    if (cudss_device_ids.empty()) { cudss_device_ids.push_back(handle_ptr_->get_device()); }
+    int cudss_device_count = static_cast<int>(cudss_device_ids.size());
+    if (cudss_device_count > 1) {
+      settings.log.printf("cuDSS devices               : %d\n", cudss_device_count);
+    }
+    CUDSS_CALL_AND_CHECK_EXIT(cudssCreateMg(&handle, cudss_device_count, cudss_device_ids.data()),
+                              status,
+                              "cudssCreateMg");
 
     CUDSS_CALL_AND_CHECK_EXIT(cudssSetStream(handle, stream), status, "cudaStreamCreate");
 
@@ -250,8 +461,11 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
     mem_handler.device_alloc = cudss_device_alloc<rmm::mr::device_memory_resource>;
     mem_handler.device_free  = cudss_device_dealloc<rmm::mr::device_memory_resource>;
 
-    CUDSS_CALL_AND_CHECK_EXIT(
-      cudssSetDeviceMemHandler(handle, &mem_handler), status, "cudssSetDeviceMemHandler");
+    // The workspace resource belongs to the handle device, let cuDSS allocate on the others
+    if (cudss_device_count == 1) {
+      CUDSS_CALL_AND_CHECK_EXIT(
+        cudssSetDeviceMemHandler(handle, &mem_handler), status, "cudssSetDeviceMemHandler");
+    }
 
     const char* cudss_mt_lib_file = nullptr;
     char* env_value               = std::getenv("CUDSS_THREADING_LIB");
@@ -271,7 +485,10 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
     CUDSS_CALL_AND_CHECK_EXIT(cudssDataCreate(handle, &solverData), status, "cudssDataCreate");
 
     CUDSS_CALL_AND_CHECK_EXIT(
-      cudssConfigSet(solverConfig, CUDSS_CONFIG_DEVICE_INDICES, &cudss_device_idx, sizeof(int)),
+      cudssConfigSet(solverConfig,
+                     CUDSS_CONFIG_DEVICE_INDICES,
+                     cudss_device_ids.data(),
+                     cudss_device_count * sizeof(int)),
       status,
       "cudssConfigSet for device indices");
 
@@ -302,6 +519,21 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
     }
 #endif
 
+    // Hybrid memory mode keeps the factors in host memory and streams them through the device,
+    // trading factorization speed for problems whose fill-in does not fit on the GPU
+    if (settings_.cudss_hybrid_memory) {
+      if (cudss_device_count == 1) {
+        settings_.log.printf("cuDSS memory mode           : hybrid\n");
+        int32_t hybrid_mode = 1;
+        CUDSS_CALL_AND_CHECK_EXIT(
+          cudssConfigSet(solverConfig, CUDSS_CONFIG_HYBRID_MODE, &hybrid_mode, sizeof(int32_t)),
+          status,
+          "cudssConfigSet for hybrid mode");
+      } else {
+        settings_.log.printf("cuDSS hybrid memory mode is not used with multiple GPUs\n");
+      }
+    }
+
 #if USE_ITERATIVE_REFINEMENT
     int32_t ir_n_steps = 2;
     CUDSS_CALL_AND_CHECK_EXIT(
@@ -340,6 +572,29 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       cudssMatrixCreateDn(&cudss_x, n, 1, ldx, x_values_d, CUDA_R_64F, CUDSS_LAYOUT_COL_MAJOR),
       status,
       "cudssMatrixCreateDn for x");
+
+    // Mixed precision factors ADAT in FP32, so the right-hand side and solution given to cuDSS are
+    // FP32 as well
+    csr_values_fp32_d = nullptr;
+    x_values_fp32_d   = nullptr;
+    b_values_fp32_d   = nullptr;
+    if (mixed_precision) {
+      settings_.log.printf("cuDSS factor precision      : FP32 with FP64 refinement\n");
+      CUDA_CALL_AND_CHECK_EXIT(cudaMallocAsync(&x_values_fp32_d, n * sizeof(float), stream),
+                               "cudaMalloc for x_values_fp32");
+      CUDA_CALL_AND_CHECK_EXIT(cudaMallocAsync(&b_values_fp32_d, n * sizeof(float), stream),
+                               "cudaMalloc for b_values_fp32");
+      CUDSS_CALL_AND_CHECK_EXIT(
+        cudssMatrixCreateDn(
+          &cudss_b_fp32, n, 1, ldb, b_values_fp32_d, CUDA_R_32F, CUDSS_LAYOUT_COL_MAJOR),
+        status,
+        "cudssMatrixCreateDn for b_fp32");
+      CUDSS_CALL_AND_CHECK_EXIT(
+        cudssMatrixCreateDn(
+          &cudss_x_fp32, n, 1, ldx, x_values_fp32_d, CUDA_R_32F, CUDSS_LAYOUT_COL_MAJOR),
+        status,
+        "cudssMatrixCreateDn for x_fp32");
+    }
     handle_ptr_->get_stream().synchronize();
   }
 
@@ -351,6 +606,15 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
 
     cudaFreeAsync(x_values_d, stream);
     cudaFreeAsync(b_values_d, stream);
+    if (x_values_fp32_d != nullptr) {
+      cudaFreeAsync(csr_values_fp32_d, stream);
+      cudaFreeAsync(x_values_fp32_d, stream);
+      cudaFreeAsync(b_values_fp32_d, stream);
+      CUDSS_CALL_AND_CHECK_EXIT(
+        cudssMatrixDestroy(cudss_x_fp32), status, "cudssMatrixDestroy for cudss_x_fp32");
+      CUDSS_CALL_AND_CHECK_EXIT(
+        cudssMatrixDestroy(cudss_b_fp32), status, "cudssMatrixDestroy for cudss_b_fp32");
+    }
     if (A_created) {
       CUDSS_CALL_AND_CHECK_EXIT(cudssMatrixDestroy(A), status, "cudssMatrixDestroy for A");
     }
@@ -398,9 +662,14 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
     const f_t density = static_cast<f_t>(nnz) / (static_cast<f_t>(n) * static_cast<f_t>(n));
 
     // skip reordering if matrix diagonal
-    if (first_factor &&
-        ((settings_.ordering == -1 && density >= 0.05 && nnz > n) || settings_.ordering == 1) &&
-        n > 1) {
+    const bool use_amd =
+      ((settings_.ordering == -1 && density >= 0.05 && nnz > n) || settings_.ordering == 1) &&
+      n > 1;
+    const bool use_nested_dissection = settings_.ordering == 2 && n > 1;
+    if (first_factor && use_nested_dissection) {
+      settings_.log.printf("Reordering algorithm        : GPU nested dissection\n");
+    }
+    if (first_factor && use_amd) {
       settings_.log.printf("Reordering algorithm        : AMD\n");
       // Tell cuDSS to use AMD
       cudssAlgType_t reorder_alg = CUDSS_ALG_3;
@@ -411,9 +680,18 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
         "cudssConfigSet for reordering alg");
     }
 
-    if (!first_factor) {
+    // A also exists before the first factorization when a failed FP32 factorization is redone
+    if (A_created) {
       raft::common::nvtx::range fun_scope("Barrier: cuDSS Analyze : Destroy");
       CUDSS_CALL_AND_CHECK(cudssMatrixDestroy(A), status, "cudssMatrixDestroy for A");
+      A_created = false;
+    }
+
+    if (mixed_precision) {
+      cudaFreeAsync(csr_values_fp32_d, stream);
+      CUDA_CALL_AND_CHECK(cudaMallocAsync(&csr_values_fp32_d, nnz * sizeof(float), stream),
+                          "cudaMalloc for csr_values_fp32");
+      convert_precision(Arow.x.data(), csr_values_fp32_d, nnz, stream);
     }
 
     {
@@ -426,9 +704,10 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
                              Arow.row_start.data(),
                              nullptr,
                              Arow.j.data(),
-                             Arow.x.data(),
+                             mixed_precision ? static_cast<void*>(csr_values_fp32_d)
+                                             : static_cast<void*>(Arow.x.data()),
                              CUDA_R_32I,
-                             CUDA_R_64F,
+                             mixed_precision ? CUDA_R_32F : CUDA_R_64F,
                              positive_definite ? CUDSS_MTYPE_SPD : CUDSS_MTYPE_SYMMETRIC,
                              CUDSS_MVIEW_FULL,
                              CUDSS_BASE_ZERO),
@@ -437,14 +716,64 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       A_created = true;
     }
 
+    // Reuse the ordering of an earlier solve with the same sparsity pattern
+    cudss_ordering_cache_t::key_t ordering_key{};
+    std::vector<int> ordering;
+    bool ordering_cached = false;
+    bool ordering_owned  = false;  // other solves wait for this one to compute the ordering
+    if (first_factor) {
+      const int algorithm = use_nested_dissection ? 2 : (use_amd ? 1 : 0);
+      ordering_key        = {sparsity_pattern_hash(Arow, nnz), n, nnz, algorithm};
+      const auto lookup = cudss_ordering_cache_t::find(
+        ordering_key, ordering, settings_.concurrent_halt, settings_.time_limit);
+      if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+        if (lookup == cudss_ordering_cache_t::lookup_t::miss) {
+          cudss_ordering_cache_t::abandon(ordering_key);
+        }
+        return CONCURRENT_HALT_RETURN;
+      }
+      ordering_cached = lookup == cudss_ordering_cache_t::lookup_t::hit;
+      ordering_owned  = lookup == cudss_ordering_cache_t::lookup_t::miss;
+    }
+    cuopt::scope_guard release_ordering([&]() {
+      if (ordering_owned) { cudss_ordering_cache_t::abandon(ordering_key); }
+    });
+    if (first_factor && !ordering_cached && use_nested_dissection) {
+      // Leaves of this size are small enough for the dense leaf factorizations of cuDSS
+      constexpr i_t nested_dissection_leaf_size = 64;
+      f_t start_ordering                        = tic();
+      if (!gpu_nested_dissection(Arow,
+                                 nested_dissection_leaf_size,
+                                 settings_.concurrent_halt,
+                                 ordering,
+                                 Arow.row_start.stream())) {
+        return CONCURRENT_HALT_RETURN;
+      }
+      settings_.log.printf("Nested dissection time      : %.2fs\n", toc(start_ordering));
+      if (ordering_owned) {
+        cudss_ordering_cache_t::insert(ordering_key, ordering);
+        ordering_owned = false;
+      }
+    }
+    const bool user_ordering = first_factor && !ordering.empty();
+    if (user_ordering) {
+      if (ordering_cached) {
+        settings_.log.printf("Reordering                  : reused from a previous solve\n");
+      }
+      CUDSS_CALL_AND_CHECK(
+        cudssDataSet(handle, solverData, CUDSS_DATA_USER_PERM, ordering.data(), n * sizeof(int)),
+        status,
+        "cudssDataSet for user permutation");
+    }
+
     // Perform symbolic analysis
     f_t start_symbolic = tic();
     f_t start_symbolic_factor;
 
     {
       raft::common::nvtx::range fun_scope("Barrier: cuDSS Analyze : CUDSS_PHASE_ANALYSIS");
-      status =
-        cudssExecute(handle, CUDSS_PHASE_REORDERING, solverConfig, solverData, A, cudss_x, cudss_b);
+      status = cudssExecute(
+        handle, CUDSS_PHASE_REORDERING, solverConfig, solverData, A, dense_x(), dense_b());
       if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
         return CONCURRENT_HALT_RETURN;
       }
@@ -457,10 +786,29 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       }
       f_t reordering_time = toc(start_symbolic);
       settings_.log.printf("Reordering time             : %.2fs\n", reordering_time);
+      if (first_factor && !user_ordering && ordering_owned) {
+        ordering.resize(n);
+        size_t ordering_size = 0;
+        if (cudssDataGet(handle,
+                         solverData,
+                         CUDSS_DATA_PERM_REORDER_ROW,
+                         ordering.data(),
+                         n * sizeof(int),
+                         &ordering_size) == CUDSS_STATUS_SUCCESS &&
+            ordering_size == n * sizeof(int)) {
+          cudss_ordering_cache_t::insert(ordering_key, std::move(ordering));
+          ordering_owned = false;
+        }
+      }
       start_symbolic_factor = tic();
 
-      status = cudssExecute(
-        handle, CUDSS_PHASE_SYMBOLIC_FACTORIZATION, solverConfig, solverData, A, cudss_x, cudss_b);
+      status = cudssExecute(handle,
+                            CUDSS_PHASE_SYMBOLIC_FACTORIZATION,
+                            solverConfig,
+                            solverData,
+                            A,
+                            dense_x(),
+                            dense_b());
       if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
         return CONCURRENT_HALT_RETURN;
       }
@@ -483,6 +831,19 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       status,
       "cudssDataGet for LU_NNZ");
     settings_.log.printf("Symbolic nonzeros in factor : %.2e\n", static_cast<f_t>(lu_nz) / 2.0);
+    if (settings_.cudss_hybrid_memory) {
+      int64_t hybrid_device_memory = 0;
+      CUDSS_CALL_AND_CHECK(cudssDataGet(handle,
+                                        solverData,
+                                        CUDSS_DATA_HYBRID_DEVICE_MEMORY_MIN,
+                                        &hybrid_device_memory,
+                                        sizeof(int64_t),
+                                        &size_written),
+                           status,
+                           "cudssDataGet for HYBRID_DEVICE_MEMORY_MIN");
+      settings_.log.printf("Hybrid min device memory    : %.2f GB\n",
+                           static_cast<f_t>(hybrid_device_memory) / 1e9);
+    }
     // TODO: Is there any way to get nonzeros in the factors?
     // TODO: Is there any way to get flops for the factorization?
     RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
@@ -513,12 +874,26 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       return -1;
     }
 
-    CUDSS_CALL_AND_CHECK(
-      cudssMatrixSetValues(A, Arow.x.data()), status, "cudssMatrixSetValues for A");
+    // The FP32 factors no longer give accurate solves: factor in FP64 for the rest of the solve
+    if (mixed_precision && fp64_requested) {
+      settings_.log.printf("Refinement of the FP32 factors stalled. Factorizing in FP64\n");
+      i_t analyze_status = switch_to_fp64(Arow);
+      if (analyze_status != 0) { return analyze_status; }
+    }
+
+    if (mixed_precision) {
+      convert_precision(Arow.x.data(), csr_values_fp32_d, nnz, stream);
+      CUDSS_CALL_AND_CHECK(
+        cudssMatrixSetValues(A, csr_values_fp32_d), status, "cudssMatrixSetValues for A");
+      factored_matrix = &Arow;
+    } else {
+      CUDSS_CALL_AND_CHECK(
+        cudssMatrixSetValues(A, Arow.x.data()), status, "cudssMatrixSetValues for A");
+    }
 
     f_t start_numeric = tic();
     status            = cudssExecute(
-      handle, CUDSS_PHASE_FACTORIZATION, solverConfig, solverData, A, cudss_x, cudss_b);
+      handle, CUDSS_PHASE_FACTORIZATION, solverConfig, solverData, A, dense_x(), dense_b());
     if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
       return CONCURRENT_HALT_RETURN;
     }
@@ -548,6 +923,12 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
 
     handle_ptr_->get_stream().synchronize();
     RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+    if (info != 0 && mixed_precision) {
+      settings_.log.printf("FP32 factorization failed info %d. Factorizing in FP64\n", info);
+      i_t analyze_status = switch_to_fp64(Arow);
+      if (analyze_status != 0) { return analyze_status; }
+      return factorize(Arow);
+    }
     if (info != 0) {
       settings_.log.printf("Factorization failed info %d\n", info);
       return -1;
@@ -566,6 +947,11 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
 
   i_t analyze(const csc_matrix_t<i_t, f_t>& A_in) override
   {
+    // Mixed precision is only implemented for matrices on the device
+    if (mixed_precision) {
+      settings_.log.printf("cuDSS factor precision      : FP64\n");
+      mixed_precision = false;
+    }
     csr_matrix_t<i_t, f_t> Arow(A_in.n, A_in.m, A_in.col_start[A_in.n]);
 
 #ifdef WRITE_MATRIX_MARKET
@@ -770,6 +1156,18 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
       return -1;
     }
 
+    if (mixed_precision) {
+      i_t solve_status = solve_fp32(b, x);
+      if (solve_status != 0) { return solve_status; }
+      mixed_precision_op_t op{{handle_ptr_}, this};
+      const f_t error = iterative_refinement_simple<i_t, f_t>(op, b, x);
+      // Keep the solution, but factor in FP64 from the next iteration on
+      if (!(error <= mixed_precision_refinement_tol * (1.0 + vector_norm_inf<f_t>(b)))) {
+        fp64_requested = true;
+      }
+      return 0;
+    }
+
     CUDSS_CALL_AND_CHECK(
       cudssMatrixSetValues(cudss_b, b.data()), status, "cudssMatrixSetValues for b");
     CUDSS_CALL_AND_CHECK(
@@ -812,6 +1210,72 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
   }
 
  private:
+  // Relative residual of a refined solve above which the FP32 factors are given up
+  static constexpr f_t mixed_precision_refinement_tol = 1e-6;
+
+  // Operator of iterative_refinement_simple: products with the FP64 matrix that was factored and
+  // solves with its FP32 factors
+  struct mixed_precision_op_t {
+    struct {
+      raft::handle_t const* handle_ptr;
+    } data_;
+    sparse_cholesky_cudss_t* cholesky;
+
+    void a_multiply(f_t alpha,
+                    const rmm::device_uvector<f_t>& x,
+                    f_t beta,
+                    rmm::device_uvector<f_t>& y) const
+    {
+      cholesky_csr_multiply(alpha,
+                            *cholesky->factored_matrix,
+                            x.data(),
+                            beta,
+                            y.data(),
+                            data_.handle_ptr->get_stream().value());
+    }
+
+    void solve(rmm::device_uvector<f_t>& b, rmm::device_uvector<f_t>& x) const
+    {
+      cholesky->solve_fp32(b, x);
+    }
+  };
+
+  cudssMatrix_t dense_x() const { return mixed_precision ? cudss_x_fp32 : cudss_x; }
+  cudssMatrix_t dense_b() const { return mixed_precision ? cudss_b_fp32 : cudss_b; }
+
+  i_t solve_fp32(const rmm::device_uvector<f_t>& b, rmm::device_uvector<f_t>& x)
+  {
+    convert_precision(b.data(), b_values_fp32_d, n, handle_ptr_->get_stream().value());
+    handle_ptr_->get_stream().synchronize();
+
+    status = cudssExecute(
+      handle, CUDSS_PHASE_SOLVE, solverConfig, solverData, A, cudss_x_fp32, cudss_b_fp32);
+    if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+      return CONCURRENT_HALT_RETURN;
+    }
+    if (status != CUDSS_STATUS_SUCCESS) {
+      settings_.log.printf(
+        "FAILED: CUDSS call ended unsuccessfully with status = %d, details: cuDSSExecute for "
+        "FP32 solve\n",
+        status);
+      return -1;
+    }
+    CUDA_CALL_AND_CHECK(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+
+    convert_precision(x_values_fp32_d, x.data(), n, handle_ptr_->get_stream().value());
+    return 0;
+  }
+
+  // Recreates A with FP64 values and runs the analysis again, the FP32 factors are dropped
+  i_t switch_to_fp64(device_csr_matrix_t<i_t, f_t>& Arow)
+  {
+    mixed_precision = false;
+    fp64_requested  = false;
+    factored_matrix = nullptr;
+    settings_.log.printf("cuDSS factor precision      : FP64\n");
+    return analyze(Arow);
+  }
+
   raft::handle_t const* handle_ptr_;
   i_t n;
   i_t nnz;
@@ -833,6 +1297,14 @@ class sparse_cholesky_cudss_t : public sparse_cholesky_base_t<i_t, f_t> {
   f_t* csr_values_d;
   f_t* x_values_d;
   f_t* b_values_d;
+  bool mixed_precision;  // true while ADAT is factored in FP32
+  bool fp64_requested;   // set when refinement stalls, the next factorization is in FP64
+  const device_csr_matrix_t<i_t, f_t>* factored_matrix;
+  float* csr_values_fp32_d;
+  float* x_values_fp32_d;
+  float* b_values_fp32_d;
+  cudssMatrix_t cudss_x_fp32;
+  cudssMatrix_t cudss_b_fp32;
 
   const simplex_solver_settings_t<i_t, f_t>& settings_;
   CUgreenCtx barrier_green_ctx;
@@ -0,0 +1,121 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_trace.hpp>
+
+#include <dual_simplex/tic_toc.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+bool bb_trace_t::open(const std::string& path, int num_rings, size_t ring_capacity)
+{
+  close();
+  file_ = std::fopen(path.c_str(), "wb");
+  if (file_ == nullptr) { return false; }
+
+  char header[16];
+  const uint32_t record_size = sizeof(bb_trace_record_t);
+  std::memcpy(header, "CUOPTBBT", 8);
+  std::memcpy(header + 8, &format_version, sizeof(uint32_t));
+  std::memcpy(header + 12, &record_size, sizeof(uint32_t));
+  std::fwrite(header, 1, sizeof(header), file_);
+
+  size_t capacity = 1;
+  while (capacity < ring_capacity) {
+    capacity *= 2;
+  }
+  mask_ = capacity - 1;
+  rings_.clear();
+  for (int k = 0; k < num_rings; ++k) {
+    rings_.push_back(std::make_unique<ring_t>());
+    rings_.back()->buffer.resize(capacity);
+  }
+
+  start_time_ = tic();
+  stop_       = false;
+  writer_     = std::thread([this]() { writer_loop(); });
+  return true;
+}
+
+void bb_trace_t::close()
+{
+  if (file_ == nullptr) { return; }
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    stop_ = true;
+  }
+  writer_wakeup_.notify_one();
+  writer_.join();
+  drain();
+
+  for (size_t k = 0; k < rings_.size(); ++k) {
+    const uint64_t dropped = rings_[k]->dropped.load(std::memory_order_relaxed);
+    if (dropped == 0) { continue; }
+    bb_trace_record_t record{toc(start_time_),
+                             static_cast<double>(dropped),
+                             static_cast<int32_t>(k),
+                             -1,
+                             bb_trace_kind_t::DROPPED,
+                             -1};
+    std::fwrite(&record, sizeof(record), 1, file_);
+  }
+  std::fclose(file_);
+  file_ = nullptr;
+  rings_.clear();
+}
+
+void bb_trace_t::record(
+  int ring, bb_trace_kind_t kind, int worker_id, int node_id, int strategy, double value)
+{
+  ring_t& r           = *rings_[ring];
+  const uint64_t head = r.head.load(std::memory_order_relaxed);
+  if (head - r.tail.load(std::memory_order_acquire) > mask_) {
+    r.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  r.buffer[head & mask_] = {toc(start_time_),
+                            value,
+                            static_cast<int32_t>(node_id),
+                            static_cast<int16_t>(worker_id),
+                            kind,
+                            static_cast<int8_t>(strategy)};
+  r.head.store(head + 1, std::memory_order_release);
+}
+
+void bb_trace_t::drain()
+{
+  for (auto& ring : rings_) {
+    ring_t& r           = *ring;
+    const uint64_t head = r.head.load(std::memory_order_acquire);
+    uint64_t tail       = r.tail.load(std::memory_order_relaxed);
+    while (tail < head) {
+      // Up to the end of the buffer, then from its start
+      const uint64_t begin = tail & mask_;
+      const uint64_t count = std::min(head - tail, mask_ + 1 - begin);
+      std::fwrite(r.buffer.data() + begin, sizeof(bb_trace_record_t), count, file_);
+      tail += count;
+    }
+    r.tail.store(tail, std::memory_order_release);
+  }
+}
+
+void bb_trace_t::writer_loop()
+{
+  std::unique_lock<std::mutex> lock(writer_mutex_);
+  while (!stop_) {
+    writer_wakeup_.wait_for(lock, std::chrono::milliseconds(50));
+    lock.unlock();
+    drain();
+    lock.lock();
+  }
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,102 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Kinds of the records of a B&B trace. The node kinds have the values of bb_event_type_t
+enum class bb_trace_kind_t : int8_t {
+  NODE_BRANCHED   = 0,
+  NODE_FATHOMED   = 1,
+  NODE_INTEGER    = 2,
+  NODE_INFEASIBLE = 3,
+  NODE_NUMERICAL  = 4,
+  WORKER_START    = 5,  // a worker starts a plunge or a dive
+  WORKER_STOP     = 6,  // and goes back to the pool
+  LOWER_BOUND     = 7,  // new global lower bound
+  UPPER_BOUND     = 8,  // new incumbent objective
+  DROPPED         = 9,  // records lost because a ring was full, written when the trace closes
+};
+
+// One record of the trace file, in the byte order of the host. Times are in seconds since the
+// trace was opened and bounds are those of the B&B problem, i.e., before the user objective scaling
+struct bb_trace_record_t {
+  double time;
+  double value;  // bound of the node, objective or count, depending on the kind
+  int32_t node_id;
+  int16_t worker_id;
+  bb_trace_kind_t kind;
+  int8_t strategy;  // search strategy of the worker, -1 if not from a worker
+};
+static_assert(sizeof(bb_trace_record_t) == 24, "bb_trace_record_t is 24 bytes in the file");
+
+// Opt-in binary trace of the tree search. Each producer, e.g., a worker, writes its records to a
+// ring buffer of its own without locks, and a writer thread drains them to the file in the
+// background. A record is dropped rather than block the producer when its ring is full.
+//
+// The file starts with a 16 bytes header: "CUOPTBBT", the format version and the record size as
+// uint32_t, followed by the records in the order the rings were drained.
+class bb_trace_t {
+ public:
+  static constexpr uint32_t format_version = 1;
+
+  bb_trace_t() = default;
+  bb_trace_t(const bb_trace_t&)            = delete;
+  bb_trace_t& operator=(const bb_trace_t&) = delete;
+  ~bb_trace_t() { close(); }
+
+  // Creates the file and num_rings rings of ring_capacity records each, rounded up to a power of
+  // two. Returns false, leaving the trace closed, if the file could not be created
+  bool open(const std::string& path, int num_rings, size_t ring_capacity = 1 << 13);
+
+  // Stops the writer thread and writes the remaining records
+  void close();
+
+  bool is_open() const { return file_ != nullptr; }
+
+  // Only one thread at a time may record to a given ring
+  void record(int ring,
+              bb_trace_kind_t kind,
+              int worker_id,
+              int node_id,
+              int strategy,
+              double value);
+
+ private:
+  struct alignas(64) ring_t {
+    std::vector<bb_trace_record_t> buffer;
+    std::atomic<uint64_t> head{0};  // written by the producer
+    alignas(64) std::atomic<uint64_t> tail{0};  // written by the writer thread
+    std::atomic<uint64_t> dropped{0};
+  };
+
+  void drain();
+  void writer_loop();
+
+  std::FILE* file_{nullptr};
+  std::vector<std::unique_ptr<ring_t>> rings_;
+  uint64_t mask_{0};
+  double start_time_{0.0};
+
+  std::thread writer_;
+  std::mutex writer_mutex_;
+  std::condition_variable writer_wakeup_;
+  bool stop_{false};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
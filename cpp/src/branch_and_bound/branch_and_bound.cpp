@@ -24,10 +24,12 @@
 
 #include <raft/core/nvtx.hpp>
 #include <utilities/hashing.hpp>
+#include <utilities/instrumentation.hpp>
 
 #include <omp.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -365,6 +367,161 @@ void branch_and_bound_t<i_t, f_t>::report(
   }
 }
 
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::spill_open_nodes()
+{
+  if (!node_spill_enabled_ || !std::isfinite(settings_.node_memory_limit)) { return; }
+  const size_t limit_bytes = settings_.node_memory_limit * 1024.0 * 1024.0;
+  if (node_queue_.queued_basis_bytes() <= limit_bytes) { return; }
+
+  if (node_spill_file_ == nullptr) { node_spill_file_ = std::make_shared<node_spill_file_t>(); }
+  // Going down to half of the limit leaves room for the queue to grow before the next spill
+  const i_t num_spilled = node_queue_.spill_bases(limit_bytes / 2, node_spill_file_);
+  if (num_spilled == 0) {
+    settings_.log.printf("Could not spill the open nodes to disk, keeping them in memory\n");
+    node_spill_enabled_ = false;
+    return;
+  }
+  settings_.log.debug("Spilled the bases of %d open nodes, %.1f MB on disk\n",
+                      num_spilled,
+                      node_spill_file_->size() / (1024.0 * 1024.0));
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::prune_open_nodes()
+{
+  const f_t upper_bound = upper_bound_;
+  if (!(upper_bound < pruned_upper_bound_)) { return; }
+  pruned_upper_bound_ = upper_bound;
+
+  const auto pruned = node_queue_.prune(upper_bound);
+  for (mip_node_t<i_t, f_t>* node_ptr : pruned) {
+    search_tree_.graphviz_node(settings_.log, node_ptr, "cutoff", node_ptr->lower_bound);
+    search_tree_.update(node_ptr, node_status_t::FATHOMED);
+  }
+  if (!pruned.empty()) {
+    settings_.log.debug("Pruned %ld open nodes with the new upper bound %e\n",
+                        pruned.size(),
+                        compute_user_objective(original_lp_, upper_bound));
+  }
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::trace_bounds(f_t lower_bound)
+{
+  if (!trace_.is_open()) { return; }
+  if (lower_bound != traced_lower_bound_) {
+    traced_lower_bound_ = lower_bound;
+    trace_.record(trace_scheduler_ring_, bb_trace_kind_t::LOWER_BOUND, -1, -1, -1, lower_bound);
+  }
+  const f_t upper_bound = upper_bound_;
+  if (upper_bound != traced_upper_bound_) {
+    traced_upper_bound_ = upper_bound;
+    trace_.record(trace_scheduler_ring_, bb_trace_kind_t::UPPER_BOUND, -1, -1, -1, upper_bound);
+  }
+}
+
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::resume_from_checkpoint()
+{
+  if (settings_.checkpoint_file.empty()) { return false; }
+  if (settings_.deterministic) {
+    settings_.log.printf("Checkpoints are not supported in deterministic mode, ignoring %s\n",
+                         settings_.checkpoint_file.c_str());
+    return false;
+  }
+  // A missing file simply means there is nothing to resume yet
+  if (!checkpoint_.read(settings_.checkpoint_file)) { return false; }
+  if (checkpoint_.problem_hash != checkpoint_problem_hash(original_problem_)) {
+    settings_.log.printf("Checkpoint %s was written for another problem, ignoring it\n",
+                         settings_.checkpoint_file.c_str());
+    checkpoint_ = bnb_checkpoint_t<i_t, f_t>();
+    return false;
+  }
+
+  if (checkpoint_.incumbent.size() == original_problem_.num_cols) {
+    std::vector<f_t> crushed_incumbent;
+    crush_primal_solution(
+      original_problem_, original_lp_, checkpoint_.incumbent, new_slacks_, crushed_incumbent);
+    f_t primal_err;
+    f_t bound_err;
+    i_t num_fractional;
+    const bool feasible = check_guess(original_lp_,
+                                      settings_,
+                                      var_types_,
+                                      crushed_incumbent,
+                                      primal_err,
+                                      bound_err,
+                                      num_fractional);
+    const f_t obj       = compute_objective(original_lp_, crushed_incumbent);
+    mutex_upper_.lock();
+    if (feasible && obj < upper_bound_) {
+      set_incumbent(obj, crushed_incumbent);
+      upper_bound_ = obj;
+    }
+    mutex_upper_.unlock();
+  }
+  settings_.log.printf("Resuming from checkpoint %s: %ld open nodes, %s incumbent\n",
+                       settings_.checkpoint_file.c_str(),
+                       checkpoint_.open_nodes.size(),
+                       checkpoint_.incumbent.empty() ? "no" : "with an");
+  if (checkpoint_.is_part()) {
+    settings_.log.printf(
+      "Checkpoint is part %u of %u, the bound only covers the subtrees of this part\n",
+      checkpoint_.part_index,
+      checkpoint_.num_parts);
+  }
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::write_checkpoint(bool split)
+{
+  if (settings_.checkpoint_file.empty() || settings_.deterministic) { return; }
+  f_t checkpoint_start = tic();
+
+  bnb_checkpoint_t<i_t, f_t> checkpoint;
+  checkpoint.problem_hash = checkpoint_problem_hash(original_problem_);
+  checkpoint.part_index   = checkpoint_.part_index;
+  checkpoint.num_parts    = checkpoint_.num_parts;
+  search_tree_.mutex.lock();
+  collect_open_nodes(search_tree_.root, checkpoint.open_nodes);
+  search_tree_.mutex.unlock();
+
+  mutex_upper_.lock();
+  std::vector<f_t> incumbent = incumbent_.has_incumbent ? incumbent_.x : std::vector<f_t>();
+  mutex_upper_.unlock();
+  if (!incumbent.empty()) {
+    mutex_original_lp_.lock();
+    uncrush_primal_solution(original_problem_, original_lp_, incumbent, checkpoint.incumbent);
+    mutex_original_lp_.unlock();
+  }
+  checkpoint.pseudo_costs = pc_.create_snapshot();
+
+  if (checkpoint.write(settings_.checkpoint_file)) {
+    settings_.log.printf("Checkpoint of %ld open nodes written to %s in %.2fs\n",
+                         checkpoint.open_nodes.size(),
+                         settings_.checkpoint_file.c_str(),
+                         toc(checkpoint_start));
+  } else {
+    settings_.log.printf("Could not write the checkpoint %s\n", settings_.checkpoint_file.c_str());
+  }
+  if (split && settings_.checkpoint_split > 1) {
+    std::vector<bnb_checkpoint_t<i_t, f_t>> parts =
+      split_checkpoint(checkpoint, settings_.checkpoint_split);
+    for (size_t k = 0; k < parts.size(); ++k) {
+      const std::string part_file = settings_.checkpoint_file + "." + std::to_string(k);
+      if (!parts[k].write(part_file)) {
+        settings_.log.printf("Could not write the checkpoint %s\n", part_file.c_str());
+      }
+    }
+    settings_.log.printf("Open nodes split into %d checkpoints %s.<k>\n",
+                         settings_.checkpoint_split,
+                         settings_.checkpoint_file.c_str());
+  }
+  last_checkpoint_time_ = tic();
+}
+
 template <typename i_t, typename f_t>
 i_t branch_and_bound_t<i_t, f_t>::find_reduced_cost_fixings(f_t upper_bound,
                                                             std::vector<f_t>& lower_bounds,
@@ -428,11 +585,23 @@ i_t branch_and_bound_t<i_t, f_t>::find_reduced_cost_fixings(f_t upper_bound,
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::update_user_bound(f_t lower_bound)
 {
-  if (user_bound_callback_ == nullptr) { return; }
+  // The bound of a checkpoint part is not a bound of the problem
+  if (is_solving_checkpoint_part()) { return; }
   f_t user_lower = compute_user_objective(original_lp_, lower_bound);
+  if (incumbent_bus_ != nullptr) { incumbent_bus_->publish_user_lower_bound(user_lower); }
+  if (user_bound_callback_ == nullptr) { return; }
   user_bound_callback_(user_lower);
 }
 
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::set_incumbent(f_t obj, const std::vector<f_t>& x)
+{
+  incumbent_.set_incumbent_solution(obj, x);
+  if (incumbent_bus_ != nullptr) {
+    incumbent_bus_->publish_user_incumbent(compute_user_objective(original_lp_, obj));
+  }
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::set_new_solution(const std::vector<f_t>& solution)
 {
@@ -468,7 +637,7 @@ void branch_and_bound_t<i_t, f_t>::set_new_solution(const std::vector<f_t>& solu
     mutex_upper_.lock();
     if (is_feasible && obj < upper_bound_) {
       upper_bound_ = obj;
-      incumbent_.set_incumbent_solution(obj, crushed_solution);
+      set_incumbent(obj, crushed_solution);
     } else {
       attempt_repair         = true;
       constexpr bool verbose = false;
@@ -628,7 +797,7 @@ void branch_and_bound_t<i_t, f_t>::repair_heuristic_solutions()
 
         if (repaired_obj < upper_bound_) {
           upper_bound_ = repaired_obj;
-          incumbent_.set_incumbent_solution(repaired_obj, repaired_solution);
+          set_incumbent(repaired_obj, repaired_solution);
           report_heuristic(repaired_obj);
 
           if (settings_.solution_callback != nullptr) {
@@ -649,7 +818,7 @@ void branch_and_bound_t<i_t, f_t>::set_solution_at_root(mip_solution_t<i_t, f_t>
                                                         const cut_info_t<i_t, f_t>& cut_info)
 {
   mutex_upper_.lock();
-  incumbent_.set_incumbent_solution(root_objective_, root_relax_soln_.x);
+  set_incumbent(root_objective_, root_relax_soln_.x);
   upper_bound_ = root_objective_;
   mutex_upper_.unlock();
 
@@ -704,13 +873,38 @@ void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>&
   settings_.log.printf("Explored %d nodes in %.2fs.\n",
                        exploration_stats_.nodes_explored,
                        toc(exploration_stats_.start_time));
+  // An open node holds half of the packed basis it shares with its sibling
+  const size_t open_node_bytes =
+    sizeof(mip_node_t<i_t, f_t>) + (original_lp_.num_cols + 1) / 2 / 2;
+  settings_.log.printf("Open node storage about %zu bytes per node (%zu with an unpacked basis)\n",
+                       open_node_bytes,
+                       sizeof(mip_node_t<i_t, f_t>) + original_lp_.num_cols);
+  if (node_spill_file_ != nullptr) {
+    settings_.log.printf("Spilled %.1f MB of open node bases to disk\n",
+                         node_spill_file_->size() / (1024.0 * 1024.0));
+  }
   settings_.log.printf("Absolute Gap %e Objective %.16e %s Bound %.16e\n",
                        gap,
                        obj,
                        is_maximization ? "Upper" : "Lower",
                        user_bound);
 
-  if (gap <= settings_.absolute_mip_gap_tol || gap_rel <= settings_.relative_mip_gap_tol) {
+  // A checkpoint part only explores its share of the tree. Closing the gap or the tree proves
+  // neither optimality nor infeasibility of the problem
+  const bool solving_part = is_solving_checkpoint_part();
+  if (solving_part) {
+    const bool part_explored =
+      exploration_stats_.nodes_unexplored == 0 || gap <= settings_.absolute_mip_gap_tol ||
+      gap_rel <= settings_.relative_mip_gap_tol;
+    if ((solver_status_ == mip_status_t::UNSET || solver_status_ == mip_status_t::PART_COMPLETE) &&
+        part_explored) {
+      solver_status_ = mip_status_t::PART_COMPLETE;
+      settings_.log.printf("Checkpoint part %u of %u explored. Bound of its subtrees %.16e\n",
+                           checkpoint_.part_index,
+                           checkpoint_.num_parts,
+                           user_bound);
+    }
+  } else if (gap <= settings_.absolute_mip_gap_tol || gap_rel <= settings_.relative_mip_gap_tol) {
     solver_status_ = mip_status_t::OPTIMAL;
 #ifdef CHECK_CUTS_AGAINST_SAVED_SOLUTION
     if (settings_.sub_mip == 0) { write_solution_for_cut_verification(original_lp_, incumbent_.x); }
@@ -729,7 +923,7 @@ void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>&
     }
   }
 
-  if (solver_status_ == mip_status_t::UNSET) {
+  if (solver_status_ == mip_status_t::UNSET && !solving_part) {
     if (exploration_stats_.nodes_explored > 0 && exploration_stats_.nodes_unexplored == 0 &&
         upper_bound_ == inf) {
       settings_.log.printf("Integer infeasible.\n");
@@ -748,6 +942,11 @@ void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>&
   solution.lower_bound        = lower_bound;
   solution.nodes_explored     = exploration_stats_.nodes_explored;
   solution.simplex_iterations = exploration_stats_.total_lp_iters;
+  CUOPT_COUNTER_SET("branch_and_bound.nodes", exploration_stats_.nodes_explored.load());
+  CUOPT_COUNTER_SET("branch_and_bound.nodes_per_second",
+                    exploration_stats_.nodes_explored.load() / toc(exploration_stats_.start_time));
+  CUOPT_COUNTER_SET("branch_and_bound.simplex_iterations",
+                    exploration_stats_.total_lp_iters.load());
 }
 
 template <typename i_t, typename f_t>
@@ -764,7 +963,7 @@ void branch_and_bound_t<i_t, f_t>::add_feasible_solution(f_t leaf_objective,
 
   mutex_upper_.lock();
   if (leaf_objective < upper_bound_) {
-    incumbent_.set_incumbent_solution(leaf_objective, leaf_solution);
+    set_incumbent(leaf_objective, leaf_solution);
     upper_bound_ = leaf_objective;
     report(feasible_solution_symbol(thread_type), leaf_objective, get_lower_bound(), leaf_depth, 0);
     send_solution = true;
@@ -902,7 +1101,7 @@ struct nondeterministic_policy_t : tree_update_policy_t<i_t, f_t> {
 
   void update_pseudo_costs(mip_node_t<i_t, f_t>* node, f_t leaf_obj) override
   {
-    bnb.pc_.update_pseudo_costs(node, leaf_obj);
+    bnb.pc_.queue_update(node, leaf_obj, worker->worker_id);
   }
 
   void handle_integer_solution(mip_node_t<i_t, f_t>* node,
@@ -958,7 +1157,27 @@ struct nondeterministic_policy_t : tree_update_policy_t<i_t, f_t> {
     }
   }
 
-  void on_node_completed(mip_node_t<i_t, f_t>*, node_status_t, rounding_direction_t) override {}
+  void on_node_completed(mip_node_t<i_t, f_t>* node,
+                         node_status_t status,
+                         rounding_direction_t) override
+  {
+    if (!bnb.trace_.is_open()) { return; }
+    bb_trace_kind_t kind;
+    switch (status) {
+      case node_status_t::HAS_CHILDREN: kind = bb_trace_kind_t::NODE_BRANCHED; break;
+      case node_status_t::FATHOMED: kind = bb_trace_kind_t::NODE_FATHOMED; break;
+      case node_status_t::INTEGER_FEASIBLE: kind = bb_trace_kind_t::NODE_INTEGER; break;
+      case node_status_t::INFEASIBLE: kind = bb_trace_kind_t::NODE_INFEASIBLE; break;
+      case node_status_t::NUMERICAL: kind = bb_trace_kind_t::NODE_NUMERICAL; break;
+      default: return;
+    }
+    bnb.trace_.record(worker->worker_id,
+                      kind,
+                      worker->worker_id,
+                      node->node_id,
+                      worker->search_strategy,
+                      node->lower_bound);
+  }
 };
 
 template <typename i_t, typename f_t, typename WorkerT>
@@ -1162,7 +1381,17 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
   node_status_t status                   = node_status_t::PENDING;
   rounding_direction_t round_dir         = rounding_direction_t::NONE;
 
+  // A pruned node gives a conflict when the multipliers of its LP alone prove the cutoff
+  auto analyze_conflict = [&]() {
+    if (!conflict_pool_.active() || !std::isfinite(upper_bound)) { return; }
+    const f_t cutoff = original_lp_.objective_is_integral
+                         ? upper_bound - 1 + settings_.integer_tol
+                         : upper_bound;
+    conflict_pool_.analyze(leaf_problem, leaf_solution.y, var_types_, cutoff, settings_);
+  };
+
   if (lp_status == dual::status_t::DUAL_UNBOUNDED) {
+    analyze_conflict();
     node_ptr->lower_bound = inf;
     policy.graphviz(search_tree, node_ptr, "infeasible", 0.0);
     search_tree.update(node_ptr, node_status_t::INFEASIBLE);
@@ -1171,6 +1400,7 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
   } else if (lp_status == dual::status_t::CUTOFF) {
     f_t leaf_obj          = compute_objective(leaf_problem, leaf_solution.x);
     node_ptr->lower_bound = upper_bound;
+    analyze_conflict();
     policy.graphviz(search_tree, node_ptr, "cut off", leaf_obj);
     search_tree.update(node_ptr, node_status_t::FATHOMED);
     status = node_status_t::FATHOMED;
@@ -1196,12 +1426,14 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
 #endif
 
     f_t leaf_obj = compute_objective(leaf_problem, leaf_solution.x);
+    // The cuts of the node can only raise its bound
+    const f_t node_bound = std::max(leaf_obj, worker->node_cut_bound);
 
     policy.graphviz(search_tree, node_ptr, "lower bound", leaf_obj);
     policy.update_pseudo_costs(node_ptr, leaf_obj);
-    node_ptr->lower_bound = leaf_obj;
+    node_ptr->lower_bound = node_bound;
     if (original_lp_.objective_is_integral) {
-      node_ptr->lower_bound = std::ceil(leaf_obj - settings_.integer_tol);
+      node_ptr->lower_bound = std::ceil(node_bound - settings_.integer_tol);
     }
     policy.on_optimal_callback(leaf_solution.x, leaf_obj);
 
@@ -1211,7 +1443,7 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
       search_tree.update(node_ptr, node_status_t::INTEGER_FEASIBLE);
       status = node_status_t::INTEGER_FEASIBLE;
 
-    } else if (leaf_obj <= upper_bound + abs_fathom_tol) {
+    } else if (node_bound <= upper_bound + abs_fathom_tol) {
       auto [branch_var, dir] =
         policy.select_branch_variable(node_ptr, leaf_fractional, leaf_solution.x);
       round_dir = dir;
@@ -1235,6 +1467,7 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
       status = node_status_t::HAS_CHILDREN;
 
     } else {
+      analyze_conflict();
       policy.graphviz(search_tree, node_ptr, "fathomed", leaf_obj);
       search_tree.update(node_ptr, node_status_t::FATHOMED);
       status = node_status_t::FATHOMED;
@@ -1275,7 +1508,7 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
   branch_and_bound_stats_t<i_t, f_t>& stats,
   logger_t& log)
 {
-  raft::common::nvtx::range scope("BB::solve_node");
+  CUOPT_NVTX_RANGE(branch_and_bound, "solve_node");
 #ifdef DEBUG_BRANCHING
   i_t num_integer_variables = 0;
   for (i_t j = 0; j < original_lp_.num_cols; j++) {
@@ -1311,6 +1544,11 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
   }
 #endif
 
+  if (!node_ptr->unpack_vstatus()) {
+    // The basis spilled to disk could not be read back, start over from the root basis
+    node_ptr->vstatus       = root_vstatus_;
+    worker->recompute_basis = true;
+  }
   std::vector<variable_status_t>& leaf_vstatus = node_ptr->vstatus;
   assert(leaf_vstatus.size() == worker->leaf_problem.num_cols);
 
@@ -1358,11 +1596,13 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
   bool feasible            = worker->set_lp_variable_bounds(node_ptr, settings_);
   dual::status_t lp_status = dual::status_t::DUAL_UNBOUNDED;
   worker->leaf_edge_norms  = edge_norms_;
+  worker->node_cut_bound   = -std::numeric_limits<f_t>::infinity();
 
   if (feasible) {
     i_t node_iter     = 0;
     f_t lp_start_time = tic();
 
+    worker->preserve_sibling_basis(node_ptr);
     lp_status = dual_phase2_with_advanced_basis(2,
                                                 0,
                                                 worker->recompute_basis,
@@ -1396,23 +1636,153 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
     stats.total_lp_iters += node_iter;
   }
 
+  if (lp_status == dual::status_t::OPTIMAL && worker->search_strategy == BEST_FIRST &&
+      node_ptr->depth <= settings_.node_cut_depth) {
+    lp_status = solve_node_cut_lp(node_ptr, worker, lp_settings, stats);
+  }
+
 #ifdef LOG_NODE_SIMPLEX
   lp_settings.log.printf("\nLP status: %d\n\n", lp_status);
 #endif
 
   return lp_status;
 }
+
+template <typename i_t, typename f_t>
+dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_cut_lp(
+  mip_node_t<i_t, f_t>* node_ptr,
+  branch_and_bound_worker_t<i_t, f_t>* worker,
+  const simplex_solver_settings_t<i_t, f_t>& lp_settings,
+  branch_and_bound_stats_t<i_t, f_t>& stats)
+{
+  raft::common::nvtx::range scope("BB::solve_node_cuts");
+  // Node LPs a cut may stay slack at before it is dropped from the subtree
+  constexpr i_t max_cut_age                    = 3;
+  const lp_problem_t<i_t, f_t>& leaf_problem   = worker->leaf_problem;
+  const lp_solution_t<i_t, f_t>& leaf_solution = worker->leaf_solution;
+  const i_t n                                  = leaf_problem.num_cols;
+
+  std::vector<i_t> fractional;
+  if (fractional_variables(settings_, leaf_solution.x, var_types_, fractional) == 0) {
+    return dual::status_t::OPTIMAL;
+  }
+
+  // The Gomory cuts use the bounds of the node, so they only hold in its subtree
+  cut_pool_t<i_t, f_t> cut_pool(n, lp_settings);
+  generate_gomory_cuts(cut_pool,
+                       leaf_problem,
+                       lp_settings,
+                       Arow_,
+                       new_slacks_,
+                       var_types_,
+                       worker->basis_factors,
+                       leaf_solution.x,
+                       worker->basic_list,
+                       worker->nonbasic_list);
+  std::vector<f_t> xstar = leaf_solution.x;
+  const i_t max_node_cuts = 2000;
+  cut_pool.score_cuts(xstar, leaf_problem.objective, max_node_cuts);
+  csr_matrix_t<i_t, f_t> new_cuts(0, n, 0);
+  std::vector<f_t> new_rhs;
+  std::vector<cut_type_t> cut_types;
+  cut_pool.get_best_cuts(new_cuts, new_rhs, cut_types);
+
+  node_cuts_t<i_t, f_t> node_cuts;
+  const node_cuts_t<i_t, f_t>* parent_cuts =
+    node_ptr->parent != nullptr ? node_ptr->parent->cuts.get() : nullptr;
+  if (parent_cuts != nullptr) {
+    node_cuts = *parent_cuts;
+  } else {
+    node_cuts.cuts = csr_matrix_t<i_t, f_t>(0, n, 0);
+  }
+  if (new_cuts.m > 0) {
+    node_cuts.cuts.append_rows(new_cuts);
+    node_cuts.rhs.insert(node_cuts.rhs.end(), new_rhs.begin(), new_rhs.end());
+    node_cuts.age.resize(node_cuts.cuts.m, 0);
+  }
+  const i_t num_cuts = node_cuts.cuts.m;
+  if (num_cuts == 0) { return dual::status_t::OPTIMAL; }
+
+  // The children start from the basis of the node LP without cuts, so the cuts go into copies
+  lp_problem_t<i_t, f_t> cut_problem       = leaf_problem;
+  lp_solution_t<i_t, f_t> cut_solution     = leaf_solution;
+  basis_update_mpf_t<i_t, f_t> cut_factors = worker->basis_factors;
+  std::vector<i_t> basic_list              = worker->basic_list;
+  std::vector<i_t> nonbasic_list           = worker->nonbasic_list;
+  std::vector<variable_status_t> vstatus   = node_ptr->vstatus;
+  std::vector<f_t> edge_norms              = worker->leaf_edge_norms;
+  std::vector<i_t> slacks                  = new_slacks_;
+
+  i_t add_cuts_status = add_cuts(lp_settings,
+                                 node_cuts.cuts,
+                                 node_cuts.rhs,
+                                 cut_problem,
+                                 slacks,
+                                 cut_solution,
+                                 cut_factors,
+                                 basic_list,
+                                 nonbasic_list,
+                                 vstatus,
+                                 edge_norms);
+  if (add_cuts_status != 0) { return dual::status_t::OPTIMAL; }
+
+  i_t iter                  = 0;
+  f_t lp_start_time         = tic();
+  dual::status_t cut_status = dual_phase2_with_advanced_basis(2,
+                                                              0,
+                                                              false,
+                                                              lp_start_time,
+                                                              cut_problem,
+                                                              lp_settings,
+                                                              vstatus,
+                                                              cut_factors,
+                                                              basic_list,
+                                                              nonbasic_list,
+                                                              cut_solution,
+                                                              iter,
+                                                              edge_norms);
+  stats.total_lp_solve_time += toc(lp_start_time);
+  stats.total_lp_iters += iter;
+
+  // The cuts hold in the subtree, so the node is pruned if its LP with the cuts is
+  if (cut_status == dual::status_t::DUAL_UNBOUNDED || cut_status == dual::status_t::CUTOFF) {
+    return cut_status;
+  }
+  // Otherwise the node keeps the result of its LP without cuts
+  if (cut_status != dual::status_t::OPTIMAL) { return dual::status_t::OPTIMAL; }
+  worker->node_cut_bound = compute_objective(cut_problem, cut_solution.x);
+
+  // The children inherit the cuts binding at the solution and the slack ones that are not too old
+  auto children_cuts  = std::make_shared<node_cuts_t<i_t, f_t>>();
+  children_cuts->cuts = csr_matrix_t<i_t, f_t>(0, n, 0);
+  for (i_t k = 0; k < num_cuts; k++) {
+    const f_t slack = cut_solution.x[n + k];
+    const i_t age   = slack <= settings_.primal_tol ? 0 : node_cuts.age[k] + 1;
+    if (age >= max_cut_age) { continue; }
+    children_cuts->cuts.append_row(sparse_vector_t<i_t, f_t>(node_cuts.cuts, k));
+    children_cuts->rhs.push_back(node_cuts.rhs[k]);
+    children_cuts->age.push_back(age);
+  }
+  if (children_cuts->cuts.m > 0) { node_ptr->cuts = std::move(children_cuts); }
+  return dual::status_t::OPTIMAL;
+}
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::plunge_with(branch_and_bound_worker_t<i_t, f_t>* worker)
 {
+  trace_worker(worker, bb_trace_kind_t::WORKER_START);
   std::deque<mip_node_t<i_t, f_t>*> stack;
   stack.push_front(worker->start_node);
   worker->recompute_basis  = true;
   worker->recompute_bounds = true;
 
+  worker->save_sibling_basis(nullptr);
   while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET) {
     mip_node_t<i_t, f_t>* node_ptr = stack.front();
     stack.pop_front();
+    // A sibling whose twin was just fathomed starts from the factorization of their parent
+    if (worker->recompute_basis && worker->restore_sibling_basis(node_ptr)) {
+      worker->recompute_basis = false;
+    }
 
     f_t lower_bound = node_ptr->lower_bound;
     f_t upper_bound = upper_bound_;
@@ -1469,34 +1839,42 @@ void branch_and_bound_t<i_t, f_t>::plunge_with(branch_and_bound_worker_t<i_t, f_
       // If the stack size is greater than 0,
       // we pop the current node from the stack and place it in the global heap,
       // since we are about to add the two children to the stack
+      // The nodes going to the global heap are pushed together, taking its lock once
+      std::array<mip_node_t<i_t, f_t>*, 2> to_queue;
+      i_t num_to_queue = 0;
       if (stack.size() > 0) {
-        mip_node_t<i_t, f_t>* node = stack.back();
+        to_queue[num_to_queue++] = stack.back();
         stack.pop_back();
-        node_queue_.push(node);
       }
 
       exploration_stats_.nodes_unexplored += 2;
 
+      const bool queue_is_short =
+        node_queue_.best_first_queue_size() + num_to_queue < min_node_queue_size_;
       if (round_dir == rounding_direction_t::UP) {
-        if (node_queue_.best_first_queue_size() < min_node_queue_size_) {
-          node_queue_.push(node_ptr->get_down_child());
+        if (queue_is_short) {
+          to_queue[num_to_queue++] = node_ptr->get_down_child();
         } else {
           stack.push_front(node_ptr->get_down_child());
         }
 
         stack.push_front(node_ptr->get_up_child());
       } else {
-        if (node_queue_.best_first_queue_size() < min_node_queue_size_) {
-          node_queue_.push(node_ptr->get_up_child());
+        if (queue_is_short) {
+          to_queue[num_to_queue++] = node_ptr->get_up_child();
         } else {
           stack.push_front(node_ptr->get_up_child());
         }
 
         stack.push_front(node_ptr->get_down_child());
       }
+      node_queue_.push(to_queue.data(), num_to_queue);
+      worker->save_sibling_basis(stack.size() > 1 ? stack[1] : nullptr);
     }
   }
 
+  pc_.flush_updates(worker->worker_id);
+  trace_worker(worker, bb_trace_kind_t::WORKER_STOP);
   if (settings_.num_threads > 1) {
     worker_pool_.return_worker_to_pool(worker);
     active_workers_per_strategy_[BEST_FIRST]--;
@@ -1512,6 +1890,7 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
 
   search_strategy_t search_strategy = worker->search_strategy;
   const i_t diving_node_limit       = settings_.diving_settings.node_limit;
+  trace_worker(worker, bb_trace_kind_t::WORKER_START);
   const i_t diving_backtrack_limit  = settings_.diving_settings.backtrack_limit;
 
   worker->recompute_basis  = true;
@@ -1527,9 +1906,13 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
   dive_stats.nodes_explored      = 0;
   dive_stats.nodes_unexplored    = 1;
 
+  worker->save_sibling_basis(nullptr);
   while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET && is_running_) {
     mip_node_t<i_t, f_t>* node_ptr = stack.front();
     stack.pop_front();
+    if (worker->recompute_basis && worker->restore_sibling_basis(node_ptr)) {
+      worker->recompute_basis = false;
+    }
 
     f_t lower_bound     = node_ptr->lower_bound;
     f_t upper_bound     = upper_bound_;
@@ -1556,6 +1939,24 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
 
     ++dive_stats.nodes_explored;
 
+    if (dive_stats.nodes_explored == 1 && lp_status == dual::status_t::OPTIMAL &&
+        settings_.diving_settings.gpu_diving == 1) {
+      std::vector<f_t> gpu_dive_solution;
+      f_t gpu_dive_objective;
+      if (batch_pdlp_diving_.try_dive(worker->leaf_problem,
+                                      var_types_,
+                                      worker->leaf_solution.x,
+                                      worker->node_presolver,
+                                      settings_,
+                                      upper_bound_,
+                                      settings_.time_limit - toc(exploration_stats_.start_time),
+                                      gpu_dive_solution,
+                                      gpu_dive_objective)) {
+        add_feasible_solution(
+          gpu_dive_objective, gpu_dive_solution, node_ptr->depth, search_strategy);
+      }
+    }
+
     auto [node_status, round_dir] = update_tree(node_ptr, dive_tree, worker, lp_status, log);
 
     worker->recompute_basis  = node_status != node_status_t::HAS_CHILDREN;
@@ -1569,6 +1970,7 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
         stack.push_front(node_ptr->get_up_child());
         stack.push_front(node_ptr->get_down_child());
       }
+      worker->save_sibling_basis(stack[1]);
     }
 
     // Remove nodes that we no longer can backtrack to (i.e., from the current node, we can only
@@ -1578,6 +1980,8 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
     }
   }
 
+  pc_.flush_updates(worker->worker_id);
+  trace_worker(worker, bb_trace_kind_t::WORKER_STOP);
   worker_pool_.return_worker_to_pool(worker);
   active_workers_per_strategy_[search_strategy]--;
 }
@@ -1594,6 +1998,8 @@ void branch_and_bound_t<i_t, f_t>::run_scheduler()
     get_max_workers(num_workers, strategies);
 
   worker_pool_.init(num_workers, original_lp_, Arow_, var_types_, settings_);
+  worker_pool_.set_node_propagation(&symmetry_orderings_, active_conflict_pool());
+  pc_.set_num_workers(num_workers);
   active_workers_per_strategy_.fill(0);
 
 #ifdef CUOPT_LOG_DEBUG
@@ -1661,6 +2067,11 @@ void branch_and_bound_t<i_t, f_t>::run_scheduler()
       break;
     }
 
+    prune_open_nodes();
+    spill_open_nodes();
+    trace_bounds(lower_bound);
+    if (toc(last_checkpoint_time_) > settings_.checkpoint_interval) { write_checkpoint(); }
+
     for (auto strategy : strategies) {
       if (active_workers_per_strategy_[strategy] >= max_num_workers_per_type[strategy]) {
         continue;
@@ -1729,6 +2140,8 @@ template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::single_threaded_solve()
 {
   branch_and_bound_worker_t<i_t, f_t> worker(0, original_lp_, Arow_, var_types_, settings_);
+  worker.node_presolver.set_orderings(&symmetry_orderings_);
+  worker.node_presolver.set_conflict_pool(active_conflict_pool());
 
   f_t lower_bound = get_lower_bound();
   f_t abs_gap     = upper_bound_ - lower_bound;
@@ -1763,6 +2176,11 @@ void branch_and_bound_t<i_t, f_t>::single_threaded_solve()
       break;
     }
 
+    prune_open_nodes();
+    spill_open_nodes();
+    trace_bounds(lower_bound);
+    if (toc(last_checkpoint_time_) > settings_.checkpoint_interval) { write_checkpoint(); }
+
     // If there any node left in the heap, we pop the top node and explore it.
     std::optional<mip_node_t<i_t, f_t>*> start_node = node_queue_.pop_best_first();
 
@@ -1945,7 +2363,16 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   is_running_                         = false;
   exploration_stats_.nodes_unexplored = 0;
   exploration_stats_.nodes_explored   = 0;
-  original_lp_.A.to_compressed_row(Arow_);
+  original_lp_.A.to_compressed_row(Arow_, settings_.num_threads);
+
+  // The orderings only restrict the search tree: the bounds of original_lp_, which also check the
+  // solutions of the heuristics, never see them
+  symmetry_orderings_ = symmetry_orderings_t<i_t>{};
+  if (settings_.symmetry == 1 ||
+      (settings_.symmetry == -1 && original_lp_.A.col_start[original_lp_.num_cols] <= 10000000)) {
+    raft::common::nvtx::range scope_symmetry("BB::detect_symmetry");
+    detect_symmetry(original_lp_, Arow_, var_types_, settings_, symmetry_orderings_);
+  }
 
   if (guess_.size() != 0) {
     raft::common::nvtx::range scope_guess("BB::check_initial_guess");
@@ -1959,12 +2386,20 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
     if (feasible) {
       const f_t computed_obj = compute_objective(original_lp_, crushed_guess);
       mutex_upper_.lock();
-      incumbent_.set_incumbent_solution(computed_obj, crushed_guess);
+      set_incumbent(computed_obj, crushed_guess);
       upper_bound_ = computed_obj;
       mutex_upper_.unlock();
     }
   }
 
+  resumed_from_checkpoint_ = resume_from_checkpoint();
+  if (is_solving_checkpoint_part() && checkpoint_.open_nodes.empty()) {
+    // An explored part has nothing left, the tree is not started again from the root
+    solver_status_ = mip_status_t::PART_COMPLETE;
+    set_final_solution(solution, upper_bound_.load());
+    return solver_status_;
+  }
+
   root_relax_soln_.resize(original_lp_.num_rows, original_lp_.num_cols);
 
   i_t original_rows                     = original_lp_.num_rows;
@@ -2091,330 +2526,396 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   f_t root_relax_objective = root_objective_;
 
   i_t cut_pool_size = 0;
-  for (i_t cut_pass = 0; cut_pass < settings_.max_cut_passes; cut_pass++) {
-    if (num_fractional == 0) {
-      set_solution_at_root(solution, cut_info);
-      return mip_status_t::OPTIMAL;
-    } else {
-#ifdef PRINT_FRACTIONAL_INFO
-      settings_.log.printf(
-        "Found %d fractional variables on cut pass %d\n", num_fractional, cut_pass);
-      for (i_t j : fractional) {
-        settings_.log.printf("Fractional variable %d lower %e value %e upper %e\n",
-                             j,
-                             original_lp_.lower[j],
-                             root_relax_soln_.x[j],
-                             original_lp_.upper[j]);
+
+  // The number of cuts added per pass adapts to the bound improvement they bring per second of
+  // the pass: it shrinks when a pass is much less effective than the best one, and grows while
+  // the cap is binding and the passes stay effective
+  const i_t min_cuts_per_pass     = 100;
+  const i_t max_cuts_per_pass     = 8000;
+  i_t cuts_per_pass               = 2000;
+  f_t best_improvement_per_second = 0.0;
+
+  // Integer variables fixed at the root, to decide on a restart of the root
+  auto num_fixed_integers = [&]() {
+    i_t num_fixed = 0;
+    for (i_t j = 0; j < original_lp_.num_cols; j++) {
+      if (var_types_[j] != variable_type_t::CONTINUOUS &&
+          original_lp_.upper[j] - original_lp_.lower[j] < settings_.fixed_tol) {
+        num_fixed++;
       }
+    }
+    return num_fixed;
+  };
+  i_t num_integers = 0;
+  for (i_t j = 0; j < original_lp_.num_cols; j++) {
+    if (var_types_[j] != variable_type_t::CONTINUOUS) { num_integers++; }
+  }
+  i_t num_root_restarts = 0;
+  bool restart_root     = false;
+  do {
+    const i_t fixed_at_start = num_fixed_integers();
+    restart_root             = false;
+    for (i_t cut_pass = 0; cut_pass < settings_.max_cut_passes; cut_pass++) {
+      if (num_fractional == 0) {
+        set_solution_at_root(solution, cut_info);
+        return mip_status_t::OPTIMAL;
+      } else {
+#ifdef PRINT_FRACTIONAL_INFO
+        settings_.log.printf(
+          "Found %d fractional variables on cut pass %d\n", num_fractional, cut_pass);
+        for (i_t j : fractional) {
+          settings_.log.printf("Fractional variable %d lower %e value %e upper %e\n",
+                               j,
+                               original_lp_.lower[j],
+                               root_relax_soln_.x[j],
+                               original_lp_.upper[j]);
+        }
 #endif
 
-      // Generate cuts and add them to the cut pool
-      f_t cut_start_time = tic();
-      cut_generation.generate_cuts(original_lp_,
-                                   settings_,
-                                   Arow_,
-                                   new_slacks_,
-                                   var_types_,
-                                   basis_update,
-                                   root_relax_soln_.x,
-                                   basic_list,
-                                   nonbasic_list);
-      f_t cut_generation_time = toc(cut_start_time);
-      if (cut_generation_time > 1.0) {
-        settings_.log.debug("Cut generation time %.2f seconds\n", cut_generation_time);
-      }
-      // Score the cuts
-      f_t score_start_time = tic();
-      cut_pool.score_cuts(root_relax_soln_.x);
-      f_t score_time = toc(score_start_time);
-      if (score_time > 1.0) { settings_.log.debug("Cut scoring time %.2f seconds\n", score_time); }
-      // Get the best cuts from the cut pool
-      csr_matrix_t<i_t, f_t> cuts_to_add(0, original_lp_.num_cols, 0);
-      std::vector<f_t> cut_rhs;
-      std::vector<cut_type_t> cut_types;
-      i_t num_cuts = cut_pool.get_best_cuts(cuts_to_add, cut_rhs, cut_types);
-      if (num_cuts == 0) { break; }
-      cut_info.record_cut_types(cut_types);
+        // Generate cuts and add them to the cut pool
+        f_t cut_start_time = tic();
+        cut_generation.generate_cuts(original_lp_,
+                                     settings_,
+                                     Arow_,
+                                     new_slacks_,
+                                     var_types_,
+                                     basis_update,
+                                     root_relax_soln_.x,
+                                     basic_list,
+                                     nonbasic_list);
+        f_t cut_generation_time = toc(cut_start_time);
+        if (cut_generation_time > 1.0) {
+          settings_.log.debug("Cut generation time %.2f seconds\n", cut_generation_time);
+        }
+        // Score the cuts
+        f_t score_start_time = tic();
+        cut_pool.score_cuts(root_relax_soln_.x, original_lp_.objective, cuts_per_pass);
+        f_t score_time = toc(score_start_time);
+        if (score_time > 1.0) {
+          settings_.log.debug("Cut scoring time %.2f seconds\n", score_time);
+        }
+        // Get the best cuts from the cut pool
+        csr_matrix_t<i_t, f_t> cuts_to_add(0, original_lp_.num_cols, 0);
+        std::vector<f_t> cut_rhs;
+        std::vector<cut_type_t> cut_types;
+        i_t num_cuts = cut_pool.get_best_cuts(cuts_to_add, cut_rhs, cut_types);
+        if (num_cuts == 0) { break; }
+        cut_info.record_cut_types(cut_types);
 #ifdef PRINT_CUT_POOL_TYPES
-      cut_pool.print_cutpool_types();
-      print_cut_types("In LP      ", cut_types, settings_);
-      printf("Cut pool size: %d\n", cut_pool.pool_size());
+        cut_pool.print_cutpool_types();
+        print_cut_types("In LP      ", cut_types, settings_);
+        printf("Cut pool size: %d\n", cut_pool.pool_size());
 #endif
 
 #ifdef CHECK_CUT_MATRIX
-      if (cuts_to_add.check_matrix() != 0) {
-        settings_.log.printf("Bad cuts matrix\n");
-        for (i_t i = 0; i < static_cast<i_t>(cut_types.size()); ++i) {
-          settings_.log.printf("row %d cut type %d\n", i, cut_types[i]);
+        if (cuts_to_add.check_matrix() != 0) {
+          settings_.log.printf("Bad cuts matrix\n");
+          for (i_t i = 0; i < static_cast<i_t>(cut_types.size()); ++i) {
+            settings_.log.printf("row %d cut type %d\n", i, cut_types[i]);
+          }
+          return mip_status_t::NUMERICAL;
         }
-        return mip_status_t::NUMERICAL;
-      }
 #endif
-      // Check against saved solution
+        // Check against saved solution
 #ifdef CHECK_CUTS_AGAINST_SAVED_SOLUTION
-      verify_cuts_against_saved_solution(cuts_to_add, cut_rhs, saved_solution);
+        verify_cuts_against_saved_solution(cuts_to_add, cut_rhs, saved_solution);
 #endif
-      cut_pool_size = cut_pool.pool_size();
-
-      // Resolve the LP with the new cuts
-      settings_.log.debug(
-        "Solving LP with %d cuts (%d cut nonzeros). Cuts in pool %d. Total constraints %d\n",
-        num_cuts,
-        cuts_to_add.row_start[cuts_to_add.m],
-        cut_pool.pool_size(),
-        cuts_to_add.m + original_lp_.num_rows);
-      lp_settings.log.log = false;
-
-      f_t add_cuts_start_time = tic();
-      mutex_original_lp_.lock();
-      i_t add_cuts_status = add_cuts(settings_,
-                                     cuts_to_add,
-                                     cut_rhs,
-                                     original_lp_,
-                                     new_slacks_,
-                                     root_relax_soln_,
-                                     basis_update,
-                                     basic_list,
-                                     nonbasic_list,
-                                     root_vstatus_,
-                                     edge_norms_);
-      var_types_.resize(original_lp_.num_cols, variable_type_t::CONTINUOUS);
-      mutex_original_lp_.unlock();
-      f_t add_cuts_time = toc(add_cuts_start_time);
-      if (add_cuts_time > 1.0) {
-        settings_.log.debug("Add cuts time %.2f seconds\n", add_cuts_time);
-      }
-      if (add_cuts_status != 0) {
-        settings_.log.printf("Failed to add cuts\n");
-        return mip_status_t::NUMERICAL;
-      }
+        cut_pool_size = cut_pool.pool_size();
 
-      if (settings_.reduced_cost_strengthening >= 1 && upper_bound_.load() < last_upper_bound) {
-        mutex_upper_.lock();
-        last_upper_bound = upper_bound_.load();
-        std::vector<f_t> lower_bounds;
-        std::vector<f_t> upper_bounds;
-        find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
-        mutex_upper_.unlock();
+        // Resolve the LP with the new cuts
+        settings_.log.debug(
+          "Solving LP with %d cuts (%d cut nonzeros). Cuts in pool %d. Total constraints %d\n",
+          num_cuts,
+          cuts_to_add.row_start[cuts_to_add.m],
+          cut_pool.pool_size(),
+          cuts_to_add.m + original_lp_.num_rows);
+        lp_settings.log.log = false;
+
+        f_t add_cuts_start_time = tic();
         mutex_original_lp_.lock();
-        original_lp_.lower = lower_bounds;
-        original_lp_.upper = upper_bounds;
+        i_t add_cuts_status = add_cuts(settings_,
+                                       cuts_to_add,
+                                       cut_rhs,
+                                       original_lp_,
+                                       new_slacks_,
+                                       root_relax_soln_,
+                                       basis_update,
+                                       basic_list,
+                                       nonbasic_list,
+                                       root_vstatus_,
+                                       edge_norms_,
+                                       &Arow_);
+        var_types_.resize(original_lp_.num_cols, variable_type_t::CONTINUOUS);
         mutex_original_lp_.unlock();
-      }
+        f_t add_cuts_time = toc(add_cuts_start_time);
+        if (add_cuts_time > 1.0) {
+          settings_.log.debug("Add cuts time %.2f seconds\n", add_cuts_time);
+        }
+        if (add_cuts_status != 0) {
+          settings_.log.printf("Failed to add cuts\n");
+          return mip_status_t::NUMERICAL;
+        }
+
+        if (settings_.reduced_cost_strengthening >= 1 && upper_bound_.load() < last_upper_bound) {
+          mutex_upper_.lock();
+          last_upper_bound = upper_bound_.load();
+          std::vector<f_t> lower_bounds;
+          std::vector<f_t> upper_bounds;
+          find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
+          mutex_upper_.unlock();
+          mutex_original_lp_.lock();
+          original_lp_.lower = lower_bounds;
+          original_lp_.upper = upper_bounds;
+          mutex_original_lp_.unlock();
+        }
 
-      // Try to do bound strengthening
-      std::vector<bool> bounds_changed(original_lp_.num_cols, true);
-      std::vector<char> row_sense;
+        // Try to do bound strengthening
+        std::vector<bool> bounds_changed(original_lp_.num_cols, true);
+        std::vector<char> row_sense;
 #ifdef CHECK_MATRICES
-      settings_.log.printf("Before A check\n");
-      original_lp_.A.check_matrix();
+        settings_.log.printf("Before A check\n");
+        original_lp_.A.check_matrix();
 #endif
-      original_lp_.A.to_compressed_row(Arow_);
-
-      f_t node_presolve_start_time = tic();
-      bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
-      std::vector<f_t> new_lower = original_lp_.lower;
-      std::vector<f_t> new_upper = original_lp_.upper;
-      bool feasible =
-        node_presolve.bounds_strengthening(settings_, bounds_changed, new_lower, new_upper);
-      mutex_original_lp_.lock();
-      original_lp_.lower = new_lower;
-      original_lp_.upper = new_upper;
-      mutex_original_lp_.unlock();
-      f_t node_presolve_time = toc(node_presolve_start_time);
-      if (node_presolve_time > 1.0) {
-        settings_.log.debug("Node presolve time %.2f seconds\n", node_presolve_time);
-      }
-      if (!feasible) {
-        settings_.log.printf("Bound strengthening detected infeasibility\n");
-        return mip_status_t::INFEASIBLE;
-      }
 
-      i_t iter                    = 0;
-      bool initialize_basis       = false;
-      lp_settings.concurrent_halt = NULL;
-      f_t dual_phase2_start_time  = tic();
-      dual::status_t cut_status   = dual_phase2_with_advanced_basis(2,
-                                                                  0,
-                                                                  initialize_basis,
-                                                                  exploration_stats_.start_time,
-                                                                  original_lp_,
-                                                                  lp_settings,
-                                                                  root_vstatus_,
-                                                                  basis_update,
-                                                                  basic_list,
-                                                                  nonbasic_list,
-                                                                  root_relax_soln_,
-                                                                  iter,
-                                                                  edge_norms_);
-      exploration_stats_.total_lp_iters += iter;
-      root_objective_      = compute_objective(original_lp_, root_relax_soln_.x);
-      f_t dual_phase2_time = toc(dual_phase2_start_time);
-      if (dual_phase2_time > 1.0) {
-        settings_.log.debug("Dual phase2 time %.2f seconds\n", dual_phase2_time);
-      }
-      if (cut_status == dual::status_t::TIME_LIMIT) {
-        solver_status_ = mip_status_t::TIME_LIMIT;
-        set_final_solution(solution, root_objective_);
-        return solver_status_;
-      }
-
-      if (cut_status != dual::status_t::OPTIMAL) {
-        settings_.log.printf("Numerical issue at root node. Resolving from scratch\n");
-        lp_status_t scratch_status =
-          solve_linear_program_with_advanced_basis(original_lp_,
-                                                   exploration_stats_.start_time,
-                                                   lp_settings,
-                                                   root_relax_soln_,
-                                                   basis_update,
-                                                   basic_list,
-                                                   nonbasic_list,
-                                                   root_vstatus_,
-                                                   edge_norms_);
-        if (scratch_status == lp_status_t::OPTIMAL) {
-          // We recovered
-          cut_status = convert_lp_status_to_dual_status(scratch_status);
-          exploration_stats_.total_lp_iters += root_relax_soln_.iterations;
-          root_objective_ = compute_objective(original_lp_, root_relax_soln_.x);
-        } else {
-          settings_.log.printf("Cut status %s\n", dual::status_to_string(cut_status).c_str());
-          return mip_status_t::NUMERICAL;
+        f_t node_presolve_start_time = tic();
+        bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
+        std::vector<f_t> new_lower = original_lp_.lower;
+        std::vector<f_t> new_upper = original_lp_.upper;
+        bool feasible =
+          node_presolve.bounds_strengthening(settings_, bounds_changed, new_lower, new_upper);
+        mutex_original_lp_.lock();
+        original_lp_.lower = new_lower;
+        original_lp_.upper = new_upper;
+        mutex_original_lp_.unlock();
+        f_t node_presolve_time = toc(node_presolve_start_time);
+        if (node_presolve_time > 1.0) {
+          settings_.log.debug("Node presolve time %.2f seconds\n", node_presolve_time);
+        }
+        if (!feasible) {
+          settings_.log.printf("Bound strengthening detected infeasibility\n");
+          return mip_status_t::INFEASIBLE;
         }
-      }
 
-      f_t remove_cuts_start_time = tic();
-      mutex_original_lp_.lock();
-      remove_cuts(original_lp_,
-                  settings_,
-                  exploration_stats_.start_time,
-                  Arow_,
-                  new_slacks_,
-                  original_rows,
-                  var_types_,
-                  root_vstatus_,
-                  edge_norms_,
-                  root_relax_soln_.x,
-                  root_relax_soln_.y,
-                  root_relax_soln_.z,
-                  basic_list,
-                  nonbasic_list,
-                  basis_update);
-      mutex_original_lp_.unlock();
-      f_t remove_cuts_time = toc(remove_cuts_start_time);
-      if (remove_cuts_time > 1.0) {
-        settings_.log.debug("Remove cuts time %.2f seconds\n", remove_cuts_time);
-      }
-      fractional.clear();
-      num_fractional = fractional_variables(settings_, root_relax_soln_.x, var_types_, fractional);
+        i_t iter                    = 0;
+        bool initialize_basis       = false;
+        lp_settings.concurrent_halt = NULL;
+        f_t dual_phase2_start_time  = tic();
+        dual::status_t cut_status   = dual_phase2_with_advanced_basis(2,
+                                                                    0,
+                                                                    initialize_basis,
+                                                                    exploration_stats_.start_time,
+                                                                    original_lp_,
+                                                                    lp_settings,
+                                                                    root_vstatus_,
+                                                                    basis_update,
+                                                                    basic_list,
+                                                                    nonbasic_list,
+                                                                    root_relax_soln_,
+                                                                    iter,
+                                                                    edge_norms_);
+        exploration_stats_.total_lp_iters += iter;
+        root_objective_      = compute_objective(original_lp_, root_relax_soln_.x);
+        f_t dual_phase2_time = toc(dual_phase2_start_time);
+        if (dual_phase2_time > 1.0) {
+          settings_.log.debug("Dual phase2 time %.2f seconds\n", dual_phase2_time);
+        }
+        if (cut_status == dual::status_t::TIME_LIMIT) {
+          solver_status_ = mip_status_t::TIME_LIMIT;
+          set_final_solution(solution, root_objective_);
+          return solver_status_;
+        }
 
-      if (num_fractional == 0) {
-        upper_bound_ = root_objective_;
-        mutex_upper_.lock();
-        incumbent_.set_incumbent_solution(root_objective_, root_relax_soln_.x);
-        mutex_upper_.unlock();
-      }
-      f_t obj = upper_bound_.load();
-      report(' ', obj, root_objective_, 0, num_fractional);
+        if (cut_status != dual::status_t::OPTIMAL) {
+          settings_.log.printf("Numerical issue at root node. Resolving from scratch\n");
+          lp_status_t scratch_status =
+            solve_linear_program_with_advanced_basis(original_lp_,
+                                                     exploration_stats_.start_time,
+                                                     lp_settings,
+                                                     root_relax_soln_,
+                                                     basis_update,
+                                                     basic_list,
+                                                     nonbasic_list,
+                                                     root_vstatus_,
+                                                     edge_norms_);
+          if (scratch_status == lp_status_t::OPTIMAL) {
+            // We recovered
+            cut_status = convert_lp_status_to_dual_status(scratch_status);
+            exploration_stats_.total_lp_iters += root_relax_soln_.iterations;
+            root_objective_ = compute_objective(original_lp_, root_relax_soln_.x);
+          } else {
+            settings_.log.printf("Cut status %s\n", dual::status_to_string(cut_status).c_str());
+            return mip_status_t::NUMERICAL;
+          }
+        }
 
-      f_t rel_gap = user_relative_gap(original_lp_, upper_bound_.load(), root_objective_);
-      f_t abs_gap = upper_bound_.load() - root_objective_;
-      if (rel_gap < settings_.relative_mip_gap_tol || abs_gap < settings_.absolute_mip_gap_tol) {
-        set_solution_at_root(solution, cut_info);
-        set_final_solution(solution, root_objective_);
-        return mip_status_t::OPTIMAL;
-      }
+        f_t remove_cuts_start_time = tic();
+        mutex_original_lp_.lock();
+        remove_cuts(original_lp_,
+                    settings_,
+                    exploration_stats_.start_time,
+                    Arow_,
+                    new_slacks_,
+                    original_rows,
+                    var_types_,
+                    root_vstatus_,
+                    edge_norms_,
+                    root_relax_soln_.x,
+                    root_relax_soln_.y,
+                    root_relax_soln_.z,
+                    basic_list,
+                    nonbasic_list,
+                    basis_update);
+        mutex_original_lp_.unlock();
+        f_t remove_cuts_time = toc(remove_cuts_start_time);
+        if (remove_cuts_time > 1.0) {
+          settings_.log.debug("Remove cuts time %.2f seconds\n", remove_cuts_time);
+        }
+        fractional.clear();
+        num_fractional =
+          fractional_variables(settings_, root_relax_soln_.x, var_types_, fractional);
+
+        if (num_fractional == 0) {
+          upper_bound_ = root_objective_;
+          mutex_upper_.lock();
+          set_incumbent(root_objective_, root_relax_soln_.x);
+          mutex_upper_.unlock();
+        }
+        f_t obj = upper_bound_.load();
+        report(' ', obj, root_objective_, 0, num_fractional);
+
+        f_t rel_gap = user_relative_gap(original_lp_, upper_bound_.load(), root_objective_);
+        f_t abs_gap = upper_bound_.load() - root_objective_;
+        if (rel_gap < settings_.relative_mip_gap_tol || abs_gap < settings_.absolute_mip_gap_tol) {
+          set_solution_at_root(solution, cut_info);
+          set_final_solution(solution, root_objective_);
+          return mip_status_t::OPTIMAL;
+        }
 
-      f_t change_in_objective = root_objective_ - last_objective;
-      const f_t factor        = settings_.cut_change_threshold;
-      const f_t min_objective = 1e-3;
-      if (change_in_objective <= factor * std::max(min_objective, std::abs(root_relax_objective))) {
-        settings_.log.debug(
-          "Change in objective %.16e is less than 1e-3 of root relax objective %.16e\n",
-          change_in_objective,
-          root_relax_objective);
-        break;
+        f_t change_in_objective = root_objective_ - last_objective;
+        const f_t pass_time     = std::max(toc(cut_start_time), f_t(1e-6));
+        const f_t improvement_per_second = std::max(change_in_objective, f_t(0.0)) / pass_time;
+        if (improvement_per_second < 0.5 * best_improvement_per_second) {
+          cuts_per_pass = std::max(min_cuts_per_pass, cuts_per_pass / 2);
+        } else if (num_cuts >= cuts_per_pass) {
+          cuts_per_pass = std::min(max_cuts_per_pass, cuts_per_pass + cuts_per_pass / 2);
+        }
+        best_improvement_per_second = std::max(best_improvement_per_second, improvement_per_second);
+
+        const f_t factor        = settings_.cut_change_threshold;
+        const f_t min_objective = 1e-3;
+        if (change_in_objective <=
+            factor * std::max(min_objective, std::abs(root_relax_objective))) {
+          settings_.log.debug(
+            "Change in objective %.16e is less than 1e-3 of root relax objective %.16e\n",
+            change_in_objective,
+            root_relax_objective);
+          break;
+        }
+        last_objective = root_objective_;
       }
-      last_objective = root_objective_;
     }
-  }
 
-  print_cut_info(settings_, cut_info);
+    print_cut_info(settings_, cut_info);
 
-  if (cut_info.has_cuts()) {
-    settings_.log.printf("Cut pool size  : %d\n", cut_pool_size);
-    settings_.log.printf("Size with cuts : %d constraints, %d variables, %d nonzeros\n",
-                         original_lp_.num_rows,
-                         original_lp_.num_cols,
-                         original_lp_.A.col_start[original_lp_.A.n]);
-  }
+    if (cut_info.has_cuts()) {
+      settings_.log.printf("Cut pool size  : %d\n", cut_pool_size);
+      settings_.log.printf("Size with cuts : %d constraints, %d variables, %d nonzeros\n",
+                           original_lp_.num_rows,
+                           original_lp_.num_cols,
+                           original_lp_.A.col_start[original_lp_.A.n]);
+    }
 
-  set_uninitialized_steepest_edge_norms(original_lp_, basic_list, edge_norms_);
+    set_uninitialized_steepest_edge_norms(original_lp_, basic_list, edge_norms_);
+
+    if (num_root_restarts > 0) {
+      // The pseudocosts of the strong branching before the restart are kept
+      const auto pseudo_costs = pc_.create_snapshot();
+      pc_.resize(original_lp_.num_cols);
+      pc_.restore_snapshot(pseudo_costs);
+    } else if (resumed_from_checkpoint_) {
+      pc_.resize(original_lp_.num_cols);
+      // The pseudocosts of the previous run replace the strong branching
+      pc_.restore_snapshot(checkpoint_.pseudo_costs);
+    } else {
+      pc_.resize(original_lp_.num_cols);
+      raft::common::nvtx::range scope_sb("BB::strong_branching");
+      strong_branching<i_t, f_t>(original_problem_,
+                                 original_lp_,
+                                 settings_,
+                                 exploration_stats_.start_time,
+                                 var_types_,
+                                 root_relax_soln_.x,
+                                 fractional,
+                                 root_objective_,
+                                 root_vstatus_,
+                                 edge_norms_,
+                                 pc_);
+    }
 
-  pc_.resize(original_lp_.num_cols);
-  {
-    raft::common::nvtx::range scope_sb("BB::strong_branching");
-    strong_branching<i_t, f_t>(original_problem_,
-                               original_lp_,
-                               settings_,
-                               exploration_stats_.start_time,
-                               var_types_,
-                               root_relax_soln_.x,
-                               fractional,
-                               root_objective_,
-                               root_vstatus_,
-                               edge_norms_,
-                               pc_);
-  }
+    if (toc(exploration_stats_.start_time) > settings_.time_limit) {
+      solver_status_ = mip_status_t::TIME_LIMIT;
+      set_final_solution(solution, root_objective_);
+      return solver_status_;
+    }
 
-  if (toc(exploration_stats_.start_time) > settings_.time_limit) {
-    solver_status_ = mip_status_t::TIME_LIMIT;
-    set_final_solution(solution, root_objective_);
-    return solver_status_;
-  }
+    if (settings_.reduced_cost_strengthening >= 2 && upper_bound_.load() < last_upper_bound) {
+      std::vector<f_t> lower_bounds;
+      std::vector<f_t> upper_bounds;
+      i_t num_fixed = find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
+      if (num_fixed > 0) {
+        std::vector<bool> bounds_changed(original_lp_.num_cols, true);
+        std::vector<char> row_sense;
 
-  if (settings_.reduced_cost_strengthening >= 2 && upper_bound_.load() < last_upper_bound) {
-    std::vector<f_t> lower_bounds;
-    std::vector<f_t> upper_bounds;
-    i_t num_fixed = find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
-    if (num_fixed > 0) {
-      std::vector<bool> bounds_changed(original_lp_.num_cols, true);
-      std::vector<char> row_sense;
-
-      bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
-
-      mutex_original_lp_.lock();
-      original_lp_.lower = lower_bounds;
-      original_lp_.upper = upper_bounds;
-      bool feasible      = node_presolve.bounds_strengthening(
-        settings_, bounds_changed, original_lp_.lower, original_lp_.upper);
-      mutex_original_lp_.unlock();
-      if (!feasible) {
-        settings_.log.printf("Bound strengthening failed\n");
-        return mip_status_t::NUMERICAL;  // We had a feasible integer solution, but bound
-                                         // strengthening thinks we are infeasible.
-      }
-      // Go through and check the fractional variables and remove any that are now fixed to their
-      // bounds
-      std::vector<i_t> to_remove(fractional.size(), 0);
-      i_t num_to_remove = 0;
-      for (i_t k = 0; k < fractional.size(); k++) {
-        const i_t j = fractional[k];
-        if (std::abs(original_lp_.upper[j] - original_lp_.lower[j]) < settings_.fixed_tol) {
-          to_remove[k] = 1;
-          num_to_remove++;
+        bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
+
+        mutex_original_lp_.lock();
+        original_lp_.lower = lower_bounds;
+        original_lp_.upper = upper_bounds;
+        bool feasible      = node_presolve.bounds_strengthening(
+          settings_, bounds_changed, original_lp_.lower, original_lp_.upper);
+        mutex_original_lp_.unlock();
+        if (!feasible) {
+          settings_.log.printf("Bound strengthening failed\n");
+          return mip_status_t::NUMERICAL;  // We had a feasible integer solution, but bound
+                                           // strengthening thinks we are infeasible.
         }
-      }
-      if (num_to_remove > 0) {
-        std::vector<i_t> new_fractional;
-        new_fractional.reserve(fractional.size() - num_to_remove);
+        // Go through and check the fractional variables and remove any that are now fixed to their
+        // bounds
+        std::vector<i_t> to_remove(fractional.size(), 0);
+        i_t num_to_remove = 0;
         for (i_t k = 0; k < fractional.size(); k++) {
-          if (!to_remove[k]) { new_fractional.push_back(fractional[k]); }
+          const i_t j = fractional[k];
+          if (std::abs(original_lp_.upper[j] - original_lp_.lower[j]) < settings_.fixed_tol) {
+            to_remove[k] = 1;
+            num_to_remove++;
+          }
+        }
+        if (num_to_remove > 0) {
+          std::vector<i_t> new_fractional;
+          new_fractional.reserve(fractional.size() - num_to_remove);
+          for (i_t k = 0; k < fractional.size(); k++) {
+            if (!to_remove[k]) { new_fractional.push_back(fractional[k]); }
+          }
+          fractional     = new_fractional;
+          num_fractional = fractional.size();
         }
-        fractional     = new_fractional;
-        num_fractional = fractional.size();
       }
     }
-  }
+
+    // Many fixings make for a different root problem: run the cut passes again on it, with the
+    // same cut pool, rather than branching on the cuts of the original one
+    if (num_root_restarts < settings_.max_root_restarts && settings_.max_cut_passes > 0 &&
+        num_fractional > 0) {
+      const i_t num_fixed = num_fixed_integers();
+      if (num_fixed - fixed_at_start > settings_.root_restart_fraction * num_integers) {
+        settings_.log.printf("Restarting the root with %d of %d integer variables fixed\n",
+                             num_fixed,
+                             num_integers);
+        num_root_restarts++;
+        restart_root = true;
+      }
+    }
+  } while (restart_root);
 
   // Choose variable to branch on
   i_t branch_var = pc_.variable_selection(fractional, root_relax_soln_.x, log);
@@ -2422,23 +2923,33 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   search_tree_.root      = std::move(mip_node_t<i_t, f_t>(root_objective_, root_vstatus_));
   search_tree_.num_nodes = 0;
   search_tree_.graphviz_node(settings_.log, &search_tree_.root, "lower bound", root_objective_);
-  search_tree_.branch(&search_tree_.root,
-                      branch_var,
-                      root_relax_soln_.x[branch_var],
-                      num_fractional,
-                      root_vstatus_,
-                      original_lp_,
-                      log);
-  node_queue_.push(search_tree_.root.get_down_child());
-  node_queue_.push(search_tree_.root.get_up_child());
+  i_t num_open_nodes = 2;
+  if (resumed_from_checkpoint_ && !checkpoint_.open_nodes.empty()) {
+    std::vector<mip_node_t<i_t, f_t>*> leaves =
+      restore_open_nodes(search_tree_, original_lp_, checkpoint_.open_nodes, root_vstatus_);
+    node_queue_.push(leaves.data(), leaves.size());
+    num_open_nodes = leaves.size();
+  } else {
+    search_tree_.branch(&search_tree_.root,
+                        branch_var,
+                        root_relax_soln_.x[branch_var],
+                        num_fractional,
+                        root_vstatus_,
+                        original_lp_,
+                        log);
+    node_queue_.push(search_tree_.root.get_down_child());
+    node_queue_.push(search_tree_.root.get_up_child());
+  }
+  checkpoint_.open_nodes.clear();
 
   settings_.log.printf("Exploring the B&B tree using %d threads\n\n", settings_.num_threads);
 
   exploration_stats_.nodes_explored       = 0;
-  exploration_stats_.nodes_unexplored     = 2;
+  exploration_stats_.nodes_unexplored     = num_open_nodes;
   exploration_stats_.nodes_since_last_log = 0;
   exploration_stats_.last_log             = tic();
   min_node_queue_size_                    = 2 * settings_.num_threads;
+  last_checkpoint_time_                   = tic();
 
   if (settings_.diving_settings.coefficient_diving != 0) {
     calculate_variable_locks(original_lp_, var_up_locks_, var_down_locks_);
@@ -2453,6 +2964,22 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
       "|   Gap    |  Time  |\n");
   }
 
+  if (!settings_.trace_file.empty()) {
+    // Deterministic mode records the events of all the workers from the coordinator
+    trace_scheduler_ring_ = 2 * settings_.num_threads;
+    if (!trace_.open(settings_.trace_file, trace_scheduler_ring_ + 1)) {
+      settings_.log.printf("Could not create the trace file %s\n", settings_.trace_file.c_str());
+    }
+  }
+
+  // The conflicts depend on the order in which the nodes are pruned, so the deterministic mode
+  // does without them
+  if (settings_.conflict_analysis != 0 && !settings_.deterministic) {
+    conflict_pool_.activate(original_lp_.lower, original_lp_.upper);
+  }
+
+  const f_t tree_search_start         = tic();
+  const int64_t nodes_before_tree_search = exploration_stats_.nodes_explored;
   if (settings_.deterministic) {
     run_deterministic_coordinator(Arow_);
   } else if (settings_.num_threads > 1) {
@@ -2464,8 +2991,17 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   } else {
     single_threaded_solve();
   }
+  contention_stats_.tree_search_time = toc(tree_search_start);
+  contention_stats_.nodes_explored   = exploration_stats_.nodes_explored - nodes_before_tree_search;
+  contention_stats_.worker_idle_time = worker_pool_.get_idle_times();
 
   is_running_ = false;
+  trace_.close();
+
+  // Save the search before the queue is emptied below, so it can be resumed past the limit
+  if (solver_status_ == mip_status_t::TIME_LIMIT || solver_status_ == mip_status_t::NODE_LIMIT) {
+    write_checkpoint(true);
+  }
 
   // Compute final lower bound
   f_t lower_bound;
@@ -2499,6 +3035,14 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
     }
   }
   set_final_solution(solution, lower_bound);
+  // A finished search has nothing left to resume. An explored part keeps its checkpoint, without
+  // open nodes, as the record of its incumbent for the combination of the parts
+  if (!settings_.checkpoint_file.empty() && (solver_status_ == mip_status_t::OPTIMAL ||
+                                             solver_status_ == mip_status_t::INFEASIBLE)) {
+    std::remove(settings_.checkpoint_file.c_str());
+  } else if (solver_status_ == mip_status_t::PART_COMPLETE) {
+    write_checkpoint();
+  }
   return solver_status_;
 }
 
@@ -2672,17 +3216,19 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_coordinator(const csr_matri
   scoped_context_registrations_t context_registrations(*deterministic_scheduler_);
   for (auto& worker : *deterministic_workers_) {
     context_registrations.add(worker.work_context);
+    worker.node_presolver.set_orderings(&symmetry_orderings_);
   }
   if (deterministic_diving_workers_) {
     for (auto& worker : *deterministic_diving_workers_) {
       context_registrations.add(worker.work_context);
+      worker.node_presolver.set_orderings(&symmetry_orderings_);
     }
   }
 
   int actual_diving_workers =
     deterministic_diving_workers_ ? (int)deterministic_diving_workers_->size() : 0;
   settings_.log.printf(
-    "Deterministic Mode: %d BFS workers + %d diving workers, horizon step = %.2f work "
+    "Deterministic Mode: %d BFS workers + %d diving workers, initial horizon step = %.2f work "
     "units\n",
     num_bfs_workers,
     actual_diving_workers,
@@ -2824,7 +3370,8 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_bfs_loop(
     }
 
     // No work - advance to sync point to participate in barrier
-    f_t nowork_start = tic();
+    worker.idle_this_horizon = true;
+    f_t nowork_start         = tic();
     deterministic_scheduler_->wait_for_next_sync(worker.work_context);
     worker.total_nowork_time += toc(nowork_start);
   }
@@ -2848,6 +3395,24 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
   work_unit_context_.global_work_units_elapsed = horizon_end;
 
   bb_event_batch_t<i_t, f_t> all_events = deterministic_workers_->collect_and_sort_events();
+  if (trace_.is_open()) {
+    for (const auto& event : all_events.events) {
+      f_t value = 0;
+      if (event.type == bb_event_type_t::NODE_BRANCHED) {
+        value = event.payload.branched.node_lower_bound;
+      } else if (event.type == bb_event_type_t::NODE_INTEGER) {
+        value = event.payload.integer_solution.objective_value;
+      } else if (event.type == bb_event_type_t::NODE_FATHOMED) {
+        value = event.payload.fathomed.lower_bound;
+      }
+      trace_.record(trace_scheduler_ring_,
+                    static_cast<bb_trace_kind_t>(event.type),
+                    event.worker_id,
+                    event.node_id,
+                    -1,
+                    value);
+    }
+  }
 
   deterministic_sort_replay_events(all_events);
 
@@ -2904,6 +3469,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
     state_hash ^= pc_.compute_state_hash();
   }
 
+  deterministic_adapt_horizon_step();
   deterministic_current_horizon_ += deterministic_horizon_step_;
 
   std::vector<f_t> incumbent_snapshot;
@@ -3036,6 +3602,7 @@ node_status_t branch_and_bound_t<i_t, f_t>::solve_node_deterministic(
 
   // Solve LP relaxation
   worker.leaf_solution.resize(worker.leaf_problem.num_rows, worker.leaf_problem.num_cols);
+  node_ptr->unpack_vstatus();
   std::vector<variable_status_t>& leaf_vstatus = node_ptr->vstatus;
   i_t node_iter                                = 0;
   f_t lp_start_time                            = tic();
@@ -3125,7 +3692,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_process_worker_solutions(
       bool improved = false;
       if (sol->objective < upper_bound_) {
         upper_bound_ = sol->objective;
-        incumbent_.set_incumbent_solution(sol->objective, sol->solution);
+        set_incumbent(sol->objective, sol->solution);
         current_upper = sol->objective;
         improved      = true;
       }
@@ -3288,7 +3855,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sort_replay_events(
 
       if (hsol.objective < upper_bound_) {
         upper_bound_ = hsol.objective;
-        incumbent_.set_incumbent_solution(hsol.objective, hsol.solution);
+        set_incumbent(hsol.objective, hsol.solution);
         new_upper = hsol.objective;
       }
 
@@ -3357,6 +3924,27 @@ void branch_and_bound_t<i_t, f_t>::deterministic_prune_worker_nodes_vs_incumbent
   }
 }
 
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::deterministic_adapt_horizon_step()
+{
+  constexpr double min_horizon_step = 0.05;
+  constexpr double max_horizon_step = 2.0;
+
+  i_t num_idle = 0;
+  for (auto& worker : *deterministic_workers_) {
+    if (worker.idle_this_horizon) { ++num_idle; }
+    worker.idle_this_horizon = false;
+  }
+
+  const i_t num_workers = deterministic_workers_->size();
+  if (2 * num_idle > num_workers) {
+    deterministic_horizon_step_ = std::max(min_horizon_step, 0.5 * deterministic_horizon_step_);
+  } else if (num_idle == 0) {
+    deterministic_horizon_step_ = std::min(max_horizon_step, 1.25 * deterministic_horizon_step_);
+  }
+  deterministic_scheduler_->set_sync_interval(deterministic_horizon_step_);
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::deterministic_balance_worker_loads()
 {
@@ -3648,6 +4236,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_dive(
 
     // Solve LP relaxation
     worker.leaf_solution.resize(worker.leaf_problem.num_rows, worker.leaf_problem.num_cols);
+    node_ptr->unpack_vstatus();
     std::vector<variable_status_t>& leaf_vstatus = node_ptr->vstatus;
     i_t node_iter                                = 0;
     f_t lp_start_time                            = tic();
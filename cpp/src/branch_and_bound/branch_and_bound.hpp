@@ -8,7 +8,9 @@
 #pragma once
 
 #include <branch_and_bound/bb_event.hpp>
+#include <branch_and_bound/bb_trace.hpp>
 #include <branch_and_bound/branch_and_bound_worker.hpp>
+#include <branch_and_bound/checkpoint.hpp>
 #include <branch_and_bound/deterministic_workers.hpp>
 #include <branch_and_bound/diving_heuristics.hpp>
 #include <branch_and_bound/mip_node.hpp>
@@ -17,13 +19,16 @@
 
 #include <cuts/cuts.hpp>
 
+#include <dual_simplex/conflict_pool.hpp>
 #include <dual_simplex/initial_basis.hpp>
 #include <dual_simplex/phase2.hpp>
 #include <dual_simplex/simplex_solver_settings.hpp>
 #include <dual_simplex/solution.hpp>
 #include <dual_simplex/solve.hpp>
+#include <dual_simplex/symmetry.hpp>
 #include <dual_simplex/types.hpp>
 
+#include <utilities/incumbent_bus.hpp>
 #include <utilities/macros.cuh>
 #include <utilities/omp_helpers.hpp>
 #include <utilities/producer_sync.hpp>
@@ -46,6 +51,9 @@ enum class mip_status_t {
   NUMERICAL  = 5,  // The solver encountered a numerical error
   UNSET      = 6,  // The status is not set
   WORK_LIMIT = 7,  // The solver reached a deterministic work limit
+  // The open nodes of a checkpoint part were all explored. The bound only covers the subtrees of
+  // the part, the problem is solved once all of its parts are
+  PART_COMPLETE = 8,
 };
 
 template <typename i_t, typename f_t>
@@ -63,6 +71,19 @@ struct deterministic_bfs_policy_t;
 template <typename i_t, typename f_t>
 struct deterministic_diving_policy_t;
 
+// Scaling of the parallel tree search: the time the threads spent blocked on the shared locks and
+// the time each worker waited in the idle list of the pool
+template <typename f_t>
+struct branch_and_bound_contention_stats_t {
+  f_t tree_search_time          = 0.0;
+  int64_t nodes_explored        = 0;
+  f_t upper_wait_time           = 0.0;
+  f_t heuristic_queue_wait_time = 0.0;
+  f_t original_lp_wait_time     = 0.0;
+  int64_t num_contended_locks   = 0;
+  std::vector<f_t> worker_idle_time;
+};
+
 template <typename i_t, typename f_t>
 class branch_and_bound_t {
  public:
@@ -104,6 +125,16 @@ class branch_and_bound_t {
     user_bound_callback_ = std::move(callback);
   }
 
+  // New incumbents and lower bounds are published to the bus for the heuristics
+  void set_incumbent_bus(cuopt::incumbent_bus_t* bus) { incumbent_bus_ = bus; }
+
+  // True when the search resumed a part of a split checkpoint, its lower bound then only covers
+  // the subtrees of the part
+  bool is_solving_checkpoint_part() const
+  {
+    return resumed_from_checkpoint_ && checkpoint_.is_part();
+  }
+
   void set_concurrent_lp_root_solve(bool enable) { enable_concurrent_lp_root_solve_ = enable; }
 
   bool stop_for_time_limit(mip_solution_t<i_t, f_t>& solution);
@@ -138,6 +169,18 @@ class branch_and_bound_t {
   // Get producer sync for external heuristics (e.g., CPUFJ) to register
   producer_sync_t& get_producer_sync() { return producer_sync_; }
 
+  branch_and_bound_contention_stats_t<f_t> get_contention_stats() const
+  {
+    auto stats                      = contention_stats_;
+    stats.upper_wait_time           = mutex_upper_.get_wait_time();
+    stats.heuristic_queue_wait_time = mutex_heuristic_queue_.get_wait_time();
+    stats.original_lp_wait_time     = mutex_original_lp_.get_wait_time();
+    stats.num_contended_locks       = mutex_upper_.get_num_contended();
+    stats.num_contended_locks += mutex_heuristic_queue_.get_num_contended();
+    stats.num_contended_locks += mutex_original_lp_.get_num_contended();
+    return stats;
+  }
+
  private:
   const user_problem_t<i_t, f_t>& original_problem_;
   const simplex_solver_settings_t<i_t, f_t> settings_;
@@ -153,6 +196,16 @@ class branch_and_bound_t {
   std::vector<i_t> new_slacks_;
   std::vector<variable_type_t> var_types_;
 
+  // Symmetry breaking orderings of the integer variables, propagated at the nodes
+  symmetry_orderings_t<i_t> symmetry_orderings_;
+
+  // Conflicts of the pruned nodes, shared by the workers and propagated at the nodes
+  conflict_pool_t<i_t, f_t> conflict_pool_;
+  const conflict_pool_t<i_t, f_t>* active_conflict_pool() const
+  {
+    return conflict_pool_.active() ? &conflict_pool_ : nullptr;
+  }
+
   // Variable locks (see definition 3.3 from T. Achterberg, “Constraint Integer Programming,”
   // PhD, Technischen Universität Berlin, Berlin, 2007. doi: 10.14279/depositonce-1634).
   // Here we assume that the constraints are in the form `Ax = b, l <= x <= u`.
@@ -164,10 +217,10 @@ class branch_and_bound_t {
   // size of the original LP by adding slacks for cuts. Heuristic threads should lock
   // this mutex when accessing the original LP. The main thread should lock this mutex
   // when modifying the original LP.
-  omp_mutex_t mutex_original_lp_;
+  omp_timed_mutex_t mutex_original_lp_;
 
   // Mutex for upper bound
-  omp_mutex_t mutex_upper_;
+  omp_timed_mutex_t mutex_upper_;
 
   // Global variable for upper bound
   omp_atomic_t<f_t> upper_bound_;
@@ -178,6 +231,9 @@ class branch_and_bound_t {
   // Structure with the general info of the solver.
   branch_and_bound_stats_t<i_t, f_t> exploration_stats_;
 
+  // Time, nodes and idle times of the tree search, the lock wait times are read from the mutexes
+  branch_and_bound_contention_stats_t<f_t> contention_stats_;
+
   // Mutex for repair
   omp_mutex_t mutex_repair_;
   std::vector<std::vector<f_t>> repair_queue_;
@@ -197,9 +253,32 @@ class branch_and_bound_t {
   // Pseudocosts
   pseudo_costs_t<i_t, f_t> pc_;
 
+  // Dives on the GPU from the start of the CPU dives, see diving_settings.gpu_diving
+  batch_pdlp_diving_t<i_t, f_t> batch_pdlp_diving_;
+
+  // Trace of the search written to settings_.trace_file, with a ring for each worker and a last
+  // one for the scheduler
+  bb_trace_t trace_;
+  int trace_scheduler_ring_{0};
+  f_t traced_lower_bound_{-inf};
+  f_t traced_upper_bound_{inf};
+
   // Heap storing the nodes waiting to be explored.
   node_queue_t<i_t, f_t> node_queue_;
 
+  // File receiving the bases of the queued nodes over settings_.node_memory_limit. Created on
+  // the first spill, nullptr afterwards if a spill failed
+  std::shared_ptr<node_spill_file_t> node_spill_file_;
+  bool node_spill_enabled_{true};
+  // Upper bound the queue was last pruned against
+  f_t pruned_upper_bound_{inf};
+
+  // Search state read from settings_.checkpoint_file. The open nodes are released once the tree
+  // is rebuilt from them, the part fields tell whether the bound of the search is a global one
+  bnb_checkpoint_t<i_t, f_t> checkpoint_;
+  bool resumed_from_checkpoint_{false};
+  f_t last_checkpoint_time_{0.0};
+
   // Search tree
   search_tree_t<i_t, f_t> search_tree_;
 
@@ -223,6 +302,10 @@ class branch_and_bound_t {
   // its blocks the progression of the lower bound.
   omp_atomic_t<f_t> lower_bound_ceiling_;
   std::function<void(f_t)> user_bound_callback_;
+  cuopt::incumbent_bus_t* incumbent_bus_{nullptr};
+
+  // Installs a new incumbent and publishes its objective to the bus
+  void set_incumbent(f_t obj, const std::vector<f_t>& x);
 
   void report_heuristic(f_t obj);
   void report(char symbol,
@@ -232,6 +315,31 @@ class branch_and_bound_t {
               i_t node_int_infeas,
               double work_time = -1);
 
+  // Spills the bases of the worst queued nodes to disk when the queue holds more than
+  // settings_.node_memory_limit of them, down to half of the limit
+  void spill_open_nodes();
+
+  // Fathoms all the queued nodes that a new incumbent cuts off, rather than as they are popped
+  void prune_open_nodes();
+
+  // Records the global bounds to the trace when they changed. Called by the scheduler only
+  void trace_bounds(f_t lower_bound);
+
+  void trace_worker(branch_and_bound_worker_t<i_t, f_t>* worker, bb_trace_kind_t kind)
+  {
+    if (!trace_.is_open()) { return; }
+    trace_.record(worker->worker_id, kind, worker->worker_id, -1, worker->search_strategy, 0.0);
+  }
+
+  // Reads settings_.checkpoint_file and installs its incumbent. Returns false if there is no
+  // checkpoint of this problem to resume from
+  bool resume_from_checkpoint();
+
+  // Saves the open nodes, the pseudocosts and the incumbent to settings_.checkpoint_file. With
+  // split, the open nodes are also dealt into settings_.checkpoint_split files
+  // <checkpoint_file>.<k>, each resumable by a separate solve
+  void write_checkpoint(bool split = false);
+
   // Set the solution when found at the root node
   void set_solution_at_root(mip_solution_t<i_t, f_t>& solution,
                             const cut_info_t<i_t, f_t>& cut_info);
@@ -273,6 +381,15 @@ class branch_and_bound_t {
                                branch_and_bound_stats_t<i_t, f_t>& stats,
                                logger_t& log);
 
+  // Separates Gomory cuts at a node whose LP was solved to optimality, then solves a copy of the
+  // node LP with them and the cuts inherited from its parent. The objective of the copy is a
+  // bound for the subtree, the cuts that did not age out are attached to the node for its
+  // children. Returns the status of the node with its cuts
+  dual::status_t solve_node_cut_lp(mip_node_t<i_t, f_t>* node_ptr,
+                                   branch_and_bound_worker_t<i_t, f_t>* worker,
+                                   const simplex_solver_settings_t<i_t, f_t>& lp_settings,
+                                   branch_and_bound_stats_t<i_t, f_t>& stats);
+
   // Selects the variable to branch on.
   branch_variable_t<i_t> variable_selection(mip_node_t<i_t, f_t>* node_ptr,
                                             const std::vector<i_t>& fractional,
@@ -310,6 +427,10 @@ class branch_and_bound_t {
 
   // Balance worker loads - redistribute nodes only if significant imbalance detected
   void deterministic_balance_worker_loads();
+  // Halves the horizon step when most BFS workers ran out of nodes in the last horizon, so nodes
+  // are redistributed sooner, and lengthens it when none did, so fewer barriers are paid. Only
+  // depends on deterministic worker state
+  void deterministic_adapt_horizon_step();
 
   node_status_t solve_node_deterministic(deterministic_bfs_worker_t<i_t, f_t>& worker,
                                          mip_node_t<i_t, f_t>* node_ptr,
@@ -356,7 +477,7 @@ class branch_and_bound_t {
   std::unique_ptr<deterministic_bfs_worker_pool_t<i_t, f_t>> deterministic_workers_;
   std::unique_ptr<cuopt::work_unit_scheduler_t> deterministic_scheduler_;
   mip_status_t deterministic_global_termination_status_{mip_status_t::UNSET};
-  double deterministic_horizon_step_{5.0};     // Work unit step per horizon (tunable)
+  double deterministic_horizon_step_{5.0};     // Work unit step per horizon (adapted at each sync)
   double deterministic_current_horizon_{0.0};  // Current horizon target
   bool deterministic_mode_enabled_{false};
   int deterministic_horizon_number_{0};  // Current horizon number (for debugging)
@@ -372,7 +493,7 @@ class branch_and_bound_t {
 
   // Determinism heuristic solution queue - solutions received from GPU heuristics
   // Stored with work unit timestamp for deterministic ordering
-  omp_mutex_t mutex_heuristic_queue_;
+  omp_timed_mutex_t mutex_heuristic_queue_;
   std::vector<queued_integer_solution_t<i_t, f_t>> heuristic_solution_queue_;
 
   // ============================================================================
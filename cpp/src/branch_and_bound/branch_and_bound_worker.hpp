@@ -12,12 +12,14 @@
 #include <dual_simplex/basis_updates.hpp>
 #include <dual_simplex/bounds_strengthening.hpp>
 #include <dual_simplex/phase2.hpp>
+#include <dual_simplex/tic_toc.hpp>
 
 #include <utilities/pcgenerator.hpp>
 
 #include <array>
 #include <deque>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -76,6 +78,13 @@ class branch_and_bound_worker_t {
   bool recompute_basis  = true;
   bool recompute_bounds = true;
 
+  // Objective of the current node LP with its cuts, -inf if the node has no cuts
+  f_t node_cut_bound = -std::numeric_limits<f_t>::infinity();
+
+  // Time spent in the idle list of the pool, the last idle period is added when it ends
+  f_t idle_time  = 0.0;
+  f_t idle_since = 0.0;
+
   branch_and_bound_worker_t(i_t worker_id,
                             const lp_problem_t<i_t, f_t>& original_lp,
                             const csr_matrix_t<i_t, f_t>& Arow,
@@ -97,6 +106,45 @@ class branch_and_bound_worker_t {
   {
   }
 
+  // Marks `sibling` as the node to pick up the factorization of its parent, which just branched,
+  // if the other child does not branch. Call with nullptr when the sibling is not next on the
+  // stack. Nothing is copied here: see preserve_sibling_basis
+  void save_sibling_basis(mip_node_t<i_t, f_t>* sibling)
+  {
+    sibling_node        = sibling;
+    sibling_basis_saved = false;
+  }
+
+  // Copies the factorization of the parent of the pending sibling before the LP of `node` changes
+  // it. The copy is skipped when there is no sibling waiting, when it was already taken, and
+  // when the other child is fathomed or found infeasible without solving its LP
+  void preserve_sibling_basis(mip_node_t<i_t, f_t>* node)
+  {
+    if (sibling_node == nullptr || sibling_node == node || sibling_basis_saved) { return; }
+    sibling_basis_factors = basis_factors;
+    sibling_basic_list    = basic_list;
+    sibling_nonbasic_list = nonbasic_list;
+    sibling_basis_saved   = true;
+  }
+
+  // Returns true, with the factorization of the parent of `node` restored, if `node` is the
+  // sibling saved above. The saved factorization is dropped either way
+  bool restore_sibling_basis(mip_node_t<i_t, f_t>* node)
+  {
+    const bool is_sibling = node != nullptr && node == sibling_node;
+    const bool was_saved  = sibling_basis_saved;
+    sibling_node          = nullptr;
+    sibling_basis_saved   = false;
+    if (!is_sibling) { return false; }
+    // Otherwise, the factors still are the ones of the parent
+    if (was_saved) {
+      std::swap(basis_factors, sibling_basis_factors);
+      basic_list.swap(sibling_basic_list);
+      nonbasic_list.swap(sibling_nonbasic_list);
+    }
+    return true;
+  }
+
   // Set the `start_node` for best-first search.
   void init_best_first(mip_node_t<i_t, f_t>* node, const lp_problem_t<i_t, f_t>& original_lp)
   {
@@ -160,6 +208,14 @@ class branch_and_bound_worker_t {
   // will be pointed by `start_node`.
   // For exploration, this will not be used.
   mip_node_t<i_t, f_t> internal_node;
+
+  // Factorization of the parent of `sibling_node`, see save_sibling_basis. Only valid when
+  // `sibling_basis_saved` is set
+  mip_node_t<i_t, f_t>* sibling_node = nullptr;
+  bool sibling_basis_saved           = false;
+  basis_update_mpf_t<i_t, f_t> sibling_basis_factors{0, 1};
+  std::vector<i_t> sibling_basic_list;
+  std::vector<i_t> sibling_nonbasic_list;
 };
 
 template <typename i_t, typename f_t>
@@ -173,15 +229,30 @@ class branch_and_bound_worker_pool_t {
   {
     workers_.resize(num_workers);
     num_idle_workers_ = num_workers;
-    for (i_t i = 0; i < num_workers; ++i) {
+    // Each worker copies the LP and allocates its scratch from a thread of the team, so that the
+    // copies are spread over the NUMA nodes when the threads are bound (OMP_PROC_BIND=spread)
+    omp_first_touch_for(num_workers, [&](int i) {
       workers_[i] = std::make_unique<branch_and_bound_worker_t<i_t, f_t>>(
         i, original_lp, Arow, var_type, settings);
+    });
+    const f_t now = tic();
+    for (i_t i = 0; i < num_workers; ++i) {
+      workers_[i]->idle_since = now;
       idle_workers_.push_front(i);
     }
 
     is_initialized = true;
   }
 
+  void set_node_propagation(const symmetry_orderings_t<i_t>* orderings,
+                            const conflict_pool_t<i_t, f_t>* conflict_pool)
+  {
+    for (auto& worker : workers_) {
+      worker->node_presolver.set_orderings(orderings);
+      worker->node_presolver.set_conflict_pool(conflict_pool);
+    }
+  }
+
   // Here, we are assuming that the scheduler is the only
   // thread that can retrieve/pop an idle worker.
   branch_and_bound_worker_t<i_t, f_t>* get_idle_worker()
@@ -201,6 +272,8 @@ class branch_and_bound_worker_pool_t {
   {
     std::lock_guard<omp_mutex_t> lock(mutex_);
     if (!idle_workers_.empty()) {
+      auto& worker = workers_[idle_workers_.front()];
+      worker->idle_time += toc(worker->idle_since);
       idle_workers_.pop_front();
       num_idle_workers_--;
     }
@@ -208,7 +281,8 @@ class branch_and_bound_worker_pool_t {
 
   void return_worker_to_pool(branch_and_bound_worker_t<i_t, f_t>* worker)
   {
-    worker->is_active = false;
+    worker->is_active  = false;
+    worker->idle_since = tic();
     std::lock_guard<omp_mutex_t> lock(mutex_);
     idle_workers_.push_back(worker->worker_id);
     num_idle_workers_++;
@@ -231,6 +305,20 @@ class branch_and_bound_worker_pool_t {
 
   i_t num_idle_workers() { return num_idle_workers_; }
 
+  // Idle time of every worker, the workers that are still in the idle list count until now
+  std::vector<f_t> get_idle_times()
+  {
+    std::vector<f_t> idle_times(workers_.size());
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      idle_times[i] = workers_[i]->idle_time;
+    }
+    for (i_t idx : idle_workers_) {
+      idle_times[idx] += toc(workers_[idx]->idle_since);
+    }
+    return idle_times;
+  }
+
  private:
   // Worker pool
   std::vector<std::unique_ptr<branch_and_bound_worker_t<i_t, f_t>>> workers_;
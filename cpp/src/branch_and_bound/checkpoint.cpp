@@ -0,0 +1,255 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/checkpoint.hpp>
+
+#include <utilities/binary_file_io.hpp>
+#include <utilities/hashing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+using detail::read_values;
+using detail::read_vector;
+using detail::write_values;
+using detail::write_vector;
+
+constexpr char checkpoint_magic[8]    = {'C', 'U', 'O', 'P', 'T', 'B', 'B', '\0'};
+// Version 2 added the part fields, version 1 files are read as checkpoints of a whole tree
+constexpr uint32_t checkpoint_version = 2;
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+bool bnb_checkpoint_t<i_t, f_t>::write(const std::string& filename) const
+{
+  const std::string temp_filename = filename + ".tmp";
+  std::FILE* file                 = std::fopen(temp_filename.c_str(), "wb");
+  if (file == nullptr) { return false; }
+
+  const uint32_t type_sizes[2] = {sizeof(i_t), sizeof(f_t)};
+  bool ok = write_values(file, checkpoint_magic, sizeof(checkpoint_magic)) &&
+            write_values(file, &checkpoint_version, 1) && write_values(file, type_sizes, 2) &&
+            write_values(file, &problem_hash, 1) && write_values(file, &part_index, 1) &&
+            write_values(file, &num_parts, 1) && write_vector(file, incumbent) &&
+            write_vector(file, pseudo_costs.sum_down_) &&
+            write_vector(file, pseudo_costs.sum_up_) &&
+            write_vector(file, pseudo_costs.num_down_) && write_vector(file, pseudo_costs.num_up_);
+
+  const uint64_t num_open_nodes = open_nodes.size();
+  ok = ok && write_values(file, &num_open_nodes, 1);
+  for (const auto& node : open_nodes) {
+    if (!ok) { break; }
+    ok = write_values(file, &node.lower_bound, 1) &&
+         write_values(file, &node.objective_estimate, 1) && write_vector(file, node.path);
+  }
+
+  ok = (std::fclose(file) == 0) && ok;
+  if (ok) { ok = std::rename(temp_filename.c_str(), filename.c_str()) == 0; }
+  if (!ok) { std::remove(temp_filename.c_str()); }
+  return ok;
+}
+
+template <typename i_t, typename f_t>
+bool bnb_checkpoint_t<i_t, f_t>::read(const std::string& filename)
+{
+  std::FILE* file = std::fopen(filename.c_str(), "rb");
+  if (file == nullptr) { return false; }
+  const int64_t file_size = detail::get_file_size(file);
+
+  char magic[sizeof(checkpoint_magic)];
+  uint32_t version       = 0;
+  uint32_t type_sizes[2] = {0, 0};
+  part_index             = 0;
+  num_parts              = 0;
+  bool ok = read_values(file, magic, sizeof(magic)) &&
+            std::memcmp(magic, checkpoint_magic, sizeof(magic)) == 0 &&
+            read_values(file, &version, 1) && version >= 1 && version <= checkpoint_version &&
+            read_values(file, type_sizes, 2) && type_sizes[0] == sizeof(i_t) &&
+            type_sizes[1] == sizeof(f_t) && read_values(file, &problem_hash, 1) &&
+            (version < 2 ||
+             (read_values(file, &part_index, 1) && read_values(file, &num_parts, 1))) &&
+            read_vector(file, file_size, incumbent) &&
+            read_vector(file, file_size, pseudo_costs.sum_down_) &&
+            read_vector(file, file_size, pseudo_costs.sum_up_) &&
+            read_vector(file, file_size, pseudo_costs.num_down_) &&
+            read_vector(file, file_size, pseudo_costs.num_up_);
+
+  uint64_t num_open_nodes = 0;
+  ok = ok && read_values(file, &num_open_nodes, 1) &&
+       num_open_nodes <= static_cast<uint64_t>(file_size);
+  if (ok) { open_nodes.resize(num_open_nodes); }
+  for (auto& node : open_nodes) {
+    if (!ok) { break; }
+    ok = read_values(file, &node.lower_bound, 1) &&
+         read_values(file, &node.objective_estimate, 1) && read_vector(file, file_size, node.path);
+  }
+  std::fclose(file);
+
+  const size_t n = pseudo_costs.sum_down_.size();
+  ok = ok && pseudo_costs.sum_up_.size() == n && pseudo_costs.num_down_.size() == n &&
+       pseudo_costs.num_up_.size() == n;
+  if (!ok) { open_nodes.clear(); }
+  return ok;
+}
+
+template <typename i_t, typename f_t>
+std::vector<bnb_checkpoint_t<i_t, f_t>> split_checkpoint(
+  const bnb_checkpoint_t<i_t, f_t>& checkpoint, i_t num_parts)
+{
+  std::vector<bnb_checkpoint_t<i_t, f_t>> parts(num_parts);
+  for (size_t k = 0; k < parts.size(); ++k) {
+    parts[k].problem_hash = checkpoint.problem_hash;
+    parts[k].part_index   = k;
+    parts[k].num_parts    = num_parts;
+    parts[k].incumbent    = checkpoint.incumbent;
+    parts[k].pseudo_costs = checkpoint.pseudo_costs;
+  }
+
+  std::vector<size_t> order(checkpoint.open_nodes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&checkpoint](size_t a, size_t b) {
+    return checkpoint.open_nodes[a].lower_bound < checkpoint.open_nodes[b].lower_bound;
+  });
+  for (size_t k = 0; k < order.size(); ++k) {
+    parts[k % num_parts].open_nodes.push_back(checkpoint.open_nodes[order[k]]);
+  }
+  return parts;
+}
+
+template <typename i_t, typename f_t>
+uint32_t checkpoint_problem_hash(const user_problem_t<i_t, f_t>& problem)
+{
+  const uint32_t hashes[] = {detail::compute_hash(problem.num_rows),
+                             detail::compute_hash(problem.num_cols),
+                             detail::compute_hash(problem.objective),
+                             detail::compute_hash(problem.rhs),
+                             detail::compute_hash(problem.lower),
+                             detail::compute_hash(problem.upper),
+                             detail::compute_hash(problem.A.col_start),
+                             detail::compute_hash(problem.A.i),
+                             detail::compute_hash(problem.A.x)};
+  uint32_t hash = 2166136261u;
+  for (uint32_t h : hashes) {
+    hash = (hash ^ h) * 16777619u;
+  }
+  return hash;
+}
+
+template <typename i_t, typename f_t>
+void collect_open_nodes(const mip_node_t<i_t, f_t>& root,
+                        std::vector<checkpoint_node_t<i_t, f_t>>& open_nodes)
+{
+  std::vector<const mip_node_t<i_t, f_t>*> stack{&root};
+  while (!stack.empty()) {
+    const mip_node_t<i_t, f_t>* node = stack.back();
+    stack.pop_back();
+
+    const mip_node_t<i_t, f_t>* down_child = node->get_down_child();
+    const mip_node_t<i_t, f_t>* up_child   = node->get_up_child();
+    if (down_child != nullptr || up_child != nullptr) {
+      if (down_child != nullptr) { stack.push_back(down_child); }
+      if (up_child != nullptr) { stack.push_back(up_child); }
+      continue;
+    }
+    if (node->parent == nullptr || node->status != node_status_t::PENDING) { continue; }
+
+    // The bounds of a pending node may be written while it is being solved, the ones of its parent
+    // are settled once it has children
+    checkpoint_node_t<i_t, f_t> open_node;
+    open_node.lower_bound        = node->parent->lower_bound;
+    open_node.objective_estimate = node->parent->objective_estimate;
+    for (const mip_node_t<i_t, f_t>* p = node; p->parent != nullptr; p = p->parent) {
+      open_node.path.push_back(
+        {p->branch_var, p->branch_dir, p->branch_var_lower, p->branch_var_upper});
+    }
+    std::reverse(open_node.path.begin(), open_node.path.end());
+    open_nodes.push_back(std::move(open_node));
+  }
+}
+
+template <typename i_t, typename f_t>
+std::vector<mip_node_t<i_t, f_t>*> restore_open_nodes(
+  search_tree_t<i_t, f_t>& tree,
+  const lp_problem_t<i_t, f_t>& lp,
+  const std::vector<checkpoint_node_t<i_t, f_t>>& open_nodes,
+  const std::vector<variable_status_t>& basis)
+{
+  auto packed_basis = std::make_shared<const packed_vstatus_t>(basis);
+  std::vector<mip_node_t<i_t, f_t>*> leaves;
+  for (const auto& open_node : open_nodes) {
+    const bool valid_path =
+      !open_node.path.empty() &&
+      std::all_of(open_node.path.begin(), open_node.path.end(), [&lp](const auto& branch) {
+        return branch.variable >= 0 && branch.variable < lp.num_cols;
+      });
+    if (!valid_path) { continue; }
+    mip_node_t<i_t, f_t>* node = &tree.root;
+    for (const auto& branch : open_node.path) {
+      if (node != &tree.root) {
+        node->status = node_status_t::HAS_CHILDREN;
+        node->packed_vstatus.reset();
+      }
+      const i_t child_index = branch.direction == rounding_direction_t::DOWN ? 0 : 1;
+      if (node->children[child_index] == nullptr) {
+        // The branching value only sets the default bounds, the saved ones replace them
+        auto child = tree.node_pool->make_node(lp,
+                                               node,
+                                               ++tree.num_nodes,
+                                               branch.variable,
+                                               branch.direction,
+                                               branch.lower,
+                                               -1,
+                                               packed_basis);
+        child->branch_var_lower     = branch.lower;
+        child->branch_var_upper     = branch.upper;
+        node->children[child_index] = std::move(child);
+      }
+      node = node->children[child_index].get();
+      assert(node->branch_var == branch.variable);
+    }
+    node->lower_bound        = open_node.lower_bound;
+    node->objective_estimate = open_node.objective_estimate;
+    // The saved bound is the one of the parent, which collect_open_nodes reads back if the tree is
+    // checkpointed again before the node is solved
+    if (node->parent != &tree.root) {
+      node->parent->lower_bound        = open_node.lower_bound;
+      node->parent->objective_estimate = open_node.objective_estimate;
+    }
+    leaves.push_back(node);
+  }
+  return leaves;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+
+template struct bnb_checkpoint_t<int, double>;
+
+template std::vector<bnb_checkpoint_t<int, double>> split_checkpoint<int, double>(
+  const bnb_checkpoint_t<int, double>& checkpoint, int num_parts);
+
+template uint32_t checkpoint_problem_hash<int, double>(const user_problem_t<int, double>& problem);
+
+template void collect_open_nodes<int, double>(
+  const mip_node_t<int, double>& root, std::vector<checkpoint_node_t<int, double>>& open_nodes);
+
+template std::vector<mip_node_t<int, double>*> restore_open_nodes<int, double>(
+  search_tree_t<int, double>& tree,
+  const lp_problem_t<int, double>& lp,
+  const std::vector<checkpoint_node_t<int, double>>& open_nodes,
+  const std::vector<variable_status_t>& basis);
+
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,92 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <branch_and_bound/mip_node.hpp>
+#include <branch_and_bound/pseudo_costs.hpp>
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// One branching decision on the path from the root to an open node
+template <typename i_t, typename f_t>
+struct checkpoint_branch_t {
+  i_t variable;
+  rounding_direction_t direction;
+  f_t lower;
+  f_t upper;
+};
+
+// An open node, identified by the bounds branched on from the root. Its basis is not saved, the
+// node is solved from the root basis after a restart
+template <typename i_t, typename f_t>
+struct checkpoint_node_t {
+  f_t lower_bound;
+  f_t objective_estimate;
+  std::vector<checkpoint_branch_t<i_t, f_t>> path;
+};
+
+// State of the branch and bound search saved to disk so a preempted solve can be resumed: the
+// open nodes of the tree, the pseudocosts and the incumbent. The root is solved again when
+// resuming, so the cuts are regenerated rather than saved
+template <typename i_t, typename f_t>
+struct bnb_checkpoint_t {
+  uint32_t problem_hash{0};
+  // Set on the parts written by split_checkpoint, num_parts is 0 for the checkpoint of a whole
+  // tree. The open nodes of a part only cover its share of the tree, so its bound is not a bound
+  // of the problem
+  uint32_t part_index{0};
+  uint32_t num_parts{0};
+  std::vector<f_t> incumbent;  // in the space of the original problem, empty if none
+  pseudo_cost_snapshot_t<i_t, f_t> pseudo_costs;
+  std::vector<checkpoint_node_t<i_t, f_t>> open_nodes;
+
+  // Writes to a temporary file renamed over filename, so a preemption in the middle of the write
+  // leaves the previous checkpoint intact. Returns false if the file could not be written
+  bool write(const std::string& filename) const;
+
+  // Returns false if the file does not exist or is not a valid checkpoint
+  bool read(const std::string& filename);
+
+  bool is_part() const { return num_parts > 0; }
+};
+
+// Deals the open nodes of checkpoint into num_parts checkpoints with the same incumbent and
+// pseudocosts, flagged as parts. The nodes are dealt in order of their lower bounds, so every part
+// gets a share of the most promising subtrees. Each part can then be resumed by an independent
+// solve
+template <typename i_t, typename f_t>
+std::vector<bnb_checkpoint_t<i_t, f_t>> split_checkpoint(
+  const bnb_checkpoint_t<i_t, f_t>& checkpoint, i_t num_parts);
+
+// Identifies the problem a checkpoint belongs to
+template <typename i_t, typename f_t>
+uint32_t checkpoint_problem_hash(const user_problem_t<i_t, f_t>& problem);
+
+// Collects the pending leaves of the tree. Must be called with the mutex of the tree held
+template <typename i_t, typename f_t>
+void collect_open_nodes(const mip_node_t<i_t, f_t>& root,
+                        std::vector<checkpoint_node_t<i_t, f_t>>& open_nodes);
+
+// Rebuilds the branches of the tree leading to the open nodes below its root, sharing the common
+// prefixes of their paths. The open nodes start from basis. Returns the new leaves
+template <typename i_t, typename f_t>
+std::vector<mip_node_t<i_t, f_t>*> restore_open_nodes(
+  search_tree_t<i_t, f_t>& tree,
+  const lp_problem_t<i_t, f_t>& lp,
+  const std::vector<checkpoint_node_t<i_t, f_t>>& open_nodes,
+  const std::vector<variable_status_t>& basis);
+
+}  // namespace cuopt::linear_programming::dual_simplex
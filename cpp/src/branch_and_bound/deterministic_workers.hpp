@@ -127,6 +127,7 @@ class deterministic_bfs_worker_t
   f_t local_lower_bound_ceiling{std::numeric_limits<f_t>::infinity()};
   bool recompute_bounds_and_basis{true};
   i_t nodes_processed_this_horizon{0};
+  bool idle_this_horizon{false};  // ran out of nodes before the end of the horizon
 
   // BFS statistics
   i_t total_nodes_pruned{0};
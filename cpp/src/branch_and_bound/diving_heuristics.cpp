@@ -7,6 +7,17 @@
 
 #include <branch_and_bound/diving_heuristics.hpp>
 
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/tic_toc.hpp>
+
+#include <cuopt/linear_programming/solve.hpp>
+
+#include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
 #include <tuple>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -175,6 +186,149 @@ branch_variable_t<i_t> coefficient_diving(const lp_problem_t<i_t, f_t>& lp_probl
   return {branch_var, round_dir};
 }
 
+template <typename i_t, typename f_t>
+bool batch_pdlp_diving_t<i_t, f_t>::try_dive(const lp_problem_t<i_t, f_t>& leaf_problem,
+                                             const std::vector<variable_type_t>& var_types,
+                                             const std::vector<f_t>& solution,
+                                             bounds_strengthening_t<i_t, f_t>& presolver,
+                                             const simplex_solver_settings_t<i_t, f_t>& settings,
+                                             f_t upper_bound,
+                                             f_t time_limit,
+                                             std::vector<f_t>& incumbent,
+                                             f_t& incumbent_objective)
+{
+  const i_t width = settings.diving_settings.gpu_dive_width;
+  if (time_limit <= 0.0 || width <= 0) { return false; }
+  if (!mutex_.try_lock()) { return false; }
+  std::lock_guard<omp_mutex_t> lock(mutex_, std::adopt_lock);
+  raft::common::nvtx::range scope("BB::batch_pdlp_diving");
+
+  if (!handle_) { handle_ = std::make_unique<raft::handle_t>(); }
+  const f_t start_time = tic();
+  const i_t n          = leaf_problem.num_cols;
+  const f_t tol        = settings.integer_tol;
+
+  lp_problem_t<i_t, f_t> dive_problem(leaf_problem);
+  std::vector<f_t> x = solution;
+  std::vector<bool> bounds_changed(n, false);
+  std::vector<i_t> fractional;
+  std::vector<f_t> candidate_values;
+  std::vector<f_t> batch_x;
+
+  auto is_fractional = [&](const f_t* y, i_t j) {
+    return var_types[j] != variable_type_t::CONTINUOUS && std::abs(y[j] - std::round(y[j])) > tol;
+  };
+  auto is_integral = [&](const f_t* y) {
+    for (i_t j = 0; j < n; ++j) {
+      if (is_fractional(y, j)) { return false; }
+    }
+    return true;
+  };
+
+  // The PDLP solution is only approximately feasible: fix the integer variables to their rounded
+  // values and solve for the continuous ones
+  auto polish = [&](const f_t* y) {
+    lp_problem_t<i_t, f_t> fixed_problem(dive_problem);
+    for (i_t j = 0; j < n; ++j) {
+      if (var_types[j] == variable_type_t::CONTINUOUS) { continue; }
+      const f_t value = std::round(y[j]);
+      if (value < dive_problem.lower[j] - tol || value > dive_problem.upper[j] + tol) {
+        return false;
+      }
+      fixed_problem.lower[j] = value;
+      fixed_problem.upper[j] = value;
+    }
+    simplex_solver_settings_t<i_t, f_t> lp_settings = settings;
+    lp_settings.set_log(false);
+    lp_settings.inside_mip = 2;
+    lp_settings.time_limit = time_limit - toc(start_time);
+    lp_solution_t<i_t, f_t> fixed_solution(fixed_problem.num_rows, n);
+    std::vector<variable_status_t> vstatus;
+    std::vector<f_t> edge_norms;
+    const lp_status_t status = solve_linear_program_advanced(
+      fixed_problem, tic(), lp_settings, fixed_solution, vstatus, edge_norms);
+    if (status != lp_status_t::OPTIMAL) { return false; }
+    const f_t objective = compute_objective(fixed_problem, fixed_solution.x);
+    if (!(objective < upper_bound)) { return false; }
+    incumbent           = std::move(fixed_solution.x);
+    incumbent_objective = objective;
+    return true;
+  };
+
+  for (i_t depth = 0; depth < settings.diving_settings.node_limit; ++depth) {
+    const f_t remaining_time = time_limit - toc(start_time);
+    if (remaining_time <= 0.0) { return false; }
+
+    fractional.clear();
+    for (i_t j = 0; j < n; ++j) {
+      if (is_fractional(x.data(), j)) { fractional.push_back(j); }
+    }
+    if (fractional.empty()) { return polish(x.data()); }
+
+    // The least fractional variables first, as in fractional diving
+    auto distance = [&](i_t j) { return std::abs(x[j] - std::round(x[j])); };
+    if ((i_t)fractional.size() > width) {
+      std::nth_element(fractional.begin(),
+                       fractional.begin() + width,
+                       fractional.end(),
+                       [&](i_t a, i_t b) { return distance(a) < distance(b); });
+      fractional.resize(width);
+    }
+    const i_t num_candidates = fractional.size();
+    candidate_values.resize(num_candidates);
+    for (i_t k = 0; k < num_candidates; ++k) {
+      candidate_values[k] = x[fractional[k]];
+    }
+
+    const auto mps_model = lp_problem_to_mps_data_model(dive_problem);
+    pdlp_solver_settings_t<i_t, f_t> pdlp_settings;
+    pdlp_settings.time_limit = remaining_time;
+    pdlp_settings.set_initial_primal_solution(x.data(), n, handle_->get_stream());
+    const auto solutions =
+      batch_pdlp_solve(handle_.get(), mps_model, fractional, candidate_values, pdlp_settings);
+
+    // The first num_candidates solutions round down, the others up
+    const i_t batch_size = 2 * num_candidates;
+    batch_x.resize(size_t(batch_size) * n);
+    raft::copy(batch_x.data(),
+               solutions.get_primal_solution().data(),
+               batch_x.size(),
+               handle_->get_stream());
+    handle_->sync_stream();
+
+    i_t best_child = -1;
+    f_t best_obj   = upper_bound;
+    for (i_t k = 0; k < batch_size; ++k) {
+      if (solutions.get_termination_status(k) != pdlp_termination_status_t::Optimal) { continue; }
+      const f_t* y        = batch_x.data() + size_t(k) * n;
+      const f_t objective = std::inner_product(
+        dive_problem.objective.begin(), dive_problem.objective.end(), y, f_t(0));
+      if (!(objective < upper_bound)) { continue; }
+      if (is_integral(y) && polish(y)) { return true; }
+      if (objective < best_obj) {
+        best_obj   = objective;
+        best_child = k;
+      }
+    }
+    if (best_child < 0) { return false; }
+
+    const i_t j = fractional[best_child % num_candidates];
+    if (best_child < num_candidates) {
+      dive_problem.upper[j] = std::floor(x[j]);
+    } else {
+      dive_problem.lower[j] = std::ceil(x[j]);
+    }
+    bounds_changed[j]   = true;
+    const bool feasible = presolver.bounds_strengthening(
+      settings, bounds_changed, dive_problem.lower, dive_problem.upper);
+    bounds_changed[j] = false;
+    if (!feasible) { return false; }
+
+    std::copy_n(batch_x.data() + size_t(best_child) * n, n, x.begin());
+  }
+  return false;
+}
+
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 template branch_variable_t<int> line_search_diving(const std::vector<int>& fractional,
                                                    const std::vector<double>& solution,
@@ -203,6 +357,9 @@ template branch_variable_t<int> coefficient_diving(const lp_problem_t<int, doubl
                                                    const std::vector<int>& up_locks,
                                                    const std::vector<int>& down_locks,
                                                    logger_t& log);
+
+template class batch_pdlp_diving_t<int, double>;
+
 #endif
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -12,6 +12,11 @@
 #include <dual_simplex/basis_updates.hpp>
 #include <dual_simplex/bounds_strengthening.hpp>
 
+#include <utilities/omp_helpers.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <memory>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -51,4 +56,31 @@ branch_variable_t<i_t> coefficient_diving(const lp_problem_t<i_t, f_t>& lp_probl
                                           const std::vector<i_t>& down_locks,
                                           logger_t& log);
 
+// Dive on the GPU, with batch PDLP in place of the dual simplex. At each step, both roundings of
+// the gpu_dive_width least fractional variables are solved in a single batch, warm started from
+// the LP solution of the previous step. The dive fixes the rounding with the lowest objective,
+// propagates it with bounds strengthening and goes on until the solution is integral, which a
+// dual simplex solve with the integer variables fixed turns into an exact feasible solution.
+// Only one dive runs at a time.
+template <typename i_t, typename f_t>
+class batch_pdlp_diving_t {
+ public:
+  // Returns true if the dive from the LP solution of a node, whose bounds are the ones of
+  // leaf_problem, found a solution better than upper_bound. Returns false right away if another
+  // dive is running.
+  bool try_dive(const lp_problem_t<i_t, f_t>& leaf_problem,
+                const std::vector<variable_type_t>& var_types,
+                const std::vector<f_t>& solution,
+                bounds_strengthening_t<i_t, f_t>& presolver,
+                const simplex_solver_settings_t<i_t, f_t>& settings,
+                f_t upper_bound,
+                f_t time_limit,
+                std::vector<f_t>& incumbent,
+                f_t& incumbent_objective);
+
+ private:
+  omp_mutex_t mutex_;
+  std::unique_ptr<raft::handle_t> handle_;
+};
+
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -8,14 +8,19 @@
 #pragma once
 
 #include <dual_simplex/initial_basis.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
 #include <dual_simplex/types.hpp>
 
 #include <utilities/hashing.hpp>
 #include <utilities/omp_helpers.hpp>
 
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -33,6 +38,144 @@ enum class rounding_direction_t : int8_t { NONE = -1, DOWN = 0, UP = 1 };
 
 bool inactive_status(node_status_t status);
 
+// Append-only temporary file receiving the packed bases spilled out of memory when the open nodes
+// exceed their memory budget. The file is created on the first write and removed when closed
+class node_spill_file_t {
+ public:
+  node_spill_file_t()                                    = default;
+  node_spill_file_t(const node_spill_file_t&)            = delete;
+  node_spill_file_t& operator=(const node_spill_file_t&) = delete;
+
+  ~node_spill_file_t()
+  {
+    if (file_ != nullptr) { std::fclose(file_); }
+  }
+
+  // Returns the offset of the new record, or -1 if it could not be written
+  int64_t write(const uint8_t* data, size_t bytes)
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    if (file_ == nullptr) { file_ = std::tmpfile(); }
+    if (file_ == nullptr) { return -1; }
+    if (std::fseek(file_, end_, SEEK_SET) != 0 || std::fwrite(data, 1, bytes, file_) != bytes) {
+      return -1;
+    }
+    const int64_t offset = end_;
+    end_ += bytes;
+    return offset;
+  }
+
+  bool read(int64_t offset, uint8_t* data, size_t bytes)
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    if (file_ == nullptr || std::fseek(file_, offset, SEEK_SET) != 0) { return false; }
+    return std::fread(data, 1, bytes, file_) == bytes;
+  }
+
+  int64_t size()
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    return end_;
+  }
+
+ private:
+  omp_mutex_t mutex_;
+  std::FILE* file_{nullptr};
+  int64_t end_{0};
+};
+
+// Basis of an open node, packed at 4 bits per variable
+// Both children of a node start from the basis of their parent, so they share one packed copy.
+// It is unpacked into vstatus only when the node is solved. The packed data may also be spilled
+// to disk, in which case it is read back when unpacked
+class packed_vstatus_t {
+ public:
+  explicit packed_vstatus_t(const std::vector<variable_status_t>& vstatus)
+    : size_(vstatus.size()), data_((vstatus.size() + 1) / 2, 0)
+  {
+    for (size_t k = 0; k < size_; ++k) {
+      // Statuses range from -1 to 4, shift them to 0 .. 5
+      const uint8_t code = static_cast<uint8_t>(static_cast<int8_t>(vstatus[k]) + 1);
+      data_[k / 2] |= code << (4 * (k % 2));
+    }
+  }
+
+  // Returns false, leaving vstatus untouched, if the spilled data could not be read back
+  bool unpack(std::vector<variable_status_t>& vstatus) const
+  {
+    std::vector<uint8_t> spilled_data;
+    const std::vector<uint8_t>* data = &data_;
+    if (spill_file_ != nullptr) {
+      spilled_data.resize(packed_bytes());
+      if (!spill_file_->read(spill_offset_, spilled_data.data(), spilled_data.size())) {
+        return false;
+      }
+      data = &spilled_data;
+    }
+    vstatus.resize(size_);
+    for (size_t k = 0; k < size_; ++k) {
+      const int8_t code = ((*data)[k / 2] >> (4 * (k % 2))) & 0xF;
+      vstatus[k]        = static_cast<variable_status_t>(code - 1);
+    }
+    return true;
+  }
+
+  // Writes the packed data to the file and returns a copy that only refers to it, or nullptr if
+  // the write failed
+  std::shared_ptr<const packed_vstatus_t> spill(
+    const std::shared_ptr<node_spill_file_t>& file) const
+  {
+    if (spill_file_ != nullptr) { return nullptr; }
+    const int64_t offset = file->write(data_.data(), data_.size());
+    if (offset < 0) { return nullptr; }
+    return std::shared_ptr<const packed_vstatus_t>(new packed_vstatus_t(size_, file, offset));
+  }
+
+  bool is_spilled() const { return spill_file_ != nullptr; }
+
+  // Bytes held in memory
+  size_t bytes() const { return data_.size(); }
+
+ private:
+  packed_vstatus_t(size_t size, std::shared_ptr<node_spill_file_t> file, int64_t offset)
+    : size_(size), spill_file_(std::move(file)), spill_offset_(offset)
+  {
+  }
+
+  size_t packed_bytes() const { return (size_ + 1) / 2; }
+
+  size_t size_;
+  std::vector<uint8_t> data_;
+  std::shared_ptr<node_spill_file_t> spill_file_;
+  int64_t spill_offset_{-1};
+};
+
+// Cuts separated at a node, in the form cuts*x <= rhs, and valid in its subtree only. They are
+// never modified once attached to the node, so the workers solving the nodes of the subtree read
+// them without a lock
+template <typename i_t, typename f_t>
+struct node_cuts_t {
+  csr_matrix_t<i_t, f_t> cuts{0, 0, 0};
+  std::vector<f_t> rhs;
+  std::vector<i_t> age;  // consecutive node LPs at which the cut was not binding
+};
+
+template <typename i_t, typename f_t>
+class mip_node_t;
+
+template <typename i_t, typename f_t>
+class mip_node_pool_t;
+
+// Returns a node to the pool it was allocated from
+template <typename i_t, typename f_t>
+struct mip_node_deleter_t {
+  mip_node_pool_t<i_t, f_t>* pool{nullptr};
+  void operator()(mip_node_t<i_t, f_t>* node) const;
+};
+
+template <typename i_t, typename f_t>
+using mip_node_ptr_t = std::unique_ptr<mip_node_t<i_t, f_t>, mip_node_deleter_t<i_t, f_t>>;
+
 template <typename i_t, typename f_t>
 class mip_node_t {
  public:
@@ -77,7 +220,7 @@ class mip_node_t {
              rounding_direction_t branch_direction,
              f_t branch_var_value,
              i_t integer_inf,
-             const std::vector<variable_status_t>& basis)
+             std::shared_ptr<const packed_vstatus_t> basis)
     : status(node_status_t::PENDING),
       lower_bound(parent_node->lower_bound),
       depth(parent_node->depth + 1),
@@ -88,7 +231,8 @@ class mip_node_t {
       fractional_val(branch_var_value),
       integer_infeasible(integer_inf),
       objective_estimate(parent_node->objective_estimate),
-      vstatus(basis)
+      vstatus(0),
+      packed_vstatus(std::move(basis))
   {
     branch_var_lower = branch_direction == rounding_direction_t::DOWN ? problem.lower[branch_var]
                                                                       : std::ceil(branch_var_value);
@@ -133,12 +277,24 @@ class mip_node_t {
     bounds_changed[branch_var] = true;
   }
 
+  // Restores vstatus from the packed basis shared with the sibling. Called before the node is
+  // solved, a no-op for the root and for nodes already unpacked. Returns false if the basis was
+  // spilled to disk and could not be read back, vstatus is then left empty
+  bool unpack_vstatus()
+  {
+    if (packed_vstatus != nullptr) {
+      const bool unpacked = packed_vstatus->unpack(vstatus);
+      packed_vstatus.reset();
+      return unpacked;
+    }
+    return true;
+  }
+
   mip_node_t* get_down_child() const { return children[0].get(); }
 
   mip_node_t* get_up_child() const { return children[1].get(); }
 
-  void add_children(std::unique_ptr<mip_node_t>&& down_child,
-                    std::unique_ptr<mip_node_t>&& up_child)
+  void add_children(mip_node_ptr_t<i_t, f_t>&& down_child, mip_node_ptr_t<i_t, f_t>&& up_child)
   {
     children[0] = std::move(down_child);
     children[1] = std::move(up_child);
@@ -240,6 +396,7 @@ class mip_node_t {
     copy.node_id            = node_id;
     copy.integer_infeasible = integer_infeasible;
     copy.vstatus            = vstatus;
+    copy.packed_vstatus     = packed_vstatus;
     copy.branch_var         = branch_var;
     copy.branch_dir         = branch_dir;
     copy.branch_var_lower   = branch_var_lower;
@@ -268,9 +425,14 @@ class mip_node_t {
   i_t integer_infeasible;
 
   mip_node_t<i_t, f_t>* parent;
-  std::unique_ptr<mip_node_t> children[2];
+  mip_node_ptr_t<i_t, f_t> children[2];
 
   std::vector<variable_status_t> vstatus;
+  std::shared_ptr<const packed_vstatus_t> packed_vstatus;  // basis of an open node
+
+  // Cuts of the node LP, inherited by the children. Only set at the nodes up to the depth of the
+  // node cuts
+  std::shared_ptr<const node_cuts_t<i_t, f_t>> cuts;
 
   // Worker-local identification for deterministic ordering:
   // - origin_worker_id: which worker created this node
@@ -299,29 +461,118 @@ class mip_node_t {
   }
 };
 
+// Recycles the memory of the nodes of a search tree
+// Nodes are carved out of chunks of node_chunk_size nodes and freed nodes go to a free list, so
+// after the first few chunks the tree no longer goes through malloc. A whole fathomed subtree is
+// returned with a single lock
 template <typename i_t, typename f_t>
-void remove_fathomed_nodes(std::vector<mip_node_t<i_t, f_t>*>& stack)
+class mip_node_pool_t {
+ public:
+  static constexpr size_t node_chunk_size = 1024;
+
+  mip_node_pool_t()                                  = default;
+  mip_node_pool_t(const mip_node_pool_t&)            = delete;
+  mip_node_pool_t& operator=(const mip_node_pool_t&) = delete;
+
+  template <typename... Args>
+  mip_node_ptr_t<i_t, f_t> make_node(Args&&... args)
+  {
+    void* storage = allocate();
+    return mip_node_ptr_t<i_t, f_t>(new (storage) mip_node_t<i_t, f_t>(std::forward<Args>(args)...),
+                                    mip_node_deleter_t<i_t, f_t>{this});
+  }
+
+  // Destroys the nodes, which must not own children anymore, and recycles their memory
+  void release(const std::vector<mip_node_t<i_t, f_t>*>& nodes)
+  {
+    for (mip_node_t<i_t, f_t>* node : nodes) {
+      node->~mip_node_t();
+    }
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    free_list_.insert(free_list_.end(), nodes.begin(), nodes.end());
+  }
+
+  void release(mip_node_t<i_t, f_t>* node)
+  {
+    node->~mip_node_t();
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    free_list_.push_back(node);
+  }
+
+ private:
+  struct alignas(mip_node_t<i_t, f_t>) node_storage_t {
+    unsigned char bytes[sizeof(mip_node_t<i_t, f_t>)];
+  };
+
+  void* allocate()
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex_);
+    if (free_list_.empty()) {
+      chunks_.push_back(std::make_unique<node_storage_t[]>(node_chunk_size));
+      node_storage_t* chunk = chunks_.back().get();
+      for (size_t k = node_chunk_size; k > 0; --k) {
+        free_list_.push_back(&chunk[k - 1]);
+      }
+    }
+    void* storage = free_list_.back();
+    free_list_.pop_back();
+    return storage;
+  }
+
+  omp_mutex_t mutex_;
+  std::vector<std::unique_ptr<node_storage_t[]>> chunks_;
+  std::vector<void*> free_list_;
+};
+
+template <typename i_t, typename f_t>
+void mip_node_deleter_t<i_t, f_t>::operator()(mip_node_t<i_t, f_t>* node) const
+{
+  if (pool != nullptr) {
+    pool->release(node);
+  } else {
+    delete node;
+  }
+}
+
+// Detaches the subtrees under the nodes in stack and returns all their nodes to the pool at once
+template <typename i_t, typename f_t>
+void remove_fathomed_nodes(std::vector<mip_node_t<i_t, f_t>*>& stack,
+                           mip_node_pool_t<i_t, f_t>& pool)
 {
+  std::vector<mip_node_t<i_t, f_t>*> released;
   for (int i = 0; i < stack.size(); ++i) {
     for (int child = 0; child < 2; ++child) {
-      if (stack[i]->children[child] != nullptr) { stack[i]->children[child].reset(); }
+      if (stack[i]->children[child] != nullptr) {
+        released.push_back(stack[i]->children[child].release());
+      }
+    }
+  }
+  for (size_t k = 0; k < released.size(); ++k) {
+    for (int child = 0; child < 2; ++child) {
+      if (released[k]->children[child] != nullptr) {
+        released.push_back(released[k]->children[child].release());
+      }
     }
   }
+  if (!released.empty()) { pool.release(released); }
 }
 
 template <typename i_t, typename f_t>
 class search_tree_t {
  public:
-  search_tree_t() : num_nodes(0) {}
+  search_tree_t() : node_pool(std::make_unique<mip_node_pool_t<i_t, f_t>>()), num_nodes(0) {}
 
-  search_tree_t(mip_node_t<i_t, f_t>&& node) : root(std::move(node)), num_nodes(0) {}
+  search_tree_t(mip_node_t<i_t, f_t>&& node)
+    : node_pool(std::make_unique<mip_node_pool_t<i_t, f_t>>()), root(std::move(node)), num_nodes(0)
+  {
+  }
 
   void update(mip_node_t<i_t, f_t>* node_ptr, node_status_t status)
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
     std::vector<mip_node_t<i_t, f_t>*> stack;
     node_ptr->set_status(status, stack);
-    remove_fathomed_nodes(stack);
+    remove_fathomed_nodes(stack, *node_pool);
   }
 
   void branch(mip_node_t<i_t, f_t>* parent_node,
@@ -333,15 +584,17 @@ class search_tree_t {
               logger_t& log)
   {
     i_t id = num_nodes.fetch_add(2);
-
-    auto down_child = std::make_unique<mip_node_t<i_t, f_t>>(original_lp,
-                                                             parent_node,
-                                                             ++id,
-                                                             branch_var,
-                                                             rounding_direction_t::DOWN,
-                                                             fractional_val,
-                                                             integer_infeasible,
-                                                             parent_vstatus);
+    assert(parent_vstatus.size() == original_lp.num_cols);
+    auto children_vstatus = std::make_shared<const packed_vstatus_t>(parent_vstatus);
+
+    auto down_child = node_pool->make_node(original_lp,
+                                           parent_node,
+                                           ++id,
+                                           branch_var,
+                                           rounding_direction_t::DOWN,
+                                           fractional_val,
+                                           integer_infeasible,
+                                           children_vstatus);
     graphviz_edge(log,
                   parent_node,
                   down_child.get(),
@@ -349,14 +602,14 @@ class search_tree_t {
                   rounding_direction_t::DOWN,
                   std::floor(fractional_val));
 
-    auto up_child = std::make_unique<mip_node_t<i_t, f_t>>(original_lp,
-                                                           parent_node,
-                                                           ++id,
-                                                           branch_var,
-                                                           rounding_direction_t::UP,
-                                                           fractional_val,
-                                                           integer_infeasible,
-                                                           parent_vstatus);
+    auto up_child = node_pool->make_node(original_lp,
+                                         parent_node,
+                                         ++id,
+                                         branch_var,
+                                         rounding_direction_t::UP,
+                                         fractional_val,
+                                         integer_infeasible,
+                                         children_vstatus);
 
     graphviz_edge(log,
                   parent_node,
@@ -365,7 +618,8 @@ class search_tree_t {
                   rounding_direction_t::UP,
                   std::ceil(fractional_val));
 
-    assert(parent_vstatus.size() == original_lp.num_cols);
+    // Under the lock, so a walk of the tree (e.g., for a checkpoint) never sees half the children
+    std::lock_guard<omp_mutex_t> lock(mutex);
     parent_node->add_children(std::move(down_child),
                               std::move(up_child));  // child pointers moved into the tree
   }
@@ -397,6 +651,8 @@ class search_tree_t {
     }
   }
 
+  // Declared before root so the nodes are destroyed before their memory
+  std::unique_ptr<mip_node_pool_t<i_t, f_t>> node_pool;
   mip_node_t<i_t, f_t> root;
   omp_mutex_t mutex;
   omp_atomic_t<i_t> num_nodes;
@@ -11,14 +11,16 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
 
-// This is a generic heap implementation based
-// on the STL functions. The main benefit here is
-// that we access the underlying container.
+// A 4-ary heap over a std::vector, ordered like the STL heap functions: comp(a, b) means that a
+// comes out after b. With four children per node the heap is half as deep as a binary one, so
+// that a push or a pop touches fewer cache lines when millions of nodes are queued. The
+// underlying container stays accessible.
 template <typename T, typename Comp>
 class heap_t {
  public:
@@ -28,32 +30,50 @@ class heap_t {
   void push(const T& node)
   {
     buffer.push_back(node);
-    std::push_heap(buffer.begin(), buffer.end(), comp);
+    sift_up(buffer.size() - 1);
   }
 
   void push(T&& node)
   {
     buffer.push_back(std::move(node));
-    std::push_heap(buffer.begin(), buffer.end(), comp);
+    sift_up(buffer.size() - 1);
   }
 
   template <typename... Args>
   void emplace(Args&&... args)
   {
     buffer.emplace_back(std::forward<Args>(args)...);
-    std::push_heap(buffer.begin(), buffer.end(), comp);
+    sift_up(buffer.size() - 1);
   }
 
   std::optional<T> pop()
   {
     if (buffer.empty()) return std::nullopt;
 
-    std::pop_heap(buffer.begin(), buffer.end(), comp);
-    T node = std::move(buffer.back());
+    T node = std::move(buffer.front());
+    T last = std::move(buffer.back());
     buffer.pop_back();
+    if (!buffer.empty()) { pop_sift(std::move(last)); }
     return node;
   }
 
+  // Removes the elements satisfying pred and rebuilds the heap, in linear time
+  template <typename Pred>
+  size_t remove_if(Pred pred)
+  {
+    auto last            = std::remove_if(buffer.begin(), buffer.end(), pred);
+    const size_t removed = buffer.end() - last;
+    if (removed == 0) { return 0; }
+    buffer.erase(last, buffer.end());
+    const size_t n = buffer.size();
+    if (n > 1) {
+      for (size_t k = (n - 2) / arity + 1; k-- > 0;) {
+        sift_down(k);
+      }
+    }
+    return removed;
+  }
+
   size_t size() const { return buffer.size(); }
   T& top() { return buffer.front(); }
   void clear() { buffer.clear(); }
@@ -63,11 +83,73 @@ class heap_t {
   const std::vector<T>& data() const { return buffer; }
 
  private:
+  static constexpr size_t arity = 4;
+
+  void sift_up(size_t k)
+  {
+    T value = std::move(buffer[k]);
+    while (k > 0) {
+      const size_t parent = (k - 1) / arity;
+      if (!comp(buffer[parent], value)) { break; }
+      buffer[k] = std::move(buffer[parent]);
+      k         = parent;
+    }
+    buffer[k] = std::move(value);
+  }
+
+  void sift_down(size_t k)
+  {
+    const size_t n = buffer.size();
+    T value        = std::move(buffer[k]);
+    while (true) {
+      const size_t first = arity * k + 1;
+      if (first >= n) { break; }
+      const size_t last = std::min(first + arity, n);
+      size_t best       = first;
+      for (size_t c = first + 1; c < last; ++c) {
+        if (comp(buffer[best], buffer[c])) { best = c; }
+      }
+      if (!comp(value, buffer[best])) { break; }
+      buffer[k] = std::move(buffer[best]);
+      k         = best;
+    }
+    buffer[k] = std::move(value);
+  }
+
+  // Moves the hole at k down to a leaf along the best children, then fills it with value from
+  // there. value comes from the bottom of the heap, so that it seldom climbs back far and this
+  // saves the comparison with value at every level of sift_down
+  void pop_sift(T value)
+  {
+    const size_t n = buffer.size();
+    size_t k       = 0;
+    while (true) {
+      const size_t first = arity * k + 1;
+      if (first >= n) { break; }
+      const size_t last = std::min(first + arity, n);
+      size_t best       = first;
+      for (size_t c = first + 1; c < last; ++c) {
+        if (comp(buffer[best], buffer[c])) { best = c; }
+      }
+      buffer[k] = std::move(buffer[best]);
+      k         = best;
+    }
+    while (k > 0) {
+      const size_t parent = (k - 1) / arity;
+      if (!comp(buffer[parent], value)) { break; }
+      buffer[k] = std::move(buffer[parent]);
+      k         = parent;
+    }
+    buffer[k] = std::move(value);
+  }
+
   std::vector<T> buffer;
   Comp comp;
 };
 
 // A queue storing the nodes waiting to be explored/dived from.
+// The sizes and the lower bound are republished as atomics after every change, so polling them,
+// which the scheduler and every plunging worker do constantly, does not take the lock
 template <typename i_t, typename f_t>
 class node_queue_t {
  private:
@@ -75,93 +157,214 @@ class node_queue_t {
     mip_node_t<i_t, f_t>* node = nullptr;
     f_t lower_bound            = -inf;
     f_t score                  = inf;
+    size_t basis_bytes         = 0;  // memory held by the basis of the node, 0 once spilled
+    i_t heaps                  = 0;  // number of heaps still holding the entry
 
     heap_entry_t(mip_node_t<i_t, f_t>* new_node)
       : node(new_node), lower_bound(new_node->lower_bound), score(new_node->objective_estimate)
     {
+      basis_bytes = new_node->packed_vstatus != nullptr ? new_node->packed_vstatus->bytes()
+                                                        : new_node->vstatus.size();
     }
   };
 
-  // Comparision function for ordering the nodes based on their lower bound with
-  // lowest one being explored first.
-  struct lower_bound_comp {
-    bool operator()(const std::shared_ptr<heap_entry_t>& a, const std::shared_ptr<heap_entry_t>& b)
-    {
-      // `a` will be placed after `b`
-      return a->lower_bound > b->lower_bound;
-    }
+  // The heaps hold the key they are ordered by next to the entry, so that comparisons do not
+  // chase the entry pointers and four children fit in a cache line. An entry is shared by both
+  // heaps and deleted by the last one to drop it
+  struct heap_item_t {
+    f_t key;
+    heap_entry_t* entry;
   };
 
-  // Comparision function for ordering the nodes based on some score (currently the pseudocost
-  // estimate) with the lowest being explored first.
-  struct score_comp {
-    bool operator()(const std::shared_ptr<heap_entry_t>& a, const std::shared_ptr<heap_entry_t>& b)
+  // Orders the nodes with the lowest key, the lower bound for best-first and some score
+  // (currently the pseudocost estimate) for diving, explored first.
+  struct key_comp {
+    bool operator()(const heap_item_t& a, const heap_item_t& b) const
     {
       // `a` will be placed after `b`
-      return a->score > b->score;
+      return a.key > b.key;
     }
   };
 
-  heap_t<std::shared_ptr<heap_entry_t>, lower_bound_comp> best_first_heap;
-  heap_t<std::shared_ptr<heap_entry_t>, score_comp> diving_heap;
+  heap_t<heap_item_t, key_comp> best_first_heap;
+  heap_t<heap_item_t, key_comp> diving_heap;
   omp_mutex_t mutex;
 
+  omp_atomic_t<i_t> best_first_size{0};
+  omp_atomic_t<i_t> diving_size{0};
+  omp_atomic_t<f_t> lower_bound{inf};
+  omp_atomic_t<size_t> basis_bytes{0};
+
+  size_t total_basis_bytes = 0;  // guarded by the mutex, published as basis_bytes
+
+  // Must be called with the mutex held
+  void publish()
+  {
+    best_first_size = best_first_heap.size();
+    diving_size     = diving_heap.size();
+    lower_bound     = best_first_heap.empty() ? inf : best_first_heap.top().key;
+    basis_bytes     = total_basis_bytes;
+  }
+
+  // Must be called with the mutex held, by a heap dropping the entry
+  static void release(heap_entry_t* entry)
+  {
+    if (--entry->heaps == 0) { delete entry; }
+  }
+
  public:
-  void push(mip_node_t<i_t, f_t>* new_node)
+  node_queue_t() = default;
+  node_queue_t(const node_queue_t&) = delete;
+  node_queue_t& operator=(const node_queue_t&) = delete;
+
+  ~node_queue_t()
   {
+    for (const auto& item : best_first_heap.data()) {
+      release(item.entry);
+    }
+    for (const auto& item : diving_heap.data()) {
+      release(item.entry);
+    }
+  }
+
+  void push(mip_node_t<i_t, f_t>* new_node) { push(&new_node, 1); }
+
+  // Pushes several nodes with a single acquisition of the lock
+  void push(mip_node_t<i_t, f_t>* const* new_nodes, i_t num_nodes)
+  {
+    if (num_nodes == 0) { return; }
     std::lock_guard<omp_mutex_t> lock(mutex);
-    auto entry = std::make_shared<heap_entry_t>(new_node);
-    best_first_heap.push(entry);
-    diving_heap.push(entry);
+    for (i_t k = 0; k < num_nodes; ++k) {
+      auto entry   = new heap_entry_t(new_nodes[k]);
+      entry->heaps = 2;
+      total_basis_bytes += entry->basis_bytes;
+      best_first_heap.push({entry->lower_bound, entry});
+      diving_heap.push({entry->score, entry});
+    }
+    publish();
   }
 
   std::optional<mip_node_t<i_t, f_t>*> pop_best_first()
   {
+    if (best_first_size == 0) { return std::nullopt; }
     std::lock_guard<omp_mutex_t> lock(mutex);
-    auto entry = best_first_heap.pop();
-
-    if (entry.has_value()) { return std::exchange(entry.value()->node, nullptr); }
-
-    return std::nullopt;
+    auto item = best_first_heap.pop();
+    if (!item.has_value()) {
+      publish();
+      return std::nullopt;
+    }
+    heap_entry_t* entry = item->entry;
+    total_basis_bytes -= entry->basis_bytes;
+    // The diving heap skips the entry from now on
+    mip_node_t<i_t, f_t>* node_ptr = std::exchange(entry->node, nullptr);
+    release(entry);
+    publish();
+    return node_ptr;
   }
 
   std::optional<mip_node_t<i_t, f_t>*> pop_diving()
   {
+    if (diving_size == 0) { return std::nullopt; }
     std::lock_guard<omp_mutex_t> lock(mutex);
 
     while (!diving_heap.empty()) {
-      auto entry = diving_heap.pop();
-
-      if (entry.has_value()) {
-        if (auto node_ptr = entry.value()->node; node_ptr != nullptr) { return node_ptr; }
+      heap_entry_t* entry            = diving_heap.pop()->entry;
+      mip_node_t<i_t, f_t>* node_ptr = entry->node;
+      release(entry);
+      if (node_ptr != nullptr) {
+        publish();
+        return node_ptr;
       }
     }
+    publish();
 
     return std::nullopt;
   }
 
-  i_t diving_queue_size()
-  {
-    std::lock_guard<omp_mutex_t> lock(mutex);
-    return diving_heap.size();
-  }
+  i_t diving_queue_size() const { return diving_size; }
+
+  i_t best_first_queue_size() const { return best_first_size; }
 
-  i_t best_first_queue_size()
+  f_t get_lower_bound() const { return lower_bound; }
+
+  // Estimate of the memory held by the bases of the queued nodes. Siblings sharing one packed
+  // basis are both counted, so this errs on the high side
+  size_t queued_basis_bytes() const { return basis_bytes; }
+
+  // Spills the bases of the queued nodes with the worst lower bounds to the file until the bases
+  // left in memory take at most target_bytes. These nodes are the last ones the best-first search
+  // will get to, and they are read back only then. Returns the number of nodes spilled
+  i_t spill_bases(size_t target_bytes, const std::shared_ptr<node_spill_file_t>& file)
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
-    return best_first_heap.size();
+    if (total_basis_bytes <= target_bytes) { return 0; }
+
+    std::vector<heap_entry_t*> candidates;
+    for (const auto& item : best_first_heap.data()) {
+      heap_entry_t* entry = item.entry;
+      if (entry->node != nullptr && entry->basis_bytes > 0 &&
+          entry->node->packed_vstatus != nullptr) {
+        candidates.push_back(entry);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](heap_entry_t* a, heap_entry_t* b) {
+      return a->lower_bound > b->lower_bound;
+    });
+
+    // Siblings share their packed basis, spill it once and give both the spilled copy. The map
+    // holds on to the original until the end, so its address cannot be reused meanwhile
+    using packed_ptr_t = std::shared_ptr<const packed_vstatus_t>;
+    std::unordered_map<const packed_vstatus_t*, std::pair<packed_ptr_t, packed_ptr_t>> spilled;
+    i_t num_spilled = 0;
+    for (heap_entry_t* entry : candidates) {
+      if (total_basis_bytes <= target_bytes) { break; }
+      auto& packed = entry->node->packed_vstatus;
+      auto it      = spilled.find(packed.get());
+      if (it == spilled.end()) {
+        auto spilled_copy = packed->spill(file);
+        if (spilled_copy == nullptr) { break; }
+        it = spilled.emplace(packed.get(), std::make_pair(packed, std::move(spilled_copy))).first;
+      }
+      packed = it->second.second;
+      total_basis_bytes -= entry->basis_bytes;
+      entry->basis_bytes = 0;
+      num_spilled++;
+    }
+    publish();
+    return num_spilled;
   }
 
-  f_t get_lower_bound()
+  // Removes the nodes whose lower bound exceeds upper_bound from both heaps, instead of leaving
+  // them queued until they are popped. Returns the removed nodes for the caller to fathom
+  std::vector<mip_node_t<i_t, f_t>*> prune(f_t upper_bound)
   {
+    std::vector<mip_node_t<i_t, f_t>*> pruned;
     std::lock_guard<omp_mutex_t> lock(mutex);
-    return best_first_heap.empty() ? inf : best_first_heap.top()->lower_bound;
+    if (best_first_heap.empty() || upper_bound == inf) { return pruned; }
+
+    best_first_heap.remove_if([&](const heap_item_t& item) {
+      if (item.key <= upper_bound) { return false; }
+      pruned.push_back(std::exchange(item.entry->node, nullptr));
+      total_basis_bytes -= item.entry->basis_bytes;
+      release(item.entry);
+      return true;
+    });
+    // Drops the pruned entries along with the ones best-first already took
+    if (!pruned.empty()) {
+      diving_heap.remove_if([](const heap_item_t& item) {
+        if (item.entry->node != nullptr) { return false; }
+        release(item.entry);
+        return true;
+      });
+    }
+    publish();
+    return pruned;
   }
 
   mip_node_t<i_t, f_t>* bfs_top()
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
-    return best_first_heap.empty() ? nullptr : best_first_heap.top()->node;
+    return best_first_heap.empty() ? nullptr : best_first_heap.top().entry->node;
   }
 };
 
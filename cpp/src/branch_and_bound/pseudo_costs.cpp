@@ -17,6 +17,7 @@
 #include <raft/core/nvtx.hpp>
 
 #include <omp.h>
+#include <mutex>
 
 namespace cuopt::linear_programming::dual_simplex {
 
@@ -296,6 +297,71 @@ static cuopt::mps_parser::mps_data_model_t<i_t, f_t> simplex_problem_to_mps_data
   return mps_model;
 }
 
+template <typename i_t, typename f_t>
+cuopt::mps_parser::mps_data_model_t<i_t, f_t> lp_problem_to_mps_data_model(
+  const lp_problem_t<i_t, f_t>& lp)
+{
+  cuopt::mps_parser::mps_data_model_t<i_t, f_t> mps_model;
+  const i_t m = lp.num_rows;
+  const i_t n = lp.num_cols;
+
+  csr_matrix_t<i_t, f_t> csr_A(m, n, 0);
+  lp.A.to_compressed_row(csr_A);
+  const i_t nz = csr_A.row_start[m];
+
+  mps_model.set_csr_constraint_matrix(
+    csr_A.x.data(), nz, csr_A.j.data(), nz, csr_A.row_start.data(), m + 1);
+  mps_model.set_objective_coefficients(lp.objective.data(), n);
+  mps_model.set_variable_lower_bounds(lp.lower.data(), n);
+  mps_model.set_variable_upper_bounds(lp.upper.data(), n);
+  mps_model.set_constraint_lower_bounds(lp.rhs.data(), m);
+  mps_model.set_constraint_upper_bounds(lp.rhs.data(), m);
+  mps_model.set_maximize(false);
+
+  return mps_model;
+}
+
+template <typename i_t, typename f_t>
+bool batch_pdlp_trial_branching_t<i_t, f_t>::try_solve(const lp_problem_t<i_t, f_t>& leaf_problem,
+                                                       const std::vector<i_t>& candidates,
+                                                       const std::vector<f_t>& solution,
+                                                       f_t time_limit,
+                                                       std::vector<f_t>& obj_down,
+                                                       std::vector<f_t>& obj_up)
+{
+  if (time_limit <= 0.0 || candidates.empty()) { return false; }
+  if (!mutex_.try_lock()) { return false; }
+  std::lock_guard<omp_mutex_t> lock(mutex_, std::adopt_lock);
+  raft::common::nvtx::range scope("BB::batch_pdlp_trial_branching");
+
+  if (!handle_) { handle_ = std::make_unique<raft::handle_t>(); }
+
+  std::vector<f_t> candidate_values(candidates.size());
+  for (size_t k = 0; k < candidates.size(); ++k) {
+    candidate_values[k] = solution[candidates[k]];
+  }
+
+  const auto mps_model = lp_problem_to_mps_data_model(leaf_problem);
+  pdlp_solver_settings_t<i_t, f_t> pdlp_settings;
+  pdlp_settings.time_limit = time_limit;
+  const auto solutions =
+    batch_pdlp_solve(handle_.get(), mps_model, candidates, candidate_values, pdlp_settings);
+
+  const size_t num_candidates = candidates.size();
+  obj_down.assign(num_candidates, std::numeric_limits<f_t>::quiet_NaN());
+  obj_up.assign(num_candidates, std::numeric_limits<f_t>::quiet_NaN());
+  for (size_t k = 0; k < num_candidates; ++k) {
+    if (solutions.get_termination_status(k) == pdlp_termination_status_t::Optimal) {
+      obj_down[k] = solutions.get_dual_objective_value(k);
+    }
+    if (solutions.get_termination_status(k + num_candidates) ==
+        pdlp_termination_status_t::Optimal) {
+      obj_up[k] = solutions.get_dual_objective_value(k + num_candidates);
+    }
+  }
+  return true;
+}
+
 template <typename i_t, typename f_t>
 void strong_branching(const user_problem_t<i_t, f_t>& original_problem,
                       const lp_problem_t<i_t, f_t>& original_lp,
@@ -475,6 +541,36 @@ void pseudo_costs_t<i_t, f_t>::update_pseudo_costs(mip_node_t<i_t, f_t>* node_pt
   }
 }
 
+template <typename i_t, typename f_t>
+void pseudo_costs_t<i_t, f_t>::queue_update(mip_node_t<i_t, f_t>* node_ptr,
+                                            f_t leaf_objective,
+                                            i_t worker_id)
+{
+  if (worker_id < 0 || worker_id >= (i_t)pending_updates_.size()) {
+    update_pseudo_costs(node_ptr, leaf_objective);
+    return;
+  }
+
+  const f_t change_in_obj = std::max(leaf_objective - node_ptr->lower_bound, 0.0);
+  const f_t frac          = node_ptr->branch_dir == rounding_direction_t::DOWN
+                              ? node_ptr->fractional_val - std::floor(node_ptr->fractional_val)
+                              : std::ceil(node_ptr->fractional_val) - node_ptr->fractional_val;
+
+  auto& updates = pending_updates_[worker_id].updates;
+  updates.push_back(
+    {node_ptr->branch_var, node_ptr->branch_dir, change_in_obj / frac, 0.0, (int)worker_id});
+  if (updates.size() >= update_merge_interval) { flush_updates(worker_id); }
+}
+
+template <typename i_t, typename f_t>
+void pseudo_costs_t<i_t, f_t>::flush_updates(i_t worker_id)
+{
+  if (worker_id < 0 || worker_id >= (i_t)pending_updates_.size()) { return; }
+  auto& updates = pending_updates_[worker_id].updates;
+  merge_updates(updates);
+  updates.clear();
+}
+
 template <typename i_t, typename f_t>
 void pseudo_costs_t<i_t, f_t>::initialized(i_t& num_initialized_down,
                                            i_t& num_initialized_up,
@@ -631,6 +727,52 @@ i_t pseudo_costs_t<i_t, f_t>::reliable_variable_selection(
     return branch_var;
   }
 
+  // Whether a batch runs depends on the timing of the other workers, so the deterministic mode
+  // always uses the dual simplex trial branching
+  if (settings.mip_batch_pdlp_strong_branching == 2 && !settings.deterministic) {
+    std::vector<i_t> candidates(unreliable_list.begin(), unreliable_list.begin() + num_candidates);
+    std::vector<f_t> obj_down;
+    std::vector<f_t> obj_up;
+    const f_t remaining_time = settings.time_limit - toc(start_time);
+    if (batch_pdlp_trial_branching.try_solve(
+          worker->leaf_problem, candidates, solution, remaining_time, obj_down, obj_up)) {
+      for (i_t k = 0; k < num_candidates; ++k) {
+        const i_t j = candidates[k];
+
+        pseudo_cost_mutex_down[j].lock();
+        if (pseudo_cost_num_down[j] < reliable_threshold && !std::isnan(obj_down[k])) {
+          f_t change_in_obj = std::max(obj_down[k] - node_ptr->lower_bound, eps);
+          f_t change_in_x   = solution[j] - std::floor(solution[j]);
+          pseudo_cost_sum_down[j] += change_in_obj / change_in_x;
+          pseudo_cost_num_down[j]++;
+        }
+        pseudo_cost_mutex_down[j].unlock();
+
+        pseudo_cost_mutex_up[j].lock();
+        if (pseudo_cost_num_up[j] < reliable_threshold && !std::isnan(obj_up[k])) {
+          f_t change_in_obj = std::max(obj_up[k] - node_ptr->lower_bound, eps);
+          f_t change_in_x   = std::ceil(solution[j]) - solution[j];
+          pseudo_cost_sum_up[j] += change_in_obj / change_in_x;
+          pseudo_cost_num_up[j]++;
+        }
+        pseudo_cost_mutex_up[j].unlock();
+
+        f_t score =
+          calculate_pseudocost_score(j, solution, pseudo_cost_up_avg, pseudo_cost_down_avg);
+        if (score > max_score) {
+          max_score  = score;
+          branch_var = j;
+        }
+      }
+
+      log.debug("pc branching on %d (batch PDLP). Value %e. Score %e\n",
+                branch_var,
+                solution[branch_var],
+                max_score);
+      return branch_var;
+    }
+  }
+
 #pragma omp taskloop if (num_tasks > 1) priority(task_priority) num_tasks(num_tasks) \
   shared(score_mutex)
   for (i_t i = 0; i < num_candidates; ++i) {
@@ -774,6 +916,10 @@ void pseudo_costs_t<i_t, f_t>::update_pseudo_costs_from_strong_branching(
 
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 
+template cuopt::mps_parser::mps_data_model_t<int, double> lp_problem_to_mps_data_model(
+  const lp_problem_t<int, double>& lp);
+
+template class batch_pdlp_trial_branching_t<int, double>;
 template class pseudo_costs_t<int, double>;
 
 template void strong_branching<int, double>(const user_problem_t<int, double>& original_problem,
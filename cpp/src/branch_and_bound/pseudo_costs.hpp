@@ -18,9 +18,15 @@
 #include <utilities/omp_helpers.hpp>
 #include <utilities/pcgenerator.hpp>
 
+#include <mps_parser/mps_data_model.hpp>
+
+#include <raft/core/handle.hpp>
+
 #include <omp.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <memory>
 
 namespace cuopt::linear_programming::dual_simplex {
 
@@ -405,6 +411,35 @@ struct reliability_branching_settings_t {
   i_t min_reliable_threshold = 1;
 };
 
+// The LP of a node is in equality form, A x = b, and its objective is c^T x without the constant,
+// so the objectives of a batch PDLP solve match the lower bounds of the nodes
+template <typename i_t, typename f_t>
+cuopt::mps_parser::mps_data_model_t<i_t, f_t> lp_problem_to_mps_data_model(
+  const lp_problem_t<i_t, f_t>& lp);
+
+// Trial branching of the unreliable candidates of a node as a single batch PDLP solve on the GPU.
+// Only one batch runs at a time. A worker that finds the GPU busy falls back to the dual simplex
+// trial branching instead of waiting, so the GPU keeps working through the tree alongside the CPU.
+// As this depends on the timing of the workers, it is not used in the deterministic mode.
+// The objectives are the PDLP dual objectives, i.e., approximate bounds of the child LPs.
+template <typename i_t, typename f_t>
+class batch_pdlp_trial_branching_t {
+ public:
+  // Returns false, leaving obj_down and obj_up untouched, if another batch is running. Otherwise,
+  // obj_down[k] and obj_up[k] are the objectives of the children of candidates[k], NaN if the
+  // child was not solved to optimality.
+  bool try_solve(const lp_problem_t<i_t, f_t>& leaf_problem,
+                 const std::vector<i_t>& candidates,
+                 const std::vector<f_t>& solution,
+                 f_t time_limit,
+                 std::vector<f_t>& obj_down,
+                 std::vector<f_t>& obj_up);
+
+ private:
+  omp_mutex_t mutex_;
+  std::unique_ptr<raft::handle_t> handle_;
+};
+
 template <typename i_t, typename f_t>
 class pseudo_costs_t {
  public:
@@ -420,6 +455,22 @@ class pseudo_costs_t {
 
   void update_pseudo_costs(mip_node_t<i_t, f_t>* node_ptr, f_t leaf_objective);
 
+  // Updates of a worker are buffered and merged into the shared pseudocosts every
+  // update_merge_interval nodes, so that the workers do not write to the same hot variables at
+  // every node. Without buffers, i.e., before set_num_workers, the update is applied right away
+  static constexpr size_t update_merge_interval = 32;
+
+  void set_num_workers(i_t num_workers)
+  {
+    pending_updates_.clear();
+    pending_updates_.resize(num_workers);
+  }
+
+  void queue_update(mip_node_t<i_t, f_t>* node_ptr, f_t leaf_objective, i_t worker_id);
+
+  // Merges the buffered updates of the worker. Call when the worker stops exploring
+  void flush_updates(i_t worker_id);
+
   pseudo_cost_snapshot_t<i_t, f_t> create_snapshot() const
   {
     const i_t n = (i_t)pseudo_cost_sum_down.size();
@@ -435,6 +486,18 @@ class pseudo_costs_t {
       std::move(sd), std::move(su), std::move(nd), std::move(nu));
   }
 
+  // Restores the pseudocosts of the variables covered by the snapshot, e.g., from a checkpoint
+  void restore_snapshot(const pseudo_cost_snapshot_t<i_t, f_t>& snapshot)
+  {
+    const i_t n = std::min<i_t>(pseudo_cost_sum_down.size(), snapshot.n_vars());
+    for (i_t j = 0; j < n; ++j) {
+      pseudo_cost_sum_down[j] = snapshot.sum_down_[j];
+      pseudo_cost_sum_up[j]   = snapshot.sum_up_[j];
+      pseudo_cost_num_down[j] = snapshot.num_down_[j];
+      pseudo_cost_num_up[j]   = snapshot.num_up_[j];
+    }
+  }
+
   void merge_updates(const std::vector<pseudo_cost_update_t<i_t, f_t>>& updates)
   {
     for (const auto& upd : updates) {
@@ -503,6 +566,7 @@ class pseudo_costs_t {
                                  f_t pseudo_cost_down_avg) const;
 
   reliability_branching_settings_t<i_t, f_t> reliability_branching_settings;
+  batch_pdlp_trial_branching_t<i_t, f_t> batch_pdlp_trial_branching;
 
   std::vector<omp_atomic_t<f_t>> pseudo_cost_sum_up;
   std::vector<omp_atomic_t<f_t>> pseudo_cost_sum_down;
@@ -514,6 +578,13 @@ class pseudo_costs_t {
   std::vector<omp_mutex_t> pseudo_cost_mutex_down;
   omp_atomic_t<i_t> num_strong_branches_completed = 0;
   omp_atomic_t<int64_t> strong_branching_lp_iter  = 0;
+
+ private:
+  // One per worker, on its own cache line
+  struct alignas(64) pending_updates_t {
+    std::vector<pseudo_cost_update_t<i_t, f_t>> updates;
+  };
+  std::vector<pending_updates_t> pending_updates_;
 };
 
 template <typename i_t, typename f_t>
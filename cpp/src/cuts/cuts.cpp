@@ -10,17 +10,36 @@
 #include <dual_simplex/basis_solves.hpp>
 #include <dual_simplex/tic_toc.hpp>
 
+#include <utilities/hashing.hpp>
+
 #include <barrier/dense_matrix.hpp>
 
 namespace cuopt::linear_programming::dual_simplex {
 
+template <typename i_t, typename f_t>
+f_t cut_pool_t<i_t, f_t>::normalized_key(const sparse_vector_t<i_t, f_t>& cut,
+                                         std::vector<int64_t>& key) const
+{
+  f_t max_coeff = 0.0;
+  for (f_t x : cut.x) {
+    max_coeff = std::max(max_coeff, std::abs(x));
+  }
+  const f_t scale = 1.0 / max_coeff;
+  // Coarse enough that cuts generated twice with rounding differences have the same key
+  const f_t quantum = 1e9;
+  key.resize(2 * cut.i.size());
+  for (size_t k = 0; k < cut.i.size(); k++) {
+    key[2 * k]     = cut.i[k];
+    key[2 * k + 1] = std::llround(cut.x[k] * scale * quantum);
+  }
+  return scale;
+}
+
 template <typename i_t, typename f_t>
 void cut_pool_t<i_t, f_t>::add_cut(cut_type_t cut_type,
                                    const sparse_vector_t<i_t, f_t>& cut,
                                    f_t rhs)
 {
-  // TODO: Need to deduplicate cuts and only add if the cut is not already in the pool
-
   for (i_t p = 0; p < cut.i.size(); p++) {
     const i_t j = cut.i[p];
     if (j >= original_vars_) {
@@ -36,6 +55,27 @@ void cut_pool_t<i_t, f_t>::add_cut(cut_type_t cut_type,
     settings_.log.printf("Cut has no coefficients\n");
     return;
   }
+  cut_squeezed.sort();
+
+  std::vector<int64_t> key;
+  const f_t scale     = normalized_key(cut_squeezed, key);
+  const uint32_t hash = detail::compute_hash(key);
+  auto& same_hash     = cut_hash_rows_[hash];
+  std::vector<int64_t> row_key;
+  for (i_t row : same_hash) {
+    sparse_vector_t<i_t, f_t> pool_cut(cut_storage_, row);
+    const f_t row_scale = normalized_key(pool_cut, row_key);
+    if (row_key != key) { continue; }
+    // Same cut up to a positive scaling: keep the larger right-hand side
+    if (rhs * scale > rhs_storage_[row] * row_scale) {
+      rhs_storage_[row] = rhs * scale / row_scale;
+      cut_type_[row]    = cut_type;
+      cut_age_[row]     = 0;
+    }
+    return;
+  }
+  same_hash.push_back(cut_storage_.m);
+
   cut_storage_.append_row(cut_squeezed);
   rhs_storage_.push_back(rhs);
   cut_type_.push_back(cut_type);
@@ -75,81 +115,120 @@ f_t cut_pool_t<i_t, f_t>::cut_density(i_t row)
 }
 
 template <typename i_t, typename f_t>
-f_t cut_pool_t<i_t, f_t>::cut_orthogonality(i_t i, i_t j)
-{
-  const i_t i_start = cut_storage_.row_start[i];
-  const i_t i_end   = cut_storage_.row_start[i + 1];
-  const i_t i_nz    = i_end - i_start;
-  const i_t j_start = cut_storage_.row_start[j];
-  const i_t j_end   = cut_storage_.row_start[j + 1];
-  const i_t j_nz    = j_end - j_start;
-
-  f_t dot = sparse_dot(cut_storage_.j.data() + i_start,
-                       cut_storage_.x.data() + i_start,
-                       i_nz,
-                       cut_storage_.j.data() + j_start,
-                       cut_storage_.x.data() + j_start,
-                       j_nz);
-
-  f_t norm_i = cut_norms_[i];
-  f_t norm_j = cut_norms_[j];
-  return 1.0 - std::abs(dot) / (norm_i * norm_j);
-}
-
-template <typename i_t, typename f_t>
-void cut_pool_t<i_t, f_t>::score_cuts(std::vector<f_t>& x_relax)
+void cut_pool_t<i_t, f_t>::score_cuts(std::vector<f_t>& x_relax,
+                                      const std::vector<f_t>& objective,
+                                      i_t max_cuts)
 {
   const f_t min_cut_distance = 1e-4;
+  // Weight of the parallelism with the objective in the score, as a fraction of the efficacy
+  const f_t objective_parallelism_weight = 0.1;
+  // Candidates scoring below this fraction of the best score are not worth a row of the LP
+  const f_t min_relative_score = 1e-3;
   cut_distances_.resize(cut_storage_.m, 0.0);
   cut_norms_.resize(cut_storage_.m, 0.0);
+  cut_objective_parallelism_.resize(cut_storage_.m, 0.0);
+  cut_scores_.resize(cut_storage_.m, 0.0);
 
-  const bool verbose = false;
+  f_t objective_norm = 0.0;
+  for (i_t j = 0; j < original_vars_; j++) {
+    objective_norm += objective[j] * objective[j];
+  }
+  objective_norm = std::sqrt(objective_norm);
+
+  // Efficacy, objective parallelism and score of every candidate in one pass over the pool
+#pragma omp parallel for num_threads(settings_.num_threads) schedule(dynamic, 64)
   for (i_t i = 0; i < cut_storage_.m; i++) {
     f_t violation;
     f_t cut_dist      = cut_distance(i, x_relax, violation, cut_norms_[i]);
     cut_distances_[i] = cut_dist <= min_cut_distance ? 0.0 : cut_dist;
-    if (verbose) {
-      settings_.log.printf("Cut %d type %d distance %+e violation %+e cut_norm %e\n",
+    f_t objective_dot = 0.0;
+    if (objective_norm > 0.0) {
+      for (i_t p = cut_storage_.row_start[i]; p < cut_storage_.row_start[i + 1]; p++) {
+        objective_dot += cut_storage_.x[p] * objective[cut_storage_.j[p]];
+      }
+    }
+    cut_objective_parallelism_[i] =
+      objective_norm > 0.0 ? std::abs(objective_dot) / (cut_norms_[i] * objective_norm) : 0.0;
+    cut_scores_[i] =
+      cut_distances_[i] * (1.0 + objective_parallelism_weight * cut_objective_parallelism_[i]);
+  }
+
+  const bool verbose = false;
+  if (verbose) {
+    for (i_t i = 0; i < cut_storage_.m; i++) {
+      settings_.log.printf("Cut %d type %d distance %+e objective parallelism %.3f score %e\n",
                            i,
                            static_cast<int>(cut_type_[i]),
                            cut_distances_[i],
-                           violation,
-                           cut_norms_[i]);
+                           cut_objective_parallelism_[i],
+                           cut_scores_[i]);
     }
   }
 
   std::vector<i_t> sorted_indices;
-  best_score_last_permutation(cut_distances_, sorted_indices);
+  best_score_last_permutation(cut_scores_, sorted_indices);
+  const f_t min_score =
+    sorted_indices.empty() ? 0.0 : min_relative_score * cut_scores_[sorted_indices.back()];
 
-  const i_t max_cuts          = 2000;
   const f_t min_orthogonality = settings_.cut_min_orthogonality;
   best_cuts_.reserve(std::min(max_cuts, cut_storage_.m));
   best_cuts_.clear();
   scored_cuts_ = 0;
 
+  // A candidate only has a nonzero dot product with the accepted cuts that share one of its
+  // columns, the others are orthogonal to it. The dot products are accumulated through the
+  // accepted cuts of each column, instead of sparse dot products with every accepted cut
+  accepted_columns_.resize(original_vars_);
+  std::vector<i_t> used_columns;
+  std::vector<f_t> accepted_dot(std::min(max_cuts, cut_storage_.m), 0.0);
+  std::vector<char> accepted_touched(accepted_dot.size(), 0);
+  std::vector<i_t> touched;
+  auto accept_cut = [&](i_t i) {
+    const i_t k = best_cuts_.size();
+    best_cuts_.push_back(i);
+    scored_cuts_++;
+    for (i_t p = cut_storage_.row_start[i]; p < cut_storage_.row_start[i + 1]; p++) {
+      const i_t j = cut_storage_.j[p];
+      if (accepted_columns_[j].empty()) { used_columns.push_back(j); }
+      accepted_columns_[j].push_back({k, cut_storage_.x[p]});
+    }
+  };
+
   if (!sorted_indices.empty()) {
     const i_t i = sorted_indices.back();
     sorted_indices.pop_back();
-    best_cuts_.push_back(i);
-    scored_cuts_++;
+    accept_cut(i);
   }
 
   while (scored_cuts_ < max_cuts && !sorted_indices.empty()) {
     const i_t i = sorted_indices.back();
     sorted_indices.pop_back();
 
-    if (cut_distances_[i] <= min_cut_distance) { break; }
+    if (cut_distances_[i] <= min_cut_distance || cut_scores_[i] < min_score) { break; }
 
-    f_t cut_ortho            = 1.0;
-    const i_t best_cuts_size = best_cuts_.size();
-    for (i_t k = 0; k < best_cuts_size; k++) {
-      const i_t j = best_cuts_[k];
-      cut_ortho   = std::min(cut_ortho, cut_orthogonality(i, j));
+    for (i_t p = cut_storage_.row_start[i]; p < cut_storage_.row_start[i + 1]; p++) {
+      const f_t a_j = cut_storage_.x[p];
+      for (const auto& [k, b_j] : accepted_columns_[cut_storage_.j[p]]) {
+        if (!accepted_touched[k]) {
+          accepted_touched[k] = 1;
+          touched.push_back(k);
+        }
+        accepted_dot[k] += a_j * b_j;
+      }
     }
-    if (cut_ortho >= min_orthogonality) {
-      best_cuts_.push_back(i);
-      scored_cuts_++;
+    f_t cut_ortho = 1.0;
+    for (i_t k : touched) {
+      const f_t norms     = cut_norms_[i] * cut_norms_[best_cuts_[k]];
+      cut_ortho           = std::min(cut_ortho, 1.0 - std::abs(accepted_dot[k]) / norms);
+      accepted_dot[k]     = 0.0;
+      accepted_touched[k] = 0;
     }
+    touched.clear();
+    if (cut_ortho >= min_orthogonality) { accept_cut(i); }
+  }
+
+  for (i_t j : used_columns) {
+    accepted_columns_[j].clear();
   }
 }
 
@@ -552,6 +631,485 @@ f_t knapsack_generation_t<i_t, f_t>::solve_knapsack_problem(const std::vector<f_
   return objective;
 }
 
+// The row is a'*x + a_s*s = b. The range of a_s*s decides whether a'*x <= b or a'*x >= b holds.
+// Without a slack, slack < 0, the row is an equality and both hold
+template <typename i_t, typename f_t>
+void row_senses(const lp_problem_t<i_t, f_t>& lp,
+                i_t slack,
+                f_t slack_coeff,
+                bool& less_equal,
+                bool& greater_equal)
+{
+  less_equal    = true;
+  greater_equal = true;
+  if (slack < 0) { return; }
+  const f_t slack_min =
+    slack_coeff > 0.0 ? slack_coeff * lp.lower[slack] : slack_coeff * lp.upper[slack];
+  const f_t slack_max =
+    slack_coeff > 0.0 ? slack_coeff * lp.upper[slack] : slack_coeff * lp.lower[slack];
+  less_equal    = slack_min >= 0.0;
+  greater_equal = slack_max <= 0.0;
+}
+
+template <typename i_t, typename f_t>
+clique_generation_t<i_t, f_t>::clique_generation_t(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<i_t>& new_slacks,
+  const std::vector<variable_type_t>& var_types)
+{
+  const i_t n = lp.num_cols;
+  std::vector<i_t> is_slack(n, 0);
+  for (i_t j : new_slacks) {
+    is_slack[j] = 1;
+  }
+
+  clique_start_.push_back(0);
+  std::vector<std::pair<f_t, i_t>> row_binaries;
+  for (i_t i = 0; i < lp.num_rows; i++) {
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+
+    bool binary_row = true;
+    i_t slack       = -1;
+    f_t slack_coeff = 0.0;
+    for (i_t p = row_start; p < row_end; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack[j]) {
+        slack       = j;
+        slack_coeff = Arow.x[p];
+        continue;
+      }
+      if (var_types[j] != variable_type_t::INTEGER || lp.lower[j] != 0.0 || lp.upper[j] != 1.0) {
+        binary_row = false;
+        break;
+      }
+    }
+    if (!binary_row) { continue; }
+
+    bool less_equal;
+    bool greater_equal;
+    row_senses(lp, slack, slack_coeff, less_equal, greater_equal);
+
+    for (f_t sign : {1.0, -1.0}) {
+      if ((sign > 0.0 && !less_equal) || (sign < 0.0 && !greater_equal)) { continue; }
+      // sign*a'*x <= sign*b, only with positive coefficients
+      row_binaries.clear();
+      bool positive = true;
+      for (i_t p = row_start; p < row_end; p++) {
+        const i_t j = Arow.j[p];
+        if (is_slack[j]) { continue; }
+        const f_t aj = sign * Arow.x[p];
+        if (aj <= 0.0) {
+          positive = false;
+          break;
+        }
+        row_binaries.push_back({aj, j});
+      }
+      if (!positive || row_binaries.size() < 2) { continue; }
+
+      // Sorted by decreasing coefficient, a prefix is a clique as long as its two smallest
+      // coefficients conflict
+      const f_t beta = sign * lp.rhs[i] + settings.primal_tol;
+      std::sort(row_binaries.begin(), row_binaries.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+      });
+      if (row_binaries[0].first + row_binaries[1].first <= beta) { continue; }
+      size_t clique_size = 2;
+      while (clique_size < row_binaries.size() &&
+             row_binaries[clique_size - 1].first + row_binaries[clique_size].first > beta) {
+        clique_size++;
+      }
+      for (size_t k = 0; k < clique_size; k++) {
+        clique_vars_.push_back(row_binaries[k].second);
+      }
+      clique_start_.push_back(clique_vars_.size());
+    }
+  }
+
+  // Transpose the cliques to get the cliques of each variable
+  var_clique_start_.assign(n + 1, 0);
+  for (i_t j : clique_vars_) {
+    var_clique_start_[j + 1]++;
+  }
+  for (i_t j = 0; j < n; j++) {
+    var_clique_start_[j + 1] += var_clique_start_[j];
+  }
+  var_cliques_.resize(clique_vars_.size());
+  std::vector<i_t> next(var_clique_start_.begin(), var_clique_start_.end() - 1);
+  for (i_t c = 0; c < num_cliques(); c++) {
+    for (i_t p = clique_start_[c]; p < clique_start_[c + 1]; p++) {
+      var_cliques_[next[clique_vars_[p]]++] = c;
+    }
+  }
+  mark_.assign(n, 0);
+
+  settings.log.debug("Conflict graph with %d cliques and %ld entries\n",
+                     num_cliques(),
+                     clique_vars_.size());
+}
+
+template <typename i_t, typename f_t>
+size_t clique_generation_t<i_t, f_t>::mark_neighbors(i_t j)
+{
+  if (mark_stamp_ == std::numeric_limits<i_t>::max()) {
+    std::fill(mark_.begin(), mark_.end(), 0);
+    mark_stamp_ = 0;
+  }
+  ++mark_stamp_;
+  size_t work = 0;
+  for (i_t q = var_clique_start_[j]; q < var_clique_start_[j + 1]; q++) {
+    const i_t c = var_cliques_[q];
+    for (i_t p = clique_start_[c]; p < clique_start_[c + 1]; p++) {
+      mark_[clique_vars_[p]] = mark_stamp_;
+    }
+    work += clique_start_[c + 1] - clique_start_[c];
+  }
+  return work;
+}
+
+template <typename i_t, typename f_t>
+size_t clique_generation_t<i_t, f_t>::grow_clique(std::vector<i_t>& candidates,
+                                                 std::vector<i_t>& clique)
+{
+  size_t work  = 0;
+  size_t first = 0;
+  while (first < candidates.size()) {
+    const i_t j = candidates[first++];
+    clique.push_back(j);
+    work += mark_neighbors(j);
+    // Keep the remaining candidates that also conflict with j
+    size_t kept = first;
+    for (size_t k = first; k < candidates.size(); k++) {
+      if (mark_[candidates[k]] == mark_stamp_) { candidates[kept++] = candidates[k]; }
+    }
+    work += candidates.size() - first;
+    candidates.resize(kept);
+  }
+  return work;
+}
+
+template <typename i_t, typename f_t>
+void clique_generation_t<i_t, f_t>::generate_clique_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  const std::vector<f_t>& xstar,
+  std::vector<sparse_vector_t<i_t, f_t>>& cuts,
+  std::vector<f_t>& cut_rhs)
+{
+  cuts.clear();
+  cut_rhs.clear();
+  const i_t n   = var_clique_start_.size() - 1;
+  const f_t tol = 1e-6;
+
+  // A violated clique has a fractional member, otherwise two of its members at one would violate
+  // the row that put them in conflict
+  std::vector<i_t> seeds;
+  for (i_t j = 0; j < n; j++) {
+    if (var_clique_start_[j + 1] > var_clique_start_[j] && xstar[j] > tol && xstar[j] < 1.0 - tol) {
+      seeds.push_back(j);
+    }
+  }
+  auto larger_value = [&xstar](i_t a, i_t b) {
+    return xstar[a] > xstar[b] || (xstar[a] == xstar[b] && a < b);
+  };
+  std::sort(seeds.begin(), seeds.end(), larger_value);
+
+  const i_t max_cuts      = 1000;
+  const size_t work_limit = 100000000;
+  size_t work             = 0;
+  std::vector<char> in_cut(n, 0);
+  std::vector<i_t> candidates;
+  std::vector<i_t> lifting;
+  std::vector<i_t> clique;
+  for (i_t seed : seeds) {
+    if (static_cast<i_t>(cuts.size()) >= max_cuts || work > work_limit) { break; }
+    if (in_cut[seed]) { continue; }
+
+    // The neighbors of the seed in the support of xstar are tried by decreasing value, the others
+    // are kept for lifting
+    work += 2 * mark_neighbors(seed);
+    const i_t stamp = mark_stamp_;
+    candidates.assign(1, seed);
+    lifting.clear();
+    for (i_t q = var_clique_start_[seed]; q < var_clique_start_[seed + 1]; q++) {
+      const i_t c = var_cliques_[q];
+      for (i_t p = clique_start_[c]; p < clique_start_[c + 1]; p++) {
+        const i_t j = clique_vars_[p];
+        if (j == seed || mark_[j] != stamp) { continue; }
+        mark_[j] = 0;
+        if (xstar[j] > tol) {
+          candidates.push_back(j);
+        } else {
+          lifting.push_back(j);
+        }
+      }
+    }
+    std::sort(candidates.begin() + 1, candidates.end(), larger_value);
+
+    clique.clear();
+    work += grow_clique(candidates, clique);
+    f_t clique_value = 0.0;
+    for (i_t j : clique) {
+      clique_value += xstar[j];
+    }
+    if (clique_value <= 1.0 + tol) { continue; }
+
+    // Lift with the variables at zero that conflict with every member
+    for (size_t k = 1; k < clique.size() && !lifting.empty(); k++) {
+      work += mark_neighbors(clique[k]);
+      size_t kept = 0;
+      for (i_t j : lifting) {
+        if (mark_[j] == mark_stamp_) { lifting[kept++] = j; }
+      }
+      lifting.resize(kept);
+    }
+    work += grow_clique(lifting, clique);
+
+    sparse_vector_t<i_t, f_t> cut(lp.num_cols, 0);
+    cut.i.reserve(clique.size());
+    cut.x.reserve(clique.size());
+    for (i_t j : clique) {
+      cut.i.push_back(j);
+      cut.x.push_back(-1.0);
+      in_cut[j] = 1;
+    }
+    cut.sort();
+    cuts.push_back(std::move(cut));
+    cut_rhs.push_back(-1.0);
+  }
+}
+
+template <typename i_t, typename f_t>
+flow_cover_generation_t<i_t, f_t>::flow_cover_generation_t(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<i_t>& new_slacks,
+  const std::vector<variable_type_t>& var_types)
+{
+  const i_t n = lp.num_cols;
+  is_slack_.assign(n, 0);
+  for (i_t j : new_slacks) {
+    is_slack_[j] = 1;
+  }
+  auto is_binary = [&](i_t j) {
+    return var_types[j] == variable_type_t::INTEGER && lp.lower[j] == 0.0 && lp.upper[j] == 1.0;
+  };
+
+  // Variable upper bound rows: a_x x + a_y y <= 0 with a_x > 0 > a_y, y binary and x >= 0
+  vub_var_.assign(n, -1);
+  vub_coeff_.assign(n, inf);
+  for (i_t i = 0; i < lp.num_rows; i++) {
+    i_t slack       = -1;
+    f_t slack_coeff = 0.0;
+    i_t vars[2];
+    f_t coeffs[2];
+    i_t num_vars = 0;
+    for (i_t p = Arow.row_start[i]; p < Arow.row_start[i + 1] && num_vars <= 2; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack_[j]) {
+        slack       = j;
+        slack_coeff = Arow.x[p];
+      } else {
+        if (num_vars < 2) {
+          vars[num_vars]   = j;
+          coeffs[num_vars] = Arow.x[p];
+        }
+        num_vars++;
+      }
+    }
+    if (num_vars != 2 || std::abs(lp.rhs[i]) > settings.primal_tol) { continue; }
+    if (is_binary(vars[0]) == is_binary(vars[1])) { continue; }
+    const i_t y   = is_binary(vars[0]) ? 0 : 1;
+    const i_t x   = 1 - y;
+    const i_t x_j = vars[x];
+    if (lp.lower[x_j] != 0.0) { continue; }
+
+    bool less_equal;
+    bool greater_equal;
+    row_senses(lp, slack, slack_coeff, less_equal, greater_equal);
+    for (f_t sign : {1.0, -1.0}) {
+      if ((sign > 0.0 && !less_equal) || (sign < 0.0 && !greater_equal)) { continue; }
+      const f_t a_x = sign * coeffs[x];
+      const f_t a_y = sign * coeffs[y];
+      if (a_x <= 0.0 || a_y >= 0.0) { continue; }
+      if (-a_y / a_x < vub_coeff_[x_j]) {
+        vub_var_[x_j]   = vars[y];
+        vub_coeff_[x_j] = -a_y / a_x;
+      }
+    }
+  }
+
+  // Flow rows: nonnegative variables only, and at least one arc of N+ with a variable upper bound
+  for (i_t i = 0; i < lp.num_rows; i++) {
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+    i_t slack           = -1;
+    f_t slack_coeff     = 0.0;
+    i_t num_vars        = 0;
+    bool nonnegative    = true;
+    for (i_t p = row_start; p < row_end; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack_[j]) {
+        slack       = j;
+        slack_coeff = Arow.x[p];
+        continue;
+      }
+      num_vars++;
+      if (lp.lower[j] != 0.0) {
+        nonnegative = false;
+        break;
+      }
+    }
+    // Rows with two variables are the bounds themselves
+    if (!nonnegative || num_vars < 3) { continue; }
+
+    bool less_equal;
+    bool greater_equal;
+    row_senses(lp, slack, slack_coeff, less_equal, greater_equal);
+    for (f_t sign : {1.0, -1.0}) {
+      if ((sign > 0.0 && !less_equal) || (sign < 0.0 && !greater_equal)) { continue; }
+      bool has_vub_arc = false;
+      for (i_t p = row_start; p < row_end && !has_vub_arc; p++) {
+        const i_t j = Arow.j[p];
+        has_vub_arc = !is_slack_[j] && vub_var_[j] >= 0 && sign * Arow.x[p] > 0.0;
+      }
+      if (has_vub_arc) {
+        flow_rows_.push_back(i);
+        flow_row_signs_.push_back(sign);
+      }
+    }
+  }
+
+  settings.log.debug("Flow cover rows %d\n", num_flow_rows());
+}
+
+template <typename i_t, typename f_t>
+void flow_cover_generation_t<i_t, f_t>::generate_flow_cover_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<variable_type_t>& var_types,
+  const std::vector<f_t>& xstar,
+  std::vector<sparse_vector_t<i_t, f_t>>& cuts,
+  std::vector<f_t>& cut_rhs)
+{
+  cuts.clear();
+  cut_rhs.clear();
+  const f_t tol = 1e-6;
+
+  struct arc_t {
+    i_t flow_var;    // the flow is coeff * x_{flow_var}
+    i_t binary_var;  // -1 if the arc has no binary, y = 1
+    f_t coeff;
+    f_t capacity;
+    f_t binary_value;
+  };
+
+  const i_t max_cuts      = 1000;
+  const size_t work_limit = 100000000;
+  size_t work             = 0;
+  std::vector<arc_t> in_arcs;
+  std::vector<arc_t> out_arcs;
+  std::vector<f_t> cut_coeffs(lp.num_cols, 0.0);
+  std::vector<i_t> cut_vars;
+  for (i_t k = 0; k < num_flow_rows(); k++) {
+    if (static_cast<i_t>(cuts.size()) >= max_cuts || work > work_limit) { break; }
+    const i_t i     = flow_rows_[k];
+    const f_t sign  = flow_row_signs_[k];
+    const f_t b     = sign * lp.rhs[i];
+    bool valid_arcs = true;
+    in_arcs.clear();
+    out_arcs.clear();
+    for (i_t p = Arow.row_start[i]; p < Arow.row_start[i + 1]; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack_[j]) { continue; }
+      const f_t a_j = sign * Arow.x[p];
+      // The bounds may have been tightened since the rows were detected
+      if (lp.lower[j] != 0.0) {
+        valid_arcs = false;
+        break;
+      }
+      arc_t arc{j, -1, std::abs(a_j), std::abs(a_j) * lp.upper[j], 1.0};
+      if (var_types[j] == variable_type_t::INTEGER && lp.upper[j] == 1.0) {
+        arc.binary_var = j;
+      } else if (vub_var_[j] >= 0 && vub_coeff_[j] < lp.upper[j]) {
+        arc.binary_var = vub_var_[j];
+        arc.capacity   = std::abs(a_j) * vub_coeff_[j];
+      }
+      if (arc.binary_var >= 0) { arc.binary_value = xstar[arc.binary_var]; }
+      // Arcs of N+ without a capacity cannot be in a cover, and are left out of the cut
+      if (a_j < 0.0) {
+        out_arcs.push_back(arc);
+      } else if (arc.capacity < inf) {
+        in_arcs.push_back(arc);
+      }
+    }
+    work += Arow.row_start[i + 1] - Arow.row_start[i];
+    if (!valid_arcs) { continue; }
+
+    // The cover takes the arcs whose binaries are closest to one first, the larger capacities
+    // first among equal values, until the capacities exceed b
+    std::sort(in_arcs.begin(), in_arcs.end(), [](const arc_t& u, const arc_t& v) {
+      return u.binary_value > v.binary_value ||
+             (u.binary_value == v.binary_value && u.capacity > v.capacity);
+    });
+    work += in_arcs.size() * static_cast<size_t>(std::log2(in_arcs.size() + 1));
+    f_t cover_capacity = 0.0;
+    size_t cover_size  = 0;
+    while (cover_size < in_arcs.size() && cover_capacity <= b + tol) {
+      cover_capacity += in_arcs[cover_size++].capacity;
+    }
+    const f_t lambda = cover_capacity - b;
+    if (lambda <= tol) { continue; }
+
+    // Accumulate the cut in the <= form, arcs may share their variables
+    f_t rhs       = b;
+    auto add_term = [&](i_t j, f_t value) {
+      if (cut_coeffs[j] == 0.0) { cut_vars.push_back(j); }
+      cut_coeffs[j] += value;
+    };
+    for (size_t c = 0; c < cover_size; c++) {
+      const arc_t& arc = in_arcs[c];
+      add_term(arc.flow_var, arc.coeff);
+      const f_t excess = arc.capacity - lambda;
+      if (arc.binary_var >= 0 && excess > 0.0) {
+        add_term(arc.binary_var, -excess);
+        rhs -= excess;
+      }
+    }
+    for (const arc_t& arc : out_arcs) {
+      const f_t flow = arc.coeff * xstar[arc.flow_var];
+      if (arc.binary_var >= 0 && lambda * arc.binary_value < flow) {
+        add_term(arc.binary_var, -lambda);
+      } else {
+        add_term(arc.flow_var, -arc.coeff);
+      }
+    }
+
+    sparse_vector_t<i_t, f_t> cut(lp.num_cols, 0);
+    f_t activity = 0.0;
+    f_t norm     = 0.0;
+    for (i_t j : cut_vars) {
+      const f_t d_j = cut_coeffs[j];
+      cut_coeffs[j] = 0.0;
+      if (std::abs(d_j) < 1e-12) { continue; }
+      cut.i.push_back(j);
+      cut.x.push_back(-d_j);
+      activity += d_j * xstar[j];
+      norm += d_j * d_j;
+    }
+    work += 2 * cut_vars.size();
+    cut_vars.clear();
+    if (cut.i.empty() || activity - rhs <= tol * std::max(1.0, std::sqrt(norm))) { continue; }
+    cut.sort();
+    cuts.push_back(std::move(cut));
+    cut_rhs.push_back(-rhs);
+  }
+}
+
 template <typename i_t, typename f_t>
 void cut_generation_t<i_t, f_t>::generate_cuts(const lp_problem_t<i_t, f_t>& lp,
                                                const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -584,6 +1142,26 @@ void cut_generation_t<i_t, f_t>::generate_cuts(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
+  // Generate Clique cuts
+  if (settings.clique_cuts != 0 && clique_generation_.num_cliques() > 0) {
+    f_t cut_start_time = tic();
+    generate_clique_cuts(lp, settings, xstar);
+    f_t cut_generation_time = toc(cut_start_time);
+    if (cut_generation_time > 1.0) {
+      settings.log.debug("Clique cut generation time %.2f seconds\n", cut_generation_time);
+    }
+  }
+
+  // Generate Flow cover cuts
+  if (settings.flow_cover_cuts != 0 && flow_cover_generation_.num_flow_rows() > 0) {
+    f_t cut_start_time = tic();
+    generate_flow_cover_cuts(lp, settings, Arow, var_types, xstar);
+    f_t cut_generation_time = toc(cut_start_time);
+    if (cut_generation_time > 1.0) {
+      settings.log.debug("Flow cover cut generation time %.2f seconds\n", cut_generation_time);
+    }
+  }
+
   // Generate MIR and CG cuts
   if (settings.mir_cuts != 0 || settings.strong_chvatal_gomory_cuts != 0) {
     f_t cut_start_time = tic();
@@ -604,14 +1182,54 @@ void cut_generation_t<i_t, f_t>::generate_knapsack_cuts(
   const std::vector<variable_type_t>& var_types,
   const std::vector<f_t>& xstar)
 {
-  if (knapsack_generation_.num_knapsack_constraints() > 0) {
-    for (i_t knapsack_row : knapsack_generation_.get_knapsack_constraints()) {
-      sparse_vector_t<i_t, f_t> cut(lp.num_cols, 0);
-      f_t cut_rhs;
-      i_t knapsack_status = knapsack_generation_.generate_knapsack_cuts(
-        lp, settings, Arow, new_slacks, var_types, xstar, knapsack_row, cut, cut_rhs);
-      if (knapsack_status == 0) { cut_pool_.add_cut(cut_type_t::KNAPSACK, cut, cut_rhs); }
-    }
+  const std::vector<i_t>& knapsack_rows = knapsack_generation_.get_knapsack_constraints();
+  const i_t num_knapsack_rows           = knapsack_rows.size();
+  if (num_knapsack_rows == 0) { return; }
+
+  // The cover of each row is separated independently. The cuts are added to the pool afterwards in
+  // the order of the rows, so the pool does not depend on the number of threads
+  std::vector<sparse_vector_t<i_t, f_t>> cuts(num_knapsack_rows);
+  std::vector<f_t> cut_rhs(num_knapsack_rows);
+  std::vector<i_t> knapsack_status(num_knapsack_rows, -1);
+#pragma omp parallel for num_threads(settings.num_threads) schedule(dynamic, 16)
+  for (i_t k = 0; k < num_knapsack_rows; k++) {
+    cuts[k]            = sparse_vector_t<i_t, f_t>(lp.num_cols, 0);
+    knapsack_status[k] = knapsack_generation_.generate_knapsack_cuts(
+      lp, settings, Arow, new_slacks, var_types, xstar, knapsack_rows[k], cuts[k], cut_rhs[k]);
+  }
+  for (i_t k = 0; k < num_knapsack_rows; k++) {
+    if (knapsack_status[k] == 0) { cut_pool_.add_cut(cut_type_t::KNAPSACK, cuts[k], cut_rhs[k]); }
+  }
+}
+
+template <typename i_t, typename f_t>
+void cut_generation_t<i_t, f_t>::generate_clique_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  const std::vector<f_t>& xstar)
+{
+  std::vector<sparse_vector_t<i_t, f_t>> cuts;
+  std::vector<f_t> cut_rhs;
+  clique_generation_.generate_clique_cuts(lp, settings, xstar, cuts, cut_rhs);
+  for (size_t k = 0; k < cuts.size(); k++) {
+    cut_pool_.add_cut(cut_type_t::CLIQUE, cuts[k], cut_rhs[k]);
+  }
+}
+
+template <typename i_t, typename f_t>
+void cut_generation_t<i_t, f_t>::generate_flow_cover_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<variable_type_t>& var_types,
+  const std::vector<f_t>& xstar)
+{
+  std::vector<sparse_vector_t<i_t, f_t>> cuts;
+  std::vector<f_t> cut_rhs;
+  flow_cover_generation_.generate_flow_cover_cuts(
+    lp, settings, Arow, var_types, xstar, cuts, cut_rhs);
+  for (size_t k = 0; k < cuts.size(); k++) {
+    cut_pool_.add_cut(cut_type_t::FLOW_COVER, cuts[k], cut_rhs[k]);
   }
 }
 
@@ -640,6 +1258,7 @@ void cut_generation_t<i_t, f_t>::generate_mir_cuts(
 
   // Compute initial scores for all rows
   std::vector<f_t> score(lp.num_rows, 0.0);
+#pragma omp parallel for num_threads(settings.num_threads) schedule(static)
   for (i_t i = 0; i < lp.num_rows; i++) {
     const i_t row_start = Arow.row_start[i];
     const i_t row_end   = Arow.row_start[i + 1];
@@ -687,9 +1306,22 @@ void cut_generation_t<i_t, f_t>::generate_mir_cuts(
   std::vector<i_t> aggregated_rows;
   std::vector<i_t> aggregated_mark(lp.num_rows, 0);
 
+  // Rows aggregated into a cut have their score zeroed. Scores never increase, so rather than
+  // sorting all the rows again after each cut, the zeroed rows are skipped when they come up
+  std::vector<i_t> row_used(lp.num_rows, 0);
+
+  // The relaxation solution is transformed once, the bound substitutions do not depend on the row
+  std::vector<f_t> transformed_xstar;
+  mir.relaxation_to_nonnegative(lp, xstar, transformed_xstar);
+
   const i_t max_cuts = std::min(lp.num_rows, 1000);
-  f_t work_estimate  = 0.0;
+  f_t work_estimate  = transformed_xstar.size();
   for (i_t h = 0; h < max_cuts; h++) {
+    while (!sorted_indices.empty() && row_used[sorted_indices.back()]) {
+      sorted_indices.pop_back();
+    }
+    if (sorted_indices.empty()) { break; }
+
     // Get the row with the highest score
     const i_t i = sorted_indices.back();
     sorted_indices.pop_back();
@@ -757,11 +1389,6 @@ void cut_generation_t<i_t, f_t>::generate_mir_cuts(
     }
     // We should now have: inequality'*x >= inequality_rhs
 
-    // Transform the relaxation solution
-    std::vector<f_t> transformed_xstar;
-    mir.relaxation_to_nonnegative(lp, xstar, transformed_xstar);
-    work_estimate += transformed_xstar.size();
-
     sparse_vector_t<i_t, f_t> cut(lp.num_cols, 0);
     f_t cut_rhs;
     bool add_cut             = false;
@@ -944,7 +1571,8 @@ void cut_generation_t<i_t, f_t>::generate_mir_cuts(
 
       // Set the score of the aggregated rows to zero
       for (i_t row : aggregated_rows) {
-        score[row] = 0.0;
+        score[row]    = 0.0;
+        row_used[row] = 1;
       }
     }
 
@@ -958,30 +1586,20 @@ void cut_generation_t<i_t, f_t>::generate_mir_cuts(
 
     // Set the score of the current row to zero
     score[i] = 0.0;
-
-    // Re-sort the rows by score
-    // It's possible this could be made more efficient by storing the rows in a data structure
-    // that allows us to:
-    // 1. Get the row with the best score
-    // 2. Get the row with a nonzero in column j that has the best score
-    // 3. Remove the rows that have been aggregated
-    // 4. Remove the current row
-    best_score_last_permutation(score, sorted_indices);
-    work_estimate += score.size() * std::log2(score.size());
   }
 }
 
 template <typename i_t, typename f_t>
-void cut_generation_t<i_t, f_t>::generate_gomory_cuts(
-  const lp_problem_t<i_t, f_t>& lp,
-  const simplex_solver_settings_t<i_t, f_t>& settings,
-  csr_matrix_t<i_t, f_t>& Arow,
-  const std::vector<i_t>& new_slacks,
-  const std::vector<variable_type_t>& var_types,
-  basis_update_mpf_t<i_t, f_t>& basis_update,
-  const std::vector<f_t>& xstar,
-  const std::vector<i_t>& basic_list,
-  const std::vector<i_t>& nonbasic_list)
+void generate_gomory_cuts(cut_pool_t<i_t, f_t>& cut_pool,
+                          const lp_problem_t<i_t, f_t>& lp,
+                          const simplex_solver_settings_t<i_t, f_t>& settings,
+                          csr_matrix_t<i_t, f_t>& Arow,
+                          const std::vector<i_t>& new_slacks,
+                          const std::vector<variable_type_t>& var_types,
+                          basis_update_mpf_t<i_t, f_t>& basis_update,
+                          const std::vector<f_t>& xstar,
+                          const std::vector<i_t>& basic_list,
+                          const std::vector<i_t>& nonbasic_list)
 {
   tableau_equality_t<i_t, f_t> tableau(lp, basis_update, nonbasic_list);
   mixed_integer_rounding_cut_t<i_t, f_t> mir(lp, settings, new_slacks, xstar);
@@ -1021,7 +1639,7 @@ void cut_generation_t<i_t, f_t>::generate_gomory_cuts(
         f_t cg_cut_rhs;
         i_t cg_status = cg.generate_strong_cg_cut(
           lp, settings, var_types, cg_inequality, cg_inequality_rhs, xstar, cg_cut, cg_cut_rhs);
-        if (cg_status == 0) { cut_pool_.add_cut(cut_type_t::CHVATAL_GOMORY, cg_cut, cg_cut_rhs); }
+        if (cg_status == 0) { cut_pool.add_cut(cut_type_t::CHVATAL_GOMORY, cg_cut, cg_cut_rhs); }
       }
 
       if (settings.mixed_integer_gomory_cuts == 0) { continue; }
@@ -1075,14 +1693,38 @@ void cut_generation_t<i_t, f_t>::generate_gomory_cuts(
       }
 
       if ((cut_A_distance > cut_B_distance) && A_valid) {
-        cut_pool_.add_cut(cut_type_t::MIXED_INTEGER_GOMORY, cut_A, cut_A_rhs);
+        cut_pool.add_cut(cut_type_t::MIXED_INTEGER_GOMORY, cut_A, cut_A_rhs);
       } else if (B_valid) {
-        cut_pool_.add_cut(cut_type_t::MIXED_INTEGER_GOMORY, cut_B, cut_B_rhs);
+        cut_pool.add_cut(cut_type_t::MIXED_INTEGER_GOMORY, cut_B, cut_B_rhs);
       }
     }
   }
 }
 
+template <typename i_t, typename f_t>
+void cut_generation_t<i_t, f_t>::generate_gomory_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<i_t>& new_slacks,
+  const std::vector<variable_type_t>& var_types,
+  basis_update_mpf_t<i_t, f_t>& basis_update,
+  const std::vector<f_t>& xstar,
+  const std::vector<i_t>& basic_list,
+  const std::vector<i_t>& nonbasic_list)
+{
+  dual_simplex::generate_gomory_cuts(cut_pool_,
+                                     lp,
+                                     settings,
+                                     Arow,
+                                     new_slacks,
+                                     var_types,
+                                     basis_update,
+                                     xstar,
+                                     basic_list,
+                                     nonbasic_list);
+}
+
 template <typename i_t, typename f_t>
 i_t tableau_equality_t<i_t, f_t>::generate_base_equality(
   const lp_problem_t<i_t, f_t>& lp,
@@ -2314,7 +2956,8 @@ i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
              std::vector<i_t>& basic_list,
              std::vector<i_t>& nonbasic_list,
              std::vector<variable_status_t>& vstatus,
-             std::vector<f_t>& edge_norms)
+             std::vector<f_t>& edge_norms,
+             csr_matrix_t<i_t, f_t>* Arow)
 
 {
   // Given a set of cuts: C*x <= d that are currently violated
@@ -2344,8 +2987,10 @@ i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
   settings.log.debug("Original lp rows %d\n", lp.num_rows);
   settings.log.debug("Original lp cols %d\n", lp.num_cols);
 
-  csr_matrix_t<i_t, f_t> new_A_row(lp.num_rows, lp.num_cols, 1);
-  lp.A.to_compressed_row(new_A_row);
+  csr_matrix_t<i_t, f_t> local_A_row(0, 0, 0);
+  if (Arow == nullptr) { lp.A.to_compressed_row(local_A_row, settings.num_threads); }
+  csr_matrix_t<i_t, f_t>& new_A_row = Arow != nullptr ? *Arow : local_A_row;
+  assert(new_A_row.m == lp.num_rows && new_A_row.n == lp.num_cols);
 
   i_t append_status = new_A_row.append_rows(cuts);
   if (append_status != 0) {
@@ -2354,7 +2999,7 @@ i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
   }
 
   csc_matrix_t<i_t, f_t> new_A_col(lp.num_rows + p, lp.num_cols, 1);
-  new_A_row.to_compressed_col(new_A_col);
+  new_A_row.to_compressed_col(new_A_col, settings.num_threads);
 
   // Add in slacks variables for the new rows
   lp.lower.resize(lp.num_cols + p);
@@ -2383,6 +3028,28 @@ i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
 
   lp.A = new_A_col;
 
+  if (Arow != nullptr) {
+    // The slack of a cut is its last column, so it goes at the end of the row. Shift the cut rows
+    // from the last one to make room for one entry per row.
+    const i_t old_nz = new_A_row.row_start[lp.num_rows + p];
+    new_A_row.j.resize(old_nz + p);
+    new_A_row.x.resize(old_nz + p);
+    for (i_t h = p - 1; h >= 0; h--) {
+      const i_t i              = lp.num_rows + h;
+      const i_t row_start      = new_A_row.row_start[i];
+      const i_t row_end        = new_A_row.row_start[i + 1];
+      new_A_row.j[row_end + h] = lp.num_cols + h;
+      new_A_row.x[row_end + h] = 1.0;
+      for (i_t q = row_end - 1; q >= row_start; q--) {
+        new_A_row.j[q + h] = new_A_row.j[q];
+        new_A_row.x[q + h] = new_A_row.x[q];
+      }
+      new_A_row.row_start[i + 1] = row_end + h + 1;
+    }
+    new_A_row.n      = lp.num_cols + p;
+    new_A_row.nz_max = old_nz + p;
+  }
+
   // Check that all slack columns have length 1
   for (i_t slack : new_slacks) {
     const i_t col_start = lp.A.col_start[slack];
@@ -2580,7 +3247,7 @@ i_t remove_cuts(lp_problem_t<i_t, f_t>& lp,
     csr_matrix_t<i_t, f_t> new_Arow(1, 1, 0);
     Arow.remove_rows(marked_rows, new_Arow);
     Arow = new_Arow;
-    Arow.to_compressed_col(lp.A);
+    Arow.to_compressed_col(lp.A, settings.num_threads);
 
     std::vector<f_t> new_objective(lp.num_cols - slacks_to_remove.size());
     std::vector<f_t> new_lower(lp.num_cols - slacks_to_remove.size());
@@ -2616,7 +3283,7 @@ i_t remove_cuts(lp_problem_t<i_t, f_t>& lp,
       }
     }
     lp.A.remove_columns(marked_cols);
-    lp.A.to_compressed_row(Arow);
+    lp.A.to_compressed_row(Arow, settings.num_threads);
     lp.objective = new_objective;
     lp.lower     = new_lower;
     lp.upper     = new_upper;
@@ -2783,9 +3450,23 @@ void verify_cuts_against_saved_solution(const csr_matrix_t<i_t, f_t>& cuts,
 template class cut_pool_t<int, double>;
 template class cut_generation_t<int, double>;
 template class knapsack_generation_t<int, double>;
+template class clique_generation_t<int, double>;
+template class flow_cover_generation_t<int, double>;
 template class tableau_equality_t<int, double>;
 template class mixed_integer_rounding_cut_t<int, double>;
 
+template void generate_gomory_cuts<int, double>(
+  cut_pool_t<int, double>& cut_pool,
+  const lp_problem_t<int, double>& lp,
+  const simplex_solver_settings_t<int, double>& settings,
+  csr_matrix_t<int, double>& Arow,
+  const std::vector<int>& new_slacks,
+  const std::vector<variable_type_t>& var_types,
+  basis_update_mpf_t<int, double>& basis_update,
+  const std::vector<double>& xstar,
+  const std::vector<int>& basic_list,
+  const std::vector<int>& nonbasic_list);
+
 template int add_cuts(const simplex_solver_settings_t<int, double>& settings,
                       const csr_matrix_t<int, double>& cuts,
                       const std::vector<double>& cut_rhs,
@@ -2796,7 +3477,8 @@ template int add_cuts(const simplex_solver_settings_t<int, double>& settings,
                       std::vector<int>& basic_list,
                       std::vector<int>& nonbasic_list,
                       std::vector<variable_status_t>& vstatus,
-                      std::vector<double>& edge_norms);
+                      std::vector<double>& edge_norms,
+                      csr_matrix_t<int, double>* Arow);
 
 template int remove_cuts<int, double>(lp_problem_t<int, double>& lp,
                                       const simplex_solver_settings_t<int, double>& settings,
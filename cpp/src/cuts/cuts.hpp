@@ -17,6 +17,8 @@
 #include <array>
 #include <numeric>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <cmath>
@@ -29,7 +31,9 @@ enum cut_type_t : int8_t {
   MIXED_INTEGER_ROUNDING = 1,
   KNAPSACK               = 2,
   CHVATAL_GOMORY         = 3,
-  MAX_CUT_TYPE           = 4
+  CLIQUE                 = 4,
+  FLOW_COVER             = 5,
+  MAX_CUT_TYPE           = 6
 };
 
 template <typename i_t, typename f_t>
@@ -48,7 +52,8 @@ struct cut_info_t {
       num_cuts[static_cast<int>(cut_type)]++;
     }
   }
-  const char* cut_type_names[MAX_CUT_TYPE] = {"Gomory   ", "MIR      ", "Knapsack ", "Strong CG"};
+  const char* cut_type_names[MAX_CUT_TYPE] = {
+    "Gomory   ", "MIR      ", "Knapsack ", "Strong CG", "Clique   ", "FlowCover"};
   std::array<i_t, MAX_CUT_TYPE> num_cuts   = {0};
 };
 
@@ -136,9 +141,13 @@ class cut_pool_t {
   // Add a cut in the form: cut'*x >= rhs.
   // We expect that the cut is violated by the current relaxation xstar
   // cut'*xstart < rhs
+  // A cut with the same normalized coefficients as a cut in the pool is not added, only the
+  // stronger right-hand side of the two is kept
   void add_cut(cut_type_t cut_type, const sparse_vector_t<i_t, f_t>& cut, f_t rhs);
 
-  void score_cuts(std::vector<f_t>& x_relax);
+  // Scores the cuts of the pool by their efficacy at x_relax and their parallelism with the
+  // objective, then selects at most max_cuts of them that are nearly orthogonal to each other
+  void score_cuts(std::vector<f_t>& x_relax, const std::vector<f_t>& objective, i_t max_cuts);
 
   // We return the cuts in the form best_cuts*x <= best_rhs
   i_t get_best_cuts(csr_matrix_t<i_t, f_t>& best_cuts,
@@ -156,7 +165,10 @@ class cut_pool_t {
  private:
   f_t cut_distance(i_t row, const std::vector<f_t>& x, f_t& cut_violation, f_t& cut_norm);
   f_t cut_density(i_t row);
-  f_t cut_orthogonality(i_t i, i_t j);
+
+  // Quantized coefficients of the cut scaled so the largest has magnitude one, interleaved with
+  // their indices. Returns the scale
+  f_t normalized_key(const sparse_vector_t<i_t, f_t>& cut, std::vector<int64_t>& key) const;
 
   i_t original_vars_;
   const simplex_solver_settings_t<i_t, f_t>& settings_;
@@ -166,10 +178,18 @@ class cut_pool_t {
   std::vector<i_t> cut_age_;
   std::vector<cut_type_t> cut_type_;
 
+  // Rows of the pool by the hash of their normalized key
+  std::unordered_map<uint32_t, std::vector<i_t>> cut_hash_rows_;
+
+  // The cuts accepted by score_cuts, by column, as (position in best_cuts_, coefficient). Only
+  // the accepted cuts sharing a column with a candidate are visited for its orthogonality
+  std::vector<std::vector<std::pair<i_t, f_t>>> accepted_columns_;
+
   i_t scored_cuts_;
   std::vector<f_t> cut_distances_;
   std::vector<f_t> cut_norms_;
   std::vector<f_t> cut_orthogonality_;
+  std::vector<f_t> cut_objective_parallelism_;
   std::vector<f_t> cut_scores_;
   std::vector<i_t> best_cuts_;
 };
@@ -214,6 +234,96 @@ class knapsack_generation_t {
   const simplex_solver_settings_t<i_t, f_t>& settings_;
 };
 
+// Conflict graph of the binary variables, stored as the cliques it is made of: two variables
+// conflict, i.e. cannot both be one, when they share a clique. The cliques come from the rows
+// sum_j a_j x_j <= b over binaries with a_j > 0, where every pair with a_i + a_j > b conflicts.
+// This covers the set packing and set partitioning rows, sum_j x_j <= 1, as a whole
+template <typename i_t, typename f_t>
+class clique_generation_t {
+ public:
+  clique_generation_t(const lp_problem_t<i_t, f_t>& lp,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      csr_matrix_t<i_t, f_t>& Arow,
+                      const std::vector<i_t>& new_slacks,
+                      const std::vector<variable_type_t>& var_types);
+
+  // Grows cliques of the conflict graph greedily from the fractional variables of xstar. A clique
+  // with sum_{j in C} xstar_j > 1 is lifted with the variables at zero that conflict with all of
+  // its members and returned as the cut -sum_{j in C} x_j >= -1
+  void generate_clique_cuts(const lp_problem_t<i_t, f_t>& lp,
+                            const simplex_solver_settings_t<i_t, f_t>& settings,
+                            const std::vector<f_t>& xstar,
+                            std::vector<sparse_vector_t<i_t, f_t>>& cuts,
+                            std::vector<f_t>& cut_rhs);
+
+  i_t num_cliques() const { return clique_start_.size() - 1; }
+
+ private:
+  // Marks the variables that conflict with j, and j itself. Returns the work done
+  size_t mark_neighbors(i_t j);
+
+  // Adds the candidates in order, each one only if it conflicts with all the previous members.
+  // Returns the work done
+  size_t grow_clique(std::vector<i_t>& candidates, std::vector<i_t>& clique);
+
+  // Cliques in compressed form: the members of clique c are
+  // clique_vars_[clique_start_[c], clique_start_[c + 1])
+  std::vector<i_t> clique_start_;
+  std::vector<i_t> clique_vars_;
+
+  // The cliques of variable j are var_cliques_[var_clique_start_[j], var_clique_start_[j + 1])
+  std::vector<i_t> var_clique_start_;
+  std::vector<i_t> var_cliques_;
+
+  std::vector<i_t> mark_;
+  i_t mark_stamp_{0};
+};
+
+// Flow cover cuts of the rows that are single node flow sets [1]. After the slack is dropped, such
+// a row reads sum_{j in N+} f_j - sum_{j in N-} f_j <= b, with nonnegative flows f_j = |a_j| x_j.
+// The flow of an arc is bounded by u_j y_j with y_j binary, either from a variable upper bound
+// row x_j <= v_j y_j or because x_j is itself binary. Arcs with a plain upper bound have y_j = 1.
+// The variable upper bound rows are detected once, on the rows of the root LP
+//
+// [1] T. J. Van Roy and L. A. Wolsey, "Valid inequalities for mixed 0-1 programs," Discrete
+// Applied Mathematics, 14(2):199-213, 1986.
+template <typename i_t, typename f_t>
+class flow_cover_generation_t {
+ public:
+  flow_cover_generation_t(const lp_problem_t<i_t, f_t>& lp,
+                          const simplex_solver_settings_t<i_t, f_t>& settings,
+                          csr_matrix_t<i_t, f_t>& Arow,
+                          const std::vector<i_t>& new_slacks,
+                          const std::vector<variable_type_t>& var_types);
+
+  // For each flow row, a cover C+ of N+ with capacity sum_{j in C+} u_j = b + lambda, lambda > 0,
+  // is chosen greedily by the values of the binaries in xstar. It gives the cut
+  // sum_{j in C+} f_j + (u_j - lambda)^+ (1 - y_j) <= b + lambda sum_{j in L-} y_j
+  //                                                    + sum_{j in N- \ L-} f_j,
+  // where L- holds the arcs of N- with lambda y_j < f_j at xstar. The cuts are returned in the
+  // form cut'*x >= rhs
+  void generate_flow_cover_cuts(const lp_problem_t<i_t, f_t>& lp,
+                                const simplex_solver_settings_t<i_t, f_t>& settings,
+                                csr_matrix_t<i_t, f_t>& Arow,
+                                const std::vector<variable_type_t>& var_types,
+                                const std::vector<f_t>& xstar,
+                                std::vector<sparse_vector_t<i_t, f_t>>& cuts,
+                                std::vector<f_t>& cut_rhs);
+
+  i_t num_flow_rows() const { return flow_rows_.size(); }
+
+ private:
+  // Flow rows, as the row and the sign that turns it into a <= row
+  std::vector<i_t> flow_rows_;
+  std::vector<f_t> flow_row_signs_;
+
+  // Variable upper bound x_j <= vub_coeff_[j] * x_{vub_var_[j]}, vub_var_[j] = -1 if none
+  std::vector<i_t> vub_var_;
+  std::vector<f_t> vub_coeff_;
+
+  std::vector<i_t> is_slack_;
+};
+
 // Forward declaration
 template <typename i_t, typename f_t>
 class mixed_integer_rounding_cut_t;
@@ -227,7 +337,10 @@ class cut_generation_t {
                    csr_matrix_t<i_t, f_t>& Arow,
                    const std::vector<i_t>& new_slacks,
                    const std::vector<variable_type_t>& var_types)
-    : cut_pool_(cut_pool), knapsack_generation_(lp, settings, Arow, new_slacks, var_types)
+    : cut_pool_(cut_pool),
+      knapsack_generation_(lp, settings, Arow, new_slacks, var_types),
+      clique_generation_(lp, settings, Arow, new_slacks, var_types),
+      flow_cover_generation_(lp, settings, Arow, new_slacks, var_types)
   {
   }
 
@@ -269,8 +382,22 @@ class cut_generation_t {
                               const std::vector<variable_type_t>& var_types,
                               const std::vector<f_t>& xstar);
 
+  // Generate all clique cuts
+  void generate_clique_cuts(const lp_problem_t<i_t, f_t>& lp,
+                            const simplex_solver_settings_t<i_t, f_t>& settings,
+                            const std::vector<f_t>& xstar);
+
+  // Generate all flow cover cuts
+  void generate_flow_cover_cuts(const lp_problem_t<i_t, f_t>& lp,
+                                const simplex_solver_settings_t<i_t, f_t>& settings,
+                                csr_matrix_t<i_t, f_t>& Arow,
+                                const std::vector<variable_type_t>& var_types,
+                                const std::vector<f_t>& xstar);
+
   cut_pool_t<i_t, f_t>& cut_pool_;
   knapsack_generation_t<i_t, f_t> knapsack_generation_;
+  clique_generation_t<i_t, f_t> clique_generation_;
+  flow_cover_generation_t<i_t, f_t> flow_cover_generation_;
 };
 
 template <typename i_t, typename f_t>
@@ -447,6 +574,24 @@ class strong_cg_cut_t {
   std::vector<i_t> transformed_variables_;
 };
 
+// Adds the mixed integer Gomory and strong Chvatal-Gomory cuts of the fractional rows of the
+// optimal tableau to cut_pool. The cuts depend on the bounds of lp, so they are only valid where
+// those bounds hold: in the subtree of the node when called on a node LP
+template <typename i_t, typename f_t>
+void generate_gomory_cuts(cut_pool_t<i_t, f_t>& cut_pool,
+                          const lp_problem_t<i_t, f_t>& lp,
+                          const simplex_solver_settings_t<i_t, f_t>& settings,
+                          csr_matrix_t<i_t, f_t>& Arow,
+                          const std::vector<i_t>& new_slacks,
+                          const std::vector<variable_type_t>& var_types,
+                          basis_update_mpf_t<i_t, f_t>& basis_update,
+                          const std::vector<f_t>& xstar,
+                          const std::vector<i_t>& basic_list,
+                          const std::vector<i_t>& nonbasic_list);
+
+// Adds the rows cuts * x <= cut_rhs to lp with a slack each and extends the basis with the slacks.
+// When Arow is given it holds the rows of lp.A, which saves transposing lp.A, and it is kept up to
+// date with the cut rows and their slacks.
 template <typename i_t, typename f_t>
 i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
              const csr_matrix_t<i_t, f_t>& cuts,
@@ -458,7 +603,8 @@ i_t add_cuts(const simplex_solver_settings_t<i_t, f_t>& settings,
              std::vector<i_t>& basic_list,
              std::vector<i_t>& nonbasic_list,
              std::vector<variable_status_t>& vstatus,
-             std::vector<f_t>& edge_norms);
+             std::vector<f_t>& edge_norms,
+             csr_matrix_t<i_t, f_t>* Arow = nullptr);
 
 template <typename i_t, typename f_t>
 i_t remove_cuts(lp_problem_t<i_t, f_t>& lp,
@@ -11,6 +11,8 @@
 #include <dual_simplex/triangle_solve.hpp>
 #include <raft/core/nvtx.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <limits>
 
@@ -1353,51 +1355,53 @@ i_t basis_update_mpf_t<i_t, f_t>::append_cuts(const csr_matrix_t<i_t, f_t>& cuts
 
 template <typename i_t, typename f_t>
 void basis_update_mpf_t<i_t, f_t>::gather_into_sparse_vector(i_t nz,
-                                                             sparse_vector_t<i_t, f_t>& out) const
+                                                             sparse_vector_t<i_t, f_t>& out,
+                                                             solve_workspace_t ws) const
 {
   const i_t m = L0_.m;
   out.i.clear();
   out.x.clear();
   out.i.reserve(nz);
   out.x.reserve(nz);
-  work_estimate_ += 2 * nz;
+  ws.work_estimate += 2 * nz;
   const f_t zero_tol = 1e-13;
   for (i_t k = 0; k < nz; ++k) {
-    const i_t i = xi_workspace_[m + k];
-    if (std::abs(x_workspace_[i]) > zero_tol) {
+    const i_t i = ws.xi[m + k];
+    if (std::abs(ws.x[i]) > zero_tol) {
       out.i.push_back(i);
-      out.x.push_back(x_workspace_[i]);
+      out.x.push_back(ws.x[i]);
     }
-    xi_workspace_[m + k] = 0;
-    xi_workspace_[i]     = 0;
-    x_workspace_[i]      = 0.0;
+    ws.xi[m + k] = 0;
+    ws.xi[i]     = 0;
+    ws.x[i]      = 0.0;
   }
-  work_estimate_ += 5 * nz;
-  work_estimate_ += 3 * out.i.size();
+  ws.work_estimate += 5 * nz;
+  ws.work_estimate += 3 * out.i.size();
 }
 
 template <typename i_t, typename f_t>
-void basis_update_mpf_t<i_t, f_t>::solve_to_workspace(i_t top) const
+void basis_update_mpf_t<i_t, f_t>::solve_to_workspace(i_t top, solve_workspace_t ws) const
 {
   const i_t m = L0_.m;
   i_t nz      = 0;
   for (i_t p = top; p < m; ++p) {
-    const i_t i           = xi_workspace_[p];
-    xi_workspace_[m + nz] = i;
-    xi_workspace_[p]      = 0;
+    const i_t i   = ws.xi[p];
+    ws.xi[m + nz] = i;
+    ws.xi[p]      = 0;
     nz++;
   }
-  work_estimate_ += 3 * (m - top);
+  ws.work_estimate += 3 * (m - top);
   for (i_t k = 0; k < nz; ++k) {
-    const i_t i      = xi_workspace_[m + k];
-    xi_workspace_[i] = 1;
+    const i_t i = ws.xi[m + k];
+    ws.xi[i]    = 1;
   }
-  work_estimate_ += 2 * nz;
+  ws.work_estimate += 2 * nz;
 }
 
 template <typename i_t, typename f_t>
 void basis_update_mpf_t<i_t, f_t>::solve_to_sparse_vector(i_t top,
-                                                          sparse_vector_t<i_t, f_t>& out) const
+                                                          sparse_vector_t<i_t, f_t>& out,
+                                                          solve_workspace_t ws) const
 {
   const i_t m  = L0_.m;
   out.n        = m;
@@ -1406,20 +1410,20 @@ void basis_update_mpf_t<i_t, f_t>::solve_to_sparse_vector(i_t top,
   out.i.clear();
   out.x.reserve(nz);
   out.i.reserve(nz);
-  work_estimate_ += 2 * nz;
+  ws.work_estimate += 2 * nz;
   i_t k              = 0;
   const f_t zero_tol = 1e-13;
   for (i_t p = top; p < m; ++p) {
-    const i_t i = xi_workspace_[p];
-    if (std::abs(x_workspace_[i]) > zero_tol) {
+    const i_t i = ws.xi[p];
+    if (std::abs(ws.x[i]) > zero_tol) {
       out.i.push_back(i);
-      out.x.push_back(x_workspace_[i]);
+      out.x.push_back(ws.x[i]);
     }
-    x_workspace_[i]  = 0.0;
-    xi_workspace_[p] = 0;
+    ws.x[i]  = 0.0;
+    ws.xi[p] = 0;
     k++;
   }
-  work_estimate_ += 4 * k + 3 * out.i.size();
+  ws.work_estimate += 4 * k + 3 * out.i.size();
 }
 
 template <typename i_t, typename f_t>
@@ -1477,7 +1481,9 @@ i_t basis_update_mpf_t<i_t, f_t>::nonzeros(const std::vector<f_t>& x) const
 
 // dot = S(:, col)' * x
 template <typename i_t, typename f_t>
-f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col, const std::vector<f_t>& x) const
+f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col,
+                                              const std::vector<f_t>& x,
+                                              f_t& work_estimate) const
 {
   f_t dot             = 0.0;
   const i_t col_start = S_.col_start[col];
@@ -1486,7 +1492,7 @@ f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col, const std::vector<f_t>& x
     const i_t i = S_.i[p];
     dot += S_.x[p] * x[i];
   }
-  work_estimate_ += 3 * (col_end - col_start);
+  work_estimate += 3 * (col_end - col_start);
   return dot;
 }
 
@@ -1494,7 +1500,8 @@ f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col, const std::vector<f_t>& x
 template <typename i_t, typename f_t>
 f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col,
                                               const std::vector<i_t>& mark,
-                                              const std::vector<f_t>& x) const
+                                              const std::vector<f_t>& x,
+                                              f_t& work_estimate) const
 {
   f_t dot             = 0.0;
   const i_t col_start = S_.col_start[col];
@@ -1507,7 +1514,7 @@ f_t basis_update_mpf_t<i_t, f_t>::dot_product(i_t col,
       nz_mark++;
     }
   }
-  work_estimate_ += 2 * nz_mark + (col_end - col_start);
+  work_estimate += 2 * nz_mark + (col_end - col_start);
   return dot;
 }
 
@@ -1516,7 +1523,8 @@ template <typename i_t, typename f_t>
 void basis_update_mpf_t<i_t, f_t>::add_sparse_column(const csc_matrix_t<i_t, f_t>& S,
                                                      i_t col,
                                                      f_t theta,
-                                                     std::vector<f_t>& x) const
+                                                     std::vector<f_t>& x,
+                                                     f_t& work_estimate) const
 {
   const i_t col_start = S.col_start[col];
   const i_t col_end   = S.col_start[col + 1];
@@ -1524,7 +1532,7 @@ void basis_update_mpf_t<i_t, f_t>::add_sparse_column(const csc_matrix_t<i_t, f_t
     const i_t i = S.i[p];
     x[i] += theta * S.x[p];
   }
-  work_estimate_ += 3 * (col_end - col_start);
+  work_estimate += 3 * (col_end - col_start);
 }
 
 template <typename i_t, typename f_t>
@@ -1533,7 +1541,8 @@ void basis_update_mpf_t<i_t, f_t>::add_sparse_column(const csc_matrix_t<i_t, f_t
                                                      f_t theta,
                                                      std::vector<i_t>& mark,
                                                      i_t& nz,
-                                                     std::vector<f_t>& x) const
+                                                     std::vector<f_t>& x,
+                                                     f_t& work_estimate) const
 {
   const i_t m         = L0_.m;
   const i_t col_start = S.col_start[col];
@@ -1549,7 +1558,7 @@ void basis_update_mpf_t<i_t, f_t>::add_sparse_column(const csc_matrix_t<i_t, f_t
     }
     x[i] += theta * S.x[p];
   }
-  work_estimate_ += 4 * (col_end - col_start) + 2 * (nz - nz_start);
+  work_estimate += 4 * (col_end - col_start) + 2 * (nz - nz_start);
 }
 
 template <typename i_t, typename f_t>
@@ -1683,7 +1692,12 @@ template <typename i_t, typename f_t>
 i_t basis_update_mpf_t<i_t, f_t>::u_transpose_solve(std::vector<f_t>& rhs) const
 {
   total_dense_U_transpose_++;
-  dual_simplex::upper_triangular_transpose_solve(U0_, rhs, work_estimate_);
+  if (use_levels(u_transpose_solve_levels_)) {
+    dual_simplex::level_scheduled_transpose_solve(
+      U0_, u_transpose_solve_levels_, rhs, solve_threads_, work_estimate_);
+  } else {
+    dual_simplex::upper_triangular_transpose_solve(U0_, rhs, work_estimate_);
+  }
   return 0;
 }
 
@@ -1727,7 +1741,12 @@ i_t basis_update_mpf_t<i_t, f_t>::l_transpose_solve(std::vector<f_t>& rhs) const
   work_estimate_ += 2 * num_updates_;
 
   // Solve for x such that L0^T * x = b'
-  dual_simplex::lower_triangular_transpose_solve(L0_, rhs, work_estimate_);
+  if (use_levels(l_transpose_solve_levels_)) {
+    dual_simplex::level_scheduled_transpose_solve(
+      L0_, l_transpose_solve_levels_, rhs, solve_threads_, work_estimate_);
+  } else {
+    dual_simplex::lower_triangular_transpose_solve(L0_, rhs, work_estimate_);
+  }
 
   return 0;
 }
@@ -1984,14 +2003,136 @@ i_t basis_update_mpf_t<i_t, f_t>::b_solve(const sparse_vector_t<i_t, f_t>& rhs,
   return 0;
 }
 
+template <typename i_t, typename f_t>
+i_t basis_update_mpf_t<i_t, f_t>::b_solve_batch(
+  const std::vector<const sparse_vector_t<i_t, f_t>*>& rhs,
+  const std::vector<sparse_vector_t<i_t, f_t>*>& solution,
+  const std::vector<sparse_vector_t<i_t, f_t>*>& Lsol,
+  i_t num_threads) const
+{
+  const i_t m          = L0_.m;
+  const i_t batch_size = rhs.size();
+  assert(solution.size() == rhs.size());
+  assert(Lsol.size() == rhs.size());
+
+  // Below this size a solve is too cheap to be worth a parallel region
+  constexpr i_t parallel_batch_rows = 10000;
+  if (num_threads <= 1 || batch_size < 2 || m < parallel_batch_rows) {
+    for (i_t k = 0; k < batch_size; ++k) {
+      if (Lsol[k] != nullptr) {
+        b_solve(*rhs[k], *solution[k], *Lsol[k]);
+      } else {
+        b_solve(*rhs[k], *solution[k]);
+      }
+    }
+    return 0;
+  }
+
+  batch_xi_workspaces_.resize(batch_size);
+  batch_x_workspaces_.resize(batch_size);
+  batch_marked_workspaces_.resize(batch_size);
+  std::vector<f_t> work(batch_size, 0.0);
+  std::vector<char> hypersparse_L(batch_size);
+  std::vector<char> hypersparse_U(batch_size);
+  std::vector<f_t> growth_L(batch_size);
+  std::vector<f_t> growth_U(batch_size);
+
+#pragma omp parallel for num_threads(std::min(num_threads, batch_size)) schedule(static, 1)
+  for (i_t k = 0; k < batch_size; ++k) {
+    std::vector<i_t>& xi      = batch_xi_workspaces_[k];
+    std::vector<f_t>& x       = batch_x_workspaces_[k];
+    std::vector<char>& marked = batch_marked_workspaces_[k];
+    if (static_cast<i_t>(x.size()) != m) {
+      xi.assign(2 * m, 0);
+      x.assign(m, 0.0);
+      marked.assign(m, 0);
+    }
+    // The shared L0_ and U0_ are only read: hypersparse reaches mark the private array
+    solve_workspace_t ws{xi, x, work[k], &marked};
+
+    sparse_vector_t<i_t, f_t>& sol = *solution[k];
+    const f_t input_size           = static_cast<f_t>(rhs[k]->i.size());
+    sol                            = *rhs[k];
+    sol.inverse_permute_vector(inverse_row_permutation_);
+    ws.work_estimate += 5 * input_size;
+
+    // Predict the density as the k-th of a sequence of solves, from the statistics gathered
+    // before the batch
+    bool use_hypersparse;
+    i_t num_calls = num_calls_L_ + k;
+    estimate_solution_density(input_size, sum_L_, num_calls, use_hypersparse);
+    hypersparse_L[k] = use_hypersparse;
+    if (use_hypersparse) {
+      l_solve(sol, ws);
+    } else {
+      std::vector<f_t> solution_dense;
+      sol.to_dense(solution_dense);
+      l_solve(solution_dense, ws);
+      sol.from_dense(solution_dense);
+      ws.work_estimate += 2 * solution_dense.size();
+    }
+    if (Lsol[k] != nullptr) {
+      *Lsol[k] = sol;
+      ws.work_estimate += 2 * sol.i.size();
+    }
+    growth_L[k] = static_cast<f_t>(sol.i.size()) / input_size;
+
+    const f_t rhs_size = static_cast<f_t>(sol.i.size());
+    num_calls          = num_calls_U_ + k;
+    estimate_solution_density(rhs_size, sum_U_, num_calls, use_hypersparse);
+    hypersparse_U[k] = use_hypersparse;
+    if (use_hypersparse) {
+      u_solve(sol, ws);
+    } else {
+      std::vector<f_t> solution_dense;
+      sol.to_dense(solution_dense);
+      u_solve(solution_dense, ws);
+      sol.from_dense(solution_dense);
+      ws.work_estimate += 2 * solution_dense.size();
+    }
+    growth_U[k] = static_cast<f_t>(sol.i.size()) / rhs_size;
+  }
+
+  // Fold the statistics and work back in batch order
+  for (i_t k = 0; k < batch_size; ++k) {
+    num_calls_L_++;
+    num_calls_U_++;
+    sum_L_ += growth_L[k];
+    sum_U_ += growth_U[k];
+    if (hypersparse_L[k]) {
+      total_sparse_L_++;
+    } else {
+      total_dense_L_++;
+    }
+    if (hypersparse_U[k]) {
+      total_sparse_U_++;
+    } else {
+      total_dense_U_++;
+    }
+    work_estimate_ += work[k];
+  }
+  return 0;
+}
+
 // Solve for x such that U*x = y
 template <typename i_t, typename f_t>
 i_t basis_update_mpf_t<i_t, f_t>::u_solve(std::vector<f_t>& rhs) const
 {
   total_dense_U_++;
-  const i_t m = L0_.m;
+  return u_solve(rhs, workspace());
+}
+
+template <typename i_t, typename f_t>
+i_t basis_update_mpf_t<i_t, f_t>::u_solve(std::vector<f_t>& rhs, solve_workspace_t ws) const
+{
   // U*x = y
-  dual_simplex::upper_triangular_solve(U0_, rhs, work_estimate_);
+  if (use_levels(u_solve_levels_)) {
+    // U = (U0')', solved through the rows of U
+    dual_simplex::level_scheduled_transpose_solve(
+      U0_transpose_, u_solve_levels_, rhs, solve_threads_, ws.work_estimate);
+  } else {
+    dual_simplex::upper_triangular_solve(U0_, rhs, ws.work_estimate);
+  }
   return 0;
 }
 
@@ -1999,13 +2140,22 @@ template <typename i_t, typename f_t>
 i_t basis_update_mpf_t<i_t, f_t>::u_solve(sparse_vector_t<i_t, f_t>& rhs) const
 {
   total_sparse_U_++;
-  const i_t m = L0_.m;
+  return u_solve(rhs, workspace());
+}
+
+template <typename i_t, typename f_t>
+i_t basis_update_mpf_t<i_t, f_t>::u_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                          solve_workspace_t ws) const
+{
   // U*x = y
 
   // Solve U0*x = y
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
-    rhs, std::nullopt, xi_workspace_, U0_, x_workspace_.data(), work_estimate_);
-  solve_to_sparse_vector(top, rhs);
+  i_t top = ws.marked != nullptr
+              ? dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
+                  rhs, std::nullopt, ws.xi, U0_, *ws.marked, ws.x.data(), ws.work_estimate)
+              : dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
+                  rhs, std::nullopt, ws.xi, U0_, ws.x.data(), ws.work_estimate);
+  solve_to_sparse_vector(top, rhs, ws);
 
   return 0;
 }
@@ -2014,6 +2164,12 @@ template <typename i_t, typename f_t>
 i_t basis_update_mpf_t<i_t, f_t>::l_solve(std::vector<f_t>& rhs) const
 {
   total_dense_L_++;
+  return l_solve(rhs, workspace());
+}
+
+template <typename i_t, typename f_t>
+i_t basis_update_mpf_t<i_t, f_t>::l_solve(std::vector<f_t>& rhs, solve_workspace_t ws) const
+{
   const i_t m = L0_.m;
   // L*x = y
   // L0 * T0 * T1 * ... * T_{num_updates_ - 1} * x = y
@@ -2025,7 +2181,13 @@ i_t basis_update_mpf_t<i_t, f_t>::l_solve(std::vector<f_t>& rhs) const
 #ifdef CHECK_L_SOLVE
   std::vector<f_t> rhs_check = rhs;
 #endif
-  dual_simplex::lower_triangular_solve(L0_, rhs, work_estimate_);
+  if (use_levels(l_solve_levels_)) {
+    // L0 = (L0')', solved through the rows of L0
+    dual_simplex::level_scheduled_transpose_solve(
+      L0_transpose_, l_solve_levels_, rhs, solve_threads_, ws.work_estimate);
+  } else {
+    dual_simplex::lower_triangular_solve(L0_, rhs, ws.work_estimate);
+  }
 
 #ifdef CHECK_L0_SOLVE
   matrix_vector_multiply(L0_, 1.0, rhs, -1.0, residual);
@@ -2044,12 +2206,14 @@ i_t basis_update_mpf_t<i_t, f_t>::l_solve(std::vector<f_t>& rhs) const
     const f_t mu    = mu_values_[k];
     const i_t u_col = 2 * k;
     const i_t v_col = 2 * k + 1;
-    f_t dot         = dot_product(v_col, rhs);
+    f_t dot         = dot_product(v_col, rhs, ws.work_estimate);
     const f_t theta = dot / mu;
 
-    if (std::abs(theta) > zero_tol) { add_sparse_column(S_, u_col, -theta, rhs); }
+    if (std::abs(theta) > zero_tol) {
+      add_sparse_column(S_, u_col, -theta, rhs, ws.work_estimate);
+    }
   }
-  work_estimate_ += 2 * num_updates_;
+  ws.work_estimate += 2 * num_updates_;
 
 #ifdef CHECK_L_SOLVE
   std::vector<f_t> inout = rhs;
@@ -2069,14 +2233,24 @@ template <typename i_t, typename f_t>
 i_t basis_update_mpf_t<i_t, f_t>::l_solve(sparse_vector_t<i_t, f_t>& rhs) const
 {
   total_sparse_L_++;
+  return l_solve(rhs, workspace());
+}
+
+template <typename i_t, typename f_t>
+i_t basis_update_mpf_t<i_t, f_t>::l_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                          solve_workspace_t ws) const
+{
   const i_t m = L0_.m;
   // L*x = y
   // L0 * T0 * T1 * ... * T_{num_updates_ - 1} * x = y
 
   // First solve L0*x0 = y
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
-    rhs, std::nullopt, xi_workspace_, L0_, x_workspace_.data(), work_estimate_);
-  solve_to_workspace(top);  // Uses xi_workspace_ and x_workspace_ to fill rhs
+  i_t top = ws.marked != nullptr
+              ? dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
+                  rhs, std::nullopt, ws.xi, L0_, *ws.marked, ws.x.data(), ws.work_estimate)
+              : dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
+                  rhs, std::nullopt, ws.xi, L0_, ws.x.data(), ws.work_estimate);
+  solve_to_workspace(top, ws);  // Uses the workspaces to fill rhs
   i_t nz = m - top;
   // Then T0 * T1 * ... * T_{num_updates_ - 1} * x = x0
   // Or x = T_{num_updates}^{-1} * T_1^{-1} * T_0^{-1}  x0
@@ -2091,16 +2265,16 @@ i_t basis_update_mpf_t<i_t, f_t>::l_solve(sparse_vector_t<i_t, f_t>& rhs) const
     const i_t v_col = 2 * k + 1;
 
     // dot = v^T * x
-    f_t dot = dot_product(v_col, xi_workspace_, x_workspace_);
+    f_t dot = dot_product(v_col, ws.xi, ws.x, ws.work_estimate);
 
     const f_t theta = dot / mu;
     if (std::abs(theta) > zero_tol) {
-      add_sparse_column(S_, u_col, -theta, xi_workspace_, nz, x_workspace_);
+      add_sparse_column(S_, u_col, -theta, ws.xi, nz, ws.x, ws.work_estimate);
     }
   }
-  work_estimate_ += 2 * num_updates_;
+  ws.work_estimate += 2 * num_updates_;
 
-  gather_into_sparse_vector(nz, rhs);
+  gather_into_sparse_vector(nz, rhs, ws);
 
   return 0;
 }
@@ -2349,6 +2523,8 @@ int basis_update_mpf_t<i_t, f_t>::refactor_basis(
   std::vector<variable_status_t>& vstatus)
 {
   raft::common::nvtx::range scope("LU::refactor_basis");
+  solve_threads_                = settings.triangle_solve_threads;
+  const f_t refactor_start_work = cleared_work_ + work_estimate_;
   std::vector<i_t> deficient;
   std::vector<i_t> slacks_needed;
   std::vector<i_t> superbasic_list;  // Empty superbasic list
@@ -2432,9 +2608,38 @@ int basis_update_mpf_t<i_t, f_t>::refactor_basis(
   reorder_basic_list(q, basic_list);  // We no longer need q after reordering the basic list
   work_estimate_ += 3 * q.size();
   reset();
+  // The factorization belongs to the cycle it starts
+  cycle_start_work_ = refactor_start_work;
   return 0;
 }
 
+template <typename i_t, typename f_t>
+void basis_update_mpf_t<i_t, f_t>::compute_levels()
+{
+  if (solve_threads_ <= 1) {
+    clear_levels();
+    return;
+  }
+  // L0 and U0' are solved through L0' and U0, whose columns depend on the earlier ones
+  dual_simplex::compute_triangle_levels(L0_transpose_, true, l_solve_levels_, work_estimate_);
+  dual_simplex::compute_triangle_levels(U0_, true, u_transpose_solve_levels_, work_estimate_);
+  dual_simplex::compute_triangle_levels(U0_transpose_, false, u_solve_levels_, work_estimate_);
+  dual_simplex::compute_triangle_levels(L0_, false, l_transpose_solve_levels_, work_estimate_);
+}
+
+template <typename i_t, typename f_t>
+bool basis_update_mpf_t<i_t, f_t>::refactor_recommended()
+{
+  if (num_updates_ >= 4 * refactor_frequency_) { return true; }
+  if (num_updates_ == 0) { return false; }
+  const f_t average = (cleared_work_ + work_estimate_ - cycle_start_work_) / num_updates_;
+  min_cycle_average_ = std::min(min_cycle_average_, average);
+  if (4 * num_updates_ < refactor_frequency_) { return false; }
+  // A small margin keeps a single expensive iteration from cutting the cycle short
+  constexpr f_t rise_tolerance = 0.05;
+  return average > (1.0 + rise_tolerance) * min_cycle_average_;
+}
+
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 template class basis_update_t<int, double>;
 template class basis_update_mpf_t<int, double>;
@@ -11,8 +11,10 @@
 #include <dual_simplex/simplex_solver_settings.hpp>
 #include <dual_simplex/sparse_matrix.hpp>
 #include <dual_simplex/sparse_vector.hpp>
+#include <dual_simplex/triangle_solve.hpp>
 #include <dual_simplex/types.hpp>
 
+#include <limits>
 #include <numeric>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -225,6 +227,8 @@ class basis_update_mpf_t {
 
   basis_update_mpf_t(const basis_update_mpf_t& other)            = default;
   basis_update_mpf_t& operator=(const basis_update_mpf_t& other) = default;
+  basis_update_mpf_t(basis_update_mpf_t&& other)                 = default;
+  basis_update_mpf_t& operator=(basis_update_mpf_t&& other)      = default;
 
   void print_stats() const
   {
@@ -291,6 +295,7 @@ class basis_update_mpf_t {
     x_workspace_.resize(n, 0.0);
     U0_transpose_.resize(1, 1, 1);
     L0_transpose_.resize(1, 1, 1);
+    clear_levels();
     clear();
     reset_stats();
   }
@@ -319,6 +324,15 @@ class basis_update_mpf_t {
               sparse_vector_t<i_t, f_t>& Lsol,
               bool need_Lsol = true) const;
 
+  // Solves B*x_k = b_k for a batch of independent sparse right-hand sides. Lsol[k] receives
+  // L^{-1}*b_k when it is not null. With more than one thread the solves of a large basis run
+  // concurrently, each on its own workspace, and their hypersparse choices are made from the
+  // statistics gathered before the batch, so the result depends on the batch but not on timing
+  i_t b_solve_batch(const std::vector<const sparse_vector_t<i_t, f_t>*>& rhs,
+                    const std::vector<sparse_vector_t<i_t, f_t>*>& solution,
+                    const std::vector<sparse_vector_t<i_t, f_t>*>& Lsol,
+                    i_t num_threads) const;
+
   // Solves for y such that B'*y = c, where B is the basis matrix
   i_t b_transpose_solve(const std::vector<f_t>& rhs, std::vector<f_t>& solution) const;
   i_t b_transpose_solve(const sparse_vector_t<i_t, f_t>& rhs,
@@ -373,6 +387,7 @@ class basis_update_mpf_t {
     L0_.transpose(L0_transpose_);
     U0_.transpose(U0_transpose_);
     work_estimate_ += 6 * L0_.col_start[L0_.n] + 6 * U0_.col_start[U0_.n];
+    compute_levels();
   }
 
   void multiply_lu(csc_matrix_t<i_t, f_t>& out) const;
@@ -389,8 +404,19 @@ class basis_update_mpf_t {
 
   void set_refactor_frequency(i_t new_frequency) { refactor_frequency_ = new_frequency; }
 
+  // Whether to refactor before the next update, from the measured work rather than a fixed count.
+  // The work of a refactor cycle is the factorization plus everything done with the factors since.
+  // Its average per update first falls as the factorization is amortized, then rises as the solves
+  // through the growing updates cost more. Refactoring pays off once the average has risen past
+  // its minimum, between refactor_frequency / 4 and 4 * refactor_frequency updates.
+  bool refactor_recommended();
+
   f_t work_estimate() const { return work_estimate_; }
-  void clear_work_estimate() { work_estimate_ = 0.0; }
+  void clear_work_estimate()
+  {
+    cleared_work_ += work_estimate_;
+    work_estimate_ = 0.0;
+  }
 
  private:
   void clear()
@@ -407,6 +433,8 @@ class basis_update_mpf_t {
     mu_values_.reserve(refactor_frequency_);
     num_updates_ = 0;
     work_estimate_ += 2 * refactor_frequency_;
+    cycle_start_work_  = cleared_work_ + work_estimate_;
+    min_cycle_average_ = std::numeric_limits<f_t>::infinity();
 
     std::fill(xi_workspace_.begin(), xi_workspace_.end(), 0);
     std::fill(x_workspace_.begin(), x_workspace_.end(), 0.0);
@@ -424,23 +452,96 @@ class basis_update_mpf_t {
                                 csc_matrix_t<i_t, f_t>& out,
                                 i_t out_col) const;
 
-  void solve_to_workspace(i_t top) const;
-  void solve_to_sparse_vector(i_t top, sparse_vector_t<i_t, f_t>& out) const;
+  // Pattern and value workspaces and work counter used by a solve. The member workspaces serve
+  // the regular solves; each solve of a parallel batch gets its own
+  struct solve_workspace_t {
+    std::vector<i_t>& xi;
+    std::vector<f_t>& x;
+    f_t& work_estimate;
+    // When set, hypersparse solves mark their reach here instead of in L0_/U0_.col_start
+    std::vector<char>* marked;
+  };
+  solve_workspace_t workspace() const
+  {
+    return {xi_workspace_, x_workspace_, work_estimate_, nullptr};
+  }
+
+  // Level sets of the dense solves, computed with the transposes when solve_threads_ > 1
+  void compute_levels();
+  void clear_levels()
+  {
+    l_solve_levels_.clear();
+    u_solve_levels_.clear();
+    l_transpose_solve_levels_.clear();
+    u_transpose_solve_levels_.clear();
+  }
+  bool use_levels(const triangle_levels_t<i_t>& levels) const
+  {
+    return solve_threads_ > 1 && levels.worth_scheduling(L0_.m);
+  }
+
+  i_t l_solve(std::vector<f_t>& rhs, solve_workspace_t ws) const;
+  i_t l_solve(sparse_vector_t<i_t, f_t>& rhs, solve_workspace_t ws) const;
+  i_t u_solve(std::vector<f_t>& rhs, solve_workspace_t ws) const;
+  i_t u_solve(sparse_vector_t<i_t, f_t>& rhs, solve_workspace_t ws) const;
+
+  void solve_to_workspace(i_t top) const { solve_to_workspace(top, workspace()); }
+  void solve_to_workspace(i_t top, solve_workspace_t ws) const;
+  void solve_to_sparse_vector(i_t top, sparse_vector_t<i_t, f_t>& out) const
+  {
+    solve_to_sparse_vector(top, out, workspace());
+  }
+  void solve_to_sparse_vector(i_t top, sparse_vector_t<i_t, f_t>& out, solve_workspace_t ws) const;
   i_t scatter_into_workspace(const sparse_vector_t<i_t, f_t>& in) const;
-  void gather_into_sparse_vector(i_t nz, sparse_vector_t<i_t, f_t>& out) const;
+  void gather_into_sparse_vector(i_t nz, sparse_vector_t<i_t, f_t>& out) const
+  {
+    gather_into_sparse_vector(nz, out, workspace());
+  }
+  void gather_into_sparse_vector(i_t nz,
+                                 sparse_vector_t<i_t, f_t>& out,
+                                 solve_workspace_t ws) const;
   i_t nonzeros(const std::vector<f_t>& x) const;
-  f_t dot_product(i_t col, const std::vector<f_t>& x) const;
-  f_t dot_product(i_t col, const std::vector<i_t>& mark, const std::vector<f_t>& x) const;
+  f_t dot_product(i_t col, const std::vector<f_t>& x) const
+  {
+    return dot_product(col, x, work_estimate_);
+  }
+  f_t dot_product(i_t col, const std::vector<f_t>& x, f_t& work_estimate) const;
+  f_t dot_product(i_t col, const std::vector<i_t>& mark, const std::vector<f_t>& x) const
+  {
+    return dot_product(col, mark, x, work_estimate_);
+  }
+  f_t dot_product(i_t col,
+                  const std::vector<i_t>& mark,
+                  const std::vector<f_t>& x,
+                  f_t& work_estimate) const;
+  void add_sparse_column(const csc_matrix_t<i_t, f_t>& S,
+                         i_t col,
+                         f_t theta,
+                         std::vector<f_t>& x) const
+  {
+    add_sparse_column(S, col, theta, x, work_estimate_);
+  }
   void add_sparse_column(const csc_matrix_t<i_t, f_t>& S,
                          i_t col,
                          f_t theta,
-                         std::vector<f_t>& x) const;
+                         std::vector<f_t>& x,
+                         f_t& work_estimate) const;
   void add_sparse_column(const csc_matrix_t<i_t, f_t>& S,
                          i_t col,
                          f_t theta,
                          std::vector<i_t>& mark,
                          i_t& nz,
-                         std::vector<f_t>& x) const;
+                         std::vector<f_t>& x) const
+  {
+    add_sparse_column(S, col, theta, mark, nz, x, work_estimate_);
+  }
+  void add_sparse_column(const csc_matrix_t<i_t, f_t>& S,
+                         i_t col,
+                         f_t theta,
+                         std::vector<i_t>& mark,
+                         i_t& nz,
+                         std::vector<f_t>& x,
+                         f_t& work_estimate) const;
 
   void l_multiply(std::vector<f_t>& inout) const;
   void l_transpose_multiply(std::vector<f_t>& inout) const;
@@ -457,6 +558,9 @@ class basis_update_mpf_t {
   std::vector<f_t> mu_values_;      // stores information about the rank-1 updates to L
   mutable std::vector<i_t> xi_workspace_;
   mutable std::vector<f_t> x_workspace_;
+  mutable std::vector<std::vector<i_t>> batch_xi_workspaces_;  // One per solve of a parallel batch
+  mutable std::vector<std::vector<f_t>> batch_x_workspaces_;
+  mutable std::vector<std::vector<char>> batch_marked_workspaces_;
   mutable csc_matrix_t<i_t, f_t> U0_transpose_;  // Needed for sparse solves
   mutable csc_matrix_t<i_t, f_t> L0_transpose_;  // Needed for sparse solves
 
@@ -481,7 +585,17 @@ class basis_update_mpf_t {
 
   f_t hypersparse_threshold_;
 
+  i_t solve_threads_{1};
+  // Level sets of the solves with L0, U0, L0' and U0', made on L0', U0', L0 and U0
+  triangle_levels_t<i_t> l_solve_levels_;
+  triangle_levels_t<i_t> u_solve_levels_;
+  triangle_levels_t<i_t> l_transpose_solve_levels_;
+  triangle_levels_t<i_t> u_transpose_solve_levels_;
+
   mutable f_t work_estimate_{0.0};
+  f_t cleared_work_{0.0};      // Work moved out of work_estimate_ by clear_work_estimate
+  f_t cycle_start_work_{0.0};  // Total work when the current refactor cycle started
+  f_t min_cycle_average_{std::numeric_limits<f_t>::infinity()};
 };
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -10,7 +10,10 @@
 #include <dual_simplex/tic_toc.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
 
 namespace cuopt::linear_programming::dual_simplex {
 
@@ -24,10 +27,21 @@ i_t bound_flipping_ratio_test_t<i_t, f_t>::compute_breakpoints(std::vector<i_t>&
   f_t pivot_tol          = settings_.pivot_tol;
   const f_t dual_tol     = settings_.dual_tol / 10;
 
+  // Below this many nonzeros in delta_z the breakpoints are found on a single thread
+  constexpr i_t parallel_breakpoints_size = 50000;
+  const i_t num_threads                   = settings_.pricing_num_threads;
+
   i_t idx = 0;
   while (idx == 0 && pivot_tol >= 1e-12) {
     // Loop over the nonbasic variables j with non-zero delta_z
     const i_t nz = delta_z_indices_.size();
+    if (num_threads > 1 && nz >= parallel_breakpoints_size) {
+      idx = compute_breakpoints_parallel(pivot_tol, dual_tol, num_threads, indicies, ratios);
+      work_estimate_ += 4 * nz;
+      work_estimate_ += 4 * idx;
+      pivot_tol /= 10;
+      continue;
+    }
     for (i_t h = 0; h < nz; ++h) {
       const i_t j = delta_z_indices_[h];
       const i_t k = nonbasic_mark_[j];
@@ -52,6 +66,50 @@ i_t bound_flipping_ratio_test_t<i_t, f_t>::compute_breakpoints(std::vector<i_t>&
   return idx;
 }
 
+template <typename i_t, typename f_t>
+i_t bound_flipping_ratio_test_t<i_t, f_t>::compute_breakpoints_parallel(f_t pivot_tol,
+                                                                        f_t dual_tol,
+                                                                        i_t num_threads,
+                                                                        std::vector<i_t>& indicies,
+                                                                        std::vector<f_t>& ratios)
+{
+  // Each block of delta_z_indices finds its breakpoints, then the blocks are copied out in order
+  // so the breakpoints, and therefore the ties broken by the passes, match the sequential loop
+  const i_t nz         = delta_z_indices_.size();
+  const i_t num_blocks = num_threads;
+  std::vector<i_t> block_count(num_blocks + 1, 0);
+  std::vector<std::vector<i_t>> block_indices(num_blocks);
+  std::vector<std::vector<f_t>> block_ratios(num_blocks);
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+  for (i_t b = 0; b < num_blocks; ++b) {
+    const i_t begin = static_cast<int64_t>(nz) * b / num_blocks;
+    const i_t end   = static_cast<int64_t>(nz) * (b + 1) / num_blocks;
+    for (i_t h = begin; h < end; ++h) {
+      const i_t j = delta_z_indices_[h];
+      const i_t k = nonbasic_mark_[j];
+      if (vstatus_[j] == variable_status_t::NONBASIC_FIXED) { continue; }
+      if (vstatus_[j] == variable_status_t::NONBASIC_LOWER && delta_z_[j] < -pivot_tol) {
+        block_indices[b].push_back(k);
+        block_ratios[b].push_back(std::max((-dual_tol - z_[j]) / delta_z_[j], 0.0));
+      }
+      if (vstatus_[j] == variable_status_t::NONBASIC_UPPER && delta_z_[j] > pivot_tol) {
+        block_indices[b].push_back(k);
+        block_ratios[b].push_back(std::max((dual_tol - z_[j]) / delta_z_[j], 0.0));
+      }
+    }
+    block_count[b + 1] = block_indices[b].size();
+  }
+  for (i_t b = 0; b < num_blocks; ++b) {
+    block_count[b + 1] += block_count[b];
+  }
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+  for (i_t b = 0; b < num_blocks; ++b) {
+    std::copy(block_indices[b].begin(), block_indices[b].end(), indicies.begin() + block_count[b]);
+    std::copy(block_ratios[b].begin(), block_ratios[b].end(), ratios.begin() + block_count[b]);
+  }
+  return block_count[num_blocks];
+}
+
 template <typename i_t, typename f_t>
 i_t bound_flipping_ratio_test_t<i_t, f_t>::single_pass(i_t start,
                                                        i_t end,
@@ -162,27 +220,22 @@ i_t bound_flipping_ratio_test_t<i_t, f_t>::compute_step_length(f_t& step_length,
       slope);
   }
 
-  // Continue the search using a heap to order the breakpoints
+  // Continue the search over the remaining breakpoints
   ratios[k_idx]   = ratios[num_breakpoints - 1];
   indicies[k_idx] = indicies[num_breakpoints - 1];
 
-  constexpr bool use_bucket_pass = false;
-
-  if (use_bucket_pass) {
-    f_t max_ratio = 0.0;
-    for (i_t k = 0; k < num_breakpoints - 1; ++k) {
-      if (ratios[k] > max_ratio) { max_ratio = ratios[k]; }
-    }
-    work_estimate_ += 2 * num_breakpoints;
-    settings_.log.printf(
-      "Starting heap passes. %d breakpoints max ratio %e\n", num_breakpoints - 1, max_ratio);
+  // Below this many breakpoints a heap over all of them is cheaper than the buckets
+  constexpr i_t bucket_pass_min_breakpoints = 64;
+  if (num_breakpoints - 1 < bucket_pass_min_breakpoints) {
+    std::vector<i_t> heap(num_breakpoints - 1);
+    std::iota(heap.begin(), heap.end(), 0);
+    work_estimate_ += heap.size();
+    heap_passes(indicies, ratios, heap, slope, step_length, nonbasic_entering, entering_index);
+  } else {
     bucket_pass(
       indicies, ratios, num_breakpoints - 1, slope, step_length, nonbasic_entering, entering_index);
   }
 
-  heap_passes(
-    indicies, ratios, num_breakpoints - 1, slope, step_length, nonbasic_entering, entering_index);
-
   if constexpr (verbose) {
     settings_.log.printf("BFRT step length %e entering index %d non basic entering %d pivot %e\n",
                          step_length,
@@ -196,29 +249,24 @@ i_t bound_flipping_ratio_test_t<i_t, f_t>::compute_step_length(f_t& step_length,
 template <typename i_t, typename f_t>
 void bound_flipping_ratio_test_t<i_t, f_t>::heap_passes(const std::vector<i_t>& current_indicies,
                                                         const std::vector<f_t>& current_ratios,
-                                                        i_t num_breakpoints,
+                                                        std::vector<i_t>& bare_idx,
                                                         f_t& slope,
                                                         f_t& step_length,
                                                         i_t& nonbasic_entering,
                                                         i_t& entering_index)
 {
-  std::vector<i_t> bare_idx(num_breakpoints);
   constexpr bool verbose                = false;
-  const f_t dual_tol                    = settings_.dual_tol;
   const f_t zero_tol                    = settings_.zero_tol;
   const std::vector<f_t>& delta_z       = delta_z_;
   const std::vector<i_t>& nonbasic_list = nonbasic_list_;
-  const i_t N                           = num_breakpoints;
-  for (i_t k = 0; k < N; ++k) {
-    bare_idx[k] = k;
-    if constexpr (verbose) {
+  if constexpr (verbose) {
+    for (i_t k : bare_idx) {
       settings_.log.printf("Adding index %d ratio %e pivot %e to heap\n",
                            current_indicies[k],
                            current_ratios[k],
                            std::abs(delta_z[nonbasic_list[current_indicies[k]]]));
     }
   }
-  work_estimate_ += N;
 
   auto compare = [zero_tol, &current_ratios, &current_indicies, &delta_z, &nonbasic_list](
                    const i_t& a, const i_t& b) {
@@ -285,62 +333,52 @@ void bound_flipping_ratio_test_t<i_t, f_t>::bucket_pass(const std::vector<i_t>&
                                                         i_t& nonbasic_entering,
                                                         i_t& entering_index)
 {
-  const f_t dual_tol                    = settings_.dual_tol;
-  const f_t zero_tol                    = settings_.zero_tol;
-  const std::vector<f_t>& delta_z       = delta_z_;
-  const std::vector<i_t>& nonbasic_list = nonbasic_list_;
-  const i_t N                           = num_breakpoints;
-
-  const i_t K = 400;  // 0, -16, -15, ...., 0, 1, ...., 400 - 18 = 382
-  std::vector<f_t> buckets(K, 0.0);
-  std::vector<i_t> bucket_count(K, 0);
+  // The breakpoints are bucketed by the binary exponent of their ratio, bucket 0 holding the zero
+  // ratios. A bucket only holds larger ratios than the ones before it, so the buckets whose total
+  // slope change leaves the slope positive are passed whole, and only the breakpoints of the
+  // bucket where the search stops are ordered by the heap
+  constexpr i_t min_exponent = -64;
+  constexpr i_t max_exponent = 64;
+  constexpr i_t K            = max_exponent - min_exponent + 2;
+  const i_t N                = num_breakpoints;
+  std::array<f_t, K> bucket_slope{};
+  std::array<i_t, K> bucket_count{};
+  std::vector<i_t> bucket(N);
   for (i_t k = 0; k < N; ++k) {
-    const i_t idx          = current_indicies[k];
-    const f_t ratio        = current_ratios[k];
-    const f_t min_exponent = -16.0;
-    const f_t max_exponent = 382.0;
-    const f_t exponent     = std::max(min_exponent, std::min(max_exponent, std::log10(ratio)));
-    const i_t bucket_idx   = ratio == 0.0 ? 0 : static_cast<i_t>(exponent - min_exponent + 1);
-    // settings_.log.printf("Ratio %e exponent %e bucket_idx %d\n", ratio, exponent, bucket_idx);
-    const i_t j           = nonbasic_list[idx];
-    const f_t interval    = upper_[j] - lower_[j];
-    const f_t delta_slope = std::abs(delta_z_[j]) * interval;
-    buckets[bucket_idx] += delta_slope;
-    bucket_count[bucket_idx]++;
-  }
-
-  std::vector<f_t> cumulative_sum(K, 0.0);
-  cumulative_sum[0] = buckets[0];
-  if (cumulative_sum[0] > slope) {
-    settings_.log.printf(
-      "Bucket 0. Count in bucket %d. Slope %e. Cumulative sum %e. Bucket value %e\n",
-      bucket_count[0],
-      slope,
-      cumulative_sum[0],
-      buckets[0]);
-    return;
+    const f_t ratio    = current_ratios[k];
+    const i_t exponent = ratio == 0.0 ? min_exponent - 1
+                                      : std::clamp(static_cast<i_t>(std::ilogb(ratio)),
+                                                   min_exponent,
+                                                   max_exponent);
+    const i_t b        = exponent - min_exponent + 1;
+    const i_t j        = nonbasic_list_[current_indicies[k]];
+    // An unbounded variable stops the search
+    const f_t delta_slope =
+      bounded_variables_[j] ? std::abs(delta_z_[j]) * (upper_[j] - lower_[j]) : inf;
+    bucket[k] = b;
+    bucket_slope[b] += delta_slope;
+    bucket_count[b]++;
   }
-  i_t k;
-  bool exceeded = false;
-  for (k = 1; k < K; ++k) {
-    cumulative_sum[k] = cumulative_sum[k - 1] + buckets[k];
-    if (cumulative_sum[k] > slope) {
-      exceeded = true;
-      break;
-    }
+  work_estimate_ += 8 * N;
+
+  // Find the bucket where the slope turns nonpositive, or the last one when it never does
+  i_t target = -1;
+  for (i_t b = 0; b < K; ++b) {
+    if (bucket_count[b] == 0) { continue; }
+    target = b;
+    if (slope - bucket_slope[b] <= 0.0) { break; }
+    slope -= bucket_slope[b];
   }
+  work_estimate_ += 2 * K;
 
-  if (exceeded) {
-    settings_.log.printf(
-      "Value in bucket %d. Count in buckets %d. Slope %e. Cumulative sum %e. Next sum %e Bucket "
-      "value %e\n",
-      k,
-      bucket_count[k],
-      slope,
-      cumulative_sum[k - 1],
-      cumulative_sum[k],
-      buckets[k - 1]);
+  std::vector<i_t> heap;
+  heap.reserve(bucket_count[target]);
+  for (i_t k = 0; k < N; ++k) {
+    if (bucket[k] == target) { heap.push_back(k); }
   }
+  work_estimate_ += N + heap.size();
+  heap_passes(
+    current_indicies, current_ratios, heap, slope, step_length, nonbasic_entering, entering_index);
 }
 
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
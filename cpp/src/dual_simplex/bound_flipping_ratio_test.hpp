@@ -58,6 +58,11 @@ class bound_flipping_ratio_test_t {
 
  private:
   i_t compute_breakpoints(std::vector<i_t>& indices, std::vector<f_t>& ratios);
+  i_t compute_breakpoints_parallel(f_t pivot_tol,
+                                   f_t dual_tol,
+                                   i_t num_threads,
+                                   std::vector<i_t>& indices,
+                                   std::vector<f_t>& ratios);
   i_t single_pass(i_t start,
                   i_t end,
                   const std::vector<i_t>& indices,
@@ -66,14 +71,17 @@ class bound_flipping_ratio_test_t {
                   f_t& step_length,
                   i_t& nonbasic_entering,
                   i_t& enetering_index);
+  // Pops the breakpoints in bare_idx, positions in current_ratios, by increasing ratio until the
+  // slope turns nonpositive or an unbounded variable is reached
   void heap_passes(const std::vector<i_t>& current_indicies,
                    const std::vector<f_t>& current_ratios,
-                   i_t num_breakpoints,
+                   std::vector<i_t>& bare_idx,
                    f_t& slope,
                    f_t& step_lenght,
                    i_t& nonbasic_entering,
                    i_t& entering_index);
 
+  // Skips the buckets of breakpoints that the slope passes whole, then orders the last one
   void bucket_pass(const std::vector<i_t>& current_indicies,
                    const std::vector<f_t>& current_ratios,
                    i_t num_breakpoints,
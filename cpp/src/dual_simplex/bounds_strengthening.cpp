@@ -65,7 +65,9 @@ bounds_strengthening_t<i_t, f_t>::bounds_strengthening_t(
     delta_min_activity(problem.num_rows),
     delta_max_activity(problem.num_rows),
     constraint_lb(problem.num_rows),
-    constraint_ub(problem.num_rows)
+    constraint_ub(problem.num_rows),
+    row_queue(problem.num_rows),
+    row_in_queue(problem.num_rows, 0)
 {
   const bool is_row_sense_empty = row_sense.empty();
   if (is_row_sense_empty) {
@@ -88,6 +90,158 @@ bounds_strengthening_t<i_t, f_t>::bounds_strengthening_t(
   }
 }
 
+template <typename i_t, typename f_t>
+void bounds_strengthening_t<i_t, f_t>::push_row(i_t i)
+{
+  if (row_in_queue[i]) { return; }
+  row_in_queue[i] = 1;
+  row_queue[(queue_head + queue_size) % row_queue.size()] = i;
+  ++queue_size;
+}
+
+template <typename i_t, typename f_t>
+i_t bounds_strengthening_t<i_t, f_t>::pop_row()
+{
+  const i_t i     = row_queue[queue_head];
+  queue_head      = (queue_head + 1) % row_queue.size();
+  row_in_queue[i] = 0;
+  --queue_size;
+  return i;
+}
+
+template <typename i_t, typename f_t>
+void bounds_strengthening_t<i_t, f_t>::clear_queue()
+{
+  while (queue_size > 0) {
+    pop_row();
+  }
+  queue_head = 0;
+}
+
+template <typename i_t, typename f_t>
+void bounds_strengthening_t<i_t, f_t>::push_column_rows(i_t j, i_t skip_row, size_t& nnz_processed)
+{
+  const i_t col_start = A.col_start[j];
+  const i_t col_end   = A.col_start[j + 1];
+  nnz_processed += (col_end - col_start);
+  for (i_t q = col_start; q < col_end; ++q) {
+    if (A.i[q] != skip_row) { push_row(A.i[q]); }
+  }
+}
+
+template <typename i_t, typename f_t>
+void bounds_strengthening_t<i_t, f_t>::copy_conflicts()
+{
+  const i_t first = static_cast<i_t>(conflict_start.size()) - 1;
+  if (conflict_pool->size() <= first) { return; }
+  conflict_pool->copy(first, conflict_start, conflict_literals);
+  if (column_conflicts.empty()) { column_conflicts.resize(A.n); }
+  const i_t num_conflicts = static_cast<i_t>(conflict_start.size()) - 1;
+  for (i_t c = first; c < num_conflicts; ++c) {
+    for (i_t p = conflict_start[c]; p < conflict_start[c + 1]; ++p) {
+      column_conflicts[conflict_literals[p].j].push_back(c);
+    }
+  }
+}
+
+// Applies x[leader] >= x[follower] to the orderings of column j: the upper bound of a leader
+// bounds its followers and the lower bound of a follower bounds its leader
+template <typename i_t, typename f_t>
+bool bounds_strengthening_t<i_t, f_t>::propagate_orderings(
+  i_t j, const simplex_solver_settings_t<i_t, f_t>& settings, size_t& nnz_processed)
+{
+  for (i_t p = orderings->begin(j); p < orderings->end(j); ++p) {
+    const i_t k        = orderings->index[p];
+    const i_t leader   = orderings->leader[k];
+    const i_t follower = orderings->follower[k];
+    ++nnz_processed;
+    if (upper[follower] > upper[leader]) {
+      upper[follower] = upper[leader];
+      push_column_rows(follower, -1, nnz_processed);
+      column_stack.push_back(follower);
+    }
+    if (lower[leader] < lower[follower]) {
+      lower[leader] = lower[follower];
+      push_column_rows(leader, -1, nnz_processed);
+      column_stack.push_back(leader);
+    }
+    if (lower[follower] > upper[follower] + settings.primal_tol ||
+        lower[leader] > upper[leader] + settings.primal_tol) {
+      settings.log.debug("Infeasible ordering x%d >= x%d\n", leader, follower);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks the conflicts of column j. A conflict with all its literals satisfied prunes the node,
+// and one with a single literal left open gets that literal negated
+template <typename i_t, typename f_t>
+bool bounds_strengthening_t<i_t, f_t>::propagate_conflicts(
+  i_t j, const simplex_solver_settings_t<i_t, f_t>& settings, size_t& nnz_processed)
+{
+  if (j >= static_cast<i_t>(column_conflicts.size())) { return true; }
+  const f_t tol = settings.integer_tol;
+  for (i_t c : column_conflicts[j]) {
+    i_t open      = -1;
+    i_t num_open  = 0;
+    bool is_false = false;
+    for (i_t p = conflict_start[c]; p < conflict_start[c + 1] && num_open < 2; ++p) {
+      const conflict_literal_t<i_t, f_t>& literal = conflict_literals[p];
+      const i_t k                                 = literal.j;
+      ++nnz_processed;
+      if (literal.is_lower) {
+        if (lower[k] >= literal.bound - tol) { continue; }
+        is_false = upper[k] < literal.bound - tol;
+      } else {
+        if (upper[k] <= literal.bound + tol) { continue; }
+        is_false = lower[k] > literal.bound + tol;
+      }
+      if (is_false) { break; }
+      open = p;
+      ++num_open;
+    }
+    if (is_false || num_open > 1) { continue; }
+    if (num_open == 0) {
+      settings.log.debug("Node violates conflict %d\n", c);
+      return false;
+    }
+
+    const conflict_literal_t<i_t, f_t>& literal = conflict_literals[open];
+    const i_t k                                 = literal.j;
+    if (literal.is_lower) {
+      upper[k] = std::ceil(literal.bound - tol) - 1;
+    } else {
+      lower[k] = std::floor(literal.bound + tol) + 1;
+    }
+    if (lower[k] > upper[k] + settings.primal_tol) {
+      settings.log.debug("Infeasible conflict %d on x%d\n", c, k);
+      return false;
+    }
+    push_column_rows(k, -1, nnz_processed);
+    column_stack.push_back(k);
+  }
+  return true;
+}
+
+// Propagates the orderings and the conflicts of the columns on the stack, which holds the columns
+// whose bounds changed
+template <typename i_t, typename f_t>
+bool bounds_strengthening_t<i_t, f_t>::propagate_columns(
+  const simplex_solver_settings_t<i_t, f_t>& settings, size_t& nnz_processed)
+{
+  while (!column_stack.empty()) {
+    const i_t j = column_stack.back();
+    column_stack.pop_back();
+    if ((orderings != nullptr && !propagate_orderings(j, settings, nnz_processed)) ||
+        (conflict_pool != nullptr && !propagate_conflicts(j, settings, nnz_processed))) {
+      column_stack.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename i_t, typename f_t>
 bool bounds_strengthening_t<i_t, f_t>::bounds_strengthening(
   const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -98,22 +252,23 @@ bool bounds_strengthening_t<i_t, f_t>::bounds_strengthening(
   const i_t m = A.m;
   const i_t n = A.n;
 
-  std::vector<bool> constraint_changed(m, true);
-  std::vector<bool> variable_changed(n, false);
-  std::vector<bool> constraint_changed_next(m, false);
-
   size_t nnz_processed = 0;
 
-  if (!bounds_changed.empty()) {
-    std::fill(constraint_changed.begin(), constraint_changed.end(), false);
+  // Only the rows of the changed variables are queued, and a row is queued again only when one
+  // of its variables is tightened, so a node touches the rows reached by its branching rather than
+  // the whole matrix. Each row is in the queue at most once
+  clear_queue();
+  if (bounds_changed.empty()) {
+    for (i_t i = 0; i < m; ++i) {
+      push_row(i);
+    }
+  } else {
     for (i_t j = 0; j < n; ++j) {
-      if (bounds_changed[j]) {
-        const i_t col_start = A.col_start[j];
-        const i_t col_end   = A.col_start[j + 1];
-        for (i_t p = col_start; p < col_end; ++p) {
-          const i_t i           = A.i[p];
-          constraint_changed[i] = true;
-        }
+      if (!bounds_changed[j]) { continue; }
+      const i_t col_start = A.col_start[j];
+      const i_t col_end   = A.col_start[j + 1];
+      for (i_t p = col_start; p < col_end; ++p) {
+        push_row(A.i[p]);
       }
     }
   }
@@ -122,127 +277,119 @@ bool bounds_strengthening_t<i_t, f_t>::bounds_strengthening(
   upper = upper_bounds;
   print_bounds_stats(lower, upper, settings, "Initial bounds");
 
-  i_t iter             = 0;
-  const i_t iter_limit = 10;
-  while (iter < iter_limit) {
-    for (i_t i = 0; i < m; ++i) {
-      if (!constraint_changed[i]) { continue; }
-      const i_t row_start = Arow.row_start[i];
-      const i_t row_end   = Arow.row_start[i + 1];
-      nnz_processed += (row_end - row_start);
-
-      f_t min_a = 0.0;
-      f_t max_a = 0.0;
-      for (i_t p = row_start; p < row_end; ++p) {
-        const i_t j    = Arow.j[p];
-        const f_t a_ij = Arow.x[p];
-
-        variable_changed[j] = true;
-        if (a_ij > 0) {
-          min_a += a_ij * lower[j];
-          max_a += a_ij * upper[j];
-        } else if (a_ij < 0) {
-          min_a += a_ij * upper[j];
-          max_a += a_ij * lower[j];
-        }
-        if (upper[j] == inf && a_ij > 0) { max_a = inf; }
-        if (lower[j] == -inf && a_ij < 0) { max_a = inf; }
-
-        if (lower[j] == -inf && a_ij > 0) { min_a = -inf; }
-        if (upper[j] == inf && a_ij < 0) { min_a = -inf; }
-      }
+  if (conflict_pool != nullptr) { copy_conflicts(); }
+  const bool has_columns = (orderings != nullptr && !orderings->empty()) ||
+                           (conflict_pool != nullptr && conflict_start.size() > 1);
+  if (has_columns) {
+    column_stack.clear();
+    for (i_t j = 0; j < n; ++j) {
+      if (bounds_changed.empty() || bounds_changed[j]) { column_stack.push_back(j); }
+    }
+    if (!propagate_columns(settings, nnz_processed)) {
+      clear_queue();
+      last_nnz_processed = nnz_processed;
+      return false;
+    }
+  }
 
-      f_t cnst_lb = constraint_lb[i];
-      f_t cnst_ub = constraint_ub[i];
-      bool is_infeasible =
-        check_infeasibility<i_t, f_t>(min_a, max_a, cnst_lb, cnst_ub, settings.primal_tol);
-      if (is_infeasible) {
-        settings.log.debug(
-          "Iter:: %d, Infeasible constraint %d, cnst_lb %e, cnst_ub %e, min_a %e, max_a %e\n",
-          iter,
-          i,
-          cnst_lb,
-          cnst_ub,
-          min_a,
-          max_a);
-        last_nnz_processed = nnz_processed;
-        return false;
+  // Long chains of small changes on continuous variables can take arbitrarily many steps to
+  // converge, so the propagation stops after about as much work as 10 passes over the matrix
+  const size_t work_limit = 20 * static_cast<size_t>(A.col_start[n]) + m;
+  while (queue_size > 0 && nnz_processed < work_limit) {
+    const i_t i         = pop_row();
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+    nnz_processed += (row_end - row_start);
+
+    f_t min_a = 0.0;
+    f_t max_a = 0.0;
+    for (i_t p = row_start; p < row_end; ++p) {
+      const i_t j    = Arow.j[p];
+      const f_t a_ij = Arow.x[p];
+
+      if (a_ij > 0) {
+        min_a += a_ij * lower[j];
+        max_a += a_ij * upper[j];
+      } else if (a_ij < 0) {
+        min_a += a_ij * upper[j];
+        max_a += a_ij * lower[j];
       }
+      if (upper[j] == inf && a_ij > 0) { max_a = inf; }
+      if (lower[j] == -inf && a_ij < 0) { max_a = inf; }
 
-      delta_min_activity[i] = cnst_ub - min_a;
-      delta_max_activity[i] = cnst_lb - max_a;
+      if (lower[j] == -inf && a_ij > 0) { min_a = -inf; }
+      if (upper[j] == inf && a_ij < 0) { min_a = -inf; }
     }
 
-    i_t num_bounds_changed = 0;
-
-    for (i_t k = 0; k < n; ++k) {
-      if (!variable_changed[k]) { continue; }
-      f_t old_lb = lower[k];
-      f_t old_ub = upper[k];
-
-      f_t new_lb = old_lb;
-      f_t new_ub = old_ub;
-
-      const i_t col_start = A.col_start[k];
-      const i_t col_end   = A.col_start[k + 1];
-      nnz_processed += (col_end - col_start);
-      for (i_t p = col_start; p < col_end; ++p) {
-        const i_t i = A.i[p];
+    f_t cnst_lb = constraint_lb[i];
+    f_t cnst_ub = constraint_ub[i];
+    bool is_infeasible =
+      check_infeasibility<i_t, f_t>(min_a, max_a, cnst_lb, cnst_ub, settings.primal_tol);
+    if (is_infeasible) {
+      settings.log.debug(
+        "Infeasible constraint %d, cnst_lb %e, cnst_ub %e, min_a %e, max_a %e\n",
+        i,
+        cnst_lb,
+        cnst_ub,
+        min_a,
+        max_a);
+      clear_queue();
+      last_nnz_processed = nnz_processed;
+      return false;
+    }
 
-        if (!constraint_changed[i]) { continue; }
-        const f_t a_ik = A.x[p];
+    delta_min_activity[i] = cnst_ub - min_a;
+    delta_max_activity[i] = cnst_lb - max_a;
 
-        f_t delta_min_act = delta_min_activity[i];
-        f_t delta_max_act = delta_max_activity[i];
+    // The activities were computed with the bounds before this loop. As bounds only tighten, the
+    // bounds derived from them stay valid
+    for (i_t p = row_start; p < row_end; ++p) {
+      const i_t k    = Arow.j[p];
+      const f_t a_ik = Arow.x[p];
+      f_t old_lb     = lower[k];
+      f_t old_ub     = upper[k];
 
-        delta_min_act += (a_ik < 0) ? a_ik * old_ub : a_ik * old_lb;
-        delta_max_act += (a_ik > 0) ? a_ik * old_ub : a_ik * old_lb;
+      f_t delta_min_act = delta_min_activity[i];
+      f_t delta_max_act = delta_max_activity[i];
+      delta_min_act += (a_ik < 0) ? a_ik * old_ub : a_ik * old_lb;
+      delta_max_act += (a_ik > 0) ? a_ik * old_ub : a_ik * old_lb;
 
-        new_lb = std::max(new_lb, update_lb(old_lb, a_ik, delta_min_act, delta_max_act));
-        new_ub = std::min(new_ub, update_ub(old_ub, a_ik, delta_min_act, delta_max_act));
-      }
+      f_t new_lb = update_lb(old_lb, a_ik, delta_min_act, delta_max_act);
+      f_t new_ub = update_ub(old_ub, a_ik, delta_min_act, delta_max_act);
 
       // Integer rounding
       if (!var_types.empty() &&
           (var_types[k] == variable_type_t::INTEGER || var_types[k] == variable_type_t::BINARY)) {
-        new_lb = std::ceil(new_lb - settings.integer_tol);
-        new_ub = std::floor(new_ub + settings.integer_tol);
+        new_lb = std::max(old_lb, std::ceil(new_lb - settings.integer_tol));
+        new_ub = std::min(old_ub, std::floor(new_ub + settings.integer_tol));
       }
-
-      bool lb_updated = std::abs(new_lb - old_lb) > 1e3 * settings.primal_tol;
-      bool ub_updated = std::abs(new_ub - old_ub) > 1e3 * settings.primal_tol;
-
-      new_lb = std::max(new_lb, lower_bounds[k]);
-      new_ub = std::min(new_ub, upper_bounds[k]);
+      if (new_lb == old_lb && new_ub == old_ub) { continue; }
 
       if (new_lb > new_ub + settings.primal_tol) {
-        settings.log.debug(
-          "Iter:: %d, Infeasible variable after update %d, %e > %e\n", iter, k, new_lb, new_ub);
+        settings.log.debug("Infeasible variable after update %d, %e > %e\n", k, new_lb, new_ub);
+        clear_queue();
         last_nnz_processed = nnz_processed;
         return false;
       }
-      if (new_lb != old_lb || new_ub != old_ub) {
-        for (i_t p = col_start; p < col_end; ++p) {
-          const i_t i                = A.i[p];
-          constraint_changed_next[i] = true;
-        }
-      }
 
       lower[k] = std::min(new_lb, new_ub);
       upper[k] = std::max(new_lb, new_ub);
 
-      bool bounds_updated = lb_updated || ub_updated;
-      if (bounds_updated) { num_bounds_changed++; }
+      // Tiny changes are kept but not propagated further
+      const bool lb_updated = std::abs(new_lb - old_lb) > 1e3 * settings.primal_tol;
+      const bool ub_updated = std::abs(new_ub - old_ub) > 1e3 * settings.primal_tol;
+      if (lb_updated || ub_updated) {
+        push_column_rows(k, i, nnz_processed);
+        if (has_columns) { column_stack.push_back(k); }
+      }
+    }
+    if (has_columns && !propagate_columns(settings, nnz_processed)) {
+      clear_queue();
+      last_nnz_processed = nnz_processed;
+      return false;
     }
-
-    if (num_bounds_changed == 0) { break; }
-
-    std::swap(constraint_changed, constraint_changed_next);
-    std::fill(constraint_changed_next.begin(), constraint_changed_next.end(), false);
-    std::fill(variable_changed.begin(), variable_changed.end(), false);
-
-    iter++;
   }
+  clear_queue();
 
   // settings.log.printf("Total strengthened variables %d\n", total_strengthened_variables);
 
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <dual_simplex/conflict_pool.hpp>
 #include <dual_simplex/presolve.hpp>
+#include <dual_simplex/symmetry.hpp>
 
 namespace cuopt::linear_programming::dual_simplex {
 
@@ -27,12 +29,25 @@ class bounds_strengthening_t {
                             std::vector<f_t>& lower_bounds,
                             std::vector<f_t>& upper_bounds);
 
+  // The symmetry breaking orderings are propagated with the rows. They are only valid in the
+  // search tree, not for the bounds of the problem itself
+  void set_orderings(const symmetry_orderings_t<i_t>* orderings_) { orderings = orderings_; }
+
+  // The conflicts of the pool are propagated the same way. New conflicts are copied from the pool
+  // at the start of each call
+  void set_conflict_pool(const conflict_pool_t<i_t, f_t>* conflict_pool_)
+  {
+    conflict_pool = conflict_pool_;
+  }
+
   size_t last_nnz_processed{0};
 
  private:
   const csc_matrix_t<i_t, f_t>& A;
   const csr_matrix_t<i_t, f_t>& Arow;
   const std::vector<variable_type_t>& var_types;
+  const symmetry_orderings_t<i_t>* orderings{nullptr};
+  const conflict_pool_t<i_t, f_t>* conflict_pool{nullptr};
 
   std::vector<f_t> lower;
   std::vector<f_t> upper;
@@ -41,5 +56,33 @@ class bounds_strengthening_t {
   std::vector<f_t> delta_max_activity;
   std::vector<f_t> constraint_lb;
   std::vector<f_t> constraint_ub;
+
+  // Rows waiting to be propagated, as a ring of num_rows entries
+  std::vector<i_t> row_queue;
+  std::vector<char> row_in_queue;
+  size_t queue_head{0};
+  size_t queue_size{0};
+
+  // Columns whose orderings and conflicts are waiting to be propagated
+  std::vector<i_t> column_stack;
+
+  // The conflicts copied from the pool, and the conflicts of each column
+  std::vector<i_t> conflict_start{0};
+  std::vector<conflict_literal_t<i_t, f_t>> conflict_literals;
+  std::vector<std::vector<i_t>> column_conflicts;
+
+  void push_row(i_t i);
+  i_t pop_row();
+  void clear_queue();
+  void push_column_rows(i_t j, i_t skip_row, size_t& nnz_processed);
+  void copy_conflicts();
+  bool propagate_orderings(i_t j,
+                           const simplex_solver_settings_t<i_t, f_t>& settings,
+                           size_t& nnz_processed);
+  bool propagate_conflicts(i_t j,
+                           const simplex_solver_settings_t<i_t, f_t>& settings,
+                           size_t& nnz_processed);
+  bool propagate_columns(const simplex_solver_settings_t<i_t, f_t>& settings,
+                         size_t& nnz_processed);
 };
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,123 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/conflict_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::activate(const std::vector<f_t>& lower,
+                                         const std::vector<f_t>& upper)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  global_lower_ = lower;
+  global_upper_ = upper;
+  starts_.assign(1, 0);
+  literals_.clear();
+  num_conflicts_.store(0, std::memory_order_release);
+  active_ = true;
+}
+
+template <typename i_t, typename f_t>
+bool conflict_pool_t<i_t, f_t>::analyze(const lp_problem_t<i_t, f_t>& node_problem,
+                                        const std::vector<f_t>& y,
+                                        const std::vector<variable_type_t>& var_types,
+                                        f_t cutoff,
+                                        const simplex_solver_settings_t<i_t, f_t>& settings)
+{
+  if (!active_ || !std::isfinite(cutoff) || size() >= max_conflicts) { return false; }
+  const csc_matrix_t<i_t, f_t>& A = node_problem.A;
+  const i_t m                     = node_problem.num_rows;
+  const i_t n                     = node_problem.num_cols;
+  if (static_cast<i_t>(y.size()) != m || static_cast<i_t>(global_lower_.size()) != n) {
+    return false;
+  }
+
+  // For any x with Ax = b, c'x = y'b + z'x where z = c - A'y. Any multipliers y give a bound, so
+  // the ones the LP stopped with are fine even when it did not reach optimality
+  f_t bound = 0.0;
+  for (i_t i = 0; i < m; ++i) {
+    bound += y[i] * node_problem.rhs[i];
+  }
+  // The tightened bounds of the integer variables, with their contribution to the bound
+  std::vector<std::tuple<f_t, i_t, bool>> candidates;
+  for (i_t j = 0; j < n; ++j) {
+    f_t z_j = node_problem.objective[j];
+    for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+      z_j -= A.x[p] * y[A.i[p]];
+    }
+    if (z_j == 0.0) { continue; }
+    const bool is_lower     = z_j > 0.0;
+    const f_t node_bound    = is_lower ? node_problem.lower[j] : node_problem.upper[j];
+    const f_t global_bound  = is_lower ? global_lower_[j] : global_upper_[j];
+    const bool is_tightened = is_lower ? node_bound > global_bound : node_bound < global_bound;
+    if (!std::isfinite(node_bound)) { return false; }
+    if (!is_tightened) {
+      bound += z_j * node_bound;
+    } else if (var_types[j] == variable_type_t::CONTINUOUS) {
+      if (!std::isfinite(global_bound)) { return false; }
+      bound += z_j * global_bound;
+    } else {
+      bound += z_j * node_bound;
+      const f_t contribution = std::isfinite(global_bound)
+                                 ? z_j * (node_bound - global_bound)
+                                 : std::numeric_limits<f_t>::infinity();
+      candidates.emplace_back(contribution, j, is_lower);
+    }
+  }
+
+  const f_t margin = 1e-6 * std::max(f_t(1), std::abs(cutoff));
+  if (!(bound > cutoff + margin)) { return false; }
+
+  std::sort(candidates.begin(), candidates.end());
+  size_t first = 0;
+  for (; first < candidates.size(); ++first) {
+    const f_t contribution = std::get<0>(candidates[first]);
+    if (!std::isfinite(contribution) || bound - contribution <= cutoff + margin) { break; }
+    bound -= contribution;
+  }
+  const size_t num_literals = candidates.size() - first;
+  // Without literals the global bounds alone prove the cutoff, which the root bound already shows
+  if (num_literals == 0 || num_literals > static_cast<size_t>(max_literals)) { return false; }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const i_t num_conflicts = num_conflicts_.load(std::memory_order_relaxed);
+  if (num_conflicts >= max_conflicts) { return false; }
+  for (size_t k = first; k < candidates.size(); ++k) {
+    const auto [contribution, j, is_lower] = candidates[k];
+    literals_.push_back({j, is_lower, is_lower ? node_problem.lower[j] : node_problem.upper[j]});
+  }
+  starts_.push_back(static_cast<i_t>(literals_.size()));
+  num_conflicts_.store(num_conflicts + 1, std::memory_order_release);
+  settings.log.debug("Conflict %d with %d literals\n", num_conflicts, int(num_literals));
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::copy(i_t first,
+                                     std::vector<i_t>& starts,
+                                     std::vector<conflict_literal_t<i_t, f_t>>& literals) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const i_t num_conflicts = num_conflicts_.load(std::memory_order_relaxed);
+  for (i_t c = first; c < num_conflicts; ++c) {
+    literals.insert(
+      literals.end(), literals_.begin() + starts_[c], literals_.begin() + starts_[c + 1]);
+    starts.push_back(static_cast<i_t>(literals.size()));
+  }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class conflict_pool_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,77 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// x[j] >= bound when is_lower, x[j] <= bound otherwise
+template <typename i_t, typename f_t>
+struct conflict_literal_t {
+  i_t j;
+  bool is_lower;
+  f_t bound;
+};
+
+// Conflicts found at the pruned nodes of branch-and-bound, shared by its workers.
+//
+// A conflict is a set of bounds on integer variables under which no solution improves on the
+// incumbent of the time: the Lagrangian bound of the node, with the row multipliers of its LP,
+// already exceeds the cutoff on these bounds alone. The other bounds are relaxed to the global
+// ones, the smallest contributions first, which keeps the conflicts short. As the cutoff only
+// decreases, a conflict stays valid for the rest of the search.
+//
+// The pool only grows, up to max_conflicts. The node bound strengthening copies the new conflicts
+// and propagates them: a node with all the literals of a conflict is pruned, and a node with all
+// but one gets the opposite of the last.
+template <typename i_t, typename f_t>
+class conflict_pool_t {
+ public:
+  static constexpr i_t max_conflicts = 10000;
+  static constexpr i_t max_literals  = 32;
+
+  // Starts collecting conflicts relative to these bounds, the ones of the search tree root
+  void activate(const std::vector<f_t>& lower, const std::vector<f_t>& upper);
+  bool active() const { return active_; }
+
+  // Derives a conflict from the multipliers y of the rows of a node problem that has no solution
+  // with an objective of cutoff or less. Returns true when a conflict was added
+  bool analyze(const lp_problem_t<i_t, f_t>& node_problem,
+               const std::vector<f_t>& y,
+               const std::vector<variable_type_t>& var_types,
+               f_t cutoff,
+               const simplex_solver_settings_t<i_t, f_t>& settings);
+
+  i_t size() const { return num_conflicts_.load(std::memory_order_acquire); }
+
+  // Appends the conflicts first to size() - 1 to starts and literals, where starts holds the
+  // offsets of the conflicts in literals, and its last entry the end of the last one
+  void copy(i_t first,
+            std::vector<i_t>& starts,
+            std::vector<conflict_literal_t<i_t, f_t>>& literals) const;
+
+ private:
+  std::vector<f_t> global_lower_;
+  std::vector<f_t> global_upper_;
+  bool active_{false};
+
+  mutable std::mutex mutex_;
+  std::vector<i_t> starts_{0};
+  std::vector<conflict_literal_t<i_t, f_t>> literals_;
+  std::atomic<i_t> num_conflicts_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
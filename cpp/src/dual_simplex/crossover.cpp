@@ -17,12 +17,38 @@
 
 #include <raft/core/nvtx.hpp>
 
+#include <algorithm>
 #include <array>
 
 namespace cuopt::linear_programming::dual_simplex {
 
 namespace {
 
+// Where the time of a push phase goes, printed once the phase completes
+struct push_timers_t {
+  double solve{0.0};
+  double pricing{0.0};
+  double ratio_test{0.0};
+  double update{0.0};
+  double refactor{0.0};
+  int num_refactors{0};
+
+  template <typename i_t, typename f_t>
+  void print(const simplex_solver_settings_t<i_t, f_t>& settings, const char* phase) const
+  {
+    settings.log.printf(
+      "%s push time: solves %.2fs, pricing %.2fs, ratio test %.2fs, updates %.2fs, refactors %.2fs "
+      "(%d)\n",
+      phase,
+      solve,
+      pricing,
+      ratio_test,
+      update,
+      refactor,
+      num_refactors);
+  }
+};
+
 crossover_status_t return_to_status(int status)
 {
   if (status == TIME_LIMIT_RETURN) {
@@ -387,6 +413,21 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
   std::vector<f_t>& y       = solution.y;
   const std::vector<f_t>& x = solution.x;
   i_t num_pushes            = 0;
+  push_timers_t timers;
+
+  // delta_zN is computed row-wise from the sparse delta_y unless delta_y is dense, so a push only
+  // touches the rows of A it needs instead of every nonbasic column
+  csc_matrix_t<i_t, f_t> A_transpose(1, 1, 0);
+  lp.A.transpose(A_transpose, settings.num_threads);
+  std::vector<i_t> nonbasic_position(n, -1);
+  for (i_t k = 0; k < n - m; ++k) {
+    nonbasic_position[nonbasic_list[k]] = k;
+  }
+  std::vector<f_t> delta_y(m, 0.0);
+  std::vector<f_t> delta_zN(n - m, 0.0);
+  std::vector<i_t> delta_zN_mark(n - m, 0);
+  std::vector<i_t> delta_zN_indices;
+  delta_zN_indices.reserve(n - m);
   while (superbasic_list.size() > 0) {
     const i_t s                   = superbasic_list.back();
     const i_t basic_leaving_index = superbasic_list_index.back();
@@ -401,11 +442,11 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
     es_sparse.x[0] = -delta_zs;
 
     // B^T delta_y = -delta_zs*es
-    std::vector<f_t> delta_y(m);
+    f_t solve_start = tic();
     sparse_vector_t<i_t, f_t> delta_y_sparse(m, 1);
     sparse_vector_t<i_t, f_t> UTsol_sparse(m, 1);
     ft.b_transpose_solve(es_sparse, delta_y_sparse, UTsol_sparse);
-    delta_y_sparse.scatter(delta_y);
+    timers.solve += toc(solve_start);
 
     // We solved B^T delta_y = -delta_zs*es, but for the update we need
     // U^T*etilde = es.
@@ -416,33 +457,72 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
     }
 
     // delta_zN = -N^T delta_y
-    std::vector<f_t> delta_zN(n - m);
-    for (i_t k = 0; k < n - m; ++k) {
-      const i_t j         = nonbasic_list[k];
-      const i_t col_start = lp.A.col_start[j];
-      const i_t col_end   = lp.A.col_start[j + 1];
-      f_t dot             = 0.0;
-      for (i_t p = col_start; p < col_end; ++p) {
-        dot += lp.A.x[p] * delta_y[lp.A.i[p]];
+    f_t pricing_start    = tic();
+    i_t delta_y_nz       = 0;
+    const i_t nz_delta_y = delta_y_sparse.i.size();
+    for (i_t k = 0; k < nz_delta_y; ++k) {
+      if (std::abs(delta_y_sparse.x[k]) > 1e-12) { delta_y_nz++; }
+    }
+    const bool use_transpose = delta_y_nz <= 0.3 * m;
+    delta_zN_indices.clear();
+    if (use_transpose) {
+      for (i_t q = 0; q < nz_delta_y; ++q) {
+        const i_t i         = delta_y_sparse.i[q];
+        const f_t delta_y_i = delta_y_sparse.x[q];
+        if (std::abs(delta_y_i) < 1e-12) { continue; }
+        const i_t row_start = A_transpose.col_start[i];
+        const i_t row_end   = A_transpose.col_start[i + 1];
+        for (i_t p = row_start; p < row_end; ++p) {
+          const i_t k = nonbasic_position[A_transpose.i[p]];
+          if (k < 0) { continue; }
+          delta_zN[k] -= delta_y_i * A_transpose.x[p];
+          if (!delta_zN_mark[k]) {
+            delta_zN_mark[k] = 1;
+            delta_zN_indices.push_back(k);
+          }
+        }
+      }
+    } else {
+      delta_y_sparse.scatter(delta_y);
+      for (i_t k = 0; k < n - m; ++k) {
+        const i_t j         = nonbasic_list[k];
+        const i_t col_start = lp.A.col_start[j];
+        const i_t col_end   = lp.A.col_start[j + 1];
+        f_t dot             = 0.0;
+        for (i_t p = col_start; p < col_end; ++p) {
+          dot += lp.A.x[p] * delta_y[lp.A.i[p]];
+        }
+        delta_zN[k] = -dot;
+        if (dot != 0.0) {
+          delta_zN_mark[k] = 1;
+          delta_zN_indices.push_back(k);
+        }
+      }
+      for (i_t q = 0; q < nz_delta_y; ++q) {
+        delta_y[delta_y_sparse.i[q]] = 0.0;
       }
-      delta_zN[k] = -dot;
     }
+    timers.pricing += toc(pricing_start);
 
+    f_t ratio_start             = tic();
     i_t entering_index          = -1;
     i_t nonbasic_entering_index = -1;
     f_t step_length             = dual_ratio_test(
       lp, settings, nonbasic_list, vstatus, z, delta_zN, entering_index, nonbasic_entering_index);
     assert(step_length >= -1e-6);
+    timers.ratio_test += toc(ratio_start);
 
     // y <- y + step_length * delta_y
-    for (i_t i = 0; i < m; ++i) {
-      y[i] += step_length * delta_y[i];
+    for (i_t q = 0; q < nz_delta_y; ++q) {
+      y[delta_y_sparse.i[q]] += step_length * delta_y_sparse.x[q];
     }
 
-    // z <- z + step_length * delta z
-    for (i_t k = 0; k < n - m; ++k) {
+    // z <- z + step_length * delta z, clearing delta z for the next push
+    for (i_t k : delta_zN_indices) {
       const i_t j = nonbasic_list[k];
       z[j] += step_length * delta_zN[k];
+      delta_zN[k]      = 0.0;
+      delta_zN_mark[k] = 0;
     }
     z[s] += step_length * delta_zs;
 
@@ -453,6 +533,8 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
       assert(basic_list[basic_leaving_index] == s);
       basic_list[basic_leaving_index]        = entering_index;
       nonbasic_list[nonbasic_entering_index] = s;
+      nonbasic_position[entering_index]      = -1;
+      nonbasic_position[s]                   = nonbasic_entering_index;
       // Set vstatus
       vstatus[entering_index] = variable_status_t::BASIC;
       const f_t lower_slack   = x[s] - lp.lower[s];
@@ -488,6 +570,7 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
       // Refactor or Update
       bool should_refactor = ft.num_updates() > settings.refactor_frequency;
       if (!should_refactor) {
+        f_t update_start = tic();
         sparse_vector_t<i_t, f_t> abar_sparse(lp.A, entering_index);
         sparse_vector_t<i_t, f_t> utilde_sparse(m, 1);
         // permute abar_sparse and store in utilde_sparse
@@ -495,9 +578,11 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
         ft.l_solve(utilde_sparse);
         i_t recommend_refactor = ft.update(utilde_sparse, UTsol_sparse, basic_leaving_index);
         should_refactor        = recommend_refactor == 1;
+        timers.update += toc(update_start);
       }
 
       if (should_refactor) {
+        f_t refactor_start = tic();
         csc_matrix_t<i_t, f_t> L(m, m, 1);
         csc_matrix_t<i_t, f_t> U(m, m, 1);
         std::vector<i_t> p(m);
@@ -569,7 +654,14 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
             superbasic_list_index.push_back(k);
           }
         }
+        // Basis repair may have swapped nonbasic variables
+        std::fill(nonbasic_position.begin(), nonbasic_position.end(), -1);
+        for (i_t k = 0; k < n - m; ++k) {
+          nonbasic_position[nonbasic_list[k]] = k;
+        }
         ft.reset(L, U, p);
+        timers.refactor += toc(refactor_start);
+        timers.num_refactors++;
       }
 
     } else {
@@ -591,6 +683,7 @@ i_t dual_push(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
+  timers.print(settings, "Dual");
   verify_basis<i_t, f_t>(m, n, vstatus);
 
   std::vector<f_t> y_test;
@@ -735,15 +828,18 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
   f_t last_print_time         = tic();
   const i_t total_superbasics = superbasic_list.size();
   i_t num_pushes              = 0;
+  push_timers_t timers;
   while (superbasic_list.size() > 0) {
     const i_t s = superbasic_list.back();
 
     // Load A(:, s) into As
+    f_t solve_start = tic();
     sparse_vector_t<i_t, f_t> As_sparse(lp.A, s);
     sparse_vector_t<i_t, f_t> w_sparse(m, 0);
     sparse_vector_t<i_t, f_t> utilde_sparse(m, 0);
     // Solve B*w = As, w = -delta_xB/delta_xs
     ft.b_solve(As_sparse, w_sparse, utilde_sparse);
+    timers.solve += toc(solve_start);
 #ifdef CHECK_RESIDUAL
     {
       std::vector<f_t> w(m);
@@ -760,6 +856,7 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
 #endif
 
     // Perform two ratio tests
+    f_t ratio_start = tic();
     std::array<sparse_vector_t<i_t, f_t>, 2> delta_xB_trials;
     std::array<f_t, 2> delta_xs_trials;
     std::array<f_t, 2> step_length_trials;
@@ -800,6 +897,7 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
 
     if (best == -1) { best = step_length_trials[0] > step_length_trials[1] ? 0 : 1; }
     assert(best != -1);
+    timers.ratio_test += toc(ratio_start);
 
     f_t delta_xs                        = delta_xs_trials[best];
     sparse_vector_t<i_t, f_t>& delta_xB = delta_xB_trials[best];
@@ -863,8 +961,9 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
       superbasic_list.pop_back();  // Remove superbasic variable
 
       // Refactor or Update
-      bool should_refactor = ft.num_updates() > 100;
+      bool should_refactor = ft.num_updates() > settings.refactor_frequency;
       if (!should_refactor) {
+        f_t update_start = tic();
         sparse_vector_t<i_t, f_t> es_sparse(m, 1);
         es_sparse.i[0] = basic_leaving_index;
         es_sparse.x[0] = 1.0;
@@ -873,9 +972,11 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
         ft.b_transpose_solve(es_sparse, solution_sparse, UTsol_sparse);
         i_t recommend_refactor = ft.update(utilde_sparse, UTsol_sparse, basic_leaving_index);
         should_refactor        = recommend_refactor == 1;
+        timers.update += toc(update_start);
       }
 
       if (should_refactor) {
+        f_t refactor_start = tic();
         csc_matrix_t<i_t, f_t> L(m, m, 1);
         csc_matrix_t<i_t, f_t> U(m, m, 1);
         std::vector<i_t> p(m);
@@ -938,6 +1039,8 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
         }
         reorder_basic_list(q, basic_list);
         ft.reset(L, U, p);
+        timers.refactor += toc(refactor_start);
+        timers.num_refactors++;
       }
     } else {
       // Move superbasic variable into the nonbasic variables
@@ -969,6 +1072,7 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
+  timers.print(settings, "Primal");
   verify_basis<i_t, f_t>(m, n, vstatus);
 
   // Solve for xB such that B*xB = b - N*xN
@@ -1331,9 +1435,11 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
   basis_update_mpf_t ft(L, U, p, settings.refactor_frequency);
   verify_basis<i_t, f_t>(m, n, vstatus);
   compare_vstatus_with_lists<i_t, f_t>(m, n, basic_list, nonbasic_list, vstatus);
-  i_t dual_push_status = dual_push(
+  const f_t dual_push_start = tic();
+  i_t dual_push_status      = dual_push(
     lp, settings, start_time, solution, ft, basic_list, nonbasic_list, superbasic_list, vstatus);
   if (dual_push_status < 0) { return return_to_status(dual_push_status); }
+  const f_t dual_push_time = toc(dual_push_start);
   settings.log.debug("basic list size %ld m %d\n", basic_list.size(), m);
   settings.log.debug("nonbasic list size %ld n - m %d\n", nonbasic_list.size(), n - m);
   print_crossover_info(lp, settings, vstatus, solution, "Dual push complete");
@@ -1341,6 +1447,7 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
   find_primal_superbasic_variables(
     lp, settings, initial_solution, solution, vstatus, nonbasic_list, superbasic_list);
 
+  const f_t primal_push_start = tic();
   if (superbasic_list.size() > 0) {
     std::vector<f_t> save_x = solution.x;
     i_t primal_push_status  = primal_push(
@@ -1351,6 +1458,8 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
   } else {
     settings.log.printf("No primal push needed. No superbasic variables\n");
   }
+  const f_t primal_push_time = toc(primal_push_start);
+  const f_t clean_up_start   = tic();
 
   f_t primal_infeas = primal_infeasibility(lp, settings, vstatus, solution.x);
   f_t dual_infeas   = dual_infeasibility(lp, settings, vstatus, solution.z);
@@ -1559,7 +1668,12 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
-  settings.log.printf("Crossover time %.2f seconds\n", toc(crossover_start));
+  settings.log.printf(
+    "Crossover time %.2f seconds (dual push %.2fs, primal push %.2fs, clean up %.2fs)\n",
+    toc(crossover_start),
+    dual_push_time,
+    primal_push_time,
+    toc(clean_up_start));
   settings.log.printf("Total time %.2f seconds\n", toc(start_time));
 
   crossover_status_t status = crossover_status_t::NUMERICAL_ISSUES;
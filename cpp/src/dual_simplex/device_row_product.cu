@@ -0,0 +1,63 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/device_row_product.hpp>
+
+#include <barrier/cusparse_view.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cassert>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+struct device_row_product_t<i_t, f_t>::impl_t {
+  impl_t(raft::handle_t const* handle_ptr, const csc_matrix_t<i_t, f_t>& A)
+    : handle_ptr(handle_ptr),
+      view(handle_ptr, A),
+      y(A.m, handle_ptr->get_stream()),
+      z(A.n, handle_ptr->get_stream())
+  {
+  }
+
+  raft::handle_t const* handle_ptr;
+  cusparse_view_t<i_t, f_t> view;
+  rmm::device_uvector<f_t> y;
+  rmm::device_uvector<f_t> z;
+};
+
+template <typename i_t, typename f_t>
+device_row_product_t<i_t, f_t>::device_row_product_t(raft::handle_t const* handle_ptr,
+                                                     const csc_matrix_t<i_t, f_t>& A)
+  : impl_(std::make_unique<impl_t>(handle_ptr, A))
+{
+}
+
+template <typename i_t, typename f_t>
+device_row_product_t<i_t, f_t>::~device_row_product_t() = default;
+
+template <typename i_t, typename f_t>
+void device_row_product_t<i_t, f_t>::negative_transpose_multiply(const std::vector<f_t>& y,
+                                                                 std::vector<f_t>& z)
+{
+  assert(y.size() == impl_->y.size());
+  assert(z.size() == impl_->z.size());
+  auto stream = impl_->handle_ptr->get_stream();
+  raft::copy(impl_->y.data(), y.data(), y.size(), stream);
+  impl_->view.transpose_spmv(f_t(-1), impl_->y, f_t(0), impl_->z);
+  raft::copy(z.data(), impl_->z.data(), z.size(), stream);
+  impl_->handle_ptr->sync_stream();
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class device_row_product_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
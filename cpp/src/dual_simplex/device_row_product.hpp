@@ -0,0 +1,38 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/sparse_matrix.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Experimental: computes the row of the dual simplex, z = -A'*y, with cuSPARSE on a copy of A
+// kept on the GPU. Meant for the dense iterations of wide LPs, where the product dominates the
+// cost of an iteration. The products are issued on the stream of the handle, which must not be
+// used concurrently by another solve.
+template <typename i_t, typename f_t>
+class device_row_product_t {
+ public:
+  device_row_product_t(raft::handle_t const* handle_ptr, const csc_matrix_t<i_t, f_t>& A);
+  ~device_row_product_t();
+
+  // z = -A'*y, y has A.m entries and z A.n entries
+  void negative_transpose_multiply(const std::vector<f_t>& y, std::vector<f_t>& z);
+
+ private:
+  // Keeps the CUDA types out of the host translation units
+  struct impl_t;
+  std::unique_ptr<impl_t> impl_;
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -9,365 +9,384 @@
 
 #include <dual_simplex/tic_toc.hpp>
 
-#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 #include <random>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace cuopt::linear_programming::dual_simplex {
 
+constexpr int8_t kRow = 0;
+constexpr int8_t kCol = 1;
+
 template <typename i_t>
-struct color_t {
-  color_t(int8_t row_or_column, int8_t active, i_t color, std::vector<i_t> vertices)
-    : row_or_column(row_or_column),
-      active(active),
-      color(color),
-      vertices(vertices.begin(), vertices.end())
-  {
-  }
+struct vertex_range_t {
+  const i_t* begin() const { return first; }
+  const i_t* end() const { return last; }
+  size_t size() const { return static_cast<size_t>(last - first); }
+  const i_t* first;
+  const i_t* last;
+};
+
+template <typename i_t>
+struct color_view_t {
   int8_t row_or_column;
-  int8_t active;
   i_t color;
-  std::unordered_set<i_t> vertices;
+  vertex_range_t<i_t> vertices;
 };
 
-constexpr int8_t kRow      = 0;
-constexpr int8_t kCol      = 1;
-constexpr int8_t kActive   = 1;
-constexpr int8_t kInactive = 0;
+// Vertices of one side of the bipartite graph of the matrix, the rows or the columns
+template <typename i_t>
+struct side_coloring_t {
+  explicit side_coloring_t(i_t num_vertices, i_t initial_color)
+    : order(num_vertices), position(num_vertices), color_map(num_vertices, initial_color)
+  {
+    std::iota(order.begin(), order.end(), 0);
+    std::iota(position.begin(), position.end(), 0);
+  }
+  // The vertices grouped by color and the position of each vertex in order
+  std::vector<i_t> order;
+  std::vector<i_t> position;
+  std::vector<i_t> color_map;
+};
 
+// Coloring of the rows and columns held in flat arrays. Color c has the size[c] vertices of its
+// side starting at sides[side[c]].order[start[c]]. Colors are never emptied, so every color is
+// active and the colors are numbered 0, ..., num_colors() - 1.
 template <typename i_t>
-void find_vertices_to_refine(const std::unordered_set<i_t>& refining_color_vertices,
-                             const std::vector<i_t>& offset,
-                             const std::vector<i_t>& vertex_list,
-                             const std::vector<i_t>& color_map,
-                             std::vector<i_t>& marked_vertices,
-                             std::vector<i_t>& vertices_to_refine,
-                             std::vector<std::vector<i_t>>& vertices_to_refine_by_color,
-                             std::vector<i_t>& marked_colors,
-                             std::vector<i_t>& colors_to_update)
-{
-  for (i_t u : refining_color_vertices) {
-    const i_t start = offset[u];
-    const i_t end   = offset[u + 1];
-    for (i_t p = start; p < end; p++) {
-      const i_t v     = vertex_list[p];
-      const i_t color = color_map[v];
-      if (marked_vertices[v] == 0) {
-        marked_vertices[v] = 1;
-        vertices_to_refine.push_back(v);
-        vertices_to_refine_by_color[color].push_back(v);
-      }
-      if (marked_colors[color] == 0) {
-        marked_colors[color] = 1;
-        colors_to_update.push_back(color);
-      }
-    }
+struct coloring_t {
+  coloring_t(i_t m, i_t n) : sides{side_coloring_t<i_t>(m, 0), side_coloring_t<i_t>(n, 1)}
+  {
+    add_color(kRow, 0, m);
+    add_color(kCol, 0, n);
   }
-  for (i_t v : vertices_to_refine) {
-    marked_vertices[v] = 0;
+
+  i_t num_colors() const { return static_cast<i_t>(side.size()); }
+
+  vertex_range_t<i_t> vertices(i_t color) const
+  {
+    const i_t* first = sides[side[color]].order.data() + start[color];
+    return {first, first + size[color]};
   }
-  for (i_t color : colors_to_update) {
-    marked_colors[color] = 0;
+
+  color_view_t<i_t> operator[](i_t color) const { return {side[color], color, vertices(color)}; }
+
+  i_t add_color(int8_t color_side, i_t color_start, i_t color_size)
+  {
+    side.push_back(color_side);
+    start.push_back(color_start);
+    size.push_back(color_size);
+    return num_colors() - 1;
   }
-}
 
+  side_coloring_t<i_t> sides[2];
+  std::vector<int8_t> side;
+  std::vector<i_t> start;
+  std::vector<i_t> size;
+};
+
+// Neighbors of the vertices of a side and the weights of the edges: the CSR matrix for the rows
+// and the CSC matrix for the columns
 template <typename i_t, typename f_t>
-void compute_sums_of_refined_vertices(i_t refining_color,
-                                      const std::unordered_set<i_t>& refining_color_vertices,
-                                      const std::vector<i_t>& vertices_to_refine,
-                                      const std::vector<i_t>& offsets,
-                                      const std::vector<i_t>& vertex_list,
-                                      const std::vector<f_t>& weight_list,
-                                      const std::vector<i_t>& color_map,
-                                      std::vector<f_t>& vertex_to_sum,
-                                      std::vector<f_t>& max_sum_by_color)
-{
-  for (i_t v : refining_color_vertices) {
-    const i_t start = offsets[v];
-    const i_t end   = offsets[v + 1];
-    for (i_t p = start; p < end; p++) {
-      const i_t u = vertex_list[p];
-      vertex_to_sum[u] += weight_list[p];
-    }
-  }
+struct adjacency_t {
+  const std::vector<i_t>& offsets;
+  const std::vector<i_t>& neighbors;
+  const std::vector<f_t>& weights;
+};
 
-  for (i_t v : vertices_to_refine) {
-    const i_t c = color_map[v];
-    if (std::isnan(max_sum_by_color[c])) {
-      max_sum_by_color[c] = vertex_to_sum[v];
-    } else {
-      max_sum_by_color[c] = std::max(max_sum_by_color[c], vertex_to_sum[v]);
-    }
-  }
-}
+template <typename i_t, typename f_t>
+struct refinement_workspace_t {
+  explicit refinement_workspace_t(i_t max_vertices) : moving(max_vertices, 0) {}
+
+  std::vector<i_t> touched_colors;
+  // Per color: the number of dirty vertices and the next free slot of its group
+  std::vector<i_t> dirty_count;
+  std::vector<i_t> cursor;
+  // Vertices whose signature is computed, grouped by touched color. A group ends with the
+  // representative of the clean vertices of the color when it has any.
+  std::vector<i_t> work_vertices;
+  std::vector<i_t> group_start;
+  std::vector<int8_t> has_representative;
+  std::vector<i_t> num_runs;
+  // Indices into work_vertices, each group sorted by signature
+  std::vector<i_t> sorted;
+  // Signature of work_vertices[k]: signature_length[k] pairs of a neighbor color and the sum of
+  // the weights of the edges to it, by increasing color, starting at signature_start[k]
+  std::vector<int64_t> signature_start;
+  std::vector<i_t> signature_length;
+  std::vector<uint64_t> signature_hash;
+  std::vector<i_t> signature_colors;
+  std::vector<f_t> signature_sums;
+  std::vector<int8_t> moving;
+};
 
+// Computes the multiset of the colors of the neighbors of v, weighted by the edges, as the sorted
+// pairs (color, sum of the weights to the color). Returns the number of pairs.
 template <typename i_t, typename f_t>
-void compute_sums(const csc_matrix_t<i_t, f_t>& A,
-                  const csr_matrix_t<i_t, f_t>& Arow,
-                  i_t num_row_colors,
-                  i_t num_col_colors,
-                  i_t total_colors_seen,
-                  const std::vector<i_t>& row_color_map,
-                  const std::vector<i_t>& col_color_map,
-                  const color_t<i_t>& refining_color,
-                  std::vector<i_t>& colors_to_update,
-                  std::vector<i_t>& marked_colors,
-                  std::vector<i_t>& vertices_to_refine,
-                  std::vector<i_t>& marked_vertices,
-                  std::vector<std::vector<i_t>>& vertices_to_refine_by_color,
-                  std::vector<f_t>& vertex_to_sum,
-                  std::vector<f_t>& max_sum_by_color)
+i_t compute_signature(i_t v,
+                      const adjacency_t<i_t, f_t>& adjacency,
+                      const std::vector<i_t>& neighbor_color_map,
+                      std::vector<std::pair<i_t, f_t>>& entries,
+                      i_t* signature_colors,
+                      f_t* signature_sums,
+                      uint64_t& hash)
 {
-  i_t num_colors = num_row_colors + num_col_colors;
-  colors_to_update.clear();
-  vertices_to_refine.clear();
-  if (refining_color.row_or_column == kRow) {
-    // The refining color is a row color
-    // Find all vertices (columns) that have a neighbor in the refining color
-    colors_to_update.reserve(num_col_colors);
-    find_vertices_to_refine(refining_color.vertices,
-                            Arow.row_start,
-                            Arow.j,
-                            col_color_map,
-                            marked_vertices,
-                            vertices_to_refine,
-                            vertices_to_refine_by_color,
-                            marked_colors,
-                            colors_to_update);
-
-    // Let R be the refining color, R is a subset of the rows
-    // We need to compute
-    // sum_{v in R} A_vw for all w such that A_vw != 0
-    // Note that if A_vw != 0 and A_vw' != 0, we may
-    // have that w and w' are in a different (column) color
-    compute_sums_of_refined_vertices(refining_color.color,
-                                     refining_color.vertices,
-                                     vertices_to_refine,
-                                     Arow.row_start,
-                                     Arow.j,
-                                     Arow.x,
-                                     col_color_map,
-                                     vertex_to_sum,
-                                     max_sum_by_color);
-  } else {
-    // The refining color is a column color
-    // Find all vertices (rows) that have a neighbor in the refining color
-    colors_to_update.reserve(num_row_colors);
-    find_vertices_to_refine(refining_color.vertices,
-                            A.col_start,
-                            A.i,
-                            row_color_map,
-                            marked_vertices,
-                            vertices_to_refine,
-                            vertices_to_refine_by_color,
-                            marked_colors,
-                            colors_to_update);
-
-    // Let Q be the refining color, Q is a subset of the columns
-    // We need to compute
-    // sum_{w in Q} A_vw for all v such that A_vw != 0
-    // Note that if A_vw != 0 and A_v'w != 0, we may
-    // have that v and v' are in a different (row) color
-    compute_sums_of_refined_vertices(refining_color.color,
-                                     refining_color.vertices,
-                                     vertices_to_refine,
-                                     A.col_start,
-                                     A.i,
-                                     A.x,
-                                     row_color_map,
-                                     vertex_to_sum,
-                                     max_sum_by_color);
-  }
+  entries.clear();
+  for (i_t p = adjacency.offsets[v]; p < adjacency.offsets[v + 1]; p++) {
+    entries.emplace_back(neighbor_color_map[adjacency.neighbors[p]], adjacency.weights[p]);
+  }
+  // Sorting the weights of a color makes its sum independent of the order of the neighbors, so
+  // that vertices with the same weights to a color get bitwise equal sums
+  std::sort(entries.begin(), entries.end());
+
+  i_t length = 0;
+  hash       = 0;
+  for (size_t k = 0; k < entries.size();) {
+    const i_t color = entries[k].first;
+    f_t sum         = 0.0;
+    for (; k < entries.size() && entries[k].first == color; k++) {
+      sum += entries[k].second;
+    }
+    // A zero sum is the same as no neighbor in the color
+    if (sum == 0.0) { continue; }
+    signature_colors[length] = color;
+    signature_sums[length]   = sum;
+    length++;
+    uint64_t bits = 0;
+    std::memcpy(&bits, &sum, sizeof(f_t));
+    hash = hash_combine(hash_combine(hash, static_cast<uint64_t>(color)), bits);
+  }
+  return length;
 }
 
 template <typename i_t, typename f_t>
-i_t find_colors_to_split(const std::vector<i_t>& colors_to_update,
-                         const std::vector<color_t<i_t>>& colors,
-                         const std::vector<std::vector<i_t>>& vertices_to_refine_by_color,
-                         const std::vector<f_t>& vertex_to_sum,
-                         std::vector<f_t>& max_sum_by_color,
-                         std::vector<f_t>& min_sum_by_color,
-                         std::vector<i_t>& colors_to_split)
+int compare_signatures(const refinement_workspace_t<i_t, f_t>& work, i_t a, i_t b)
 {
-  for (i_t color : colors_to_update) {
-    min_sum_by_color[color] = max_sum_by_color[color];
-    for (i_t v : vertices_to_refine_by_color[color]) {
-      if (vertex_to_sum[v] < min_sum_by_color[color]) {
-        min_sum_by_color[color] = vertex_to_sum[v];
-      }
-    }
-
-    if (vertices_to_refine_by_color[color].size() != colors[color].vertices.size()) {
-      // We didn't touch all the vertices in the color. These vertices must have a sum of 0.0
-      if (0.0 > max_sum_by_color[color]) { max_sum_by_color[color] = 0.0; }
-      if (0.0 < min_sum_by_color[color]) { min_sum_by_color[color] = 0.0; }
-    } else {
-      // We touched all the vertices in the color. Compute the minimum sum seen
-    }
-  }
-
-  colors_to_split.clear();
-  for (i_t color : colors_to_update) {
-    if (max_sum_by_color[color] < min_sum_by_color[color]) {
-      printf("Color %d has max sum %e < min sum %e\n",
-             color,
-             max_sum_by_color[color],
-             min_sum_by_color[color]);
-      return -1;
-    }
-    if (min_sum_by_color[color] < max_sum_by_color[color]) { colors_to_split.push_back(color); }
+  if (work.signature_hash[a] != work.signature_hash[b]) {
+    return work.signature_hash[a] < work.signature_hash[b] ? -1 : 1;
+  }
+  const i_t length = work.signature_length[a];
+  if (length != work.signature_length[b]) { return length < work.signature_length[b] ? -1 : 1; }
+  const int64_t offset_a = work.signature_start[a];
+  const int64_t offset_b = work.signature_start[b];
+  for (i_t q = 0; q < length; q++) {
+    const i_t color_a = work.signature_colors[offset_a + q];
+    const i_t color_b = work.signature_colors[offset_b + q];
+    if (color_a != color_b) { return color_a < color_b ? -1 : 1; }
+    const f_t sum_a = work.signature_sums[offset_a + q];
+    const f_t sum_b = work.signature_sums[offset_b + q];
+    if (sum_a != sum_b) { return sum_a < sum_b ? -1 : 1; }
   }
   return 0;
 }
 
+// Splits color c by the signatures of its group of work vertices, whose sorted runs hold the
+// vertices of equal signature. The clean vertices of c belong to the run of their representative.
+// The largest run keeps color c, the others get new colors and their vertices are appended to
+// moved and moved to the end of the segment of c.
 template <typename i_t, typename f_t>
-i_t split_colors(i_t color,
-                 i_t refining_color,
-                 int8_t side_being_split,
-                 std::vector<f_t>& vertex_to_sum,
-                 std::map<f_t, std::vector<i_t>>& color_sums,
-                 std::map<f_t, i_t>& sum_to_sizes,
-                 std::vector<color_t<i_t>>& colors,
-                 std::vector<i_t>& color_stack,
-                 std::vector<i_t>& color_in_stack,
-                 std::vector<i_t>& color_map_B,
-                 std::vector<i_t>& marked_vertices,
-                 std::vector<std::vector<i_t>>& vertices_to_refine_by_color,
-                 std::vector<f_t>& min_sum_by_color,
-                 std::vector<f_t>& max_sum_by_color,
-                 i_t& num_colors,
-                 i_t& num_side_colors,
-                 i_t& total_colors_seen)
+void split_color(int8_t side,
+                 i_t t,
+                 const std::vector<int8_t>& is_dirty,
+                 coloring_t<i_t>& coloring,
+                 refinement_workspace_t<i_t, f_t>& work,
+                 std::vector<i_t>& moved)
 {
-  bool in_stack = color_in_stack[color];
-
-  sum_to_sizes.clear();
-  color_sums.clear();
-  for (i_t v : vertices_to_refine_by_color[color]) {
-    sum_to_sizes[vertex_to_sum[v]]++;
-  }
-  if (vertices_to_refine_by_color[color].size() != colors[color].vertices.size()) {
-    const i_t remaining_size =
-      colors[color].vertices.size() - vertices_to_refine_by_color[color].size();
-    if (remaining_size < 0) {
-      printf("Negative remaining size %d\n", remaining_size);
-
-      printf("Color %d vertices\n", color);
-      for (i_t v : colors[color].vertices) {
-        printf("Vertex %d\n", v);
+  side_coloring_t<i_t>& vertices = coloring.sides[side];
+  const i_t c                    = work.touched_colors[t];
+  const i_t first                = work.group_start[t];
+  const i_t last                 = work.group_start[t + 1];
+  const i_t representative       = work.has_representative[t] ? last - 1 : -1;
+  const i_t clean_count          = coloring.size[c] - work.dirty_count[c];
+  const i_t color_start          = coloring.start[c];
+  const i_t color_end            = color_start + coloring.size[c];
+
+  auto run_end = [&](i_t r, bool& holds_representative) {
+    holds_representative = work.sorted[r] == representative;
+    i_t e                = r + 1;
+    while (e < last && compare_signatures(work, work.sorted[r], work.sorted[e]) == 0) {
+      holds_representative |= work.sorted[e] == representative;
+      e++;
+    }
+    return e;
+  };
+
+  i_t kept_run  = -1;
+  i_t kept_size = -1;
+  for (i_t r = first; r < last;) {
+    bool holds_representative = false;
+    const i_t e               = run_end(r, holds_representative);
+    const i_t run_size        = e - r + (holds_representative ? clean_count - 1 : 0);
+    if (run_size > kept_size) {
+      kept_size = run_size;
+      kept_run  = r;
+    }
+    r = e;
+  }
+
+  const size_t moved_begin = moved.size();
+  i_t next_start           = color_end - (coloring.size[c] - kept_size);
+  for (i_t r = first; r < last;) {
+    bool holds_representative = false;
+    const i_t e               = run_end(r, holds_representative);
+    if (r != kept_run) {
+      const i_t run_size  = e - r + (holds_representative ? clean_count - 1 : 0);
+      const i_t new_color = coloring.add_color(side, next_start, run_size);
+      next_start += run_size;
+      for (i_t q = r; q < e; q++) {
+        if (work.sorted[q] == representative) { continue; }
+        const i_t v           = work.work_vertices[work.sorted[q]];
+        vertices.color_map[v] = new_color;
+        moved.push_back(v);
       }
-      printf("Vertices to refine by color %d\n", color);
-      for (i_t v : vertices_to_refine_by_color[color]) {
-        printf("Vertex %d\n", v);
+      if (holds_representative) {
+        for (i_t p = color_start; p < color_end; p++) {
+          const i_t v = vertices.order[p];
+          if (is_dirty[v]) { continue; }
+          vertices.color_map[v] = new_color;
+          moved.push_back(v);
+        }
       }
-      return -1;
-    }
-    sum_to_sizes[0.0] += remaining_size;
-    if (color_sums.count(0.0) == 0) { color_sums[0.0] = std::vector<i_t>(); }
-  }
-
-  i_t max_size = -1;
-  f_t max_sum  = std::numeric_limits<f_t>::quiet_NaN();
-  for (auto& [sum, size] : sum_to_sizes) {
-    if (size > max_size) {
-      max_size = size;
-      max_sum  = sum;
     }
-  }
-
-  for (i_t v : vertices_to_refine_by_color[color]) {
-    color_sums[vertex_to_sum[v]].push_back(v);
-  }
-  bool only_one = sum_to_sizes.size() == 1;
-  if (only_one) {
-    printf("Color %d has only one sum. color_sums size %ld. In stack %d\n",
-           color,
-           color_sums.size(),
-           in_stack);
-    return -1;
-  }
-
-  // Paige-Tarjan O(n log n) optimization:
-  // The largest part keeps the original color id and inherits its stack slot.
-  // All other parts (smaller) become new colors and are added to the stack.
-
-  bool largest_is_sum_zero    = (max_sum == 0.0);
-  bool adjust_color_sums_zero = !largest_is_sum_zero && color_sums.count(0.0) > 0;
+    r = e;
+  }
+
+  // Swap the moved vertices before the tail of the segment with the staying vertices of the tail,
+  // then lay the tail out in the order of the new colors
+  const i_t num_moved = static_cast<i_t>(moved.size() - moved_begin);
+  const i_t tail      = color_end - num_moved;
+  for (size_t q = moved_begin; q < moved.size(); q++) {
+    work.moving[moved[q]] = 1;
+  }
+  i_t p = tail;
+  for (size_t q = moved_begin; q < moved.size(); q++) {
+    const i_t v = moved[q];
+    if (vertices.position[v] >= tail) { continue; }
+    while (work.moving[vertices.order[p]]) {
+      p++;
+    }
+    const i_t u                          = vertices.order[p];
+    vertices.order[vertices.position[v]] = u;
+    vertices.position[u]                 = vertices.position[v];
+    vertices.order[p]                    = v;
+    vertices.position[v]                 = p;
+  }
+  for (size_t q = moved_begin; q < moved.size(); q++) {
+    const i_t v              = moved[q];
+    const i_t position       = tail + static_cast<i_t>(q - moved_begin);
+    vertices.order[position] = v;
+    vertices.position[v]     = position;
+    work.moving[v]           = 0;
+  }
+  coloring.size[c] = kept_size;
+}
 
-  // Collect sum==0.0 vertices in colors[color].vertices but not in vertices_to_refine_by_color
-  if (adjust_color_sums_zero) {
-    for (i_t v : color_sums[0.0]) {
-      vertex_to_sum[v] = std::numeric_limits<f_t>::quiet_NaN();
-    }
-    for (i_t v : colors[color].vertices) {
-      if (vertex_to_sum[v] == 0.0) { color_sums[0.0].push_back(v); }
+// One round of color refinement of a side. The colors holding a dirty vertex are split by the
+// signatures of their vertices with respect to the colors of the other side. A clean vertex has
+// not seen a neighbor change color since the last round of its side, so that the clean vertices
+// of a color still share a signature and only one of them is computed. The signatures are
+// computed and sorted in parallel. The vertices that changed color are returned in moved.
+template <typename i_t, typename f_t>
+void refine_side(int8_t side,
+                 const adjacency_t<i_t, f_t>& adjacency,
+                 i_t num_threads,
+                 coloring_t<i_t>& coloring,
+                 std::vector<i_t>& dirty,
+                 std::vector<int8_t>& is_dirty,
+                 refinement_workspace_t<i_t, f_t>& work,
+                 std::vector<i_t>& moved)
+{
+  side_coloring_t<i_t>& vertices             = coloring.sides[side];
+  const std::vector<i_t>& neighbor_color_map = coloring.sides[1 - side].color_map;
+  moved.clear();
+  work.dirty_count.resize(coloring.num_colors(), 0);
+  work.cursor.resize(coloring.num_colors(), 0);
+
+  work.touched_colors.clear();
+  for (i_t v : dirty) {
+    const i_t c = vertices.color_map[v];
+    if (work.dirty_count[c]++ == 0) { work.touched_colors.push_back(c); }
+  }
+  const i_t num_touched = static_cast<i_t>(work.touched_colors.size());
+  work.group_start.assign(num_touched + 1, 0);
+  work.has_representative.assign(num_touched, 0);
+  for (i_t t = 0; t < num_touched; t++) {
+    const i_t c                = work.touched_colors[t];
+    work.has_representative[t] = work.dirty_count[c] < coloring.size[c];
+    work.cursor[c]             = work.group_start[t];
+    work.group_start[t + 1] =
+      work.group_start[t] + work.dirty_count[c] + work.has_representative[t];
+  }
+  const i_t num_work = work.group_start[num_touched];
+  work.work_vertices.resize(num_work);
+  for (i_t v : dirty) {
+    work.work_vertices[work.cursor[vertices.color_map[v]]++] = v;
+  }
+  for (i_t t = 0; t < num_touched; t++) {
+    if (!work.has_representative[t]) { continue; }
+    // At most dirty_count vertices are scanned before a clean one
+    i_t p = coloring.start[work.touched_colors[t]];
+    while (is_dirty[vertices.order[p]]) {
+      p++;
+    }
+    work.work_vertices[work.group_start[t + 1] - 1] = vertices.order[p];
+  }
+
+  work.signature_start.resize(num_work + 1);
+  work.signature_start[0] = 0;
+  for (i_t k = 0; k < num_work; k++) {
+    const i_t v                 = work.work_vertices[k];
+    work.signature_start[k + 1] =
+      work.signature_start[k] + adjacency.offsets[v + 1] - adjacency.offsets[v];
+  }
+  work.signature_length.resize(num_work);
+  work.signature_hash.resize(num_work);
+  work.signature_colors.resize(work.signature_start[num_work]);
+  work.signature_sums.resize(work.signature_start[num_work]);
+#pragma omp parallel num_threads(num_threads)
+  {
+    std::vector<std::pair<i_t, f_t>> entries;
+#pragma omp for schedule(dynamic, 256)
+    for (i_t k = 0; k < num_work; k++) {
+      const int64_t offset     = work.signature_start[k];
+      work.signature_length[k] = compute_signature(work.work_vertices[k],
+                                                   adjacency,
+                                                   neighbor_color_map,
+                                                   entries,
+                                                   work.signature_colors.data() + offset,
+                                                   work.signature_sums.data() + offset,
+                                                   work.signature_hash[k]);
     }
   }
 
-  i_t vertices_considered = 0;
-  for (auto& [sum, vertices] : color_sums) {
-    i_t size = vertices.size();
-
-    if (sum == 0.0) {
-      i_t additional_size =
-        colors[color].vertices.size() - vertices_to_refine_by_color[color].size();
-      if (!adjust_color_sums_zero) { size += additional_size; }
-    }
-
-    bool is_largest = (sum == max_sum && size == max_size);
-    vertices_considered += size;
-
-    if (is_largest) {
-      // Largest part keeps the original color id and inherits its stack slot, so it is not added to
-      // the stack
-      continue;
-    }
-
-    colors.emplace_back(side_being_split, kActive, total_colors_seen, vertices);
-
-    // All non-largest parts are added to the stack
-    color_stack.push_back(total_colors_seen);
-    color_in_stack[total_colors_seen] = 1;
-
-    for (i_t v : vertices) {
-      color_map_B[v] = total_colors_seen;
+  work.sorted.resize(num_work);
+  std::iota(work.sorted.begin(), work.sorted.end(), 0);
+  work.num_runs.resize(num_touched);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 16)
+  for (i_t t = 0; t < num_touched; t++) {
+    auto first = work.sorted.begin() + work.group_start[t];
+    auto last  = work.sorted.begin() + work.group_start[t + 1];
+    std::sort(first, last, [&](i_t a, i_t b) { return compare_signatures(work, a, b) < 0; });
+    i_t runs = 1;
+    for (auto it = first + 1; it < last; ++it) {
+      if (compare_signatures(work, *(it - 1), *it) != 0) { runs++; }
     }
-
-    total_colors_seen++;
-    num_colors++;
-    num_side_colors++;
+    work.num_runs[t] = runs;
   }
 
-  if (vertices_considered != colors[color].vertices.size()) {
-    printf("Vertices considered %d does not match color size %ld\n",
-           vertices_considered,
-           colors[color].vertices.size());
-    return -1;
+  for (i_t t = 0; t < num_touched; t++) {
+    if (work.num_runs[t] > 1) { split_color(side, t, is_dirty, coloring, work, moved); }
   }
 
-  // Remove vertices that moved to new colors from the original color
-  for (i_t v : vertices_to_refine_by_color[color]) {
-    if (color_map_B[v] != color) { colors[color].vertices.erase(v); }
-  }
-  // Also remove sum=0 vertices if they were moved (sum=0 wasn't the largest)
-  if (!largest_is_sum_zero) {
-    for (i_t v : color_sums[0.0]) {
-      colors[color].vertices.erase(v);
-    }
+  for (i_t v : dirty) {
+    is_dirty[v] = 0;
   }
-
-  if (colors[color].vertices.size() == 0) {
-    colors[color].active = kInactive;
-    num_colors--;
-    num_side_colors--;
+  for (i_t c : work.touched_colors) {
+    work.dirty_count[c] = 0;
   }
-
-  vertices_to_refine_by_color[color].clear();
-  max_sum_by_color[color] = std::numeric_limits<f_t>::quiet_NaN();
-  min_sum_by_color[color] = std::numeric_limits<f_t>::quiet_NaN();
-  return 0;
+  dirty.clear();
 }
 
 template <typename i_t, typename f_t>
@@ -419,7 +438,7 @@ enum coloring_status_t : int8_t { COLORING_SUCCESS = 0, COLORING_FAILED = -1 };
 template <typename i_t, typename f_t>
 coloring_status_t color_graph(const csc_matrix_t<i_t, f_t>& A,
                               const simplex_solver_settings_t<i_t, f_t>& settings,
-                              std::vector<color_t<i_t>>& colors,
+                              coloring_t<i_t>& colors,
                               i_t row_threshold,
                               i_t col_threshold,
                               i_t& num_row_colors,
@@ -454,292 +473,61 @@ coloring_status_t color_graph(const csc_matrix_t<i_t, f_t>& A,
     return coloring_status_t::COLORING_FAILED;
   }
 
-  std::vector<i_t> all_rows_vertices(m);
-  std::iota(all_rows_vertices.begin(), all_rows_vertices.end(), 0);
-  color_t<i_t> all_rows(kRow, kActive, 0, all_rows_vertices);
-
-  std::vector<i_t> all_cols_vertices(n);
-  std::iota(all_cols_vertices.begin(), all_cols_vertices.end(), 0);
-  color_t<i_t> all_cols(kCol, kActive, 1, all_cols_vertices);
-
-  std::vector<i_t> color_stack;
-  color_stack.push_back(0);
-  color_stack.push_back(1);
-
-  std::vector<i_t> row_color_map(m, 0);
-  std::vector<i_t> col_color_map(n, 1);
-
-  num_row_colors    = 1;
-  num_col_colors    = 1;
-  num_colors        = num_row_colors + num_col_colors;
-  total_colors_seen = 2;  // The total colors seen includes inactive colors
-
-  colors.emplace_back(all_rows);
-  colors.emplace_back(all_cols);
-
-  const i_t max_vertices = std::max(m, n);
-  std::vector<f_t> vertex_to_sum(max_vertices, 0.0);
-  std::vector<i_t> vertices_to_refine;
-  vertices_to_refine.reserve(max_vertices);
-  std::vector<i_t> marked_vertices(max_vertices, 0);
-
-  i_t max_colors = m + n;
-  std::vector<i_t> color_in_stack(max_colors, 0);
-  color_in_stack[0] = 1;
-  color_in_stack[1] = 1;
-
-  std::map<f_t, std::vector<i_t>> color_sums;
-  std::map<f_t, i_t> sum_to_sizes;
-
-  std::vector<std::vector<i_t>> vertices_to_refine_by_color(max_colors);
-  std::vector<f_t> max_sum_by_color(max_colors, std::numeric_limits<f_t>::quiet_NaN());
-  std::vector<f_t> min_sum_by_color(max_colors, std::numeric_limits<f_t>::quiet_NaN());
-  std::vector<i_t> marked_colors(max_colors, 0);
-
-  std::vector<i_t> colors_to_split;
-  colors_to_split.reserve(max_vertices);
-  std::vector<i_t> colors_to_update;
-  colors_to_update.reserve(max_vertices);
-
-  i_t num_refinements       = 0;
-  f_t colors_per_refinement = 0.0;
-  while (!color_stack.empty()) {
-    num_refinements++;
-    i_t refining_color_index           = color_stack.back();
-    const color_t<i_t>& refining_color = colors[refining_color_index];
-    color_stack.pop_back();  // Can pop since refining color is no longer needed. New colors will be
-                             // added to the stack.
-    color_in_stack[refining_color_index] = 0;
-    colors_to_update.clear();
-    compute_sums(A,
-                 A_row,
-                 num_row_colors,
-                 num_col_colors,
-                 total_colors_seen,
-                 row_color_map,
-                 col_color_map,
-                 refining_color,
-                 colors_to_update,
-                 marked_colors,
-                 vertices_to_refine,
-                 marked_vertices,
-                 vertices_to_refine_by_color,
-                 vertex_to_sum,
-                 max_sum_by_color);
-
-    colors_to_split.clear();
-    i_t status = find_colors_to_split(colors_to_update,
-                                      colors,
-                                      vertices_to_refine_by_color,
-                                      vertex_to_sum,
-                                      max_sum_by_color,
-                                      min_sum_by_color,
-                                      colors_to_split);
-    if (status != 0) { return coloring_status_t::COLORING_FAILED; }
-    // We now need to split the current colors into new colors
-    if (refining_color.row_or_column == kRow) {
-      // Refining color is a row color.
-      // See if we need to split the column colors
-      for (i_t color : colors_to_split) {
-        i_t status = split_colors(color,
-                                  colors[refining_color_index].color,
-                                  kCol,
-                                  vertex_to_sum,
-                                  color_sums,
-                                  sum_to_sizes,
-                                  colors,
-                                  color_stack,
-                                  color_in_stack,
-                                  col_color_map,
-                                  marked_vertices,
-                                  vertices_to_refine_by_color,
-                                  min_sum_by_color,
-                                  max_sum_by_color,
-                                  num_colors,
-                                  num_col_colors,
-                                  total_colors_seen);
-        if (status != 0) { return coloring_status_t::COLORING_FAILED; }
-      }
-    } else {
-      // Refining color is a column color.
-      // See if we need to split the row colors
-      for (i_t color : colors_to_split) {
-        i_t status = split_colors(color,
-                                  colors[refining_color_index].color,
-                                  kRow,
-                                  vertex_to_sum,
-                                  color_sums,
-                                  sum_to_sizes,
-                                  colors,
-                                  color_stack,
-                                  color_in_stack,
-                                  row_color_map,
-                                  marked_vertices,
-                                  vertices_to_refine_by_color,
-                                  min_sum_by_color,
-                                  max_sum_by_color,
-                                  num_colors,
-                                  num_row_colors,
-                                  total_colors_seen);
-        if (status != 0) { return coloring_status_t::COLORING_FAILED; }
-      }
-    }
-
-    for (i_t v : vertices_to_refine) {
-      vertex_to_sum[v] = 0.0;
-    }
-
-    colors_per_refinement =
-      static_cast<f_t>(num_row_colors + num_col_colors) / static_cast<f_t>(num_refinements);
-    i_t projected_colors =
-      num_row_colors + num_col_colors +
-      static_cast<i_t>(colors_per_refinement * static_cast<f_t>(color_stack.size()));
-
-    if (total_colors_seen >= max_colors - 10) {
-      settings.log.debug(
-        "Folding: Increase max colors from %d to %d\n", max_colors, max_colors * 2);
-      max_colors *= 2;
-      color_in_stack.resize(max_colors, 0);
-      vertices_to_refine_by_color.resize(max_colors);
-      max_sum_by_color.resize(max_colors);
-      min_sum_by_color.resize(max_colors);
-      marked_colors.resize(max_colors, 0);
-    }
-
-#ifdef DEBUG
-    for (i_t k = 0; k < max_vertices; k++) {
-      if (vertex_to_sum[k] != 0.0) {
-        settings.log.printf("Folding: Vertex %d has sum %e\n", k, vertex_to_sum[k]);
-        return coloring_status_t::COLORING_FAILED;
-      }
-    }
-#endif
-
-    for (i_t color : colors_to_update) {
-      vertices_to_refine_by_color[color].clear();
-      max_sum_by_color[color] = std::numeric_limits<f_t>::quiet_NaN();
-      min_sum_by_color[color] = std::numeric_limits<f_t>::quiet_NaN();
-    }
-
-#ifdef DEBUG
-    for (i_t k = 0; k < total_colors_seen; k++) {
-      if (vertices_to_refine_by_color[k].size() != 0) {
-        settings.log.printf("Folding: Color %d has %ld vertices to refine. Not cleared\n",
-                            k,
-                            vertices_to_refine_by_color[k].size());
-        return coloring_status_t::COLORING_FAILED;
-      }
-    }
-#endif
-
-#ifdef DEBUG
-    for (i_t i = 0; i < m; i++) {
-      if (row_color_map[i] >= total_colors_seen) {
-        settings.log.printf("Folding: Row color %d is not in the colors vector\n",
-                            row_color_map[i]);
-        return coloring_status_t::COLORING_FAILED;
-      }
-    }
-    for (i_t j = 0; j < n; j++) {
-      if (col_color_map[j] >= total_colors_seen) {
-        settings.log.printf("Folding: Column color %d is not in the colors vector. %d\n",
-                            col_color_map[j],
-                            num_colors);
-        return coloring_status_t::COLORING_FAILED;
-      }
-    }
-#endif
-
-#ifdef DEBUG
-    // Count the number of active colors
-    i_t num_active_colors     = 0;
-    i_t num_active_row_colors = 0;
-    i_t num_active_col_colors = 0;
-    for (color_t<i_t>& color : colors) {
-      if (color.active == kActive) {
-        num_active_colors++;
-        if (color.row_or_column == kRow) {
-          num_active_row_colors++;
-          for (i_t v : color.vertices) {
-            if (row_color_map[v] != color.color) {
-              settings.log.printf(
-                "Folding: Row color map %d does not match color %d for vertex %d\n",
-                row_color_map[v],
-                color.color,
-                v);
-              return coloring_status_t::COLORING_FAILED;
-            }
-          }
-        } else {
-          num_active_col_colors++;
-          for (i_t v : color.vertices) {
-            if (col_color_map[v] != color.color) {
-              settings.log.printf(
-                "Folding: Column color map %d does not match color %d for vertex %d\n",
-                col_color_map[v],
-                color.color,
-                v);
-              return coloring_status_t::COLORING_FAILED;
-            }
+  // Start from one row color and one column color and refine the rows and the columns in turn
+  // until no vertex changes color, which gives the coarsest equitable partition. All the
+  // vertices are dirty in the first round of their side.
+  const adjacency_t<i_t, f_t> adjacency[2] = {{A_row.row_start, A_row.j, A_row.x},
+                                              {A.col_start, A.i, A.x}};
+  const i_t num_threads                    = std::max(settings.num_threads, 1);
+  std::vector<i_t> dirty[2]                = {std::vector<i_t>(m), std::vector<i_t>(n)};
+  std::iota(dirty[kRow].begin(), dirty[kRow].end(), 0);
+  std::iota(dirty[kCol].begin(), dirty[kCol].end(), 0);
+  std::vector<int8_t> is_dirty[2] = {std::vector<int8_t>(m, 1), std::vector<int8_t>(n, 1)};
+  i_t num_side_colors[2]          = {1, 1};
+
+  refinement_workspace_t<i_t, f_t> work(std::max(m, n));
+  std::vector<i_t> moved;
+
+  i_t num_refinements = 0;
+  int8_t side         = kRow;
+  while (!dirty[kRow].empty() || !dirty[kCol].empty()) {
+    if (!dirty[side].empty()) {
+      num_refinements++;
+      const i_t colors_before = colors.num_colors();
+      refine_side(
+        side, adjacency[side], num_threads, colors, dirty[side], is_dirty[side], work, moved);
+      num_side_colors[side] += colors.num_colors() - colors_before;
+
+      // The neighbors of the vertices that changed color have a new signature
+      const int8_t other = 1 - side;
+      for (i_t v : moved) {
+        for (i_t p = adjacency[side].offsets[v]; p < adjacency[side].offsets[v + 1]; p++) {
+          const i_t u = adjacency[side].neighbors[p];
+          if (!is_dirty[other][u]) {
+            is_dirty[other][u] = 1;
+            dirty[other].push_back(u);
           }
         }
       }
     }
-    // printf("Number of active colors: %d\n", num_active_colors);
-    if (num_active_colors != num_colors) {
-      settings.log.printf("Folding: Number of active colors does not match number of colors\n");
-      return coloring_status_t::COLORING_FAILED;
-    }
-    // printf("Number of active row colors: %d\n", num_active_row_colors);
-    if (num_active_row_colors != num_row_colors) {
-      settings.log.printf(
-        "Folding: Number of active row colors does not match number of row colors\n");
-      return coloring_status_t::COLORING_FAILED;
-    }
-    // printf("Number of active column colors: %d\n", num_active_col_colors);
-    if (num_active_col_colors != num_col_colors) {
-      settings.log.printf(
-        "Folding: Number of active column colors does not match number of column colors\n");
-      return coloring_status_t::COLORING_FAILED;
-    }
-#endif
+    side = 1 - side;
 
+    num_row_colors = num_side_colors[kRow];
+    num_col_colors = num_side_colors[kCol];
     if (toc(last_log_time) > 1.0) {
-      f_t elapsed        = toc(start_time);
-      i_t current_colors = num_row_colors + num_col_colors;
-      last_log_time      = tic();
-      settings.log.printf(
-        "Folding: %d refinements %d colors in %.2fs\n", num_refinements, current_colors, elapsed);
-#ifdef PRINT_INFO
-      settings.log.debug(
-        "Number of refinements %8d. Number of colors %d (row colors %d, col colors %d) stack size "
-        "%ld colors per "
-        "refinement %.2f projected colors %d in %.2f seconds\n",
-        num_refinements,
-        num_row_colors + num_col_colors,
-        num_row_colors,
-        num_col_colors,
-        color_stack.size(),
-        colors_per_refinement,
-        projected_colors,
-        elapsed);
-#endif
-    }
-    if (num_row_colors >= max_vertices) {
-      settings.log.printf("Folding: Too many row colors %d max %d\n", num_row_colors, max_vertices);
-      return coloring_status_t::COLORING_FAILED;
-    }
-    if (num_col_colors >= max_vertices) {
-      settings.log.printf(
-        "Folding: Too many column colors %d max %d\n", num_col_colors, max_vertices);
-      return coloring_status_t::COLORING_FAILED;
+      last_log_time = tic();
+      settings.log.printf("Folding: %d refinements %d colors in %.2fs\n",
+                          num_refinements,
+                          num_row_colors + num_col_colors,
+                          toc(start_time));
     }
-
     if (num_row_colors > row_threshold || num_col_colors > col_threshold) {
-      settings.log.printf("Folding: Number of colors exceeds threshold");
+      settings.log.printf("Folding: Number of colors exceeds threshold\n");
       return coloring_status_t::COLORING_FAILED;
     }
   }
+  num_colors        = colors.num_colors();
+  total_colors_seen = num_colors;
   settings.log.printf(
     "Folding: Colors %d. Refinements: %d\n", num_row_colors + num_col_colors, num_refinements);
 
@@ -774,7 +562,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
   i_t m = problem.num_rows;
   i_t n = problem.num_cols;
 
-  if (settings.folding == -1 && (m > 1e6 || n > 1e6)) {
+  if (settings.folding == -1 && (m > 1e7 || n > 1e7)) {
     settings.log.printf("Folding: Skipping\n");
     return;
   }
@@ -894,7 +682,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
   }
 #endif
 
-  std::vector<color_t<i_t>> colors;
+  coloring_t<i_t> colors(augmented.m, augmented.n);
   i_t num_row_colors;
   i_t num_col_colors;
   i_t num_colors;
@@ -939,40 +727,37 @@ void folding(lp_problem_t<i_t, f_t>& problem,
 
   bool found_objective_color = false;
   i_t objective_color        = -1;
-  i_t color_count            = 0;
-  for (const color_t<i_t>& color : colors) {
-    if (color.active == kActive) {
-      if (color.row_or_column == kRow) {
-        if (color.vertices.size() == 1) {
-          if (*color.vertices.begin() == m + nz_ub) {
-            settings.log.debug("Folding: Row color %d is the objective color\n", color.color);
-            found_objective_color = true;
-            objective_color       = color_count;
-          } else {
-            row_colors.push_back(color_count);
-          }
+  for (i_t color_count = 0; color_count < colors.num_colors(); color_count++) {
+    const color_view_t<i_t> color = colors[color_count];
+    if (color.row_or_column == kRow) {
+      if (color.vertices.size() == 1) {
+        if (*color.vertices.begin() == m + nz_ub) {
+          settings.log.debug("Folding: Row color %d is the objective color\n", color.color);
+          found_objective_color = true;
+          objective_color       = color_count;
         } else {
           row_colors.push_back(color_count);
+        }
+      } else {
+        row_colors.push_back(color_count);
 #ifdef ROW_RHS_CHECK
-          // Check that all vertices in the same row color have the same rhs value
-          auto it       = color.vertices.begin();
-          f_t rhs_value = full_rhs[*it];
-          for (++it; it != color.vertices.end(); ++it) {
-            if (full_rhs[*it] != rhs_value) {
-              settings.log.printf(
-                "Folding: RHS value for vertex %d is %e, but should be %e. Difference is %e\n",
-                *it,
-                full_rhs[*it],
-                rhs_value,
-                full_rhs[*it] - rhs_value);
-              return;
-            }
+        // Check that all vertices in the same row color have the same rhs value
+        auto it       = color.vertices.begin();
+        f_t rhs_value = full_rhs[*it];
+        for (++it; it != color.vertices.end(); ++it) {
+          if (full_rhs[*it] != rhs_value) {
+            settings.log.printf(
+              "Folding: RHS value for vertex %d is %e, but should be %e. Difference is %e\n",
+              *it,
+              full_rhs[*it],
+              rhs_value,
+              full_rhs[*it] - rhs_value);
+            return;
           }
-#endif
         }
+#endif
       }
     }
-    color_count++;
   }
 
   if (!found_objective_color) {
@@ -992,41 +777,38 @@ void folding(lp_problem_t<i_t, f_t>& problem,
 
   std::vector<i_t> col_colors;
   col_colors.reserve(num_col_colors - 1);
-  color_count = 0;
-  for (const color_t<i_t>& color : colors) {
-    if (color.active == kActive) {
-      if (color.row_or_column == kCol) {
-        if (color.vertices.size() == 1) {
-          if (*color.vertices.begin() == n_prime - 1) {
-            settings.log.debug("Folding: Column color %d is the rhs color\n", color.color);
-            found_rhs_color = true;
-            rhs_color       = color_count;
-          } else {
-            col_colors.push_back(color_count);
-          }
+  for (i_t color_count = 0; color_count < colors.num_colors(); color_count++) {
+    const color_view_t<i_t> color = colors[color_count];
+    if (color.row_or_column == kCol) {
+      if (color.vertices.size() == 1) {
+        if (*color.vertices.begin() == n_prime - 1) {
+          settings.log.debug("Folding: Column color %d is the rhs color\n", color.color);
+          found_rhs_color = true;
+          rhs_color       = color_count;
         } else {
           col_colors.push_back(color_count);
+        }
+      } else {
+        col_colors.push_back(color_count);
 #ifdef COL_OBJ_CHECK
-          // Check that all vertices in the same column color have the same objective value
-          auto it             = color.vertices.begin();
-          f_t objective_value = full_objective[*it];
-          for (; it != color.vertices.end(); ++it) {
-            if (full_objective[*it] != objective_value) {
-              settings.log.printf(
-                "Folding: Objective value for vertex %d is %e, but should be %e. Difference is "
-                "%e\n",
-                *it,
-                full_objective[*it],
-                objective_value,
-                full_objective[*it] - objective_value);
-              return;
-            }
+        // Check that all vertices in the same column color have the same objective value
+        auto it             = color.vertices.begin();
+        f_t objective_value = full_objective[*it];
+        for (; it != color.vertices.end(); ++it) {
+          if (full_objective[*it] != objective_value) {
+            settings.log.printf(
+              "Folding: Objective value for vertex %d is %e, but should be %e. Difference is "
+              "%e\n",
+              *it,
+              full_objective[*it],
+              objective_value,
+              full_objective[*it] - objective_value);
+            return;
           }
-#endif
         }
+#endif
       }
     }
-    color_count++;
   }
 
   if (!found_rhs_color) {
@@ -1066,7 +848,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
   for (i_t k = 0; k < reduced_rows; k++) {
     Pi_P.col_start[k]         = nnz;
     const i_t color_index     = row_colors[k];
-    const color_t<i_t>& color = colors[color_index];
+    const color_view_t<i_t> color = colors[color_index];
     for (i_t v : color.vertices) {
       Pi_P.i[nnz] = v;
       Pi_P.x[nnz] = 1.0;
@@ -1109,7 +891,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
       settings.log.printf("Folding: Bad row colors\n");
       return;
     }
-    const color_t<i_t>& color = colors[color_index];
+    const color_view_t<i_t> color = colors[color_index];
     const i_t color_size      = color.vertices.size();
     for (i_t v : color.vertices) {
       C_s_row.j[nnz] = v;
@@ -1168,7 +950,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
       settings.log.printf("Folding: Bad column colors\n");
       return;
     }
-    const color_t<i_t>& color = colors[color_index];
+    const color_view_t<i_t> color = colors[color_index];
     for (const i_t v : color.vertices) {
       D.i[nnz] = v;
       D.x[nnz] = 1.0;
@@ -1190,7 +972,7 @@ void folding(lp_problem_t<i_t, f_t>& problem,
   for (i_t k = 0; k < reduced_cols; k++) {
     D_s_row.row_start[k]      = nnz;
     const i_t color_index     = col_colors[k];
-    const color_t<i_t>& color = colors[color_index];
+    const color_view_t<i_t> color = colors[color_index];
     const i_t color_size      = color.vertices.size();
     for (i_t v : color.vertices) {
       D_s_row.j[nnz] = v;
@@ -1386,9 +1168,9 @@ void folding(lp_problem_t<i_t, f_t>& problem,
 #ifdef DEBUG
   std::vector<i_t> row_to_color(A_tilde.m, -1);
   for (i_t k = 0; k < total_colors_seen; k++) {
-    const color_t<i_t>& row_color = colors[k];
+    const color_view_t<i_t> row_color = colors[k];
     if (k == objective_color) continue;
-    if (row_color.active == kActive && row_color.row_or_column == kRow) {
+    if (row_color.row_or_column == kRow) {
       for (i_t u : row_color.vertices) {
         row_to_color[u] = k;
       }
@@ -1396,9 +1178,9 @@ void folding(lp_problem_t<i_t, f_t>& problem,
   }
   std::vector<i_t> col_to_color(A_tilde.n, -1);
   for (i_t k = 0; k < total_colors_seen; k++) {
-    const color_t<i_t>& col_color = colors[k];
+    const color_view_t<i_t> col_color = colors[k];
     if (k == rhs_color) continue;
-    if (col_color.active == kActive && col_color.row_or_column == kCol) {
+    if (col_color.row_or_column == kCol) {
       for (i_t v : col_color.vertices) {
         col_to_color[v] = k;
         // printf("Col %d assigned to color %d =? %d\n", v, k, col_color.color);
@@ -1428,8 +1210,8 @@ void folding(lp_problem_t<i_t, f_t>& problem,
 
   // Step 2: Verify column partition
   for (i_t h = 0; h < total_colors_seen; h++) {
-    const color_t<i_t>& row_color = colors[h];
-    if (row_color.active != kActive || row_color.row_or_column != kRow) continue;
+    const color_view_t<i_t> row_color = colors[h];
+    if (row_color.row_or_column != kRow) continue;
     if (row_color.vertices.size() < 2) continue;
 
     auto it     = row_color.vertices.begin();
@@ -1467,8 +1249,8 @@ void folding(lp_problem_t<i_t, f_t>& problem,
 
   // Step 4: Verify row partition
   for (i_t k = 0; k < total_colors_seen; k++) {
-    const color_t<i_t>& col_color = colors[k];
-    if (col_color.active != kActive || col_color.row_or_column != kCol) continue;
+    const color_view_t<i_t> col_color = colors[k];
+    if (col_color.row_or_column != kCol) continue;
     if (col_color.vertices.size() < 2) continue;
 
     auto it     = col_color.vertices.begin();
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -11,8 +11,20 @@
 #include <dual_simplex/simplex_solver_settings.hpp>
 #include <dual_simplex/types.hpp>
 
+#include <cstdint>
+
 namespace cuopt::linear_programming::dual_simplex {
 
+// Hash of the color signatures of the refinements, shared with the symmetry detection
+inline uint64_t hash_combine(uint64_t hash, uint64_t value)
+{
+  // splitmix64 finalizer of the combined value
+  uint64_t z = hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+  z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z          = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
 template <typename i_t, typename f_t>
 void folding(lp_problem_t<i_t, f_t>& problem,
              const simplex_solver_settings_t<i_t, f_t>& settings,
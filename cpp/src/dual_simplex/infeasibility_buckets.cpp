@@ -0,0 +1,145 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/infeasibility_buckets.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+// Covers the exponents of every finite positive value, subnormals included
+constexpr int min_exponent = -1100;
+constexpr int max_exponent = 1100;
+constexpr int num_buckets  = max_exponent - min_exponent + 1;
+}  // namespace
+
+template <typename i_t, typename f_t>
+infeasibility_buckets_t<i_t, f_t>::infeasibility_buckets_t(i_t n)
+  : buckets_(num_buckets), bucket_(n, -1), position_(n, -1), is_marked_(n, 0)
+{
+}
+
+template <typename i_t, typename f_t>
+i_t infeasibility_buckets_t<i_t, f_t>::bucket_of(f_t val)
+{
+  if (!(val < std::numeric_limits<f_t>::infinity())) { return num_buckets - 1; }
+  const int exponent = std::ilogb(val);
+  return std::clamp(exponent, min_exponent, max_exponent) - min_exponent;
+}
+
+template <typename i_t, typename f_t>
+void infeasibility_buckets_t<i_t, f_t>::insert(i_t j, i_t b)
+{
+  bucket_[j]   = b;
+  position_[j] = buckets_[b].size();
+  buckets_[b].push_back(j);
+  top_ = std::max(top_, b);
+  num_entries_++;
+}
+
+template <typename i_t, typename f_t>
+void infeasibility_buckets_t<i_t, f_t>::remove(i_t j)
+{
+  std::vector<i_t>& bucket = buckets_[bucket_[j]];
+  const i_t last           = bucket.back();
+  bucket[position_[j]]     = last;
+  position_[last]          = position_[j];
+  bucket.pop_back();
+  bucket_[j]   = -1;
+  position_[j] = -1;
+  num_entries_--;
+}
+
+template <typename i_t, typename f_t>
+void infeasibility_buckets_t<i_t, f_t>::rebuild(const std::vector<f_t>& squared_infeasibilities,
+                                                const std::vector<i_t>& infeasibility_indices,
+                                                const std::vector<f_t>& norms,
+                                                f_t& work_estimate)
+{
+  for (i_t b = 0; b <= top_; ++b) {
+    for (i_t j : buckets_[b]) {
+      bucket_[j]   = -1;
+      position_[j] = -1;
+    }
+    work_estimate += 2 * buckets_[b].size();
+    buckets_[b].clear();
+  }
+  for (i_t j : marked_) {
+    is_marked_[j] = 0;
+  }
+  work_estimate += marked_.size() + top_ + 1;
+  marked_.clear();
+  top_         = -1;
+  num_entries_ = 0;
+  for (i_t j : infeasibility_indices) {
+    const f_t squared_infeas = squared_infeasibilities[j];
+    if (squared_infeas > 0.0 && bucket_[j] == -1) {
+      insert(j, bucket_of(squared_infeas / norms[j]));
+    }
+  }
+  work_estimate += 5 * infeasibility_indices.size();
+}
+
+template <typename i_t, typename f_t>
+void infeasibility_buckets_t<i_t, f_t>::mark(i_t j)
+{
+  if (is_marked_[j]) { return; }
+  is_marked_[j] = 1;
+  marked_.push_back(j);
+}
+
+template <typename i_t, typename f_t>
+void infeasibility_buckets_t<i_t, f_t>::flush(const std::vector<f_t>& squared_infeasibilities,
+                                              const std::vector<f_t>& norms,
+                                              f_t& work_estimate)
+{
+  for (i_t j : marked_) {
+    is_marked_[j]            = 0;
+    const f_t squared_infeas = squared_infeasibilities[j];
+    const i_t b = squared_infeas > 0.0 ? bucket_of(squared_infeas / norms[j]) : i_t{-1};
+    if (b == bucket_[j]) { continue; }
+    if (bucket_[j] != -1) { remove(j); }
+    if (b != -1) { insert(j, b); }
+  }
+  work_estimate += 6 * marked_.size();
+  marked_.clear();
+}
+
+template <typename i_t, typename f_t>
+i_t infeasibility_buckets_t<i_t, f_t>::best(const std::vector<f_t>& squared_infeasibilities,
+                                            const std::vector<f_t>& norms,
+                                            f_t& max_val,
+                                            f_t& work_estimate)
+{
+  flush(squared_infeasibilities, norms, work_estimate);
+  max_val               = 0.0;
+  i_t leaving_index     = -1;
+  const i_t initial_top = top_;
+  while (top_ >= 0 && buckets_[top_].empty()) {
+    top_--;
+  }
+  work_estimate += initial_top - top_;
+  if (top_ < 0) { return -1; }
+  for (i_t j : buckets_[top_]) {
+    const f_t val = squared_infeasibilities[j] / norms[j];
+    if (val > max_val || (val == max_val && j > leaving_index)) {
+      max_val       = val;
+      leaving_index = j;
+    }
+  }
+  work_estimate += 3 * buckets_[top_].size();
+  return leaving_index;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class infeasibility_buckets_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
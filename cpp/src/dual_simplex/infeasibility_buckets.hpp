@@ -0,0 +1,65 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/types.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Primal infeasible basic variables grouped by the binary exponent of their steepest edge price
+// squared_infeasibility / norm, for the dual simplex pricing on problems with many rows.
+//
+// A price in a higher bucket is strictly larger than any price in a lower one, so the leaving
+// variable is the best of the highest nonempty bucket. The variables whose infeasibility or norm
+// changed are marked during the iteration and moved when the buckets are next read, which makes
+// the pricing cost proportional to the updated rows and the size of the top bucket instead of
+// the number of infeasibilities.
+template <typename i_t, typename f_t>
+class infeasibility_buckets_t {
+ public:
+  explicit infeasibility_buckets_t(i_t n);
+
+  // Rebuilds the buckets from scratch, after the infeasibilities or the norms were recomputed
+  void rebuild(const std::vector<f_t>& squared_infeasibilities,
+               const std::vector<i_t>& infeasibility_indices,
+               const std::vector<f_t>& norms,
+               f_t& work_estimate);
+
+  // The price of variable j may have changed
+  void mark(i_t j);
+
+  // Returns the variable with the largest price, ties going to the largest index as in the full
+  // scan, or -1 when no variable is infeasible
+  i_t best(const std::vector<f_t>& squared_infeasibilities,
+           const std::vector<f_t>& norms,
+           f_t& max_val,
+           f_t& work_estimate);
+
+  i_t size() const { return num_entries_; }
+
+ private:
+  static i_t bucket_of(f_t val);
+  void insert(i_t j, i_t b);
+  void remove(i_t j);
+  void flush(const std::vector<f_t>& squared_infeasibilities,
+             const std::vector<f_t>& norms,
+             f_t& work_estimate);
+
+  std::vector<std::vector<i_t>> buckets_;
+  std::vector<i_t> bucket_;    // bucket of each variable, -1 when it is in none
+  std::vector<i_t> position_;  // position of each variable in its bucket
+  std::vector<i_t> marked_;
+  std::vector<uint8_t> is_marked_;
+  i_t top_{-1};
+  i_t num_entries_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
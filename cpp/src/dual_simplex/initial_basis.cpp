@@ -13,6 +13,7 @@
 
 #include <raft/core/nvtx.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -35,34 +36,31 @@ i_t initial_basis_selection(const lp_problem_t<i_t, f_t>& problem,
   assert(n == problem.A.n);
   assert(N == vstatus.size());
 
-  i_t Cnz = 0;
-  {
-    for (i_t k = 0; k < N; ++k) {
-      const i_t j         = candidate_columns[k];
-      const i_t col_start = problem.A.col_start[j];
-      const i_t col_end   = problem.A.col_start[j + 1];
-      Cnz += col_end - col_start;
-    }
+  // Gather C' = A(:, candidate_cols). The column starts fix where each column goes, so that the
+  // columns are copied in parallel
+  csc_matrix_t<i_t, f_t> CT(m, N, 1);
+  CT.col_start[0] = 0;
+  for (i_t k = 0; k < N; ++k) {
+    const i_t j         = candidate_columns[k];
+    CT.col_start[k + 1] = CT.col_start[k] + problem.A.col_start[j + 1] - problem.A.col_start[j];
   }
-  csc_matrix_t<i_t, f_t> CT(m, N, Cnz);
-  i_t Cq = 0;
+  const i_t Cnz = CT.col_start[N];
+  CT.i.resize(Cnz);
+  CT.x.resize(Cnz);
+  CT.nz_max = Cnz;
+#pragma omp parallel for num_threads(settings.num_threads) schedule(static)
   for (i_t k = 0; k < N; ++k) {
     const i_t j         = candidate_columns[k];
     const i_t col_start = problem.A.col_start[j];
     const i_t col_end   = problem.A.col_start[j + 1];
-    CT.col_start[k]     = Cq;
-    for (i_t p = col_start; p < col_end; ++p) {
-      CT.i[Cq] = problem.A.i[p];
-      CT.x[Cq] = problem.A.x[p];
-      Cq++;
-    }
+    const i_t dest      = CT.col_start[k];
+    std::copy(problem.A.i.begin() + col_start, problem.A.i.begin() + col_end, CT.i.begin() + dest);
+    std::copy(problem.A.x.begin() + col_start, problem.A.x.begin() + col_end, CT.x.begin() + dest);
   }
-  CT.col_start[N] = Cq;
-  assert(Cq == Cnz);
 
   // Form C = A(:, candidate_cols)'
   csc_matrix_t<i_t, f_t> C(N, m, 1);
-  CT.transpose(C);
+  CT.transpose(C, settings.num_threads);
   assert(C.col_start[m] == Cnz);
 
   // Calculate L*U = C(p, :)
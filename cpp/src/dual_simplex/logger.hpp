@@ -88,7 +88,9 @@ class logger_t {
   {
     if (log) {
 #ifdef CUOPT_LOG_DEBUG
-      if (log_to_console) {
+      // skip the formatting when the trace level is off, debug is called on hot paths
+      if (log_to_console &&
+          cuopt::default_logger().should_log(rapids_logger::level_enum::trace)) {
         char buffer[1024];
         std::va_list args;
         va_start(args, fmt);
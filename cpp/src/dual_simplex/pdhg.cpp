@@ -0,0 +1,432 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/pdhg.hpp>
+
+#include <dual_simplex/sparse_matrix.hpp>
+#include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/vector_math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+// Restart and primal weight parameters of the default PDLP solver mode
+constexpr double sufficient_reduction    = 0.2;
+constexpr double necessary_reduction     = 0.8;
+constexpr double artificial_restart      = 0.36;
+constexpr double primal_weight_smoothing = 0.5;
+constexpr double step_size_factor        = 0.998;
+constexpr int ruiz_iterations            = 10;
+constexpr int power_iterations           = 100;
+// Iterations between two restart and termination checks
+constexpr int check_frequency = 64;
+
+// Splits [0, n) in num_parts ranges of about the same number of nonzeros plus entries, start being
+// the row or column pointers of a compressed matrix. Counting the entries too spreads the empty
+// rows or columns
+template <typename i_t>
+std::vector<i_t> balance_nonzeros(const std::vector<i_t>& start, i_t n, int num_parts)
+{
+  std::vector<i_t> bounds(num_parts + 1, n);
+  bounds[0]          = 0;
+  const double total = static_cast<double>(start[n]) + n;
+  for (int t = 1; t < num_parts; ++t) {
+    const double target = total * t / num_parts;
+    i_t lo              = bounds[t - 1];
+    i_t hi              = n;
+    while (lo < hi) {
+      const i_t mid = lo + (hi - lo) / 2;
+      if (static_cast<double>(start[mid]) + mid < target) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    bounds[t] = lo;
+  }
+  return bounds;
+}
+
+// y = A x, each thread computing the rows of its range
+template <typename i_t, typename f_t>
+void csr_multiply(const csr_matrix_t<i_t, f_t>& A,
+                  const std::vector<i_t>& bounds,
+                  const std::vector<f_t>& x,
+                  std::vector<f_t>& y)
+{
+  const int num_parts = static_cast<int>(bounds.size()) - 1;
+#pragma omp parallel for num_threads(num_parts) schedule(static, 1)
+  for (int t = 0; t < num_parts; ++t) {
+    for (i_t i = bounds[t]; i < bounds[t + 1]; ++i) {
+      f_t dot = 0.0;
+#pragma omp simd reduction(+ : dot)
+      for (i_t p = A.row_start[i]; p < A.row_start[i + 1]; ++p) {
+        dot += A.x[p] * x[A.j[p]];
+      }
+      y[i] = dot;
+    }
+  }
+}
+
+// x = A^T y, each thread computing the columns of its range
+template <typename i_t, typename f_t>
+void csc_transpose_multiply(const csc_matrix_t<i_t, f_t>& A,
+                            const std::vector<i_t>& bounds,
+                            const std::vector<f_t>& y,
+                            std::vector<f_t>& x)
+{
+  const int num_parts = static_cast<int>(bounds.size()) - 1;
+#pragma omp parallel for num_threads(num_parts) schedule(static, 1)
+  for (int t = 0; t < num_parts; ++t) {
+    for (i_t j = bounds[t]; j < bounds[t + 1]; ++j) {
+      f_t dot = 0.0;
+#pragma omp simd reduction(+ : dot)
+      for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+        dot += A.x[p] * y[A.i[p]];
+      }
+      x[j] = dot;
+    }
+  }
+}
+
+// Ruiz equilibration in the infinity norm followed by a Pock-Chambolle rescaling with alpha = 1,
+// as in the initial scaling of PDLP. A becomes R A C, R and C being the returned row and column
+// scalings
+template <typename i_t, typename f_t>
+void scale_matrix(csc_matrix_t<i_t, f_t>& A,
+                  std::vector<f_t>& row_scale,
+                  std::vector<f_t>& col_scale)
+{
+  const i_t m = A.m;
+  const i_t n = A.n;
+  row_scale.assign(m, 1.0);
+  col_scale.assign(n, 1.0);
+  std::vector<f_t> row_norm(m);
+  std::vector<f_t> col_norm(n);
+
+  auto rescale = [&](auto&& combine) {
+    std::fill(row_norm.begin(), row_norm.end(), 0.0);
+    for (i_t j = 0; j < n; ++j) {
+      f_t norm = 0.0;
+      for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+        const f_t a      = std::abs(A.x[p]);
+        norm             = combine(norm, a);
+        row_norm[A.i[p]] = combine(row_norm[A.i[p]], a);
+      }
+      col_norm[j] = norm > 0.0 ? 1.0 / std::sqrt(norm) : 1.0;
+    }
+    for (i_t i = 0; i < m; ++i) {
+      row_norm[i] = row_norm[i] > 0.0 ? 1.0 / std::sqrt(row_norm[i]) : 1.0;
+      row_scale[i] *= row_norm[i];
+    }
+    for (i_t j = 0; j < n; ++j) {
+      col_scale[j] *= col_norm[j];
+      for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+        A.x[p] *= row_norm[A.i[p]] * col_norm[j];
+      }
+    }
+  };
+
+  for (int k = 0; k < ruiz_iterations; ++k) {
+    rescale([](f_t norm, f_t a) { return std::max(norm, a); });
+  }
+  rescale([](f_t norm, f_t a) { return norm + a; });
+}
+
+// Largest singular value of A estimated with a power iteration on A^T A
+template <typename i_t, typename f_t>
+f_t estimate_norm(const csc_matrix_t<i_t, f_t>& A,
+                  const std::vector<i_t>& col_bounds,
+                  const csr_matrix_t<i_t, f_t>& Arow,
+                  const std::vector<i_t>& row_bounds)
+{
+  std::vector<f_t> v(A.n, 1.0 / std::sqrt(static_cast<f_t>(std::max<i_t>(A.n, 1))));
+  std::vector<f_t> Av(A.m);
+  f_t norm = 0.0;
+  for (int k = 0; k < power_iterations; ++k) {
+    csr_multiply(Arow, row_bounds, v, Av);
+    csc_transpose_multiply(A, col_bounds, Av, v);
+    const f_t new_norm = vector_norm2<i_t, f_t>(v);
+    if (new_norm == 0.0) { return 0.0; }
+    for (f_t& value : v) {
+      value /= new_norm;
+    }
+    const bool converged = std::abs(new_norm - norm) <= 1e-4 * new_norm;
+    norm                 = new_norm;
+    if (converged) { break; }
+  }
+  return std::sqrt(norm);
+}
+
+template <typename f_t>
+struct convergence_t {
+  f_t primal_objective;
+  f_t dual_objective;
+  f_t primal_residual;
+  f_t dual_residual;
+  bool optimal;
+};
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+lp_status_t host_pdhg(const lp_problem_t<i_t, f_t>& lp,
+                      f_t start_time,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      lp_solution_t<i_t, f_t>& solution)
+{
+  if (lp.Q.n > 0) {
+    settings.log.printf("Quadratic objectives are not supported by PDHG on the host\n");
+    return lp_status_t::UNSET;
+  }
+  const i_t m           = lp.num_rows;
+  const i_t n           = lp.num_cols;
+  const int num_threads = std::max<i_t>(settings.num_threads, 1);
+  const f_t inf         = std::numeric_limits<f_t>::infinity();
+  solution.resize(m, n);
+
+  // Scaled problem: A' = R A C, c' = C c, b' = R b, l' = C^-1 l, u' = C^-1 u, with x = C x' and
+  // y = R y'
+  csc_matrix_t<i_t, f_t> A = lp.A;
+  std::vector<f_t> row_scale;
+  std::vector<f_t> col_scale;
+  scale_matrix(A, row_scale, col_scale);
+  csr_matrix_t<i_t, f_t> Arow(m, n, 0);
+  A.to_compressed_row(Arow, num_threads);
+  const std::vector<i_t> col_bounds = balance_nonzeros(A.col_start, n, num_threads);
+  const std::vector<i_t> row_bounds = balance_nonzeros(Arow.row_start, m, num_threads);
+
+  std::vector<f_t> c(n);
+  std::vector<f_t> lower(n);
+  std::vector<f_t> upper(n);
+  std::vector<f_t> b(m);
+  for (i_t j = 0; j < n; ++j) {
+    c[j]     = col_scale[j] * lp.objective[j];
+    lower[j] = lp.lower[j] / col_scale[j];
+    upper[j] = lp.upper[j] / col_scale[j];
+  }
+  for (i_t i = 0; i < m; ++i) {
+    b[i] = row_scale[i] * lp.rhs[i];
+  }
+
+  const f_t operator_norm = estimate_norm(A, col_bounds, Arow, row_bounds);
+  const f_t step_size     = operator_norm > 0.0 ? step_size_factor / operator_norm : 1.0;
+  const f_t c_norm        = vector_norm2<i_t, f_t>(c);
+  const f_t b_norm        = vector_norm2<i_t, f_t>(b);
+  f_t primal_weight       = c_norm > 0.0 && b_norm > 0.0 ? c_norm / b_norm : 1.0;
+
+  // Current iterate, PDHG output, reflected primal and restart anchor
+  std::vector<f_t> x(n, 0.0);
+  std::vector<f_t> y(m, 0.0);
+  for (i_t j = 0; j < n; ++j) {
+    x[j] = std::clamp<f_t>(0.0, lower[j], upper[j]);
+  }
+  std::vector<f_t> x_hat     = x;
+  std::vector<f_t> y_hat     = y;
+  std::vector<f_t> x_reflect = x;
+  std::vector<f_t> x_anchor  = x;
+  std::vector<f_t> y_anchor  = y;
+
+  // Unscaled quantities of the termination checks
+  std::vector<f_t> Ax(m);
+  std::vector<f_t> Aty(n);
+  const f_t rhs_norm       = vector_norm2<i_t, f_t>(lp.rhs);
+  const f_t objective_norm = vector_norm2<i_t, f_t>(lp.objective);
+  const f_t tol            = settings.pdhg_relative_tol;
+
+  auto check_convergence = [&]() {
+    convergence_t<f_t> result{};
+    // A x = R^-1 A' x' and A^T y = C^-1 A'^T y'
+    csr_multiply(Arow, row_bounds, x_hat, Ax);
+    csc_transpose_multiply(A, col_bounds, y_hat, Aty);
+    f_t primal_residual = 0.0;
+    f_t dual_objective  = 0.0;
+    for (i_t i = 0; i < m; ++i) {
+      const f_t residual = Ax[i] / row_scale[i] - lp.rhs[i];
+      primal_residual += residual * residual;
+      dual_objective += lp.rhs[i] * row_scale[i] * y_hat[i];
+    }
+    f_t dual_residual    = 0.0;
+    f_t primal_objective = 0.0;
+    for (i_t j = 0; j < n; ++j) {
+      const f_t x_j = col_scale[j] * x_hat[j];
+      const f_t z_j = lp.objective[j] - Aty[j] / col_scale[j];
+      primal_objective += lp.objective[j] * x_j;
+      // The reduced cost is a bound multiplier when the bound it pushes against exists
+      if (z_j > 0.0 && lp.lower[j] > -inf) {
+        dual_objective += lp.lower[j] * z_j;
+      } else if (z_j < 0.0 && lp.upper[j] < inf) {
+        dual_objective += lp.upper[j] * z_j;
+      } else {
+        dual_residual += z_j * z_j;
+      }
+      solution.z[j] = z_j;
+    }
+    result.primal_objective = primal_objective;
+    result.dual_objective   = dual_objective;
+    result.primal_residual  = std::sqrt(primal_residual);
+    result.dual_residual    = std::sqrt(dual_residual);
+    const f_t gap           = std::abs(primal_objective - dual_objective);
+    result.optimal =
+      result.primal_residual <= tol * (1.0 + rhs_norm) &&
+      result.dual_residual <= tol * (1.0 + objective_norm) &&
+      gap <= tol * (1.0 + std::abs(primal_objective) + std::abs(dual_objective));
+    return result;
+  };
+
+  settings.log.printf(
+    "PDHG on %d threads, %d rows, %d columns, %d nonzeros\n", num_threads, m, n, A.col_start[n]);
+  settings.log.printf(" Iter     Primal Obj.      Dual Obj.    Primal Res.  Dual Res.   Time\n");
+
+  lp_status_t status           = lp_status_t::UNSET;
+  i_t iteration                = 0;
+  i_t iterations_since_restart = 0;
+  i_t last_restart_iteration   = 0;
+  f_t restart_residual         = inf;
+  f_t last_residual            = inf;
+  i_t next_log                 = 0;
+  convergence_t<f_t> convergence{};
+  while (true) {
+    const f_t tau            = step_size / primal_weight;
+    const f_t sigma          = step_size * primal_weight;
+    const f_t halpern_weight = static_cast<f_t>(iterations_since_restart + 1) /
+                               static_cast<f_t>(iterations_since_restart + 2);
+
+    // Primal step fused with A'^T y, then the dual step fused with A' (2 x_hat - x)
+    f_t primal_delta = 0.0;
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1) reduction(+ : primal_delta)
+    for (int t = 0; t < num_threads; ++t) {
+      for (i_t j = col_bounds[t]; j < col_bounds[t + 1]; ++j) {
+        f_t aty = 0.0;
+#pragma omp simd reduction(+ : aty)
+        for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+          aty += A.x[p] * y[A.i[p]];
+        }
+        const f_t x_j       = x[j];
+        const f_t next      = std::clamp(x_j - tau * (c[j] - aty), lower[j], upper[j]);
+        const f_t reflected = 2.0 * next - x_j;
+        primal_delta += (next - x_j) * (next - x_j);
+        x_hat[j]     = next;
+        x_reflect[j] = reflected;
+        x[j]         = halpern_weight * reflected + (1.0 - halpern_weight) * x_anchor[j];
+      }
+    }
+    f_t dual_delta = 0.0;
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1) reduction(+ : dual_delta)
+    for (int t = 0; t < num_threads; ++t) {
+      for (i_t i = row_bounds[t]; i < row_bounds[t + 1]; ++i) {
+        f_t ax = 0.0;
+#pragma omp simd reduction(+ : ax)
+        for (i_t p = Arow.row_start[i]; p < Arow.row_start[i + 1]; ++p) {
+          ax += Arow.x[p] * x_reflect[Arow.j[p]];
+        }
+        const f_t y_i  = y[i];
+        const f_t next = y_i + sigma * (b[i] - ax);
+        dual_delta += (next - y_i) * (next - y_i);
+        y_hat[i] = next;
+        y[i]     = halpern_weight * (2.0 * next - y_i) + (1.0 - halpern_weight) * y_anchor[i];
+      }
+    }
+    ++iteration;
+    ++iterations_since_restart;
+
+    if (iteration % check_frequency != 0) { continue; }
+
+    convergence = check_convergence();
+    if (iteration >= next_log || convergence.optimal) {
+      settings.log.printf("%5d %+.8e %+.8e %.2e %.2e %6.1fs\n",
+                          iteration,
+                          compute_user_objective(lp, convergence.primal_objective),
+                          compute_user_objective(lp, convergence.dual_objective),
+                          convergence.primal_residual,
+                          convergence.dual_residual,
+                          toc(start_time));
+      next_log = iteration + settings.iteration_log_frequency;
+    }
+    if (convergence.optimal) {
+      status = lp_status_t::OPTIMAL;
+      break;
+    }
+    if (iteration >= settings.iteration_limit) {
+      status = lp_status_t::ITERATION_LIMIT;
+      break;
+    }
+    if (toc(start_time) > settings.time_limit) {
+      status = lp_status_t::TIME_LIMIT;
+      break;
+    }
+    if (settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1) {
+      status = lp_status_t::CONCURRENT_LIMIT;
+      break;
+    }
+
+    // Fixed point residual of the last iteration in the primal weight norm
+    const f_t residual = std::sqrt(primal_weight * primal_delta + dual_delta / primal_weight);
+    if (restart_residual == inf) { restart_residual = residual; }
+    const bool restart =
+      residual <= sufficient_reduction * restart_residual ||
+      (residual <= necessary_reduction * restart_residual && residual > last_residual) ||
+      iteration - last_restart_iteration >= artificial_restart * iteration;
+    last_residual = residual;
+    if (!restart) { continue; }
+
+    // Restart from the PDHG output and move the primal weight towards the ratio of the distances
+    // travelled since the last restart
+    f_t primal_distance = 0.0;
+    f_t dual_distance   = 0.0;
+    for (i_t j = 0; j < n; ++j) {
+      primal_distance += (x_hat[j] - x_anchor[j]) * (x_hat[j] - x_anchor[j]);
+    }
+    for (i_t i = 0; i < m; ++i) {
+      dual_distance += (y_hat[i] - y_anchor[i]) * (y_hat[i] - y_anchor[i]);
+    }
+    primal_distance = std::sqrt(primal_distance);
+    dual_distance   = std::sqrt(dual_distance);
+    if (primal_distance > 1e-10 && dual_distance > 1e-10) {
+      primal_weight = std::exp(primal_weight_smoothing * std::log(dual_distance / primal_distance) +
+                               (1.0 - primal_weight_smoothing) * std::log(primal_weight));
+    }
+    x                        = x_hat;
+    y                        = y_hat;
+    x_anchor                 = x_hat;
+    y_anchor                 = y_hat;
+    iterations_since_restart = 0;
+    last_restart_iteration   = iteration;
+    restart_residual         = residual;
+    last_residual            = inf;
+  }
+
+  for (i_t j = 0; j < n; ++j) {
+    solution.x[j] = col_scale[j] * x_hat[j];
+  }
+  for (i_t i = 0; i < m; ++i) {
+    solution.y[i] = row_scale[i] * y_hat[i];
+  }
+  solution.objective          = convergence.primal_objective;
+  solution.user_objective     = compute_user_objective(lp, convergence.primal_objective);
+  solution.iterations         = iteration;
+  solution.l2_primal_residual = convergence.primal_residual;
+  solution.l2_dual_residual   = convergence.dual_residual;
+  return status;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+
+template lp_status_t host_pdhg<int, double>(const lp_problem_t<int, double>& lp,
+                                            double start_time,
+                                            const simplex_solver_settings_t<int, double>& settings,
+                                            lp_solution_t<int, double>& solution);
+
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,33 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solution.hpp>
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/types.hpp>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Solves the LP min c^T x s.t. A x = b, l <= x <= u with PDHG on the host, for machines without a
+// GPU. This is the method of the default PDLP solver mode: reflected Halpern iterations with
+// adaptive restarts, primal weight updates and an initial Ruiz and Pock-Chambolle scaling.
+// The products with A and A^T run on settings.num_threads OpenMP threads, each one streaming a
+// range of rows or columns holding the same number of nonzeros.
+//
+// Stops once the relative primal residual, dual residual and duality gap are all below
+// settings.pdhg_relative_tol, or at the iteration or time limit. No infeasibility detection is
+// done and quadratic objectives are not supported.
+template <typename i_t, typename f_t>
+lp_status_t host_pdhg(const lp_problem_t<i_t, f_t>& lp,
+                      f_t start_time,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      lp_solution_t<i_t, f_t>& solution);
+
+}  // namespace cuopt::linear_programming::dual_simplex
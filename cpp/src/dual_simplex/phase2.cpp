@@ -8,6 +8,8 @@
 #include <dual_simplex/basis_solves.hpp>
 #include <dual_simplex/basis_updates.hpp>
 #include <dual_simplex/bound_flipping_ratio_test.hpp>
+#include <dual_simplex/device_row_product.hpp>
+#include <dual_simplex/infeasibility_buckets.hpp>
 #include <dual_simplex/initial_basis.hpp>
 #include <dual_simplex/phase1.hpp>
 #include <dual_simplex/phase2.hpp>
@@ -16,6 +18,7 @@
 #include <dual_simplex/sparse_matrix.hpp>
 #include <dual_simplex/tic_toc.hpp>
 
+#include <utilities/instrumentation.hpp>
 #include <utilities/scope_guard.hpp>
 #include <utilities/timing_utils.hpp>
 #include <utilities/version_info.hpp>
@@ -26,10 +29,7 @@
 // #define PHASE2_NVTX_RANGES
 
 #ifdef PHASE2_NVTX_RANGES
-#define PHASE2_NVTX_RANGE(name) raft::common::nvtx::range NVTX_UNIQUE_NAME(nvtx_scope_)(name)
-#define NVTX_UNIQUE_NAME(base)  NVTX_CONCAT(base, __LINE__)
-#define NVTX_CONCAT(a, b)       NVTX_CONCAT_INNER(a, b)
-#define NVTX_CONCAT_INNER(a, b) a##b
+#define PHASE2_NVTX_RANGE(name) CUOPT_NVTX_RANGE(dual_simplex, name)
 #else
 #define PHASE2_NVTX_RANGE(name) ((void)0)
 #endif
@@ -38,13 +38,19 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <ctime>
 #include <map>
+#include <memory>
 
 namespace cuopt::linear_programming::dual_simplex {
 
 constexpr int FEATURE_LOG_INTERVAL = 100;
+// Pricing and row computations over fewer entries than this stay on a single thread
+constexpr int PARALLEL_PRICING_MIN_SIZE = 50000;
+// The automatic bucket pricing starts at this number of rows
+constexpr int BUCKET_PRICING_MIN_ROWS = 100000;
 
 using cuopt::ins_vector;
 
@@ -332,6 +338,7 @@ void compute_reduced_cost_update(const lp_problem_t<i_t, f_t>& lp,
                                  std::vector<i_t>& delta_z_mark,
                                  std::vector<i_t>& delta_z_indices,
                                  std::vector<f_t>& delta_z,
+                                 i_t num_threads,
                                  f_t& work_estimate)
 {
   const i_t m = lp.num_rows;
@@ -347,6 +354,43 @@ void compute_reduced_cost_update(const lp_problem_t<i_t, f_t>& lp,
   delta_z[leaving_index] = direction;
   // delta_zN = -N'*delta_y
   const i_t num_nonbasic = n - m;
+  if (num_threads > 1 && num_nonbasic >= PARALLEL_PRICING_MIN_SIZE) {
+    // Each block of nonbasic columns collects its own nonzeros. Appending the blocks in order
+    // gives the same delta_z_indices as the sequential loop below
+    const i_t num_blocks = num_threads;
+    std::vector<std::vector<i_t>> block_indices(num_blocks);
+    std::vector<size_t> block_nnzs(num_blocks, 0);
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (i_t b = 0; b < num_blocks; ++b) {
+      const i_t begin = static_cast<int64_t>(num_nonbasic) * b / num_blocks;
+      const i_t end   = static_cast<int64_t>(num_nonbasic) * (b + 1) / num_blocks;
+      for (i_t k = begin; k < end; k++) {
+        const i_t j         = nonbasic_list[k];
+        const i_t col_start = lp.A.col_start[j];
+        const i_t col_end   = lp.A.col_start[j + 1];
+        f_t dot             = 0.0;
+        for (i_t p = col_start; p < col_end; ++p) {
+          dot += lp.A.x[p] * delta_y[lp.A.i[p]];
+        }
+        block_nnzs[b] += col_end - col_start;
+
+        delta_z[j] = -dot;
+        if (dot != 0.0) {
+          block_indices[b].push_back(j);
+          delta_z_mark[j] = 1;
+        }
+      }
+    }
+    for (i_t b = 0; b < num_blocks; ++b) {
+      delta_z_indices.insert(
+        delta_z_indices.end(), block_indices[b].begin(), block_indices[b].end());
+      nnzs_processed += block_nnzs[b];
+    }
+    work_estimate += 3 * num_nonbasic;
+    work_estimate += 3 * nnzs_processed;
+    work_estimate += 2 * delta_z_indices.size();
+    return;
+  }
   for (i_t k = 0; k < num_nonbasic; k++) {
     const i_t j = nonbasic_list[k];
     // z_j <- -A(:, j)'*delta_y
@@ -369,6 +413,43 @@ void compute_reduced_cost_update(const lp_problem_t<i_t, f_t>& lp,
   work_estimate += 2 * delta_z_indices.size();
 }
 
+// Same as compute_reduced_cost_update, with the product N'*delta_y computed on the GPU
+template <typename i_t, typename f_t>
+void compute_reduced_cost_update_on_device(device_row_product_t<i_t, f_t>& device_row_product,
+                                           const lp_problem_t<i_t, f_t>& lp,
+                                           const std::vector<i_t>& basic_list,
+                                           const std::vector<i_t>& nonbasic_list,
+                                           const std::vector<f_t>& delta_y,
+                                           i_t leaving_index,
+                                           i_t direction,
+                                           std::vector<i_t>& delta_z_mark,
+                                           std::vector<i_t>& delta_z_indices,
+                                           std::vector<f_t>& delta_z,
+                                           f_t& work_estimate)
+{
+  const i_t m = lp.num_rows;
+  const i_t n = lp.num_cols;
+
+  // delta_z = -A'*delta_y, then delta_zB = sigma*ei
+  device_row_product.negative_transpose_multiply(delta_y, delta_z);
+  for (i_t k = 0; k < m; k++) {
+    delta_z[basic_list[k]] = 0;
+  }
+  delta_z[leaving_index] = direction;
+
+  const i_t num_nonbasic = n - m;
+  for (i_t k = 0; k < num_nonbasic; k++) {
+    const i_t j = nonbasic_list[k];
+    if (delta_z[j] != 0.0) {
+      delta_z_indices.push_back(j);
+      delta_z_mark[j] = 1;
+    }
+  }
+  // Charged as the host product, so that the work does not depend on where it ran
+  work_estimate += 2 * m + 3 * num_nonbasic + 3 * lp.A.col_start[n];
+  work_estimate += 2 * delta_z_indices.size();
+}
+
 template <typename i_t, typename f_t>
 void compute_delta_z(const csc_matrix_t<i_t, f_t>& A_transpose,
                      const sparse_vector_t<i_t, f_t>& delta_y,
@@ -888,10 +969,57 @@ i_t steepest_edge_pricing_with_infeasibilities(const lp_problem_t<i_t, f_t>& lp,
                                                f_t& max_val,
                                                f_t& work_estimate)
 {
-  max_val           = 0.0;
-  i_t leaving_index = -1;
-  const i_t nz      = infeasibility_indices.size();
-  i_t max_count     = 0;
+  max_val               = 0.0;
+  i_t leaving_index     = -1;
+  const i_t nz          = infeasibility_indices.size();
+  const i_t num_threads = settings.pricing_num_threads;
+  if (num_threads > 1 && nz >= PARALLEL_PRICING_MIN_SIZE) {
+    // Largest val, ties going to the largest j, is a total order on the candidates, so merging
+    // the best candidate of each block selects the same leaving variable as the sequential loop
+    const i_t num_blocks = num_threads;
+    std::vector<f_t> block_max_val(num_blocks, 0.0);
+    std::vector<i_t> block_leaving(num_blocks, -1);
+    std::vector<i_t> block_max_count(num_blocks, 0);
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (i_t b = 0; b < num_blocks; ++b) {
+      const i_t begin = static_cast<int64_t>(nz) * b / num_blocks;
+      const i_t end   = static_cast<int64_t>(nz) * (b + 1) / num_blocks;
+      f_t best_val    = 0.0;
+      i_t best_j      = -1;
+      i_t count       = 0;
+      for (i_t k = begin; k < end; ++k) {
+        const i_t j   = infeasibility_indices[k];
+        const f_t val = squared_infeasibilities[j] / dy_steepest_edge[j];
+        if (val > best_val || (val == best_val && j > best_j)) {
+          best_val = val;
+          best_j   = j;
+          count++;
+        }
+      }
+      block_max_val[b]   = best_val;
+      block_leaving[b]   = best_j;
+      block_max_count[b] = count;
+    }
+    i_t max_count = 0;
+    for (i_t b = 0; b < num_blocks; ++b) {
+      const f_t val = block_max_val[b];
+      const i_t j   = block_leaving[b];
+      if (val > max_val || (val == max_val && j > leaving_index)) {
+        max_val       = val;
+        leaving_index = j;
+      }
+      max_count += block_max_count[b];
+    }
+    if (leaving_index >= 0) {
+      const f_t lower_infeas = lp.lower[leaving_index] - x[leaving_index];
+      const f_t upper_infeas = x[leaving_index] - lp.upper[leaving_index];
+      direction              = lower_infeas >= upper_infeas ? 1 : -1;
+    }
+    work_estimate += 3 * nz + 3 * max_count;
+    basic_leaving = leaving_index >= 0 ? basic_mark[leaving_index] : -1;
+    return leaving_index;
+  }
+  i_t max_count = 0;
   for (i_t k = 0; k < nz; ++k) {
     const i_t j              = infeasibility_indices[k];
     const f_t squared_infeas = squared_infeasibilities[j];
@@ -912,6 +1040,29 @@ i_t steepest_edge_pricing_with_infeasibilities(const lp_problem_t<i_t, f_t>& lp,
   return leaving_index;
 }
 
+template <typename i_t, typename f_t>
+i_t steepest_edge_pricing_with_buckets(const lp_problem_t<i_t, f_t>& lp,
+                                       const std::vector<f_t>& x,
+                                       const std::vector<f_t>& dy_steepest_edge,
+                                       const std::vector<i_t>& basic_mark,
+                                       const std::vector<f_t>& squared_infeasibilities,
+                                       infeasibility_buckets_t<i_t, f_t>& infeasibility_buckets,
+                                       i_t& direction,
+                                       i_t& basic_leaving,
+                                       f_t& max_val,
+                                       f_t& work_estimate)
+{
+  const i_t leaving_index = infeasibility_buckets.best(
+    squared_infeasibilities, dy_steepest_edge, max_val, work_estimate);
+  if (leaving_index >= 0) {
+    const f_t lower_infeas = lp.lower[leaving_index] - x[leaving_index];
+    const f_t upper_infeas = x[leaving_index] - lp.upper[leaving_index];
+    direction              = lower_infeas >= upper_infeas ? 1 : -1;
+  }
+  basic_leaving = leaving_index >= 0 ? basic_mark[leaving_index] : -1;
+  return leaving_index;
+}
+
 template <typename i_t, typename f_t>
 i_t steepest_edge_pricing(const lp_problem_t<i_t, f_t>& lp,
                           const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -1384,7 +1535,6 @@ i_t initialize_steepest_edge_norms(const lp_problem_t<i_t, f_t>& lp,
 template <typename i_t, typename f_t>
 i_t update_steepest_edge_norms(const simplex_solver_settings_t<i_t, f_t>& settings,
                                const std::vector<i_t>& basic_list,
-                               const basis_update_mpf_t<i_t, f_t>& ft,
                                i_t direction,
                                const sparse_vector_t<i_t, f_t>& delta_y_sparse,
                                f_t dy_norm_squared,
@@ -1397,10 +1547,8 @@ i_t update_steepest_edge_norms(const simplex_solver_settings_t<i_t, f_t>& settin
                                f_t& work_estimate)
 {
   const i_t delta_y_nz = delta_y_sparse.i.size();
-  v_sparse.clear();
   // B^T delta_y = - direction * e_basic_leaving_index
-  // We want B v =  - B^{-T} e_basic_leaving_index
-  ft.b_solve(delta_y_sparse, v_sparse);
+  // We want B v =  - B^{-T} e_basic_leaving_index, v_sparse holds B^{-1} delta_y from the batch
   if (direction == -1) {
     v_sparse.negate();
     work_estimate += 2 * v_sparse.i.size();
@@ -1668,17 +1816,10 @@ i_t update_dual_variables(const sparse_vector_t<i_t, f_t>& delta_y_sparse,
 }
 
 template <typename i_t, typename f_t>
-void adjust_for_flips(const basis_update_mpf_t<i_t, f_t>& ft,
-                      const std::vector<i_t>& basic_list,
-                      const std::vector<i_t>& delta_z_indices,
-                      std::vector<i_t>& atilde_index,
-                      std::vector<f_t>& atilde,
-                      std::vector<i_t>& atilde_mark,
-                      sparse_vector_t<i_t, f_t>& atilde_sparse,
-                      sparse_vector_t<i_t, f_t>& delta_xB_0_sparse,
-                      std::vector<f_t>& delta_x_flip,
-                      std::vector<f_t>& x,
-                      f_t& work_estimate)
+void flip_rhs(const std::vector<i_t>& atilde_index,
+              const std::vector<f_t>& atilde,
+              sparse_vector_t<i_t, f_t>& atilde_sparse,
+              f_t& work_estimate)
 {
   const i_t atilde_nz = atilde_index.size();
   // B*delta_xB_0 = atilde
@@ -1690,7 +1831,20 @@ void adjust_for_flips(const basis_update_mpf_t<i_t, f_t>& ft,
     atilde_sparse.x.push_back(atilde[atilde_index[k]]);
   }
   work_estimate += 5 * atilde_nz;
-  ft.b_solve(atilde_sparse, delta_xB_0_sparse);
+}
+
+// delta_xB_0_sparse holds the solution of B*delta_xB_0 = atilde from the batch
+template <typename i_t, typename f_t>
+void adjust_for_flips(const std::vector<i_t>& basic_list,
+                      const std::vector<i_t>& delta_z_indices,
+                      std::vector<i_t>& atilde_index,
+                      std::vector<f_t>& atilde,
+                      std::vector<i_t>& atilde_mark,
+                      const sparse_vector_t<i_t, f_t>& delta_xB_0_sparse,
+                      std::vector<f_t>& delta_x_flip,
+                      std::vector<f_t>& x,
+                      f_t& work_estimate)
+{
   const i_t delta_xB_0_nz = delta_xB_0_sparse.i.size();
   for (i_t k = 0; k < delta_xB_0_nz; ++k) {
     const i_t j = basic_list[delta_xB_0_sparse.i[k]];
@@ -1734,8 +1888,7 @@ i_t compute_delta_x(const lp_problem_t<i_t, f_t>& lp,
 {
   f_t delta_x_leaving = direction == 1 ? lp.lower[leaving_index] - x[leaving_index]
                                        : lp.upper[leaving_index] - x[leaving_index];
-  // B*w = -A(:, entering)
-  ft.b_solve(rhs_sparse, scaled_delta_xB_sparse, utilde_sparse);
+  // B*w = -A(:, entering), scaled_delta_xB_sparse holds B^{-1} A(:, entering) from the batch
   scaled_delta_xB_sparse.negate();
   work_estimate += 2 * scaled_delta_xB_sparse.i.size();
 
@@ -2693,6 +2846,18 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                    primal_infeasibility);
   phase2_work_estimate += 4 * m + 2 * n;
 
+  const bool use_bucket_pricing =
+    settings.use_steepest_edge_pricing &&
+    (settings.bucket_pricing > 0 ||
+     (settings.bucket_pricing == -1 && m >= BUCKET_PRICING_MIN_ROWS));
+  infeasibility_buckets_t<i_t, f_t> infeasibility_buckets(use_bucket_pricing ? n : 0);
+  if (use_bucket_pricing) {
+    infeasibility_buckets.rebuild(squared_infeasibilities,
+                                  infeasibility_indices,
+                                  delta_y_steepest_edge,
+                                  phase2_work_estimate);
+  }
+
 #ifdef CHECK_BASIC_INFEASIBILITIES
   phase2::check_basic_infeasibilities(basic_list, basic_mark, infeasibility_indices, 0);
 #endif
@@ -2700,6 +2865,8 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
   csc_matrix_t<i_t, f_t> A_transpose(1, 1, 0);
   lp.A.transpose(A_transpose);
   phase2_work_estimate += 2 * lp.A.col_start[lp.A.n];
+  // Created on the first dense row computation when settings.gpu_row_product is set
+  std::unique_ptr<device_row_product_t<i_t, f_t>> device_row_product;
 
   f_t obj = compute_objective(lp, x);
   phase2_work_estimate += 2 * n;
@@ -2754,7 +2921,18 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     timers.start_timer();
     {
       PHASE2_NVTX_RANGE("DualSimplex::pricing");
-      if (settings.use_steepest_edge_pricing) {
+      if (use_bucket_pricing) {
+        leaving_index = phase2::steepest_edge_pricing_with_buckets(lp,
+                                                                   x,
+                                                                   delta_y_steepest_edge,
+                                                                   basic_mark,
+                                                                   squared_infeasibilities,
+                                                                   infeasibility_buckets,
+                                                                   direction,
+                                                                   basic_leaving_index,
+                                                                   max_val,
+                                                                   phase2_work_estimate);
+      } else if (settings.use_steepest_edge_pricing) {
         leaving_index = phase2::steepest_edge_pricing_with_infeasibilities(lp,
                                                                            settings,
                                                                            x,
@@ -2813,6 +2991,12 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                        squared_infeasibilities,
                                                        infeasibility_indices,
                                                        primal_infeasibility);
+      if (use_bucket_pricing) {
+        infeasibility_buckets.rebuild(squared_infeasibilities,
+                                      infeasibility_indices,
+                                      delta_y_steepest_edge,
+                                      phase2_work_estimate);
+      }
       if (primal_infeasibility > settings.primal_tol) {
         const i_t nz = infeasibility_indices.size();
         for (i_t k = 0; k < nz; ++k) {
@@ -2878,6 +3062,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
           delta_y_steepest_edge[leaving_index]);
       }
       delta_y_steepest_edge[leaving_index] = steepest_edge_norm_check;
+      if (use_bucket_pricing) { infeasibility_buckets.mark(leaving_index); }
       continue;
     }
 
@@ -2908,16 +3093,36 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
         // delta_zB = sigma*ei
         delta_y_sparse.to_dense(delta_y);
         phase2_work_estimate += delta_y.size();
-        phase2::compute_reduced_cost_update(lp,
-                                            basic_list,
-                                            nonbasic_list,
-                                            delta_y,
-                                            leaving_index,
-                                            direction,
-                                            delta_z_mark,
-                                            delta_z_indices,
-                                            delta_z,
-                                            phase2_work_estimate);
+        if (settings.gpu_row_product && lp.handle_ptr != nullptr) {
+          // A is only copied to the GPU once an iteration needs it
+          if (!device_row_product) {
+            device_row_product =
+              std::make_unique<device_row_product_t<i_t, f_t>>(lp.handle_ptr, lp.A);
+          }
+          phase2::compute_reduced_cost_update_on_device(*device_row_product,
+                                                        lp,
+                                                        basic_list,
+                                                        nonbasic_list,
+                                                        delta_y,
+                                                        leaving_index,
+                                                        direction,
+                                                        delta_z_mark,
+                                                        delta_z_indices,
+                                                        delta_z,
+                                                        phase2_work_estimate);
+        } else {
+          phase2::compute_reduced_cost_update(lp,
+                                              basic_list,
+                                              nonbasic_list,
+                                              delta_y,
+                                              leaving_index,
+                                              direction,
+                                              delta_z_mark,
+                                              delta_z_indices,
+                                              delta_z,
+                                              settings.pricing_num_threads,
+                                              phase2_work_estimate);
+        }
       }
     }
     timers.delta_z_time += timers.stop_timer();
@@ -3026,6 +3231,12 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                              squared_infeasibilities,
                                                              infeasibility_indices,
                                                              primal_infeasibility);
+            if (use_bucket_pricing) {
+              infeasibility_buckets.rebuild(squared_infeasibilities,
+                                            infeasibility_indices,
+                                            delta_y_steepest_edge,
+                                            phase2_work_estimate);
+            }
             phase2_work_estimate += 4 * m + 2 * n;
             settings.log.printf("Updated primal infeasibility: %e\n", primal_infeasibility);
 
@@ -3083,6 +3294,12 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                              squared_infeasibilities,
                                                              infeasibility_indices,
                                                              primal_infeasibility);
+            if (use_bucket_pricing) {
+              infeasibility_buckets.rebuild(squared_infeasibilities,
+                                            infeasibility_indices,
+                                            delta_y_steepest_edge,
+                                            phase2_work_estimate);
+            }
             phase2_work_estimate += 4 * m + 2 * n;
 
             const f_t orig_dual_infeas = phase2::dual_infeasibility(
@@ -3209,29 +3426,44 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     timers.flip_time += timers.stop_timer();
     total_bound_flips += num_flipped;
 
-    delta_xB_0_sparse.clear();
-    if (num_flipped > 0) {
-      timers.start_timer();
-      phase2::adjust_for_flips(ft,
-                               basic_list,
-                               delta_z_indices,
-                               atilde_index,
-                               atilde,
-                               atilde_mark,
-                               atilde_sparse,
-                               delta_xB_0_sparse,
-                               delta_x_flip,
-                               x,
-                               phase2_work_estimate);
-      timers.ftran_time += timers.stop_timer();
-    }
-
     timers.start_timer();
+    // The FTRANs of the iteration are independent: the bound flip rhs, the entering column and
+    // the steepest edge rhs. Solve them as one batch, in that order
+    delta_xB_0_sparse.clear();
     utilde_sparse.clear();
     scaled_delta_xB_sparse.clear();
+    v_sparse.clear();
     rhs_sparse.from_csc_column(lp.A, entering_index);
     {
       PHASE2_NVTX_RANGE("DualSimplex::ftran");
+      std::vector<const sparse_vector_t<i_t, f_t>*> ftran_rhs;
+      std::vector<sparse_vector_t<i_t, f_t>*> ftran_solution;
+      std::vector<sparse_vector_t<i_t, f_t>*> ftran_Lsol;
+      if (num_flipped > 0) {
+        phase2::flip_rhs(atilde_index, atilde, atilde_sparse, phase2_work_estimate);
+        ftran_rhs.push_back(&atilde_sparse);
+        ftran_solution.push_back(&delta_xB_0_sparse);
+        ftran_Lsol.push_back(nullptr);
+      }
+      ftran_rhs.push_back(&rhs_sparse);
+      ftran_solution.push_back(&scaled_delta_xB_sparse);
+      ftran_Lsol.push_back(&utilde_sparse);
+      ftran_rhs.push_back(&delta_y_sparse);
+      ftran_solution.push_back(&v_sparse);
+      ftran_Lsol.push_back(nullptr);
+      ft.b_solve_batch(ftran_rhs, ftran_solution, ftran_Lsol, settings.lu_num_threads);
+
+      if (num_flipped > 0) {
+        phase2::adjust_for_flips(basic_list,
+                                 delta_z_indices,
+                                 atilde_index,
+                                 atilde,
+                                 atilde_mark,
+                                 delta_xB_0_sparse,
+                                 delta_x_flip,
+                                 x,
+                                 phase2_work_estimate);
+      }
       if (phase2::compute_delta_x(lp,
                                   ft,
                                   entering_index,
@@ -3263,7 +3495,6 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     timers.start_timer();
     const i_t steepest_edge_status = phase2::update_steepest_edge_norms(settings,
                                                                         basic_list,
-                                                                        ft,
                                                                         direction,
                                                                         delta_y_sparse,
                                                                         steepest_edge_norm_check,
@@ -3353,6 +3584,19 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     phase2::clean_up_infeasibilities(
       squared_infeasibilities, infeasibility_indices, phase2_work_estimate);
 
+    if (use_bucket_pricing) {
+      // The norms and infeasibilities changed on these rows only
+      for (i_t k : scaled_delta_xB_sparse.i) {
+        infeasibility_buckets.mark(basic_list[k]);
+      }
+      for (i_t k : delta_xB_0_sparse.i) {
+        infeasibility_buckets.mark(basic_list[k]);
+      }
+      infeasibility_buckets.mark(entering_index);
+      infeasibility_buckets.mark(leaving_index);
+      phase2_work_estimate += scaled_delta_xB_sparse.i.size() + delta_xB_0_sparse.i.size();
+    }
+
 #if CHECK_PRIMAL_INFEASIBILITIES
     phase2::check_primal_infeasibilities(
       lp, settings, basic_list, x, squared_infeasibilities, infeasibility_indices);
@@ -3391,7 +3635,9 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     // Refactor or update the basis factorization
     {
       PHASE2_NVTX_RANGE("DualSimplex::basis_update");
-      bool should_refactor = ft.num_updates() > settings.refactor_frequency;
+      bool should_refactor = settings.adaptive_refactor
+                               ? ft.refactor_recommended()
+                               : ft.num_updates() > settings.refactor_frequency;
       if (!should_refactor) {
         i_t recommend_refactor = ft.update(utilde_sparse, UTsol_sparse, basic_leaving_index);
 #ifdef CHECK_UPDATE
@@ -3406,6 +3652,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
       if (should_refactor) {
         PHASE2_NVTX_RANGE("DualSimplex::refactorization");
         num_refactors++;
+        CUOPT_COUNTER_ADD("dual_simplex.refactors", 1);
         bool should_recompute_x = false;
         i_t refactor_status     = ft.refactor_basis(
           lp.A, settings, lp.lower, lp.upper, start_time, basic_list, nonbasic_list, vstatus);
@@ -3464,6 +3711,12 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                          squared_infeasibilities,
                                                          infeasibility_indices,
                                                          primal_infeasibility);
+        if (use_bucket_pricing) {
+          infeasibility_buckets.rebuild(squared_infeasibilities,
+                                        infeasibility_indices,
+                                        delta_y_steepest_edge,
+                                        phase2_work_estimate);
+        }
         phase2_work_estimate += 4 * m + 2 * n;
       }
 #ifdef CHECK_BASIC_INFEASIBILITIES
@@ -3489,6 +3742,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
 #endif
 
     iter++;
+    CUOPT_COUNTER_ADD("dual_simplex.iterations", 1);
 
     // Clear delta_z
     phase2_work_estimate += 3 * delta_z_indices.size();
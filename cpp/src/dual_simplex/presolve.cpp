@@ -434,7 +434,7 @@ i_t find_dependent_rows(lp_problem_t<i_t, f_t>& problem,
 
   // Form C = A'
   csc_matrix_t<i_t, f_t> C(n, m, 1);
-  problem.A.transpose(C);
+  problem.A.transpose(C, settings.num_threads);
   assert(C.col_start[m] == nz);
 
   // Calculate L*U = C(p, :)
@@ -623,7 +623,7 @@ void convert_user_problem(const user_problem_t<i_t, f_t>& user_problem,
   constexpr bool run_bounds_strengthening = false;
   if constexpr (run_bounds_strengthening) {
     csr_matrix_t<i_t, f_t> Arow(1, 1, 1);
-    problem.A.to_compressed_row(Arow);
+    problem.A.to_compressed_row(Arow, settings.num_threads);
 
     settings.log.printf("Running bound strengthening\n");
 
@@ -719,7 +719,7 @@ void convert_user_problem(const user_problem_t<i_t, f_t>& user_problem,
       i_t dual_cols = problem.num_rows + problem.num_cols + num_upper_bounds;
       lp_problem_t<i_t, f_t> dual_problem(problem.handle_ptr, 1, 1, 0);
       csc_matrix_t<i_t, f_t> dual_constraint_matrix(1, 1, 0);
-      problem.A.transpose(dual_constraint_matrix);
+      problem.A.transpose(dual_constraint_matrix, settings.num_threads);
       // dual_constraint_matrix <- [-A^T I I]
       dual_constraint_matrix.m = dual_rows;
       dual_constraint_matrix.n = dual_cols;
@@ -911,7 +911,7 @@ i_t presolve(const lp_problem_t<i_t, f_t>& original,
   i_t num_empty_rows = 0;
   {
     csr_matrix_t<i_t, f_t> Arow(0, 0, 0);
-    problem.A.to_compressed_row(Arow);
+    problem.A.to_compressed_row(Arow, settings.num_threads);
     for (i_t i = 0; i < problem.num_rows; i++) {
       if (Arow.row_start[i + 1] - Arow.row_start[i] == 0) { num_empty_rows++; }
     }
@@ -1111,7 +1111,7 @@ i_t presolve(const lp_problem_t<i_t, f_t>& original,
       const i_t num_dependent_rows = problem.num_rows - independent_rows;
       settings.log.printf("%d dependent rows\n", num_dependent_rows);
       csr_matrix_t<i_t, f_t> Arow(0, 0, 0);
-      problem.A.to_compressed_row(Arow);
+      problem.A.to_compressed_row(Arow, settings.num_threads);
       remove_rows(problem, row_sense, Arow, dependent_rows, false);
     }
     settings.log.printf("Dependent row check in %.2fs\n", toc(dependent_row_start));
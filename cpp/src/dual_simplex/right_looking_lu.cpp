@@ -13,6 +13,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 
 using cuopt::ins_vector;
@@ -383,6 +384,206 @@ void update_Rdegree_and_row_count(i_t pivot_i,
   Rdegree[pivot_i] = -1;
 }
 
+// Appends the fill-in element (i, j) with value x at the end of column j and row i, and moves row i
+// and column j to their new degree lists
+template <typename i_t, typename f_t>
+void append_fill(i_t i,
+                 i_t j,
+                 f_t x,
+                 i_t pivot_p,
+                 element_t<i_t, f_t>*& pivot_entry,
+                 i_t& col_last,
+                 std::vector<i_t>& first_in_col,
+                 std::vector<i_t>& first_in_row,
+                 std::vector<i_t>& row_last_workspace,
+                 std::vector<f_t>& max_in_column,
+                 std::vector<f_t>& max_in_row,
+                 std::vector<i_t>& Rdegree,
+                 std::vector<i_t>& Cdegree,
+                 std::vector<std::vector<i_t>>& row_count,
+                 std::vector<std::vector<i_t>>& col_count,
+                 std::vector<element_t<i_t, f_t>>& elements,
+                 f_t& work_estimate)
+{
+  element_t<i_t, f_t> fill;
+  fill.i              = i;
+  fill.j              = j;
+  fill.x              = x;
+  const f_t abs_fillx = std::abs(fill.x);
+  if (abs_fillx > max_in_column[j]) { max_in_column[j] = abs_fillx; }
+#ifdef THRESHOLD_ROOK_PIVOTING
+  if (abs_fillx > max_in_row[i]) { max_in_row[i] = abs_fillx; }
+#endif
+  fill.next_in_column = kNone;
+  fill.next_in_row    = kNone;
+  elements.push_back(fill);
+  pivot_entry = &elements[pivot_p];  // push_back could cause a realloc so need to get a new pointer
+  i_t fill_p = elements.size() - 1;
+  assert(elements[fill_p].x == fill.x);
+  if (col_last != kNone) {
+    elements[col_last].next_in_column = fill_p;
+  } else {
+    first_in_col[j] = fill_p;
+  }
+  col_last     = fill_p;
+  i_t row_last = row_last_workspace[i];
+  if (row_last != kNone) {
+    elements[row_last].next_in_row = fill_p;
+  } else {
+    first_in_row[i] = fill_p;
+  }
+  row_last_workspace[i] = fill_p;
+  i_t rdeg              = Rdegree[i];  // Rdgree must increase
+  for (typename std::vector<i_t>::iterator it = row_count[rdeg].begin();
+       it != row_count[rdeg].end();
+       it++) {
+    if (*it == i) {
+      // Remove row i from row_count[rdeg]
+      std::swap(*it, row_count[rdeg].back());
+      row_count[rdeg].pop_back();
+      work_estimate += 2 * (it - row_count[rdeg].begin());
+      break;
+    }
+  }
+  rdeg = ++Rdegree[i];           // Increase rdeg
+  row_count[rdeg].push_back(i);  // Add row i to row_count[rdeg]
+
+  i_t cdeg = Cdegree[j];  // Cdegree must increase
+  for (typename std::vector<i_t>::iterator it = col_count[cdeg].begin();
+       it != col_count[cdeg].end();
+       it++) {
+    if (*it == j) {
+      // Remove col j from col_count[cdeg]
+      std::swap(*it, col_count[cdeg].back());
+      col_count[cdeg].pop_back();
+      work_estimate += 2 * (it - col_count[cdeg].begin());
+      break;
+    }
+  }
+  cdeg = ++Cdegree[j];           // Increase Cdegree
+  col_count[cdeg].push_back(j);  // Add column j to col_count[cdeg]
+}
+
+// Number of Schur complement updates (pivot row length times pivot column length) below which
+// the parallel update is not worth the thread synchronization
+constexpr int kParallelSchurWork = 4096;
+
+// Same update as the loop over the pivot row in schur_complement, with the columns of the pivot row
+// split across threads. A column is only written by the thread that owns it; fill-in is recorded
+// and linked afterwards in the sequential order, so the elements, their order and work_estimate
+// are bitwise identical to the sequential update for any number of threads
+template <typename i_t, typename f_t>
+void parallel_schur_update(i_t pivot_i,
+                           i_t pivot_j,
+                           f_t drop_tol,
+                           f_t pivot_val,
+                           i_t pivot_p,
+                           element_t<i_t, f_t>*& pivot_entry,
+                           std::vector<i_t>& first_in_col,
+                           std::vector<i_t>& first_in_row,
+                           std::vector<i_t>& row_last_workspace,
+                           std::vector<i_t>& column_j_workspace,
+                           std::vector<f_t>& max_in_column,
+                           std::vector<f_t>& max_in_row,
+                           std::vector<i_t>& Rdegree,
+                           std::vector<i_t>& Cdegree,
+                           std::vector<std::vector<i_t>>& row_count,
+                           std::vector<std::vector<i_t>>& col_count,
+                           std::vector<element_t<i_t, f_t>>& elements,
+                           i_t num_threads,
+                           f_t& work_estimate)
+{
+  // l = A(:, pivot_j) / pivot_val below the pivot. column_j_workspace maps a row to its position
+  std::vector<i_t> l_rows;
+  std::vector<f_t> l_vals;
+  l_rows.reserve(Cdegree[pivot_j]);
+  l_vals.reserve(Cdegree[pivot_j]);
+  for (i_t p1 = first_in_col[pivot_j]; p1 != kNone; p1 = elements[p1].next_in_column) {
+    const element_t<i_t, f_t>* e = &elements[p1];
+    if (e->i == pivot_i) { continue; }
+    column_j_workspace[e->i] = l_rows.size();
+    l_rows.push_back(e->i);
+    l_vals.push_back(e->x / pivot_val);
+  }
+  // u = A(pivot_i, :) without the pivot
+  std::vector<i_t> u_cols;
+  std::vector<f_t> u_vals;
+  u_cols.reserve(Rdegree[pivot_i]);
+  u_vals.reserve(Rdegree[pivot_i]);
+  for (i_t p0 = first_in_row[pivot_i]; p0 != kNone; p0 = elements[p0].next_in_row) {
+    if (elements[p0].j == pivot_j) { continue; }
+    u_cols.push_back(elements[p0].j);
+    u_vals.push_back(elements[p0].x);
+  }
+  const i_t nl = l_rows.size();
+  const i_t nu = u_cols.size();
+
+  // Update the existing entries of each column and record where fill-in is needed
+  std::vector<i_t> col_last(nu, kNone);
+  std::vector<std::vector<i_t>> fill_positions(nu);
+#pragma omp parallel num_threads(num_threads)
+  {
+    std::vector<char> hit(nl, 0);
+#pragma omp for schedule(dynamic, 16)
+    for (i_t c = 0; c < nu; ++c) {
+      const i_t j  = u_cols[c];
+      const f_t uj = u_vals[c];
+      for (i_t p1 = first_in_col[j]; p1 != kNone; p1 = elements[p1].next_in_column) {
+        element_t<i_t, f_t>* e = &elements[p1];
+        col_last[c]            = p1;
+        const i_t pos          = column_j_workspace[e->i];
+        if (pos == kNone) { continue; }
+        hit[pos]      = 1;
+        const f_t val = l_vals[pos] * uj;
+        if (std::abs(val) < drop_tol) { continue; }
+        e->x -= val;
+        const f_t abs_ex = std::abs(e->x);
+        if (abs_ex > max_in_column[j]) { max_in_column[j] = abs_ex; }
+      }
+      for (i_t pos = 0; pos < nl; ++pos) {
+        if (hit[pos]) {
+          hit[pos] = 0;
+        } else if (std::abs(l_vals[pos] * uj) >= drop_tol) {
+          fill_positions[c].push_back(pos);
+        }
+      }
+    }
+  }
+
+  for (i_t pos = 0; pos < nl; ++pos) {
+    column_j_workspace[l_rows[pos]] = kNone;
+  }
+
+  // Link the fill-in in the order the sequential update creates it
+  for (i_t c = 0; c < nu; ++c) {
+    const i_t j  = u_cols[c];
+    const f_t uj = u_vals[c];
+    work_estimate += 5 * Cdegree[j];
+    for (const i_t pos : fill_positions[c]) {
+      const f_t val = l_vals[pos] * uj;
+      append_fill(l_rows[pos],
+                  j,
+                  -val,
+                  pivot_p,
+                  pivot_entry,
+                  col_last[c],
+                  first_in_col,
+                  first_in_row,
+                  row_last_workspace,
+                  max_in_column,
+                  max_in_row,
+                  Rdegree,
+                  Cdegree,
+                  row_count,
+                  col_count,
+                  elements,
+                  work_estimate);
+    }
+    work_estimate += 10 * Cdegree[pivot_j];
+    work_estimate += 5 * Cdegree[j];
+  }
+}
+
 template <typename i_t, typename f_t>
 void schur_complement(i_t pivot_i,
                       i_t pivot_j,
@@ -401,6 +602,7 @@ void schur_complement(i_t pivot_i,
                       std::vector<std::vector<i_t>>& row_count,
                       std::vector<std::vector<i_t>>& col_count,
                       std::vector<element_t<i_t, f_t>>& elements,
+                      i_t num_threads,
                       f_t& work_estimate)
 {
   for (i_t p1 = first_in_col[pivot_j]; p1 != kNone; p1 = elements[p1].next_in_column) {
@@ -415,6 +617,34 @@ void schur_complement(i_t pivot_i,
   }
   work_estimate += 4 * Cdegree[pivot_j];
 
+#ifndef THRESHOLD_ROOK_PIVOTING
+  // The row maxima of rook pivoting are shared between columns, so it keeps the sequential update
+  if (num_threads > 1 && Rdegree[pivot_i] > 1 &&
+      static_cast<int64_t>(Rdegree[pivot_i]) * Cdegree[pivot_j] >= kParallelSchurWork) {
+    parallel_schur_update(pivot_i,
+                          pivot_j,
+                          drop_tol,
+                          pivot_val,
+                          pivot_p,
+                          pivot_entry,
+                          first_in_col,
+                          first_in_row,
+                          row_last_workspace,
+                          column_j_workspace,
+                          max_in_column,
+                          max_in_row,
+                          Rdegree,
+                          Cdegree,
+                          row_count,
+                          col_count,
+                          elements,
+                          num_threads,
+                          work_estimate);
+    work_estimate += 10 * Rdegree[pivot_i];
+    return;
+  }
+#endif
+
   for (i_t p0 = first_in_row[pivot_i]; p0 != kNone; p0 = elements[p0].next_in_row) {
     element_t<i_t, f_t>* entry = &elements[p0];
     const i_t j                = entry->j;
@@ -449,64 +679,23 @@ void schur_complement(i_t pivot_i,
         if (abs_e2x > max_in_row[i]) { max_in_row[i] = abs_e2x; }
 #endif
       } else {
-        element_t<i_t, f_t> fill;
-        fill.i              = i;
-        fill.j              = j;
-        fill.x              = -val;
-        const f_t abs_fillx = std::abs(fill.x);
-        if (abs_fillx > max_in_column[j]) { max_in_column[j] = abs_fillx; }
-#ifdef THRESHOLD_ROOK_PIVOTING
-        if (abs_fillx > max_in_row[i]) { max_in_row[i] = abs_fillx; }
-#endif
-        fill.next_in_column = kNone;
-        fill.next_in_row    = kNone;
-        elements.push_back(fill);
-        pivot_entry =
-          &elements[pivot_p];  // push_back could cause a realloc so need to get a new pointer
-        i_t fill_p = elements.size() - 1;
-        assert(elements[fill_p].x == fill.x);
-        if (col_last != kNone) {
-          elements[col_last].next_in_column = fill_p;
-        } else {
-          first_in_col[j] = fill_p;
-        }
-        col_last     = fill_p;
-        i_t row_last = row_last_workspace[i];
-        if (row_last != kNone) {
-          elements[row_last].next_in_row = fill_p;
-        } else {
-          first_in_row[i] = fill_p;
-        }
-        row_last_workspace[i] = fill_p;
-        i_t rdeg              = Rdegree[i];  // Rdgree must increase
-        for (typename std::vector<i_t>::iterator it = row_count[rdeg].begin();
-             it != row_count[rdeg].end();
-             it++) {
-          if (*it == i) {
-            // Remove row i from row_count[rdeg]
-            std::swap(*it, row_count[rdeg].back());
-            row_count[rdeg].pop_back();
-            work_estimate += 2 * (it - row_count[rdeg].begin());
-            break;
-          }
-        }
-        rdeg = ++Rdegree[i];           // Increase rdeg
-        row_count[rdeg].push_back(i);  // Add row i to row_count[rdeg]
-
-        i_t cdeg = Cdegree[j];  // Cdegree must increase
-        for (typename std::vector<i_t>::iterator it = col_count[cdeg].begin();
-             it != col_count[cdeg].end();
-             it++) {
-          if (*it == j) {
-            // Remove col j from col_count[cdeg]
-            std::swap(*it, col_count[cdeg].back());
-            col_count[cdeg].pop_back();
-            work_estimate += 2 * (it - col_count[cdeg].begin());
-            break;
-          }
-        }
-        cdeg = ++Cdegree[j];           // Increase Cdegree
-        col_count[cdeg].push_back(j);  // Add column j to col_count[cdeg]
+        append_fill(i,
+                    j,
+                    -val,
+                    pivot_p,
+                    pivot_entry,
+                    col_last,
+                    first_in_col,
+                    first_in_row,
+                    row_last_workspace,
+                    max_in_column,
+                    max_in_row,
+                    Rdegree,
+                    Cdegree,
+                    row_count,
+                    col_count,
+                    elements,
+                    work_estimate);
       }
     }
     work_estimate += 10 * Cdegree[pivot_j];
@@ -799,6 +988,7 @@ i_t right_looking_lu(const csc_matrix_t<i_t, f_t>& A,
                      row_count,
                      col_count,
                      elements,
+                     settings.lu_num_threads,
                      work_estimate);
 
     // Remove the pivot row
@@ -1122,6 +1312,7 @@ i_t right_looking_lu_row_permutation_only(const csc_matrix_t<i_t, f_t>& A,
                                row_count,
                                col_count,
                                elements,
+                               settings.lu_num_threads,
                                work_estimate);
 
     // Remove the pivot row
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <string>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -41,6 +42,13 @@ struct diving_heuristics_settings_t {
 
   // The maximum backtracking allowed.
   i_t backtrack_limit = 5;
+
+  // 0 disabled, 1 enabled. Also dives from the start of the CPU dives with batch PDLP on the GPU,
+  // one node at a time, when the GPU is not busy with another dive
+  i_t gpu_diving = 0;
+
+  // The number of fractional variables whose two roundings the GPU dive solves at each step
+  i_t gpu_dive_width = 64;
 };
 
 template <typename i_t, typename f_t>
@@ -81,6 +89,12 @@ struct simplex_solver_settings_t {
       print_presolve_stats(true),
       barrier_presolve(false),
       cudss_deterministic(false),
+      cudss_hybrid_memory(false),
+      barrier_pcg(false),
+      barrier_pcg_tolerance(1e-8),
+      barrier_pcg_iteration_limit(1000),
+      barrier_mixed_precision(false),
+      pdhg_relative_tol(1e-4),
       deterministic(false),
       barrier(false),
       eliminate_dense_columns(true),
@@ -93,17 +107,33 @@ struct simplex_solver_settings_t {
       check_Q(false),
       crossover(false),
       refactor_frequency(100),
+      adaptive_refactor(false),
+      triangle_solve_threads(1),
+      gpu_row_product(false),
       iteration_log_frequency(1000),
       first_iteration_log(2),
       num_threads(omp_get_max_threads() - 1),
+      lu_num_threads(1),
+      pricing_num_threads(1),
+      bucket_pricing(-1),
       max_cut_passes(0),
       mir_cuts(-1),
       mixed_integer_gomory_cuts(-1),
       knapsack_cuts(-1),
+      clique_cuts(-1),
+      flow_cover_cuts(-1),
+      node_cut_depth(0),
       strong_chvatal_gomory_cuts(-1),
       reduced_cost_strengthening(-1),
+      symmetry(-1),
+      conflict_analysis(-1),
+      max_root_restarts(1),
+      root_restart_fraction(0.2),
       cut_change_threshold(1e-3),
       cut_min_orthogonality(0.5),
+      node_memory_limit(std::numeric_limits<f_t>::infinity()),
+      checkpoint_interval(600),
+      checkpoint_split(1),
       random_seed(0),
       reliability_branching(-1),
       inside_mip(0),
@@ -156,36 +186,65 @@ struct simplex_solver_settings_t {
   bool print_presolve_stats;  // true to print presolve stats
   bool barrier_presolve;      // true to use barrier presolve
   bool cudss_deterministic;   // true to use cuDSS deterministic mode, false for non-deterministic
+  bool cudss_hybrid_memory;   // true to keep the cuDSS factors in host memory (hybrid mode)
+  bool barrier_pcg;           // true to solve ADAT with Jacobi PCG instead of Cholesky
+  f_t barrier_pcg_tolerance;  // relative residual at which PCG stops
+  i_t barrier_pcg_iteration_limit;  // maximum number of PCG iterations per solve
+  bool barrier_mixed_precision;     // true to factor ADAT in FP32 and refine the solves in FP64
+  f_t pdhg_relative_tol;      // relative primal, dual and gap tolerance of PDHG on the host
   bool barrier;               // true to use barrier method, false to use dual simplex method
   bool deterministic;  // true to use B&B deterministic mode, false to use non-deterministic mode
   bool eliminate_dense_columns;  // true to eliminate dense columns from A*D*A^T
-  int num_gpus;   // Number of GPUs to use (maximum of 2 gpus are supported at the moment)
+  int num_gpus;   // Number of GPUs to use (concurrent mode gives all but one to barrier)
+  std::vector<int> barrier_device_ids;  // cuDSS devices, empty means the handle device
   i_t folding;    // -1 automatic, 0 don't fold, 1 fold
   i_t augmented;  // -1 automatic, 0 to solve with ADAT, 1 to solve with augmented system
   i_t dualize;    // -1 automatic, 0 to not dualize, 1 to dualize
-  i_t ordering;   // -1 automatic, 0 to use nested dissection, 1 to use AMD
+  i_t ordering;   // -1 automatic, 0 to use nested dissection, 1 to use AMD, 2 GPU nested dissection
   i_t barrier_dual_initial_point;  // -1 automatic, 0 to use Lustig, Marsten, and Shanno initial
                                    // point, 1 to use initial point form dual least squares problem
   bool check_Q;                    // true to check if Q is positive semidefinite
   bool crossover;                  // true to do crossover, false to not
   i_t refactor_frequency;          // number of basis updates before refactorization
+  bool adaptive_refactor;          // true to refactor when the average work per update grows
+  i_t triangle_solve_threads;      // threads of the level scheduled dense basis solves
+  bool gpu_row_product;  // true to compute the dense rows of phase 2 on the GPU (experimental)
   i_t iteration_log_frequency;     // number of iterations between log updates
   i_t first_iteration_log;         // number of iterations to log at beginning of solve
   i_t num_threads;                 // number of threads to use
+  i_t lu_num_threads;              // threads for the LU Schur updates and batched FTRANs
+  i_t pricing_num_threads;         // threads for the pricing, row computation and ratio test
+  i_t bucket_pricing;              // -1 automatic, 0 off, 1 to price infeasibilities in buckets
   i_t random_seed;                 // random seed
   i_t max_cut_passes;              // number of cut passes to make
   i_t mir_cuts;                    // -1 automatic, 0 to disable, >0 to enable MIR cuts
   i_t mixed_integer_gomory_cuts;   // -1 automatic, 0 to disable, >0 to enable mixed integer Gomory
                                    // cuts
   i_t knapsack_cuts;               // -1 automatic, 0 to disable, >0 to enable knapsack cuts
+  i_t clique_cuts;                 // -1 automatic, 0 to disable, >0 to enable clique cuts
+  i_t flow_cover_cuts;             // -1 automatic, 0 to disable, >0 to enable flow cover cuts
+  i_t node_cut_depth;              // nodes up to this depth separate Gomory cuts, 0 to disable
   i_t strong_chvatal_gomory_cuts;  // -1 automatic, 0 to disable, >0 to enable strong Chvatal Gomory
                                    // cuts
   i_t reduced_cost_strengthening;  // -1 automatic, 0 to disable, >0 to enable reduced cost
                                    // strengthening
+  i_t symmetry;                    // -1 automatic, 0 to disable, 1 to break the symmetries of the
+                                   // integer variables in branch-and-bound
+  i_t conflict_analysis;           // -1 automatic, 0 to disable, 1 to learn conflicts from the
+                                   // pruned nodes of branch-and-bound
+  i_t max_root_restarts;           // number of times the root cut loop may restart
+  f_t root_restart_fraction;       // restart the root when the reduced cost strengthening after
+                                   // strong branching fixes this fraction of the integer variables
   f_t cut_change_threshold;        // threshold for cut change
   f_t cut_min_orthogonality;       // minimum orthogonality for cuts
   i_t mip_batch_pdlp_strong_branching{0};  // 0 if not using batch PDLP for strong branching, 1 if
-                                           // using batch PDLP for strong branching
+                                           // using batch PDLP for strong branching at the root, 2
+                                           // if also using it for the reliability branching
+  f_t node_memory_limit;        // MB of bases the open nodes keep in memory before spilling to disk
+  std::string checkpoint_file;  // file the branch and bound search is saved to and resumed from
+  f_t checkpoint_interval;      // seconds between two checkpoints
+  i_t checkpoint_split;         // parts the checkpoint written at a limit is split into
+  std::string trace_file;       // binary trace of the tree search, see bb_trace_t, empty if none
 
   diving_heuristics_settings_t<i_t, f_t> diving_settings;  // Settings for the diving heuristics
 
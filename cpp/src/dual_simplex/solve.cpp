@@ -14,6 +14,7 @@
 #include <dual_simplex/basis_solves.hpp>
 #include <dual_simplex/crossover.hpp>
 #include <dual_simplex/initial_basis.hpp>
+#include <dual_simplex/pdhg.hpp>
 #include <dual_simplex/phase1.hpp>
 #include <dual_simplex/phase2.hpp>
 #include <dual_simplex/presolve.hpp>
@@ -663,6 +664,30 @@ lp_status_t solve_linear_program_with_barrier(const user_problem_t<i_t, f_t>& us
   return solve_linear_program_with_barrier(user_problem, settings, start_time, solution);
 }
 
+template <typename i_t, typename f_t>
+lp_status_t solve_linear_program_with_pdhg(const user_problem_t<i_t, f_t>& user_problem,
+                                           const simplex_solver_settings_t<i_t, f_t>& settings,
+                                           f_t start_time,
+                                           lp_solution_t<i_t, f_t>& solution)
+{
+  lp_problem_t<i_t, f_t> original_lp(user_problem.handle_ptr, 1, 1, 1);
+  std::vector<i_t> new_slacks;
+  dualize_info_t<i_t, f_t> dualize_info;
+  convert_user_problem(user_problem, settings, original_lp, new_slacks, dualize_info);
+  solution.resize(user_problem.num_rows, user_problem.num_cols);
+  lp_solution_t<i_t, f_t> lp_solution(original_lp.num_rows, original_lp.num_cols);
+  lp_status_t status = host_pdhg(original_lp, start_time, settings, lp_solution);
+  uncrush_primal_solution(user_problem, original_lp, lp_solution.x, solution.x);
+  uncrush_dual_solution(
+    user_problem, original_lp, lp_solution.y, lp_solution.z, solution.y, solution.z);
+  solution.objective          = lp_solution.objective;
+  solution.user_objective     = lp_solution.user_objective;
+  solution.iterations         = lp_solution.iterations;
+  solution.l2_primal_residual = lp_solution.l2_primal_residual;
+  solution.l2_dual_residual   = lp_solution.l2_dual_residual;
+  return status;
+}
+
 template <typename i_t, typename f_t>
 lp_status_t solve_linear_program(const user_problem_t<i_t, f_t>& user_problem,
                                  const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -804,6 +829,12 @@ template lp_status_t solve_linear_program_with_barrier(
   double start_time,
   lp_solution_t<int, double>& solution);
 
+template lp_status_t solve_linear_program_with_pdhg(
+  const user_problem_t<int, double>& user_problem,
+  const simplex_solver_settings_t<int, double>& settings,
+  double start_time,
+  lp_solution_t<int, double>& solution);
+
 template lp_status_t solve_linear_program(const user_problem_t<int, double>& user_problem,
                                           const simplex_solver_settings_t<int, double>& settings,
                                           lp_solution_t<int, double>& solution);
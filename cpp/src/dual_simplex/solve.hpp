@@ -96,6 +96,13 @@ lp_status_t solve_linear_program_with_barrier(const user_problem_t<i_t, f_t>& us
                                               f_t start_time,
                                               lp_solution_t<i_t, f_t>& solution);
 
+// Solve the LP with PDHG on the host, see host_pdhg
+template <typename i_t, typename f_t>
+lp_status_t solve_linear_program_with_pdhg(const user_problem_t<i_t, f_t>& user_problem,
+                                           const simplex_solver_settings_t<i_t, f_t>& settings,
+                                           f_t start_time,
+                                           lp_solution_t<i_t, f_t>& solution);
+
 template <typename i_t, typename f_t>
 lp_status_t solve_linear_program(const user_problem_t<i_t, f_t>& user_problem,
                                  const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -20,8 +20,12 @@
 // #include <utilities/cuda_helpers.cuh>
 #include <vector>
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -78,59 +82,141 @@ i_t coo_to_csc(const std::vector<i_t>& Ai,
   return 0;
 }
 
+// Below this many nonzeros a transpose runs on one thread
+constexpr int kParallelTransposeNnz = 1 << 16;
+
+// Counting sort transpose of the major compressed vectors start, index, value into the minor
+// compressed vectors of the transpose. The entries of a transposed vector are sorted by major
+// index.
+//
+// In parallel, the major vectors are split into blocks of about equal nonzeros and each block
+// counts its entries per minor index, which gives every block its slots in each transposed vector,
+// so the result matches the sequential one. The num_blocks * minor counts are limited to nz
+// entries, and the transpose stays sequential inside an active parallel region.
 template <typename i_t, typename f_t>
-i_t csc_matrix_t<i_t, f_t>::to_compressed_row(csr_matrix_t<i_t, f_t>& Arow) const
+void transpose_compressed(i_t major,
+                          i_t minor,
+                          const std::vector<i_t>& start,
+                          const std::vector<i_t>& index,
+                          const std::vector<f_t>& value,
+                          std::vector<i_t>& transpose_start,
+                          std::vector<i_t>& transpose_index,
+                          std::vector<f_t>& transpose_value,
+                          i_t num_threads)
 {
-  i_t m = Arow.m = this->m;
-  i_t n = Arow.n = this->n;
-  i_t nz         = this->col_start[n];
-  Arow.row_start.resize(m + 1);
-  Arow.j.resize(nz);
-  Arow.x.resize(nz);
+  const i_t nz = start[major];
+  transpose_start.resize(minor + 1);
+  transpose_index.resize(nz);
+  transpose_value.resize(nz);
+
+  i_t num_blocks = 1;
+  if (num_threads > 1 && nz >= kParallelTransposeNnz && !omp_in_parallel()) {
+    num_blocks = std::min(num_threads, nz / std::max<i_t>(minor, 1));
+  }
+  if (num_blocks <= 1) {
+    std::vector<i_t> workspace(minor, 0);
+    for (i_t p = 0; p < nz; ++p) {
+      workspace[index[p]]++;
+    }
+    cumulative_sum(workspace, transpose_start);
+    for (i_t j = 0; j < major; ++j) {
+      const i_t vector_start = start[j];
+      const i_t vector_end   = start[j + 1];
+      for (i_t p = vector_start; p < vector_end; ++p) {
+        const i_t q        = workspace[index[p]]++;
+        transpose_index[q] = j;
+        transpose_value[q] = value[p];
+      }
+    }
+    return;
+  }
 
-  std::vector<i_t> workspace(m, 0);
-  for (i_t p = 0; p < nz; ++p) {
-    workspace[this->i[p]]++;
+  std::vector<i_t> block_start(num_blocks + 1);
+  for (i_t b = 0; b <= num_blocks; ++b) {
+    const i_t target = static_cast<int64_t>(nz) * b / num_blocks;
+    block_start[b] =
+      std::lower_bound(start.begin(), start.begin() + major, target) - start.begin();
   }
-  cumulative_sum(workspace, Arow.row_start);
-  for (i_t j = 0; j < n; ++j) {
-    i_t col_start = this->col_start[j];
-    i_t col_end   = this->col_start[j + 1];
-    for (i_t p = col_start; p < col_end; ++p) {
-      i_t q     = workspace[this->i[p]]++;
-      Arow.j[q] = j;
-      Arow.x[q] = this->x[p];
+  block_start[num_blocks] = major;
+
+  std::vector<i_t> counts(static_cast<size_t>(num_blocks) * minor, 0);
+#pragma omp parallel for num_threads(num_blocks) schedule(static, 1)
+  for (i_t b = 0; b < num_blocks; ++b) {
+    i_t* block_counts = counts.data() + static_cast<size_t>(b) * minor;
+    for (i_t p = start[block_start[b]]; p < start[block_start[b + 1]]; ++p) {
+      block_counts[index[p]]++;
+    }
+  }
+
+  // The counts become the offset of each block in the transposed vectors
+#pragma omp parallel for num_threads(num_blocks) schedule(static)
+  for (i_t i = 0; i < minor; ++i) {
+    i_t offset = 0;
+    for (i_t b = 0; b < num_blocks; ++b) {
+      const size_t k = static_cast<size_t>(b) * minor + i;
+      const i_t c    = counts[k];
+      counts[k]      = offset;
+      offset += c;
+    }
+    transpose_start[i] = offset;
+  }
+  i_t total = 0;
+  for (i_t i = 0; i < minor; ++i) {
+    const i_t count    = transpose_start[i];
+    transpose_start[i] = total;
+    total += count;
+  }
+  transpose_start[minor] = total;
+
+#pragma omp parallel for num_threads(num_blocks) schedule(static, 1)
+  for (i_t b = 0; b < num_blocks; ++b) {
+    i_t* block_offsets = counts.data() + static_cast<size_t>(b) * minor;
+    for (i_t j = block_start[b]; j < block_start[b + 1]; ++j) {
+      const i_t vector_start = start[j];
+      const i_t vector_end   = start[j + 1];
+      for (i_t p = vector_start; p < vector_end; ++p) {
+        const i_t i        = index[p];
+        const i_t q        = transpose_start[i] + block_offsets[i]++;
+        transpose_index[q] = j;
+        transpose_value[q] = value[p];
+      }
     }
   }
-  assert(Arow.row_start[m] == nz);
-  return 0;
 }
 
 template <typename i_t, typename f_t>
-i_t csr_matrix_t<i_t, f_t>::to_compressed_col(csc_matrix_t<i_t, f_t>& Acol) const
+i_t csc_matrix_t<i_t, f_t>::to_compressed_row(csr_matrix_t<i_t, f_t>& Arow, i_t num_threads) const
 {
-  i_t m = Acol.m = this->m;
-  i_t n = Acol.n = this->n;
-  i_t nz         = this->row_start[m];
-  Acol.col_start.resize(n + 1);
-  Acol.i.resize(nz);
-  Acol.x.resize(nz);
+  Arow.m = this->m;
+  Arow.n = this->n;
+  transpose_compressed(this->n,
+                       this->m,
+                       this->col_start,
+                       this->i,
+                       this->x,
+                       Arow.row_start,
+                       Arow.j,
+                       Arow.x,
+                       num_threads);
+  assert(Arow.row_start[Arow.m] == this->col_start[this->n]);
+  return 0;
+}
 
-  std::vector<i_t> workspace(n, 0);
-  for (i_t p = 0; p < nz; ++p) {
-    workspace[this->j[p]]++;
-  }
-  cumulative_sum(workspace, Acol.col_start);
-  for (i_t i = 0; i < m; ++i) {
-    i_t row_start = this->row_start[i];
-    i_t row_end   = this->row_start[i + 1];
-    for (i_t p = row_start; p < row_end; ++p) {
-      i_t q     = workspace[this->j[p]]++;
-      Acol.i[q] = i;
-      Acol.x[q] = this->x[p];
-    }
-  }
-  assert(Acol.col_start[n] == nz);
+template <typename i_t, typename f_t>
+i_t csr_matrix_t<i_t, f_t>::to_compressed_col(csc_matrix_t<i_t, f_t>& Acol, i_t num_threads) const
+{
+  Acol.m = this->m;
+  Acol.n = this->n;
+  transpose_compressed(this->m,
+                       this->n,
+                       this->row_start,
+                       this->j,
+                       this->x,
+                       Acol.col_start,
+                       Acol.i,
+                       Acol.x,
+                       num_threads);
+  assert(Acol.col_start[Acol.n] == this->row_start[this->m]);
   return 0;
 }
 
@@ -213,29 +299,14 @@ void csc_matrix_t<i_t, f_t>::append_column(i_t x_nz, i_t* i, f_t* x)
 
 // Work = 6*nz + 2*n
 template <typename i_t, typename f_t>
-i_t csc_matrix_t<i_t, f_t>::transpose(csc_matrix_t<i_t, f_t>& AT) const
+i_t csc_matrix_t<i_t, f_t>::transpose(csc_matrix_t<i_t, f_t>& AT, i_t num_threads) const
 {
-  AT.m   = this->n;
-  AT.n   = this->m;
-  i_t nz = this->col_start[this->n];
-  AT.col_start.resize(AT.n + 1);
-  AT.reallocate(nz);
-
-  std::vector<i_t> workspace(AT.n, 0);
-  for (i_t p = 0; p < nz; ++p) {
-    workspace[this->i[p]]++;
-  }
-  cumulative_sum(workspace, AT.col_start);
-  for (i_t j = 0; j < this->n; j++) {
-    i_t col_start = this->col_start[j];
-    i_t col_end   = this->col_start[j + 1];
-    for (i_t p = col_start; p < col_end; ++p) {
-      i_t q   = workspace[this->i[p]]++;
-      AT.i[q] = j;
-      AT.x[q] = this->x[p];
-    }
-  }
-  assert(AT.col_start[AT.n] == nz);
+  AT.m = this->n;
+  AT.n = this->m;
+  transpose_compressed(
+    this->n, this->m, this->col_start, this->i, this->x, AT.col_start, AT.i, AT.x, num_threads);
+  AT.nz_max = this->col_start[this->n];
+  assert(AT.col_start[AT.n] == AT.nz_max);
   return 0;
 }
 
@@ -993,4 +1064,11 @@ matrix_transpose_vector_multiply<int, double, std::allocator<double>, std::alloc
 
 #endif
 
+#if defined(DUAL_SIMPLEX_INSTANTIATE_DOUBLE) && PDLP_INSTANTIATE_INT64
+// Host copy of the problems PDLP solves with 64-bit indices, see problem_t::get_host_user_problem
+template class csc_matrix_t<int64_t, double>;
+
+template class csr_matrix_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::dual_simplex
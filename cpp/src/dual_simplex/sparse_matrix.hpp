@@ -49,9 +49,9 @@ class csc_matrix_t {
   void reallocate(i_t new_nz);
 
   i_t nnz() const { return col_start[n]; }
-  // Convert the CSC matrix to a CSR matrix
-  i_t to_compressed_row(
-    cuopt::linear_programming::dual_simplex::csr_matrix_t<i_t, f_t>& Arow) const;
+  // Convert the CSC matrix to a CSR matrix, on num_threads threads for large matrices
+  i_t to_compressed_row(cuopt::linear_programming::dual_simplex::csr_matrix_t<i_t, f_t>& Arow,
+                        i_t num_threads = 1) const;
 
   // Permutes rows of a sparse matrix A. Computes C = A(p, :)
   i_t permute_rows(const std::vector<i_t>& pinv, csc_matrix_t<i_t, f_t>& C) const;
@@ -64,8 +64,8 @@ class csc_matrix_t {
   // Aj <- A(:, j), where Aj is a dense vector initially all zero
   i_t load_a_column(i_t j, std::vector<f_t>& Aj) const;
 
-  // Compute the transpose of A
-  i_t transpose(csc_matrix_t<i_t, f_t>& AT) const;
+  // Compute the transpose of A, on num_threads threads for large matrices
+  i_t transpose(csc_matrix_t<i_t, f_t>& AT, i_t num_threads = 1) const;
 
   // Append a dense column to the matrix. Assumes the matrix has already been
   // resized accordingly
@@ -145,8 +145,8 @@ class csr_matrix_t {
   {
   }
 
-  // Convert the CSR matrix to CSC
-  i_t to_compressed_col(csc_matrix_t<i_t, f_t>& Acol) const;
+  // Convert the CSR matrix to CSC, on num_threads threads for large matrices
+  i_t to_compressed_col(csc_matrix_t<i_t, f_t>& Acol, i_t num_threads = 1) const;
 
   // Create a new matrix with the marked rows removed
   i_t remove_rows(std::vector<i_t>& row_marker, csr_matrix_t<i_t, f_t>& Aout) const;
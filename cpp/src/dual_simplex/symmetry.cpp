@@ -0,0 +1,520 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/symmetry.hpp>
+
+#include <dual_simplex/folding.hpp>
+#include <dual_simplex/tic_toc.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <tuple>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+constexpr int max_levels     = 64;   // leaders of the stabilizer chain
+constexpr int max_classes    = 8;    // color classes tried for the leader of a level
+constexpr int max_candidates = 256;  // images of the leader tried in a class
+constexpr int max_depth      = 16;   // individualizations to find one automorphism
+
+// 0.0 and -0.0 get the same bits
+template <typename f_t>
+uint64_t value_bits(f_t value)
+{
+  const f_t normalized = value + f_t(0);
+  uint64_t bits        = 0;
+  std::memcpy(&bits, &normalized, sizeof(f_t));
+  return bits;
+}
+
+template <typename i_t>
+struct union_find_t {
+  explicit union_find_t(i_t n) : parent(n) { reset(); }
+
+  void reset() { std::iota(parent.begin(), parent.end(), 0); }
+
+  i_t find(i_t v)
+  {
+    while (parent[v] != v) {
+      parent[v] = parent[parent[v]];
+      v         = parent[v];
+    }
+    return v;
+  }
+
+  void unite(i_t a, i_t b) { parent[find(a)] = find(b); }
+
+  std::vector<i_t> parent;
+};
+
+// Color refinement of the bipartite graph of A, where the columns are the vertices 0 to n - 1 and
+// the rows the vertices n to n + m - 1. A new color is the rank of the pair (color, hash of the
+// sorted colors and coefficients of the neighbors), which does not depend on the labels of the
+// vertices: two copies of the graph individualized on vertices of the same orbit keep the same
+// colors on the vertices that an automorphism maps onto each other.
+template <typename i_t, typename f_t>
+class color_refinement_t {
+ public:
+  color_refinement_t(const lp_problem_t<i_t, f_t>& problem,
+                     const csr_matrix_t<i_t, f_t>& Arow,
+                     size_t work_limit)
+    : A(problem.A),
+      Arow(Arow),
+      m(problem.num_rows),
+      n(problem.num_cols),
+      work_limit(work_limit),
+      keys(problem.num_rows + problem.num_cols),
+      new_colors(problem.num_rows + problem.num_cols)
+  {
+  }
+
+  // Refines the colors until their number is stable. Returns false once the work limit is reached
+  bool refine(std::vector<i_t>& colors, i_t& num_colors)
+  {
+    const i_t num_vertices = n + m;
+    while (true) {
+      if (work > work_limit) { return false; }
+      for (i_t j = 0; j < n; ++j) {
+        const uint64_t hash = signature(colors, A.col_start[j], A.col_start[j + 1], A.i, A.x, n);
+        keys[j]             = {colors[j], hash, j};
+      }
+      for (i_t i = 0; i < m; ++i) {
+        const uint64_t hash =
+          signature(colors, Arow.row_start[i], Arow.row_start[i + 1], Arow.j, Arow.x, 0);
+        keys[n + i] = {colors[n + i], hash, n + i};
+      }
+      std::sort(keys.begin(), keys.end());
+      work += 2 * static_cast<size_t>(A.col_start[n]) + 4 * static_cast<size_t>(num_vertices);
+
+      i_t next_color = -1;
+      for (i_t k = 0; k < num_vertices; ++k) {
+        if (k == 0 || std::get<0>(keys[k]) != std::get<0>(keys[k - 1]) ||
+            std::get<1>(keys[k]) != std::get<1>(keys[k - 1])) {
+          ++next_color;
+        }
+        new_colors[std::get<2>(keys[k])] = next_color;
+      }
+      std::copy(new_colors.begin(), new_colors.end(), colors.begin());
+      const bool stable = next_color + 1 == num_colors;
+      num_colors        = next_color + 1;
+      if (stable) { return true; }
+    }
+  }
+
+  // Gives vertex v a color of its own
+  static void individualize(std::vector<i_t>& colors, i_t& num_colors, i_t v)
+  {
+    colors[v] = num_colors++;
+  }
+
+  size_t work{0};
+
+ private:
+  uint64_t signature(const std::vector<i_t>& colors,
+                     i_t start,
+                     i_t end,
+                     const std::vector<i_t>& neighbors,
+                     const std::vector<f_t>& values,
+                     i_t offset)
+  {
+    entries.clear();
+    for (i_t p = start; p < end; ++p) {
+      entries.emplace_back(colors[offset + neighbors[p]], value_bits(values[p]));
+    }
+    std::sort(entries.begin(), entries.end());
+    uint64_t hash = 0;
+    for (const auto& [color, bits] : entries) {
+      hash = hash_combine(hash_combine(hash, static_cast<uint64_t>(color)), bits);
+    }
+    return hash;
+  }
+
+  const csc_matrix_t<i_t, f_t>& A;
+  const csr_matrix_t<i_t, f_t>& Arow;
+  const i_t m;
+  const i_t n;
+  const size_t work_limit;
+
+  std::vector<std::tuple<i_t, uint64_t, i_t>> keys;
+  std::vector<std::pair<i_t, uint64_t>> entries;
+  std::vector<i_t> new_colors;
+};
+
+template <typename i_t, typename f_t>
+class automorphism_search_t {
+ public:
+  automorphism_search_t(const lp_problem_t<i_t, f_t>& problem,
+                        const csr_matrix_t<i_t, f_t>& Arow,
+                        const std::vector<variable_type_t>& var_types,
+                        color_refinement_t<i_t, f_t>& refinement)
+    : perm(problem.num_rows + problem.num_cols),
+      problem(problem),
+      Arow(Arow),
+      var_types(var_types),
+      refinement(refinement),
+      m(problem.num_rows),
+      n(problem.num_cols),
+      colors_a(problem.num_rows + problem.num_cols),
+      colors_b(problem.num_rows + problem.num_cols),
+      row_mark(problem.num_rows, 0),
+      col_mark(problem.num_cols, 0),
+      col_value(problem.num_cols)
+  {
+  }
+
+  // Looks for an automorphism that maps column l onto column c and fixes the colors of the
+  // equitable partition base. On success it is in perm, over the columns and then the rows
+  bool find(i_t l, i_t c, const std::vector<i_t>& base, i_t base_colors)
+  {
+    using refinement_t = color_refinement_t<i_t, f_t>;
+    colors_a           = base;
+    colors_b           = base;
+    i_t num_colors_a   = base_colors;
+    i_t num_colors_b   = base_colors;
+    refinement_t::individualize(colors_a, num_colors_a, l);
+    refinement_t::individualize(colors_b, num_colors_b, c);
+
+    for (int depth = 0; depth < max_depth; ++depth) {
+      if (!refinement.refine(colors_a, num_colors_a)) { return false; }
+      if (!refinement.refine(colors_b, num_colors_b)) { return false; }
+      if (num_colors_a != num_colors_b) { return false; }
+      sort_by_color(colors_a, num_colors_a, start_a, order_a);
+      sort_by_color(colors_b, num_colors_b, start_b, order_b);
+
+      // Vertices in a color of both copies are kept, the others are paired in order. The first
+      // color with a choice gives the next individualization if the pairing is not an automorphism
+      i_t split_a = -1;
+      i_t split_b = -1;
+      for (i_t k = 0; k < num_colors_a; ++k) {
+        if (start_a[k + 1] - start_a[k] != start_b[k + 1] - start_b[k]) { return false; }
+        only_a.clear();
+        only_b.clear();
+        i_t p = start_a[k];
+        i_t q = start_b[k];
+        while (p < start_a[k + 1] || q < start_b[k + 1]) {
+          if (q == start_b[k + 1] || (p < start_a[k + 1] && order_a[p] < order_b[q])) {
+            only_a.push_back(order_a[p++]);
+          } else if (p == start_a[k + 1] || order_b[q] < order_a[p]) {
+            only_b.push_back(order_b[q++]);
+          } else {
+            perm[order_a[p]] = order_a[p];
+            ++p;
+            ++q;
+          }
+        }
+        for (size_t t = 0; t < only_a.size(); ++t) {
+          perm[only_a[t]] = only_b[t];
+        }
+        if (split_a < 0 && only_a.size() > 1) {
+          split_a = only_a[0];
+          split_b = only_b[0];
+        }
+      }
+      refinement.work += 2 * static_cast<size_t>(n + m);
+
+      if (verify()) { return true; }
+      if (split_a < 0) { return false; }
+      refinement_t::individualize(colors_a, num_colors_a, split_a);
+      refinement_t::individualize(colors_b, num_colors_b, split_b);
+    }
+    return false;
+  }
+
+  std::vector<i_t> perm;
+
+ private:
+  void sort_by_color(const std::vector<i_t>& colors,
+                     i_t num_colors,
+                     std::vector<i_t>& start,
+                     std::vector<i_t>& order)
+  {
+    start.assign(num_colors + 1, 0);
+    for (i_t color : colors) {
+      ++start[color + 1];
+    }
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    order.resize(colors.size());
+    next.assign(start.begin(), start.end() - 1);
+    for (i_t v = 0; v < static_cast<i_t>(colors.size()); ++v) {
+      order[next[colors[v]]++] = v;
+    }
+  }
+
+  // Checks that perm maps the columns onto columns of the same type, bounds and cost, and each
+  // row onto a row with the same right-hand side and the permuted coefficients
+  bool verify()
+  {
+    const csc_matrix_t<i_t, f_t>& A = problem.A;
+    ++row_stamp;
+    rows.clear();
+    for (i_t j = 0; j < n; ++j) {
+      const i_t k = perm[j];
+      if (k == j) { continue; }
+      if (var_types[j] != var_types[k] || problem.objective[j] != problem.objective[k] ||
+          problem.lower[j] != problem.lower[k] || problem.upper[j] != problem.upper[k]) {
+        return false;
+      }
+      for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+        if (row_mark[A.i[p]] != row_stamp) {
+          row_mark[A.i[p]] = row_stamp;
+          rows.push_back(A.i[p]);
+        }
+      }
+    }
+    for (i_t i = 0; i < m; ++i) {
+      if (perm[n + i] != n + i && row_mark[i] != row_stamp) {
+        row_mark[i] = row_stamp;
+        rows.push_back(i);
+      }
+    }
+
+    for (i_t i : rows) {
+      const i_t image = perm[n + i] - n;
+      refinement.work += 2 * static_cast<size_t>(Arow.row_start[i + 1] - Arow.row_start[i]);
+      if (problem.rhs[i] != problem.rhs[image]) { return false; }
+      if (Arow.row_start[i + 1] - Arow.row_start[i] !=
+          Arow.row_start[image + 1] - Arow.row_start[image]) {
+        return false;
+      }
+      ++col_stamp;
+      for (i_t p = Arow.row_start[image]; p < Arow.row_start[image + 1]; ++p) {
+        col_mark[Arow.j[p]]  = col_stamp;
+        col_value[Arow.j[p]] = Arow.x[p];
+      }
+      for (i_t p = Arow.row_start[i]; p < Arow.row_start[i + 1]; ++p) {
+        const i_t k = perm[Arow.j[p]];
+        if (col_mark[k] != col_stamp || col_value[k] != Arow.x[p]) { return false; }
+      }
+    }
+    return true;
+  }
+
+  const lp_problem_t<i_t, f_t>& problem;
+  const csr_matrix_t<i_t, f_t>& Arow;
+  const std::vector<variable_type_t>& var_types;
+  color_refinement_t<i_t, f_t>& refinement;
+  const i_t m;
+  const i_t n;
+
+  std::vector<i_t> colors_a;
+  std::vector<i_t> colors_b;
+  std::vector<i_t> start_a;
+  std::vector<i_t> start_b;
+  std::vector<i_t> order_a;
+  std::vector<i_t> order_b;
+  std::vector<i_t> only_a;
+  std::vector<i_t> only_b;
+  std::vector<i_t> next;
+
+  std::vector<i_t> rows;
+  std::vector<int64_t> row_mark;
+  std::vector<int64_t> col_mark;
+  std::vector<f_t> col_value;
+  int64_t row_stamp{0};
+  int64_t col_stamp{0};
+};
+
+// Colors of the columns by type, cost and bounds, and of the rows by right-hand side
+template <typename i_t, typename f_t>
+i_t initial_colors(const lp_problem_t<i_t, f_t>& problem,
+                   const std::vector<variable_type_t>& var_types,
+                   std::vector<i_t>& colors)
+{
+  const i_t n = problem.num_cols;
+  const i_t m = problem.num_rows;
+  using column_key_t = std::tuple<int, uint64_t, uint64_t, uint64_t>;
+  std::vector<std::pair<column_key_t, i_t>> columns(n);
+  for (i_t j = 0; j < n; ++j) {
+    columns[j] = {{static_cast<int>(var_types[j]),
+                   value_bits(problem.objective[j]),
+                   value_bits(problem.lower[j]),
+                   value_bits(problem.upper[j])},
+                  j};
+  }
+  std::sort(columns.begin(), columns.end());
+  i_t num_colors = 0;
+  for (i_t k = 0; k < n; ++k) {
+    if (k > 0 && columns[k].first != columns[k - 1].first) { ++num_colors; }
+    colors[columns[k].second] = num_colors;
+  }
+  if (n > 0) { ++num_colors; }
+
+  std::vector<std::pair<uint64_t, i_t>> rows(m);
+  for (i_t i = 0; i < m; ++i) {
+    rows[i] = {value_bits(problem.rhs[i]), i};
+  }
+  std::sort(rows.begin(), rows.end());
+  for (i_t k = 0; k < m; ++k) {
+    if (k > 0 && rows[k].first != rows[k - 1].first) { ++num_colors; }
+    colors[n + rows[k].second] = num_colors;
+  }
+  if (m > 0) { ++num_colors; }
+  return num_colors;
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+void detect_symmetry(const lp_problem_t<i_t, f_t>& problem,
+                     const csr_matrix_t<i_t, f_t>& Arow,
+                     const std::vector<variable_type_t>& var_types,
+                     const simplex_solver_settings_t<i_t, f_t>& settings,
+                     symmetry_orderings_t<i_t>& orderings)
+{
+  orderings = symmetry_orderings_t<i_t>{};
+  // The permutations would also have to map the quadratic objective onto itself
+  if (problem.Q.row_start.size() > 1 && problem.Q.row_start.back() > 0) { return; }
+
+  f_t start_time   = tic();
+  const i_t n      = problem.num_cols;
+  const i_t m      = problem.num_rows;
+  const size_t nnz = problem.A.col_start[n];
+  // About 500 refinements of the whole graph, which bounds the time of the detection
+  const size_t work_limit = 500 * (2 * nnz + 4 * static_cast<size_t>(n + m));
+
+  color_refinement_t<i_t, f_t> refinement(problem, Arow, work_limit);
+  automorphism_search_t<i_t, f_t> search(problem, Arow, var_types, refinement);
+  std::vector<i_t> colors(n + m);
+  i_t num_colors = initial_colors(problem, var_types, colors);
+  if (!refinement.refine(colors, num_colors)) { return; }
+
+  std::vector<i_t> leaders;
+  // Moved columns of each generator, with the level where it was found
+  std::vector<std::vector<std::pair<i_t, i_t>>> generators;
+  std::vector<i_t> generator_level;
+  union_find_t<i_t> orbits(n);
+  std::vector<i_t> class_size(num_colors);
+  std::vector<i_t> members;
+  std::vector<char> leader_row(m, 0);
+
+  for (int level = 0; level < max_levels; ++level) {
+    // The largest classes of integer columns, by their first column. Classes away from the rows
+    // of the leaders come first: a leader in the same row as the previous one is often fixed with
+    // it, and its orderings are then of no use
+    std::vector<std::tuple<i_t, bool, i_t, i_t>> classes;
+    class_size.assign(num_colors, 0);
+    std::vector<i_t> first_column(num_colors, -1);
+    for (i_t j = 0; j < n; ++j) {
+      if (first_column[colors[j]] < 0) { first_column[colors[j]] = j; }
+      ++class_size[colors[j]];
+    }
+    for (i_t k = 0; k < num_colors; ++k) {
+      const i_t j = first_column[k];
+      if (j >= 0 && class_size[k] > 1 && var_types[j] != variable_type_t::CONTINUOUS) {
+        bool near_leader = false;
+        for (i_t p = problem.A.col_start[j]; p < problem.A.col_start[j + 1]; ++p) {
+          near_leader = near_leader || leader_row[problem.A.i[p]];
+        }
+        classes.emplace_back(-class_size[k], near_leader, j, k);
+      }
+    }
+    std::sort(classes.begin(), classes.end());
+    if (classes.size() > static_cast<size_t>(max_classes)) { classes.resize(max_classes); }
+
+    i_t leader       = -1;
+    bool out_of_work = false;
+    for (const auto& [negative_size, near_leader, l, color] : classes) {
+      members.clear();
+      for (i_t j = l + 1; j < n && static_cast<i_t>(members.size()) < max_candidates; ++j) {
+        if (colors[j] == color) { members.push_back(j); }
+      }
+      orbits.reset();
+      const size_t num_generators = generators.size();
+      for (i_t c : members) {
+        if (orbits.find(c) == orbits.find(l)) { continue; }
+        if (search.find(l, c, colors, num_colors)) {
+          generators.emplace_back();
+          for (i_t j = 0; j < n; ++j) {
+            if (search.perm[j] == j) { continue; }
+            generators.back().emplace_back(j, search.perm[j]);
+            orbits.unite(j, search.perm[j]);
+          }
+          generator_level.push_back(level);
+        }
+        if (refinement.work > work_limit) {
+          out_of_work = true;
+          break;
+        }
+      }
+      if (generators.size() > num_generators) {
+        leader = l;
+        break;
+      }
+      if (out_of_work) { break; }
+    }
+    if (leader < 0) { break; }
+    leaders.push_back(leader);
+    for (i_t p = problem.A.col_start[leader]; p < problem.A.col_start[leader + 1]; ++p) {
+      leader_row[problem.A.i[p]] = 1;
+    }
+    if (out_of_work) { break; }
+
+    // The automorphisms of the next levels fix the leaders
+    color_refinement_t<i_t, f_t>::individualize(colors, num_colors, leader);
+    if (!refinement.refine(colors, num_colors)) { break; }
+  }
+
+  // The orbit of a leader is under the generators of its level and the deeper ones
+  orbits.reset();
+  std::vector<std::pair<i_t, i_t>> pairs;
+  i_t next_generator = static_cast<i_t>(generators.size()) - 1;
+  for (i_t level = static_cast<i_t>(leaders.size()) - 1; level >= 0; --level) {
+    for (; next_generator >= 0 && generator_level[next_generator] >= level; --next_generator) {
+      for (const auto& [j, k] : generators[next_generator]) {
+        orbits.unite(j, k);
+      }
+    }
+    const i_t root = orbits.find(leaders[level]);
+    for (i_t j = 0; j < n; ++j) {
+      if (j != leaders[level] && orbits.find(j) == root) { pairs.emplace_back(leaders[level], j); }
+    }
+  }
+
+  for (const auto& [l, k] : pairs) {
+    orderings.leader.push_back(l);
+    orderings.follower.push_back(k);
+  }
+  orderings.col_start.assign(n + 1, 0);
+  for (const auto& [l, k] : pairs) {
+    ++orderings.col_start[l + 1];
+    ++orderings.col_start[k + 1];
+  }
+  std::partial_sum(orderings.col_start.begin(), orderings.col_start.end(),
+                   orderings.col_start.begin());
+  orderings.index.resize(2 * pairs.size());
+  std::vector<i_t> next(orderings.col_start.begin(), orderings.col_start.end() - 1);
+  for (i_t k = 0; k < static_cast<i_t>(pairs.size()); ++k) {
+    orderings.index[next[pairs[k].first]++]  = k;
+    orderings.index[next[pairs[k].second]++] = k;
+  }
+  orderings.num_generators = static_cast<i_t>(generators.size());
+  orderings.num_levels     = static_cast<i_t>(leaders.size());
+
+  if (orderings.num_generators > 0) {
+    settings.log.printf("Symmetry: %d generators, %d orderings on %d leaders in %.2fs\n",
+                        orderings.num_generators,
+                        orderings.num_orderings(),
+                        orderings.num_levels,
+                        toc(start_time));
+  } else {
+    settings.log.debug("Symmetry: no generator found in %.2fs\n", toc(start_time));
+  }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template void detect_symmetry<int, double>(const lp_problem_t<int, double>& problem,
+                                           const csr_matrix_t<int, double>& Arow,
+                                           const std::vector<variable_type_t>& var_types,
+                                           const simplex_solver_settings_t<int, double>& settings,
+                                           symmetry_orderings_t<int>& orderings);
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,59 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Symmetry breaking orderings x[leader[k]] >= x[follower[k]] of the integer variables. Some
+// optimal solution satisfies all of them at once, so branch-and-bound may restrict its search to
+// the solutions that do.
+//
+// The orderings are the Schreier-Sims cuts of a stabilizer chain: level i has a leader and the
+// orbit of the leader under the automorphisms, found at levels i and deeper, that fix the leaders
+// of the levels before. Any solution is mapped onto one where each leader is the largest of its
+// orbit by applying these automorphisms level by level.
+template <typename i_t>
+struct symmetry_orderings_t {
+  std::vector<i_t> leader;
+  std::vector<i_t> follower;
+
+  // The orderings of column j are index[col_start[j]] to index[col_start[j + 1] - 1]. Columns
+  // appended after the detection, such as the slacks of the cuts, have no ordering
+  std::vector<i_t> col_start;
+  std::vector<i_t> index;
+
+  i_t num_generators{0};
+  i_t num_levels{0};
+
+  bool empty() const { return leader.empty(); }
+  i_t num_orderings() const { return static_cast<i_t>(leader.size()); }
+  i_t begin(i_t j) const { return j + 1 < static_cast<i_t>(col_start.size()) ? col_start[j] : 0; }
+  i_t end(i_t j) const { return j + 1 < static_cast<i_t>(col_start.size()) ? col_start[j + 1] : 0; }
+};
+
+// Finds permutations of the columns and rows of the problem that map it onto itself, with the
+// types, bounds and objective of the columns and the right-hand sides of the rows, and returns
+// their orderings. The candidates are given by a color refinement of the bipartite graph of A,
+// individualized on the leaders, and each generator is verified on the matrix, so a missed
+// symmetry makes weaker orderings but never wrong ones.
+template <typename i_t, typename f_t>
+void detect_symmetry(const lp_problem_t<i_t, f_t>& problem,
+                     const csr_matrix_t<i_t, f_t>& Arow,
+                     const std::vector<variable_type_t>& var_types,
+                     const simplex_solver_settings_t<i_t, f_t>& settings,
+                     symmetry_orderings_t<i_t>& orderings);
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -7,6 +7,9 @@
 
 #include <dual_simplex/triangle_solve.hpp>
 
+#include <omp.h>
+
+#include <algorithm>
 #include <optional>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -104,17 +107,19 @@ i_t depth_first_search(i_t j,
   return top;
 }
 
+namespace {
+
+// Solves with G over the nonzero pattern xi[top] .. xi[m-1] found by a reach
 template <typename i_t, typename f_t, bool lo>
-i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
-                          const std::optional<std::vector<i_t>>& pinv,
-                          std::vector<i_t>& xi,
-                          csc_matrix_t<i_t, f_t>& G,
-                          f_t* x,
-                          f_t& work_estimate)
+void solve_over_reach(const sparse_vector_t<i_t, f_t>& b,
+                      const std::optional<std::vector<i_t>>& pinv,
+                      const std::vector<i_t>& xi,
+                      i_t top,
+                      const csc_matrix_t<i_t, f_t>& G,
+                      f_t* x,
+                      f_t& work_estimate)
 {
-  i_t m = G.m;
-  assert(b.n == m);
-  i_t top = reach(b, pinv, G, xi, work_estimate);
+  const i_t m = G.m;
   for (i_t p = top; p < m; ++p) {
     x[xi[p]] = 0;  // Clear x vector
   }
@@ -148,9 +153,181 @@ i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
       x[G.i[p]] -= G.x[p] * x[j];  // x(i) -= G(i,j) * x(j)
     }
   }
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t, bool lo>
+i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
+                          const std::optional<std::vector<i_t>>& pinv,
+                          std::vector<i_t>& xi,
+                          csc_matrix_t<i_t, f_t>& G,
+                          f_t* x,
+                          f_t& work_estimate)
+{
+  assert(b.n == G.m);
+  i_t top = reach(b, pinv, G, xi, work_estimate);
+  solve_over_reach<i_t, f_t, lo>(b, pinv, xi, top, G, x, work_estimate);
   return top;
 }
 
+template <typename i_t, typename f_t>
+i_t reach(const sparse_vector_t<i_t, f_t>& b,
+          const std::optional<std::vector<i_t>>& pinv,
+          const csc_matrix_t<i_t, f_t>& G,
+          std::vector<char>& marked,
+          std::vector<i_t>& xi,
+          f_t& work_estimate)
+{
+  const i_t m   = G.m;
+  i_t top       = m;
+  const i_t bnz = b.i.size();
+  for (i_t p = 0; p < bnz; ++p) {
+    if (!marked[b.i[p]]) {  // start a DFS at unmarked node i
+      top = depth_first_search(b.i[p], pinv, G, marked, top, xi, xi.begin() + m, work_estimate);
+    }
+  }
+  work_estimate += 4 * bnz;
+  for (i_t p = top; p < m; ++p) {  // restore marked
+    marked[xi[p]] = 0;
+  }
+  work_estimate += 2 * (m - top);
+  return top;
+}
+
+template <typename i_t, typename f_t>
+i_t depth_first_search(i_t j,
+                       const std::optional<std::vector<i_t>>& pinv,
+                       const csc_matrix_t<i_t, f_t>& G,
+                       std::vector<char>& marked,
+                       i_t top,
+                       std::vector<i_t>& xi,
+                       typename std::vector<i_t>::iterator pstack,
+                       f_t& work_estimate)
+{
+  i_t head = 0;
+  xi[0]    = j;  // Initialize the recursion stack
+  i_t done = 0;
+  while (head >= 0) {
+    j        = xi[head];  // Get j from the top of the recursion stack
+    i_t jnew = pinv ? ((*pinv)[j]) : j;
+    if (!marked[j]) {
+      // If node j is not marked this is the first time it has been visited
+      marked[j] = 1;  // Mark node j as visited
+      // Point to the first outgoing edge of node j
+      pstack[head] = (jnew < 0) ? 0 : G.col_start[jnew];
+    }
+    done           = 1;  // Node j is done if no unvisited neighbors
+    i_t p2         = (jnew < 0) ? 0 : G.col_start[jnew + 1];
+    const i_t psav = pstack[head];
+    i_t p;
+    for (p = psav; p < p2; ++p) {  // Examine all neighbors of j
+      i_t i = G.i[p];              // Consider neighbor i
+      if (marked[i]) {
+        continue;  // skip visited node i
+      }
+      pstack[head] = p;  // pause depth-first search of node j
+      xi[++head]   = i;  // start dfs at node i
+      done         = 0;  // node j is not done
+      break;             // break to start dfs at node i
+    }
+    work_estimate += 3 * (p - psav) + 10;
+    if (done) {
+      pstack[head] = 0;  // restore pstack so it can be used again in other routines
+      xi[head]     = 0;  // restore xi so it can be used again in other routines
+      head--;            // remove j from the recursion stack
+      xi[--top] = j;     // and place it the output stack
+    }
+  }
+  return top;
+}
+
+template <typename i_t, typename f_t, bool lo>
+i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
+                          const std::optional<std::vector<i_t>>& pinv,
+                          std::vector<i_t>& xi,
+                          const csc_matrix_t<i_t, f_t>& G,
+                          std::vector<char>& marked,
+                          f_t* x,
+                          f_t& work_estimate)
+{
+  assert(b.n == G.m);
+  i_t top = reach(b, pinv, G, marked, xi, work_estimate);
+  solve_over_reach<i_t, f_t, lo>(b, pinv, xi, top, G, x, work_estimate);
+  return top;
+}
+
+template <typename i_t, typename f_t>
+void compute_triangle_levels(const csc_matrix_t<i_t, f_t>& G,
+                             bool ascending,
+                             triangle_levels_t<i_t>& levels,
+                             f_t& work_estimate)
+{
+  const i_t n = G.n;
+  // The level of x(j) is one more than the deepest x(i) it depends on. In column order they are
+  // all known when column j is reached
+  std::vector<i_t> level(n, 0);
+  i_t num_levels = n > 0 ? 1 : 0;
+  for (i_t k = 0; k < n; ++k) {
+    const i_t j = ascending ? k : n - 1 - k;
+    i_t level_j = 0;
+    for (i_t p = G.col_start[j]; p < G.col_start[j + 1]; ++p) {
+      const i_t i = G.i[p];
+      if (i != j) { level_j = std::max(level_j, level[i] + 1); }
+    }
+    level[j]   = level_j;
+    num_levels = std::max(num_levels, level_j + 1);
+  }
+
+  // Bucket the columns by level
+  levels.ascending = ascending;
+  levels.level_start.assign(num_levels + 1, 0);
+  for (i_t j = 0; j < n; ++j) {
+    levels.level_start[level[j] + 1]++;
+  }
+  for (i_t k = 0; k < num_levels; ++k) {
+    levels.level_start[k + 1] += levels.level_start[k];
+  }
+  std::vector<i_t> next(levels.level_start.begin(), levels.level_start.end() - 1);
+  levels.order.resize(n);
+  for (i_t j = 0; j < n; ++j) {
+    levels.order[next[level[j]]++] = j;
+  }
+  work_estimate += 4 * G.col_start[n] + 8 * n + 2 * num_levels;
+}
+
+template <typename i_t, typename f_t>
+i_t level_scheduled_transpose_solve(const csc_matrix_t<i_t, f_t>& G,
+                                    const triangle_levels_t<i_t>& levels,
+                                    std::vector<f_t>& x,
+                                    i_t num_threads,
+                                    f_t& work_estimate)
+{
+  const i_t n = G.n;
+  assert(x.size() == n);
+  const i_t num_levels     = levels.num_levels();
+  const bool diagonal_last = levels.ascending;
+
+#pragma omp parallel num_threads(num_threads)
+  for (i_t k = 0; k < num_levels; ++k) {
+    // The implicit barrier at the end of the loop separates the levels
+#pragma omp for schedule(static)
+    for (i_t q = levels.level_start[k]; q < levels.level_start[k + 1]; ++q) {
+      const i_t j         = levels.order[q];
+      const i_t col_start = diagonal_last ? G.col_start[j] : G.col_start[j] + 1;
+      const i_t col_end   = diagonal_last ? G.col_start[j + 1] - 1 : G.col_start[j + 1];
+      const i_t diagonal  = diagonal_last ? col_end : G.col_start[j];
+      f_t x_j             = x[j];
+      for (i_t p = col_start; p < col_end; ++p) {
+        x_j -= G.x[p] * x[G.i[p]];
+      }
+      x[j] = x_j / G.x[diagonal];
+    }
+  }
+  work_estimate += 6 * n + 4 * G.col_start[n];
+  return 0;
+}
+
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 
 // NOTE: lower_triangular_solve, lower_triangular_transpose_solve,
@@ -184,6 +361,49 @@ template int sparse_triangle_solve<int, double, false>(const sparse_vector_t<int
                                                        csc_matrix_t<int, double>& G,
                                                        double* x,
                                                        double& work_estimate);
+
+template int reach<int, double>(const sparse_vector_t<int, double>& b,
+                                const std::optional<std::vector<int>>& pinv,
+                                const csc_matrix_t<int, double>& G,
+                                std::vector<char>& marked,
+                                std::vector<int>& xi,
+                                double& work_estimate);
+
+template int depth_first_search<int, double>(int j,
+                                             const std::optional<std::vector<int>>& pinv,
+                                             const csc_matrix_t<int, double>& G,
+                                             std::vector<char>& marked,
+                                             int top,
+                                             std::vector<int>& xi,
+                                             std::vector<int>::iterator pstack,
+                                             double& work_estimate);
+
+template int sparse_triangle_solve<int, double, true>(const sparse_vector_t<int, double>& b,
+                                                      const std::optional<std::vector<int>>& pinv,
+                                                      std::vector<int>& xi,
+                                                      const csc_matrix_t<int, double>& G,
+                                                      std::vector<char>& marked,
+                                                      double* x,
+                                                      double& work_estimate);
+
+template int sparse_triangle_solve<int, double, false>(const sparse_vector_t<int, double>& b,
+                                                       const std::optional<std::vector<int>>& pinv,
+                                                       std::vector<int>& xi,
+                                                       const csc_matrix_t<int, double>& G,
+                                                       std::vector<char>& marked,
+                                                       double* x,
+                                                       double& work_estimate);
+
+template void compute_triangle_levels<int, double>(const csc_matrix_t<int, double>& G,
+                                                   bool ascending,
+                                                   triangle_levels_t<int>& levels,
+                                                   double& work_estimate);
+
+template int level_scheduled_transpose_solve<int, double>(const csc_matrix_t<int, double>& G,
+                                                          const triangle_levels_t<int>& levels,
+                                                          std::vector<double>& x,
+                                                          int num_threads,
+                                                          double& work_estimate);
 #endif
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -171,4 +171,83 @@ i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
                           f_t* x,
                           f_t& work_estimate);
 
+// \brief Same as reach above, but nodes are marked in marked instead of G.col_start, so G is
+// only read and several reaches may run on the same G from different threads
+// \param[in, out] marked - An array of size m of zeros, restored to zeros on output
+template <typename i_t, typename f_t>
+i_t reach(const sparse_vector_t<i_t, f_t>& b,
+          const std::optional<std::vector<i_t>>& pinv,
+          const csc_matrix_t<i_t, f_t>& G,
+          std::vector<char>& marked,
+          std::vector<i_t>& xi,
+          f_t& work_estimate);
+
+template <typename i_t, typename f_t>
+i_t depth_first_search(i_t j,
+                       const std::optional<std::vector<i_t>>& pinv,
+                       const csc_matrix_t<i_t, f_t>& G,
+                       std::vector<char>& marked,
+                       i_t top,
+                       std::vector<i_t>& xi,
+                       typename std::vector<i_t>::iterator pstack,
+                       f_t& work_estimate);
+
+// \brief Same as sparse_triangle_solve above, with the reach marked in marked so that G is
+// not modified
+template <typename i_t, typename f_t, bool lo>
+i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
+                          const std::optional<std::vector<i_t>>& pinv,
+                          std::vector<i_t>& xi,
+                          const csc_matrix_t<i_t, f_t>& G,
+                          std::vector<char>& marked,
+                          f_t* x,
+                          f_t& work_estimate);
+
+// \brief Level sets of the solve G'*x = b, where x(j) is computed from the entries G(i, j),
+// i != j, of column j once the x(i) are known. The columns of a level only depend on the columns
+// of the previous levels, so that they are solved in parallel.
+template <typename i_t>
+struct triangle_levels_t {
+  // Level k holds the columns order[level_start[k]] .. order[level_start[k + 1] - 1]
+  std::vector<i_t> level_start;
+  std::vector<i_t> order;
+  // True if x(j) depends on the x(i), i < j, and the diagonal is the last entry of a column.
+  // False if it depends on the x(i), i > j, and the diagonal is the first entry
+  bool ascending{true};
+
+  i_t num_levels() const { return level_start.empty() ? 0 : level_start.size() - 1; }
+
+  // A level must hold enough columns on average to pay for the barrier between levels
+  bool worth_scheduling(i_t n) const
+  {
+    constexpr i_t min_columns_per_level = 64;
+    return num_levels() > 0 && min_columns_per_level * num_levels() <= n;
+  }
+
+  void clear()
+  {
+    level_start.clear();
+    order.clear();
+  }
+};
+
+// \brief Computes the level sets of the solve G'*x = b
+// \param[in] G - Triangular matrix, upper triangular when ascending and lower triangular otherwise
+template <typename i_t, typename f_t>
+void compute_triangle_levels(const csc_matrix_t<i_t, f_t>& G,
+                             bool ascending,
+                             triangle_levels_t<i_t>& levels,
+                             f_t& work_estimate);
+
+// \brief Solves G'*x = b one level after the other, with the columns of a level in parallel. On
+// input x contains the right-hand side b, on output the solution. The result does not depend on
+// the number of threads and matches upper_triangular_transpose_solve (ascending) or
+// lower_triangular_transpose_solve on G.
+template <typename i_t, typename f_t>
+i_t level_scheduled_transpose_solve(const csc_matrix_t<i_t, f_t>& G,
+                                    const triangle_levels_t<i_t>& levels,
+                                    std::vector<f_t>& x,
+                                    i_t num_threads,
+                                    f_t& work_estimate);
+
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -17,17 +17,41 @@
 
 namespace cuopt::linear_programming::dual_simplex {
 
-template <typename i_t, typename f_t, typename Allocator>
-f_t vector_norm2_squared(const std::vector<f_t, Allocator>& x)
+namespace {
+
+// Sums op(k) over k = 0, ..., n - 1 with dense_reduction_lanes partial sums combined pairwise
+template <typename i_t, typename f_t, typename Op>
+f_t dense_sum(i_t n, Op op)
 {
-  i_t n   = x.size();
-  f_t sum = 0.0;
-  for (i_t j = 0; j < n; ++j) {
-    sum += x[j] * x[j];
+  f_t lane_sum[dense_reduction_lanes] = {};
+  i_t k                               = 0;
+  for (; k + dense_reduction_lanes <= n; k += dense_reduction_lanes) {
+    for (i_t l = 0; l < dense_reduction_lanes; ++l) {
+      lane_sum[l] += op(k + l);
+    }
+  }
+  for (i_t width = dense_reduction_lanes / 2; width > 0; width /= 2) {
+    for (i_t l = 0; l < width; ++l) {
+      lane_sum[l] += lane_sum[l + width];
+    }
+  }
+  f_t sum = lane_sum[0];
+  for (; k < n; ++k) {
+    sum += op(k);
   }
   return sum;
 }
 
+}  // namespace
+
+template <typename i_t, typename f_t, typename Allocator>
+f_t vector_norm2_squared(const std::vector<f_t, Allocator>& x)
+{
+  const i_t n   = x.size();
+  const f_t* px = x.data();
+  return dense_sum<i_t, f_t>(n, [px](i_t j) { return px[j] * px[j]; });
+}
+
 template <typename i_t, typename f_t, typename Allocator>
 f_t vector_norm2(const std::vector<f_t, Allocator>& x)
 {
@@ -37,24 +61,19 @@ f_t vector_norm2(const std::vector<f_t, Allocator>& x)
 template <typename i_t, typename f_t>
 f_t vector_norm1(const std::vector<f_t>& x)
 {
-  i_t n   = x.size();
-  f_t sum = 0.0;
-  for (i_t j = 0; j < n; ++j) {
-    sum += std::abs(x[j]);
-  }
-  return sum;
+  const i_t n   = x.size();
+  const f_t* px = x.data();
+  return dense_sum<i_t, f_t>(n, [px](i_t j) { return std::abs(px[j]); });
 }
 
 template <typename i_t, typename f_t>
 f_t dot(const std::vector<f_t>& x, const std::vector<f_t>& y)
 {
   assert(x.size() == y.size());
-  const i_t n = x.size();
-  f_t dot     = 0.0;
-  for (i_t k = 0; k < n; ++k) {
-    dot += x[k] * y[k];
-  }
-  return dot;
+  const i_t n   = x.size();
+  const f_t* px = x.data();
+  const f_t* py = y.data();
+  return dense_sum<i_t, f_t>(n, [px, py](i_t k) { return px[k] * py[k]; });
 }
 
 // Work = 3*min(nz_x, nz_y)
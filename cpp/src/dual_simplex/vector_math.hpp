@@ -13,14 +13,31 @@
 
 namespace cuopt::linear_programming::dual_simplex {
 
+// Number of partial results of the dense reductions below. Independent partial results let the
+// compiler vectorize the loops, and they are combined in a fixed order so that the result does
+// not depend on the instruction set the code was compiled for.
+constexpr int dense_reduction_lanes = 8;
+
 // Computes || x ||_inf = max_j | x |_j
 template <typename i_t, typename f_t, typename Allocator>
 f_t vector_norm_inf(const std::vector<f_t, Allocator>& x)
 {
-  i_t n = x.size();
+  const i_t n                         = x.size();
+  const f_t* px                       = x.data();
+  f_t lane_max[dense_reduction_lanes] = {};
+  i_t j                               = 0;
+  for (; j + dense_reduction_lanes <= n; j += dense_reduction_lanes) {
+    for (i_t l = 0; l < dense_reduction_lanes; ++l) {
+      const f_t t = std::abs(px[j + l]);
+      lane_max[l] = t > lane_max[l] ? t : lane_max[l];
+    }
+  }
   f_t a = 0.0;
-  for (i_t j = 0; j < n; ++j) {
-    f_t t = std::abs(x[j]);
+  for (i_t l = 0; l < dense_reduction_lanes; ++l) {
+    if (lane_max[l] > a) { a = lane_max[l]; }
+  }
+  for (; j < n; ++j) {
+    const f_t t = std::abs(px[j]);
     if (t > a) { a = t; }
   }
   return a;
@@ -1,13 +1,16 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #include "solution_reader.hpp"
+#include "solution_writer.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <optional>
 #include <regex>
@@ -107,6 +110,48 @@ solution_info_t read_sol_file(const std::string& filename)
   return info;
 }
 
+/**
+ * @brief Reads the values of a binary .solb file written by solution_writer_t
+ *
+ * @param file File opened in binary mode, positioned at its start
+ * @param n_variables Number of variables of the problem
+ * @return std::optional<std::vector<double>> The values, nullopt if the file is not a binary one
+ * @throws std::runtime_error if the file is truncated or does not match the problem
+ *
+ * The values are read in a single pass since they are stored in the order of the variables.
+ */
+static std::optional<std::vector<double>> read_binary_sol_file(std::ifstream& file,
+                                                               size_t n_variables)
+{
+  char magic[sizeof(solution_writer_t::binary_magic)];
+  if (!file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, solution_writer_t::binary_magic, sizeof(magic)) != 0) {
+    return std::nullopt;
+  }
+  uint32_t version       = 0;
+  uint32_t status_length = 0;
+  uint64_t n_values      = 0;
+  double objective_value = 0;
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&status_length), sizeof(status_length));
+  file.read(reinterpret_cast<char*>(&n_values), sizeof(n_values));
+  file.read(reinterpret_cast<char*>(&objective_value), sizeof(objective_value));
+  if (!file || version != solution_writer_t::binary_format_version) {
+    throw std::runtime_error("Unsupported binary solution file");
+  }
+  file.seekg(status_length, std::ios::cur);
+  if (n_values != n_variables) {
+    throw std::runtime_error("Binary solution has " + std::to_string(n_values) +
+                             " values, the problem has " + std::to_string(n_variables) +
+                             " variables");
+  }
+  std::vector<double> values(n_values);
+  if (!file.read(reinterpret_cast<char*>(values.data()), n_values * sizeof(double))) {
+    throw std::runtime_error("Truncated binary solution file");
+  }
+  return values;
+}
+
 // Helper method to get a specific variable value
 static double get_variable_value(const solution_info_t& info, const std::string& variable_name)
 {
@@ -127,6 +172,11 @@ static double get_variable_value(const solution_info_t& info, const std::string&
 std::vector<double> solution_reader_t::get_variable_values_from_sol_file(
   const std::string& sol_file_path, const std::vector<std::string>& variable_names)
 {
+  {
+    std::ifstream file(sol_file_path, std::ios::binary);
+    if (!file.is_open()) { throw std::runtime_error("Could not open file: " + sol_file_path); }
+    if (auto values = read_binary_sol_file(file, variable_names.size())) { return *values; }
+  }
   auto info = read_sol_file(sol_file_path);
   std::vector<double> values;
   for (const auto& var_name : variable_names) {
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -15,6 +15,9 @@ namespace cuopt::linear_programming {
 /**
  * @brief Reads a solution file and returns the values of specified variables
  *
+ * Binary .solb files, recognized by their magic, are read directly: their values are in the
+ * order of the variables and only their count is checked against variable_names.
+ *
  * @param sol_file_path Path to the .sol file to read
  * @param variable_names Vector of variable names to extract values for
  * @return std::vector<double> Vector of values corresponding to the variable names
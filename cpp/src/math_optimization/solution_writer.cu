@@ -6,13 +6,44 @@
 /* clang-format on */
 
 #include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
 #include <utilities/logger.hpp>
 #include "solution_writer.hpp"
 
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
 #include <fstream>
+#include <limits>
+#include <string_view>
+#include <type_traits>
 
 namespace cuopt::linear_programming {
 
+namespace {
+
+// Variables formatted by one thread in one go, and read from the device in one copy
+constexpr size_t text_chunk_size   = 1 << 15;
+constexpr size_t binary_chunk_size = 1 << 20;
+
+void format_variables(std::string& out,
+                      const std::vector<std::string>& variable_names,
+                      const std::vector<double>& variable_values,
+                      size_t begin,
+                      size_t end)
+{
+  constexpr int precision = std::numeric_limits<double>::max_digits10 + 1;
+  char buffer[64];
+  for (size_t i = begin; i < end; ++i) {
+    int length = std::snprintf(buffer, sizeof(buffer), " %.*g\n", precision, variable_values[i]);
+    out.append(variable_names[i]).append(buffer, length);
+  }
+}
+
+}  // namespace
+
 void solution_writer_t::write_solution_to_sol_file(const std::string& filename,
                                                    const std::string& status,
                                                    const double objective_value,
@@ -33,10 +64,125 @@ void solution_writer_t::write_solution_to_sol_file(const std::string& filename,
 
   if (status != "Infeasible") {
     file << "# Objective value: " << objective_value << std::endl;
-    for (size_t i = 0; i < variable_names.size(); ++i) {
-      file << variable_names[i] << " " << variable_values[i] << std::endl;
+    // The chunks of a batch are formatted in parallel and written in order
+    const size_t n_variables = variable_names.size();
+    const size_t n_chunks    = (n_variables + text_chunk_size - 1) / text_chunk_size;
+    const size_t batch_size  = std::max(1, omp_get_max_threads());
+    std::vector<std::string> chunks(std::min(n_chunks, batch_size));
+    for (size_t first_chunk = 0; first_chunk < n_chunks; first_chunk += batch_size) {
+      const size_t n_batch_chunks = std::min(batch_size, n_chunks - first_chunk);
+#pragma omp parallel for schedule(static, 1) if (n_batch_chunks > 1)
+      for (size_t c = 0; c < n_batch_chunks; ++c) {
+        const size_t begin = (first_chunk + c) * text_chunk_size;
+        chunks[c].clear();
+        format_variables(chunks[c],
+                         variable_names,
+                         variable_values,
+                         begin,
+                         std::min(n_variables, begin + text_chunk_size));
+      }
+      for (size_t c = 0; c < n_batch_chunks; ++c) {
+        file.write(chunks[c].data(), chunks[c].size());
+      }
+    }
+    file.flush();
+  }
+}
+
+template <typename f_t>
+void solution_writer_t::write_solution_to_binary_sol_file(const std::string& filename,
+                                                          const std::string& status,
+                                                          const double objective_value,
+                                                          const f_t* device_values,
+                                                          size_t n_values,
+                                                          rmm::cuda_stream_view stream_view)
+{
+  raft::common::nvtx::range fun_scope("write final solution to .solb file");
+  std::ofstream file(filename.data(), std::ios::binary);
+
+  if (!file.is_open()) {
+    CUOPT_LOG_ERROR("Could not open file: %s for solution output", filename.data());
+    return;
+  }
+
+  // An infeasible solution is written without values, as in the text format
+  if (status == "Infeasible") { n_values = 0; }
+  const uint32_t status_length = status.size();
+  const uint64_t values        = n_values;
+  file.write(binary_magic, sizeof(binary_magic));
+  file.write(reinterpret_cast<const char*>(&binary_format_version), sizeof(uint32_t));
+  file.write(reinterpret_cast<const char*>(&status_length), sizeof(uint32_t));
+  file.write(reinterpret_cast<const char*>(&values), sizeof(uint64_t));
+  file.write(reinterpret_cast<const char*>(&objective_value), sizeof(double));
+  file.write(status.data(), status_length);
+  if (n_values == 0) { return; }
+
+  // Double buffering: chunk k + 1 is copied to the host while chunk k is written
+  const size_t chunk_size = std::min(n_values, binary_chunk_size);
+  std::array<f_t*, 2> staging{nullptr, nullptr};
+  std::array<cudaEvent_t, 2> copied{nullptr, nullptr};
+  std::vector<double> converted(std::is_same_v<f_t, double> ? 0 : chunk_size);
+  auto release = [&]() {
+    for (int i = 0; i < 2; ++i) {
+      if (copied[i] != nullptr) { cudaEventDestroy(copied[i]); }
+      if (staging[i] != nullptr) { cudaFreeHost(staging[i]); }
     }
+  };
+  try {
+    for (int i = 0; i < 2; ++i) {
+      RAFT_CUDA_TRY(cudaMallocHost(&staging[i], chunk_size * sizeof(f_t)));
+      RAFT_CUDA_TRY(cudaEventCreateWithFlags(&copied[i], cudaEventDisableTiming));
+    }
+    auto copy_chunk = [&](size_t chunk) {
+      const size_t begin = chunk * chunk_size;
+      const size_t size  = std::min(chunk_size, n_values - begin);
+      RAFT_CUDA_TRY(cudaMemcpyAsync(staging[chunk % 2],
+                                    device_values + begin,
+                                    size * sizeof(f_t),
+                                    cudaMemcpyDeviceToHost,
+                                    stream_view.value()));
+      RAFT_CUDA_TRY(cudaEventRecord(copied[chunk % 2], stream_view.value()));
+    };
+    const size_t n_chunks = (n_values + chunk_size - 1) / chunk_size;
+    copy_chunk(0);
+    for (size_t chunk = 0; chunk < n_chunks; ++chunk) {
+      if (chunk + 1 < n_chunks) { copy_chunk(chunk + 1); }
+      RAFT_CUDA_TRY(cudaEventSynchronize(copied[chunk % 2]));
+      const size_t size = std::min(chunk_size, n_values - chunk * chunk_size);
+      if constexpr (std::is_same_v<f_t, double>) {
+        file.write(reinterpret_cast<const char*>(staging[chunk % 2]), size * sizeof(double));
+      } else {
+        std::copy(staging[chunk % 2], staging[chunk % 2] + size, converted.begin());
+        file.write(reinterpret_cast<const char*>(converted.data()), size * sizeof(double));
+      }
+    }
+  } catch (...) {
+    RAFT_CUDA_TRY_NO_THROW(cudaStreamSynchronize(stream_view.value()));
+    release();
+    throw;
   }
+  release();
+  file.flush();
+}
+
+bool solution_writer_t::is_binary_sol_file(const std::string& filename)
+{
+  constexpr std::string_view extension = ".solb";
+  return filename.size() >= extension.size() &&
+         filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
 }
 
+template void solution_writer_t::write_solution_to_binary_sol_file<float>(const std::string&,
+                                                                          const std::string&,
+                                                                          const double,
+                                                                          const float*,
+                                                                          size_t,
+                                                                          rmm::cuda_stream_view);
+template void solution_writer_t::write_solution_to_binary_sol_file<double>(const std::string&,
+                                                                           const std::string&,
+                                                                           const double,
+                                                                           const double*,
+                                                                           size_t,
+                                                                           rmm::cuda_stream_view);
+
 }  // namespace cuopt::linear_programming
@@ -1,12 +1,16 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #pragma once
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -23,10 +27,40 @@ namespace cuopt::linear_programming {
  */
 class solution_writer_t {
  public:
+  // A binary file starts with the magic, the format version, the status length, the number of
+  // values and the objective, then holds the status characters and the values as doubles
+  static constexpr char binary_magic[8]           = {'C', 'U', 'O', 'P', 'T', 'S', 'O', 'L'};
+  static constexpr uint32_t binary_format_version = 1;
+
   static void write_solution_to_sol_file(const std::string& sol_file_path,
                                          const std::string& status,
                                          const double objective_value,
                                          const std::vector<std::string>& variable_names,
                                          const std::vector<double>& variable_values);
+
+  /**
+   * @brief Writes a solution to a binary .solb file, streaming the values from the device
+   *
+   * The values are copied through two pinned chunks, so the file is written while the next chunk
+   * is being transferred and the solution is never entirely on the host. The file holds no
+   * variable names: its values are in the order of the variables of the problem.
+   *
+   * @param sol_file_path Path to the .solb file to write
+   * @param status Status of the solution
+   * @param objective_value Objective value of the solution
+   * @param device_values Device pointer to the variable values
+   * @param n_values Number of variable values
+   * @param stream_view Stream on which the values are ready
+   */
+  template <typename f_t>
+  static void write_solution_to_binary_sol_file(const std::string& sol_file_path,
+                                                const std::string& status,
+                                                const double objective_value,
+                                                const f_t* device_values,
+                                                size_t n_values,
+                                                rmm::cuda_stream_view stream_view);
+
+  // True when the path ends with the .solb extension of the binary solution files
+  static bool is_binary_sol_file(const std::string& sol_file_path);
 };
 }  // namespace cuopt::linear_programming
@@ -0,0 +1,183 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <math_optimization/warm_start_cache.hpp>
+#include <mip_heuristics/mip_constants.hpp>
+#include <utilities/binary_file_io.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/core/nvtx.hpp>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace cuopt::linear_programming::detail {
+
+namespace {
+
+constexpr char warm_start_magic[8]    = {'C', 'U', 'O', 'P', 'T', 'W', 'S', '\0'};
+constexpr uint32_t warm_start_version = 1;
+
+// 64 bit FNV-1a, the entries of unrelated problems share the directory
+struct structure_hash_t {
+  uint64_t hash = 14695981039346656037ull;
+
+  void add_bytes(const void* data, size_t size)
+  {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+  }
+
+  template <typename T>
+  void add(const T& value)
+  {
+    add_bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void add(const std::vector<T>& values)
+  {
+    add(values.size());
+    add_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  void add(const std::vector<std::string>& names)
+  {
+    add(names.size());
+    for (const auto& name : names) {
+      add(name.size());
+      add_bytes(name.data(), name.size());
+    }
+  }
+};
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+warm_start_cache_t<i_t, f_t>::warm_start_cache_t(const std::string& directory,
+                                                 const optimization_problem_t<i_t, f_t>& problem)
+  : directory_(directory),
+    n_variables_(problem.get_n_variables()),
+    n_constraints_(problem.get_n_constraints())
+{
+  raft::common::nvtx::range fun_scope("warm_start_cache_t::warm_start_cache_t");
+  auto stream     = problem.get_handle_ptr()->get_stream();
+  lower_bounds_   = cuopt::host_copy(problem.get_variable_lower_bounds(), stream);
+  upper_bounds_   = cuopt::host_copy(problem.get_variable_upper_bounds(), stream);
+  variable_types_ = cuopt::host_copy(problem.get_variable_types(), stream);
+
+  structure_hash_t hash;
+  hash.add(n_variables_);
+  hash.add(n_constraints_);
+  auto offsets = cuopt::host_copy(problem.get_constraint_matrix_offsets(), stream);
+  auto indices = cuopt::host_copy(problem.get_constraint_matrix_indices(), stream);
+  // presolve sorts the rows of the problem it is given
+  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+    std::sort(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+  }
+  hash.add(offsets);
+  hash.add(indices);
+  hash.add(variable_types_);
+  hash.add(problem.get_variable_names());
+  hash.add(problem.get_row_names());
+  key_ = hash.hash;
+
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016" PRIx64 ".warm", key_);
+  path_ = (std::filesystem::path(directory_) / name).string();
+}
+
+template <typename i_t, typename f_t>
+bool warm_start_cache_t<i_t, f_t>::read(std::vector<f_t>& primal, std::vector<f_t>& dual) const
+{
+  std::FILE* file = std::fopen(path_.c_str(), "rb");
+  if (file == nullptr) { return false; }
+  const int64_t file_size = get_file_size(file);
+
+  char magic[sizeof(warm_start_magic)];
+  uint32_t version       = 0;
+  uint32_t type_sizes[2] = {0, 0};
+  uint64_t key           = 0;
+  i_t dims[2]            = {0, 0};
+  bool ok = read_values(file, magic, sizeof(magic)) &&
+            std::memcmp(magic, warm_start_magic, sizeof(magic)) == 0 &&
+            read_values(file, &version, 1) && version == warm_start_version &&
+            read_values(file, type_sizes, 2) && type_sizes[0] == sizeof(i_t) &&
+            type_sizes[1] == sizeof(f_t) && read_values(file, &key, 1) && key == key_ &&
+            read_values(file, dims, 2) && dims[0] == n_variables_ && dims[1] == n_constraints_ &&
+            read_vector(file, file_size, primal) && read_vector(file, file_size, dual);
+  std::fclose(file);
+
+  auto is_finite = [](f_t value) { return std::isfinite(value); };
+  ok = ok && primal.size() == static_cast<size_t>(n_variables_) &&
+       (dual.empty() || dual.size() == static_cast<size_t>(n_constraints_)) &&
+       std::all_of(primal.begin(), primal.end(), is_finite) &&
+       std::all_of(dual.begin(), dual.end(), is_finite);
+  if (!ok) {
+    primal.clear();
+    dual.clear();
+    return false;
+  }
+
+  for (i_t j = 0; j < n_variables_; ++j) {
+    f_t value = primal[j];
+    if (!variable_types_.empty() && variable_types_[j] == var_t::INTEGER) {
+      value = std::round(value);
+    }
+    if (!lower_bounds_.empty()) { value = std::max(value, lower_bounds_[j]); }
+    if (!upper_bounds_.empty()) { value = std::min(value, upper_bounds_[j]); }
+    primal[j] = value;
+  }
+  return true;
+}
+
+template <typename i_t, typename f_t>
+bool warm_start_cache_t<i_t, f_t>::write(const std::vector<f_t>& primal,
+                                         const std::vector<f_t>& dual) const
+{
+  if (primal.size() != static_cast<size_t>(n_variables_)) { return false; }
+  // the dual is not always mapped back through presolve
+  const bool has_dual = dual.size() == static_cast<size_t>(n_constraints_);
+
+  std::error_code error;
+  std::filesystem::create_directories(directory_, error);
+  if (error) { return false; }
+
+  const std::string temp_filename = path_ + ".tmp";
+  std::FILE* file                 = std::fopen(temp_filename.c_str(), "wb");
+  if (file == nullptr) { return false; }
+
+  const uint32_t type_sizes[2] = {sizeof(i_t), sizeof(f_t)};
+  const i_t dims[2]            = {n_variables_, n_constraints_};
+  bool ok = write_values(file, warm_start_magic, sizeof(warm_start_magic)) &&
+            write_values(file, &warm_start_version, 1) && write_values(file, type_sizes, 2) &&
+            write_values(file, &key_, 1) && write_values(file, dims, 2) &&
+            write_vector(file, primal) && write_vector(file, has_dual ? dual : std::vector<f_t>{});
+
+  ok = (std::fclose(file) == 0) && ok;
+  if (ok) { ok = std::rename(temp_filename.c_str(), path_.c_str()) == 0; }
+  if (!ok) { std::remove(temp_filename.c_str()); }
+  return ok;
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class warm_start_cache_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class warm_start_cache_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
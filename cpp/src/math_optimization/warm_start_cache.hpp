@@ -0,0 +1,54 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/optimization_problem.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+/**
+ * @brief Entry of a problem in the warm start cache directory
+ *
+ * The entry is named after a hash of the structure of the problem: its dimensions, the sparsity
+ * pattern of the constraint matrix, the variable types and the names. The coefficients, bounds and
+ * objective are left out, so that a recurring model whose data changed finds the solution of the
+ * previous run.
+ */
+template <typename i_t, typename f_t>
+class warm_start_cache_t {
+ public:
+  warm_start_cache_t(const std::string& directory, const optimization_problem_t<i_t, f_t>& problem);
+
+  const std::string& path() const { return path_; }
+  uint64_t key() const { return key_; }
+
+  // Reads the saved primal and dual solutions, the dual is empty when a MIP solve saved the entry.
+  // The primal is moved inside the current bounds and its integer variables are rounded. Returns
+  // false when there is no entry or it does not fit the problem
+  bool read(std::vector<f_t>& primal, std::vector<f_t>& dual) const;
+
+  // Replaces the entry through a temporary file, so that a concurrent solve never reads half of it.
+  // A dual that does not have a value per constraint is left out
+  bool write(const std::vector<f_t>& primal, const std::vector<f_t>& dual) const;
+
+ private:
+  std::string directory_;
+  std::string path_;
+  uint64_t key_{0};
+  i_t n_variables_{0};
+  i_t n_constraints_{0};
+  std::vector<f_t> lower_bounds_;
+  std::vector<f_t> upper_bounds_;
+  std::vector<var_t> variable_types_;
+};
+
+}  // namespace cuopt::linear_programming::detail
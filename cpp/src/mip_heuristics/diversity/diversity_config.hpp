@@ -30,6 +30,33 @@ struct diversity_config_t {
   double lp_run_time_if_feasible      = 2.;
   double lp_run_time_if_infeasible    = 1.;
   bool halve_population               = false;
+  double time_ratio_on_lagrangian     = 0.05;
+  double max_time_on_lagrangian       = 10.;
+  size_t n_elites_for_segment_search  = 6;
+  double max_time_on_segment_search   = 2.;
+  size_t max_conditional_bound_pairs  = size_t{1} << 21;
 };
 
+// Small population and short phases, for the latency mode where the setup of the heuristics
+// would dominate the solve time of a small problem
+inline diversity_config_t latency_diversity_config()
+{
+  diversity_config_t config;
+  config.time_ratio_on_init_lp       = 0.05;
+  config.max_time_on_lp              = 2.0;
+  config.time_ratio_of_probing_cache = 0.02;
+  config.max_time_on_probing         = 1.0;
+  config.max_solutions               = 8;
+  config.initial_island_size         = 2;
+  config.maximum_island_size         = 4;
+  config.max_fast_sol_time           = 1.0;
+  config.lp_run_time_if_feasible     = 0.5;
+  config.lp_run_time_if_infeasible   = 0.25;
+  config.max_time_on_lagrangian      = 1.0;
+  config.n_elites_for_segment_search = 3;
+  config.max_time_on_segment_search  = 0.5;
+  config.max_conditional_bound_pairs = size_t{1} << 16;
+  return config;
+}
+
 }  // namespace cuopt::linear_programming::detail
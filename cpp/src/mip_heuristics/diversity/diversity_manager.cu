@@ -38,7 +38,8 @@ diversity_manager_t<i_t, f_t>::diversity_manager_t(mip_solver_context_t<i_t, f_t
   : context(context_),
     branch_and_bound_ptr(nullptr),
     problem_ptr(context.problem_ptr),
-    diversity_config(),
+    diversity_config(context.settings.latency_mode ? latency_diversity_config()
+                                                   : diversity_config_t{}),
     population("population",
                context,
                *this,
@@ -51,6 +52,7 @@ diversity_manager_t<i_t, f_t>::diversity_manager_t(mip_solver_context_t<i_t, f_t
                              context.problem_ptr->handle_ptr->get_stream()),
     ls(context, lp_optimal_solution),
     rins(context, *this),
+    lagrangian(context.problem_ptr->handle_ptr),
     timer(diversity_config.default_time_limit),
     bound_prop_recombiner(context,
                           context.problem_ptr->n_variables,
@@ -210,6 +212,8 @@ bool diversity_manager_t<i_t, f_t>::run_presolve(f_t time_limit)
       // do the resizing no-matter what, bounds presolve might not change the bounds but initial
       // trivial presolve might have
       ls.constraint_prop.bounds_update.resize(*problem_ptr);
+      ls.constraint_prop.conditional_bounds_update.pair_budget =
+        diversity_config.max_conditional_bound_pairs;
       ls.constraint_prop.conditional_bounds_update.update_constraint_bounds(
         *problem_ptr, ls.constraint_prop.bounds_update);
       if (!check_bounds_sanity(*problem_ptr)) { return false; }
@@ -295,6 +299,60 @@ void diversity_manager_t<i_t, f_t>::run_fp_alone()
   CUOPT_LOG_DEBUG("FP alone finished!");
 }
 
+template <typename i_t, typename f_t>
+void diversity_manager_t<i_t, f_t>::run_lagrangian_heuristic()
+{
+  raft::common::nvtx::range fun_scope("run_lagrangian_heuristic");
+  if (!lagrangian.detect_structure(*problem_ptr)) { return; }
+  const double time_limit =
+    std::min(diversity_config.max_time_on_lagrangian,
+             timer.remaining_time() * diversity_config.time_ratio_on_lagrangian);
+  timer_t lagrangian_timer(time_limit);
+  const f_t upper_bound = population.is_feasible() ? population.best_feasible().get_objective()
+                                                   : std::numeric_limits<f_t>::infinity();
+  // the duals of the LP relaxation are the multipliers of its Lagrangian bound
+  rmm::device_uvector<f_t> no_multipliers(0, problem_ptr->handle_ptr->get_stream());
+  lagrangian.solve(*problem_ptr,
+                   ls.lp_optimal_exists ? lp_dual_optimal_solution : no_multipliers,
+                   upper_bound,
+                   lagrangian_timer);
+  // The bound is not stronger than the one of the LP relaxation, it only matters when that one
+  // was not solved to optimality
+  if (std::isfinite(lagrangian.best_bound) && !std::isfinite(stats.get_solution_bound())) {
+    set_new_user_bound(problem_ptr->get_user_obj_from_solver_obj(lagrangian.best_bound));
+  }
+  for (auto& candidate : lagrangian.candidates) {
+    solution_t<i_t, f_t> solution(*problem_ptr);
+    solution.copy_new_assignment(candidate);
+    solution.compute_feasibility();
+    timer_t ls_timer(std::min(time_limit, timer.remaining_time()));
+    ls_config_t<i_t, f_t> ls_config;
+    run_local_search(solution, population.weights, ls_timer, ls_config);
+    population.add_solution(std::move(solution));
+  }
+  lagrangian.candidates.clear();
+}
+
+template <typename i_t, typename f_t>
+void diversity_manager_t<i_t, f_t>::run_elite_segment_search()
+{
+  raft::common::nvtx::range fun_scope("run_elite_segment_search");
+  if (population.current_size() < 2) { return; }
+  auto population_vector = population.population_to_vector();
+  std::vector<const f_t*> elite_assignments;
+  for (auto& sol : population_vector) {
+    if (elite_assignments.size() == diversity_config.n_elites_for_segment_search) { break; }
+    elite_assignments.push_back(sol.assignment.data());
+  }
+  if (elite_assignments.size() < 2) { return; }
+  timer_t segment_timer(
+    std::min(diversity_config.max_time_on_segment_search, timer.remaining_time()));
+  solution_t<i_t, f_t> solution(population_vector[0]);
+  ls.line_segment_search.fj.copy_weights(population.weights, solution.handle_ptr);
+  ls.line_segment_search.search_elite_segments(solution, elite_assignments, segment_timer);
+  population.add_solution(std::move(solution));
+}
+
 template <typename i_t, typename f_t>
 struct ls_cpufj_raii_guard_t {
   ls_cpufj_raii_guard_t(local_search_t<i_t, f_t>& ls) : ls(ls) {}
@@ -502,6 +560,8 @@ solution_t<i_t, f_t> diversity_manager_t<i_t, f_t>::run_solver()
     ls.start_cpufj_lptopt_scratch_threads(population);
   }
 
+  run_lagrangian_heuristic();
+
   population.add_solutions_from_vec(std::move(initial_sol_vector));
 
   if (check_b_b_preemption()) { return population.best_feasible(); }
@@ -533,6 +593,7 @@ solution_t<i_t, f_t> diversity_manager_t<i_t, f_t>::run_solver()
 template <typename i_t, typename f_t>
 void diversity_manager_t<i_t, f_t>::diversity_step(i_t max_iterations_without_improvement)
 {
+  run_elite_segment_search();
   bool improved = true;
   while (improved) {
     int k    = max_iterations_without_improvement;
@@ -22,6 +22,7 @@
 #include <cuopt/linear_programming/mip/solver_stats.hpp>
 
 #include <mip_heuristics/diversity/lns/rins.cuh>
+#include <mip_heuristics/local_search/lagrangian/lagrangian_heuristic.cuh>
 #include <mip_heuristics/local_search/local_search.cuh>
 #include <mip_heuristics/solution/solution.cuh>
 #include <mip_heuristics/solver.cuh>
@@ -38,6 +39,9 @@ class diversity_manager_t {
   void generate_solution(f_t time_limit, bool random_start = true);
   void run_fj_alone(solution_t<i_t, f_t>& solution);
   void run_fp_alone();
+  void run_lagrangian_heuristic();
+  // searches the segments between all pairs of the best solutions of the population
+  void run_elite_segment_search();
   // main loop of diversity improvements
   void main_loop();
   // randomly chooses a recombiner and returns the offspring
@@ -98,6 +102,7 @@ class diversity_manager_t {
   std::atomic<int> global_concurrent_halt{0};
 
   rins_t<i_t, f_t> rins;
+  lagrangian_heuristic_t<i_t, f_t> lagrangian;
 
   bool run_only_ls_recombiner{false};
   bool run_only_bp_recombiner{false};
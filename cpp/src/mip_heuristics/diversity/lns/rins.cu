@@ -63,7 +63,7 @@ void rins_t<i_t, f_t>::node_callback(const std::vector<f_t>& solution, f_t objec
 
   if (node_count - node_count_at_last_improvement < settings.nodes_after_later_improvement) return;
 
-  if (node_count - node_count_at_last_rins > settings.node_freq) {
+  if (node_count - node_count_at_last_rins > settings.node_freq * node_freq_factor) {
     // opportunistic early test w/ atomic to avoid having to take the lock
     if (!rins_thread->cpu_thread_done) return;
     std::lock_guard<std::mutex> lock(rins_mutex);
@@ -218,10 +218,42 @@ void rins_t<i_t, f_t>::run_rins()
 
   fixed_problem.presolve_data.reset_additional_vars(fixed_problem, &rins_handle);
   fixed_problem.presolve_data.initialize_var_mapping(fixed_problem, &rins_handle);
-  trivial_presolve(fixed_problem);
+  // fixing the variables recomputed the transpose
+  trivial_presolve(fixed_problem, false, true);
   fixed_problem.check_problem_representation(true);
 
-  std::vector<std::vector<f_t>> rins_solution_queue;
+  bool improvement_found = false;
+  std::mutex publish_mutex;
+  auto publish_solution = [&](const std::vector<f_t>& fixed_sol) {
+    std::lock_guard<std::mutex> lock(publish_mutex);
+    cuopt_assert(fixed_assignment.size() == fixed_sol.size(), "Assignment size mismatch");
+    rmm::device_uvector<f_t> post_processed_solution(fixed_sol.size(), rins_handle.get_stream());
+    raft::copy(
+      post_processed_solution.data(), fixed_sol.data(), fixed_sol.size(), rins_handle.get_stream());
+    fixed_problem.post_process_assignment(post_processed_solution, false);
+    cuopt_assert(post_processed_solution.size() == fixed_assignment.size(),
+                 "Assignment size mismatch");
+    rins_handle.sync_stream();
+
+    rmm::device_uvector<f_t> unfixed_assignment(post_processed_solution.size(),
+                                                rins_handle.get_stream());
+    raft::copy(unfixed_assignment.data(),
+               post_processed_solution.data(),
+               post_processed_solution.size(),
+               rins_handle.get_stream());
+    best_sol.unfix_variables(unfixed_assignment, variable_map);
+    best_sol.compute_feasibility();
+
+    if (best_sol.get_feasible()) {
+      cuopt_assert(best_sol.test_number_all_integer(), "All must be integers after RINS");
+      if (best_sol.get_user_objective() < prev_obj) { improvement_found = true; }
+      cuopt_assert(best_sol.assignment.size() == sol_size_before_rins, "Assignment size mismatch");
+      cuopt_assert(best_sol.assignment.size() == problem_copy->n_variables,
+                   "Assignment size mismatch");
+      dm.population.add_external_solution(
+        best_sol.get_host_assignment(), best_sol.get_objective(), solution_origin_t::RINS);
+    }
+  };
 
   mip_solver_context_t<i_t, f_t> fj_context(
     &rins_handle, &fixed_problem, context.settings, context.scaling);
@@ -269,9 +301,13 @@ void rins_t<i_t, f_t>::run_rins()
   branch_and_bound_settings.sub_mip               = 1;
   branch_and_bound_settings.log.log               = false;
   branch_and_bound_settings.log.log_prefix        = "[RINS] ";
-  branch_and_bound_settings.solution_callback = [&rins_solution_queue](std::vector<f_t>& solution,
-                                                                       f_t objective) {
-    rins_solution_queue.push_back(solution);
+  // Each solution of the sub-MIP is mapped back to the original space and handed to the
+  // population as soon as it is found, instead of when the sub-MIP ends. The callback may run on a
+  // thread of the sub-MIP, so the device is set there before using the RINS stream
+  branch_and_bound_settings.solution_callback = [this, &publish_solution](
+                                                  std::vector<f_t>& solution, f_t objective) {
+    RAFT_CUDA_TRY(cudaSetDevice(context.handle_ptr->get_device()));
+    publish_solution(solution);
   };
   dual_simplex::branch_and_bound_t<i_t, f_t> branch_and_bound(
     branch_and_bound_problem, branch_and_bound_settings, dual_simplex::tic());
@@ -282,8 +318,8 @@ void rins_t<i_t, f_t>::run_rins()
     CUOPT_LOG_DEBUG("RINS submip solution found. Objective %.16e. Status %d",
                     branch_and_bound_solution.objective,
                     int(branch_and_bound_status));
-    // RINS submip may have just proved the initial guess is the optimal, therefore the queue might
-    // be empty in that case
+    // RINS submip may have just proved the initial guess is the optimal, therefore no solution
+    // might have been published in that case
   }
   if (branch_and_bound_status == dual_simplex::mip_status_t::OPTIMAL) {
     CUOPT_LOG_DEBUG("RINS submip optimal");
@@ -312,42 +348,15 @@ void rins_t<i_t, f_t>::run_rins()
   if (fj_solution_found) {
     CUOPT_LOG_DEBUG("RINS FJ solution found. Objective %.16e",
                     cpu_fj_thread.fj_cpu->h_best_objective);
-    rins_solution_queue.push_back(cpu_fj_thread.fj_cpu->h_best_assignment);
+    publish_solution(cpu_fj_thread.fj_cpu->h_best_assignment);
   }
   // Thread will be automatically terminated and joined by destructor
 
-  bool improvement_found = false;
-  for (auto& fixed_sol : rins_solution_queue) {
-    cuopt_assert(fixed_assignment.size() == fixed_sol.size(), "Assignment size mismatch");
-    rmm::device_uvector<f_t> post_processed_solution(fixed_sol.size(), rins_handle.get_stream());
-    raft::copy(
-      post_processed_solution.data(), fixed_sol.data(), fixed_sol.size(), rins_handle.get_stream());
-    fixed_problem.post_process_assignment(post_processed_solution, false);
-    cuopt_assert(post_processed_solution.size() == fixed_assignment.size(),
-                 "Assignment size mismatch");
-    rins_handle.sync_stream();
-
-    rmm::device_uvector<f_t> unfixed_assignment(post_processed_solution.size(),
-                                                rins_handle.get_stream());
-    raft::copy(unfixed_assignment.data(),
-               post_processed_solution.data(),
-               post_processed_solution.size(),
-               rins_handle.get_stream());
-    best_sol.unfix_variables(unfixed_assignment, variable_map);
-    best_sol.compute_feasibility();
-
-    if (best_sol.get_feasible()) {
-      cuopt_assert(best_sol.test_number_all_integer(), "All must be integers after RINS");
-      if (best_sol.get_user_objective() < prev_obj) { improvement_found = true; }
-      cuopt_assert(best_sol.assignment.size() == sol_size_before_rins, "Assignment size mismatch");
-      cuopt_assert(best_sol.assignment.size() == problem_copy->n_variables,
-                   "Assignment size mismatch");
-      dm.population.add_external_solution(
-        best_sol.get_host_assignment(), best_sol.get_objective(), solution_origin_t::RINS);
-    }
-  }
-
   if (improvement_found) total_success++;
+  // RINS runs its sub-MIP on CPU threads and a stream of its own, leave them to the rest of the
+  // solver for longer while it does not improve the incumbent
+  node_freq_factor =
+    improvement_found ? 1 : std::min(2 * node_freq_factor.load(), settings.max_node_freq_factor);
   CUOPT_LOG_DEBUG("RINS calls/successes %d/%d", total_calls, total_success);
 }
 
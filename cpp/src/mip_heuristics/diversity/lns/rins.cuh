@@ -50,6 +50,8 @@ struct rins_settings_t {
   double default_time_limit         = 3.;
   double target_mip_gap             = 0.03;
   bool objective_cut                = true;
+  // the node frequency is doubled after every call without improvement, up to this factor
+  int max_node_freq_factor          = 16;
 };
 
 template <typename i_t, typename f_t>
@@ -96,6 +98,7 @@ class rins_t {
   f_t fixrate{0.5};
   i_t total_calls{0};
   i_t total_success{0};
+  std::atomic<i_t> node_freq_factor{1};
   f_t time_limit{10.};
   i_t seed;
 
@@ -9,12 +9,14 @@
 #include "population.cuh"
 
 #include <thrust/for_each.h>
+#include <cub/cub.cuh>
 #include <mip_heuristics/mip_constants.hpp>
 #include <mip_heuristics/utils.cuh>
 #include <pdlp/utils.cuh>
 #include <utilities/copy_helpers.hpp>
 #include <utilities/seed_generator.cuh>
 
+#include <algorithm>
 #include <mutex>
 
 namespace cuopt::linear_programming::detail {
@@ -26,6 +28,73 @@ constexpr double min_infeasibility_weight    = 1.;
 constexpr double infeasibility_balance_ratio = 1.1;
 constexpr double halving_skip_ratio          = 0.75;
 
+// One block per compared solution: counts the integers on which it agrees with assignment, the
+// same measure as solution_t::calculate_similarity_radius
+template <typename i_t, typename f_t, int TPB>
+__global__ void count_equal_integers_kernel(typename problem_t<i_t, f_t>::view_t pb,
+                                            const f_t* assignment,
+                                            raft::device_span<const f_t*> other_assignments,
+                                            raft::device_span<i_t> n_equal_integers)
+{
+  typedef cub::BlockReduce<i_t, TPB> BlockReduce;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  const f_t* other_assignment = other_assignments[blockIdx.x];
+  i_t th_n_equal              = 0;
+  for (i_t i = threadIdx.x; i < (i_t)pb.integer_indices.size(); i += TPB) {
+    i_t idx         = pb.integer_indices[i];
+    auto var_bounds = pb.variable_bounds[idx];
+    th_n_equal += diverse_equal<f_t>(other_assignment[idx],
+                                     assignment[idx],
+                                     get_lower(var_bounds),
+                                     get_upper(var_bounds),
+                                     pb.is_integer_var(idx),
+                                     pb.tolerances.integrality_tolerance);
+  }
+  i_t n_equal = BlockReduce(temp_storage).Sum(th_n_equal);
+  if (threadIdx.x == 0) { n_equal_integers[blockIdx.x] = n_equal; }
+}
+
+// One block per candidate of the row major assignments matrix: computes its objective and counts
+// the violated constraints, bounds and integralities with the tolerances of compute_feasibility
+template <typename i_t, typename f_t, int TPB>
+__global__ void evaluate_assignments_kernel(typename problem_t<i_t, f_t>::view_t pb,
+                                            raft::device_span<const f_t> assignments,
+                                            raft::device_span<f_t> objectives,
+                                            raft::device_span<i_t> n_violations)
+{
+  typedef cub::BlockReduce<i_t, TPB> BlockReduceInt;
+  typedef cub::BlockReduce<f_t, TPB> BlockReduceFloat;
+  __shared__ typename BlockReduceInt::TempStorage int_temp_storage;
+  __shared__ typename BlockReduceFloat::TempStorage float_temp_storage;
+  const f_t* assignment = assignments.data() + (size_t)blockIdx.x * pb.n_variables;
+  i_t th_n_violations   = 0;
+  f_t th_objective      = 0.;
+  for (i_t c = threadIdx.x; c < pb.n_constraints; c += TPB) {
+    auto [offset_begin, offset_end] = pb.range_for_constraint(c);
+    f_t cstr_val                    = 0.;
+    for (i_t i = offset_begin; i < offset_end; i++) {
+      cstr_val += pb.coefficients[i] * assignment[pb.variables[i]];
+    }
+    th_n_violations += !is_constraint_feasible<i_t, f_t>(cstr_val,
+                                                         pb.constraint_lower_bounds[c],
+                                                         pb.constraint_upper_bounds[c],
+                                                         pb.tolerances);
+  }
+  for (i_t v = threadIdx.x; v < pb.n_variables; v += TPB) {
+    f_t val = assignment[v];
+    th_objective += pb.objective_coefficients[v] * val;
+    th_n_violations += !isfinite(val) || !pb.check_variable_within_bounds(v, val) ||
+                       (pb.is_integer_var(v) && !pb.is_integer(val));
+  }
+  i_t block_n_violations = BlockReduceInt(int_temp_storage).Sum(th_n_violations);
+  f_t block_objective    = BlockReduceFloat(float_temp_storage).Sum(th_objective);
+  if (threadIdx.x == 0) {
+    objectives[blockIdx.x]   = block_objective;
+    n_violations[blockIdx.x] = block_n_violations;
+  }
+}
+
 template <typename i_t, typename f_t>
 population_t<i_t, f_t>::population_t(std::string const& name_,
                                      mip_solver_context_t<i_t, f_t>& context_,
@@ -47,6 +116,12 @@ population_t<i_t, f_t>::population_t(std::string const& name_,
     timer(0)
 {
   best_feasible_objective = std::numeric_limits<f_t>::max();
+  auto user_callbacks     = context.settings.get_mip_callbacks();
+  if (std::any_of(user_callbacks.begin(), user_callbacks.end(), [](auto callback) {
+        return callback->get_type() == internals::base_solution_callback_type::GET_SOLUTION;
+      })) {
+    callback_queue = std::make_unique<solution_callback_queue_t<f_t>>(user_callbacks);
+  }
 }
 
 template <typename i_t>
@@ -195,6 +270,55 @@ void population_t<i_t, f_t>::preempt_heuristic_solver()
   early_exit_primal_generation      = true;
 }
 
+template <typename i_t, typename f_t>
+size_t population_t<i_t, f_t>::add_external_solutions(const rmm::device_uvector<f_t>& assignments,
+                                                      solution_origin_t origin)
+{
+  raft::common::nvtx::range fun_scope("add_external_solutions");
+  if (problem_ptr->n_variables == 0) { return 0; }
+  cuopt_assert(assignments.size() % problem_ptr->n_variables == 0,
+               "Assignments size should be a multiple of the number of variables");
+  const size_t n_candidates = assignments.size() / problem_ptr->n_variables;
+  if (n_candidates == 0) { return 0; }
+  auto stream = problem_ptr->handle_ptr->get_stream();
+  rmm::device_uvector<f_t> d_objectives(n_candidates, stream);
+  rmm::device_uvector<i_t> d_n_violations(n_candidates, stream);
+  constexpr int TPB = 256;
+  evaluate_assignments_kernel<i_t, f_t, TPB>
+    <<<n_candidates, TPB, 0, stream>>>(problem_ptr->view(),
+                                       cuopt::make_span(assignments),
+                                       cuopt::make_span(d_objectives),
+                                       cuopt::make_span(d_n_violations));
+  RAFT_CHECK_CUDA(stream);
+  auto h_objectives   = host_copy(d_objectives, stream);
+  auto h_n_violations = host_copy(d_n_violations, stream);
+
+  std::vector<size_t> feasible_candidates;
+  for (size_t i = 0; i < n_candidates; i++) {
+    if (h_n_violations[i] == 0) { feasible_candidates.push_back(i); }
+  }
+  // Only the best candidates can make it into the population, the others would only be built into
+  // solutions to be ejected
+  const size_t n_kept = std::min(feasible_candidates.size(), max_solutions);
+  std::partial_sort(feasible_candidates.begin(),
+                    feasible_candidates.begin() + n_kept,
+                    feasible_candidates.end(),
+                    [&h_objectives](size_t a, size_t b) {
+                      return h_objectives[a] < h_objectives[b];
+                    });
+  CUOPT_LOG_DEBUG("%s batch of %lu external solutions, %lu feasible, %lu queued",
+                  solution_origin_to_string(origin),
+                  n_candidates,
+                  feasible_candidates.size(),
+                  n_kept);
+  for (size_t k = 0; k < n_kept; k++) {
+    const f_t* candidate = assignments.data() + feasible_candidates[k] * problem_ptr->n_variables;
+    auto h_solution      = host_copy(candidate, problem_ptr->n_variables, stream);
+    add_external_solution(h_solution, h_objectives[feasible_candidates[k]], origin);
+  }
+  return n_kept;
+}
+
 template <typename i_t, typename f_t>
 std::vector<solution_t<i_t, f_t>> population_t<i_t, f_t>::get_external_solutions()
 {
@@ -259,6 +383,19 @@ bool population_t<i_t, f_t>::is_better_than_best_feasible(solution_t<i_t, f_t>&
   return obj_better && sol.get_feasible();
 }
 
+template <typename i_t, typename f_t>
+void population_t<i_t, f_t>::user_assignment(solution_t<i_t, f_t>& sol)
+{
+  problem_ptr->post_process_assignment(sol.assignment);
+  if (context.settings.mip_scaling) {
+    rmm::device_uvector<f_t> dummy(0, sol.handle_ptr->get_stream());
+    context.scaling.unscale_solutions(sol.assignment, dummy);
+  }
+  if (problem_ptr->has_papilo_presolve_data()) {
+    problem_ptr->papilo_uncrush_assignment(sol.assignment);
+  }
+}
+
 template <typename i_t, typename f_t>
 void population_t<i_t, f_t>::invoke_get_solution_callback(
   solution_t<i_t, f_t>& sol, internals::get_solution_callback_t* callback)
@@ -266,14 +403,7 @@ void population_t<i_t, f_t>::invoke_get_solution_callback(
   f_t user_objective = sol.get_user_objective();
   f_t user_bound     = context.stats.get_solution_bound();
   solution_t<i_t, f_t> temp_sol(sol);
-  problem_ptr->post_process_assignment(temp_sol.assignment);
-  if (context.settings.mip_scaling) {
-    rmm::device_uvector<f_t> dummy(0, temp_sol.handle_ptr->get_stream());
-    context.scaling.unscale_solutions(temp_sol.assignment, dummy);
-  }
-  if (problem_ptr->has_papilo_presolve_data()) {
-    problem_ptr->papilo_uncrush_assignment(temp_sol.assignment);
-  }
+  user_assignment(temp_sol);
 
   std::vector<f_t> user_objective_vec(1);
   std::vector<f_t> user_bound_vec(1);
@@ -301,14 +431,19 @@ void population_t<i_t, f_t>::run_solution_callbacks(solution_t<i_t, f_t>& sol)
       context.settings.benchmark_info_ptr->last_improvement_of_best_feasible = timer.elapsed_time();
     }
     CUOPT_LOG_DEBUG("Population: Found new best solution %g", sol.get_user_objective());
+    context.incumbent_bus.publish_incumbent(sol.get_objective());
     if (problem_ptr->branch_and_bound_callback != nullptr) {
       problem_ptr->branch_and_bound_callback(sol.get_host_assignment());
     }
-    for (auto callback : user_callbacks) {
-      if (callback->get_type() == internals::base_solution_callback_type::GET_SOLUTION) {
-        auto get_sol_callback = static_cast<internals::get_solution_callback_t*>(callback);
-        invoke_get_solution_callback(sol, get_sol_callback);
-      }
+    if (callback_queue != nullptr) {
+      // the copy to the host and the user code run on the callback thread
+      solution_t<i_t, f_t> temp_sol(sol);
+      user_assignment(temp_sol);
+      callback_queue->push_incumbent(temp_sol.assignment.data(),
+                                     temp_sol.assignment.size(),
+                                     sol.get_user_objective(),
+                                     context.stats.get_solution_bound(),
+                                     temp_sol.handle_ptr->get_stream());
     }
     // save the best objective here, because we might not have been able to return the solution to
     // the user because of the unscaling that causes infeasibility.
@@ -317,6 +452,7 @@ void population_t<i_t, f_t>::run_solution_callbacks(solution_t<i_t, f_t>& sol)
     best_feasible_objective = sol.get_objective();
   }
 
+  // The set solution callbacks run on the solver thread so their solutions are injected right away
   for (auto callback : user_callbacks) {
     if (callback->get_type() == internals::base_solution_callback_type::SET_SOLUTION) {
       auto set_sol_callback       = static_cast<internals::set_solution_callback_t*>(callback);
@@ -471,7 +607,6 @@ std::pair<i_t, bool> population_t<i_t, f_t>::add_solution(solution_t<i_t, f_t>&&
 
     int inserted_pos = insert_index(std::pair<size_t, double>((size_t)hint, sol_cost));
     cuopt_assert(test_invariant(), "Population invariant doesn't hold");
-    test_invariant();
     return std::make_pair(inserted_pos, best_updated);
 
   } else if (sol_cost + OBJECTIVE_EPSILON < indices[index].second) {
@@ -485,12 +620,10 @@ std::pair<i_t, bool> population_t<i_t, f_t>::add_solution(solution_t<i_t, f_t>&&
 
     int inserted_pos = insert_index(std::pair<size_t, double>((size_t)free, sol_cost));
     cuopt_assert(test_invariant(), "Population invariant doesn't hold");
-    test_invariant();
     return std::make_pair(inserted_pos, best_updated);
   }
   CUOPT_LOG_TRACE("Adding solution failed!");
   cuopt_assert(test_invariant(), "Population invariant doesn't hold");
-  test_invariant();
   return std::make_pair(-1, best_updated);
 }
 
@@ -621,13 +754,38 @@ bool population_t<i_t, f_t>::check_sols_similar(solution_t<i_t, f_t>& sol1,
   return sol1.calculate_similarity_radius(sol2) > var_threshold;
 }
 
+template <typename i_t, typename f_t>
+std::vector<i_t> population_t<i_t, f_t>::similarity_to_population(solution_t<i_t, f_t>& sol,
+                                                                  size_t start_index)
+{
+  raft::common::nvtx::range fun_scope("similarity_to_population");
+  if (start_index >= indices.size()) { return {}; }
+  std::vector<const f_t*> h_other_assignments;
+  h_other_assignments.reserve(indices.size() - start_index);
+  for (size_t i = start_index; i < indices.size(); i++) {
+    h_other_assignments.push_back(solutions[indices[i].first].second.assignment.data());
+  }
+  auto stream              = sol.handle_ptr->get_stream();
+  auto d_other_assignments = device_copy(h_other_assignments, stream);
+  rmm::device_uvector<i_t> d_n_equal_integers(h_other_assignments.size(), stream);
+  constexpr int TPB = 256;
+  count_equal_integers_kernel<i_t, f_t, TPB>
+    <<<h_other_assignments.size(), TPB, 0, stream>>>(sol.problem_ptr->view(),
+                                                     sol.assignment.data(),
+                                                     cuopt::make_span(d_other_assignments),
+                                                     cuopt::make_span(d_n_equal_integers));
+  RAFT_CHECK_CUDA(stream);
+  return host_copy(d_n_equal_integers, stream);
+}
+
 template <typename i_t, typename f_t>
 size_t population_t<i_t, f_t>::best_similar_index(solution_t<i_t, f_t>& sol)
 {
   raft::common::nvtx::range fun_scope("best_similar_index");
   if (indices.size() == 1) return max_solutions;
+  auto n_equal_integers = similarity_to_population(sol, 1);
   for (size_t i = 1; i < indices.size(); i++) {
-    if (check_sols_similar(sol, solutions[indices[i].first].second)) { return i; }
+    if (n_equal_integers[i - 1] > var_threshold) { return i; }
   }
 
   cuopt_assert(test_invariant(), "Population invariant doesn't hold");
@@ -655,8 +813,9 @@ bool population_t<i_t, f_t>::check_if_feasible_similar_exists(size_t start_index
                                                               solution_t<i_t, f_t>& sol)
 {
   raft::common::nvtx::range fun_scope("check_if_feasible_similar_exists");
+  auto n_equal_integers = similarity_to_population(sol, start_index);
   for (size_t i = start_index; i < indices.size(); i++) {
-    if (check_sols_similar(sol, solutions[indices[i].first].second)) {
+    if (n_equal_integers[i - start_index] > var_threshold) {
       if (solutions[indices[i].first].second.get_feasible()) { return true; }
     }
   }
@@ -667,8 +826,9 @@ template <typename i_t, typename f_t>
 void population_t<i_t, f_t>::eradicate_similar(size_t start_index, solution_t<i_t, f_t>& sol)
 {
   raft::common::nvtx::range fun_scope("eradicate_similar");
+  auto n_equal_integers = similarity_to_population(sol, start_index);
   for (size_t i = start_index; i < indices.size(); i++) {
-    if (check_sols_similar(sol, solutions[indices[i].first].second)) {
+    if (n_equal_integers[i - start_index] > var_threshold) {
       solutions[indices[i].first].first = false;              // mark place as available
       indices[i].first = std::numeric_limits<size_t>::max();  // mark as deleted in indices
     }
@@ -815,9 +975,9 @@ bool population_t<i_t, f_t>::test_invariant()
       return false;
     }
     // Each two solutions radius should be lower then threshold
+    auto n_equal_integers = similarity_to_population(solutions[indices[i].first].second, i + 1);
     for (size_t j = i + 1; j < indices.size(); j++) {
-      if (check_sols_similar(solutions[indices[i].first].second,
-                             solutions[indices[j].first].second)) {
+      if (n_equal_integers[j - i - 1] > var_threshold) {
         CUOPT_LOG_ERROR("Solutions radius greater then threshold: %d %d\n",
                         (int)indices[i].first,
                         (int)indices[j].first);
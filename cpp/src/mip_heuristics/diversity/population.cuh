@@ -12,8 +12,10 @@
 
 #include <mip_heuristics/solution/solution.cuh>
 #include <mip_heuristics/solver.cuh>
+#include <mip_heuristics/utilities/solution_callback_queue.cuh>
 #include <utilities/timer.hpp>
 
+#include <memory>
 #include <mutex>
 #include <random>
 #include <string>
@@ -107,6 +109,13 @@ class population_t {
   void add_external_solution(const std::vector<f_t>& solution,
                              f_t objective,
                              solution_origin_t origin);
+  /*! \brief { Checks a batch of candidates in a single kernel and queues the best feasible ones
+   *  like add_external_solution. assignments is a row major matrix with one candidate of
+   *  problem_ptr->n_variables values per row, in the space of the presolved problem. }
+   *  \return { Number of queued candidates }
+   */
+  size_t add_external_solutions(const rmm::device_uvector<f_t>& assignments,
+                                solution_origin_t origin);
   std::vector<solution_t<i_t, f_t>> get_external_solutions();
   void add_external_solutions_to_population();
   size_t get_external_solution_size();
@@ -127,6 +136,11 @@ class population_t {
    *  \return { Index of the best solution similar to sol. If no similar is found we return
    * max_solutions. }*/
   size_t best_similar_index(solution_t<i_t, f_t>& sol);
+  /*! \brief { Compares sol with the solutions of the population from start_index on in a single
+   * launch. }
+   *  \return { Number of integers on which sol agrees with each of them, in the order of indices }
+   */
+  std::vector<i_t> similarity_to_population(solution_t<i_t, f_t>& sol, size_t start_index);
 
   // normalizes the weights according to the cstr importance
   void normalize_weights();
@@ -164,6 +178,9 @@ class population_t {
   void invoke_get_solution_callback(solution_t<i_t, f_t>& sol,
                                     internals::get_solution_callback_t* callback);
 
+  // maps the assignment of sol back to the user problem
+  void user_assignment(solution_t<i_t, f_t>& sol);
+
   // does some consistency tests
   bool test_invariant();
 
@@ -210,6 +227,9 @@ class population_t {
   f_t best_feasible_objective                    = std::numeric_limits<f_t>::max();
   assignment_hash_map_t<i_t, f_t> population_hash_map;
   cuopt::timer_t timer;
+  // delivers the incumbents to the user callbacks and polls the injected solutions on its own
+  // thread, null when there are no user callbacks
+  std::unique_ptr<solution_callback_queue_t<f_t>> callback_queue;
 };
 
 }  // namespace cuopt::linear_programming::detail
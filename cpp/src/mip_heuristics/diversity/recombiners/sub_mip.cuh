@@ -86,7 +86,8 @@ class sub_mip_recombiner_t : public recombiner_t<i_t, f_t> {
     scaling.scale_problem();
     fixed_problem.presolve_data.reset_additional_vars(fixed_problem, offspring.handle_ptr);
     fixed_problem.presolve_data.initialize_var_mapping(fixed_problem, offspring.handle_ptr);
-    trivial_presolve(fixed_problem);
+    // fixing the variables recomputed the transpose
+    trivial_presolve(fixed_problem, false, true);
     fixed_problem.check_problem_representation(true);
     // brute force rounding threshold is 8
     const bool run_sub_mip                             = fixed_problem.n_integer_vars > 8;
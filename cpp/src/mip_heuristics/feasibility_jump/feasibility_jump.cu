@@ -63,7 +63,8 @@ fj_t<i_t, f_t>::fj_t(mip_solver_context_t<i_t, f_t>& context_, fj_settings_t in_
     work_id_to_nonbin_var_idx(pb_ptr->coefficients.size(), pb_ptr->handle_ptr->get_stream()),
     row_size_bin_prefix_sum(pb_ptr->binary_indices.size(), pb_ptr->handle_ptr->get_stream()),
     row_size_nonbin_prefix_sum(pb_ptr->nonbinary_indices.size(), pb_ptr->handle_ptr->get_stream()),
-    work_ids_for_related_vars(pb_ptr->n_variables, pb_ptr->handle_ptr->get_stream())
+    work_ids_for_related_vars(pb_ptr->n_variables, pb_ptr->handle_ptr->get_stream()),
+    heavy_constraints(0, pb_ptr->handle_ptr->get_stream())
 {
   setval_launch_dims = get_launch_dims_max_occupancy(
     (void*)update_assignment_kernel<i_t, f_t>, TPB_setval, pb_ptr->handle_ptr);
@@ -93,6 +94,8 @@ fj_t<i_t, f_t>::fj_t(mip_solver_context_t<i_t, f_t>& context_, fj_settings_t in_
     (void*)load_balancing_mtm_compute_scores<i_t, f_t>, TPB_loadbalance, pb_ptr->handle_ptr);
   load_balancing_prepare_launch_dims = get_launch_dims_max_occupancy(
     (void*)load_balancing_prepare_iteration<i_t, f_t>, TPB_loadbalance, pb_ptr->handle_ptr);
+  heavy_cstrs_launch_dims = get_launch_dims_max_occupancy(
+    (void*)init_lhs_and_violation_heavy<i_t, f_t>, TPB_heavycstrs, pb_ptr->handle_ptr);
   reset_weights(pb_ptr->handle_ptr->get_stream());
 
   // ensure the problem and its transpose are in a valid state (assert checks)
@@ -107,8 +110,10 @@ fj_t<i_t, f_t>::fj_t(mip_solver_context_t<i_t, f_t>& context_, fj_settings_t in_
 template <typename i_t, typename f_t>
 void fj_t<i_t, f_t>::reset_cuda_graph()
 {
-  if (graph_created) cudaGraphExecDestroy(graph_instance);
-  graph_created = false;
+  for (auto& climber : climbers) {
+    if (climber->graph_created) cudaGraphExecDestroy(climber->graph_instance);
+    climber->graph_created = false;
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -150,6 +155,30 @@ void fj_t<i_t, f_t>::randomize_weights(const raft::handle_t* handle_ptr)
   handle_ptr->sync_stream();
 }
 
+template <typename i_t, typename f_t>
+void fj_t<i_t, f_t>::randomize_climber_weights(i_t climber_idx,
+                                               const rmm::cuda_stream_view& stream)
+{
+  auto& climber = *climbers[climber_idx];
+  std::mt19937 rng(cuopt::seed_generator::get_seed());
+  constexpr f_t min_weight = 10.;
+  constexpr f_t max_weight = 30.;
+  auto h_cstr_vec =
+    get_random_uniform_vector<i_t, f_t>(pb_ptr->n_constraints, rng, min_weight, max_weight);
+  f_t h_max_weight =
+    h_cstr_vec.empty() ? min_weight : *std::max_element(h_cstr_vec.begin(), h_cstr_vec.end());
+  climber.independent = true;
+  climber.cstr_weights.resize(h_cstr_vec.size(), stream);
+  climber.cstr_left_weights.resize(h_cstr_vec.size(), stream);
+  climber.cstr_right_weights.resize(h_cstr_vec.size(), stream);
+  climber.max_cstr_weight.set_value_async(h_max_weight, stream);
+  raft::copy(climber.cstr_weights.data(), h_cstr_vec.data(), h_cstr_vec.size(), stream);
+  raft::copy(climber.cstr_left_weights.data(), h_cstr_vec.data(), h_cstr_vec.size(), stream);
+  raft::copy(climber.cstr_right_weights.data(), h_cstr_vec.data(), h_cstr_vec.size(), stream);
+  raft::copy(climber.objective_weight.data(), objective_weight.data(), 1, stream);
+  stream.synchronize();
+}
+
 template <typename i_t, typename f_t>
 fj_t<i_t, f_t>::climber_data_t::view_t fj_t<i_t, f_t>::climber_data_t::view()
 {
@@ -190,6 +219,7 @@ fj_t<i_t, f_t>::climber_data_t::view_t fj_t<i_t, f_t>::climber_data_t::view()
   v.jump_candidate_count = make_span(jump_candidate_count);
   v.jump_locks           = make_span(jump_locks);
   v.candidate_arrived_workids         = make_span(candidate_arrived_workids);
+  v.heavy_constraints                 = make_span(fj.heavy_constraints);
   v.grid_score_buf                    = make_span(grid_score_buf);
   v.grid_delta_buf                    = make_span(grid_delta_buf);
   v.grid_var_buf                      = make_span(grid_var_buf);
@@ -228,6 +258,26 @@ fj_t<i_t, f_t>::climber_data_t::view_t fj_t<i_t, f_t>::climber_data_t::view()
   v.full_refresh_iteration            = full_refresh_iteration.data();
   RAFT_CUDA_TRY(cudaGetSymbolAddress((void**)&v.settings, device_settings));
 
+  // FJ may run on a sub-MIP whose objective has another offset than the main problem. The cutoff
+  // changes at any time, so it is not read in deterministic mode
+  const auto& bus    = fj.context.incumbent_bus;
+  const double shift = fj.pb_ptr->get_solver_obj_from_user_obj(bus.user_objective(0.0));
+  const double one   = fj.pb_ptr->get_solver_obj_from_user_obj(bus.user_objective(1.0));
+  v.objective_cutoff = fj.context.settings.determinism_mode == CUOPT_MODE_DETERMINISTIC
+                         ? nullptr
+                         : bus.device_objective_cutoff();
+  v.cutoff_shift     = shift;
+  v.cutoff_scale     = one - shift;
+
+  if (independent) {
+    v.cstr_weights       = make_span(cstr_weights);
+    v.cstr_left_weights  = make_span(cstr_left_weights);
+    v.cstr_right_weights = make_span(cstr_right_weights);
+    v.max_cstr_weight    = max_cstr_weight.data();
+    v.objective_weight   = objective_weight.data();
+    v.settings           = climber_settings.data();
+  }
+
   return v;
 }
 
@@ -300,6 +350,18 @@ void fj_t<i_t, f_t>::device_init(const rmm::cuda_stream_view& stream)
                                     "invalid bounds for binary variable");
                      }
                    });
+
+  // split the constraints by length once per problem, the heavy ones get their own LHS kernel
+  heavy_constraints.resize(pb_ptr->n_constraints, stream);
+  auto heavy_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<i_t>(0),
+    thrust::counting_iterator<i_t>(pb_ptr->n_constraints),
+    heavy_constraints.begin(),
+    [offsets = make_span(pb_ptr->offsets)] __device__(i_t cstr_idx) -> bool {
+      return offsets[cstr_idx + 1] - offsets[cstr_idx] > heavy_cstr_min_nnz;
+    });
+  heavy_constraints.resize(heavy_end - heavy_constraints.begin(), stream);
 }
 
 template <typename i_t, typename f_t>
@@ -435,6 +497,11 @@ void fj_t<i_t, f_t>::climber_init(i_t climber_idx, const rmm::cuda_stream_view&
   climber->violation_score.set_value_to_zero_async(climber_stream);
   climber->weighted_violation_score.set_value_to_zero_async(climber_stream);
   init_lhs_and_violation<i_t, f_t><<<256, 256, 0, climber_stream.value()>>>(view);
+  if (heavy_constraints.size() > 0) {
+    auto [grid_heavy_cstrs, blocks_heavy_cstrs] = heavy_cstrs_launch_dims;
+    init_lhs_and_violation_heavy<i_t, f_t>
+      <<<grid_heavy_cstrs, blocks_heavy_cstrs, 0, climber_stream.value()>>>(view);
+  }
 
   // initialize the best_objective values according to the initial assignment
   f_t best_obj = compute_objective_from_vec<i_t, f_t>(
@@ -570,6 +637,15 @@ void fj_t<i_t, f_t>::set_fj_settings(fj_settings_t settings_)
   settings = settings_;
 }
 
+template <typename i_t, typename f_t>
+std::pair<dim3, dim3> fj_t<i_t, f_t>::climber_launch_dims(
+  const std::pair<dim3, dim3>& launch_dims) const
+{
+  auto [grid, blocks] = launch_dims;
+  grid.x              = std::max(1u, grid.x / (unsigned)n_concurrent_climbers);
+  return {grid, blocks};
+}
+
 template <typename i_t, typename f_t>
 void fj_t<i_t, f_t>::run_step_device(i_t climber_idx, bool use_graph)
 {
@@ -585,13 +661,13 @@ void fj_t<i_t, f_t>::load_balancing_score_update(const rmm::cuda_stream_view& st
                                                  i_t climber_idx)
 {
   auto [grid_load_balancing_prepare, blocks_load_balancing_prepare] =
-    load_balancing_prepare_launch_dims;
+    climber_launch_dims(load_balancing_prepare_launch_dims);
   auto [grid_load_balancing_binary, blocks_load_balancing_binary] =
-    load_balancing_binary_launch_dims;
+    climber_launch_dims(load_balancing_binary_launch_dims);
   auto [grid_load_balancing_mtm_compute_scores, blocks_load_balancing_mtm_compute_scores] =
-    load_balancing_mtm_compute_scores_launch_dims;
+    climber_launch_dims(load_balancing_mtm_compute_scores_launch_dims);
   auto [grid_load_balancing_mtm_compute_candidates, blocks_load_balancing_mtm_compute_candidates] =
-    load_balancing_mtm_compute_candidates_launch_dims;
+    climber_launch_dims(load_balancing_mtm_compute_candidates_launch_dims);
 
   auto& data = *climbers[climber_idx];
   auto v     = data.view();
@@ -647,13 +723,15 @@ void fj_t<i_t, f_t>::run_step_device(const rmm::cuda_stream_view& climber_stream
                                      bool use_graph)
 {
   raft::common::nvtx::range scope("run_step_device");
-  auto [grid_setval, blocks_setval] = setval_launch_dims;
+  auto [grid_setval, blocks_setval] = climber_launch_dims(setval_launch_dims);
   auto [grid_update_changed_constraints, blocks_update_changed_constraints] =
-    update_changed_constraints_launch_dims;
-  auto [grid_resetmoves, blocks_resetmoves]         = resetmoves_launch_dims;
-  auto [grid_resetmoves_bin, blocks_resetmoves_bin] = resetmoves_bin_launch_dims;
-  auto [grid_update_weights, blocks_update_weights] = update_weights_launch_dims;
-  auto [grid_lift_move, blocks_lift_move]           = lift_move_launch_dims;
+    climber_launch_dims(update_changed_constraints_launch_dims);
+  auto [grid_resetmoves, blocks_resetmoves] = climber_launch_dims(resetmoves_launch_dims);
+  auto [grid_resetmoves_bin, blocks_resetmoves_bin] =
+    climber_launch_dims(resetmoves_bin_launch_dims);
+  auto [grid_update_weights, blocks_update_weights] =
+    climber_launch_dims(update_weights_launch_dims);
+  auto [grid_lift_move, blocks_lift_move] = climber_launch_dims(lift_move_launch_dims);
 
   auto& data    = *climbers[climber_idx];
   auto v        = data.view();
@@ -687,7 +765,7 @@ void fj_t<i_t, f_t>::run_step_device(const rmm::cuda_stream_view& climber_stream
   void* reset_moves_args[]       = {&v, &force_reset};
   bool ignore_load_balancing     = false;
   void* update_assignment_args[] = {&v, &ignore_load_balancing};
-  if (!graph_created || !use_graph) {
+  if (!data.graph_created || !use_graph) {
     // CUB temp storage initialization
     size_t compaction_temp_storage_bytes = 0;
     auto valid_move_iterator             = thrust::make_transform_iterator(
@@ -806,14 +884,14 @@ void fj_t<i_t, f_t>::run_step_device(const rmm::cuda_stream_view& climber_stream
 
     if (use_graph) {
       cudaStreamEndCapture(climber_stream, &graph);
-      cudaGraphInstantiate(&graph_instance, graph);
+      cudaGraphInstantiate(&data.graph_instance, graph);
       RAFT_CHECK_CUDA(climber_stream);
       cudaGraphDestroy(graph);
-      graph_created = true;
+      data.graph_created = true;
     }
   }
 
-  if (use_graph) cudaGraphLaunch(graph_instance, climber_stream);
+  if (use_graph) cudaGraphLaunch(data.graph_instance, climber_stream);
 }
 
 template <typename i_t, typename f_t>
@@ -844,6 +922,10 @@ void fj_t<i_t, f_t>::refresh_lhs_and_violation(const rmm::cuda_stream_view& stre
   data.violation_score.set_value_to_zero_async(stream);
   data.weighted_violation_score.set_value_to_zero_async(stream);
   init_lhs_and_violation<i_t, f_t><<<4096, 256, 0, stream>>>(v);
+  if (heavy_constraints.size() > 0) {
+    auto [grid_heavy_cstrs, blocks_heavy_cstrs] = heavy_cstrs_launch_dims;
+    init_lhs_and_violation_heavy<i_t, f_t><<<grid_heavy_cstrs, blocks_heavy_cstrs, 0, stream>>>(v);
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -975,6 +1057,102 @@ i_t fj_t<i_t, f_t>::host_loop(solution_t<i_t, f_t>& solution, i_t climber_idx)
   return steps;
 }
 
+template <typename i_t, typename f_t>
+i_t fj_t<i_t, f_t>::batched_host_loop(solution_t<i_t, f_t>& solution, i_t n_climbers)
+{
+  cuopt_assert(n_climbers > 0 && n_climbers <= (i_t)climbers.size(), "");
+  auto [grid_resetmoves, blocks_resetmoves] = resetmoves_launch_dims;
+  f_t obj = -std::numeric_limits<f_t>::infinity();
+  for (i_t i = 0; i < n_climbers; ++i) {
+    auto& data = *climbers[i];
+    if (settings.feasibility_run) {
+      auto& climber_objective_weight = data.independent ? data.objective_weight : objective_weight;
+      climber_objective_weight.set_value_to_zero_async(handle_ptr->get_stream());
+    }
+    data.incumbent_quality.set_value_async(obj, handle_ptr->get_stream());
+  }
+  handle_ptr->sync_stream();
+
+  // the best solution of each climber is checked in candidate, the best one is kept in solution
+  solution_t<i_t, f_t> candidate(solution);
+  bool best_feasible = false;
+  f_t best_value     = std::numeric_limits<f_t>::infinity();
+  std::vector<bool> active(n_climbers, true);
+  i_t n_active = n_climbers;
+
+  timer_t timer(settings.time_limit);
+  i_t steps;
+  bool limit_reached = false;
+  bool found_first   = false;
+  for (steps = 0; steps < std::numeric_limits<i_t>::max(); steps += iterations_per_graph) {
+    // to actualize time limit, and to keep the queues of the climbers short
+    for (i_t i = 0; i < n_climbers; ++i) {
+      climbers[i]->stream.view().synchronize();
+    }
+    if (timer.check_time_limit() || steps >= settings.iteration_limit ||
+        context.preempt_heuristic_solver_.load()) {
+      limit_reached = true;
+    }
+
+    if (steps % 10000 == 0) {
+      context.diversity_manager_ptr->get_population_pointer()
+        ->add_external_solutions_to_population();
+    }
+
+    for (i_t i = 0; i < n_climbers; ++i) {
+      if (!active[i]) { continue; }
+      auto climber_stream = climbers[i]->stream.view();
+      if (!limit_reached) { run_step_device(climber_stream, i); }
+      if (steps % settings.parameters.lhs_refresh_period == 0) {
+        refresh_lhs_and_violation(climber_stream, i);
+      }
+    }
+
+    if (steps % settings.parameters.sync_period != 0 && !limit_reached) { continue; }
+
+    for (i_t i = 0; i < n_climbers; ++i) {
+      if (!active[i]) { continue; }
+      auto& data          = *climbers[i];
+      auto climber_stream = data.stream.view();
+      i_t break_condition = data.break_condition.value(climber_stream);
+      update_best_solution_kernel<i_t, f_t>
+        <<<1, blocks_resetmoves, 0, climber_stream>>>(data.view());
+      raft::copy(candidate.assignment.data(),
+                 data.best_assignment.data(),
+                 data.best_assignment.size(),
+                 climber_stream);
+      climber_stream.synchronize();
+      // feasible solutions are ranked by objective, the others by their total excess
+      bool is_feasible = candidate.compute_feasibility();
+      f_t value        = is_feasible ? candidate.get_objective() : candidate.get_total_excess();
+      bool improves    = is_feasible == best_feasible ? value < best_value : is_feasible;
+      if (improves) {
+        best_feasible = is_feasible;
+        best_value    = value;
+        solution.copy_from(candidate);
+      }
+      if (is_feasible && settings.mode == fj_mode_t::FIRST_FEASIBLE) { found_first = true; }
+      if (settings.mode != fj_mode_t::FIRST_FEASIBLE && break_condition) {
+        CUOPT_LOG_TRACE(FJ_LOG_PREFIX "climber %d exits at step %d", i, steps);
+        active[i] = false;
+        n_active--;
+      }
+    }
+    if (limit_reached || found_first || n_active == 0) { break; }
+  }
+  for (i_t i = 0; i < n_climbers; ++i) {
+    climbers[i]->stream.view().synchronize();
+  }
+  CUOPT_LOG_DEBUG("EXIT batched FJ %d climbers step %d, best objective %f best_excess %f, feas %d",
+                  n_climbers,
+                  steps,
+                  solution.get_user_objective(),
+                  solution.get_total_excess(),
+                  solution.get_feasible());
+
+  return steps;
+}
+
 template <typename i_t, typename f_t>
 i_t fj_t<i_t, f_t>::alloc_max_climbers(i_t desired_climbers)
 {
@@ -1011,34 +1189,35 @@ template <typename i_t, typename f_t>
 void fj_t<i_t, f_t>::resize_vectors(const raft::handle_t* handle_ptr)
 {
   // climber related vars
-  climbers[0]->constraints_changed.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
-  climbers[0]->violated_constraints.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
-  climbers[0]->best_assignment.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->incumbent_assignment.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->incumbent_lhs.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
-  climbers[0]->incumbent_lhs_sumcomp.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
-  climbers[0]->jump_move_scores.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->jump_move_delta.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->jump_move_infeasibility.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->move_last_update.resize(pb_ptr->n_variables * FJ_MOVE_SIZE,
-                                       handle_ptr->get_stream());
-  climbers[0]->move_delta.resize(pb_ptr->n_variables * FJ_MOVE_SIZE, handle_ptr->get_stream());
-  climbers[0]->move_score.resize(pb_ptr->n_variables * FJ_MOVE_SIZE, handle_ptr->get_stream());
-  climbers[0]->tabu_nodec_until.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->tabu_noinc_until.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->tabu_lastdec.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->tabu_lastinc.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->candidate_variables.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->iteration_related_variables.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->jump_locks.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-  climbers[0]->candidate_arrived_workids.resize(pb_ptr->coefficients.size(),
-                                                handle_ptr->get_stream());
-  climbers[0]->jump_candidates.resize(pb_ptr->coefficients.size(), handle_ptr->get_stream());
-  climbers[0]->jump_candidate_count.resize(pb_ptr->n_variables, handle_ptr->get_stream());
-
-  climbers[0]->grid_score_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
-  climbers[0]->grid_var_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
-  climbers[0]->grid_delta_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
+  for (auto& climber : climbers) {
+    climber->constraints_changed.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
+    climber->violated_constraints.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
+    climber->best_assignment.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->incumbent_assignment.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->incumbent_lhs.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
+    climber->incumbent_lhs_sumcomp.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
+    climber->jump_move_scores.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->jump_move_delta.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->jump_move_infeasibility.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->move_last_update.resize(pb_ptr->n_variables * FJ_MOVE_SIZE, handle_ptr->get_stream());
+    climber->move_delta.resize(pb_ptr->n_variables * FJ_MOVE_SIZE, handle_ptr->get_stream());
+    climber->move_score.resize(pb_ptr->n_variables * FJ_MOVE_SIZE, handle_ptr->get_stream());
+    climber->tabu_nodec_until.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->tabu_noinc_until.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->tabu_lastdec.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->tabu_lastinc.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->candidate_variables.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->iteration_related_variables.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->jump_locks.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+    climber->candidate_arrived_workids.resize(pb_ptr->coefficients.size(),
+                                              handle_ptr->get_stream());
+    climber->jump_candidates.resize(pb_ptr->coefficients.size(), handle_ptr->get_stream());
+    climber->jump_candidate_count.resize(pb_ptr->n_variables, handle_ptr->get_stream());
+
+    climber->grid_score_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
+    climber->grid_var_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
+    climber->grid_delta_buf.resize(update_weights_launch_dims.first.x, handle_ptr->get_stream());
+  }
 
   // FJ related vars
   cstr_weights.resize(pb_ptr->n_constraints, handle_ptr->get_stream());
@@ -1066,6 +1245,11 @@ i_t fj_t<i_t, f_t>::solve(solution_t<i_t, f_t>& solution)
     cuopt_assert(solution.test_number_all_integer(), "All integers must be rounded");
   }
   pb_ptr->check_problem_representation(true);
+  // the rounding mode finishes on the state of the first climber, it always runs alone
+  i_t n_climbers = 1;
+  if (settings.n_climbers > 1 && settings.mode != fj_mode_t::ROUNDING) {
+    n_climbers = alloc_max_climbers(settings.n_climbers);
+  }
   resize_vectors(solution.handle_ptr);
 
   bool is_initial_feasible = solution.compute_feasibility();
@@ -1098,11 +1282,27 @@ i_t fj_t<i_t, f_t>::solve(solution_t<i_t, f_t>& solution)
                handle_ptr->get_stream());
   }
 
-  climber_init(0);
-  RAFT_CHECK_CUDA(handle_ptr->get_stream());
-  handle_ptr->sync_stream();
+  i_t iterations;
+  if (n_climbers > 1) {
+    // the climbers are initialized one after the other on the main stream, as they all rebuild
+    // the shared load balancing structures
+    for (i_t i = 0; i < n_climbers; ++i) {
+      if (i > 0) { randomize_climber_weights(i, handle_ptr->get_stream()); }
+      climber_init(i, handle_ptr->get_stream());
+    }
+    RAFT_CHECK_CUDA(handle_ptr->get_stream());
+    handle_ptr->sync_stream();
 
-  i_t iterations = host_loop(solution);
+    n_concurrent_climbers = n_climbers;
+    iterations            = batched_host_loop(solution, n_climbers);
+    n_concurrent_climbers = 1;
+  } else {
+    climber_init(0);
+    RAFT_CHECK_CUDA(handle_ptr->get_stream());
+    handle_ptr->sync_stream();
+
+    iterations = host_loop(solution);
+  }
   RAFT_CHECK_CUDA(handle_ptr->get_stream());
   handle_ptr->sync_stream();
 
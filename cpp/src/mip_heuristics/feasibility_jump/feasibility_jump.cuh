@@ -33,6 +33,10 @@ static constexpr int TPB_update_changed_constraints = raft::WarpSize * 4;
 static constexpr int TPB_liftmoves                  = raft::WarpSize * 4;
 static constexpr int TPB_loadbalance                = raft::WarpSize * 4;
 
+// constraints with more nonzeros than this have their LHS summed by a whole block rather than by a
+// single thread, so that a few very long rows do not stall the LHS refresh
+static constexpr int heavy_cstr_min_nnz = 1024;
+
 struct fj_hyper_parameters_t {
   // The number of moves to evaluate, if there are many positive-score
   // variables available.
@@ -107,6 +111,9 @@ struct fj_settings_t {
   bool feasibility_run        = true;
   fj_load_balancing_mode_t load_balancing_mode{fj_load_balancing_mode_t::AUTO};
   double baseline_objective_for_longer_run{std::numeric_limits<double>::lowest()};
+  // number of climbers descending concurrently from the same solution with their own seeds and
+  // weights, each on its own slice of the grid. The best solution found by any of them is kept
+  int n_climbers{1};
 };
 
 struct fj_move_t {
@@ -214,16 +221,23 @@ class fj_t {
                  f_t time_limit = +std::numeric_limits<f_t>::infinity());
   i_t alloc_max_climbers(i_t desired_climbers);
   void resize_vectors(const raft::handle_t* handle_ptr);
+  // returns the launch dimensions of a kernel once its grid is split between the climbers
+  std::pair<dim3, dim3> climber_launch_dims(const std::pair<dim3, dim3>& launch_dims) const;
   void device_init(const rmm::cuda_stream_view& stream);
   void climber_init(i_t climber_idx);
   void climber_init(i_t climber_idx, const rmm::cuda_stream_view& stream);
   void set_fj_settings(fj_settings_t settings_);
   void reset_weights(const rmm::cuda_stream_view& stream, f_t weight = 10.);
   void randomize_weights(const raft::handle_t* handle_ptr);
+  // gives an independent climber its own random weights, for it to descend differently
+  void randomize_climber_weights(i_t climber_idx, const rmm::cuda_stream_view& stream);
   void copy_weights(const weight_t<i_t, f_t>& weights,
                     const raft::handle_t* handle_ptr,
                     std::optional<i_t> new_size = std::nullopt);
   i_t host_loop(solution_t<i_t, f_t>& solution, i_t climber_idx = 0);
+  // runs the first n_climbers climbers concurrently, each on its own stream, and leaves the best
+  // solution found in solution
+  i_t batched_host_loop(solution_t<i_t, f_t>& solution, i_t n_climbers);
   void run_step_device(i_t climber_idx = 0, bool use_graph = true);
   void run_step_device(const rmm::cuda_stream_view& stream,
                        i_t climber_idx = 0,
@@ -262,9 +276,8 @@ class fj_t {
   rmm::device_uvector<fj_load_balancing_workid_mapping_t> work_id_to_bin_var_idx;
   rmm::device_uvector<fj_load_balancing_workid_mapping_t> work_id_to_nonbin_var_idx;
   rmm::device_uvector<i_t> work_ids_for_related_vars;
-
-  cudaGraphExec_t graph_instance;
-  bool graph_created = false;
+  // constraints with more than heavy_cstr_min_nnz nonzeros
+  rmm::device_uvector<i_t> heavy_constraints;
 
   // kernel launch dimensions, computed once inside the constructor
   std::pair<dim3, dim3> setval_launch_dims;
@@ -283,6 +296,8 @@ class fj_t {
 
   i_t load_balancing_variable_count;
   i_t load_balancing_constraint_count;
+  // number of climbers sharing the grid, the cooperative kernels of each get a slice of it
+  i_t n_concurrent_climbers{1};
 
   // data that is specific to each individual climber running on its own seed
   // boilerplate for now, will become useful when support for parallel descents is added
@@ -361,6 +376,19 @@ class fj_t {
     rmm::device_uvector<std::byte> cub_storage_bytes;
     rmm::device_uvector<f_t> dot_product_buffer;
 
+    cudaGraphExec_t graph_instance;
+    bool graph_created = false;
+
+    // an independent climber keeps its own weights and device settings instead of those of the
+    // fj_t, so that it can run concurrently with the others. The problem data is still shared
+    bool independent = false;
+    rmm::device_uvector<f_t> cstr_weights;
+    rmm::device_uvector<f_t> cstr_right_weights;
+    rmm::device_uvector<f_t> cstr_left_weights;
+    rmm::device_scalar<f_t> max_cstr_weight;
+    rmm::device_scalar<f_t> objective_weight;
+    rmm::device_scalar<fj_settings_t> climber_settings;
+
     climber_data_t(fj_t& in_fj)
       : fj(in_fj),
         selected_var(std::numeric_limits<i_t>::max(), fj.handle_ptr->get_stream()),
@@ -417,7 +445,13 @@ class fj_t {
         break_condition(0, fj.handle_ptr->get_stream()),
         temp_break_condition(0, fj.handle_ptr->get_stream()),
         cub_storage_bytes(0, fj.handle_ptr->get_stream()),
-        dot_product_buffer(fj.pb_ptr->n_variables, fj.handle_ptr->get_stream())
+        dot_product_buffer(fj.pb_ptr->n_variables, fj.handle_ptr->get_stream()),
+        cstr_weights(0, fj.handle_ptr->get_stream()),
+        cstr_right_weights(0, fj.handle_ptr->get_stream()),
+        cstr_left_weights(0, fj.handle_ptr->get_stream()),
+        max_cstr_weight(0, fj.handle_ptr->get_stream()),
+        objective_weight(0, fj.handle_ptr->get_stream()),
+        climber_settings(fj.settings, fj.handle_ptr->get_stream())
     {
       // Allocate space for the objective dot product reduction
       size_t temp_storage_bytes = 0;
@@ -466,6 +500,7 @@ class fj_t {
       raft::device_span<i_t> jump_locks;
       raft::device_span<i_t> work_ids_for_related_vars;
       raft::device_span<i_t> candidate_arrived_workids;
+      raft::device_span<i_t> heavy_constraints;
 
       raft::device_span<f_t> cstr_coeff_reciprocal;
       raft::device_span<f_t> constraint_lower_bounds_csr;
@@ -513,6 +548,12 @@ class fj_t {
       i_t* load_balancing_skip;
       f_t* max_cstr_weight;
 
+      // Global objective cutoff of the incumbent bus, null if not readable from the device. It is
+      // in the space of the main problem, cutoff_scale * cutoff + cutoff_shift in the FJ one
+      const volatile double* objective_cutoff;
+      double cutoff_scale;
+      double cutoff_shift;
+
       fj_settings_t* settings;
 
       HDI f_t lower_excess_score(i_t cstr, f_t lhs, f_t c_lb) const
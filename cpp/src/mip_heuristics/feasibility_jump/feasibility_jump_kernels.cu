@@ -138,11 +138,24 @@ DI void update_weights(typename fj_t<i_t, f_t>::climber_data_t::view_t& fj)
   }
 }
 
+template <typename i_t, typename f_t>
+DI void init_violation(typename fj_t<i_t, f_t>::climber_data_t::view_t& fj, i_t cstr_idx)
+{
+  f_t th_violation       = fj.excess_score(cstr_idx, fj.incumbent_lhs[cstr_idx]);
+  f_t weighted_violation = th_violation * fj.cstr_weights[cstr_idx];
+  atomicAdd(fj.violation_score, th_violation);
+  atomicAdd(fj.weighted_violation_score, weighted_violation);
+  f_t cstr_tolerance = fj.get_corrected_tolerance(cstr_idx);
+  if (th_violation < -cstr_tolerance) { fj.violated_constraints.insert(cstr_idx); }
+}
+
 template <typename i_t, typename f_t>
 __global__ void init_lhs_and_violation(typename fj_t<i_t, f_t>::climber_data_t::view_t fj)
 {
   for (i_t cstr_idx = TH_ID_X; cstr_idx < fj.pb.n_constraints; cstr_idx += GRID_STRIDE) {
     auto [offset_begin, offset_end] = fj.pb.range_for_constraint(cstr_idx);
+    // left to init_lhs_and_violation_heavy
+    if (offset_end - offset_begin > heavy_cstr_min_nnz) { continue; }
 
     auto delta_it =
       thrust::make_transform_iterator(thrust::make_counting_iterator(0), [fj] __device__(i_t j) {
@@ -151,13 +164,39 @@ __global__ void init_lhs_and_violation(typename fj_t<i_t, f_t>::climber_data_t::
     fj.incumbent_lhs[cstr_idx] =
       fj_kahan_babushka_neumaier_sum<i_t, f_t>(delta_it + offset_begin, delta_it + offset_end);
     fj.incumbent_lhs_sumcomp[cstr_idx] = 0;
+    init_violation<i_t, f_t>(fj, cstr_idx);
+  }
+}
+
+template <typename i_t, typename f_t>
+__global__ void init_lhs_and_violation_heavy(typename fj_t<i_t, f_t>::climber_data_t::view_t fj)
+{
+  typedef cub::BlockReduce<f_t, TPB_heavycstrs> BlockReduce;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  cuopt_assert(blockDim.x == TPB_heavycstrs, "invalid TPB");
+  for (i_t i = blockIdx.x; i < fj.heavy_constraints.size(); i += gridDim.x) {
+    i_t cstr_idx                    = fj.heavy_constraints[i];
+    auto [offset_begin, offset_end] = fj.pb.range_for_constraint(cstr_idx);
+
+    // each thread keeps a compensated sum of its share of the row
+    f_t sum = 0;
+    f_t c   = 0;
+    for (i_t j = offset_begin + threadIdx.x; j < offset_end; j += blockDim.x) {
+      f_t delta = fj.pb.coefficients[j] * fj.incumbent_assignment[fj.pb.variables[j]];
+      f_t t     = sum + delta;
+      c += fabs(sum) > fabs(delta) ? (sum - t) + delta : (delta - t) + sum;
+      sum = t;
+    }
+    f_t lhs = BlockReduce(temp_storage).Sum(sum + c);
 
-    f_t th_violation       = fj.excess_score(cstr_idx, fj.incumbent_lhs[cstr_idx]);
-    f_t weighted_violation = th_violation * fj.cstr_weights[cstr_idx];
-    atomicAdd(fj.violation_score, th_violation);
-    atomicAdd(fj.weighted_violation_score, weighted_violation);
-    f_t cstr_tolerance = fj.get_corrected_tolerance(cstr_idx);
-    if (th_violation < -cstr_tolerance) { fj.violated_constraints.insert(cstr_idx); }
+    if (threadIdx.x == 0) {
+      fj.incumbent_lhs[cstr_idx]         = lhs;
+      fj.incumbent_lhs_sumcomp[cstr_idx] = 0;
+      init_violation<i_t, f_t>(fj, cstr_idx);
+    }
+    // temp_storage is reused by the next constraint
+    __syncthreads();
   }
 }
 
@@ -1313,8 +1352,14 @@ __global__ void handle_local_minimum_kernel(typename fj_t<i_t, f_t>::climber_dat
         *fj.last_improving_minimum = *fj.local_minimums_reached;
         // if the current objective is better than the parents (or any provided baseline)
         // increase the number number of local minimax by x3
-        if (fj.settings->baseline_objective_for_longer_run >
-            *fj.incumbent_objective + fj.settings->parameters.breakthrough_move_epsilon) {
+        // The cutoff published by B&B or other heuristics is read without syncing with the host:
+        // a solution that it already beats is not worth the longer run
+        const f_t epsilon       = fj.settings->parameters.breakthrough_move_epsilon;
+        const bool beats_cutoff = fj.objective_cutoff == nullptr ||
+                                  fj.cutoff_scale * *fj.objective_cutoff + fj.cutoff_shift >
+                                    *fj.incumbent_objective + epsilon;
+        if (beats_cutoff &&
+            fj.settings->baseline_objective_for_longer_run > *fj.incumbent_objective + epsilon) {
           fj.settings->n_of_minimums_for_exit *= 3;
           fj.settings->baseline_objective_for_longer_run = *fj.incumbent_objective;
         }
@@ -1460,6 +1505,8 @@ __global__ void handle_local_minimum_kernel(typename fj_t<i_t, f_t>::climber_dat
     const __grid_constant__ typename fj_t<int, F_TYPE>::climber_data_t::view_t fj);   \
   template __global__ void init_lhs_and_violation<int, F_TYPE>(                       \
     typename fj_t<int, F_TYPE>::climber_data_t::view_t fj);                           \
+  template __global__ void init_lhs_and_violation_heavy<int, F_TYPE>(                 \
+    typename fj_t<int, F_TYPE>::climber_data_t::view_t fj);                           \
   template __global__ void update_lift_moves_kernel<int, F_TYPE>(                     \
     typename fj_t<int, F_TYPE>::climber_data_t::view_t fj);                           \
   template __global__ void update_breakthrough_moves_kernel<int, F_TYPE>(             \
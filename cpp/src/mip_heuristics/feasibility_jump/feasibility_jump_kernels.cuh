@@ -54,6 +54,10 @@ __global__ void load_balancing_mtm_compute_scores(
 template <typename i_t, typename f_t>
 __global__ void init_lhs_and_violation(typename fj_t<i_t, f_t>::climber_data_t::view_t fj);
 
+// Same as init_lhs_and_violation for the heavy constraints, with one block per constraint
+template <typename i_t, typename f_t>
+__global__ void init_lhs_and_violation_heavy(typename fj_t<i_t, f_t>::climber_data_t::view_t fj);
+
 // Update the jump move tables after the best jump value has been computed for a "heavy" variable
 template <typename i_t, typename f_t>
 __global__ void heavy_jump_table_update_kernel(typename fj_t<i_t, f_t>::climber_data_t::view_t fj,
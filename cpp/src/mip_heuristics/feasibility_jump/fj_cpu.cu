@@ -11,6 +11,7 @@
 #include "feasibility_jump_impl_common.cuh"
 #include "fj_cpu.cuh"
 
+#include <utilities/instrumentation.hpp>
 #include <utilities/seed_generator.cuh>
 
 #include <raft/core/nvtx.hpp>
@@ -21,17 +22,13 @@
 #include <random>
 #include <sstream>
 #include <thread>
-#include <unordered_set>
 #include <vector>
 
 #define CPUFJ_TIMING_TRACE 0
 
 // Define CPUFJ_NVTX_RANGES to enable detailed NVTX profiling ranges
 #ifdef CPUFJ_NVTX_RANGES
-#define CPUFJ_NVTX_RANGE(name)        raft::common::nvtx::range CPUFJ_NVTX_UNIQUE_NAME(nvtx_scope_)(name)
-#define CPUFJ_NVTX_UNIQUE_NAME(base)  CPUFJ_NVTX_CONCAT(base, __LINE__)
-#define CPUFJ_NVTX_CONCAT(a, b)       CPUFJ_NVTX_CONCAT_INNER(a, b)
-#define CPUFJ_NVTX_CONCAT_INNER(a, b) a##b
+#define CPUFJ_NVTX_RANGE(name) CUOPT_NVTX_RANGE(mip_heuristics, name)
 #else
 #define CPUFJ_NVTX_RANGE(name) ((void)0)
 #endif
@@ -1321,6 +1318,11 @@ static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   fj_cpu.var_bitmap.resize(fj_cpu.view.pb.n_variables, false);
   fj_cpu.iter_mtm_vars.reserve(fj_cpu.view.pb.n_variables);
 
+  fj_cpu.violated_constraints.resize(fj_cpu.view.pb.n_constraints);
+  fj_cpu.satisfied_constraints.resize(fj_cpu.view.pb.n_constraints);
+  fj_cpu.unique_cstrs_accessed_window.resize(fj_cpu.view.pb.n_constraints);
+  fj_cpu.unique_vars_accessed_window.resize(fj_cpu.view.pb.n_variables);
+
   recompute_lhs(fj_cpu);
 
   // Precompute static problem features for regression model
@@ -1551,6 +1553,7 @@ bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu, f_t in_time_l
     cuopt_func_call(sanity_checks(fj_cpu));
     fj_cpu.iterations++;
     fj_cpu.iterations_since_best++;
+    CUOPT_COUNTER_ADD("mip_heuristics.cpu_fj_moves", 1);
   }
   auto loop_end = std::chrono::high_resolution_clock::now();
   double total_time =
@@ -13,7 +13,6 @@
 #include <limits>
 #include <mutex>
 #include <thread>
-#include <unordered_set>
 #include <vector>
 
 #include <mip_heuristics/feasibility_jump/feasibility_jump.cuh>
@@ -23,6 +22,56 @@
 
 namespace cuopt::linear_programming::detail {
 
+// Set of indices in [0, n), stored as the dense array of its members plus the position of every
+// index in that array. Tests, insertions and removals are O(1) without hashing, and iterating or
+// sampling the set only walks its members
+template <typename i_t>
+struct host_contiguous_set_t {
+  void resize(i_t n)
+  {
+    contents.clear();
+    index_map.assign(n, -1);
+  }
+
+  void clear()
+  {
+    for (i_t idx : contents) {
+      index_map[idx] = -1;
+    }
+    contents.clear();
+  }
+
+  bool insert(i_t idx)
+  {
+    if (index_map[idx] != -1) { return false; }
+    index_map[idx] = contents.size();
+    contents.push_back(idx);
+    return true;
+  }
+
+  // the last member takes the place of the removed one
+  size_t erase(i_t idx)
+  {
+    i_t position = index_map[idx];
+    if (position == -1) { return 0; }
+    i_t last_idx        = contents.back();
+    contents[position]  = last_idx;
+    index_map[last_idx] = position;
+    contents.pop_back();
+    index_map[idx] = -1;
+    return 1;
+  }
+
+  size_t count(i_t idx) const { return index_map[idx] != -1; }
+  size_t size() const { return contents.size(); }
+  bool empty() const { return contents.empty(); }
+  typename std::vector<i_t>::const_iterator begin() const { return contents.begin(); }
+  typename std::vector<i_t>::const_iterator end() const { return contents.end(); }
+
+  std::vector<i_t> contents;
+  std::vector<i_t> index_map;
+};
+
 // NOTE: this seems an easy pick for reflection/xmacros once this is available (C++26?)
 // Maintaining a single source of truth for all members would be nice
 template <typename i_t, typename f_t>
@@ -32,7 +81,8 @@ struct fj_cpu_climber_t {
 #define ADD_INSTRUMENTED(var) \
   std::make_pair(#var, std::ref(static_cast<memory_instrumentation_base_t&>(var)))
 
-    // Initialize memory aggregator with all ins_vector members
+    // Initialize memory aggregator with all counted_vector members, the work units are derived
+    // from their loads and stores
     memory_aggregator = instrumentation_aggregator_t{ADD_INSTRUMENTED(h_reverse_coefficients),
                                                      ADD_INSTRUMENTED(h_reverse_constraints),
                                                      ADD_INSTRUMENTED(h_reverse_offsets),
@@ -72,40 +122,41 @@ struct fj_cpu_climber_t {
   fj_settings_t settings;
   typename fj_t<i_t, f_t>::climber_data_t::view_t view;
   // Host copies of device data as struct members
-  ins_vector<f_t> h_reverse_coefficients;
-  ins_vector<i_t> h_reverse_constraints;
-  ins_vector<i_t> h_reverse_offsets;
-  ins_vector<f_t> h_coefficients;
-  ins_vector<i_t> h_offsets;
-  ins_vector<i_t> h_variables;
-  ins_vector<f_t> h_obj_coeffs;
-  ins_vector<typename type_2<f_t>::type> h_var_bounds;
-  ins_vector<f_t> h_cstr_lb;
-  ins_vector<f_t> h_cstr_ub;
-  ins_vector<var_t> h_var_types;
-  ins_vector<i_t> h_is_binary_variable;
-  ins_vector<i_t> h_objective_vars;
-  ins_vector<i_t> h_binary_indices;
-
-  ins_vector<i_t> h_tabu_nodec_until;
-  ins_vector<i_t> h_tabu_noinc_until;
-  ins_vector<i_t> h_tabu_lastdec;
-  ins_vector<i_t> h_tabu_lastinc;
-
-  ins_vector<f_t> h_lhs;
-  ins_vector<f_t> h_lhs_sumcomp;
-  ins_vector<f_t> h_cstr_left_weights;
-  ins_vector<f_t> h_cstr_right_weights;
+  counted_vector<f_t> h_reverse_coefficients;
+  counted_vector<i_t> h_reverse_constraints;
+  counted_vector<i_t> h_reverse_offsets;
+  counted_vector<f_t> h_coefficients;
+  counted_vector<i_t> h_offsets;
+  counted_vector<i_t> h_variables;
+  counted_vector<f_t> h_obj_coeffs;
+  counted_vector<typename type_2<f_t>::type> h_var_bounds;
+  counted_vector<f_t> h_cstr_lb;
+  counted_vector<f_t> h_cstr_ub;
+  counted_vector<var_t> h_var_types;
+  counted_vector<i_t> h_is_binary_variable;
+  counted_vector<i_t> h_objective_vars;
+  counted_vector<i_t> h_binary_indices;
+
+  counted_vector<i_t> h_tabu_nodec_until;
+  counted_vector<i_t> h_tabu_noinc_until;
+  counted_vector<i_t> h_tabu_lastdec;
+  counted_vector<i_t> h_tabu_lastinc;
+
+  counted_vector<f_t> h_lhs;
+  counted_vector<f_t> h_lhs_sumcomp;
+  counted_vector<f_t> h_cstr_left_weights;
+  counted_vector<f_t> h_cstr_right_weights;
   f_t max_weight;
-  ins_vector<f_t> h_assignment;
-  ins_vector<f_t> h_best_assignment;
+  counted_vector<f_t> h_assignment;
+  counted_vector<f_t> h_best_assignment;
   f_t h_objective_weight;
   f_t h_incumbent_objective;
   f_t h_best_objective;
   i_t last_feasible_entrance_iter{0};
   i_t iterations;
-  std::unordered_set<i_t> violated_constraints;
-  std::unordered_set<i_t> satisfied_constraints;
+  // every constraint is in exactly one of these, updated incrementally in apply_move
+  host_contiguous_set_t<i_t> violated_constraints;
+  host_contiguous_set_t<i_t> satisfied_constraints;
   bool feasible_found{false};
   bool trigger_early_lhs_recomputation{false};
   f_t total_violations{0};
@@ -132,10 +183,10 @@ struct fj_cpu_climber_t {
 
   // CSC (transposed!) nnz-offset-indexed constraint bounds (lb, ub)
   // std::pair<f_t, f_t> better compile down to 16 bytes!! GCC do your job!
-  ins_vector<std::pair<f_t, f_t>> cached_cstr_bounds;
+  counted_vector<std::pair<f_t, f_t>> cached_cstr_bounds;
 
   std::vector<bool> var_bitmap;
-  ins_vector<i_t> iter_mtm_vars;
+  counted_vector<i_t> iter_mtm_vars;
 
   i_t mtm_viol_samples{25};
   i_t mtm_sat_samples{15};
@@ -173,8 +224,8 @@ struct fj_cpu_climber_t {
   // Cache and locality tracking
   i_t hit_count_window_start{0};
   i_t miss_count_window_start{0};
-  std::unordered_set<i_t> unique_cstrs_accessed_window;
-  std::unordered_set<i_t> unique_vars_accessed_window;
+  host_contiguous_set_t<i_t> unique_cstrs_accessed_window;
+  host_contiguous_set_t<i_t> unique_vars_accessed_window;
 
   // Precomputed static problem features
   i_t n_binary_vars{0};
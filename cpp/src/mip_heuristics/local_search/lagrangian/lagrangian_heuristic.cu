@@ -0,0 +1,351 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "lagrangian_heuristic.cuh"
+
+#include <mip_heuristics/mip_constants.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/common/nvtx.hpp>
+#include <rmm/device_scalar.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/inner_product.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cuopt::linear_programming::detail {
+
+// bounds of a kept row enforced by the subproblem. A row with both is a partitioning row
+constexpr int at_most_one_row  = 1;
+constexpr int at_least_one_row = 2;
+
+template <typename i_t, typename f_t>
+lagrangian_heuristic_t<i_t, f_t>::lagrangian_heuristic_t(const raft::handle_t* handle_ptr_)
+  : handle_ptr(handle_ptr_),
+    kept_row_flags(0, handle_ptr->get_stream()),
+    kept_rows(0, handle_ptr->get_stream()),
+    var_in_kept_row(0, handle_ptr->get_stream()),
+    multipliers(0, handle_ptr->get_stream()),
+    reduced_costs(0, handle_ptr->get_stream()),
+    assignment(0, handle_ptr->get_stream()),
+    subgradient(0, handle_ptr->get_stream()),
+    dual_terms(0, handle_ptr->get_stream()),
+    violations(0, handle_ptr->get_stream())
+{
+}
+
+template <typename i_t, typename f_t>
+bool lagrangian_heuristic_t<i_t, f_t>::detect_structure(problem_t<i_t, f_t>& problem)
+{
+  raft::common::nvtx::range fun_scope("lagrangian_detect_structure");
+  auto stream         = handle_ptr->get_stream();
+  auto h_offsets      = cuopt::host_copy(problem.offsets, stream);
+  auto h_variables    = cuopt::host_copy(problem.variables, stream);
+  auto h_coefficients = cuopt::host_copy(problem.coefficients, stream);
+  auto h_cstr_lb      = cuopt::host_copy(problem.constraint_lower_bounds, stream);
+  auto h_cstr_ub      = cuopt::host_copy(problem.constraint_upper_bounds, stream);
+  auto h_var_bounds   = cuopt::host_copy(problem.variable_bounds, stream);
+  auto h_var_types    = cuopt::host_copy(problem.variable_types, stream);
+  const f_t int_tol   = problem.tolerances.integrality_tolerance;
+
+  std::vector<i_t> h_kept_row_flags(problem.n_constraints, 0);
+  std::vector<i_t> h_kept_rows;
+  std::vector<i_t> h_var_in_kept_row(problem.n_variables, 0);
+  i_t n_structured_vars = 0;
+  // greedily keep the rows whose variables are not in an already kept row, so that the
+  // subproblem separates into one choice per row
+  for (i_t cstr_idx = 0; cstr_idx < problem.n_constraints; ++cstr_idx) {
+    const i_t row_begin = h_offsets[cstr_idx];
+    const i_t row_end   = h_offsets[cstr_idx + 1];
+    const i_t row_size  = row_end - row_begin;
+    if (row_size < 2) { continue; }
+    const bool unit_binary_row = std::all_of(
+      h_variables.begin() + row_begin, h_variables.begin() + row_end, [&](i_t var_idx) {
+        return h_var_types[var_idx] == var_t::INTEGER && get_lower(h_var_bounds[var_idx]) == 0 &&
+               get_upper(h_var_bounds[var_idx]) == 1 && h_var_in_kept_row[var_idx] == 0;
+      });
+    if (!unit_binary_row ||
+        !std::all_of(h_coefficients.begin() + row_begin,
+                     h_coefficients.begin() + row_end,
+                     [](f_t coeff) { return coeff == 1; })) {
+      continue;
+    }
+    const f_t lb            = h_cstr_lb[cstr_idx];
+    const f_t ub            = h_cstr_ub[cstr_idx];
+    const bool at_most_one  = ub >= 1 - int_tol && ub < 2 - int_tol;
+    const bool ub_implied   = ub >= row_size - int_tol;
+    const bool at_least_one = lb > int_tol && lb <= 1 + int_tol;
+    const bool lb_implied   = lb <= int_tol;
+    if (!(at_most_one || ub_implied) || !(at_least_one || lb_implied) ||
+        !(at_most_one || at_least_one)) {
+      continue;
+    }
+    h_kept_row_flags[cstr_idx] =
+      (at_most_one ? at_most_one_row : 0) | (at_least_one ? at_least_one_row : 0);
+    h_kept_rows.push_back(cstr_idx);
+    for (i_t i = row_begin; i < row_end; ++i) {
+      h_var_in_kept_row[h_variables[i]] = 1;
+    }
+    n_structured_vars += row_size;
+  }
+  CUOPT_LOG_DEBUG("Lagrangian relaxation keeps %d rows covering %d of %d variables",
+                  h_kept_rows.size(),
+                  n_structured_vars,
+                  problem.n_variables);
+  if (h_kept_rows.empty() ||
+      n_structured_vars < settings.min_structured_var_ratio * problem.n_variables) {
+    return false;
+  }
+
+  kept_row_flags  = cuopt::device_copy(h_kept_row_flags, stream);
+  kept_rows       = cuopt::device_copy(h_kept_rows, stream);
+  var_in_kept_row = cuopt::device_copy(h_var_in_kept_row, stream);
+  multipliers.resize(problem.n_constraints, stream);
+  reduced_costs.resize(problem.n_variables, stream);
+  assignment.resize(problem.n_variables, stream);
+  subgradient.resize(problem.n_constraints, stream);
+  dual_terms.resize(problem.n_constraints, stream);
+  violations.resize(problem.n_constraints, stream);
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void lagrangian_heuristic_t<i_t, f_t>::solve(problem_t<i_t, f_t>& problem,
+                                             const rmm::device_uvector<f_t>& initial_multipliers,
+                                             f_t upper_bound,
+                                             timer_t& timer)
+{
+  raft::common::nvtx::range fun_scope("lagrangian_solve");
+  cuopt_assert(kept_row_flags.size() == static_cast<size_t>(problem.n_constraints),
+               "detect_structure should be called on the problem first");
+  auto stream = handle_ptr->get_stream();
+  auto policy = handle_ptr->get_thrust_policy();
+  auto pb     = problem.view();
+  best_bound  = -std::numeric_limits<f_t>::infinity();
+  candidates.clear();
+
+  if (initial_multipliers.size() == multipliers.size()) {
+    raft::copy(multipliers.data(), initial_multipliers.data(), multipliers.size(), stream);
+  } else {
+    thrust::fill(policy, multipliers.begin(), multipliers.end(), f_t(0));
+  }
+  // the kept rows are enforced by the subproblem, and a side of a relaxed row without a bound
+  // cannot be penalized
+  thrust::for_each(policy,
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(problem.n_constraints),
+                   [pb,
+                    kept_row_flags = make_span(kept_row_flags),
+                    multipliers    = make_span(multipliers)] __device__(i_t cstr_idx) {
+                     f_t multiplier = multipliers[cstr_idx];
+                     if (!isfinite(multiplier) || kept_row_flags[cstr_idx] != 0) { multiplier = 0; }
+                     if (!isfinite(pb.constraint_lower_bounds[cstr_idx])) {
+                       multiplier = min(multiplier, f_t(0));
+                     }
+                     if (!isfinite(pb.constraint_upper_bounds[cstr_idx])) {
+                       multiplier = max(multiplier, f_t(0));
+                     }
+                     multipliers[cstr_idx] = multiplier;
+                   });
+
+  rmm::device_uvector<f_t> best_bound_assignment(problem.n_variables, stream);
+  rmm::device_uvector<f_t> least_violation_assignment(problem.n_variables, stream);
+  rmm::device_scalar<i_t> n_unbounded(0, stream);
+  f_t least_violation                  = std::numeric_limits<f_t>::infinity();
+  f_t step_scale                       = settings.initial_step_scale;
+  i_t n_iterations_without_improvement = 0;
+  i_t iteration                        = 0;
+  for (; iteration < settings.iteration_limit && !timer.check_time_limit(); ++iteration) {
+    thrust::for_each(policy,
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(problem.n_variables),
+                     [pb,
+                      multipliers   = make_span(multipliers),
+                      reduced_costs = make_span(reduced_costs)] __device__(i_t var_idx) {
+                       auto [offset_begin, offset_end] = pb.reverse_range_for_var(var_idx);
+                       f_t reduced_cost                = pb.objective_coefficients[var_idx];
+                       for (i_t i = offset_begin; i < offset_end; ++i) {
+                         reduced_cost -=
+                           multipliers[pb.reverse_constraints[i]] * pb.reverse_coefficients[i];
+                       }
+                       reduced_costs[var_idx] = reduced_cost;
+                     });
+
+    // the variables outside of the kept rows go to the bound their reduced cost points to
+    n_unbounded.set_value_to_zero_async(stream);
+    thrust::for_each(policy,
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(problem.n_variables),
+                     [pb,
+                      var_in_kept_row = make_span(var_in_kept_row),
+                      reduced_costs   = make_span(reduced_costs),
+                      assignment      = make_span(assignment),
+                      n_unbounded     = n_unbounded.data()] __device__(i_t var_idx) {
+                       if (var_in_kept_row[var_idx]) { return; }
+                       auto bounds        = pb.variable_bounds[var_idx];
+                       const f_t lb       = get_lower(bounds);
+                       const f_t ub       = get_upper(bounds);
+                       const f_t red_cost = reduced_costs[var_idx];
+                       f_t val = red_cost > 0 ? lb : (red_cost < 0 ? ub : (isfinite(lb) ? lb : ub));
+                       if (!isfinite(val)) {
+                         // the bound is -inf, the value is only used by the primal candidate
+                         if (red_cost != 0) { atomicAdd(n_unbounded, 1); }
+                         val = isfinite(lb) ? lb : (isfinite(ub) ? ub : f_t(0));
+                       }
+                       assignment[var_idx] = val;
+                     });
+
+    thrust::for_each(policy,
+                     kept_rows.begin(),
+                     kept_rows.end(),
+                     [pb,
+                      kept_row_flags = make_span(kept_row_flags),
+                      reduced_costs  = make_span(reduced_costs),
+                      assignment     = make_span(assignment)] __device__(i_t cstr_idx) {
+                       auto [offset_begin, offset_end] = pb.range_for_constraint(cstr_idx);
+                       const i_t row_flags             = kept_row_flags[cstr_idx];
+                       i_t best_var                    = pb.variables[offset_begin];
+                       for (i_t i = offset_begin; i < offset_end; ++i) {
+                         const i_t var_idx  = pb.variables[i];
+                         const f_t red_cost = reduced_costs[var_idx];
+                         if (red_cost < reduced_costs[best_var]) { best_var = var_idx; }
+                         // without an upper bound every variable lowering the objective is set
+                         const bool take = !(row_flags & at_most_one_row) && red_cost < 0;
+                         assignment[var_idx] = take ? 1 : 0;
+                       }
+                       if (reduced_costs[best_var] < 0 || (row_flags & at_least_one_row)) {
+                         assignment[best_var] = 1;
+                       }
+                     });
+
+    thrust::for_each(policy,
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(problem.n_constraints),
+                     [pb,
+                      kept_row_flags = make_span(kept_row_flags),
+                      multipliers    = make_span(multipliers),
+                      assignment     = make_span(assignment),
+                      subgradient    = make_span(subgradient),
+                      dual_terms     = make_span(dual_terms),
+                      violations     = make_span(violations)] __device__(i_t cstr_idx) {
+                       if (kept_row_flags[cstr_idx] != 0) {
+                         subgradient[cstr_idx] = 0;
+                         dual_terms[cstr_idx]  = 0;
+                         violations[cstr_idx]  = 0;
+                         return;
+                       }
+                       auto [offset_begin, offset_end] = pb.range_for_constraint(cstr_idx);
+                       f_t activity                    = 0;
+                       for (i_t i = offset_begin; i < offset_end; ++i) {
+                         activity += pb.coefficients[i] * assignment[pb.variables[i]];
+                       }
+                       const f_t lb         = pb.constraint_lower_bounds[cstr_idx];
+                       const f_t ub         = pb.constraint_upper_bounds[cstr_idx];
+                       const f_t multiplier = multipliers[cstr_idx];
+                       f_t grad             = 0;
+                       if (multiplier > 0 || (multiplier == 0 && activity < lb)) {
+                         grad = lb - activity;
+                       } else if (multiplier < 0 || activity > ub) {
+                         grad = ub - activity;
+                       }
+                       subgradient[cstr_idx] = grad;
+                       dual_terms[cstr_idx] =
+                         multiplier > 0 ? multiplier * lb : (multiplier < 0 ? multiplier * ub : 0);
+                       violations[cstr_idx] =
+                         max(lb - activity, f_t(0)) + max(activity - ub, f_t(0));
+                     });
+
+    // value of the Lagrangian function at the current multipliers
+    const f_t bound = thrust::inner_product(policy,
+                                            reduced_costs.begin(),
+                                            reduced_costs.end(),
+                                            assignment.begin(),
+                                            f_t(0)) +
+                      thrust::reduce(policy, dual_terms.begin(), dual_terms.end(), f_t(0));
+
+    const bool bound_is_valid          = n_unbounded.value(stream) == 0;
+    const f_t squared_subgradient_norm = thrust::transform_reduce(
+      policy,
+      subgradient.begin(),
+      subgradient.end(),
+      [] __device__(f_t grad) { return grad * grad; },
+      f_t(0),
+      thrust::plus<f_t>{});
+
+    const f_t violation = thrust::reduce(policy, violations.begin(), violations.end(), f_t(0));
+    if (violation < least_violation) {
+      least_violation = violation;
+      raft::copy(least_violation_assignment.data(), assignment.data(), assignment.size(), stream);
+      if (violation <= problem.tolerances.absolute_tolerance) {
+        upper_bound = std::min(upper_bound,
+                               thrust::inner_product(policy,
+                                                     problem.objective_coefficients.begin(),
+                                                     problem.objective_coefficients.end(),
+                                                     assignment.begin(),
+                                                     f_t(0)));
+      }
+    }
+    if (bound_is_valid && bound > best_bound) {
+      best_bound = bound;
+      raft::copy(best_bound_assignment.data(), assignment.data(), assignment.size(), stream);
+      n_iterations_without_improvement = 0;
+    } else if (++n_iterations_without_improvement >= settings.n_iterations_to_halve_step) {
+      step_scale /= 2;
+      n_iterations_without_improvement = 0;
+      if (step_scale < settings.min_step_scale) { break; }
+    }
+    // a zero subgradient means the subproblem solution is optimal, and a bound reaching the
+    // known objective proves it optimal
+    if (squared_subgradient_norm == 0 || best_bound >= upper_bound) { break; }
+
+    // Polyak step towards the best known objective, or an estimate of it
+    f_t gap = upper_bound - bound;
+    if (!std::isfinite(gap) || gap <= 0) { gap = std::max(f_t(0.05) * std::abs(bound), f_t(1)); }
+    const f_t step = step_scale * gap / squared_subgradient_norm;
+    thrust::for_each(policy,
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(problem.n_constraints),
+                     [pb,
+                      step,
+                      multipliers = make_span(multipliers),
+                      subgradient = make_span(subgradient)] __device__(i_t cstr_idx) {
+                       f_t multiplier = multipliers[cstr_idx] + step * subgradient[cstr_idx];
+                       if (!isfinite(pb.constraint_lower_bounds[cstr_idx])) {
+                         multiplier = min(multiplier, f_t(0));
+                       }
+                       if (!isfinite(pb.constraint_upper_bounds[cstr_idx])) {
+                         multiplier = max(multiplier, f_t(0));
+                       }
+                       multipliers[cstr_idx] = multiplier;
+                     });
+  }
+  CUOPT_LOG_DEBUG("Lagrangian heuristic ran %d iterations, bound %g least violation %g",
+                  iteration,
+                  best_bound,
+                  least_violation);
+
+  if (std::isfinite(best_bound)) { candidates.emplace_back(std::move(best_bound_assignment)); }
+  if (std::isfinite(least_violation)) {
+    candidates.emplace_back(std::move(least_violation_assignment));
+  }
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class lagrangian_heuristic_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class lagrangian_heuristic_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,74 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <mip_heuristics/problem/problem.cuh>
+#include <utilities/timer.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+struct lagrangian_settings_t {
+  int iteration_limit = 5000;
+  // the step scale is halved after this many iterations without a better bound
+  int n_iterations_to_halve_step = 20;
+  double initial_step_scale      = 2.;
+  double min_step_scale          = 1e-4;
+  // the heuristic only runs when the kept rows cover at least this ratio of the variables
+  double min_structured_var_ratio = 0.5;
+};
+
+// Subgradient optimization of a Lagrangian relaxation. The set partitioning, packing and covering
+// rows over disjoint sets of binaries are kept, every other row is relaxed into the objective.
+// The subproblem then decomposes into one choice per kept row and a bound per remaining
+// variable, both solved on the device at every iteration. The solutions of the subproblem are
+// integral, so they are kept as primal candidates to be repaired by local search
+template <typename i_t, typename f_t>
+class lagrangian_heuristic_t {
+ public:
+  lagrangian_heuristic_t(const raft::handle_t* handle_ptr);
+
+  // Selects the kept rows. Returns false if they cover too few variables for the relaxation to be
+  // worth it
+  bool detect_structure(problem_t<i_t, f_t>& problem);
+
+  // Runs the subgradient iterations on the problem given to detect_structure. The multipliers
+  // start from initial_multipliers if it is not empty, e.g. from the duals of the LP relaxation.
+  // upper_bound is the objective of the best known feasible solution, if any
+  void solve(problem_t<i_t, f_t>& problem,
+             const rmm::device_uvector<f_t>& initial_multipliers,
+             f_t upper_bound,
+             timer_t& timer);
+
+  // Best Lagrangian bound found by solve in the solver space, -inf if none is valid
+  f_t best_bound{-std::numeric_limits<f_t>::infinity()};
+  // Subproblem solutions at the best bound and with the least violation of the relaxed rows
+  std::vector<rmm::device_uvector<f_t>> candidates;
+
+  lagrangian_settings_t settings;
+
+ private:
+  const raft::handle_t* handle_ptr;
+  // per constraint, whether the row is kept and which of its bounds it enforces
+  rmm::device_uvector<i_t> kept_row_flags;
+  rmm::device_uvector<i_t> kept_rows;
+  // per variable, whether it belongs to a kept row
+  rmm::device_uvector<i_t> var_in_kept_row;
+  rmm::device_uvector<f_t> multipliers;
+  rmm::device_uvector<f_t> reduced_costs;
+  rmm::device_uvector<f_t> assignment;
+  rmm::device_uvector<f_t> subgradient;
+  rmm::device_uvector<f_t> dual_terms;
+  rmm::device_uvector<f_t> violations;
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -8,10 +8,16 @@
 #include <mip_heuristics/mip_constants.hpp>
 #include "line_segment_search.cuh"
 
+#include <utilities/copy_helpers.hpp>
+
+#include <cub/cub.cuh>
 #include <thrust/device_ptr.h>
 #include <thrust/functional.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
+
+#include <algorithm>
+#include <numeric>
 #include <queue>
 namespace cuopt::linear_programming::detail {
 
@@ -68,6 +74,139 @@ class middle_first_iterator_t {
   std::queue<std::pair<int, int>> queue;
 };
 
+// The point at ratio t of the segment from val_1 to val_2, rounded to the nearest integer for
+// integer variables and clamped within the bounds
+template <typename i_t, typename f_t>
+__device__ f_t get_segment_point_value(const typename problem_t<i_t, f_t>::view_t& pb,
+                                       i_t v,
+                                       f_t val_1,
+                                       f_t val_2,
+                                       f_t t)
+{
+  f_t val = val_1 + (val_2 - val_1) * t;
+  if (pb.is_integer_var(v)) { val = round(val); }
+  auto bounds = pb.variable_bounds[v];
+  return max(get_lower(bounds), min(get_upper(bounds), val));
+}
+
+// One block per segment and point: computes the weighted quality of the point, the same measure
+// as solution_t::get_quality, without materializing it
+template <typename i_t, typename f_t, int TPB>
+__global__ void evaluate_segment_points_kernel(typename problem_t<i_t, f_t>::view_t pb,
+                                               raft::device_span<const f_t*> elites,
+                                               raft::device_span<const i_t> segment_first,
+                                               raft::device_span<const i_t> segment_second,
+                                               raft::device_span<const f_t> cstr_weights,
+                                               const f_t* objective_weight,
+                                               raft::device_span<f_t> qualities)
+{
+  typedef cub::BlockReduce<f_t, TPB> BlockReduce;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  const f_t* point_1 = elites[segment_first[blockIdx.x]];
+  const f_t* point_2 = elites[segment_second[blockIdx.x]];
+  const f_t t        = f_t(blockIdx.y + 1) / (gridDim.y + 1);
+  f_t th_quality     = 0.;
+  for (i_t c = threadIdx.x; c < pb.n_constraints; c += TPB) {
+    auto [offset_begin, offset_end] = pb.range_for_constraint(c);
+    f_t cstr_val                    = 0.;
+    for (i_t i = offset_begin; i < offset_end; i++) {
+      i_t v = pb.variables[i];
+      cstr_val += pb.coefficients[i] *
+                  get_segment_point_value<i_t, f_t>(pb, v, point_1[v], point_2[v], t);
+    }
+    f_t excess = max(0., pb.constraint_lower_bounds[c] - cstr_val) +
+                 max(0., cstr_val - pb.constraint_upper_bounds[c]);
+    th_quality += excess * cstr_weights[c];
+  }
+  for (i_t v = threadIdx.x; v < pb.n_variables; v += TPB) {
+    th_quality += *objective_weight * pb.objective_coefficients[v] *
+                  get_segment_point_value<i_t, f_t>(pb, v, point_1[v], point_2[v], t);
+  }
+  f_t quality = BlockReduce(temp_storage).Sum(th_quality);
+  if (threadIdx.x == 0) { qualities[blockIdx.x * gridDim.y + blockIdx.y] = quality; }
+}
+
+template <typename i_t, typename f_t>
+bool line_segment_search_t<i_t, f_t>::search_elite_segments(
+  solution_t<i_t, f_t>& solution,
+  const std::vector<const f_t*>& elite_assignments,
+  cuopt::timer_t& timer)
+{
+  raft::common::nvtx::range fun_scope("search_elite_segments");
+  const i_t n_elites = elite_assignments.size();
+  if (n_elites < 2 || settings.n_points_to_search <= 0) { return solution.get_feasible(); }
+  auto stream = solution.handle_ptr->get_stream();
+  std::vector<i_t> h_segment_first;
+  std::vector<i_t> h_segment_second;
+  for (i_t a = 0; a < n_elites; a++) {
+    for (i_t b = a + 1; b < n_elites; b++) {
+      h_segment_first.push_back(a);
+      h_segment_second.push_back(b);
+    }
+  }
+  const i_t n_segments  = h_segment_first.size();
+  const i_t n_points    = settings.n_points_to_search;
+  auto d_elites         = device_copy(elite_assignments, stream);
+  auto d_segment_first  = device_copy(h_segment_first, stream);
+  auto d_segment_second = device_copy(h_segment_second, stream);
+  rmm::device_uvector<f_t> d_qualities(n_segments * n_points, stream);
+  constexpr int TPB = 128;
+  evaluate_segment_points_kernel<i_t, f_t, TPB>
+    <<<dim3(n_segments, n_points), TPB, 0, stream>>>(solution.problem_ptr->view(),
+                                                     cuopt::make_span(d_elites),
+                                                     cuopt::make_span(d_segment_first),
+                                                     cuopt::make_span(d_segment_second),
+                                                     cuopt::make_span(fj.cstr_weights),
+                                                     fj.objective_weight.data(),
+                                                     cuopt::make_span(d_qualities));
+  RAFT_CHECK_CUDA(stream);
+  auto h_qualities = host_copy(d_qualities, stream);
+
+  std::vector<i_t> order(h_qualities.size());
+  std::iota(order.begin(), order.end(), 0);
+  const i_t n_candidates = std::min<i_t>(settings.n_segment_candidates, order.size());
+  std::partial_sort(
+    order.begin(), order.begin() + n_candidates, order.end(), [&h_qualities](i_t a, i_t b) {
+      return h_qualities[a] < h_qualities[b];
+    });
+  CUOPT_LOG_DEBUG("Elite segment search over %d segments, best point quality %g",
+                  n_segments,
+                  h_qualities[order[0]]);
+
+  rmm::device_uvector<f_t> best_assignment(solution.assignment, stream);
+  f_t best_cost = solution.get_quality(fj.cstr_weights, fj.objective_weight);
+  for (i_t k = 0; k < n_candidates; k++) {
+    if (timer.check_time_limit()) { break; }
+    const i_t segment = order[k] / n_points;
+    const f_t t       = f_t(order[k] % n_points + 1) / (n_points + 1);
+    thrust::tabulate(solution.handle_ptr->get_thrust_policy(),
+                     solution.assignment.begin(),
+                     solution.assignment.end(),
+                     [pb      = solution.problem_ptr->view(),
+                      point_1 = elite_assignments[h_segment_first[segment]],
+                      point_2 = elite_assignments[h_segment_second[segment]],
+                      t] __device__(const i_t v) {
+                       return get_segment_point_value<i_t, f_t>(pb, v, point_1[v], point_2[v], t);
+                     });
+    solution.round_nearest();
+    fj.settings.mode                   = fj_mode_t::EXIT_NON_IMPROVING;
+    fj.settings.n_of_minimums_for_exit = settings.n_local_min;
+    fj.settings.iteration_limit        = settings.iteration_limit;
+    fj.settings.update_weights         = false;
+    fj.settings.feasibility_run        = false;
+    fj.settings.time_limit             = std::min(1., timer.remaining_time());
+    fj.solve(solution);
+    f_t curr_cost = solution.get_quality(fj.cstr_weights, fj.objective_weight);
+    if (curr_cost < best_cost) {
+      best_cost = curr_cost;
+      raft::copy(
+        best_assignment.data(), solution.assignment.data(), best_assignment.size(), stream);
+    }
+  }
+  raft::copy(solution.assignment.data(), best_assignment.data(), best_assignment.size(), stream);
+  return solution.compute_feasibility();
+}
+
 template <typename i_t, typename f_t>
 void line_segment_search_t<i_t, f_t>::save_solution_if_better(
   solution_t<i_t, f_t>& solution,
@@ -20,6 +20,8 @@ struct line_segment_settings_t {
   int n_local_min             = 50;
   int iteration_limit         = 20 * n_local_min;
   int n_points_to_search      = 5;
+  // number of the best points of the elite segments that are handed to FJ
+  int n_segment_candidates = 3;
 };
 
 template <typename i_t, typename f_t>
@@ -40,6 +42,13 @@ class line_segment_search_t {
                            bool is_feasibility_run,
                            cuopt::timer_t& timer);
 
+  // Evaluates n_points_to_search points on the segments between all pairs of elite_assignments in
+  // a single launch, then runs FJ from the best of them. solution holds the best solution found,
+  // it is kept if no point improves its quality
+  bool search_elite_segments(solution_t<i_t, f_t>& solution,
+                             const std::vector<const f_t*>& elite_assignments,
+                             cuopt::timer_t& timer);
+
   void save_solution_if_better(solution_t<i_t, f_t>& solution,
                                const rmm::device_uvector<f_t>& point_1,
                                const rmm::device_uvector<f_t>& point_2,
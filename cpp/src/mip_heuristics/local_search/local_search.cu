@@ -26,6 +26,11 @@
 
 namespace cuopt::linear_programming::detail {
 
+// number of GPU climbers racing for a first solution on problems too small to fill the GPU
+static constexpr int fast_solution_fj_climbers = 4;
+// number of variable orders tried by constraint prop rounding on such problems
+static constexpr int small_problem_rounding_orders = 4;
+
 template <typename i_t, typename f_t>
 local_search_t<i_t, f_t>::local_search_t(mip_solver_context_t<i_t, f_t>& context_,
                                          rmm::device_uvector<f_t>& lp_optimal_solution_)
@@ -71,8 +76,11 @@ void local_search_t<i_t, f_t>::start_cpufj_scratch_threads(population_t<i_t, f_t
                solution.assignment.end(),
                0.0);
   solution.clamp_within_bounds();
+  const i_t n_scratch = context.cpu_threads.acquire(scratch_cpu_fj.size());
+  scratch_cpu_threads += n_scratch;
   i_t counter = 0;
   for (auto& cpu_fj : scratch_cpu_fj) {
+    if (counter == n_scratch) { break; }
     if (counter > 0) solution.assign_random_within_bounds(0.4);
     cpu_fj.fj_cpu = cpu_fj.fj_ptr->create_cpu_climber(solution,
                                                       default_weights,
@@ -100,8 +108,8 @@ void local_search_t<i_t, f_t>::start_cpufj_scratch_threads(population_t<i_t, f_t
     counter++;
   };
 
-  for (auto& cpu_fj : scratch_cpu_fj) {
-    cpu_fj.start_cpu_solver();
+  for (i_t i = 0; i < n_scratch; ++i) {
+    scratch_cpu_fj[i].start_cpu_solver();
   }
 }
 
@@ -109,6 +117,8 @@ template <typename i_t, typename f_t>
 void local_search_t<i_t, f_t>::start_cpufj_lptopt_scratch_threads(
   population_t<i_t, f_t>& population)
 {
+  if (context.cpu_threads.acquire(1) == 0) { return; }
+  scratch_cpu_threads++;
   pop_ptr = &population;
 
   std::vector<f_t> default_weights(context.problem_ptr->n_constraints, 1.);
@@ -145,6 +155,8 @@ void local_search_t<i_t, f_t>::stop_cpufj_scratch_threads()
     cpu_fj.request_termination();
   }
   scratch_cpu_fj_on_lp_opt.request_termination();
+  context.cpu_threads.release(scratch_cpu_threads);
+  scratch_cpu_threads = 0;
 }
 
 template <typename i_t, typename f_t>
@@ -170,6 +182,7 @@ void local_search_t<i_t, f_t>::start_cpufj_deterministic(
                                                       /*randomize=*/true);
 
   deterministic_cpu_fj.fj_cpu->log_prefix = "******* deterministic CPUFJ: ";
+  deterministic_cpu_fj.fj_cpu->work_unit_bias *= context.work_unit_calibration.cpu_fj_scale;
 
   // Register with producer_sync for B&B synchronization
   producer_sync_t& producer_sync             = bb.get_producer_sync();
@@ -212,7 +225,10 @@ bool local_search_t<i_t, f_t>::do_fj_solve(solution_t<i_t, f_t>& solution,
 
   auto h_weights          = cuopt::host_copy(in_fj.cstr_weights, solution.handle_ptr->get_stream());
   auto h_objective_weight = in_fj.objective_weight.value(solution.handle_ptr->get_stream());
-  for (auto& cpu_fj : ls_cpu_fj) {
+  // the climbers only run on the CPU threads left by branch-and-bound and the other heuristics
+  const i_t n_cpu_fj = context.cpu_threads.acquire(ls_cpu_fj.size());
+  for (i_t i = 0; i < n_cpu_fj; ++i) {
+    auto& cpu_fj  = ls_cpu_fj[i];
     cpu_fj.fj_cpu = cpu_fj.fj_ptr->create_cpu_climber(solution,
                                                       h_weights,
                                                       h_weights,
@@ -225,8 +241,8 @@ bool local_search_t<i_t, f_t>::do_fj_solve(solution_t<i_t, f_t>& solution,
   auto solution_copy = solution;
 
   // Start CPU solver in background thread
-  for (auto& cpu_fj : ls_cpu_fj) {
-    cpu_fj.start_cpu_solver();
+  for (i_t i = 0; i < n_cpu_fj; ++i) {
+    ls_cpu_fj[i].start_cpu_solver();
   }
 
   // Run GPU solver and measure execution time
@@ -235,8 +251,8 @@ bool local_search_t<i_t, f_t>::do_fj_solve(solution_t<i_t, f_t>& solution,
   in_fj.solve(solution);
 
   // Stop CPU solver
-  for (auto& cpu_fj : ls_cpu_fj) {
-    cpu_fj.stop_cpu_solver();
+  for (i_t i = 0; i < n_cpu_fj; ++i) {
+    ls_cpu_fj[i].stop_cpu_solver();
   }
 
   auto gpu_fj_end        = std::chrono::high_resolution_clock::now();
@@ -246,7 +262,8 @@ bool local_search_t<i_t, f_t>::do_fj_solve(solution_t<i_t, f_t>& solution,
 
   f_t best_cpu_obj = std::numeric_limits<f_t>::max();
   // // Wait for CPU solver to finish
-  for (auto& cpu_fj : ls_cpu_fj) {
+  for (i_t i = 0; i < n_cpu_fj; ++i) {
+    auto& cpu_fj       = ls_cpu_fj[i];
     bool cpu_sol_found = cpu_fj.wait_for_cpu_solver();
     if (cpu_sol_found) {
       f_t cpu_obj = cpu_fj.fj_cpu->h_best_objective;
@@ -257,6 +274,7 @@ bool local_search_t<i_t, f_t>::do_fj_solve(solution_t<i_t, f_t>& solution,
       }
     }
   }
+  context.cpu_threads.release(n_cpu_fj);
   bool cpu_sol_found = best_cpu_obj < std::numeric_limits<f_t>::max();
 
   bool gpu_feasible = solution.get_feasible();
@@ -303,15 +321,23 @@ void local_search_t<i_t, f_t>::generate_fast_solution(solution_t<i_t, f_t>& solu
   fj.settings.update_weights         = true;
   fj.settings.feasibility_run        = true;
   fj.settings.time_limit             = std::min(30., timer.remaining_time());
+  // A small problem leaves most of the GPU idle with a single rounding or a single climber, so
+  // several of them are tried for the first feasible solution
+  const bool small_problem = solution.problem_ptr->n_variables <
+                             fj.settings.parameters.load_balancing_codepath_min_varcount;
   while (!context.diversity_manager_ptr->check_b_b_preemption() && !timer.check_time_limit()) {
     timer_t constr_prop_timer = timer_t(std::min(timer.remaining_time(), 2.));
     // do constraint prop on lp optimal solution
+    constraint_prop.n_rounding_orders = small_problem ? small_problem_rounding_orders : 1;
     constraint_prop.apply_round(solution, 1., constr_prop_timer);
+    constraint_prop.n_rounding_orders = 1;
     if (solution.compute_feasibility()) { return; }
     if (timer.check_time_limit()) { return; };
     f_t time_limit = std::min(3., timer.remaining_time());
     // run fj on the solution
+    fj.settings.n_climbers = small_problem ? fast_solution_fj_climbers : 1;
     do_fj_solve(solution, fj, time_limit, "fast");
+    fj.settings.n_climbers = 1;
     // TODO check if FJ returns the same solution
     // check if the solution is feasible
     if (solution.compute_feasibility()) { return; }
@@ -454,8 +480,12 @@ bool local_search_t<i_t, f_t>::check_fj_on_lp_optimal(solution_t<i_t, f_t>& solu
   cuopt_func_call(solution.test_variable_bounds(false));
   f_t lp_run_time_after_feasible = std::min(1., timer.remaining_time());
   timer_t bounds_prop_timer      = timer_t(std::min(timer.remaining_time(), 10.));
+  const bool small_problem       = solution.problem_ptr->n_variables <
+                             fj.settings.parameters.load_balancing_codepath_min_varcount;
+  constraint_prop.n_rounding_orders = small_problem ? small_problem_rounding_orders : 1;
   bool is_feasible =
     constraint_prop.apply_round(solution, lp_run_time_after_feasible, bounds_prop_timer);
+  constraint_prop.n_rounding_orders = 1;
   if (!is_feasible) {
     const f_t lp_run_time = 2.;
     relaxed_lp_settings_t lp_settings;
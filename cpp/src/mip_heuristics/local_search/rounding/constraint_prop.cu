@@ -1063,6 +1063,54 @@ bool constraint_prop_t<i_t, f_t>::apply_round(
   raft::common::nvtx::range fun_scope("constraint prop round");
   max_timer = timer_t{max_time_for_bounds_prop};
   if (check_brute_force_rounding(sol)) { return true; }
+  // The counters of balanced probing are for one rounding
+  const i_t n_orders = probing_config.has_value() ? 1 : n_rounding_orders;
+  if (n_orders == 1) {
+    return round_once(sol, lp_run_time_after_feasible, timer, probing_config);
+  }
+
+  // Every attempt starts from the input assignment, the variable order and the rounding
+  // directions come from a new seed each time. The feasible outcome of smallest objective is
+  // kept, or the one of smallest excess when none is feasible
+  auto stream = sol.handle_ptr->get_stream();
+  rmm::device_uvector<f_t> input_assignment(sol.assignment, stream);
+  rmm::device_uvector<f_t> best_assignment(sol.assignment.size(), stream);
+  bool best_feasible = false;
+  f_t best_objective = std::numeric_limits<f_t>::infinity();
+  f_t best_excess    = std::numeric_limits<f_t>::infinity();
+  for (i_t attempt = 0; attempt < n_orders; ++attempt) {
+    if (attempt > 0) {
+      if (max_timer.check_time_limit() || timer.check_time_limit()) { break; }
+      raft::copy(sol.assignment.data(), input_assignment.data(), input_assignment.size(), stream);
+    }
+    bool feasible = round_once(sol, lp_run_time_after_feasible, timer, probing_config);
+    f_t objective = sol.get_objective();
+    f_t excess    = sol.get_total_excess();
+    bool improved = feasible ? (!best_feasible || objective < best_objective)
+                             : (!best_feasible && excess < best_excess);
+    CUOPT_LOG_TRACE("Rounding order %d: feasible %d objective %g excess %g",
+                    attempt,
+                    feasible,
+                    objective,
+                    excess);
+    if (improved) {
+      raft::copy(best_assignment.data(), sol.assignment.data(), sol.assignment.size(), stream);
+      best_feasible  = feasible;
+      best_objective = objective;
+      best_excess    = excess;
+    }
+  }
+  raft::copy(sol.assignment.data(), best_assignment.data(), best_assignment.size(), stream);
+  return sol.compute_feasibility();
+}
+
+template <typename i_t, typename f_t>
+bool constraint_prop_t<i_t, f_t>::round_once(
+  solution_t<i_t, f_t>& sol,
+  f_t lp_run_time_after_feasible,
+  timer_t& timer,
+  std::optional<std::reference_wrapper<probing_config_t<i_t, f_t>>> probing_config)
+{
   recovery_mode      = false;
   rounding_ii        = false;
   n_iter_in_recovery = 0;
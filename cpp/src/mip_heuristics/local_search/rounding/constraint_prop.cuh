@@ -46,6 +46,10 @@ struct constraint_prop_t {
                    timer_t& timer,
                    std::optional<std::reference_wrapper<probing_config_t<i_t, f_t>>>
                      probing_config = std::nullopt);
+  bool round_once(solution_t<i_t, f_t>& sol,
+                  f_t lp_run_time_after_feasible,
+                  timer_t& timer,
+                  std::optional<std::reference_wrapper<probing_config_t<i_t, f_t>>> probing_config);
   void sort_by_implied_slack_consumption(solution_t<i_t, f_t>& sol,
                                          raft::device_span<i_t> vars,
                                          bool problem_ii);
@@ -154,6 +158,8 @@ struct constraint_prop_t {
   static repair_stats_t repair_stats;
   bool single_rounding_only = false;
   bool round_all_vars       = true;
+  // apply_round keeps the best of this many roundings under different variable orders
+  i_t n_rounding_orders = 1;
   // this is second timer that can continue but without recovery mode
   f_t max_time_for_bounds_prop = 5.;
 };
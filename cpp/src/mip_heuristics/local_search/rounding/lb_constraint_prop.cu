@@ -20,11 +20,21 @@
 
 namespace cuopt::linear_programming::detail {
 
+template <typename i_t, typename f_t>
+load_balanced_problem_cache_t<i_t, f_t>& get_lb_problem_cache(
+  mip_solver_context_t<i_t, f_t>& context)
+{
+  if (!context.lb_problem_cache) {
+    context.lb_problem_cache = std::make_shared<load_balanced_problem_cache_t<i_t, f_t>>();
+  }
+  return *context.lb_problem_cache;
+}
+
 template <typename i_t, typename f_t>
 lb_constraint_prop_t<i_t, f_t>::lb_constraint_prop_t(mip_solver_context_t<i_t, f_t>& context_)
   : context(context_),
-    temp_problem(*context.problem_ptr),
-    bounds_update(temp_problem, context),
+    temp_problem(get_lb_problem_cache(context).get(*context.problem_ptr)),
+    bounds_update(*temp_problem, context),
     bounds_repair(context.problem_ptr->handle_ptr),
     unset_vars(context.problem_ptr->n_variables, context.problem_ptr->handle_ptr->get_stream()),
     temp_assignment(context.problem_ptr->n_variables,
@@ -714,13 +724,20 @@ bool lb_constraint_prop_t<i_t, f_t>::apply_round(
   n_iter_in_recovery = 0;
   sol.compute_constraints();
 
-  temp_problem.setup(*sol.problem_ptr);
-  bounds_update.setup(temp_problem);
+  // the load balanced problem is only rebuilt when the problem structure changed
+  auto lb_problem = get_lb_problem_cache(context).get(*sol.problem_ptr);
+  lb_problem->refresh_vertex_data();
+  if (lb_problem != temp_problem) {
+    temp_problem = lb_problem;
+    bounds_update.setup(*temp_problem);
+  } else {
+    bounds_update.copy_input_bounds(*temp_problem);
+  }
 
   expand_device_copy(temp_assignment, sol.assignment, sol.handle_ptr->get_stream());
   f_t bounds_prop_start_time = max_timer.remaining_time();
   bool sol_found             = find_integer(temp_assignment,
-                                temp_problem,
+                                *temp_problem,
                                 bounds_update,
                                 sol,
                                 lp_run_time_after_feasible,
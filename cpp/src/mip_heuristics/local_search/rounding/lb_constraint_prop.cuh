@@ -87,7 +87,7 @@ struct lb_constraint_prop_t {
                             const raft::handle_t* handle_ptr);
 
   mip_solver_context_t<i_t, f_t>& context;
-  load_balanced_problem_t<i_t, f_t> temp_problem;
+  std::shared_ptr<load_balanced_problem_t<i_t, f_t>> temp_problem;
   load_balanced_bounds_presolve_t<i_t, f_t> bounds_update;
   lb_bounds_repair_t<i_t, f_t> bounds_repair;
   rmm::device_uvector<i_t> unset_vars;
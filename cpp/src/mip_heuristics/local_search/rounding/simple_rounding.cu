@@ -13,6 +13,7 @@
 #include <utilities/seed_generator.cuh>
 
 #include <thrust/copy.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
 #include <thrust/shuffle.h>
@@ -35,7 +36,7 @@ bool check_brute_force_rounding(solution_t<i_t, f_t>& solution)
   if (n_integers_to_round == 0) { return solution.compute_feasibility(); }
   constexpr i_t brute_force_rounding_threshold = 8;
   if (n_integers_to_round <= brute_force_rounding_threshold) {
-    solution.compute_constraints();
+    solution.compute_feasibility();
     i_t n_configs = pow(2, n_integers_to_round);
     i_t n_blocks  = (n_configs + TPB - 1) / TPB;
     // extract the variables to round
@@ -60,11 +61,16 @@ bool check_brute_force_rounding(solution_t<i_t, f_t>& solution)
                                                                 best_config.data());
     if (best_config.value(solution.handle_ptr->get_stream()) != -1) {
       CUOPT_LOG_DEBUG("Feasible found during brute force rounding!");
+      rmm::device_uvector<f_t> old_values(n_integers_to_round, solution.handle_ptr->get_stream());
+      thrust::gather(solution.handle_ptr->get_thrust_policy(),
+                     var_map.begin(),
+                     var_map.end(),
+                     solution.assignment.begin(),
+                     old_values.begin());
       // apply the feasible rounding
       apply_feasible_rounding_kernel<i_t, f_t><<<1, TPB, 0, solution.handle_ptr->get_stream()>>>(
         solution.view(), n_integers_to_round, cuopt::make_span(var_map), best_config.data());
-      solution.handle_ptr->sync_stream();
-      bool feas = solution.compute_feasibility();
+      bool feas = solution.update_feasibility_after_changes(var_map, old_values);
       cuopt_assert(feas, "Solution must be feasible!");
       return true;
     }
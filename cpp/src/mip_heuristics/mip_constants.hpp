@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -11,3 +11,10 @@
 
 #define MIP_INSTANTIATE_FLOAT  CUOPT_INSTANTIATE_FLOAT
 #define MIP_INSTANTIATE_DOUBLE CUOPT_INSTANTIATE_DOUBLE
+
+// Also instantiates the LP path (optimization_problem_t, problem_t, PDLP and its strategies) with
+// int64_t indices, for problems of more than 2^31 nonzeros. Built with -DDEFINE_PDLP_INT64=ON as it
+// doubles the compile time of these files. Only the PDLP method runs with 64-bit indices
+#ifndef PDLP_INSTANTIATE_INT64
+#define PDLP_INSTANTIATE_INT64 0
+#endif
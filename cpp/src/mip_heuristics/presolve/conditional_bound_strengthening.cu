@@ -11,19 +11,25 @@
 #include <utilities/cuda_helpers.cuh>
 #include <utilities/vector_helpers.cuh>
 
-#include <raft/sparse/detail/cusparse_wrappers.h>
-#include <raft/core/cusparse_macros.hpp>
-#include <raft/sparse/linalg/transpose.cuh>
-#include "cusparse.h"
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
 
 #include <cub/cub.cuh>
 #include "conditional_bound_strengthening.cuh"
 
+#include <cstdint>
+#include <limits>
 #include <unordered_set>
 namespace cuopt::linear_programming::detail {
 
-constexpr size_t max_pair_per_row = 100;
-
 template <typename i_t, typename f_t>
 conditional_bound_strengthening_t<i_t, f_t>::conditional_bound_strengthening_t(
   problem_t<i_t, f_t>& problem)
@@ -59,168 +65,6 @@ void conditional_bound_strengthening_t<i_t, f_t>::update_constraint_bounds(
   solve(problem);
 }
 
-void check_cusparse_status(cusparseStatus_t status)
-{
-  if (status != CUSPARSE_STATUS_SUCCESS) { throw std::bad_alloc(); }
-}
-
-template <typename i_t, typename f_t>
-void spgemm_cusparse([[maybe_unused]] rmm::device_uvector<i_t>& offsetsA,
-                     [[maybe_unused]] rmm::device_uvector<i_t>& colsA,
-                     [[maybe_unused]] rmm::device_uvector<f_t>& valsA,
-                     [[maybe_unused]] rmm::device_uvector<i_t>& offsetsB,
-                     [[maybe_unused]] rmm::device_uvector<i_t>& colsB,
-                     [[maybe_unused]] rmm::device_uvector<f_t>& valsB,
-                     [[maybe_unused]] rmm::device_uvector<i_t>& offsetsC,
-                     [[maybe_unused]] rmm::device_uvector<i_t>& colsC,
-                     [[maybe_unused]] rmm::device_uvector<f_t>& valsC)
-{
-#if CUDART_VERSION >= 12000
-  auto stream = offsetsA.stream();
-  cusparseHandle_t handle;
-  cusparseCreate(&handle);
-  cusparseSetStream(handle, stream);
-
-  int m    = offsetsA.size() - 1;
-  int n    = offsetsB.size() - 1;
-  int nnzA = colsA.size();
-  int nnzB = colsB.size();
-
-  offsetsC.resize(m + 1, stream);
-
-  cusparseSpMatDescr_t matA, matB, matC;
-  cusparseSpGEMMAlg_t alg = CUSPARSE_SPGEMM_ALG1;
-  rmm::device_buffer dBuffer1(0, stream), dBuffer2(0, stream), dBuffer3(0, stream);
-
-  float alpha              = 1.0f;
-  float beta               = 0.0f;
-  cusparseOperation_t opA  = CUSPARSE_OPERATION_NON_TRANSPOSE;
-  cusparseOperation_t opB  = CUSPARSE_OPERATION_NON_TRANSPOSE;
-  cudaDataType computeType = CUDA_R_32F;
-
-  check_cusparse_status(cusparseCreateCsr(&matA,
-                                          m,
-                                          n,
-                                          nnzA,
-                                          offsetsA.data(),
-                                          colsA.data(),
-                                          valsA.data(),
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_BASE_ZERO,
-                                          CUDA_R_32F));
-  check_cusparse_status(cusparseCreateCsr(&matB,
-                                          n,
-                                          m,
-                                          nnzB,
-                                          offsetsB.data(),
-                                          colsB.data(),
-                                          valsB.data(),
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_BASE_ZERO,
-                                          CUDA_R_32F));
-  check_cusparse_status(cusparseCreateCsr(&matC,
-                                          m,
-                                          m,
-                                          0,
-                                          offsetsC.data(),
-                                          NULL,
-                                          NULL,
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_32I,
-                                          CUSPARSE_INDEX_BASE_ZERO,
-                                          CUDA_R_32F));
-
-  cusparseSpGEMMDescr_t spgemmDesc;
-  cusparseSpGEMM_createDescr(&spgemmDesc);
-
-  size_t bufferSize1 = 0;
-  // ask bufferSize1 bytes for external memory
-  check_cusparse_status(cusparseSpGEMM_workEstimation(handle,
-                                                      opA,
-                                                      opB,
-                                                      &alpha,
-                                                      matA,
-                                                      matB,
-                                                      &beta,
-                                                      matC,
-                                                      computeType,
-                                                      alg,
-                                                      spgemmDesc,
-                                                      &bufferSize1,
-                                                      NULL));
-  dBuffer1.resize(bufferSize1, stream);
-
-  // inspect the matrices A and B to understand the memory requirement for
-  // the next step
-  check_cusparse_status(cusparseSpGEMM_workEstimation(handle,
-                                                      opA,
-                                                      opB,
-                                                      &alpha,
-                                                      matA,
-                                                      matB,
-                                                      &beta,
-                                                      matC,
-                                                      computeType,
-                                                      alg,
-                                                      spgemmDesc,
-                                                      &bufferSize1,
-                                                      dBuffer1.data()));
-
-  size_t bufferSize2 = 0;
-  // ask bufferSize2 bytes for external memory
-  check_cusparse_status(cusparseSpGEMM_compute(handle,
-                                               opA,
-                                               opB,
-                                               &alpha,
-                                               matA,
-                                               matB,
-                                               &beta,
-                                               matC,
-                                               computeType,
-                                               alg,
-                                               spgemmDesc,
-                                               &bufferSize2,
-                                               NULL));
-  dBuffer2.resize(bufferSize2, stream);
-
-  // compute the intermediate product of A * B
-  check_cusparse_status(cusparseSpGEMM_compute(handle,
-                                               opA,
-                                               opB,
-                                               &alpha,
-                                               matA,
-                                               matB,
-                                               &beta,
-                                               matC,
-                                               computeType,
-                                               alg,
-                                               spgemmDesc,
-                                               &bufferSize2,
-                                               dBuffer2.data()));
-
-  int64_t C_num_rows1, C_num_cols1, C_nnz1;
-  check_cusparse_status(cusparseSpMatGetSize(matC, &C_num_rows1, &C_num_cols1, &C_nnz1));
-  colsC.resize(C_nnz1, stream);
-  valsC.resize(C_nnz1, stream);
-
-  check_cusparse_status(cusparseCsrSetPointers(matC, offsetsC.data(), colsC.data(), valsC.data()));
-
-  check_cusparse_status(cusparseSpGEMM_copy(
-    handle, opA, opB, &alpha, matA, matB, &beta, matC, computeType, alg, spgemmDesc));
-  stream.synchronize();
-
-  cusparseSpGEMM_destroyDescr(spgemmDesc);
-  cusparseDestroySpMat(matA);
-  cusparseDestroySpMat(matB);
-  cusparseDestroySpMat(matC);
-  cusparseDestroy(handle);
-#else
-  throw std::bad_alloc();
-#endif
-}
-
 // #define DEBUG_COND_BOUNDS_PROP
 
 template <typename i_t, typename f_t>
@@ -237,6 +81,7 @@ void conditional_bound_strengthening_t<i_t, f_t>::select_constraint_pairs_host(
   auto reverse_constraints = cuopt::host_copy(problem.reverse_constraints, stream);
   auto reverse_offsets     = cuopt::host_copy(problem.reverse_offsets, stream);
 
+  const size_t max_pair_per_row = max_pairs_per_row;
   std::vector<int2> constraint_pairs_h(max_pair_per_row * problem.n_constraints, {-1, -1});
   std::unordered_set<int> cnstr_pair;
 
@@ -269,6 +114,55 @@ void conditional_bound_strengthening_t<i_t, f_t>::select_constraint_pairs_host(
 #endif
 }
 
+// The knapsack of a pair only fits rows that have at most this many variables
+constexpr int max_conditioning_row_size = 128;
+
+// A pair (i, j) strengthens the bounds of the row i with the row j, which the knapsack solve can
+// only do when j is an inequality with a finite side that fits in a block, and i is not an equality
+template <typename i_t, typename f_t>
+struct pair_eligibility_t {
+  raft::device_span<i_t> offsets;
+  raft::device_span<f_t> constraint_lower_bounds;
+  raft::device_span<f_t> constraint_upper_bounds;
+  f_t tolerance;
+
+  HDI bool is_free_or_equality(i_t row) const
+  {
+    const f_t lb = constraint_lower_bounds[row];
+    const f_t ub = constraint_upper_bounds[row];
+    return ub - lb < tolerance || (!std::isfinite(lb) && !std::isfinite(ub));
+  }
+
+  HDI bool operator()(i_t i, i_t j) const
+  {
+    if (i == j || offsets[j + 1] - offsets[j] > max_conditioning_row_size) { return false; }
+    const f_t lb_i = constraint_lower_bounds[i];
+    const f_t ub_i = constraint_upper_bounds[i];
+    return ub_i - lb_i >= tolerance && !is_free_or_equality(j);
+  }
+};
+
+// Number of pairs that the nonzero k hashes, the other rows of its column unless the column is long
+template <typename i_t>
+struct column_candidates_t {
+  raft::device_span<i_t> variables;
+  raft::device_span<i_t> reverse_offsets;
+  i_t max_column_length;
+
+  HDI size_t operator()(i_t k) const
+  {
+    const i_t var    = variables[k];
+    const i_t length = reverse_offsets[var + 1] - reverse_offsets[var];
+    return length <= max_column_length ? static_cast<size_t>(length - 1) : size_t{0};
+  }
+};
+
+// Enumerates the pairs of rows that share variables without forming A * A^T: every nonzero (i, v)
+// hashes the pair (i, j) for each row j of the column v into a 64 bit key, and sorting the keys
+// counts the variables shared by each pair. Columns longer than a cap are skipped, and the cap is
+// halved until the candidates fit the budget, so dense columns do not make the enumeration
+// quadratic. The pairs are then ranked by an estimate of the tightening, the product of the
+// fractions of the two rows that are shared, and only the best ones per row and overall are kept
 template <typename i_t, typename f_t>
 void conditional_bound_strengthening_t<i_t, f_t>::select_constraint_pairs_device(
   problem_t<i_t, f_t>& problem)
@@ -276,55 +170,174 @@ void conditional_bound_strengthening_t<i_t, f_t>::select_constraint_pairs_device
 #ifdef DEBUG_COND_BOUNDS_PROP
   auto start_time = std::chrono::high_resolution_clock::now();
 #endif
-  auto stream = problem.variables.stream();
-  rmm::device_uvector<float> valsA(problem.variables.size(), stream),
-    valsB(problem.variables.size(), stream), valsC(0, stream);
-  // fill valsA, valsB with 1
-  thrust::fill(problem.handle_ptr->get_thrust_policy(), valsA.begin(), valsA.end(), 1.f);
-  thrust::fill(problem.handle_ptr->get_thrust_policy(), valsB.begin(), valsB.end(), 1.f);
-
-  rmm::device_uvector<i_t> offsetsC(0, stream), colsC(0, stream);
-  std::vector<i_t> offsets_h, cols_h;
-
-  spgemm_cusparse(problem.offsets,
-                  problem.variables,
-                  valsA,
-                  problem.reverse_offsets,
-                  problem.reverse_constraints,
-                  valsB,
-                  offsetsC,
-                  colsC,
-                  valsC);
-  std::vector<int2> constraint_pairs_h;
-  offsets_h = cuopt::host_copy(offsetsC, stream);
-  cols_h    = cuopt::host_copy(colsC, stream);
-
-  constraint_pairs_h.reserve(max_pair_per_row * problem.n_constraints);
-  for (int i = 0; i < problem.n_constraints; ++i) {
-    int cnstr_i = i;
-    int cnt     = 0;
-    for (int jj = offsets_h[i]; jj < offsets_h[i + 1]; ++jj) {
-      int cnstr_j = cols_h[jj];
-      cuopt_expects(cnstr_j < problem.n_constraints && cnstr_j >= 0,
-                    error_type_t::RuntimeError,
-                    "Constraint index should be in range");
-
-      if (cnstr_i != cnstr_j) {
-        constraint_pairs_h.push_back({cnstr_i, cnstr_j});
-        cnt++;
-      }
-      if (cnt == max_pair_per_row) { break; }
-    }
+  auto stream      = problem.handle_ptr->get_stream();
+  auto policy      = problem.handle_ptr->get_thrust_policy();
+  const i_t nnz    = problem.variables.size();
+  const i_t n_rows = problem.n_constraints;
+  constraint_pairs.resize(0, stream);
+  if (nnz == 0 || n_rows < 2 || max_pairs_per_row <= 0 || pair_budget == 0) { return; }
+
+  auto offsets             = make_span(problem.offsets);
+  auto variables           = make_span(problem.variables);
+  auto reverse_offsets     = make_span(problem.reverse_offsets);
+  auto reverse_constraints = make_span(problem.reverse_constraints);
+  pair_eligibility_t<i_t, f_t> is_eligible{offsets,
+                                           make_span(problem.constraint_lower_bounds),
+                                           make_span(problem.constraint_upper_bounds),
+                                           problem.tolerances.absolute_tolerance};
+
+  // row of every nonzero
+  rmm::device_uvector<i_t> nonzero_row(nnz, stream);
+  thrust::upper_bound(policy,
+                      problem.offsets.begin() + 1,
+                      problem.offsets.end(),
+                      thrust::make_counting_iterator<i_t>(0),
+                      thrust::make_counting_iterator<i_t>(nnz),
+                      nonzero_row.begin());
+
+  // bound on the hashed keys, the pairs share a few variables on average
+  constexpr size_t candidates_per_pair = 16;
+  const size_t max_candidates          = candidates_per_pair * pair_budget;
+  column_candidates_t<i_t> candidates_of{variables, reverse_offsets, n_rows};
+  auto count_candidates = [&]() {
+    return thrust::transform_reduce(policy,
+                                    thrust::make_counting_iterator<i_t>(0),
+                                    thrust::make_counting_iterator<i_t>(nnz),
+                                    candidates_of,
+                                    size_t{0},
+                                    thrust::plus<size_t>());
+  };
+  size_t n_candidates = count_candidates();
+  while (n_candidates > max_candidates && candidates_of.max_column_length > 2) {
+    candidates_of.max_column_length /= 2;
+    n_candidates = count_candidates();
+  }
+  if (n_candidates == 0) { return; }
+
+  rmm::device_uvector<size_t> candidate_offsets(nnz, stream);
+  thrust::transform_exclusive_scan(policy,
+                                   thrust::make_counting_iterator<i_t>(0),
+                                   thrust::make_counting_iterator<i_t>(nnz),
+                                   candidate_offsets.begin(),
+                                   candidates_of,
+                                   size_t{0},
+                                   thrust::plus<size_t>());
+
+  constexpr uint64_t invalid_key = std::numeric_limits<uint64_t>::max();
+  rmm::device_uvector<uint64_t> keys(n_candidates, stream);
+  thrust::for_each(policy,
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(nnz),
+                   [candidates_of,
+                    is_eligible,
+                    variables,
+                    reverse_offsets,
+                    reverse_constraints,
+                    nonzero_row       = make_span(nonzero_row),
+                    candidate_offsets = make_span(candidate_offsets),
+                    keys              = make_span(keys)] __device__(i_t k) {
+                     if (candidates_of(k) == 0) { return; }
+                     const i_t row = nonzero_row[k];
+                     const i_t var = variables[k];
+                     size_t out    = candidate_offsets[k];
+                     for (i_t kk = reverse_offsets[var]; kk < reverse_offsets[var + 1]; ++kk) {
+                       const i_t other = reverse_constraints[kk];
+                       if (other == row) { continue; }
+                       keys[out++] = is_eligible(row, other)
+                                       ? (static_cast<uint64_t>(row) << 32) | uint32_t(other)
+                                       : invalid_key;
+                     }
+                   });
+  keys.resize(thrust::remove(policy, keys.begin(), keys.end(), invalid_key) - keys.begin(), stream);
+  if (keys.size() == 0) { return; }
+  thrust::sort(policy, keys.begin(), keys.end());
+
+  // the number of occurrences of a key is the number of variables the pair shares
+  rmm::device_uvector<uint64_t> pair_keys(keys.size(), stream);
+  rmm::device_uvector<i_t> n_shared(keys.size(), stream);
+  auto pair_end     = thrust::reduce_by_key(policy,
+                                        keys.begin(),
+                                        keys.end(),
+                                        thrust::make_constant_iterator<i_t>(1),
+                                        pair_keys.begin(),
+                                        n_shared.begin());
+  const i_t n_pairs = pair_end.first - pair_keys.begin();
+  keys.resize(0, stream);
+  keys.shrink_to_fit(stream);
+
+  // rank the pairs of a row with a key made of the row and the quantized tightening estimate
+  rmm::device_uvector<uint64_t> rank_keys(n_pairs, stream);
+  rmm::device_uvector<f_t> scores(n_pairs, stream);
+  thrust::for_each(policy,
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n_pairs),
+                   [offsets,
+                    pair_keys = make_span(pair_keys),
+                    n_shared  = make_span(n_shared),
+                    rank_keys = make_span(rank_keys),
+                    scores    = make_span(scores)] __device__(i_t p) {
+                     const i_t i      = pair_keys[p] >> 32;
+                     const i_t j      = pair_keys[p] & 0xffffffffu;
+                     const f_t shared = n_shared[p];
+                     const f_t score  = (shared / (offsets[i + 1] - offsets[i])) *
+                                       (shared / (offsets[j + 1] - offsets[j]));
+                     scores[p]        = score;
+                     const auto quantized_loss =
+                       static_cast<uint32_t>((1. - score) * std::numeric_limits<uint32_t>::max());
+                     rank_keys[p] = (static_cast<uint64_t>(i) << 32) | quantized_loss;
+                   });
+  thrust::sort_by_key(policy,
+                      rank_keys.begin(),
+                      rank_keys.end(),
+                      thrust::make_zip_iterator(thrust::make_tuple(pair_keys.begin(), scores.begin())));
+
+  // keep the first pairs of every row
+  const i_t pairs_per_row = max_pairs_per_row;
+  rmm::device_uvector<uint64_t> selected_keys(n_pairs, stream);
+  rmm::device_uvector<f_t> selected_scores(n_pairs, stream);
+  auto selected_end = thrust::copy_if(
+    policy,
+    thrust::make_zip_iterator(thrust::make_tuple(pair_keys.begin(), scores.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(pair_keys.end(), scores.end())),
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_zip_iterator(thrust::make_tuple(selected_keys.begin(), selected_scores.begin())),
+    [pairs_per_row, rank_keys = make_span(rank_keys)] __device__(i_t p) {
+      const uint64_t row_start = rank_keys[p] & ~uint64_t{0xffffffffu};
+      const i_t first =
+        thrust::lower_bound(thrust::seq, rank_keys.begin(), rank_keys.end(), row_start) -
+        rank_keys.begin();
+      return p - first < pairs_per_row;
+    });
+  size_t n_selected = thrust::get<0>(selected_end.get_iterator_tuple()) - selected_keys.begin();
+
+  // and the best ones overall when the budget is exceeded
+  if (n_selected > pair_budget) {
+    thrust::sort_by_key(policy,
+                        selected_scores.begin(),
+                        selected_scores.begin() + n_selected,
+                        selected_keys.begin(),
+                        thrust::greater<f_t>());
+    n_selected = pair_budget;
   }
 
-  constraint_pairs = cuopt::device_copy(constraint_pairs_h, problem.handle_ptr->get_stream());
+  constraint_pairs.resize(n_selected, stream);
+  thrust::transform(policy,
+                    selected_keys.begin(),
+                    selected_keys.begin() + n_selected,
+                    constraint_pairs.begin(),
+                    [] __device__(uint64_t key) {
+                      return int2{static_cast<int>(key >> 32),
+                                  static_cast<int>(key & 0xffffffffu)};
+                    });
 
 #ifdef DEBUG_COND_BOUNDS_PROP
   auto end_time = std::chrono::high_resolution_clock::now();
 
   std::cout << "Time for constructing pairs:: "
             << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count()
-            << " ms" << std::endl;
+            << " ms, max column length " << candidates_of.max_column_length << ", candidates "
+            << n_candidates
+            << ", pairs " << n_pairs << ", selected " << n_selected << std::endl;
 #endif
 }
 
@@ -645,7 +658,7 @@ i_t get_max_row_size(rmm::device_uvector<i_t>& offsets, rmm::cuda_stream_view st
 template <typename i_t, typename f_t>
 void conditional_bound_strengthening_t<i_t, f_t>::solve(problem_t<i_t, f_t>& problem)
 {
-  constexpr int TPB = 128;
+  constexpr int TPB = max_conditioning_row_size;
   size_t n_blocks   = constraint_pairs.size();
 
   if (n_blocks == 0) { return; }
@@ -45,6 +45,10 @@ class conditional_bound_strengthening_t {
 
   rmm::device_uvector<int2> constraint_pairs;
 
+  // The pairs with the best expected tightening are kept, up to this many per row and overall
+  i_t max_pairs_per_row{100};
+  size_t pair_budget{size_t{1} << 21};
+
   rmm::device_uvector<i_t> locks_per_constraint;
 };
 
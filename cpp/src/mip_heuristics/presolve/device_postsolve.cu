@@ -0,0 +1,230 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <mip_heuristics/mip_constants.hpp>
+#include <mip_heuristics/presolve/device_postsolve.hpp>
+#include <utilities/copy_helpers.hpp>
+#include <utilities/macros.cuh>
+
+#include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+
+#include <algorithm>
+
+namespace cuopt::linear_programming::detail {
+
+template <typename i_t, typename f_t>
+struct device_primal_postsolve_t<i_t, f_t>::device_data_t {
+  explicit device_data_t(rmm::cuda_stream_view stream)
+    : reduced_to_original(0, stream),
+      fixed_cols(0, stream),
+      fixed_values(0, stream),
+      sub_cols(0, stream),
+      sub_rhs(0, stream),
+      sub_col_coefs(0, stream),
+      sub_offsets(0, stream),
+      sub_entry_cols(0, stream),
+      sub_entry_coefs(0, stream)
+  {
+  }
+
+  rmm::device_uvector<i_t> reduced_to_original;
+  rmm::device_uvector<i_t> fixed_cols;
+  rmm::device_uvector<f_t> fixed_values;
+  rmm::device_uvector<i_t> sub_cols;
+  rmm::device_uvector<f_t> sub_rhs;
+  rmm::device_uvector<f_t> sub_col_coefs;
+  rmm::device_uvector<i_t> sub_offsets;
+  rmm::device_uvector<i_t> sub_entry_cols;
+  rmm::device_uvector<f_t> sub_entry_coefs;
+};
+
+template <typename i_t, typename f_t>
+device_primal_postsolve_t<i_t, f_t>::device_primal_postsolve_t(i_t n_original_columns,
+                                                               std::vector<i_t> reduced_to_original)
+  : n_original_columns_(n_original_columns), h_reduced_to_original_(std::move(reduced_to_original))
+{
+}
+
+template <typename i_t, typename f_t>
+device_primal_postsolve_t<i_t, f_t>::~device_primal_postsolve_t() = default;
+
+template <typename i_t, typename f_t>
+void device_primal_postsolve_t<i_t, f_t>::add_fixed_column(i_t col, f_t value)
+{
+  h_fixed_cols_.push_back(col);
+  h_fixed_values_.push_back(value);
+  h_fixed_order_.push_back(num_reductions_++);
+}
+
+template <typename i_t, typename f_t>
+void device_primal_postsolve_t<i_t, f_t>::add_substitution(
+  i_t col, f_t rhs, f_t col_coef, const std::vector<i_t>& cols, const std::vector<f_t>& coefs)
+{
+  h_sub_cols_.push_back(col);
+  h_sub_rhs_.push_back(rhs);
+  h_sub_col_coefs_.push_back(col_coef);
+  h_sub_entry_cols_.insert(h_sub_entry_cols_.end(), cols.begin(), cols.end());
+  h_sub_entry_coefs_.insert(h_sub_entry_coefs_.end(), coefs.begin(), coefs.end());
+  h_sub_offsets_.push_back(h_sub_entry_cols_.size());
+  h_sub_order_.push_back(num_reductions_++);
+}
+
+template <typename i_t, typename f_t>
+bool device_primal_postsolve_t<i_t, f_t>::finalize(rmm::cuda_stream_view stream)
+{
+  raft::common::nvtx::range fun_scope("device_primal_postsolve_t::finalize");
+  const i_t n_sub = h_sub_cols_.size();
+  // Storage order of the reduction that sets each column, -2 for the columns kept by presolve
+  std::vector<i_t> writer_order(n_original_columns_, -1);
+  std::vector<i_t> writer_sub(n_original_columns_, -1);
+  auto set_writer = [&](i_t col, i_t order) {
+    if (col < 0 || col >= n_original_columns_ || writer_order[col] != -1) { return false; }
+    writer_order[col] = order;
+    return true;
+  };
+  for (auto col : h_reduced_to_original_) {
+    if (!set_writer(col, -2)) { return false; }
+  }
+  for (size_t k = 0; k < h_fixed_cols_.size(); ++k) {
+    if (!set_writer(h_fixed_cols_[k], h_fixed_order_[k])) { return false; }
+  }
+  for (i_t k = 0; k < n_sub; ++k) {
+    if (!set_writer(h_sub_cols_[k], h_sub_order_[k])) { return false; }
+    writer_sub[h_sub_cols_[k]] = k;
+  }
+
+  // The reductions are undone from the last one, a substitution reads the columns of reductions
+  // stored after it. The fixed columns and the kept ones are known before the first level
+  std::vector<i_t> level(n_sub, 0);
+  num_levels_ = 0;
+  for (i_t k = n_sub - 1; k >= 0; --k) {
+    i_t lvl = 0;
+    for (i_t e = h_sub_offsets_[k]; e < h_sub_offsets_[k + 1]; ++e) {
+      const i_t col = h_sub_entry_cols_[e];
+      if (col < 0 || col >= n_original_columns_) { return false; }
+      // a column set by an earlier reduction is not set yet when the host replays this one
+      if (writer_order[col] == -1 ||
+          (writer_order[col] >= 0 && writer_order[col] < h_sub_order_[k])) {
+        return false;
+      }
+      if (writer_sub[col] >= 0) { lvl = std::max(lvl, level[writer_sub[col]] + 1); }
+    }
+    level[k]    = lvl;
+    num_levels_ = std::max(num_levels_, lvl + 1);
+    if (num_levels_ > max_levels) { return false; }
+  }
+
+  // Substitutions sorted by level
+  level_offsets_.assign(num_levels_ + 1, 0);
+  for (i_t k = 0; k < n_sub; ++k) {
+    level_offsets_[level[k] + 1]++;
+  }
+  for (i_t l = 0; l < num_levels_; ++l) {
+    level_offsets_[l + 1] += level_offsets_[l];
+  }
+  std::vector<i_t> position(level_offsets_.begin(), level_offsets_.end() - 1);
+  std::vector<i_t> perm(n_sub);
+  for (i_t k = 0; k < n_sub; ++k) {
+    perm[position[level[k]]++] = k;
+  }
+  std::vector<i_t> sub_cols(n_sub), sub_offsets(n_sub + 1, 0);
+  std::vector<f_t> sub_rhs(n_sub), sub_col_coefs(n_sub);
+  std::vector<i_t> entry_cols;
+  std::vector<f_t> entry_coefs;
+  entry_cols.reserve(h_sub_entry_cols_.size());
+  entry_coefs.reserve(h_sub_entry_coefs_.size());
+  for (i_t p = 0; p < n_sub; ++p) {
+    const i_t k      = perm[p];
+    sub_cols[p]      = h_sub_cols_[k];
+    sub_rhs[p]       = h_sub_rhs_[k];
+    sub_col_coefs[p] = h_sub_col_coefs_[k];
+    entry_cols.insert(entry_cols.end(),
+                      h_sub_entry_cols_.begin() + h_sub_offsets_[k],
+                      h_sub_entry_cols_.begin() + h_sub_offsets_[k + 1]);
+    entry_coefs.insert(entry_coefs.end(),
+                       h_sub_entry_coefs_.begin() + h_sub_offsets_[k],
+                       h_sub_entry_coefs_.begin() + h_sub_offsets_[k + 1]);
+    sub_offsets[p + 1] = entry_cols.size();
+  }
+
+  device_                      = std::make_unique<device_data_t>(stream);
+  device_->reduced_to_original = cuopt::device_copy(h_reduced_to_original_, stream);
+  device_->fixed_cols          = cuopt::device_copy(h_fixed_cols_, stream);
+  device_->fixed_values        = cuopt::device_copy(h_fixed_values_, stream);
+  device_->sub_cols            = cuopt::device_copy(sub_cols, stream);
+  device_->sub_rhs             = cuopt::device_copy(sub_rhs, stream);
+  device_->sub_col_coefs       = cuopt::device_copy(sub_col_coefs, stream);
+  device_->sub_offsets         = cuopt::device_copy(sub_offsets, stream);
+  device_->sub_entry_cols      = cuopt::device_copy(entry_cols, stream);
+  device_->sub_entry_coefs     = cuopt::device_copy(entry_coefs, stream);
+  stream.synchronize();
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void device_primal_postsolve_t<i_t, f_t>::undo(const f_t* reduced_primal,
+                                               rmm::device_uvector<f_t>& full_primal,
+                                               rmm::cuda_stream_view stream) const
+{
+  raft::common::nvtx::range fun_scope("device_primal_postsolve_t::undo");
+  cuopt_assert(device_ != nullptr, "Device postsolve used before finalize");
+  const auto& d = *device_;
+  full_primal.resize(n_original_columns_, stream);
+  thrust::fill(rmm::exec_policy(stream), full_primal.begin(), full_primal.end(), f_t(0));
+  thrust::scatter(rmm::exec_policy(stream),
+                  reduced_primal,
+                  reduced_primal + d.reduced_to_original.size(),
+                  d.reduced_to_original.begin(),
+                  full_primal.begin());
+  thrust::scatter(rmm::exec_policy(stream),
+                  d.fixed_values.begin(),
+                  d.fixed_values.end(),
+                  d.fixed_cols.begin(),
+                  full_primal.begin());
+  for (i_t l = 0; l < num_levels_; ++l) {
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<i_t>(level_offsets_[l]),
+                     thrust::make_counting_iterator<i_t>(level_offsets_[l + 1]),
+                     [x           = full_primal.data(),
+                      sub_cols    = d.sub_cols.data(),
+                      rhs         = d.sub_rhs.data(),
+                      col_coefs   = d.sub_col_coefs.data(),
+                      offsets     = d.sub_offsets.data(),
+                      entry_cols  = d.sub_entry_cols.data(),
+                      entry_coefs = d.sub_entry_coefs.data()] __device__(i_t k) {
+                       // compensated sum, papilo sums the row with a stable sum as well
+                       f_t sum = rhs[k];
+                       f_t c   = 0;
+                       for (i_t e = offsets[k]; e < offsets[k + 1]; ++e) {
+                         const f_t y = -entry_coefs[e] * x[entry_cols[e]] - c;
+                         const f_t t = sum + y;
+                         c           = (t - sum) - y;
+                         sum         = t;
+                       }
+                       x[sub_cols[k]] = sum / col_coefs[k];
+                     });
+  }
+  RAFT_CHECK_CUDA(stream);
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class device_primal_postsolve_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class device_primal_postsolve_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,78 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+/**
+ * @brief Primal postsolve of the fixed column and column substitution reductions on the device.
+ *
+ * The reductions are added in the order presolve stored them and are undone in reverse order. A
+ * substitution only waits for the substitutions that set the columns of its row, so the
+ * substitutions are grouped in levels that are undone one kernel at a time, and the fixed columns
+ * are written with the columns kept by presolve.
+ *
+ * Built on the host from the papilo postsolve storage, this header does not include papilo so
+ * that it can be used from the .cu files.
+ */
+template <typename i_t, typename f_t>
+class device_primal_postsolve_t {
+ public:
+  device_primal_postsolve_t(i_t n_original_columns, std::vector<i_t> reduced_to_original);
+  ~device_primal_postsolve_t();
+
+  void add_fixed_column(i_t col, f_t value);
+  // col = (rhs - sum coefs[k] * cols[k]) / col_coef, the other columns exclude col
+  void add_substitution(
+    i_t col, f_t rhs, f_t col_coef, const std::vector<i_t>& cols, const std::vector<f_t>& coefs);
+
+  // Computes the levels and copies the plan to the device. Returns false when the reductions do
+  // not fit the level schedule and the host postsolve has to be used
+  bool finalize(rmm::cuda_stream_view stream);
+
+  i_t num_levels() const { return num_levels_; }
+
+  // full_primal is resized to the original number of columns
+  void undo(const f_t* reduced_primal,
+            rmm::device_uvector<f_t>& full_primal,
+            rmm::cuda_stream_view stream) const;
+
+ private:
+  // Beyond this many levels the launches cost more than the host replay
+  static constexpr i_t max_levels = 256;
+
+  i_t n_original_columns_;
+  i_t num_levels_{0};
+  // position of each reduction in the storage order
+  i_t num_reductions_{0};
+  std::vector<i_t> h_fixed_order_;
+  std::vector<i_t> h_sub_order_;
+
+  std::vector<i_t> h_reduced_to_original_;
+  std::vector<i_t> h_fixed_cols_;
+  std::vector<f_t> h_fixed_values_;
+  std::vector<i_t> h_sub_cols_;
+  std::vector<f_t> h_sub_rhs_;
+  std::vector<f_t> h_sub_col_coefs_;
+  std::vector<i_t> h_sub_offsets_{0};
+  std::vector<i_t> h_sub_entry_cols_;
+  std::vector<f_t> h_sub_entry_coefs_;
+
+  struct device_data_t;
+  std::unique_ptr<device_data_t> device_;
+  // substitutions of level l are [level_offsets_[l], level_offsets_[l + 1]) on the device
+  std::vector<i_t> level_offsets_;
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -9,7 +9,9 @@
 
 #include <mip_heuristics/mip_constants.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <unordered_map>
 
 #if GF2_PRESOLVE_DEBUG
@@ -33,55 +35,80 @@ static inline i_t positive_modulo(i_t i, i_t n)
   return (i % n + n) % n;
 }
 
-// this is kind-of a stopgap implementation (as in practice MIPLIB2017 only contains a couple of GF2
-// problems and they're small) but cuDSS could be used for this since A is likely to be sparse and
-// low-bandwidth (i think?) unlikely to occur in real-world problems however. doubt it'd be worth
-// the effort trashes A and b, return true if solved
-static bool gf2_solve(std::vector<std::vector<int>>& A, std::vector<int>& b, std::vector<int>& x)
+// Above this size the dense matrix of the system no longer fits in a reasonable amount of memory:
+// 32768 rows take 128 MiB once packed
+constexpr size_t max_gf2_constraints = 1 << 15;
+// Smaller systems are eliminated on one thread
+constexpr size_t gf2_parallel_rows = 1024;
+// Pivots between two checks of the presolve time limit
+constexpr size_t gf2_pivots_per_time_check = 64;
+
+enum class gf2_status_t { UNIQUE, SINGULAR, INCONSISTENT, TIME_LIMIT };
+
+// Rows of the augmented matrix [A | b], packed 64 columns per word, b being column n
+static inline size_t gf2_row_words(size_t n) { return (n + 1 + 63) / 64; }
+
+static inline bool gf2_test(const uint64_t* row, size_t col)
 {
-  int i, j, k;
-  const int N = A.size();
-  for (i = 0; i < N; i++) {
-    // Find pivot
-    int pivot = -1;
-    for (j = i; j < N; j++) {
-      if (A[j][i]) {
-        pivot = j;
-        break;
-      }
+  return (row[col / 64] >> (col % 64)) & 1;
+}
+
+static inline void gf2_set(uint64_t* row, size_t col)
+{
+  row[col / 64] |= uint64_t{1} << (col % 64);
+}
+
+// Gauss-Jordan elimination over GF(2) of the n x n system packed in A, which is trashed. Adding
+// the pivot row to another is a run of word XORs from the word of the pivot column on, and the rows
+// are updated in parallel. The solution is returned in x when it is unique
+template <typename time_limit_reached_t>
+static gf2_status_t gf2_solve(std::vector<uint64_t>& A,
+                              size_t n,
+                              std::vector<int>& x,
+                              time_limit_reached_t time_limit_reached)
+{
+  const size_t n_words = gf2_row_words(n);
+  size_t rank          = 0;
+  for (size_t col = 0; col < n; ++col) {
+    if (col % gf2_pivots_per_time_check == 0 && time_limit_reached()) {
+      return gf2_status_t::TIME_LIMIT;
     }
-    if (pivot == -1) return false;  // No solution
-
-    // Swap current row with pivot row if needed
-    if (pivot != i) {
-      for (k = 0; k < N; k++) {
-        int temp    = A[i][k];
-        A[i][k]     = A[pivot][k];
-        A[pivot][k] = temp;
-      }
-      int temp = b[i];
-      b[i]     = b[pivot];
-      b[pivot] = temp;
+    size_t pivot = rank;
+    while (pivot < n && !gf2_test(&A[pivot * n_words], col)) {
+      ++pivot;
+    }
+    // No pivot: col is a free variable, unless the system turns out to be inconsistent
+    if (pivot == n) { continue; }
+    if (pivot != rank) {
+      std::swap_ranges(A.begin() + pivot * n_words,
+                       A.begin() + (pivot + 1) * n_words,
+                       A.begin() + rank * n_words);
     }
 
-    // Eliminate downwards
-    for (j = i + 1; j < N; j++) {
-      if (A[j][i]) {
-        for (k = i; k < N; k++)
-          A[j][k] ^= A[i][k];
-        b[j] ^= b[i];
+    const uint64_t* pivot_row = &A[rank * n_words];
+    const size_t first_word   = col / 64;
+#pragma omp parallel for schedule(static) if (n >= gf2_parallel_rows)
+    for (size_t row = 0; row < n; ++row) {
+      uint64_t* target = &A[row * n_words];
+      if (row == rank || !gf2_test(target, col)) { continue; }
+      for (size_t w = first_word; w < n_words; ++w) {
+        target[w] ^= pivot_row[w];
       }
     }
+    ++rank;
   }
 
-  // Back-substitution
-  for (i = N - 1; i >= 0; i--) {
-    x[i] = b[i];
-    for (j = i + 1; j < N; j++)
-      x[i] ^= (A[i][j] & x[j]);
-    if (!A[i][i] && x[i]) return false;  // No solution
+  // The coefficients of the rows past the rank are all zero
+  for (size_t row = rank; row < n; ++row) {
+    if (gf2_test(&A[row * n_words], n)) { return gf2_status_t::INCONSISTENT; }
   }
-  return true;  // Success
+  if (rank < n) { return gf2_status_t::SINGULAR; }
+
+  // Full rank: the pivot of row i is column i and the matrix is the identity
+  for (size_t row = 0; row < n; ++row) {
+    x[row] = gf2_test(&A[row * n_words], n);
+  }
+  return gf2_status_t::UNIQUE;
 }
 
 template <typename f_t>
@@ -183,8 +210,7 @@ papilo::PresolveStatus GF2Presolve<f_t>::execute(const papilo::Problem<f_t>& pro
   // If no GF2 constraints found, return unchanged
   if (gf2_constraints.empty()) { return papilo::PresolveStatus::kUnchanged; }
 
-  // Skip if that would cause computational explosion (O(n^3) with simple gaussian elimination)
-  if (gf2_constraints.size() > 1000) { return papilo::PresolveStatus::kUnchanged; }
+  if (gf2_constraints.size() > max_gf2_constraints) { return papilo::PresolveStatus::kUnchanged; }
 
   // Validate structure
   if (gf2_key_vars.size() != gf2_constraints.size() ||
@@ -198,21 +224,24 @@ papilo::PresolveStatus GF2Presolve<f_t>::execute(const papilo::Problem<f_t>& pro
     gf2_bin_vars_invmap.insert({gf2_idx, var_idx});
   }
 
-  // Build binary matrix
-  // Could be a flat vector but. oh well. in practice N is small
-  std::vector<std::vector<int>> A(gf2_constraints.size(),
-                                  std::vector<int>(gf2_constraints.size(), 0));
-  std::vector<int> b(gf2_constraints.size());
-  for (const auto& cons : gf2_constraints) {
+  // Build the bit-packed augmented matrix, one row per GF2 constraint
+  const size_t n       = gf2_constraints.size();
+  const size_t n_words = gf2_row_words(n);
+  std::vector<uint64_t> A(n * n_words, 0);
+  for (size_t row = 0; row < n; ++row) {
+    const auto& cons = gf2_constraints[row];
     for (auto [bin_var, _] : cons.bin_vars) {
-      A[cons.cstr_idx][gf2_bin_vars[bin_var]] = 1;
+      gf2_set(&A[row * n_words], gf2_bin_vars[bin_var]);
     }
-    b[cons.cstr_idx] = cons.rhs;
+    if (cons.rhs) { gf2_set(&A[row * n_words], n); }
   }
 
-  std::vector<int> solution(gf2_constraints.size());
-  bool feasible = gf2_solve(A, b, solution);
-  if (!feasible) { return papilo::PresolveStatus::kInfeasible; }
+  const double time_limit = problemUpdate.getPresolveOptions().tlim;
+  std::vector<int> solution(n);
+  auto gf2_status = gf2_solve(A, n, solution, [&]() { return timer.getTime() >= time_limit; });
+  if (gf2_status == gf2_status_t::INCONSISTENT) { return papilo::PresolveStatus::kInfeasible; }
+  // Without a unique solution no variable can be fixed
+  if (gf2_status != gf2_status_t::UNIQUE) { return papilo::PresolveStatus::kUnchanged; }
 
   std::unordered_map<size_t, f_t> fixings;
   // Fix binary variables
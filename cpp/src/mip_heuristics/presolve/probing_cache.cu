@@ -15,10 +15,18 @@
 
 #include <omp.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/sort.h>
+#include <utilities/binary_file_io.hpp>
 #include <utilities/copy_helpers.hpp>
 #include <utilities/timer.hpp>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
 namespace cuopt::linear_programming::detail {
 
 template <typename i_t, typename f_t>
@@ -148,35 +156,70 @@ bool probing_cache_t<i_t, f_t>::contains(problem_t<i_t, f_t>& problem, i_t var_i
   return probing_cache.count(problem.original_ids[var_id]) > 0;
 }
 
+// Copies to the host the integer variables whose bounds were changed by a probe, along with their
+// new bounds. The comparison runs on the device, so only the implications of the probe are copied
+template <typename i_t, typename f_t>
+void get_changed_integer_bounds(problem_t<i_t, f_t>& problem,
+                                const rmm::device_uvector<f_t>& d_lb,
+                                const rmm::device_uvector<f_t>& d_ub,
+                                std::vector<i_t>& changed_vars,
+                                std::vector<f_t>& changed_lb,
+                                std::vector<f_t>& changed_ub,
+                                const raft::handle_t* handle_ptr)
+{
+  auto stream = handle_ptr->get_stream();
+  rmm::device_uvector<i_t> d_changed_vars(problem.integer_indices.size(), stream);
+  auto end = thrust::copy_if(
+    handle_ptr->get_thrust_policy(),
+    problem.integer_indices.begin(),
+    problem.integer_indices.end(),
+    d_changed_vars.begin(),
+    [pb = problem.view(), lb = d_lb.data(), ub = d_ub.data()] __device__(i_t var_idx) -> bool {
+      auto bounds = pb.variable_bounds[var_idx];
+      return get_lower(bounds) != lb[var_idx] || get_upper(bounds) != ub[var_idx];
+    });
+  d_changed_vars.resize(end - d_changed_vars.begin(), stream);
+  rmm::device_uvector<f_t> d_changed_lb(d_changed_vars.size(), stream);
+  rmm::device_uvector<f_t> d_changed_ub(d_changed_vars.size(), stream);
+  thrust::gather(handle_ptr->get_thrust_policy(),
+                 d_changed_vars.begin(),
+                 d_changed_vars.end(),
+                 d_lb.begin(),
+                 d_changed_lb.begin());
+  thrust::gather(handle_ptr->get_thrust_policy(),
+                 d_changed_vars.begin(),
+                 d_changed_vars.end(),
+                 d_ub.begin(),
+                 d_changed_ub.begin());
+  changed_vars = host_copy(d_changed_vars, stream);
+  changed_lb   = host_copy(d_changed_lb, stream);
+  changed_ub   = host_copy(d_changed_ub, stream);
+}
+
 template <typename i_t, typename f_t, typename f_t2>
 void inline insert_current_probing_to_cache(i_t var_idx,
                                             const val_interval_t<i_t, f_t>& probe_val,
                                             bound_presolve_t<i_t, f_t>& bound_presolve,
                                             const std::vector<f_t2>& original_bounds,
-                                            const std::vector<f_t>& modified_lb,
-                                            const std::vector<f_t>& modified_ub,
-                                            const std::vector<i_t>& h_integer_indices,
+                                            const std::vector<i_t>& changed_vars,
+                                            const std::vector<f_t>& changed_lb,
+                                            const std::vector<f_t>& changed_ub,
                                             std::atomic<size_t>& n_implied_singletons)
 {
   f_t int_tol = bound_presolve.context.settings.tolerances.integrality_tolerance;
 
   cache_entry_t<i_t, f_t> cache_item;
   cache_item.val_interval = probe_val;
-  for (auto impacted_var_idx : h_integer_indices) {
+  for (size_t k = 0; k < changed_vars.size(); ++k) {
+    i_t impacted_var_idx     = changed_vars[k];
     auto original_var_bounds = original_bounds[impacted_var_idx];
-    if (get_lower(original_var_bounds) != modified_lb[impacted_var_idx] ||
-        get_upper(original_var_bounds) != modified_ub[impacted_var_idx]) {
-      if (integer_equal<f_t>(
-            modified_lb[impacted_var_idx], modified_ub[impacted_var_idx], int_tol)) {
-        ++n_implied_singletons;
-      }
-      cuopt_assert(modified_lb[impacted_var_idx] >= get_lower(original_var_bounds),
-                   "Lower bound must be greater than or equal to original lower bound");
-      cuopt_assert(modified_ub[impacted_var_idx] <= get_upper(original_var_bounds),
-                   "Upper bound must be less than or equal to original upper bound");
-      cached_bound_t<f_t> new_bound{modified_lb[impacted_var_idx], modified_ub[impacted_var_idx]};
-      cache_item.var_to_cached_bound_map.insert({impacted_var_idx, new_bound});
-    }
+    if (integer_equal<f_t>(changed_lb[k], changed_ub[k], int_tol)) { ++n_implied_singletons; }
+    cuopt_assert(changed_lb[k] >= get_lower(original_var_bounds),
+                 "Lower bound must be greater than or equal to original lower bound");
+    cuopt_assert(changed_ub[k] <= get_upper(original_var_bounds),
+                 "Upper bound must be less than or equal to original upper bound");
+    cached_bound_t<f_t> new_bound{changed_lb[k], changed_ub[k]};
+    cache_item.var_to_cached_bound_map.insert({impacted_var_idx, new_bound});
   }
   {
     std::lock_guard<std::mutex> lock(bound_presolve.probing_cache.probing_cache_mutex);
@@ -360,7 +403,6 @@ void compute_cache_for_var(i_t var_idx,
                            problem_t<i_t, f_t>& problem,
                            multi_probe_t<i_t, f_t>& multi_probe_presolve,
                            const std::vector<f_t2>& h_var_bounds,
-                           const std::vector<i_t>& h_integer_indices,
                            std::atomic<size_t>& n_of_implied_singletons,
                            std::atomic<size_t>& n_of_cached_probings,
                            std::atomic<bool>& problem_is_infeasible,
@@ -372,10 +414,9 @@ void compute_cache_for_var(i_t var_idx,
   RAFT_CUDA_TRY(cudaSetDevice(device_id));
   // test if we need per thread handle
   raft::handle_t handle{};
-  std::vector<f_t> h_improved_lower_bounds_0(h_var_bounds.size());
-  std::vector<f_t> h_improved_upper_bounds_0(h_var_bounds.size());
-  std::vector<f_t> h_improved_lower_bounds_1(h_var_bounds.size());
-  std::vector<f_t> h_improved_upper_bounds_1(h_var_bounds.size());
+  std::vector<i_t> h_changed_vars;
+  std::vector<f_t> h_changed_lb;
+  std::vector<f_t> h_changed_ub;
   std::pair<val_interval_t<i_t, f_t>, val_interval_t<i_t, f_t>> probe_vals;
   auto bounds = h_var_bounds[var_idx];
   f_t lb      = get_lower(bounds);
@@ -445,8 +486,6 @@ void compute_cache_for_var(i_t var_idx,
     i_t infeas_constraints_count  = i == 0 ? multi_probe_presolve.infeas_constraints_count_0
                                            : multi_probe_presolve.infeas_constraints_count_1;
     const auto& probe_val         = i == 0 ? probe_vals.first : probe_vals.second;
-    auto& h_improved_lower_bounds = i == 0 ? h_improved_lower_bounds_0 : h_improved_lower_bounds_1;
-    auto& h_improved_upper_bounds = i == 0 ? h_improved_upper_bounds_0 : h_improved_upper_bounds_1;
     if (infeas_constraints_count > 0) {
       CUOPT_LOG_TRACE("Var %d is infeasible for probe %d on value %f. Fixing other interval",
                       var_idx,
@@ -476,31 +515,68 @@ void compute_cache_for_var(i_t var_idx,
       valid_host_bounds++;
       auto& d_lb = i == 0 ? multi_probe_presolve.upd_0.lb : multi_probe_presolve.upd_1.lb;
       auto& d_ub = i == 0 ? multi_probe_presolve.upd_0.ub : multi_probe_presolve.upd_1.ub;
-      raft::copy(h_improved_lower_bounds.data(),
-                 d_lb.data(),
-                 h_improved_lower_bounds.size(),
-                 handle.get_stream());
-      raft::copy(h_improved_upper_bounds.data(),
-                 d_ub.data(),
-                 h_improved_upper_bounds.size(),
-                 handle.get_stream());
+      get_changed_integer_bounds(
+        problem, d_lb, d_ub, h_changed_vars, h_changed_lb, h_changed_ub, &handle);
       insert_current_probing_to_cache(var_idx,
                                       probe_val,
                                       bound_presolve,
                                       h_var_bounds,
-                                      h_improved_lower_bounds,
-                                      h_improved_upper_bounds,
-                                      h_integer_indices,
+                                      h_changed_vars,
+                                      h_changed_lb,
+                                      h_changed_ub,
                                       n_of_implied_singletons);
     }
   }
   // when both probes are feasible, we can infer some global bounds
   if (n_of_infeasible_probings == 0 && valid_host_bounds == 2) {
-    // TODO do the check in parallel
-    for (size_t i = 0; i < h_improved_lower_bounds_0.size(); i++) {
-      if (i == (size_t)var_idx) { continue; }
-      f_t lower_bound = min(h_improved_lower_bounds_0[i], h_improved_lower_bounds_1[i]);
-      f_t upper_bound = max(h_improved_upper_bounds_0[i], h_improved_upper_bounds_1[i]);
+    // select on the device the variables whose bounds hold in both probes or that can be
+    // substituted by var_idx, then only these are copied and checked on the host
+    f_t int_tol       = bound_presolve.context.settings.tolerances.integrality_tolerance;
+    auto stream       = handle.get_stream();
+    const auto& upd_0 = multi_probe_presolve.upd_0;
+    const auto& upd_1 = multi_probe_presolve.upd_1;
+    rmm::device_uvector<i_t> d_selected_vars(problem.n_variables, stream);
+    auto end = thrust::copy_if(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator<i_t>(0),
+      thrust::make_counting_iterator<i_t>(problem.n_variables),
+      d_selected_vars.begin(),
+      [pb   = problem.view(),
+       lb_0 = upd_0.lb.data(),
+       ub_0 = upd_0.ub.data(),
+       lb_1 = upd_1.lb.data(),
+       ub_1 = upd_1.ub.data(),
+       var_idx,
+       is_binary,
+       int_tol] __device__(i_t i) -> bool {
+        if (i == var_idx) { return false; }
+        auto bounds = pb.variable_bounds[i];
+        f_t lower_bound = min(lb_0[i], lb_1[i]);
+        f_t upper_bound = max(ub_0[i], ub_1[i]);
+        if (get_lower(bounds) < lower_bound || get_upper(bounds) > upper_bound) { return true; }
+        return is_binary && integer_equal<f_t>(lb_0[i], ub_0[i], int_tol) &&
+               integer_equal<f_t>(lb_1[i], ub_1[i], int_tol) &&
+               !integer_equal<f_t>(lb_0[i], lb_1[i], int_tol);
+      });
+    d_selected_vars.resize(end - d_selected_vars.begin(), stream);
+    auto gather_to_host = [&](const rmm::device_uvector<f_t>& values) {
+      rmm::device_uvector<f_t> selected_values(d_selected_vars.size(), stream);
+      thrust::gather(handle.get_thrust_policy(),
+                     d_selected_vars.begin(),
+                     d_selected_vars.end(),
+                     values.begin(),
+                     selected_values.begin());
+      return host_copy(selected_values, stream);
+    };
+    auto h_selected_vars           = host_copy(d_selected_vars, stream);
+    auto h_improved_lower_bounds_0 = gather_to_host(upd_0.lb);
+    auto h_improved_upper_bounds_0 = gather_to_host(upd_0.ub);
+    auto h_improved_lower_bounds_1 = gather_to_host(upd_1.lb);
+    auto h_improved_upper_bounds_1 = gather_to_host(upd_1.ub);
+    for (size_t k = 0; k < h_selected_vars.size(); k++) {
+      i_t i           = h_selected_vars[k];
+      f_t lower_bound = min(h_improved_lower_bounds_0[k], h_improved_lower_bounds_1[k]);
+      f_t upper_bound = max(h_improved_upper_bounds_0[k], h_improved_upper_bounds_1[k]);
       cuopt_assert(h_var_bounds[i].x <= lower_bound, "lower bound violation");
       cuopt_assert(h_var_bounds[i].y >= upper_bound, "upper bound violation");
       // check why we might have invalid lower and upper bound here
@@ -514,13 +590,12 @@ void compute_cache_for_var(i_t var_idx,
           h_var_bounds[i].x,
           h_var_bounds[i].y);
       }
-      f_t int_tol = bound_presolve.context.settings.tolerances.integrality_tolerance;
-      if (integer_equal<f_t>(h_improved_lower_bounds_0[i], h_improved_upper_bounds_0[i], int_tol) &&
-          integer_equal<f_t>(h_improved_lower_bounds_1[i], h_improved_upper_bounds_1[i], int_tol) &&
+      if (integer_equal<f_t>(h_improved_lower_bounds_0[k], h_improved_upper_bounds_0[k], int_tol) &&
+          integer_equal<f_t>(h_improved_lower_bounds_1[k], h_improved_upper_bounds_1[k], int_tol) &&
           is_binary) {
         // == case has been handled as fixing by the global bounds update
         if (!integer_equal<f_t>(
-              h_improved_lower_bounds_0[i], h_improved_lower_bounds_1[i], int_tol)) {
+              h_improved_lower_bounds_0[k], h_improved_lower_bounds_1[k], int_tol)) {
           // trivial presolve handles eliminations
           // x_i = l_0 + (l_1 - l_0) * x_var_idx
           // this means
@@ -529,8 +604,8 @@ void compute_cache_for_var(i_t var_idx,
           substitution.timestamp        = timer.elapsed_time();
           substitution.substituted_var  = i;
           substitution.substituting_var = var_idx;
-          substitution.offset           = h_improved_lower_bounds_0[i];
-          substitution.coefficient = h_improved_lower_bounds_1[i] - h_improved_lower_bounds_0[i];
+          substitution.offset           = h_improved_lower_bounds_0[k];
+          substitution.coefficient = h_improved_lower_bounds_1[k] - h_improved_lower_bounds_0[k];
           substitution_vector.emplace_back(substitution);
         }
       }
@@ -839,18 +914,202 @@ std::vector<i_t> compute_priority_indices_by_implied_integers(problem_t<i_t, f_t
   return h_priority_indices;
 }
 
+namespace {
+
+constexpr char probing_result_magic[8]    = {'C', 'U', 'O', 'P', 'T', 'P', 'C', '\0'};
+constexpr uint32_t probing_result_version = 1;
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+bool probing_result_t<i_t, f_t>::write(const std::string& filename,
+                                       const probing_cache_t<i_t, f_t>& cache) const
+{
+  std::vector<f_t> modification_times;
+  std::vector<i_t> modification_vars;
+  std::vector<f_t> modification_lb;
+  std::vector<f_t> modification_ub;
+  for (const auto& [time, var_idx, lb, ub] : modifications) {
+    modification_times.push_back(time);
+    modification_vars.push_back(var_idx);
+    modification_lb.push_back(lb);
+    modification_ub.push_back(ub);
+  }
+  // two entries per probed variable, each followed by the number of bounds it implies
+  std::vector<i_t> probed_vars;
+  std::vector<f_t> interval_vals;
+  std::vector<i_t> interval_types;
+  std::vector<i_t> n_implied_bounds;
+  std::vector<i_t> implied_vars;
+  std::vector<f_t> implied_lb;
+  std::vector<f_t> implied_ub;
+  for (const auto& [var_idx, entries] : cache.probing_cache) {
+    probed_vars.push_back(var_idx);
+    for (const auto& entry : entries) {
+      interval_vals.push_back(entry.val_interval.val);
+      interval_types.push_back(entry.val_interval.interval_type);
+      n_implied_bounds.push_back(entry.var_to_cached_bound_map.size());
+      for (const auto& [implied_var, bound] : entry.var_to_cached_bound_map) {
+        implied_vars.push_back(implied_var);
+        implied_lb.push_back(bound.lb);
+        implied_ub.push_back(bound.ub);
+      }
+    }
+  }
+
+  const std::string temp_filename = filename + ".tmp";
+  std::FILE* file                 = std::fopen(temp_filename.c_str(), "wb");
+  if (file == nullptr) { return false; }
+
+  const uint32_t type_sizes[2] = {sizeof(i_t), sizeof(f_t)};
+  const uint8_t infeasible     = problem_is_infeasible;
+  bool ok = write_values(file, probing_result_magic, sizeof(probing_result_magic)) &&
+            write_values(file, &probing_result_version, 1) && write_values(file, type_sizes, 2) &&
+            write_values(file, &problem_fingerprint, 1) && write_values(file, &infeasible, 1) &&
+            write_vector(file, modification_times) && write_vector(file, modification_vars) &&
+            write_vector(file, modification_lb) && write_vector(file, modification_ub) &&
+            write_vector(file, substitutions) && write_vector(file, probed_vars) &&
+            write_vector(file, interval_vals) && write_vector(file, interval_types) &&
+            write_vector(file, n_implied_bounds) && write_vector(file, implied_vars) &&
+            write_vector(file, implied_lb) && write_vector(file, implied_ub);
+
+  ok = (std::fclose(file) == 0) && ok;
+  if (ok) { ok = std::rename(temp_filename.c_str(), filename.c_str()) == 0; }
+  if (!ok) { std::remove(temp_filename.c_str()); }
+  return ok;
+}
+
+template <typename i_t, typename f_t>
+bool probing_result_t<i_t, f_t>::read(const std::string& filename,
+                                      uint32_t fingerprint,
+                                      i_t n_variables,
+                                      probing_cache_t<i_t, f_t>& cache)
+{
+  std::FILE* file = std::fopen(filename.c_str(), "rb");
+  if (file == nullptr) { return false; }
+  const int64_t file_size = get_file_size(file);
+
+  char magic[sizeof(probing_result_magic)];
+  uint32_t version       = 0;
+  uint32_t type_sizes[2] = {0, 0};
+  uint8_t infeasible     = 0;
+  std::vector<f_t> modification_times;
+  std::vector<i_t> modification_vars;
+  std::vector<f_t> modification_lb;
+  std::vector<f_t> modification_ub;
+  std::vector<i_t> probed_vars;
+  std::vector<f_t> interval_vals;
+  std::vector<i_t> interval_types;
+  std::vector<i_t> n_implied_bounds;
+  std::vector<i_t> implied_vars;
+  std::vector<f_t> implied_lb;
+  std::vector<f_t> implied_ub;
+  bool ok = read_values(file, magic, sizeof(magic)) &&
+            std::memcmp(magic, probing_result_magic, sizeof(magic)) == 0 &&
+            read_values(file, &version, 1) && version == probing_result_version &&
+            read_values(file, type_sizes, 2) && type_sizes[0] == sizeof(i_t) &&
+            type_sizes[1] == sizeof(f_t) && read_values(file, &problem_fingerprint, 1) &&
+            problem_fingerprint == fingerprint && read_values(file, &infeasible, 1) &&
+            read_vector(file, file_size, modification_times) &&
+            read_vector(file, file_size, modification_vars) &&
+            read_vector(file, file_size, modification_lb) &&
+            read_vector(file, file_size, modification_ub) &&
+            read_vector(file, file_size, substitutions) &&
+            read_vector(file, file_size, probed_vars) &&
+            read_vector(file, file_size, interval_vals) &&
+            read_vector(file, file_size, interval_types) &&
+            read_vector(file, file_size, n_implied_bounds) &&
+            read_vector(file, file_size, implied_vars) &&
+            read_vector(file, file_size, implied_lb) && read_vector(file, file_size, implied_ub);
+  std::fclose(file);
+
+  // the indices are used to address the problem, so the file is rejected if any is out of range
+  auto in_range = [n_variables](i_t var_idx) { return var_idx >= 0 && var_idx < n_variables; };
+  const size_t n_modifications = modification_vars.size();
+  ok = ok && modification_times.size() == n_modifications &&
+       modification_lb.size() == n_modifications && modification_ub.size() == n_modifications &&
+       std::all_of(modification_vars.begin(), modification_vars.end(), in_range);
+  ok = ok && std::all_of(substitutions.begin(), substitutions.end(), [&](const auto& sub) {
+         return in_range(sub.substituted_var) && in_range(sub.substituting_var);
+       });
+  const size_t n_entries = 2 * probed_vars.size();
+  ok = ok && interval_vals.size() == n_entries && interval_types.size() == n_entries &&
+       n_implied_bounds.size() == n_entries &&
+       std::all_of(probed_vars.begin(), probed_vars.end(), in_range) &&
+       implied_lb.size() == implied_vars.size() && implied_ub.size() == implied_vars.size() &&
+       std::all_of(implied_vars.begin(), implied_vars.end(), in_range);
+  size_t n_implied_total = 0;
+  for (size_t k = 0; ok && k < n_entries; ++k) {
+    ok = n_implied_bounds[k] >= 0;
+    n_implied_total += n_implied_bounds[k];
+  }
+  ok = ok && n_implied_total == implied_vars.size();
+  if (!ok) {
+    substitutions.clear();
+    return false;
+  }
+
+  problem_is_infeasible = infeasible != 0;
+  modifications.clear();
+  for (size_t k = 0; k < n_modifications; ++k) {
+    modifications.emplace_back(
+      modification_times[k], modification_vars[k], modification_lb[k], modification_ub[k]);
+  }
+  std::unordered_map<i_t, std::array<cache_entry_t<i_t, f_t>, 2>> probing_cache;
+  size_t entry_idx = 0;
+  size_t bound_idx = 0;
+  for (i_t var_idx : probed_vars) {
+    auto& entries = probing_cache[var_idx];
+    for (auto& entry : entries) {
+      entry.val_interval.val           = interval_vals[entry_idx];
+      entry.val_interval.interval_type = static_cast<interval_type_t>(interval_types[entry_idx]);
+      for (i_t i = 0; i < n_implied_bounds[entry_idx]; ++i, ++bound_idx) {
+        cached_bound_t<f_t> bound{implied_lb[bound_idx], implied_ub[bound_idx]};
+        entry.var_to_cached_bound_map.insert({implied_vars[bound_idx], bound});
+      }
+      entry_idx++;
+    }
+  }
+  std::lock_guard<std::mutex> lock(cache.probing_cache_mutex);
+  cache.probing_cache = std::move(probing_cache);
+  return true;
+}
+
 template <typename i_t, typename f_t>
 bool compute_probing_cache(bound_presolve_t<i_t, f_t>& bound_presolve,
                            problem_t<i_t, f_t>& problem,
                            timer_t timer)
 {
   raft::common::nvtx::range fun_scope("compute_probing_cache");
+  // the probing of an identical problem is replayed from the presolve cache file if it has one
+  const std::string& presolve_cache_file = bound_presolve.context.settings.presolve_cache_file;
+  probing_result_t<i_t, f_t> probing_result;
+  if (!presolve_cache_file.empty()) {
+    probing_result.problem_fingerprint = problem.get_fingerprint();
+    probing_result_t<i_t, f_t> saved_result;
+    if (saved_result.read(presolve_cache_file,
+                          probing_result.problem_fingerprint,
+                          problem.n_variables,
+                          bound_presolve.probing_cache)) {
+      CUOPT_LOG_INFO("Replaying probing from %s: %lu bound changes, %lu substitutions",
+                     presolve_cache_file.c_str(),
+                     saved_result.modifications.size(),
+                     saved_result.substitutions.size());
+      if (saved_result.problem_is_infeasible) { return true; }
+      std::vector<std::vector<std::tuple<f_t, i_t, f_t, f_t>>> modification_vector_pool{
+        saved_result.modifications};
+      std::vector<std::vector<substitution_t<i_t, f_t>>> substitution_vector_pool{
+        saved_result.substitutions};
+      apply_modification_queue_to_problem(modification_vector_pool, problem);
+      apply_substitution_queue_to_problem(substitution_vector_pool, problem);
+      return false;
+    }
+  }
   // we dont want to compute the probing cache for all variables for time and computation resources
   auto priority_indices = compute_priority_indices_by_implied_integers(problem);
   CUOPT_LOG_DEBUG("Computing probing cache");
-  auto stream            = problem.handle_ptr->get_stream();
-  auto h_integer_indices = host_copy(problem.integer_indices, stream);
-  auto h_var_bounds      = host_copy(problem.variable_bounds, stream);
+  auto stream       = problem.handle_ptr->get_stream();
+  auto h_var_bounds = host_copy(problem.variable_bounds, stream);
   // TODO adjust the iteration limit depending on the total time limit and time it takes for single
   // var
   bound_presolve.settings.iteration_limit = 50;
@@ -903,7 +1162,6 @@ bool compute_probing_cache(bound_presolve_t<i_t, f_t>& bound_presolve,
                                         problem,
                                         multi_probe_presolve,
                                         h_var_bounds,
-                                        h_integer_indices,
                                         n_of_implied_singletons,
                                         n_of_cached_probings,
                                         problem_is_infeasible,
@@ -931,10 +1189,27 @@ bool compute_probing_cache(bound_presolve_t<i_t, f_t>& bound_presolve,
       last_it_implied_singletons = n_of_implied_singletons;
     }
   }  // end of step
+  if (!presolve_cache_file.empty()) {
+    probing_result.problem_is_infeasible = problem_is_infeasible.load();
+    for (const auto& modification_vector : modification_vector_pool) {
+      probing_result.modifications.insert(probing_result.modifications.end(),
+                                          modification_vector.begin(),
+                                          modification_vector.end());
+    }
+    for (const auto& substitution_vector : substitution_vector_pool) {
+      probing_result.substitutions.insert(probing_result.substitutions.end(),
+                                          substitution_vector.begin(),
+                                          substitution_vector.end());
+    }
+  }
   apply_substitution_queue_to_problem(substitution_vector_pool, problem);
   CUOPT_LOG_DEBUG("Total number of cached probings %lu number of implied singletons %lu",
                   n_of_cached_probings.load(),
                   n_of_implied_singletons.load());
+  if (!presolve_cache_file.empty() &&
+      !probing_result.write(presolve_cache_file, bound_presolve.probing_cache)) {
+    CUOPT_LOG_WARN("Could not write the presolve cache file %s", presolve_cache_file.c_str());
+  }
   // restore the settings
   bound_presolve.settings = {};
   return problem_is_infeasible.load();
@@ -944,7 +1219,8 @@ bool compute_probing_cache(bound_presolve_t<i_t, f_t>& bound_presolve,
   template bool compute_probing_cache<int, F_TYPE>(bound_presolve_t<int, F_TYPE> & bound_presolve, \
                                                    problem_t<int, F_TYPE> & problem,               \
                                                    timer_t timer);                                 \
-  template class probing_cache_t<int, F_TYPE>;
+  template class probing_cache_t<int, F_TYPE>;                                                     \
+  template struct probing_result_t<int, F_TYPE>;
 
 #if MIP_INSTANTIATE_FLOAT
 INSTANTIATE(float)
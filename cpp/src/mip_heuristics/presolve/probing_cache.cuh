@@ -13,6 +13,10 @@
 
 #include <utilities/timer.hpp>
 
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace cuopt::linear_programming::detail {
 
 template <typename i_t, typename f_t>
@@ -114,6 +118,29 @@ class lb_probing_cache_t {
   std::unordered_map<i_t, std::array<cache_entry_t<i_t, f_t>, 2>> probing_cache;
 };
 
+// What compute_probing_cache found on a problem, saved to the presolve cache file so that a later
+// solve of the same problem replays it instead of probing again. The probing cache itself is
+// saved along with it
+template <typename i_t, typename f_t>
+struct probing_result_t {
+  uint32_t problem_fingerprint{0};
+  bool problem_is_infeasible{false};
+  // global bound changes as (time, var, lb, ub), applied as in apply_modification_queue_to_problem
+  std::vector<std::tuple<f_t, i_t, f_t, f_t>> modifications;
+  std::vector<substitution_t<i_t, f_t>> substitutions;
+
+  // Writes to a temporary file renamed over filename. Returns false if the file could not be
+  // written
+  bool write(const std::string& filename, const probing_cache_t<i_t, f_t>& cache) const;
+
+  // Returns false if the file does not exist, is not valid, or was saved for a problem with a
+  // different fingerprint. The cache is only filled on success
+  bool read(const std::string& filename,
+            uint32_t fingerprint,
+            i_t n_variables,
+            probing_cache_t<i_t, f_t>& cache);
+};
+
 template <typename i_t, typename f_t>
 bool compute_probing_cache(bound_presolve_t<i_t, f_t>& bound_presolve,
                            problem_t<i_t, f_t>& problem,
@@ -20,6 +20,7 @@
 #pragma GCC diagnostic pop
 #endif
 #include <mip_heuristics/mip_constants.hpp>
+#include <mip_heuristics/presolve/device_postsolve.hpp>
 #include <mip_heuristics/presolve/gf2_presolve.hpp>
 #include <mip_heuristics/presolve/third_party_presolve.hpp>
 #include <utilities/logger.hpp>
@@ -568,6 +569,50 @@ void set_presolve_parameters(papilo::Presolve<f_t>& presolver,
   }
 }
 
+// Device plan of a primal postsolve made of fixed columns and column substitutions, null when the
+// storage has other reductions
+template <typename i_t, typename f_t>
+std::unique_ptr<device_primal_postsolve_t<i_t, f_t>> build_device_postsolve(
+  const papilo::PostsolveStorage<f_t>& storage, rmm::cuda_stream_view stream)
+{
+  if (storage.postsolveType != papilo::PostsolveType::kPrimal) { return nullptr; }
+  auto plan = std::make_unique<device_primal_postsolve_t<i_t, f_t>>(
+    storage.nColsOriginal,
+    std::vector<i_t>(storage.origcol_mapping.begin(), storage.origcol_mapping.end()));
+  std::vector<i_t> cols;
+  std::vector<f_t> coefs;
+  for (size_t k = 0; k < storage.types.size(); ++k) {
+    const int first = storage.start[k];
+    const int last  = storage.start[k + 1];
+    switch (storage.types[k]) {
+      case papilo::ReductionType::kFixedCol:
+        plan->add_fixed_column(storage.indices[first], storage.values[first]);
+        break;
+      case papilo::ReductionType::kSubstitutedCol: {
+        // column and side, then the entries of the equation, the column included
+        const int col = storage.indices[first];
+        f_t col_coef  = 0;
+        cols.clear();
+        coefs.clear();
+        for (int j = first + 1; j < last; ++j) {
+          if (storage.indices[j] == col) {
+            col_coef = storage.values[j];
+          } else {
+            cols.push_back(storage.indices[j]);
+            coefs.push_back(storage.values[j]);
+          }
+        }
+        if (col_coef == 0) { return nullptr; }
+        plan->add_substitution(col, storage.values[first], col_coef, cols, coefs);
+        break;
+      }
+      default: return nullptr;
+    }
+  }
+  if (!plan->finalize(stream)) { return nullptr; }
+  return plan;
+}
+
 template <typename i_t, typename f_t>
 std::optional<third_party_presolve_result_t<i_t, f_t>> third_party_presolve_t<i_t, f_t>::apply_pslp(
   optimization_problem_t<i_t, f_t> const& op_problem, const double time_limit)
@@ -646,6 +691,12 @@ std::optional<third_party_presolve_result_t<i_t, f_t>> third_party_presolve_t<i_
     return std::nullopt;
   }
   papilo_post_solve_storage_.reset(new papilo::PostsolveStorage<f_t>(result.postsolve));
+  device_postsolve_ = build_device_postsolve<i_t, f_t>(*papilo_post_solve_storage_,
+                                                       op_problem.get_handle_ptr()->get_stream());
+  if (device_postsolve_ != nullptr) {
+    CUOPT_LOG_DEBUG("Papilo postsolve runs on the device in %d levels",
+                    device_postsolve_->num_levels());
+  }
   CUOPT_LOG_INFO("Presolve removed: %d constraints, %d variables, %d nonzeros",
                  op_problem.get_n_constraints() - papilo_problem.getNRows(),
                  op_problem.get_n_variables() - papilo_problem.getNCols(),
@@ -697,6 +748,13 @@ void third_party_presolve_t<i_t, f_t>::undo(rmm::device_uvector<f_t>& primal_sol
   }
 
   if (status_to_skip) { return; }
+  // The MIP solutions have no duals, the primal is uncrushed without leaving the device
+  if (category == problem_category_t::MIP && device_postsolve_ != nullptr) {
+    rmm::device_uvector<f_t> full_primal(0, stream_view);
+    device_postsolve_->undo(primal_solution.data(), full_primal, stream_view);
+    primal_solution = std::move(full_primal);
+    return;
+  }
   std::vector<f_t> primal_sol_vec_h(primal_solution.size());
   raft::copy(primal_sol_vec_h.data(), primal_solution.data(), primal_solution.size(), stream_view);
   std::vector<f_t> dual_sol_vec_h(dual_solution.size());
@@ -782,6 +840,76 @@ void third_party_presolve_t<i_t, f_t>::uncrush_primal_solution(
   full_primal = std::move(full_sol.primal);
 }
 
+template <typename i_t, typename f_t>
+void third_party_presolve_t<i_t, f_t>::uncrush_primal_solution(
+  rmm::device_uvector<f_t>& assignment, rmm::cuda_stream_view stream_view) const
+{
+  if (device_postsolve_ != nullptr) {
+    rmm::device_uvector<f_t> full_assignment(0, stream_view);
+    device_postsolve_->undo(assignment.data(), full_assignment, stream_view);
+    assignment = std::move(full_assignment);
+    return;
+  }
+  std::vector<f_t> h_assignment(assignment.size());
+  raft::copy(h_assignment.data(), assignment.data(), assignment.size(), stream_view);
+  stream_view.synchronize();
+  std::vector<f_t> full_assignment;
+  uncrush_primal_solution(h_assignment, full_assignment);
+  assignment.resize(full_assignment.size(), stream_view);
+  raft::copy(assignment.data(), full_assignment.data(), full_assignment.size(), stream_view);
+  stream_view.synchronize();
+}
+
+template <typename i_t, typename f_t>
+void third_party_presolve_t<i_t, f_t>::crush_primal_solution(const std::vector<f_t>& full_primal,
+                                                             std::vector<f_t>& reduced_primal) const
+{
+  reduced_primal.resize(reduced_to_original_map_.size());
+  for (size_t i = 0; i < reduced_to_original_map_.size(); ++i) {
+    cuopt_assert(reduced_to_original_map_[i] < (i_t)full_primal.size(), "Invalid variable map");
+    reduced_primal[i] = full_primal[reduced_to_original_map_[i]];
+  }
+}
+
+template <typename i_t, typename f_t>
+double third_party_presolve_t<i_t, f_t>::estimate_reduction(
+  optimization_problem_t<i_t, f_t> const& op_problem)
+{
+  const i_t num_cols = op_problem.get_n_variables();
+  const i_t num_rows = op_problem.get_n_constraints();
+  if (num_cols + num_rows == 0) { return 0.0; }
+
+  const auto& offsets   = op_problem.get_constraint_matrix_offsets();
+  const auto& variables = op_problem.get_constraint_matrix_indices();
+  const auto& var_lb    = op_problem.get_variable_lower_bounds();
+  const auto& var_ub    = op_problem.get_variable_upper_bounds();
+  auto stream_view      = op_problem.get_handle_ptr()->get_stream();
+  std::vector<i_t> h_offsets(offsets.size());
+  raft::copy(h_offsets.data(), offsets.data(), offsets.size(), stream_view);
+  std::vector<i_t> h_variables(variables.size());
+  raft::copy(h_variables.data(), variables.data(), variables.size(), stream_view);
+  std::vector<f_t> h_var_lb(var_lb.size());
+  raft::copy(h_var_lb.data(), var_lb.data(), var_lb.size(), stream_view);
+  std::vector<f_t> h_var_ub(var_ub.size());
+  raft::copy(h_var_ub.data(), var_ub.data(), var_ub.size(), stream_view);
+  stream_view.synchronize();
+
+  i_t reducible = 0;
+  for (i_t i = 0; i + 1 < static_cast<i_t>(h_offsets.size()); ++i) {
+    if (h_offsets[i + 1] - h_offsets[i] <= 1) { ++reducible; }
+  }
+  std::vector<char> in_rows(num_cols, 0);
+  for (i_t j : h_variables) {
+    in_rows[j] = 1;
+  }
+  for (i_t j = 0; j < num_cols; ++j) {
+    const bool fixed = j < static_cast<i_t>(h_var_lb.size()) &&
+                       j < static_cast<i_t>(h_var_ub.size()) && h_var_lb[j] == h_var_ub[j];
+    if (fixed || !in_rows[j]) { ++reducible; }
+  }
+  return static_cast<double>(reducible) / (num_cols + num_rows);
+}
+
 template <typename i_t, typename f_t>
 third_party_presolve_t<i_t, f_t>::~third_party_presolve_t()
 {
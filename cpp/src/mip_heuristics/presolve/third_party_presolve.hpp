@@ -13,6 +13,8 @@
 
 #include <cuopt/linear_programming/optimization_problem.hpp>
 
+#include <mip_heuristics/presolve/device_postsolve.hpp>
+
 #include <PSLP/PSLP_API.h>
 
 namespace papilo {
@@ -36,6 +38,10 @@ struct third_party_presolve_result_t {
   // clique info, etc...
 };
 
+// In latency mode, presolve is skipped when it is not expected to remove this fraction of the rows
+// and columns
+constexpr double latency_mode_min_presolve_reduction = 0.05;
+
 template <typename i_t, typename f_t>
 class third_party_presolve_t {
  public:
@@ -58,6 +64,11 @@ class third_party_presolve_t {
     double time_limit,
     i_t num_cpu_threads = 0);
 
+  // Fraction of the rows and columns that the simplest reductions remove: empty and singleton
+  // rows, fixed columns and columns without nonzeros. A cheap lower estimate of what presolve
+  // removes, to decide whether it pays for itself on a small problem
+  static double estimate_reduction(optimization_problem_t<i_t, f_t> const& op_problem);
+
   void undo(rmm::device_uvector<f_t>& primal_solution,
             rmm::device_uvector<f_t>& dual_solution,
             rmm::device_uvector<f_t>& reduced_costs,
@@ -68,6 +79,14 @@ class third_party_presolve_t {
 
   void uncrush_primal_solution(const std::vector<f_t>& reduced_primal,
                                std::vector<f_t>& full_primal) const;
+  // Same on the device, the assignment only leaves the device when the postsolve has no device
+  // plan
+  void uncrush_primal_solution(rmm::device_uvector<f_t>& assignment,
+                               rmm::cuda_stream_view stream_view) const;
+  // Projects an assignment of the original problem on the variables kept by presolve. This is
+  // not the inverse of uncrush, the result may violate the constraints of the reduced problem
+  void crush_primal_solution(const std::vector<f_t>& full_primal,
+                             std::vector<f_t>& reduced_primal) const;
   const std::vector<i_t>& get_reduced_to_original_map() const { return reduced_to_original_map_; }
   const std::vector<i_t>& get_original_to_reduced_map() const { return original_to_reduced_map_; }
 
@@ -93,6 +112,8 @@ class third_party_presolve_t {
   // into any .cu context
   std::unique_ptr<papilo::PostsolveStorage<f_t>, papilo_postsolve_deleter<f_t>>
     papilo_post_solve_storage_;
+  // Primal postsolve on the device, null when the reductions need the papilo postsolve
+  std::unique_ptr<device_primal_postsolve_t<i_t, f_t>> device_postsolve_;
 
   std::vector<i_t> reduced_to_original_map_{};
   std::vector<i_t> original_to_reduced_map_{};
@@ -11,11 +11,15 @@
 namespace cuopt::linear_programming::detail {
 
 #if MIP_INSTANTIATE_FLOAT
-template void trivial_presolve(problem_t<int, float>& problem, bool remap_cache_ids);
+template void trivial_presolve(problem_t<int, float>& problem,
+                               bool remap_cache_ids,
+                               bool transpose_is_current);
 #endif
 
 #if MIP_INSTANTIATE_DOUBLE
-template void trivial_presolve(problem_t<int, double>& problem, bool remap_cache_ids);
+template void trivial_presolve(problem_t<int, double>& problem,
+                               bool remap_cache_ids,
+                               bool transpose_is_current);
 #endif
 
 }  // namespace cuopt::linear_programming::detail
@@ -103,8 +103,72 @@ void cleanup_vectors(problem_t<i_t, f_t>& pb,
   handle_ptr->sync_stream();
 }
 
+// The entries of the transpose are already ordered by variable, so removing the ones dropped
+// from the csr keeps them ordered and the transpose does not need to be sorted again
 template <typename i_t, typename f_t>
-void update_from_csr(problem_t<i_t, f_t>& pb, bool remap_cache_ids)
+void compact_transpose(problem_t<i_t, f_t>& pb,
+                       const rmm::device_uvector<i_t>& var_map,
+                       rmm::device_uvector<i_t>& cnst_renum_ids,
+                       rmm::device_uvector<i_t>& var_renum_ids,
+                       i_t nnz_edge_count)
+{
+  auto handle_ptr = pb.handle_ptr;
+  //  csc to coo
+  rmm::device_uvector<i_t> coo_variables(pb.reverse_constraints.size(), handle_ptr->get_stream());
+  thrust::uninitialized_fill(
+    handle_ptr->get_thrust_policy(), coo_variables.begin(), coo_variables.end(), 0);
+  thrust::scatter_if(handle_ptr->get_thrust_policy(),
+                     thrust::counting_iterator<i_t>(0),
+                     thrust::counting_iterator<i_t>(pb.reverse_offsets.size() - 1),
+                     pb.reverse_offsets.begin(),
+                     thrust::counting_iterator<i_t>(0),
+                     coo_variables.begin(),
+                     non_zero_degree_t{make_span(pb.reverse_offsets)});
+  thrust::inclusive_scan(handle_ptr->get_thrust_policy(),
+                         coo_variables.begin(),
+                         coo_variables.end(),
+                         coo_variables.begin(),
+                         thrust::maximum<i_t>{});
+  RAFT_CHECK_CUDA(handle_ptr->get_stream());
+
+  auto coo_begin = thrust::make_zip_iterator(thrust::make_tuple(
+    coo_variables.begin(), pb.reverse_constraints.begin(), pb.reverse_coefficients.begin()));
+  auto coo_end   = thrust::remove_if(handle_ptr->get_thrust_policy(),
+                                     coo_begin,
+                                     coo_begin + coo_variables.size(),
+                                     is_transpose_entry_removed_t<i_t>{make_span(var_map)});
+  RAFT_CHECK_CUDA(handle_ptr->get_stream());
+  cuopt_assert(coo_end - coo_begin == nnz_edge_count, "Transpose does not match the csr");
+
+  //  renumber coo
+  thrust::transform(handle_ptr->get_thrust_policy(),
+                    coo_variables.begin(),
+                    coo_variables.begin() + nnz_edge_count,
+                    coo_variables.begin(),
+                    apply_renumbering_t{make_span(var_renum_ids)});
+  thrust::transform(handle_ptr->get_thrust_policy(),
+                    pb.reverse_constraints.begin(),
+                    pb.reverse_constraints.begin() + nnz_edge_count,
+                    pb.reverse_constraints.begin(),
+                    apply_renumbering_t{make_span(cnst_renum_ids)});
+  pb.reverse_constraints.resize(nnz_edge_count, handle_ptr->get_stream());
+  pb.reverse_coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
+  pb.variables.resize(nnz_edge_count, handle_ptr->get_stream());
+  pb.coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
+
+  //  update csc offset
+  pb.reverse_offsets.resize(pb.n_variables + 1, handle_ptr->get_stream());
+  thrust::fill(
+    handle_ptr->get_thrust_policy(), pb.reverse_offsets.begin(), pb.reverse_offsets.end(), 0);
+  thrust::for_each(
+    handle_ptr->get_thrust_policy(),
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(nnz_edge_count),
+    coo_to_offset_t{make_span(coo_variables, 0, nnz_edge_count), make_span(pb.reverse_offsets)});
+}
+
+template <typename i_t, typename f_t>
+void update_from_csr(problem_t<i_t, f_t>& pb, bool remap_cache_ids, bool transpose_is_current)
 {
   using f_t2      = typename type_2<f_t>::type;
   auto handle_ptr = pb.handle_ptr;
@@ -160,6 +224,16 @@ void update_from_csr(problem_t<i_t, f_t>& pb, bool remap_cache_ids)
                   var_map.begin());
   RAFT_CHECK_CUDA(handle_ptr->get_stream());
 
+  if (pb.presolve_data.constraint_mapping.size() == static_cast<size_t>(pb.n_constraints)) {
+    auto kept_iter = thrust::stable_partition(handle_ptr->get_thrust_policy(),
+                                              pb.presolve_data.constraint_mapping.begin(),
+                                              pb.presolve_data.constraint_mapping.end(),
+                                              cnst_map.begin(),
+                                              cuda::std::identity{});
+    pb.presolve_data.constraint_mapping.resize(
+      kept_iter - pb.presolve_data.constraint_mapping.begin(), handle_ptr->get_stream());
+  }
+
   auto unused_var_count =
     thrust::count(handle_ptr->get_thrust_policy(), var_map.begin(), var_map.end(), 0);
   if (unused_var_count > 0) {
@@ -291,35 +365,41 @@ void update_from_csr(problem_t<i_t, f_t>& pb, bool remap_cache_ids)
   // clean up vectors
   cleanup_vectors(pb, cnst_map, var_map);
 
-  //  reorder coo by var
-  rmm::device_uvector<i_t> coo_variables(nnz_edge_count, handle_ptr->get_stream());
-  raft::copy(coo_variables.data(), pb.variables.data(), nnz_edge_count, handle_ptr->get_stream());
-
-  pb.reverse_constraints.resize(nnz_edge_count, handle_ptr->get_stream());
-  raft::copy(pb.reverse_constraints.data(), cnst.data(), nnz_edge_count, handle_ptr->get_stream());
+  if (transpose_is_current) {
+    compact_transpose(pb, var_map, cnst_renum_ids, var_renum_ids, nnz_edge_count);
+  } else {
+    //  reorder coo by var
+    rmm::device_uvector<i_t> coo_variables(nnz_edge_count, handle_ptr->get_stream());
+    raft::copy(
+      coo_variables.data(), pb.variables.data(), nnz_edge_count, handle_ptr->get_stream());
 
-  pb.reverse_coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
-  raft::copy(pb.reverse_coefficients.data(),
-             pb.coefficients.data(),
-             nnz_edge_count,
-             handle_ptr->get_stream());
+    pb.reverse_constraints.resize(nnz_edge_count, handle_ptr->get_stream());
+    raft::copy(
+      pb.reverse_constraints.data(), cnst.data(), nnz_edge_count, handle_ptr->get_stream());
 
-  pb.variables.resize(nnz_edge_count, handle_ptr->get_stream());
-  pb.coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
+    pb.reverse_coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
+    raft::copy(pb.reverse_coefficients.data(),
+               pb.coefficients.data(),
+               nnz_edge_count,
+               handle_ptr->get_stream());
 
-  auto coo_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(pb.reverse_constraints.begin(), pb.reverse_coefficients.begin()));
-  thrust::sort_by_key(
-    handle_ptr->get_thrust_policy(), coo_variables.begin(), coo_variables.end(), coo_begin);
+    pb.variables.resize(nnz_edge_count, handle_ptr->get_stream());
+    pb.coefficients.resize(nnz_edge_count, handle_ptr->get_stream());
 
-  //  update csc offset
-  pb.reverse_offsets.resize(pb.n_variables + 1, handle_ptr->get_stream());
-  thrust::fill(
-    handle_ptr->get_thrust_policy(), pb.reverse_offsets.begin(), pb.reverse_offsets.end(), 0);
-  thrust::for_each(handle_ptr->get_thrust_policy(),
-                   thrust::make_counting_iterator<i_t>(0),
-                   thrust::make_counting_iterator<i_t>(nnz_edge_count),
-                   coo_to_offset_t{make_span(coo_variables), make_span(pb.reverse_offsets)});
+    auto coo_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(pb.reverse_constraints.begin(), pb.reverse_coefficients.begin()));
+    thrust::sort_by_key(
+      handle_ptr->get_thrust_policy(), coo_variables.begin(), coo_variables.end(), coo_begin);
+
+    //  update csc offset
+    pb.reverse_offsets.resize(pb.n_variables + 1, handle_ptr->get_stream());
+    thrust::fill(
+      handle_ptr->get_thrust_policy(), pb.reverse_offsets.begin(), pb.reverse_offsets.end(), 0);
+    thrust::for_each(handle_ptr->get_thrust_policy(),
+                     thrust::make_counting_iterator<i_t>(0),
+                     thrust::make_counting_iterator<i_t>(nnz_edge_count),
+                     coo_to_offset_t{make_span(coo_variables), make_span(pb.reverse_offsets)});
+  }
   pb.nnz = nnz_edge_count;
 }
 
@@ -353,13 +433,17 @@ void test_reverse_matches(const problem_t<i_t, f_t>& pb)
   }
 }
 
+// transpose_is_current can be set when the transpose matches the csr, the removed entries are then
+// compacted out of it instead of sorting the remaining ones again
 template <typename i_t, typename f_t>
-void trivial_presolve(problem_t<i_t, f_t>& problem, bool remap_cache_ids = false)
+void trivial_presolve(problem_t<i_t, f_t>& problem,
+                      bool remap_cache_ids      = false,
+                      bool transpose_is_current = false)
 {
   cuopt_expects(problem.preprocess_called,
                 error_type_t::RuntimeError,
                 "preprocess_problem should be called before running the solver");
-  update_from_csr(problem, remap_cache_ids);
+  update_from_csr(problem, remap_cache_ids, transpose_is_current);
   problem.recompute_auxilliary_data(
     false);  // check problem representation later once cstr bounds are computed
   cuopt_func_call(test_reverse_matches(problem));
@@ -39,6 +39,19 @@ struct is_variable_free_t {
   }
 };
 
+// Entry of the transpose that trivial presolve removed from the csr: its coefficient is zero or
+// its variable is no longer used
+template <typename i_t>
+struct is_transpose_entry_removed_t {
+  raft::device_span<const i_t> var_map;
+  is_transpose_entry_removed_t(raft::device_span<const i_t> var_map_) : var_map(var_map_) {}
+  template <typename tuple_t>
+  __device__ bool operator()(tuple_t edge)
+  {
+    return thrust::get<2>(edge) == 0. || var_map[thrust::get<0>(edge)] == 0;
+  }
+};
+
 template <typename i_t, typename f_t, typename f_t2>
 struct assign_fixed_var_t {
   raft::device_span<i_t> is_var_used;
@@ -16,6 +16,10 @@
 
 #include <raft/core/logger.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+
 #include "load_balanced_problem.cuh"
 
 namespace cuopt::linear_programming::detail {
@@ -398,12 +402,90 @@ void load_balanced_problem_t<i_t, f_t>::set_updated_bounds(
     variable_bounds.data(), prs.vars_bnd.data(), prs.vars_bnd.size(), handle_ptr->get_stream());
 }
 
+template <typename i_t, typename f_t>
+bool load_balanced_problem_cache_t<i_t, f_t>::matches(const problem_t<i_t, f_t>& problem) const
+{
+  // the sizes guard against a problem that was move assigned in place
+  return cached != nullptr && cached_problem == &problem &&
+         cached_version == problem.structure_version && cached_n_variables == problem.n_variables &&
+         cached_n_constraints == problem.n_constraints && cached_nnz == problem.nnz;
+}
+
+template <typename i_t, typename f_t>
+std::shared_ptr<load_balanced_problem_t<i_t, f_t>> load_balanced_problem_cache_t<i_t, f_t>::get(
+  problem_t<i_t, f_t>& problem)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (matches(problem)) { return cached; }
+  raft::common::nvtx::range fun_scope("load_balanced_problem_cache_t::get");
+  // drop our reference first so that an unused old version is freed before the new one is built
+  cached.reset();
+  cached               = std::make_shared<load_balanced_problem_t<i_t, f_t>>(problem);
+  cached_problem       = &problem;
+  cached_version       = problem.structure_version;
+  cached_n_variables   = problem.n_variables;
+  cached_n_constraints = problem.n_constraints;
+  cached_nnz           = problem.nnz;
+  ++n_builds;
+  CUOPT_LOG_DEBUG("Built load balanced problem version %d, %d builds so far",
+                  cached_version,
+                  n_builds);
+  return cached;
+}
+
+template <typename i_t, typename f_t>
+bool load_balanced_problem_cache_t<i_t, f_t>::is_current(const problem_t<i_t, f_t>& problem) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return matches(problem);
+}
+
+template <typename i_t, typename f_t>
+void load_balanced_problem_cache_t<i_t, f_t>::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  cached.reset();
+  cached_problem = nullptr;
+  cached_version = -1;
+}
+
+template <typename i_t, typename f_t>
+void load_balanced_problem_t<i_t, f_t>::refresh_vertex_data()
+{
+  raft::common::nvtx::range fun_scope("refresh_vertex_data");
+  cuopt_assert(pb->n_variables == n_variables && pb->n_constraints == n_constraints,
+               "The load balanced problem is older than its problem");
+  raft::copy(variable_bounds.data(),
+             reinterpret_cast<const f_t*>(pb->variable_bounds.data()),
+             2 * n_variables,
+             handle_ptr->get_stream());
+  thrust::for_each(handle_ptr->get_thrust_policy(),
+                   thrust::make_counting_iterator(i_t{0}),
+                   thrust::make_counting_iterator(n_constraints),
+                   [reorg_ids   = make_span(cnst_reorg_ids),
+                    cnst_bounds = make_span_2(cnst_bounds_data),
+                    lb          = make_span(pb->constraint_lower_bounds),
+                    ub          = make_span(pb->constraint_upper_bounds)] __device__(i_t new_idx) {
+                     i_t idx              = reorg_ids[new_idx];
+                     cnst_bounds[new_idx] = f_t2{lb[idx], ub[idx]};
+                   });
+  thrust::gather(handle_ptr->get_thrust_policy(),
+                 vars_reorg_ids.begin(),
+                 vars_reorg_ids.end(),
+                 pb->variable_types.begin(),
+                 vars_types.begin());
+  constraint_lower_bounds = make_span(pb->constraint_lower_bounds);
+  constraint_upper_bounds = make_span(pb->constraint_upper_bounds);
+}
+
 #if MIP_INSTANTIATE_FLOAT
 template class load_balanced_problem_t<int, float>;
+template class load_balanced_problem_cache_t<int, float>;
 #endif
 
 #if MIP_INSTANTIATE_DOUBLE
 template class load_balanced_problem_t<int, double>;
+template class load_balanced_problem_cache_t<int, double>;
 #endif
 
 }  // namespace cuopt::linear_programming::detail
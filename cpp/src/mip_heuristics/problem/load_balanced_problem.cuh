@@ -28,6 +28,9 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <memory>
+#include <mutex>
+
 namespace cuopt::linear_programming::detail {
 
 template <typename i_t, typename f_t>
@@ -42,6 +45,8 @@ class load_balanced_problem_t {
   load_balanced_problem_t() = delete;
   void setup(problem_t<i_t, f_t>& problem, bool debug = false);
   void set_updated_bounds(const load_balanced_bounds_presolve_t<i_t, f_t>& prs);
+  // copy the bounds and variable types of pb again, they change without a structure change
+  void refresh_vertex_data();
 
   problem_t<i_t, f_t>* pb;
   const raft::handle_t* handle_ptr;
@@ -86,4 +91,30 @@ class load_balanced_problem_t {
   vertex_bin_t<i_t> vars_binner;
 };
 
+// Lazily builds one load balanced problem per problem structure version and shares it between the
+// load balanced consumers (bounds presolve, probing cache and constraint propagation). The
+// consumers keep a reference so an older version stays alive until the last of them refreshes.
+// The variable bounds of the shared problem are a scratch space, each consumer copies its input
+// bounds before using them.
+template <typename i_t, typename f_t>
+class load_balanced_problem_cache_t {
+ public:
+  std::shared_ptr<load_balanced_problem_t<i_t, f_t>> get(problem_t<i_t, f_t>& problem);
+  bool is_current(const problem_t<i_t, f_t>& problem) const;
+  void clear();
+
+  i_t n_builds{0};
+
+ private:
+  bool matches(const problem_t<i_t, f_t>& problem) const;
+
+  mutable std::mutex mutex;
+  std::shared_ptr<load_balanced_problem_t<i_t, f_t>> cached;
+  const problem_t<i_t, f_t>* cached_problem{nullptr};
+  i_t cached_version{-1};
+  i_t cached_n_variables{-1};
+  i_t cached_n_constraints{-1};
+  i_t cached_nnz{-1};
+};
+
 }  // namespace cuopt::linear_programming::detail
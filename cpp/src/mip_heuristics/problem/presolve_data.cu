@@ -166,7 +166,8 @@ void presolve_data_t<i_t, f_t>::post_process_solution(problem_t<i_t, f_t>& probl
   raft::common::nvtx::range fun_scope("post_process_solution");
   post_process_assignment(problem, solution.assignment);
   // this is for resizing other fields such as excess, slack so that we can compute the feasibility
-  solution.resize_to_original_problem();
+  // solution_t, as the rest of MIP, only has 32-bit indices
+  if constexpr (std::is_same_v<i_t, int>) { solution.resize_to_original_problem(); }
   problem.handle_ptr->sync_stream();
   solution.post_process_completed = true;
 }
@@ -234,14 +235,11 @@ void presolve_data_t<i_t, f_t>::papilo_uncrush_assignment(
   }
   cuopt_assert(assignment.size() == papilo_reduced_to_original_map.size(),
                "Papilo uncrush assignment size mismatch");
-  auto h_assignment = cuopt::host_copy(assignment, problem.handle_ptr->get_stream());
-  std::vector<f_t> full_assignment;
-  papilo_presolve_ptr->uncrush_primal_solution(h_assignment, full_assignment);
-  assignment.resize(full_assignment.size(), problem.handle_ptr->get_stream());
-  raft::copy(assignment.data(),
-             full_assignment.data(),
-             full_assignment.size(),
-             problem.handle_ptr->get_stream());
+  if constexpr (std::is_same_v<i_t, int>) {
+    papilo_presolve_ptr->uncrush_primal_solution(assignment, problem.handle_ptr->get_stream());
+  } else {
+    cuopt_assert(false, "Third-party presolve only runs with 32-bit indices");
+  }
   problem.handle_ptr->sync_stream();
 }
 
@@ -253,5 +251,9 @@ template class presolve_data_t<int, float>;
 template class presolve_data_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class presolve_data_t<int64_t, double>;
+#endif
+
 }  // namespace linear_programming::detail
 }  // namespace cuopt
@@ -45,7 +45,8 @@ class presolve_data_t {
       objective_scaling_factor(problem.get_objective_scaling_factor()),
       variable_mapping(0, stream),
       fixed_var_assignment(0, stream),
-      var_flags(0, stream)
+      var_flags(0, stream),
+      constraint_mapping(0, stream)
   {
   }
 
@@ -58,6 +59,7 @@ class presolve_data_t {
       variable_mapping(other.variable_mapping, stream),
       fixed_var_assignment(other.fixed_var_assignment, stream),
       var_flags(other.var_flags, stream),
+      constraint_mapping(other.constraint_mapping, stream),
       papilo_presolve_ptr(other.papilo_presolve_ptr),
       papilo_reduced_to_original_map(other.papilo_reduced_to_original_map),
       papilo_original_to_reduced_map(other.papilo_original_to_reduced_map),
@@ -76,6 +78,9 @@ class presolve_data_t {
                                fixed_var_assignment.begin(),
                                fixed_var_assignment.end(),
                                0.);
+    constraint_mapping.resize(problem.n_constraints, handle_ptr->get_stream());
+    thrust::sequence(
+      handle_ptr->get_thrust_policy(), constraint_mapping.begin(), constraint_mapping.end());
     variable_substitutions.clear();
   }
 
@@ -115,6 +120,8 @@ class presolve_data_t {
   rmm::device_uvector<i_t> variable_mapping;
   rmm::device_uvector<f_t> fixed_var_assignment;
   rmm::device_uvector<i_t> var_flags;
+  // original ids of the constraints kept by trivial presolve
+  rmm::device_uvector<i_t> constraint_mapping;
 
   const third_party_presolve_t<i_t, f_t>* papilo_presolve_ptr{nullptr};
   std::vector<i_t> papilo_reduced_to_original_map{};
@@ -27,6 +27,7 @@
 #include <thrust/count.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/set_operations.h>
 #include <thrust/sort.h>
 #include <thrust/tabulate.h>
@@ -145,7 +146,10 @@ problem_t<i_t, f_t>::problem_t(
     fixing_helpers(n_constraints, n_variables, handle_ptr),
     Q_offsets(problem_.get_quadratic_objective_offsets()),
     Q_indices(problem_.get_quadratic_objective_indices()),
-    Q_values(problem_.get_quadratic_objective_values())
+    Q_values(problem_.get_quadratic_objective_values()),
+    F_offsets(problem_.get_quadratic_objective_factor_offsets()),
+    F_indices(problem_.get_quadratic_objective_factor_indices()),
+    F_values(problem_.get_quadratic_objective_factor_values())
 {
   op_problem_cstr_body(problem_);
   branch_and_bound_callback             = nullptr;
@@ -170,6 +174,7 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_)
     maximize(problem_.maximize),
     empty(problem_.empty),
     is_binary_pb(problem_.is_binary_pb),
+    unit_coefficients(problem_.unit_coefficients),
     presolve_data(problem_.presolve_data, handle_ptr->get_stream()),
     original_ids(problem_.original_ids),
     reverse_original_ids(problem_.reverse_original_ids),
@@ -203,7 +208,10 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_)
     expensive_to_fix_vars(problem_.expensive_to_fix_vars),
     Q_offsets(problem_.Q_offsets),
     Q_indices(problem_.Q_indices),
-    Q_values(problem_.Q_values)
+    Q_values(problem_.Q_values),
+    F_offsets(problem_.F_offsets),
+    F_indices(problem_.F_indices),
+    F_values(problem_.F_values)
 {
 }
 
@@ -226,6 +234,7 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_,
     maximize(problem_.maximize),
     empty(problem_.empty),
     is_binary_pb(problem_.is_binary_pb),
+    unit_coefficients(problem_.unit_coefficients),
     presolve_data(problem_.presolve_data, handle_ptr->get_stream()),
     original_ids(problem_.original_ids),
     reverse_original_ids(problem_.reverse_original_ids),
@@ -259,7 +268,10 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_,
     expensive_to_fix_vars(problem_.expensive_to_fix_vars),
     Q_offsets(problem_.Q_offsets),
     Q_indices(problem_.Q_indices),
-    Q_values(problem_.Q_values)
+    Q_values(problem_.Q_values),
+    F_offsets(problem_.F_offsets),
+    F_indices(problem_.F_indices),
+    F_values(problem_.F_values)
 {
 }
 
@@ -279,6 +291,7 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_, bool no_deep
     maximize(problem_.maximize),
     empty(problem_.empty),
     is_binary_pb(problem_.is_binary_pb),
+    unit_coefficients(problem_.unit_coefficients),
     // Copy constructor used by PDLP and MIP
     // PDLP uses the version with no_deep_copy = false which deep copy some fields but doesn't
     // allocate others that are not needed in PDLP
@@ -358,7 +371,10 @@ problem_t<i_t, f_t>::problem_t(const problem_t<i_t, f_t>& problem_, bool no_deep
     expensive_to_fix_vars(problem_.expensive_to_fix_vars),
     Q_offsets(problem_.Q_offsets),
     Q_indices(problem_.Q_indices),
-    Q_values(problem_.Q_values)
+    Q_values(problem_.Q_values),
+    F_offsets(problem_.F_offsets),
+    F_indices(problem_.F_indices),
+    F_values(problem_.F_values)
 {
 }
 
@@ -472,6 +488,7 @@ template <typename i_t, typename f_t>
 void problem_t<i_t, f_t>::compute_transpose_of_problem()
 {
   raft::common::nvtx::range fun_scope("compute_transpose_of_problem");
+  ++structure_version;
   csrsort_cusparse(coefficients, variables, offsets, n_constraints, n_variables, handle_ptr);
   RAFT_CUBLAS_TRY(raft::linalg::detail::cublassetpointermode(
     handle_ptr->get_cublas_handle(), CUBLAS_POINTER_MODE_DEVICE, handle_ptr->get_stream()));
@@ -850,6 +867,13 @@ void problem_t<i_t, f_t>::compute_auxiliary_data()
     nnz_stddev     = std::sqrt(variance);
     unbalancedness = nnz_stddev / mean;
   }
+
+  unit_coefficients = nnz > 0 && thrust::all_of(handle_ptr->get_thrust_policy(),
+                                                coefficients.begin(),
+                                                coefficients.end(),
+                                                [] __device__(f_t value) {
+                                                  return value == f_t(1) || value == f_t(-1);
+                                                });
 }
 
 template <typename i_t, typename f_t>
@@ -1563,6 +1587,7 @@ void problem_t<i_t, f_t>::substitute_variables(const std::vector<i_t>& var_indic
                    [objective_coefficients = make_span(objective_coefficients)] __device__(
                      i_t var_idx) { objective_coefficients[var_idx] = 0.; });
   handle_ptr->sync_stream();
+  ++structure_version;
   CUOPT_LOG_DEBUG("Substituted %d variables", var_indices.size());
 }
 
@@ -1655,6 +1680,7 @@ template <typename i_t, typename f_t>
 void problem_t<i_t, f_t>::sort_rows_by_variables(const raft::handle_t* handle_ptr)
 {
   csrsort_cusparse(coefficients, variables, offsets, n_constraints, n_variables, handle_ptr);
+  ++structure_version;
 }
 
 template <typename i_t, typename f_t>
@@ -1728,6 +1754,30 @@ problem_t<i_t, f_t> problem_t<i_t, f_t>::get_problem_after_fixing_vars(
   return problem;
 }
 
+template <typename i_t, typename f_t>
+problem_t<i_t, f_t> problem_t<i_t, f_t>::get_problem_after_fixing_var_bounds(
+  const rmm::device_uvector<f_t>& assignment,
+  const rmm::device_uvector<i_t>& variables_to_fix,
+  rmm::device_uvector<i_t>& variable_map,
+  const raft::handle_t* handle_ptr)
+{
+  raft::common::nvtx::range fun_scope("get_problem_after_fixing_var_bounds");
+  cuopt_assert(n_variables == assignment.size(), "Assignment size issue");
+  problem_t<i_t, f_t> problem(*this);
+  CUOPT_LOG_DEBUG("Fixing the bounds of %d variables", variables_to_fix.size());
+  variable_map.resize(n_variables, handle_ptr->get_stream());
+  thrust::sequence(handle_ptr->get_thrust_policy(), variable_map.begin(), variable_map.end(), 0);
+  thrust::for_each(handle_ptr->get_thrust_policy(),
+                   variables_to_fix.begin(),
+                   variables_to_fix.end(),
+                   [assignment      = make_span(assignment),
+                    variable_bounds = make_span(problem.variable_bounds)] __device__(i_t var_idx) {
+                     variable_bounds[var_idx] = f_t2{assignment[var_idx], assignment[var_idx]};
+                   });
+  RAFT_CHECK_CUDA(handle_ptr->get_stream());
+  return problem;
+}
+
 template <typename i_t, typename f_t>
 void problem_t<i_t, f_t>::remove_given_variables(problem_t<i_t, f_t>& original_problem,
                                                  rmm::device_uvector<f_t>& assignment,
@@ -2300,4 +2350,8 @@ template class problem_t<int, float>;
 template class problem_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class problem_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
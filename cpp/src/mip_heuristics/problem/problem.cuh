@@ -67,6 +67,13 @@ class problem_t {
     const rmm::device_uvector<i_t>& variables_to_fix,
     rmm::device_uvector<i_t>& variable_map,
     const raft::handle_t* handle_ptr);
+  // Fixes variables_to_fix to their assignment through their bounds, without removing them from a
+  // copy of the problem. variable_map is the identity
+  problem_t<i_t, f_t> get_problem_after_fixing_var_bounds(
+    const rmm::device_uvector<f_t>& assignment,
+    const rmm::device_uvector<i_t>& variables_to_fix,
+    rmm::device_uvector<i_t>& variable_map,
+    const raft::handle_t* handle_ptr);
   void remove_given_variables(problem_t<i_t, f_t>& original_problem,
                               rmm::device_uvector<f_t>& assignment,
                               rmm::device_uvector<i_t>& variable_map,
@@ -253,6 +260,8 @@ class problem_t {
   double sparsity{0.0};
   double nnz_stddev{0.0};
   double unbalancedness{0.0};
+  // All the coefficients of A are +1 or -1, e.g., set partitioning, covering or network problems
+  bool unit_coefficients{false};
 
   presolve_data_t<i_t, f_t> presolve_data;
 
@@ -311,11 +320,18 @@ class problem_t {
   lp_state_t<i_t, f_t> lp_state;
   problem_fixing_helpers_t<i_t, f_t> fixing_helpers;
   bool cutting_plane_added{false};
+  // Bumped whenever the CSR/CSC matrices change, the cached load balanced problem is rebuilt on
+  // the next access when it was built from an older version
+  i_t structure_version{0};
   std::pair<std::vector<i_t>, std::vector<f_t>> vars_with_objective_coeffs;
   bool expensive_to_fix_vars{false};
   std::vector<i_t> Q_offsets;
   std::vector<i_t> Q_indices;
   std::vector<f_t> Q_values;
+  // Factor of the quadratic objective Q = F^T F, only set for factored quadratic objectives
+  std::vector<i_t> F_offsets;
+  std::vector<i_t> F_indices;
+  std::vector<f_t> F_values;
 };
 
 }  // namespace linear_programming::detail
@@ -7,12 +7,12 @@
 
 #include "problem.cuh"
 
-#include <fstream>
-#include <iomanip>
 #include <limits>
+#include <memory>
 #include <string>
 
 #include <mip_heuristics/mip_constants.hpp>
+#include <mps_parser/utilities/chunked_output.hpp>
 
 #include "utilities/copy_helpers.hpp"
 
@@ -31,75 +31,96 @@ void problem_t<i_t, f_t>::write_as_mps(const std::string& path)
   auto h_cstr_ub              = cuopt::host_copy(constraint_upper_bounds, handle_ptr->get_stream());
   auto h_var_types            = cuopt::host_copy(variable_types, handle_ptr->get_stream());
 
-  std::ofstream mps_file(path);
-  if (!mps_file.is_open()) {
-    CUOPT_LOG_ERROR("Could not open file %s for writing", path.c_str());
+  const std::string obj_name = objective_name.empty() ? "OBJ" : objective_name;
+  auto append_row_name       = [&](std::string& buffer, size_t i) {
+    if (i < row_names.size()) {
+      buffer += row_names[i];
+    } else {
+      buffer += 'R';
+      mps_parser::append_number(buffer, i);
+    }
+  };
+  auto append_col_name = [&](std::string& buffer, size_t j) {
+    if (j < var_names.size()) {
+      buffer += var_names[j];
+    } else {
+      buffer += 'C';
+      mps_parser::append_number(buffer, j);
+    }
+  };
+
+  // The sections are formatted in parallel chunks, compressed when the path ends with .gz or .bz2
+  std::unique_ptr<mps_parser::mps_output_t> output;
+  try {
+    output = std::make_unique<mps_parser::mps_output_t>(path);
+  } catch (const std::exception& e) {
+    CUOPT_LOG_ERROR("Could not open file %s for writing: %s", path.c_str(), e.what());
     return;
   }
-
-  // save coefficients with full precision
-  mps_file << std::setprecision(std::numeric_limits<f_t>::max_digits10);
+  auto& mps_file = *output;
+  std::string header;
 
   // NAME section
-  mps_file << "NAME          " << original_problem_ptr->get_problem_name() << "\n";
+  header += "NAME          " + original_problem_ptr->get_problem_name() + "\n";
 
-  if (maximize) { mps_file << "OBJSENSE\n MAXIMIZE\n"; }
+  if (maximize) { header += "OBJSENSE\n MAXIMIZE\n"; }
 
   // ROWS section
-  mps_file << "ROWS\n";
-  mps_file << " N  " << (objective_name.empty() ? "OBJ" : objective_name) << "\n";
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    std::string row_name = i < row_names.size() ? row_names[i] : "R" + std::to_string(i);
-
+  header += "ROWS\n";
+  header += " N  " + obj_name + "\n";
+  mps_file.write(header);
+  mps_parser::write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
     char type = 'L';
     if (h_cstr_lb[i] == h_cstr_ub[i])
       type = 'E';
     else if (std::isinf(h_cstr_ub[i]))
       type = 'G';
-    mps_file << " " << type << "  " << row_name << "\n";
-  }
+    buffer += ' ';
+    buffer += type;
+    buffer += "  ";
+    append_row_name(buffer, i);
+    buffer += '\n';
+  });
 
   // COLUMNS section
-  mps_file << "COLUMNS\n";
-
-  bool in_integer_section = false;
-  for (size_t j = 0; j < (size_t)n_variables; j++) {
-    std::string col_name = j < var_names.size() ? var_names[j] : "C" + std::to_string(j);
+  mps_file.write("COLUMNS\n");
 
-    // Write integer marker if needed
-    if (h_var_types[j] != var_t::CONTINUOUS) {
-      if (!in_integer_section) {
-        mps_file << "    MARK0001  'MARKER'                 'INTORG'\n";
-        in_integer_section = true;
-      }
+  mps_parser::write_in_chunks(mps_file, n_variables, [&](size_t j, std::string& buffer) {
+    // Integer markers around each run of integer variables
+    const bool is_integer = h_var_types[j] != var_t::CONTINUOUS;
+    if (is_integer && (j == 0 || h_var_types[j - 1] == var_t::CONTINUOUS)) {
+      buffer += "    MARK0001  'MARKER'                 'INTORG'\n";
     }
 
     // Write objective coefficient if non-zero
     if (h_obj_coeffs[j] != 0.0) {
-      mps_file << "    " << col_name << " " << (objective_name.empty() ? "OBJ" : objective_name)
-               << " " << (maximize ? -h_obj_coeffs[j] : h_obj_coeffs[j]) << "\n";
+      buffer += "    ";
+      append_col_name(buffer, j);
+      buffer += ' ' + obj_name + ' ';
+      mps_parser::append_number(buffer, maximize ? -h_obj_coeffs[j] : h_obj_coeffs[j]);
+      buffer += '\n';
     }
 
     // Write constraint coefficients
     for (size_t k = (size_t)h_reverse_offsets[j]; k < (size_t)h_reverse_offsets[j + 1]; k++) {
-      size_t row           = (size_t)h_reverse_constraints[k];
-      std::string row_name = row < row_names.size() ? row_names[row] : "R" + std::to_string(row);
-      mps_file << "    " << col_name << " " << row_name << " " << h_reverse_coefficients[k] << "\n";
+      buffer += "    ";
+      append_col_name(buffer, j);
+      buffer += ' ';
+      append_row_name(buffer, h_reverse_constraints[k]);
+      buffer += ' ';
+      mps_parser::append_number(buffer, h_reverse_coefficients[k]);
+      buffer += '\n';
     }
 
-    if (h_var_types[j] != var_t::CONTINUOUS && in_integer_section) {
-      if (j == (size_t)n_variables - 1 || h_var_types[j + 1] == var_t::CONTINUOUS) {
-        mps_file << "    MARK0001  'MARKER'                 'INTEND'\n";
-        in_integer_section = false;
-      }
+    if (is_integer &&
+        (j == (size_t)n_variables - 1 || h_var_types[j + 1] == var_t::CONTINUOUS)) {
+      buffer += "    MARK0001  'MARKER'                 'INTEND'\n";
     }
-  }
+  });
 
   // RHS section
-  mps_file << "RHS\n";
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    std::string row_name = i < row_names.size() ? row_names[i] : "R" + std::to_string(i);
-
+  mps_file.write("RHS\n");
+  mps_parser::write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
     f_t rhs;
     if (std::isinf(h_cstr_lb[i])) {
       rhs = h_cstr_ub[i];
@@ -110,48 +131,73 @@ void problem_t<i_t, f_t>::write_as_mps(const std::string& path)
     }
 
     if (isfinite(rhs) && rhs != 0.0) {
-      mps_file << "    RHS1      " << row_name << " " << rhs << "\n";
+      buffer += "    RHS1      ";
+      append_row_name(buffer, i);
+      buffer += ' ';
+      mps_parser::append_number(buffer, rhs);
+      buffer += '\n';
     }
-  }
+  });
 
   // RANGES section if needed
+  auto is_range = [&](size_t i) {
+    return h_cstr_lb[i] != -std::numeric_limits<f_t>::infinity() &&
+           h_cstr_ub[i] != std::numeric_limits<f_t>::infinity() && h_cstr_lb[i] != h_cstr_ub[i];
+  };
   bool has_ranges = false;
-  for (size_t i = 0; i < (size_t)n_constraints; i++) {
-    if (h_cstr_lb[i] != -std::numeric_limits<f_t>::infinity() &&
-        h_cstr_ub[i] != std::numeric_limits<f_t>::infinity() && h_cstr_lb[i] != h_cstr_ub[i]) {
-      if (!has_ranges) {
-        mps_file << "RANGES\n";
-        has_ranges = true;
-      }
-      std::string row_name = i < row_names.size() ? row_names[i] : "R" + std::to_string(i);
-      mps_file << "    RNG1      " << row_name << " " << (h_cstr_ub[i] - h_cstr_lb[i]) << "\n";
-    }
+  for (size_t i = 0; i < (size_t)n_constraints && !has_ranges; i++) {
+    has_ranges = is_range(i);
+  }
+  if (has_ranges) {
+    mps_file.write("RANGES\n");
+    mps_parser::write_in_chunks(mps_file, n_constraints, [&](size_t i, std::string& buffer) {
+      if (!is_range(i)) { return; }
+      buffer += "    RNG1      ";
+      append_row_name(buffer, i);
+      buffer += ' ';
+      mps_parser::append_number(buffer, h_cstr_ub[i] - h_cstr_lb[i]);
+      buffer += '\n';
+    });
   }
 
   // BOUNDS section
-  mps_file << "BOUNDS\n";
-  for (size_t j = 0; j < (size_t)n_variables; j++) {
-    std::string col_name = j < var_names.size() ? var_names[j] : "C" + std::to_string(j);
-
+  mps_file.write("BOUNDS\n");
+  mps_parser::write_in_chunks(mps_file, n_variables, [&](size_t j, std::string& buffer) {
     if (h_var_lb[j] == -std::numeric_limits<f_t>::infinity() &&
         h_var_ub[j] == std::numeric_limits<f_t>::infinity()) {
-      mps_file << " FR BOUND1    " << col_name << "\n";
+      buffer += " FR BOUND1    ";
+      append_col_name(buffer, j);
+      buffer += '\n';
     } else {
       if (h_var_lb[j] != 0.0 || h_obj_coeffs[j] == 0.0 || h_var_types[j] != var_t::CONTINUOUS) {
         if (h_var_lb[j] == -std::numeric_limits<f_t>::infinity()) {
-          mps_file << " MI BOUND1    " << col_name << "\n";
+          buffer += " MI BOUND1    ";
+          append_col_name(buffer, j);
+          buffer += '\n';
         } else {
-          mps_file << " LO BOUND1    " << col_name << " " << h_var_lb[j] << "\n";
+          buffer += " LO BOUND1    ";
+          append_col_name(buffer, j);
+          buffer += ' ';
+          mps_parser::append_number(buffer, h_var_lb[j]);
+          buffer += '\n';
         }
       }
       if (h_var_ub[j] != std::numeric_limits<f_t>::infinity()) {
-        mps_file << " UP BOUND1    " << col_name << " " << h_var_ub[j] << "\n";
+        buffer += " UP BOUND1    ";
+        append_col_name(buffer, j);
+        buffer += ' ';
+        mps_parser::append_number(buffer, h_var_ub[j]);
+        buffer += '\n';
       }
     }
-  }
+  });
 
-  mps_file << "ENDATA\n";
-  mps_file.close();
+  mps_file.write("ENDATA\n");
+  try {
+    mps_file.close();
+  } catch (const std::exception& e) {
+    CUOPT_LOG_ERROR("Error writing file %s: %s", path.c_str(), e.what());
+  }
 }
 
 #if MIP_INSTANTIATE_FLOAT
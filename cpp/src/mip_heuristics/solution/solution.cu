@@ -324,6 +324,7 @@ f_t solution_t<i_t, f_t>::compute_l2_residual()
 template <typename i_t, typename f_t>
 bool solution_t<i_t, f_t>::compute_feasibility()
 {
+  n_incremental_updates = 0;
   n_feasible_constraints.set_value_to_zero_async(handle_ptr->get_stream());
   compute_constraints();
   compute_objective();
@@ -338,6 +339,83 @@ bool solution_t<i_t, f_t>::compute_feasibility()
   return is_feasible;
 }
 
+template <typename i_t, typename f_t>
+bool solution_t<i_t, f_t>::update_feasibility_after_changes(
+  const rmm::device_uvector<i_t>& changed_vars, const rmm::device_uvector<f_t>& old_values)
+{
+  cuopt_assert(changed_vars.size() == old_values.size(), "Size mismatch");
+  // Scattering over the columns beats the full SpMV only for small changes. The incremental
+  // updates accumulate rounding errors, so the activities are recomputed from time to time
+  constexpr double max_incremental_change_ratio        = 0.05;
+  constexpr i_t n_incremental_updates_before_recompute = 32;
+  if (changed_vars.size() > max_incremental_change_ratio * problem_ptr->n_variables ||
+      ++n_incremental_updates >= n_incremental_updates_before_recompute) {
+    return compute_feasibility();
+  }
+  if (changed_vars.size() == 0) { return is_feasible; }
+  auto v             = view();
+  auto changed_span  = cuopt::make_span(changed_vars);
+  auto old_vals_span = cuopt::make_span(old_values);
+
+  f_t objective_delta = thrust::transform_reduce(
+    handle_ptr->get_thrust_policy(),
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(changed_vars.size()),
+    cuda::proclaim_return_type<f_t>([v, changed_span, old_vals_span] __device__(i_t k) -> f_t {
+      i_t var = changed_span[k];
+      return v.problem.objective_coefficients[var] * (v.assignment[var] - old_vals_span[k]);
+    }),
+    0.,
+    thrust::plus<f_t>());
+  i_t integers_delta = thrust::transform_reduce(
+    handle_ptr->get_thrust_policy(),
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(changed_vars.size()),
+    cuda::proclaim_return_type<i_t>([v, changed_span, old_vals_span] __device__(i_t k) -> i_t {
+      i_t var = changed_span[k];
+      if (!v.problem.is_integer_var(var)) { return 0; }
+      return (i_t)v.problem.is_integer(v.assignment[var]) -
+             (i_t)v.problem.is_integer(old_vals_span[k]);
+    }),
+    0,
+    thrust::plus<i_t>());
+  thrust::for_each(handle_ptr->get_thrust_policy(),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(changed_vars.size()),
+                   [v, changed_span, old_vals_span] __device__(i_t k) {
+                     i_t var   = changed_span[k];
+                     f_t delta = v.assignment[var] - old_vals_span[k];
+                     if (delta == 0.) { return; }
+                     auto [offset_begin, offset_end] = v.problem.reverse_range_for_var(var);
+                     for (i_t i = offset_begin; i < offset_end; i++) {
+                       atomicAdd(&v.constraint_value[v.problem.reverse_constraints[i]],
+                                 v.problem.reverse_coefficients[i] * delta);
+                     }
+                   });
+  n_feasible_constraints.set_value_to_zero_async(handle_ptr->get_stream());
+  thrust::for_each(handle_ptr->get_thrust_policy(),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(problem_ptr->n_constraints),
+                   [v] __device__(i_t c) {
+                     f_t constr_val    = v.constraint_value[c];
+                     f_t lb            = v.problem.constraint_lower_bounds[c];
+                     f_t ub            = v.problem.constraint_upper_bounds[c];
+                     v.lower_excess[c] = max(0., lb - constr_val);
+                     v.upper_excess[c] = max(0., constr_val - ub);
+                     i_t feasible =
+                       is_constraint_feasible<i_t, f_t>(constr_val, lb, ub, v.problem.tolerances);
+                     atomicAdd(v.n_feasible_constraints, feasible);
+                   });
+  compute_infeasibility();
+  h_obj += objective_delta;
+  h_user_obj = problem_ptr->get_user_obj_from_solver_obj(h_obj);
+  n_assigned_integers += integers_delta;
+  i_t h_n_feas_constraints = n_feasible_constraints.value(handle_ptr->get_stream());
+  is_feasible              = h_n_feas_constraints == problem_ptr->n_constraints &&
+                n_assigned_integers == problem_ptr->n_integer_vars;
+  return is_feasible;
+}
+
 template <typename i_t, typename f_t>
 void solution_t<i_t, f_t>::compute_objective()
 {
@@ -428,8 +506,15 @@ solution_t<i_t, f_t>::fix_variables(const rmm::device_uvector<i_t>& variable_ind
   rmm::device_uvector<f_t> new_assignment(assignment, handle_ptr->get_stream());
   rmm::device_uvector<i_t> variable_map(assignment.size(), handle_ptr->get_stream());
 
-  problem_t<i_t, f_t> fixed_problem = problem_ptr->get_problem_after_fixing_vars(
-    new_assignment, variable_indices, variable_map, handle_ptr);
+  // Removing the fixed variables rebuilds the matrix and its transpose in new allocations. When
+  // only a few of them are fixed the reduction is not worth it and they are fixed by their bounds
+  constexpr double min_fixed_ratio_to_compact = 0.1;
+  const bool compact = variable_indices.size() >= min_fixed_ratio_to_compact * assignment.size();
+  problem_t<i_t, f_t> fixed_problem =
+    compact ? problem_ptr->get_problem_after_fixing_vars(
+                new_assignment, variable_indices, variable_map, handle_ptr)
+            : problem_ptr->get_problem_after_fixing_var_bounds(
+                new_assignment, variable_indices, variable_map, handle_ptr);
   fixed_problem.check_problem_representation();
   thrust::for_each(
     handle_ptr->get_thrust_policy(),
@@ -59,6 +59,12 @@ class solution_t {
   void correct_integer_precision();
   // does a reduction and returns if the current solution is feasible
   bool compute_feasibility();
+  // updates the constraint values, excesses, objective and feasibility after changed_vars moved
+  // from old_values to their current assignment, by scattering the changes over their columns.
+  // Assumes the rest of the assignment is as of the last compute_feasibility, which is run instead
+  // when the change is large or after many incremental updates. changed_vars must be unique
+  bool update_feasibility_after_changes(const rmm::device_uvector<i_t>& changed_vars,
+                                        const rmm::device_uvector<f_t>& old_values);
   // sets the is_feasible flag to 1
   void set_feasible();
   // sets the is_feasible flag to 0
@@ -147,6 +153,8 @@ class solution_t {
   bool is_scaled_{false};
   bool post_process_completed{false};
   lp_state_t<i_t, f_t> lp_state;
+  // number of update_feasibility_after_changes calls since the last full compute_feasibility
+  i_t n_incremental_updates{0};
 
   // runtime TEST functions
   void test_feasibility(bool check_integer = true);
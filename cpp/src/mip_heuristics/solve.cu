@@ -7,6 +7,8 @@
 
 #include <cuopt/error.hpp>
 
+#include <math_optimization/warm_start_cache.hpp>
+#include <mip_heuristics/feasibility_jump/fj_cpu.cuh>
 #include <mip_heuristics/mip_constants.hpp>
 #include <mip_heuristics/presolve/third_party_presolve.hpp>
 #include <mip_heuristics/presolve/trivial_presolve.cuh>
@@ -20,6 +22,8 @@
 #include <pdlp/step_size_strategy/adaptive_step_size_strategy.hpp>
 #include <pdlp/utilities/problem_checking.cuh>
 #include <pdlp/utils.cuh>
+#include <utilities/device_memory_budget.hpp>
+#include <utilities/instrumentation.hpp>
 #include <utilities/logger.hpp>
 #include <utilities/seed_generator.cuh>
 #include <utilities/version_info.hpp>
@@ -34,9 +38,20 @@
 
 #include <raft/sparse/detail/cusparse_wrappers.h>
 #include <raft/core/cusparse_macros.hpp>
+#include <raft/core/device_setter.hpp>
 #include <raft/core/handle.hpp>
 #include <raft/core/nvtx.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include <cuda_profiler_api.h>
 
 namespace cuopt::linear_programming {
@@ -51,6 +66,81 @@ static void init_handler(const raft::handle_t* handle_ptr)
     handle_ptr->get_cusparse_handle(), CUSPARSE_POINTER_MODE_DEVICE, handle_ptr->get_stream()));
 }
 
+// Feasibility jump on the CPU over the original problem, run while Papilo presolves it. Presolve
+// can take a large part of the time limit on big models, so the solve of the reduced problem
+// starts with the incumbent found in the meantime instead of from scratch.
+template <typename i_t, typename f_t>
+class presolve_overlap_fj_t {
+ public:
+  presolve_overlap_fj_t(const detail::problem_t<i_t, f_t>& original_problem,
+                        mip_solver_settings_t<i_t, f_t> const& settings,
+                        f_t time_limit)
+    : problem_(original_problem)
+  {
+    raft::common::nvtx::range fun_scope("presolve_overlap_fj");
+    auto constexpr const running_mip = true;
+    problem_.preprocess_problem();
+    // The climber does not use the scaling, the context only needs one
+    scaling_ = std::make_unique<detail::pdlp_initial_scaling_strategy_t<i_t, f_t>>(
+      problem_.handle_ptr,
+      problem_,
+      settings.hyper_params.default_l_inf_ruiz_iterations,
+      (f_t)settings.hyper_params.default_alpha_pock_chambolle_rescaling,
+      problem_.reverse_coefficients,
+      problem_.reverse_offsets,
+      problem_.reverse_constraints,
+      nullptr,
+      settings.hyper_params,
+      running_mip);
+    context_ = std::make_unique<detail::mip_solver_context_t<i_t, f_t>>(
+      problem_.handle_ptr, &problem_, settings, *scaling_);
+    fj_ = std::make_unique<detail::fj_t<i_t, f_t>>(*context_);
+
+    detail::solution_t<i_t, f_t> solution(problem_);
+    thrust::fill(solution.handle_ptr->get_thrust_policy(),
+                 solution.assignment.begin(),
+                 solution.assignment.end(),
+                 0.0);
+    solution.clamp_within_bounds();
+    std::vector<f_t> default_weights(problem_.n_constraints, 1.);
+    cpu_fj_.fj_cpu             = fj_->create_cpu_climber(solution,
+                                             default_weights,
+                                             default_weights,
+                                             0.,
+                                             context_->preempt_heuristic_solver_,
+                                             detail::fj_settings_t{},
+                                             /*randomize=*/false);
+    cpu_fj_.fj_ptr             = fj_.get();
+    cpu_fj_.fj_cpu->log_prefix = "[Presolve FJ] ";
+    cpu_fj_.time_limit         = time_limit;
+    cpu_fj_.start_cpu_solver();
+  }
+
+  // Stops the climber and returns its best feasible assignment in the space of the original
+  // problem. Empty when no feasible assignment was found
+  std::vector<f_t> stop()
+  {
+    cpu_fj_.stop_cpu_solver();
+    if (!cpu_fj_.wait_for_cpu_solver()) { return {}; }
+    CUOPT_LOG_INFO("Feasible solution found during presolve, objective %g",
+                   problem_.get_user_obj_from_solver_obj(cpu_fj_.fj_cpu->h_best_objective));
+    const std::vector<f_t>& best = cpu_fj_.fj_cpu->h_best_assignment;
+    auto stream                  = problem_.handle_ptr->get_stream();
+    rmm::device_uvector<f_t> assignment(best.size(), stream);
+    raft::copy(assignment.data(), best.data(), best.size(), stream);
+    problem_.post_process_assignment(assignment, true);
+    return cuopt::host_copy(assignment, stream);
+  }
+
+ private:
+  detail::problem_t<i_t, f_t> problem_;
+  std::unique_ptr<detail::pdlp_initial_scaling_strategy_t<i_t, f_t>> scaling_;
+  std::unique_ptr<detail::mip_solver_context_t<i_t, f_t>> context_;
+  std::unique_ptr<detail::fj_t<i_t, f_t>> fj_;
+  // Destroyed first, which stops and joins the thread
+  detail::cpu_fj_thread_t<i_t, f_t> cpu_fj_;
+};
+
 template <typename i_t, typename f_t>
 mip_solution_t<i_t, f_t> run_mip(detail::problem_t<i_t, f_t>& problem,
                                  mip_solver_settings_t<i_t, f_t> const& settings,
@@ -115,6 +205,7 @@ mip_solution_t<i_t, f_t> run_mip(detail::problem_t<i_t, f_t>& problem,
     }
     return solution.get_solution(true, stats, false);
   }
+  const double preprocess_start_time = timer.elapsed_time();
   // problem contains unpreprocessed data
   detail::problem_t<i_t, f_t> scaled_problem(problem);
 
@@ -152,8 +243,13 @@ mip_solution_t<i_t, f_t> run_mip(detail::problem_t<i_t, f_t>& problem,
   // cuopt_func_call((check_scaled_problem<i_t, f_t>(scaled_problem, saved_problem)));
   detail::trivial_presolve(scaled_problem);
 
+  const double search_start_time = timer.elapsed_time();
   detail::mip_solver_t<i_t, f_t> solver(scaled_problem, settings, scaling, timer);
-  auto scaled_sol                 = solver.run_solver();
+  auto scaled_sol = solver.run_solver();
+
+  solver.get_solver_stats().preprocess_time = search_start_time - preprocess_start_time;
+  solver.get_solver_stats().search_time     = timer.elapsed_time() - search_start_time;
+
   bool is_feasible_before_scaling = scaled_sol.get_feasible();
   scaled_sol.problem_ptr          = &problem;
   if (settings.mip_scaling) { scaling.unscale_solutions(scaled_sol); }
@@ -180,10 +276,12 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
 {
   try {
     mip_solver_settings_t<i_t, f_t> settings(settings_const);
-    if (settings.presolver == presolver_t::Default || settings.presolver == presolver_t::PSLP) {
-      if (settings.presolver == presolver_t::PSLP) {
+    if (settings.presolver == presolver_t::Default || settings.presolver == presolver_t::PSLP ||
+        settings.presolver == presolver_t::GPU) {
+      if (settings.presolver != presolver_t::Default) {
         CUOPT_LOG_INFO(
-          "PSLP presolver is not supported for MIP problems, using Papilo presolver instead");
+          "%s presolver is not supported for MIP problems, using Papilo presolver instead",
+          settings.presolver == presolver_t::PSLP ? "PSLP" : "GPU LP");
       }
       settings.presolver = presolver_t::Papilo;
     }
@@ -194,8 +292,13 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
         ? max_time_limit
         : settings.time_limit;
 
+    // Setup phase of the latency breakdown, from the entry of the solve to presolve
+    auto setup_timer = timer_t(time_limit);
+
     // Create log stream for file logging and add it to default logger
     init_logger_t log(settings.log_file, settings.log_to_console);
+    device_memory_budget_t memory_budget(settings.device_memory_limit);
+    solver_counters_scope_t counters_scope;
     // Init libraies before to not include it in solve time
     // This needs to be called before pdlp is initialized
     init_handler(op_problem.get_handle_ptr());
@@ -234,6 +337,20 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
     detail::problem_t<i_t, f_t> problem(
       op_problem, settings.get_tolerances(), settings.determinism_mode == CUOPT_MODE_DETERMINISTIC);
 
+    // The solution saved by an earlier solve of a problem with the same structure is added as an
+    // initial solution, through presolve as it is in the space of the original problem
+    std::optional<detail::warm_start_cache_t<i_t, f_t>> warm_start_cache;
+    std::vector<f_t> warm_start_assignment;
+    if (!settings.warm_start_cache_dir.empty()) {
+      warm_start_cache.emplace(settings.warm_start_cache_dir, op_problem);
+      std::vector<f_t> warm_start_dual;
+      if (settings.initial_solutions.empty() &&
+          warm_start_cache->read(warm_start_assignment, warm_start_dual)) {
+        CUOPT_LOG_INFO("Using the initial solution of the warm start cache entry %s",
+                       warm_start_cache->path().c_str());
+      }
+    }
+
     auto run_presolve              = settings.presolver != presolver_t::None;
     run_presolve                   = run_presolve && settings.initial_solutions.size() == 0;
     bool has_set_solution_callback = false;
@@ -249,8 +366,23 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
       run_presolve = false;
     }
 
+    // A small problem that presolve barely reduces is solved faster without it. Only the default
+    // presolver is skipped, an explicit choice of the user is kept
+    if (run_presolve && settings.latency_mode && settings_const.presolver == presolver_t::Default) {
+      const double reduction =
+        detail::third_party_presolve_t<i_t, f_t>::estimate_reduction(op_problem);
+      if (reduction < detail::latency_mode_min_presolve_reduction) {
+        CUOPT_LOG_INFO("Latency mode: estimated presolve reduction %.1f%%, skipping presolve",
+                       100.0 * reduction);
+        run_presolve = false;
+      }
+    }
+
     if (!run_presolve) { CUOPT_LOG_INFO("Presolve is disabled, skipping"); }
 
+    const double setup_time          = setup_timer.elapsed_time();
+    const double presolve_start_time = timer.elapsed_time();
+
     auto constexpr const dual_postsolve = false;
     if (run_presolve) {
       detail::sort_csr(op_problem);
@@ -260,6 +392,13 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
       if (settings.determinism_mode == CUOPT_MODE_DETERMINISTIC) {
         presolve_time_limit = std::numeric_limits<double>::infinity();
       }
+      // The climber may find a first incumbent while presolve runs. It is not started in
+      // deterministic mode as the time it gets depends on the machine
+      std::unique_ptr<presolve_overlap_fj_t<i_t, f_t>> presolve_fj;
+      if (settings.determinism_mode != CUOPT_MODE_DETERMINISTIC && !problem.empty) {
+        presolve_fj =
+          std::make_unique<presolve_overlap_fj_t<i_t, f_t>>(problem, settings, presolve_time_limit);
+      }
       presolver   = std::make_unique<detail::third_party_presolve_t<i_t, f_t>>();
       auto result = presolver->apply(op_problem,
                                      cuopt::linear_programming::problem_category_t::MIP,
@@ -275,6 +414,26 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
                                         op_problem.get_handle_ptr()->get_stream());
       }
       presolve_result.emplace(std::move(*result));
+      if (presolve_fj) {
+        auto original_assignment = presolve_fj->stop();
+        presolve_fj.reset();
+        // Presolve is skipped when the user gives initial solutions, so only this one and the
+        // warm start are crushed
+        if (!original_assignment.empty() && !presolve_result->reduced_to_original_map.empty()) {
+          std::vector<f_t> reduced_assignment;
+          presolver->crush_primal_solution(original_assignment, reduced_assignment);
+          settings.add_initial_solution(reduced_assignment.data(),
+                                        reduced_assignment.size(),
+                                        op_problem.get_handle_ptr()->get_stream());
+        }
+      }
+      if (!warm_start_assignment.empty() && !presolve_result->reduced_to_original_map.empty()) {
+        std::vector<f_t> reduced_assignment;
+        presolver->crush_primal_solution(warm_start_assignment, reduced_assignment);
+        settings.add_initial_solution(reduced_assignment.data(),
+                                      reduced_assignment.size(),
+                                      op_problem.get_handle_ptr()->get_stream());
+      }
 
       problem = detail::problem_t<i_t, f_t>(presolve_result->reduced_problem);
       problem.set_papilo_presolve_data(presolver.get(),
@@ -282,12 +441,17 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
                                        presolve_result->original_to_reduced_map,
                                        op_problem.get_n_variables());
       problem.set_implied_integers(presolve_result->implied_integer_indices);
-      presolve_time = timer.elapsed_time();
+      presolve_time = timer.elapsed_time() - presolve_start_time;
       if (presolve_result->implied_integer_indices.size() > 0) {
         CUOPT_LOG_INFO("%d implied integers", presolve_result->implied_integer_indices.size());
       }
       CUOPT_LOG_INFO("Papilo presolve time: %.2f", presolve_time);
     }
+    if (!run_presolve && !warm_start_assignment.empty()) {
+      settings.add_initial_solution(warm_start_assignment.data(),
+                                    warm_start_assignment.size(),
+                                    op_problem.get_handle_ptr()->get_stream());
+    }
     if (settings.user_problem_file != "") {
       CUOPT_LOG_INFO("Writing user problem to file: %s", settings.user_problem_file.c_str());
       op_problem.write_to_mps(settings.user_problem_file);
@@ -295,6 +459,7 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
 
     auto sol = run_mip(problem, settings, timer);
 
+    const double postsolve_start_time = timer.elapsed_time();
     if (run_presolve) {
       auto status_to_skip = sol.get_termination_status() == mip_termination_status_t::TimeLimit ||
                             sol.get_termination_status() == mip_termination_status_t::WorkLimit ||
@@ -339,6 +504,30 @@ mip_solution_t<i_t, f_t> solve_mip(optimization_problem_t<i_t, f_t>& op_problem,
       }
     }
 
+    sol.get_stats().setup_time     = setup_time;
+    sol.get_stats().postsolve_time = timer.elapsed_time() - postsolve_start_time;
+    if (settings.latency_mode) {
+      const auto& stats = sol.get_stats();
+      CUOPT_LOG_INFO(
+        "Latency breakdown: setup %.3fs presolve %.3fs preprocess %.3fs search %.3fs postsolve "
+        "%.3fs",
+        static_cast<double>(stats.setup_time),
+        static_cast<double>(stats.presolve_time),
+        static_cast<double>(stats.preprocess_time),
+        static_cast<double>(stats.search_time),
+        static_cast<double>(stats.postsolve_time));
+    }
+
+    if (warm_start_cache &&
+        (sol.get_termination_status() == mip_termination_status_t::Optimal ||
+         sol.get_termination_status() == mip_termination_status_t::FeasibleFound)) {
+      auto stream = op_problem.get_handle_ptr()->get_stream();
+      if (!warm_start_cache->write(cuopt::host_copy(sol.get_solution(), stream), {})) {
+        CUOPT_LOG_WARN("Could not write the warm start cache entry %s",
+                       warm_start_cache->path().c_str());
+      }
+    }
+
     if (settings.sol_file != "") {
       CUOPT_LOG_INFO("Writing solution to file %s", settings.sol_file.c_str());
       sol.write_to_sol_file(settings.sol_file, op_problem.get_handle_ptr()->get_stream());
@@ -365,14 +554,76 @@ mip_solution_t<i_t, f_t> solve_mip(
   return solve_mip(op_problem, settings);
 }
 
-#define INSTANTIATE(F_TYPE)                                                 \
-  template mip_solution_t<int, F_TYPE> solve_mip(                           \
-    optimization_problem_t<int, F_TYPE>& op_problem,                        \
-    mip_solver_settings_t<int, F_TYPE> const& settings);                    \
-                                                                            \
-  template mip_solution_t<int, F_TYPE> solve_mip(                           \
-    raft::handle_t const* handle_ptr,                                       \
-    const cuopt::mps_parser::mps_data_model_t<int, F_TYPE>& mps_data_model, \
+template <typename i_t, typename f_t>
+void solve_mip_batch(
+  const std::vector<const cuopt::mps_parser::mps_data_model_t<i_t, f_t>*>& problems,
+  const std::function<void(size_t, mip_solution_t<i_t, f_t>&)>& on_solution,
+  mip_solver_settings_t<i_t, f_t> const& settings)
+{
+  raft::common::nvtx::range fun_scope("Solve MIP batch");
+  // Small problems leave most of the GPU idle, beyond this many streams they mostly contend
+  constexpr size_t max_concurrent_solves = 8;
+
+  if (problems.empty()) { return; }
+  // The solves below reuse this configuration instead of reconfiguring the sinks each time
+  init_logger_t log(settings.log_file, settings.log_to_console);
+  print_version_info();
+
+  const size_t total_threads =
+    settings.num_cpu_threads > 0 ? settings.num_cpu_threads
+                                 : std::max(1u, std::thread::hardware_concurrency());
+  const size_t n_workers =
+    std::min({problems.size(), max_concurrent_solves, std::max<size_t>(1, total_threads / 2)});
+  mip_solver_settings_t<i_t, f_t> instance_settings(settings);
+  instance_settings.num_cpu_threads =
+    static_cast<i_t>(std::max<size_t>(1, total_threads / n_workers));
+  CUOPT_LOG_INFO("Solving %zu MIPs, %zu at a time with %d CPU threads each",
+                 problems.size(),
+                 n_workers,
+                 instance_settings.num_cpu_threads);
+
+  std::atomic<size_t> next_problem{0};
+  std::vector<std::exception_ptr> errors(n_workers);
+  std::vector<std::thread> workers;
+  workers.reserve(n_workers);
+  const int device = raft::device_setter::get_current_device();
+  for (size_t w = 0; w < n_workers; ++w) {
+    workers.emplace_back([&, w]() {
+      try {
+        raft::device_setter device_guard{device};
+        rmm::cuda_stream stream;
+        const raft::handle_t handle{stream};
+        for (size_t i = next_problem++; i < problems.size(); i = next_problem++) {
+          auto op_problem = mps_data_model_to_optimization_problem(&handle, *problems[i]);
+          auto solution   = solve_mip(op_problem, instance_settings);
+          on_solution(i, solution);
+        }
+      } catch (...) {
+        errors[w] = std::current_exception();
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+}
+
+#define INSTANTIATE(F_TYPE)                                                                    \
+  template mip_solution_t<int, F_TYPE> solve_mip(                                              \
+    optimization_problem_t<int, F_TYPE>& op_problem,                                           \
+    mip_solver_settings_t<int, F_TYPE> const& settings);                                       \
+                                                                                               \
+  template mip_solution_t<int, F_TYPE> solve_mip(                                              \
+    raft::handle_t const* handle_ptr,                                                          \
+    const cuopt::mps_parser::mps_data_model_t<int, F_TYPE>& mps_data_model,                    \
+    mip_solver_settings_t<int, F_TYPE> const& settings);                                       \
+                                                                                               \
+  template void solve_mip_batch(                                                               \
+    const std::vector<const cuopt::mps_parser::mps_data_model_t<int, F_TYPE>*>& problems,      \
+    const std::function<void(size_t, mip_solution_t<int, F_TYPE>&)>& on_solution,              \
     mip_solver_settings_t<int, F_TYPE> const& settings);
 
 #if MIP_INSTANTIATE_FLOAT
@@ -165,6 +165,10 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
     return sol;
   }
   context.work_unit_scheduler_.register_context(context.gpu_heur_loop);
+  // B&B exchanges user objectives with the bus
+  context.incumbent_bus.set_objective_map(
+    context.problem_ptr->presolve_data.objective_scaling_factor,
+    context.problem_ptr->presolve_data.objective_offset);
 
   namespace dual_simplex = cuopt::linear_programming::dual_simplex;
   std::future<dual_simplex::mip_status_t> branch_and_bound_status_future;
@@ -202,25 +206,45 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
 
     if (context.settings.determinism_mode == CUOPT_MODE_DETERMINISTIC) {
       branch_and_bound_settings.work_limit = context.settings.work_limit;
+      if (!context.settings.work_unit_calibration_file.empty()) {
+        context.work_unit_calibration =
+          work_unit_calibration_t::load_or_calibrate(context.settings.work_unit_calibration_file);
+        CUOPT_LOG_INFO("CPUFJ work units scaled by %g",
+                       context.work_unit_calibration.cpu_fj_scale);
+      }
     } else {
       branch_and_bound_settings.work_limit = std::numeric_limits<f_t>::infinity();
     }
     branch_and_bound_settings.mixed_integer_gomory_cuts =
       context.settings.mixed_integer_gomory_cuts;
-    branch_and_bound_settings.knapsack_cuts = context.settings.knapsack_cuts;
+    branch_and_bound_settings.knapsack_cuts   = context.settings.knapsack_cuts;
+    branch_and_bound_settings.clique_cuts     = context.settings.clique_cuts;
+    branch_and_bound_settings.flow_cover_cuts = context.settings.flow_cover_cuts;
+    branch_and_bound_settings.node_cut_depth  = context.settings.node_cut_depth;
     branch_and_bound_settings.strong_chvatal_gomory_cuts =
       context.settings.strong_chvatal_gomory_cuts;
     branch_and_bound_settings.reduced_cost_strengthening =
       context.settings.reduced_cost_strengthening;
+    branch_and_bound_settings.symmetry              = context.settings.symmetry;
+    branch_and_bound_settings.conflict_analysis     = context.settings.conflict_analysis;
     branch_and_bound_settings.cut_change_threshold  = context.settings.cut_change_threshold;
     branch_and_bound_settings.cut_min_orthogonality = context.settings.cut_min_orthogonality;
     branch_and_bound_settings.mip_batch_pdlp_strong_branching =
       context.settings.mip_batch_pdlp_strong_branching;
+    branch_and_bound_settings.node_memory_limit   = context.settings.node_memory_limit;
+    branch_and_bound_settings.checkpoint_file     = context.settings.checkpoint_file;
+    branch_and_bound_settings.checkpoint_interval = context.settings.checkpoint_interval;
+    branch_and_bound_settings.checkpoint_split    = context.settings.checkpoint_split;
+    branch_and_bound_settings.trace_file          = context.settings.trace_file;
 
     if (context.settings.num_cpu_threads < 0) {
       branch_and_bound_settings.num_threads = std::max(1, omp_get_max_threads() - 1);
     } else {
-      branch_and_bound_settings.num_threads = std::max(1, context.settings.num_cpu_threads);
+      // The thread count bounds the whole solve: B&B comes first and leaves one thread to the CPU
+      // heuristics when there are several
+      const i_t num_cpu_threads = context.settings.num_cpu_threads;
+      branch_and_bound_settings.num_threads =
+        std::max(1, context.cpu_threads.acquire(std::max(1, num_cpu_threads - 1)));
     }
 
     // Set the branch and bound -> primal heuristics callback
@@ -251,6 +275,7 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
     branch_and_bound = std::make_unique<dual_simplex::branch_and_bound_t<i_t, f_t>>(
       branch_and_bound_problem, branch_and_bound_settings, timer_.get_tic_start());
     context.branch_and_bound_ptr = branch_and_bound.get();
+    branch_and_bound->set_incumbent_bus(&context.incumbent_bus);
     auto* stats_ptr              = &context.stats;
     branch_and_bound->set_user_bound_callback(
       [stats_ptr](f_t user_bound) { stats_ptr->set_solution_bound(user_bound); });
@@ -301,13 +326,29 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
   if (run_bb) {
     // Wait for the branch and bound to finish
     auto bb_status = branch_and_bound_status_future.get();
-    if (branch_and_bound_solution.lower_bound > -std::numeric_limits<f_t>::infinity()) {
+    // The bound of a checkpoint part only covers its subtrees, the solve reports its solution
+    // without a bound of the problem
+    if (!branch_and_bound->is_solving_checkpoint_part() &&
+        branch_and_bound_solution.lower_bound > -std::numeric_limits<f_t>::infinity()) {
       context.stats.set_solution_bound(
         context.problem_ptr->get_user_obj_from_solver_obj(branch_and_bound_solution.lower_bound));
     }
     if (bb_status == dual_simplex::mip_status_t::INFEASIBLE) { sol.set_problem_fully_reduced(); }
     context.stats.num_nodes              = branch_and_bound_solution.nodes_explored;
     context.stats.num_simplex_iterations = branch_and_bound_solution.simplex_iterations;
+    if (context.settings.benchmark_info_ptr != nullptr) {
+      auto contention = branch_and_bound->get_contention_stats();
+      auto& info      = *context.settings.benchmark_info_ptr;
+
+      info.tree_search_time               = contention.tree_search_time;
+      info.tree_search_nodes              = contention.nodes_explored;
+      info.upper_bound_lock_wait_time     = contention.upper_wait_time;
+      info.heuristic_queue_lock_wait_time = contention.heuristic_queue_wait_time;
+      info.original_lp_lock_wait_time     = contention.original_lp_wait_time;
+      info.num_contended_locks            = contention.num_contended_locks;
+      info.worker_idle_time.assign(contention.worker_idle_time.begin(),
+                                   contention.worker_idle_time.end());
+    }
   }
   sol.compute_feasibility();
   rmm::device_scalar<i_t> is_feasible(sol.handle_ptr->get_stream());
@@ -10,7 +10,10 @@
 #include <mip_heuristics/problem/problem.cuh>
 #include <mip_heuristics/relaxed_lp/lp_state.cuh>
 #include <pdlp/initial_scaling_strategy/initial_scaling.cuh>
+#include <utilities/cpu_thread_budget.hpp>
+#include <utilities/incumbent_bus.hpp>
 #include <utilities/work_limit_context.hpp>
+#include <utilities/work_unit_calibration.hpp>
 #include <utilities/work_unit_scheduler.hpp>
 
 #include <limits>
@@ -28,6 +31,9 @@ namespace cuopt::linear_programming::detail {
 template <typename i_t, typename f_t>
 class diversity_manager_t;
 
+template <typename i_t, typename f_t>
+class load_balanced_problem_cache_t;
+
 // Aggregate structure containing the global context of the solving process for convenience:
 // The current problem, user settings, raft handle and statistics objects
 template <typename i_t, typename f_t>
@@ -42,6 +48,7 @@ struct mip_solver_context_t {
     stats.set_solution_bound(problem_ptr->maximize ? std::numeric_limits<f_t>::infinity()
                                                    : -std::numeric_limits<f_t>::infinity());
     gpu_heur_loop.deterministic = settings.determinism_mode == CUOPT_MODE_DETERMINISTIC;
+    if (settings.num_cpu_threads >= 0) { cpu_threads.set_limit(settings.num_cpu_threads); }
   }
 
   mip_solver_context_t(const mip_solver_context_t&)            = delete;
@@ -55,9 +62,17 @@ struct mip_solver_context_t {
   const mip_solver_settings_t<i_t, f_t> settings;
   pdlp_initial_scaling_strategy_t<i_t, f_t>& scaling;
   solver_stats_t<i_t, f_t> stats;
+  // Objective cutoff and global lower bound shared by B&B and the heuristics without locks
+  incumbent_bus_t incumbent_bus;
+  // Bounded by num_cpu_threads when it is set, branch-and-bound takes its threads first
+  cpu_thread_budget_t cpu_threads;
   // Work limit context for tracking work units in deterministic mode (shared across all timers in
   // GPU heuristic loop)
   work_limit_context_t gpu_heur_loop{"GPUHeur"};
+  // Scale of the CPU climber work estimates on this machine, see mip_work_unit_calibration_file
+  work_unit_calibration_t work_unit_calibration;
+  // Load balanced representation of problem_ptr shared by its consumers, created on first use
+  std::shared_ptr<load_balanced_problem_cache_t<i_t, f_t>> lb_problem_cache;
 
   // synchronization every 5 seconds for deterministic mode
   work_unit_scheduler_t work_unit_scheduler_{5.0};
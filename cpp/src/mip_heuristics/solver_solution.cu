@@ -174,6 +174,12 @@ solver_stats_t<i_t, f_t> mip_solution_t<i_t, f_t>::get_stats() const
   return stats_;
 }
 
+template <typename i_t, typename f_t>
+solver_stats_t<i_t, f_t>& mip_solution_t<i_t, f_t>::get_stats()
+{
+  return stats_;
+}
+
 template <typename i_t, typename f_t>
 i_t mip_solution_t<i_t, f_t>::get_num_nodes() const
 {
@@ -210,7 +216,16 @@ void mip_solution_t<i_t, f_t>::write_to_sol_file(std::string_view filename,
   }
 
   double objective_value = get_objective_value();
-  auto& var_names        = get_variable_names();
+  if (solution_writer_t::is_binary_sol_file(std::string(filename))) {
+    solution_writer_t::write_solution_to_binary_sol_file(std::string(filename),
+                                                         status,
+                                                         objective_value,
+                                                         solution_.data(),
+                                                         solution_.size(),
+                                                         stream_view);
+    return;
+  }
+  auto& var_names = get_variable_names();
   std::vector<f_t> solution;
   solution.resize(solution_.size());
   raft::copy(solution.data(), solution_.data(), solution_.size(), stream_view.value());
@@ -230,7 +245,11 @@ void mip_solution_t<i_t, f_t>::log_summary() const
   CUOPT_LOG_INFO("Max variable bound violation: %f", get_max_variable_bound_violation());
   CUOPT_LOG_INFO("MIP Gap: %f", get_mip_gap());
   CUOPT_LOG_INFO("Solution Bound: %f", get_solution_bound());
+  CUOPT_LOG_INFO("Setup Time: %f", stats_.setup_time);
   CUOPT_LOG_INFO("Presolve Time: %f", get_presolve_time());
+  CUOPT_LOG_INFO("Preprocess Time: %f", stats_.preprocess_time);
+  CUOPT_LOG_INFO("Search Time: %f", stats_.search_time);
+  CUOPT_LOG_INFO("Postsolve Time: %f", stats_.postsolve_time);
   CUOPT_LOG_INFO("Total Solve Time: %f", get_total_solve_time());
 }
 
@@ -0,0 +1,203 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/utilities/internals.hpp>
+#include <utilities/logger.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+/**
+ * @brief Delivers the incumbents to the user get solution callbacks on a dedicated thread, so a
+ * slow callback does not hold up the solver thread that found the incumbent.
+ *
+ * An incumbent is copied to a pinned host snapshot on the solver stream and the delivery thread,
+ * not the solver, waits for the copy. At most max_pending incumbents wait for delivery; when the
+ * user falls behind the oldest ones are dropped, the latest incumbent is always delivered.
+ *
+ * The set solution callbacks are not handled here, they run on the solver thread so the solutions
+ * they return are injected right away.
+ */
+template <typename f_t>
+class solution_callback_queue_t {
+ public:
+  solution_callback_queue_t(const std::vector<internals::base_solution_callback_t*>& callbacks,
+                            size_t max_pending = 4)
+    : max_pending_(max_pending)
+  {
+    for (auto callback : callbacks) {
+      if (callback->get_type() == internals::base_solution_callback_type::GET_SOLUTION) {
+        get_callbacks_.push_back(static_cast<internals::get_solution_callback_t*>(callback));
+      }
+    }
+    RAFT_CUDA_TRY(cudaGetDevice(&device_));
+    worker_ = std::thread(&solution_callback_queue_t::run, this);
+  }
+
+  solution_callback_queue_t(const solution_callback_queue_t&)            = delete;
+  solution_callback_queue_t& operator=(const solution_callback_queue_t&) = delete;
+
+  // Delivers the queued incumbents before returning
+  ~solution_callback_queue_t()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) { worker_.join(); }
+    for (auto& snapshot : snapshots_) {
+      if (snapshot->copied != nullptr) {
+        RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(snapshot->copied));
+      }
+      if (snapshot->data != nullptr) { RAFT_CUDA_TRY_NO_THROW(cudaFreeHost(snapshot->data)); }
+    }
+  }
+
+  bool has_get_callbacks() const { return !get_callbacks_.empty(); }
+
+  // Queues the incumbent, d_assignment only needs to stay valid in stream order
+  void push_incumbent(const f_t* d_assignment,
+                      size_t n_variables,
+                      f_t objective,
+                      f_t bound,
+                      rmm::cuda_stream_view stream)
+  {
+    if (!has_get_callbacks()) { return; }
+    snapshot_t* snapshot = acquire_snapshot(n_variables);
+    snapshot->size       = n_variables;
+    snapshot->objective  = objective;
+    snapshot->bound      = bound;
+    RAFT_CUDA_TRY(cudaMemcpyAsync(snapshot->data,
+                                  d_assignment,
+                                  n_variables * sizeof(f_t),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+    RAFT_CUDA_TRY(cudaEventRecord(snapshot->copied, stream.value()));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.push_back(snapshot);
+      while (pending_.size() > max_pending_) {
+        free_.push_back(pending_.front());
+        pending_.pop_front();
+      }
+    }
+    cv_.notify_all();
+  }
+
+  // Waits until every queued incumbent is delivered
+  void flush()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pending_.empty() && !delivering_; });
+  }
+
+ private:
+  struct snapshot_t {
+    f_t* data{nullptr};
+    size_t capacity{0};
+    size_t size{0};
+    f_t objective{};
+    f_t bound{};
+    cudaEvent_t copied{nullptr};
+  };
+
+  snapshot_t* acquire_snapshot(size_t n_variables)
+  {
+    snapshot_t* snapshot = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_.empty()) {
+        snapshot = free_.back();
+        free_.pop_back();
+      } else {
+        snapshots_.push_back(std::make_unique<snapshot_t>());
+        snapshot = snapshots_.back().get();
+      }
+    }
+    if (snapshot->copied == nullptr) {
+      RAFT_CUDA_TRY(cudaEventCreateWithFlags(&snapshot->copied, cudaEventDisableTiming));
+    }
+    // a dropped snapshot might still be copied to
+    RAFT_CUDA_TRY(cudaEventSynchronize(snapshot->copied));
+    if (snapshot->capacity < n_variables) {
+      if (snapshot->data != nullptr) { RAFT_CUDA_TRY(cudaFreeHost(snapshot->data)); }
+      snapshot->data = nullptr;
+      RAFT_CUDA_TRY(
+        cudaMallocHost(reinterpret_cast<void**>(&snapshot->data), n_variables * sizeof(f_t)));
+      snapshot->capacity = n_variables;
+    }
+    return snapshot;
+  }
+
+  void deliver(snapshot_t* snapshot)
+  {
+    RAFT_CUDA_TRY_NO_THROW(cudaEventSynchronize(snapshot->copied));
+    // the callbacks may write to their buffers
+    std::vector<f_t> assignment(snapshot->data, snapshot->data + snapshot->size);
+    for (auto callback : get_callbacks_) {
+      f_t objective = snapshot->objective;
+      f_t bound     = snapshot->bound;
+      try {
+        callback->get_solution(assignment.data(), &objective, &bound, callback->get_user_data());
+      } catch (const std::exception& e) {
+        CUOPT_LOG_ERROR("Get solution callback failed: %s", e.what());
+      }
+    }
+  }
+
+  void run()
+  {
+    RAFT_CUDA_TRY_NO_THROW(cudaSetDevice(device_));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+      if (!pending_.empty()) {
+        snapshot_t* snapshot = pending_.front();
+        pending_.pop_front();
+        delivering_ = true;
+        lock.unlock();
+        deliver(snapshot);
+        lock.lock();
+        free_.push_back(snapshot);
+        delivering_ = false;
+        cv_.notify_all();
+      } else if (stop_) {
+        break;
+      }
+    }
+  }
+
+  std::vector<internals::get_solution_callback_t*> get_callbacks_;
+  const size_t max_pending_;
+
+  int device_{0};
+  // all the snapshots, the pointers move between the queues below
+  std::vector<std::unique_ptr<snapshot_t>> snapshots_;
+  std::deque<snapshot_t*> pending_;
+  std::vector<snapshot_t*> free_;
+  bool delivering_ = false;
+  bool stop_       = false;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread worker_;
+};
+
+}  // namespace cuopt::linear_programming::detail
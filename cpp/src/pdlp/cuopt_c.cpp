@@ -14,13 +14,24 @@
 #include <pdlp/cuopt_c_internal.hpp>
 #include <utilities/logger.hpp>
 
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/mr/cuda_async_memory_resource.hpp>
+#include <rmm/mr/per_device_resource.hpp>
+
+#include <mps_parser/binary_format.hpp>
 #include <mps_parser/parser.hpp>
 
 #include <cuopt/version_config.hpp>
 
 #include <cstdlib>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace cuopt::mps_parser;
@@ -103,8 +114,13 @@ cuopt_int_t cuOptReadProblem(const char* filename, cuOptOptimizationProblem* pro
   bool input_mps_strict = false;
   std::unique_ptr<mps_data_model_t<cuopt_int_t, cuopt_float_t>> mps_data_model_ptr;
   try {
-    mps_data_model_ptr = std::make_unique<mps_data_model_t<cuopt_int_t, cuopt_float_t>>(
-      parse_mps<cuopt_int_t, cuopt_float_t>(filename_str, input_mps_strict));
+    if (cuopt::mps_parser::is_binary_problem_file(filename_str)) {
+      mps_data_model_ptr = std::make_unique<mps_data_model_t<cuopt_int_t, cuopt_float_t>>(
+        cuopt::mps_parser::parse_binary<cuopt_int_t, cuopt_float_t>(filename_str));
+    } else {
+      mps_data_model_ptr = std::make_unique<mps_data_model_t<cuopt_int_t, cuopt_float_t>>(
+        parse_mps<cuopt_int_t, cuopt_float_t>(filename_str, input_mps_strict));
+    }
   } catch (const std::exception& e) {
     CUOPT_LOG_INFO("Error parsing MPS file: %s", e.what());
     *problem_ptr = nullptr;
@@ -129,12 +145,18 @@ cuopt_int_t cuOptWriteProblem(cuOptOptimizationProblem problem,
   if (problem == nullptr) { return CUOPT_INVALID_ARGUMENT; }
   if (filename == nullptr) { return CUOPT_INVALID_ARGUMENT; }
   if (strlen(filename) == 0) { return CUOPT_INVALID_ARGUMENT; }
-  if (format != CUOPT_FILE_FORMAT_MPS) { return CUOPT_INVALID_ARGUMENT; }
+  if (format != CUOPT_FILE_FORMAT_MPS && format != CUOPT_FILE_FORMAT_BINARY) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
 
   problem_and_stream_view_t* problem_and_stream_view =
     static_cast<problem_and_stream_view_t*>(problem);
   try {
-    problem_and_stream_view->op_problem->write_to_mps(std::string(filename));
+    if (format == CUOPT_FILE_FORMAT_BINARY) {
+      problem_and_stream_view->op_problem->write_to_binary(std::string(filename));
+    } else {
+      problem_and_stream_view->op_problem->write_to_mps(std::string(filename));
+    }
   } catch (const std::exception& e) {
     CUOPT_LOG_INFO("Error writing MPS file: %s", e.what());
     return CUOPT_MPS_FILE_ERROR;
@@ -258,6 +280,159 @@ cuopt_int_t cuOptCreateRangedProblem(cuopt_int_t num_constraints,
   return CUOPT_SUCCESS;
 }
 
+// Orders the work queued on the problem stream after the work already queued on the caller stream
+static void wait_for_stream(rmm::cuda_stream_view problem_stream, void* stream)
+{
+  cudaEvent_t event;
+  RAFT_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  RAFT_CUDA_TRY(cudaEventRecord(event, static_cast<cudaStream_t>(stream)));
+  RAFT_CUDA_TRY(cudaStreamWaitEvent(problem_stream.value(), event, 0));
+  RAFT_CUDA_TRY(cudaEventDestroy(event));
+}
+
+// Releases a problem whose creation failed part way
+static void destroy_partial_problem(problem_and_stream_view_t* problem_and_stream)
+{
+  delete problem_and_stream->op_problem;
+  delete problem_and_stream;
+}
+
+cuopt_int_t cuOptCreateProblemFromDevice(cuopt_int_t num_constraints,
+                                         cuopt_int_t num_variables,
+                                         cuopt_int_t objective_sense,
+                                         cuopt_float_t objective_offset,
+                                         const cuopt_float_t* objective_coefficients,
+                                         const cuopt_int_t* constraint_matrix_row_offsets,
+                                         const cuopt_int_t* constraint_matrix_column_indices,
+                                         const cuopt_float_t* constraint_matrix_coefficent_values,
+                                         const char* constraint_sense,
+                                         const cuopt_float_t* rhs,
+                                         const cuopt_float_t* lower_bounds,
+                                         const cuopt_float_t* upper_bounds,
+                                         const char* variable_types,
+                                         void* stream,
+                                         cuOptOptimizationProblem* problem_ptr)
+{
+  cuopt::utilities::printTimestamp("CUOPT_CREATE_PROBLEM");
+
+  if (problem_ptr == nullptr || objective_coefficients == nullptr ||
+      constraint_matrix_row_offsets == nullptr || constraint_matrix_column_indices == nullptr ||
+      constraint_matrix_coefficent_values == nullptr || constraint_sense == nullptr ||
+      rhs == nullptr || lower_bounds == nullptr || upper_bounds == nullptr ||
+      variable_types == nullptr) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+
+  problem_and_stream_view_t* problem_and_stream = new problem_and_stream_view_t();
+  problem_and_stream->op_problem =
+    new optimization_problem_t<cuopt_int_t, cuopt_float_t>(problem_and_stream->get_handle_ptr());
+  try {
+    wait_for_stream(problem_and_stream->stream_view, stream);
+    cuopt_int_t nnz;
+    raft::copy(
+      &nnz, constraint_matrix_row_offsets + num_constraints, 1, problem_and_stream->stream_view);
+    problem_and_stream->stream_view.synchronize();
+    problem_and_stream->op_problem->set_maximize(objective_sense == CUOPT_MAXIMIZE);
+    problem_and_stream->op_problem->set_objective_offset(objective_offset);
+    problem_and_stream->op_problem->set_objective_coefficients(objective_coefficients,
+                                                               num_variables);
+    problem_and_stream->op_problem->set_csr_constraint_matrix(constraint_matrix_coefficent_values,
+                                                              nnz,
+                                                              constraint_matrix_column_indices,
+                                                              nnz,
+                                                              constraint_matrix_row_offsets,
+                                                              num_constraints + 1);
+    problem_and_stream->op_problem->set_row_types(constraint_sense, num_constraints);
+    problem_and_stream->op_problem->set_constraint_bounds(rhs, num_constraints);
+    problem_and_stream->op_problem->set_variable_lower_bounds(lower_bounds, num_variables);
+    problem_and_stream->op_problem->set_variable_upper_bounds(upper_bounds, num_variables);
+    set_variable_types_from_device(
+      *problem_and_stream->op_problem, variable_types, num_variables);
+    problem_and_stream->stream_view.synchronize();
+    *problem_ptr = static_cast<cuOptOptimizationProblem>(problem_and_stream);
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory creating the problem from device arrays: %s", e.what());
+    destroy_partial_problem(problem_and_stream);
+    *problem_ptr = nullptr;
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error creating the problem from device arrays: %s", e.what());
+    destroy_partial_problem(problem_and_stream);
+    *problem_ptr = nullptr;
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  return CUOPT_SUCCESS;
+}
+
+cuopt_int_t cuOptCreateRangedProblemFromDevice(cuopt_int_t num_constraints,
+                                               cuopt_int_t num_variables,
+                                               cuopt_int_t objective_sense,
+                                               cuopt_float_t objective_offset,
+                                               const cuopt_float_t* objective_coefficients,
+                                               const cuopt_int_t* constraint_matrix_row_offsets,
+                                               const cuopt_int_t* constraint_matrix_column_indices,
+                                               const cuopt_float_t* constraint_matrix_coefficients,
+                                               const cuopt_float_t* constraint_lower_bounds,
+                                               const cuopt_float_t* constraint_upper_bounds,
+                                               const cuopt_float_t* variable_lower_bounds,
+                                               const cuopt_float_t* variable_upper_bounds,
+                                               const char* variable_types,
+                                               void* stream,
+                                               cuOptOptimizationProblem* problem_ptr)
+{
+  cuopt::utilities::printTimestamp("CUOPT_CREATE_PROBLEM");
+
+  if (problem_ptr == nullptr || objective_coefficients == nullptr ||
+      constraint_matrix_row_offsets == nullptr || constraint_matrix_column_indices == nullptr ||
+      constraint_matrix_coefficients == nullptr || constraint_lower_bounds == nullptr ||
+      constraint_upper_bounds == nullptr || variable_lower_bounds == nullptr ||
+      variable_upper_bounds == nullptr || variable_types == nullptr) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+
+  problem_and_stream_view_t* problem_and_stream = new problem_and_stream_view_t();
+  problem_and_stream->op_problem =
+    new optimization_problem_t<cuopt_int_t, cuopt_float_t>(problem_and_stream->get_handle_ptr());
+  try {
+    wait_for_stream(problem_and_stream->stream_view, stream);
+    cuopt_int_t nnz;
+    raft::copy(
+      &nnz, constraint_matrix_row_offsets + num_constraints, 1, problem_and_stream->stream_view);
+    problem_and_stream->stream_view.synchronize();
+    problem_and_stream->op_problem->set_maximize(objective_sense == CUOPT_MAXIMIZE);
+    problem_and_stream->op_problem->set_objective_offset(objective_offset);
+    problem_and_stream->op_problem->set_objective_coefficients(objective_coefficients,
+                                                               num_variables);
+    problem_and_stream->op_problem->set_csr_constraint_matrix(constraint_matrix_coefficients,
+                                                              nnz,
+                                                              constraint_matrix_column_indices,
+                                                              nnz,
+                                                              constraint_matrix_row_offsets,
+                                                              num_constraints + 1);
+    problem_and_stream->op_problem->set_constraint_lower_bounds(constraint_lower_bounds,
+                                                                num_constraints);
+    problem_and_stream->op_problem->set_constraint_upper_bounds(constraint_upper_bounds,
+                                                                num_constraints);
+    problem_and_stream->op_problem->set_variable_lower_bounds(variable_lower_bounds, num_variables);
+    problem_and_stream->op_problem->set_variable_upper_bounds(variable_upper_bounds, num_variables);
+    set_variable_types_from_device(
+      *problem_and_stream->op_problem, variable_types, num_variables);
+    problem_and_stream->stream_view.synchronize();
+    *problem_ptr = static_cast<cuOptOptimizationProblem>(problem_and_stream);
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory creating the problem from device arrays: %s", e.what());
+    destroy_partial_problem(problem_and_stream);
+    *problem_ptr = nullptr;
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error creating the problem from device arrays: %s", e.what());
+    destroy_partial_problem(problem_and_stream);
+    *problem_ptr = nullptr;
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  return CUOPT_SUCCESS;
+}
+
 cuopt_int_t cuOptCreateQuadraticProblem(
   cuopt_int_t num_constraints,
   cuopt_int_t num_variables,
@@ -621,6 +796,252 @@ cuopt_int_t cuOptGetVariableTypes(cuOptOptimizationProblem problem, char* variab
   return CUOPT_SUCCESS;
 }
 
+// Whether the num_entries indices are all within [0, size)
+static bool indices_in_range(const cuopt_int_t* indices, cuopt_int_t num_entries, size_t size)
+{
+  for (cuopt_int_t i = 0; i < num_entries; ++i) {
+    if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= size) { return false; }
+  }
+  return true;
+}
+
+cuopt_int_t cuOptSetObjectiveCoefficients(cuOptOptimizationProblem problem,
+                                          cuopt_int_t num_entries,
+                                          const cuopt_int_t* variable_indices,
+                                          const cuopt_float_t* objective_coefficients)
+{
+  if (problem == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries < 0) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries > 0 && (variable_indices == nullptr || objective_coefficients == nullptr)) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view_t* problem_and_stream_view =
+    static_cast<problem_and_stream_view_t*>(problem);
+  rmm::device_uvector<cuopt_float_t>& objective_coefficients_device =
+    problem_and_stream_view->op_problem->get_objective_coefficients();
+  if (!indices_in_range(variable_indices, num_entries, objective_coefficients_device.size())) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  try {
+    scatter_to_device(objective_coefficients_device,
+                      variable_indices,
+                      objective_coefficients,
+                      num_entries,
+                      problem_and_stream_view->stream_view);
+    problem_and_stream_view->stream_view.synchronize();
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory modifying the problem: %s", e.what());
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error modifying the problem: %s", e.what());
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view->modified_since_solve = true;
+  return CUOPT_SUCCESS;
+}
+
+cuopt_int_t cuOptSetVariableBounds(cuOptOptimizationProblem problem,
+                                   cuopt_int_t num_entries,
+                                   const cuopt_int_t* variable_indices,
+                                   const cuopt_float_t* lower_bounds,
+                                   const cuopt_float_t* upper_bounds)
+{
+  if (problem == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries < 0) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries > 0 &&
+      (variable_indices == nullptr || lower_bounds == nullptr || upper_bounds == nullptr)) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view_t* problem_and_stream_view =
+    static_cast<problem_and_stream_view_t*>(problem);
+  rmm::device_uvector<cuopt_float_t>& lower_bounds_device =
+    problem_and_stream_view->op_problem->get_variable_lower_bounds();
+  rmm::device_uvector<cuopt_float_t>& upper_bounds_device =
+    problem_and_stream_view->op_problem->get_variable_upper_bounds();
+  if (!indices_in_range(variable_indices, num_entries, lower_bounds_device.size()) ||
+      !indices_in_range(variable_indices, num_entries, upper_bounds_device.size())) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  try {
+    scatter_to_device(lower_bounds_device,
+                      variable_indices,
+                      lower_bounds,
+                      num_entries,
+                      problem_and_stream_view->stream_view);
+    scatter_to_device(upper_bounds_device,
+                      variable_indices,
+                      upper_bounds,
+                      num_entries,
+                      problem_and_stream_view->stream_view);
+    problem_and_stream_view->stream_view.synchronize();
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory modifying the problem: %s", e.what());
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error modifying the problem: %s", e.what());
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view->modified_since_solve = true;
+  return CUOPT_SUCCESS;
+}
+
+cuopt_int_t cuOptSetConstraintBounds(cuOptOptimizationProblem problem,
+                                     cuopt_int_t num_entries,
+                                     const cuopt_int_t* constraint_indices,
+                                     const cuopt_float_t* lower_bounds,
+                                     const cuopt_float_t* upper_bounds)
+{
+  if (problem == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries < 0) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries > 0 &&
+      (constraint_indices == nullptr || lower_bounds == nullptr || upper_bounds == nullptr)) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view_t* problem_and_stream_view =
+    static_cast<problem_and_stream_view_t*>(problem);
+  rmm::device_uvector<cuopt_float_t>& lower_bounds_device =
+    problem_and_stream_view->op_problem->get_constraint_lower_bounds();
+  rmm::device_uvector<cuopt_float_t>& upper_bounds_device =
+    problem_and_stream_view->op_problem->get_constraint_upper_bounds();
+  if (!indices_in_range(constraint_indices, num_entries, lower_bounds_device.size()) ||
+      !indices_in_range(constraint_indices, num_entries, upper_bounds_device.size())) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  try {
+    scatter_to_device(lower_bounds_device,
+                      constraint_indices,
+                      lower_bounds,
+                      num_entries,
+                      problem_and_stream_view->stream_view);
+    scatter_to_device(upper_bounds_device,
+                      constraint_indices,
+                      upper_bounds,
+                      num_entries,
+                      problem_and_stream_view->stream_view);
+    problem_and_stream_view->stream_view.synchronize();
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory modifying the problem: %s", e.what());
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error modifying the problem: %s", e.what());
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view->modified_since_solve = true;
+  return CUOPT_SUCCESS;
+}
+
+cuopt_int_t cuOptSetConstraintRightHandSide(cuOptOptimizationProblem problem,
+                                            cuopt_int_t num_entries,
+                                            const cuopt_int_t* constraint_indices,
+                                            const cuopt_float_t* rhs)
+{
+  if (problem == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries < 0) { return CUOPT_INVALID_ARGUMENT; }
+  if (num_entries > 0 && (constraint_indices == nullptr || rhs == nullptr)) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view_t* problem_and_stream_view =
+    static_cast<problem_and_stream_view_t*>(problem);
+  rmm::device_uvector<cuopt_float_t>& rhs_device =
+    problem_and_stream_view->op_problem->get_constraint_bounds();
+  if (!indices_in_range(constraint_indices, num_entries, rhs_device.size())) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  try {
+    scatter_to_device(
+      rhs_device, constraint_indices, rhs, num_entries, problem_and_stream_view->stream_view);
+    problem_and_stream_view->stream_view.synchronize();
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_INFO("Out of memory modifying the problem: %s", e.what());
+    return CUOPT_OUT_OF_MEMORY;
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error modifying the problem: %s", e.what());
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  problem_and_stream_view->modified_since_solve = true;
+  return CUOPT_SUCCESS;
+}
+
+namespace {
+
+struct device_memory_pool_t {
+  std::unique_ptr<rmm::mr::cuda_async_memory_resource> resource;
+  rmm::mr::device_memory_resource* previous_resource{nullptr};
+  int n_leases{0};
+};
+
+std::mutex memory_pool_mutex;
+std::unordered_map<int, device_memory_pool_t> memory_pools;
+// Pools over which another resource was installed, it may still allocate from them
+std::vector<std::unique_ptr<rmm::mr::cuda_async_memory_resource>> detached_memory_pools;
+
+}  // namespace
+
+cuopt::linear_programming::device_memory_pool_lease_t::device_memory_pool_lease_t(
+  rmm::cuda_device_id device_id)
+  : device_id_(device_id)
+{
+  std::lock_guard<std::mutex> lock(memory_pool_mutex);
+  auto& pool = memory_pools[device_id_.value()];
+  if (pool.n_leases == 0) {
+    pool.resource          = std::make_unique<rmm::mr::cuda_async_memory_resource>(
+      std::nullopt, std::numeric_limits<std::size_t>::max());
+    pool.previous_resource = rmm::mr::set_per_device_resource(device_id_, pool.resource.get());
+  }
+  ++pool.n_leases;
+}
+
+cuopt::linear_programming::device_memory_pool_lease_t::~device_memory_pool_lease_t()
+{
+  std::lock_guard<std::mutex> lock(memory_pool_mutex);
+  auto& pool = memory_pools[device_id_.value()];
+  if (--pool.n_leases > 0) { return; }
+  if (rmm::mr::get_per_device_resource(device_id_) == pool.resource.get()) {
+    rmm::mr::set_per_device_resource(device_id_, pool.previous_resource);
+  } else {
+    CUOPT_LOG_WARN(
+      "Device %d resource replaced while solver contexts were alive, the previous one is not "
+      "restored",
+      device_id_.value());
+    detached_memory_pools.push_back(std::move(pool.resource));
+  }
+  memory_pools.erase(device_id_.value());
+}
+
+solver_context_t*& cuopt::linear_programming::current_solver_context()
+{
+  thread_local solver_context_t* context = nullptr;
+  return context;
+}
+
+cuopt_int_t cuOptCreateSolverContext(cuOptSolverContext* context_ptr)
+{
+  if (context_ptr == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  try {
+    *context_ptr = static_cast<cuOptSolverContext>(new solver_context_t());
+  } catch (const std::exception& e) {
+    CUOPT_LOG_INFO("Error creating solver context: %s", e.what());
+    return CUOPT_RUNTIME_ERROR;
+  }
+  return CUOPT_SUCCESS;
+}
+
+void cuOptDestroySolverContext(cuOptSolverContext* context_ptr)
+{
+  if (context_ptr == nullptr) { return; }
+  if (*context_ptr == nullptr) { return; }
+  auto* context = static_cast<solver_context_t*>(*context_ptr);
+  if (current_solver_context() == context) { current_solver_context() = nullptr; }
+  delete context;
+  *context_ptr = nullptr;
+}
+
+cuopt_int_t cuOptSetSolverContext(cuOptSolverContext context)
+{
+  current_solver_context() = static_cast<solver_context_t*>(context);
+  return CUOPT_SUCCESS;
+}
+
 cuopt_int_t cuOptCreateSolverSettings(cuOptSolverSettings* settings_ptr)
 {
   if (settings_ptr == nullptr) { return CUOPT_INVALID_ARGUMENT; }
@@ -848,6 +1269,26 @@ cuopt_int_t cuOptIsMIP(cuOptOptimizationProblem problem, cuopt_int_t* is_mip_ptr
   return CUOPT_SUCCESS;
 }
 
+// Keeps a copy of the solution of the problem to warm start the solve following a modification
+static void keep_last_solution(problem_and_stream_view_t& problem_and_stream_view,
+                               const rmm::device_uvector<cuopt_float_t>& primal_solution,
+                               const cuopt_float_t* dual_solution,
+                               size_t dual_solution_size)
+{
+  auto stream_view = problem_and_stream_view.stream_view;
+  problem_and_stream_view.last_primal_solution.resize(primal_solution.size(), stream_view);
+  raft::copy(problem_and_stream_view.last_primal_solution.data(),
+             primal_solution.data(),
+             primal_solution.size(),
+             stream_view);
+  problem_and_stream_view.last_dual_solution.resize(dual_solution_size, stream_view);
+  raft::copy(problem_and_stream_view.last_dual_solution.data(),
+             dual_solution,
+             dual_solution_size,
+             stream_view);
+  problem_and_stream_view.modified_since_solve = false;
+}
+
 cuopt_int_t cuOptSolve(cuOptOptimizationProblem problem,
                        cuOptSolverSettings settings,
                        cuOptSolution* solution_ptr)
@@ -867,11 +1308,36 @@ cuopt_int_t cuOptSolve(cuOptOptimizationProblem problem,
       solver_settings->get_mip_settings();
     optimization_problem_t<cuopt_int_t, cuopt_float_t>* op_problem =
       problem_and_stream_view->op_problem;
+    // After an in place modification the last solution is passed as a MIP start, on a copy so
+    // that the settings of the caller are left as they are
+    mip_solver_settings_t<cuopt_int_t, cuopt_float_t> warm_start_settings = mip_settings;
+    if (problem_and_stream_view->modified_since_solve &&
+        problem_and_stream_view->last_primal_solution.size() ==
+          static_cast<size_t>(op_problem->get_n_variables())) {
+      warm_start_settings.add_initial_solution(problem_and_stream_view->last_primal_solution.data(),
+                                               op_problem->get_n_variables(),
+                                               problem_and_stream_view->stream_view);
+    }
     solution_and_stream_view_t* solution_and_stream_view =
       new solution_and_stream_view_t(true, problem_and_stream_view->stream_view);
     solution_and_stream_view->mip_solution_ptr = new mip_solution_t<cuopt_int_t, cuopt_float_t>(
-      solve_mip<cuopt_int_t, cuopt_float_t>(*op_problem, mip_settings));
+      solve_mip<cuopt_int_t, cuopt_float_t>(*op_problem, warm_start_settings));
     *solution_ptr = static_cast<cuOptSolution>(solution_and_stream_view);
+    // Only a feasible solution is worth passing as a MIP start, drop the previous one otherwise
+    const mip_termination_status_t termination_status =
+      solution_and_stream_view->mip_solution_ptr->get_termination_status();
+    if (termination_status == mip_termination_status_t::Optimal ||
+        termination_status == mip_termination_status_t::FeasibleFound) {
+      keep_last_solution(*problem_and_stream_view,
+                         solution_and_stream_view->mip_solution_ptr->get_solution(),
+                         nullptr,
+                         0);
+    } else {
+      problem_and_stream_view->last_primal_solution.resize(0,
+                                                           problem_and_stream_view->stream_view);
+      problem_and_stream_view->last_dual_solution.resize(0, problem_and_stream_view->stream_view);
+      problem_and_stream_view->modified_since_solve = false;
+    }
 
     cuopt::utilities::printTimestamp("CUOPT_SOLVE_RETURN");
 
@@ -884,12 +1350,35 @@ cuopt_int_t cuOptSolve(cuOptOptimizationProblem problem,
       solver_settings->get_pdlp_settings();
     optimization_problem_t<cuopt_int_t, cuopt_float_t>* op_problem =
       problem_and_stream_view->op_problem;
+    // After an in place modification the last solution is the initial solution, unless the
+    // settings of the caller already provide one. They are left as they are
+    pdlp_solver_settings_t<cuopt_int_t, cuopt_float_t> warm_start_settings = pdlp_settings;
+    if (problem_and_stream_view->modified_since_solve &&
+        !pdlp_settings.has_initial_primal_solution() &&
+        !pdlp_settings.has_initial_dual_solution() &&
+        problem_and_stream_view->last_primal_solution.size() ==
+          static_cast<size_t>(op_problem->get_n_variables()) &&
+        problem_and_stream_view->last_dual_solution.size() ==
+          static_cast<size_t>(op_problem->get_n_constraints())) {
+      warm_start_settings.set_initial_primal_solution(
+        problem_and_stream_view->last_primal_solution.data(),
+        op_problem->get_n_variables(),
+        problem_and_stream_view->stream_view);
+      warm_start_settings.set_initial_dual_solution(
+        problem_and_stream_view->last_dual_solution.data(),
+        op_problem->get_n_constraints(),
+        problem_and_stream_view->stream_view);
+    }
     solution_and_stream_view_t* solution_and_stream_view =
       new solution_and_stream_view_t(false, problem_and_stream_view->stream_view);
     solution_and_stream_view->lp_solution_ptr =
       new optimization_problem_solution_t<cuopt_int_t, cuopt_float_t>(
-        solve_lp<cuopt_int_t, cuopt_float_t>(*op_problem, pdlp_settings));
+        solve_lp<cuopt_int_t, cuopt_float_t>(*op_problem, warm_start_settings));
     *solution_ptr = static_cast<cuOptSolution>(solution_and_stream_view);
+    keep_last_solution(*problem_and_stream_view,
+                       solution_and_stream_view->lp_solution_ptr->get_primal_solution(),
+                       solution_and_stream_view->lp_solution_ptr->get_dual_solution().data(),
+                       solution_and_stream_view->lp_solution_ptr->get_dual_solution().size());
 
     cuopt::utilities::printTimestamp("CUOPT_SOLVE_RETURN");
 
@@ -1007,6 +1496,31 @@ cuopt_int_t cuOptGetPrimalSolution(cuOptSolution solution, cuopt_float_t* soluti
   return CUOPT_SUCCESS;
 }
 
+cuopt_int_t cuOptGetPrimalSolutionToDevice(cuOptSolution solution,
+                                           cuopt_float_t* solution_values_ptr,
+                                           void* stream)
+{
+  if (solution == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (solution_values_ptr == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  solution_and_stream_view_t* solution_and_stream_view =
+    static_cast<solution_and_stream_view_t*>(solution);
+  const rmm::device_uvector<cuopt_float_t>& solution_values =
+    solution_and_stream_view->is_mip
+      ? solution_and_stream_view->mip_solution_ptr->get_solution()
+      : solution_and_stream_view->lp_solution_ptr->get_primal_solution();
+  try {
+    // the copy is queued on the caller stream once the solution stream is done with the values
+    solution_and_stream_view->stream_view.synchronize();
+    raft::copy(solution_values_ptr,
+               solution_values.data(),
+               solution_values.size(),
+               rmm::cuda_stream_view{static_cast<cudaStream_t>(stream)});
+  } catch (const raft::exception& e) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  return CUOPT_SUCCESS;
+}
+
 cuopt_int_t cuOptGetObjectiveValue(cuOptSolution solution, cuopt_float_t* objective_value_ptr)
 {
   if (solution == nullptr) { return CUOPT_INVALID_ARGUMENT; }
@@ -1047,6 +1561,31 @@ cuopt_int_t cuOptGetSolveTime(cuOptSolution solution, cuopt_float_t* solve_time_
   return CUOPT_SUCCESS;
 }
 
+cuopt_int_t cuOptGetPDLPPhaseTimes(cuOptSolution solution,
+                                   cuopt_float_t* pdhg_step_time_ptr,
+                                   cuopt_float_t* step_size_time_ptr,
+                                   cuopt_float_t* restart_time_ptr,
+                                   cuopt_float_t* termination_check_time_ptr)
+{
+  if (solution == nullptr) { return CUOPT_INVALID_ARGUMENT; }
+  if (pdhg_step_time_ptr == nullptr || step_size_time_ptr == nullptr ||
+      restart_time_ptr == nullptr || termination_check_time_ptr == nullptr) {
+    return CUOPT_INVALID_ARGUMENT;
+  }
+  solution_and_stream_view_t* solution_and_stream_view =
+    static_cast<solution_and_stream_view_t*>(solution);
+  if (solution_and_stream_view->is_mip) { return CUOPT_INVALID_ARGUMENT; }
+  optimization_problem_solution_t<cuopt_int_t, cuopt_float_t>* optimization_problem_solution =
+    static_cast<optimization_problem_solution_t<cuopt_int_t, cuopt_float_t>*>(
+      solution_and_stream_view->lp_solution_ptr);
+  const auto info = optimization_problem_solution->get_additional_termination_information();
+  *pdhg_step_time_ptr         = info.pdhg_step_time;
+  *step_size_time_ptr         = info.step_size_time;
+  *restart_time_ptr           = info.restart_time;
+  *termination_check_time_ptr = info.termination_check_time;
+  return CUOPT_SUCCESS;
+}
+
 cuopt_int_t cuOptGetMIPGap(cuOptSolution solution, cuopt_float_t* mip_gap_ptr)
 {
   if (solution == nullptr) { return CUOPT_INVALID_ARGUMENT; }
@@ -0,0 +1,53 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/cuopt_c_internal.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+namespace cuopt::linear_programming {
+
+void set_variable_types_from_device(optimization_problem_t<cuopt_int_t, cuopt_float_t>& op_problem,
+                                    const char* variable_types,
+                                    cuopt_int_t num_variables)
+{
+  const auto* handle_ptr = op_problem.get_handle_ptr();
+  rmm::device_uvector<var_t> enum_variable_types(num_variables, handle_ptr->get_stream());
+  thrust::transform(handle_ptr->get_thrust_policy(),
+                    variable_types,
+                    variable_types + num_variables,
+                    enum_variable_types.begin(),
+                    [] __device__(char type) {
+                      return type == CUOPT_CONTINUOUS ? var_t::CONTINUOUS : var_t::INTEGER;
+                    });
+  op_problem.set_variable_types(enum_variable_types.data(), num_variables);
+}
+
+void scatter_to_device(rmm::device_uvector<cuopt_float_t>& values,
+                       const cuopt_int_t* indices,
+                       const cuopt_float_t* new_values,
+                       cuopt_int_t num_entries,
+                       rmm::cuda_stream_view stream_view)
+{
+  rmm::device_uvector<cuopt_int_t> d_indices(num_entries, stream_view);
+  rmm::device_uvector<cuopt_float_t> d_new_values(num_entries, stream_view);
+  raft::copy(d_indices.data(), indices, num_entries, stream_view);
+  raft::copy(d_new_values.data(), new_values, num_entries, stream_view);
+  thrust::scatter(rmm::exec_policy(stream_view),
+                  d_new_values.begin(),
+                  d_new_values.end(),
+                  d_indices.begin(),
+                  values.begin());
+}
+
+}  // namespace cuopt::linear_programming
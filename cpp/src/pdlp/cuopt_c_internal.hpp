@@ -14,19 +14,70 @@
 
 #include <raft/core/handle.hpp>
 
+#include <rmm/cuda_device.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 namespace cuopt::linear_programming {
 
+/**
+ * @brief Keeps a stream ordered memory pool installed as the memory resource of a device while it
+ * is alive. The pool of a device is shared by all the leases of the device: the first one installs
+ * it and the last one restores the previous resource, whatever order they are destroyed in. The
+ * previous resource is not restored when another one was installed over the pool in the meantime
+ */
+class device_memory_pool_lease_t {
+ public:
+  explicit device_memory_pool_lease_t(rmm::cuda_device_id device_id);
+  ~device_memory_pool_lease_t();
+
+  device_memory_pool_lease_t(const device_memory_pool_lease_t&)            = delete;
+  device_memory_pool_lease_t& operator=(const device_memory_pool_lease_t&) = delete;
+
+ private:
+  rmm::cuda_device_id device_id_;
+};
+
+/**
+ * @brief Resources shared by the problems created while the context is current on a thread: the
+ * raft handle, and so its cuBLAS/cuSPARSE handles, and a lease on the memory pool of the device,
+ * which keeps the memory it was grown to between solves
+ */
+struct solver_context_t {
+  solver_context_t()
+    : device_id(rmm::get_current_cuda_device()),
+      memory_pool(device_id),
+      handle(rmm::cuda_stream_per_thread)
+  {
+  }
+  rmm::cuda_device_id device_id;
+  device_memory_pool_lease_t memory_pool;
+  raft::handle_t handle;
+};
+
+/**
+ * @brief Context set by cuOptSetSolverContext on the calling thread, nullptr when none is
+ */
+solver_context_t*& current_solver_context();
+
 struct problem_and_stream_view_t {
   problem_and_stream_view_t()
-    : op_problem(nullptr), stream_view(rmm::cuda_stream_per_thread), handle(stream_view)
+    : op_problem(nullptr),
+      stream_view(rmm::cuda_stream_per_thread),
+      handle(stream_view),
+      context(current_solver_context())
   {
   }
-  raft::handle_t* get_handle_ptr() { return &handle; }
+  raft::handle_t* get_handle_ptr() { return context != nullptr ? &context->handle : &handle; }
   optimization_problem_t<cuopt_int_t, cuopt_float_t>* op_problem;
   rmm::cuda_stream_view stream_view;
   raft::handle_t handle;
+  // Context the problem was created in, its handle is used instead of the problem one
+  solver_context_t* context;
+  // Solution of the last solve, the next solve starts from it once the problem is modified in place
+  rmm::device_uvector<cuopt_float_t> last_primal_solution{0, rmm::cuda_stream_per_thread};
+  rmm::device_uvector<cuopt_float_t> last_dual_solution{0, rmm::cuda_stream_per_thread};
+  bool modified_since_solve{false};
 };
 
 struct solution_and_stream_view_t {
@@ -43,4 +94,22 @@ struct solution_and_stream_view_t {
   rmm::cuda_stream_view stream_view;
 };
 
+/**
+ * @brief Sets the variable types of the problem from an array of CUOPT_CONTINUOUS/CUOPT_INTEGER
+ * chars in device memory, converted on the problem stream
+ */
+void set_variable_types_from_device(optimization_problem_t<cuopt_int_t, cuopt_float_t>& op_problem,
+                                    const char* variable_types,
+                                    cuopt_int_t num_variables);
+
+/**
+ * @brief Sets values[indices[i]] to new_values[i] for the host arrays indices and new_values of
+ * size num_entries, on the given stream
+ */
+void scatter_to_device(rmm::device_uvector<cuopt_float_t>& values,
+                       const cuopt_int_t* indices,
+                       const cuopt_float_t* new_values,
+                       cuopt_int_t num_entries,
+                       rmm::cuda_stream_view stream_view);
+
 }  // namespace cuopt::linear_programming
@@ -959,6 +959,11 @@ template class cusparse_dn_mat_descr_wrapper_t<double>;
 template class cusparse_view_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class cusparse_sp_mat_descr_wrapper_t<int64_t, double>;
+template class cusparse_view_t<int64_t, double>;
+#endif
+
 #if CUDA_VER_12_4_UP
 #if MIP_INSTANTIATE_FLOAT
 template void my_cusparsespmm_preprocess<float>(cusparseHandle_t,
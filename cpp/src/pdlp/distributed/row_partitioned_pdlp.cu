@@ -0,0 +1,1295 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/error.hpp>
+
+#include <utilities/copy_helpers.hpp>
+#include <utilities/logger.hpp>
+
+#include <mip_heuristics/mip_constants.hpp>
+#include <pdlp/distributed/row_partitioned_pdlp.cuh>
+#include <pdlp/pdlp_constants.hpp>
+#include <pdlp/restart_strategy/pdlp_restart_strategy.cuh>
+#include <pdlp/utils.cuh>
+
+#include <raft/core/device_setter.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/linalg/binary_op.cuh>
+#include <raft/sparse/detail/cusparse_wrappers.h>
+#include <raft/util/cuda_utils.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <cub/cub.cuh>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#define CUOPT_NCCL_TRY(call)                                                                \
+  do {                                                                                      \
+    const ncclResult_t nccl_status = (call);                                                \
+    cuopt_expects(nccl_status == ncclSuccess,                                               \
+                  error_type_t::RuntimeError,                                               \
+                  "NCCL error %s at %s:%d",                                                 \
+                  ncclGetErrorString(nccl_status),                                          \
+                  __FILE__,                                                                 \
+                  __LINE__);                                                                \
+  } while (0)
+
+namespace cuopt::linear_programming::detail {
+
+// Slots of the per device partial sums
+enum partial_slot_t : int {
+  constraint_bound_norm = 0,
+  objective_norm,
+  primal_residual,
+  dual_residual,
+  primal_objective,
+  dual_slack_objective,
+  constraint_bound_objective,
+  primal_distance,
+  dual_distance,
+  delta_primal,
+  delta_dual,
+  interaction,
+  power_iteration_norm,
+  power_iteration_eigenvalue,
+  power_iteration_residual,
+  partial_slot_count
+};
+
+template <typename f_t>
+ncclDataType_t nccl_data_type()
+{
+  if constexpr (std::is_same_v<f_t, float>) {
+    return ncclFloat;
+  } else {
+    return ncclDouble;
+  }
+}
+
+// Writes the sum of op(i) over [0, size) to out
+template <typename i_t, typename f_t, typename op_t>
+void transform_sum(
+  i_t size, op_t op, f_t* out, rmm::device_buffer& storage, rmm::cuda_stream_view stream_view)
+{
+  size_t bytes = 0;
+  cub::DeviceReduce::TransformReduce(nullptr,
+                                     bytes,
+                                     thrust::make_counting_iterator<i_t>(0),
+                                     out,
+                                     size,
+                                     cuda::std::plus<>{},
+                                     op,
+                                     f_t(0),
+                                     stream_view);
+  storage.resize(bytes, stream_view);
+  cub::DeviceReduce::TransformReduce(storage.data(),
+                                     bytes,
+                                     thrust::make_counting_iterator<i_t>(0),
+                                     out,
+                                     size,
+                                     cuda::std::plus<>{},
+                                     op,
+                                     f_t(0),
+                                     stream_view);
+}
+
+// Same as the Ruiz kernel of the initial scaling over a row block, the column maximums of each
+// device are combined afterwards
+template <typename i_t, typename f_t>
+__global__ void shard_inf_norm_kernel(i_t n_rows,
+                                      const i_t* offsets,
+                                      const i_t* indices,
+                                      const f_t* values,
+                                      const f_t* row_scaling,
+                                      const f_t* column_scaling,
+                                      f_t* row_max,
+                                      f_t* column_max)
+{
+  for (i_t row = blockIdx.x; row < n_rows; row += gridDim.x) {
+    const i_t row_offset = offsets[row];
+    const i_t nnz_in_row = offsets[row + 1] - row_offset;
+    const f_t row_scale  = row_scaling[row];
+    for (i_t j = threadIdx.x; j < nnz_in_row; j += blockDim.x) {
+      const i_t col     = indices[row_offset + j];
+      const f_t abs_val = raft::abs((values[row_offset + j] * row_scale) * column_scaling[col]);
+      if (abs_val > row_max[row]) { raft::myAtomicMax(&row_max[row], abs_val); }
+      if (abs_val > column_max[col]) { raft::myAtomicMax(&column_max[col], abs_val); }
+    }
+  }
+}
+
+// Sum of |a_ij|^exponent of each row of a CSR matrix, one block per row
+// Used on A for the Pock-Chambolle row norms and on the local A_T for the column norms
+template <typename i_t, typename f_t, int BLOCK_SIZE>
+__global__ void shard_pock_chambolle_kernel(const i_t* offsets,
+                                            const i_t* indices,
+                                            const f_t* values,
+                                            const f_t* row_scaling,
+                                            const f_t* column_scaling,
+                                            f_t exponent,
+                                            f_t* out)
+{
+  __shared__ f_t shared[BLOCK_SIZE / raft::WarpSize];
+  auto accumulated_row_value = raft::device_span<f_t>{shared, BLOCK_SIZE / raft::WarpSize};
+  f_t accumulated_value      = f_t(0);
+
+  const i_t row        = blockIdx.x;
+  const i_t row_offset = offsets[row];
+  const i_t nnz_in_row = offsets[row + 1] - row_offset;
+  const f_t row_scale  = row_scaling[row];
+  for (i_t j = threadIdx.x; j < nnz_in_row; j += blockDim.x) {
+    const i_t col     = indices[row_offset + j];
+    const f_t abs_val = raft::abs((values[row_offset + j] * row_scale) * column_scaling[col]);
+    accumulated_value += raft::pow(abs_val, exponent);
+  }
+
+  accumulated_value =
+    deterministic_block_reduce<f_t, BLOCK_SIZE>(accumulated_row_value, accumulated_value);
+  if (threadIdx.x == 0) { out[row] = accumulated_value; }
+}
+
+template <typename i_t, typename f_t>
+__global__ void shard_scale_matrix_kernel(i_t n_rows,
+                                          const i_t* offsets,
+                                          const i_t* indices,
+                                          f_t* values,
+                                          const f_t* row_scaling,
+                                          const f_t* column_scaling)
+{
+  for (i_t row = blockIdx.x; row < n_rows; row += gridDim.x) {
+    const i_t row_offset = offsets[row];
+    const i_t nnz_in_row = offsets[row + 1] - row_offset;
+    const f_t row_scale  = row_scaling[row];
+    for (i_t j = threadIdx.x; j < nnz_in_row; j += blockDim.x) {
+      const i_t col = indices[row_offset + j];
+      values[row_offset + j] *= row_scale * column_scaling[col];
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+struct row_partitioned_pdlp_t<i_t, f_t>::host_problem_t {
+  std::vector<i_t> offsets;
+  std::vector<i_t> variables;
+  std::vector<f_t> coefficients;
+  std::vector<f_t> objective_coefficients;
+  std::vector<f_t> variable_lower_bounds;
+  std::vector<f_t> variable_upper_bounds;
+  std::vector<f_t> constraint_lower_bounds;
+  std::vector<f_t> constraint_upper_bounds;
+};
+
+template <typename i_t, typename f_t, typename host_problem_t>
+optimization_problem_t<i_t, f_t> make_shard_problem(raft::handle_t const* handle_ptr,
+                                                    const host_problem_t& host_problem,
+                                                    i_t row_begin,
+                                                    i_t n_rows)
+{
+  const i_t nnz_begin = host_problem.offsets[row_begin];
+  const i_t nnz       = host_problem.offsets[row_begin + n_rows] - nnz_begin;
+  std::vector<i_t> offsets(n_rows + 1);
+  for (i_t i = 0; i <= n_rows; ++i) {
+    offsets[i] = host_problem.offsets[row_begin + i] - nnz_begin;
+  }
+  const i_t n_variables = host_problem.objective_coefficients.size();
+
+  optimization_problem_t<i_t, f_t> op_problem(handle_ptr);
+  op_problem.set_csr_constraint_matrix(host_problem.coefficients.data() + nnz_begin,
+                                       nnz,
+                                       host_problem.variables.data() + nnz_begin,
+                                       nnz,
+                                       offsets.data(),
+                                       n_rows + 1);
+  op_problem.set_objective_coefficients(host_problem.objective_coefficients.data(), n_variables);
+  op_problem.set_variable_lower_bounds(host_problem.variable_lower_bounds.data(), n_variables);
+  op_problem.set_variable_upper_bounds(host_problem.variable_upper_bounds.data(), n_variables);
+  op_problem.set_constraint_lower_bounds(host_problem.constraint_lower_bounds.data() + row_begin,
+                                         n_rows);
+  op_problem.set_constraint_upper_bounds(host_problem.constraint_upper_bounds.data() + row_begin,
+                                         n_rows);
+  return op_problem;
+}
+
+template <typename i_t, typename f_t>
+row_partitioned_pdlp_t<i_t, f_t>::shard_t::shard_t(
+  int device_id_,
+  i_t row_begin_,
+  i_t n_rows_,
+  const host_problem_t& host_problem,
+  const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params)
+  : device_id(device_id_),
+    row_begin(row_begin_),
+    n_rows(n_rows_),
+    stream(),
+    handle(stream.view()),
+    op_problem(make_shard_problem<i_t, f_t>(&handle, host_problem, row_begin_, n_rows_)),
+    problem(op_problem),
+    one{f_t(1), stream.view()},
+    zero{f_t(0), stream.view()},
+    primal{static_cast<size_t>(problem.n_variables), stream.view()},
+    potential_next_primal{static_cast<size_t>(problem.n_variables), stream.view()},
+    reflected_primal{static_cast<size_t>(problem.n_variables), stream.view()},
+    last_restart_primal{static_cast<size_t>(problem.n_variables), stream.view()},
+    dual_slack{static_cast<size_t>(problem.n_variables), stream.view()},
+    current_AtY{static_cast<size_t>(problem.n_variables), stream.view()},
+    next_AtY{static_cast<size_t>(problem.n_variables), stream.view()},
+    variable_scaling{static_cast<size_t>(problem.n_variables), stream.view()},
+    dual{static_cast<size_t>(n_rows_), stream.view()},
+    potential_next_dual{static_cast<size_t>(n_rows_), stream.view()},
+    reflected_dual{static_cast<size_t>(n_rows_), stream.view()},
+    last_restart_dual{static_cast<size_t>(n_rows_), stream.view()},
+    Ax{static_cast<size_t>(n_rows_), stream.view()},
+    constraint_scaling{static_cast<size_t>(n_rows_), stream.view()},
+    partials{partial_slot_count, stream.view()},
+    reduce_storage{0, stream.view()},
+    climber_strategies(1, pdlp_climber_strategy_t{0}),
+    cusparse_view(&handle,
+                  problem,
+                  primal,
+                  dual,
+                  next_AtY,
+                  Ax,
+                  reflected_primal,
+                  potential_next_dual,
+                  problem.reverse_coefficients,
+                  problem.reverse_offsets,
+                  problem.reverse_constraints,
+                  climber_strategies,
+                  hyper_params)
+{
+  primal_descr.create(problem.n_variables, primal.data());
+  potential_next_primal_descr.create(problem.n_variables, potential_next_primal.data());
+  dual_descr.create(n_rows, dual.data());
+  reflected_dual_descr.create(n_rows, reflected_dual.data());
+  current_AtY_descr.create(problem.n_variables, current_AtY.data());
+}
+
+template <typename i_t, typename f_t>
+row_partitioned_pdlp_t<i_t, f_t>::row_partitioned_pdlp_t(
+  const problem_t<i_t, f_t>& problem,
+  const pdlp_solver_settings_t<i_t, f_t>& settings,
+  const std::vector<int>& device_ids)
+  : problem_(problem), settings_(settings), hyper_params_(settings.hyper_params)
+{
+  raft::common::nvtx::range fun_scope("row_partitioned_pdlp_t");
+  cuopt_assert(device_ids.front() == raft::device_setter::get_current_device(),
+               "The problem must be on the first device");
+
+  const auto stream_view = problem.handle_ptr->get_stream();
+  const i_t n_rows       = problem.n_constraints;
+  const i_t num_shards   = std::min<i_t>(device_ids.size(), n_rows);
+
+  host_problem_t host_problem;
+  host_problem.offsets                 = host_copy(problem.offsets, stream_view);
+  host_problem.variables               = host_copy(problem.variables, stream_view);
+  host_problem.coefficients            = host_copy(problem.coefficients, stream_view);
+  host_problem.objective_coefficients  = host_copy(problem.objective_coefficients, stream_view);
+  host_problem.constraint_lower_bounds = host_copy(problem.constraint_lower_bounds, stream_view);
+  host_problem.constraint_upper_bounds = host_copy(problem.constraint_upper_bounds, stream_view);
+  for (const auto& bounds : host_copy(problem.variable_bounds, stream_view)) {
+    host_problem.variable_lower_bounds.push_back(bounds.x);
+    host_problem.variable_upper_bounds.push_back(bounds.y);
+  }
+
+  // Row blocks with about the same number of non zeros, each with at least one row
+  std::vector<i_t> row_starts(num_shards + 1, n_rows);
+  row_starts[0] = 0;
+  for (i_t s = 1; s < num_shards; ++s) {
+    const int64_t target = static_cast<int64_t>(problem.nnz) * s / num_shards;
+    i_t row              = std::lower_bound(host_problem.offsets.begin(),
+                                   host_problem.offsets.end(),
+                                   static_cast<i_t>(target)) -
+              host_problem.offsets.begin();
+    row           = std::clamp<i_t>(row, row_starts[s - 1] + 1, n_rows - (num_shards - s));
+    row_starts[s] = row;
+  }
+
+  for (i_t s = 0; s < num_shards; ++s) {
+    raft::device_setter device_guard{device_ids[s]};
+    shards_.push_back(std::make_unique<shard_t>(
+      device_ids[s], row_starts[s], row_starts[s + 1] - row_starts[s], host_problem, hyper_params_));
+    CUOPT_LOG_CONDITIONAL_INFO(!settings_.inside_mip,
+                               "PDLP rows [%ld, %ld) with %ld non zeros on device %d",
+                               static_cast<int64_t>(row_starts[s]),
+                               static_cast<int64_t>(row_starts[s + 1]),
+                               static_cast<int64_t>(shards_.back()->problem.nnz),
+                               device_ids[s]);
+  }
+
+  comms_.resize(num_shards);
+  std::vector<int> shard_devices(device_ids.begin(), device_ids.begin() + num_shards);
+  CUOPT_NCCL_TRY(ncclCommInitAll(comms_.data(), num_shards, shard_devices.data()));
+}
+
+template <typename i_t, typename f_t>
+row_partitioned_pdlp_t<i_t, f_t>::~row_partitioned_pdlp_t()
+{
+  // Device memory and library handles are released on the device they belong to
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    shard.reset();
+  }
+  for (auto comm : comms_) {
+    ncclCommDestroy(comm);
+  }
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::all_reduce(rmm::device_uvector<f_t> shard_t::* vector,
+                                                  ncclRedOp_t op)
+{
+  CUOPT_NCCL_TRY(ncclGroupStart());
+  for (size_t s = 0; s < shards_.size(); ++s) {
+    auto& shard = *shards_[s];
+    auto& data  = shard.*vector;
+    CUOPT_NCCL_TRY(ncclAllReduce(data.data(),
+                                 data.data(),
+                                 data.size(),
+                                 nccl_data_type<f_t>(),
+                                 op,
+                                 comms_[s],
+                                 shard.stream.value()));
+  }
+  CUOPT_NCCL_TRY(ncclGroupEnd());
+}
+
+template <typename i_t, typename f_t>
+std::vector<f_t> row_partitioned_pdlp_t<i_t, f_t>::all_reduce_partials()
+{
+  all_reduce(&shard_t::partials, ncclSum);
+  raft::device_setter device_guard{shards_.front()->device_id};
+  return host_copy(shards_.front()->partials, shards_.front()->stream.view());
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::sync_shards()
+{
+  for (auto& shard : shards_) {
+    shard->stream.synchronize();
+  }
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::scale_problem()
+{
+  raft::common::nvtx::range fun_scope("scale_problem");
+  using f_t2    = typename type_2<f_t>::type;
+  const i_t n   = problem_.n_variables;
+  auto bound_op = [] HD(f_t lower, f_t upper) {
+    f_t sum = 0;
+    if (isfinite(lower) && (lower != upper)) sum += lower * lower;
+    if (isfinite(upper)) sum += upper * upper;
+    return sum;
+  };
+
+  // ||b|| and ||c|| of the unscaled problem for the relative residuals
+  for (size_t s = 0; s < shards_.size(); ++s) {
+    auto& shard = *shards_[s];
+    raft::device_setter device_guard{shard.device_id};
+    const auto stream_view = shard.stream.view();
+    RAFT_CUDA_TRY(cudaMemsetAsync(
+      shard.partials.data(), 0, sizeof(f_t) * shard.partials.size(), stream_view));
+    transform_sum(
+      shard.n_rows,
+      [lower = shard.problem.constraint_lower_bounds.data(),
+       upper = shard.problem.constraint_upper_bounds.data(),
+       bound_op] HD(i_t i) { return bound_op(lower[i], upper[i]); },
+      shard.partials.data() + constraint_bound_norm,
+      shard.reduce_storage,
+      stream_view);
+    if (s == 0) {
+      transform_sum(
+        n,
+        [c = shard.problem.objective_coefficients.data()] HD(i_t j) { return c[j] * c[j]; },
+        shard.partials.data() + objective_norm,
+        shard.reduce_storage,
+        stream_view);
+    }
+    thrust::fill(shard.handle.get_thrust_policy(),
+                 shard.variable_scaling.begin(),
+                 shard.variable_scaling.end(),
+                 f_t(1));
+    thrust::fill(shard.handle.get_thrust_policy(),
+                 shard.constraint_scaling.begin(),
+                 shard.constraint_scaling.end(),
+                 f_t(1));
+  }
+  auto norms                       = all_reduce_partials();
+  l2_norm_primal_right_hand_side_  = std::sqrt(norms[constraint_bound_norm]);
+  l2_norm_primal_linear_objective_ = std::sqrt(norms[objective_norm]);
+
+  // The iteration scaling of the rows goes to Ax and of the columns to next_AtY
+  auto update_scaling = [this]() {
+    for (auto& shard : shards_) {
+      raft::device_setter device_guard{shard->device_id};
+      raft::linalg::binaryOp(shard->constraint_scaling.data(),
+                             shard->constraint_scaling.data(),
+                             shard->Ax.data(),
+                             shard->n_rows,
+                             a_divides_sqrt_b_bounded<f_t>(),
+                             shard->stream.view());
+      raft::linalg::binaryOp(shard->variable_scaling.data(),
+                             shard->variable_scaling.data(),
+                             shard->next_AtY.data(),
+                             problem_.n_variables,
+                             a_divides_sqrt_b_bounded<f_t>(),
+                             shard->stream.view());
+    }
+  };
+
+  if (hyper_params_.do_ruiz_scaling) {
+    for (int i = 0; i < hyper_params_.default_l_inf_ruiz_iterations; ++i) {
+      for (auto& shard : shards_) {
+        raft::device_setter device_guard{shard->device_id};
+        const auto stream_view = shard->stream.view();
+        RAFT_CUDA_TRY(
+          cudaMemsetAsync(shard->Ax.data(), 0, sizeof(f_t) * shard->n_rows, stream_view));
+        RAFT_CUDA_TRY(cudaMemsetAsync(shard->next_AtY.data(), 0, sizeof(f_t) * n, stream_view));
+        const i_t number_of_blocks  = raft::ceildiv<i_t>(shard->n_rows, block_size);
+        const i_t number_of_threads = std::min(n, (i_t)block_size);
+        shard_inf_norm_kernel<i_t, f_t><<<number_of_blocks, number_of_threads, 0, stream_view>>>(
+          shard->n_rows,
+          shard->problem.offsets.data(),
+          shard->problem.variables.data(),
+          shard->problem.coefficients.data(),
+          shard->constraint_scaling.data(),
+          shard->variable_scaling.data(),
+          shard->Ax.data(),
+          shard->next_AtY.data());
+        RAFT_CUDA_TRY(cudaPeekAtLastError());
+      }
+      all_reduce(&shard_t::next_AtY, ncclMax);
+      update_scaling();
+    }
+  }
+
+  if (hyper_params_.do_pock_chambolle_scaling) {
+    const f_t alpha = hyper_params_.default_alpha_pock_chambolle_rescaling;
+    for (auto& shard : shards_) {
+      raft::device_setter device_guard{shard->device_id};
+      const auto stream_view = shard->stream.view();
+      shard_pock_chambolle_kernel<i_t, f_t, block_size>
+        <<<shard->n_rows, block_size, 0, stream_view>>>(shard->problem.offsets.data(),
+                                                         shard->problem.variables.data(),
+                                                         shard->problem.coefficients.data(),
+                                                         shard->constraint_scaling.data(),
+                                                         shard->variable_scaling.data(),
+                                                         alpha,
+                                                         shard->Ax.data());
+      RAFT_CUDA_TRY(cudaPeekAtLastError());
+      // Columns of the row block, summed over the devices below
+      shard_pock_chambolle_kernel<i_t, f_t, block_size>
+        <<<n, block_size, 0, stream_view>>>(shard->problem.reverse_offsets.data(),
+                                            shard->problem.reverse_constraints.data(),
+                                            shard->problem.reverse_coefficients.data(),
+                                            shard->variable_scaling.data(),
+                                            shard->constraint_scaling.data(),
+                                            f_t(2) - alpha,
+                                            shard->next_AtY.data());
+      RAFT_CUDA_TRY(cudaPeekAtLastError());
+    }
+    all_reduce(&shard_t::next_AtY, ncclSum);
+    update_scaling();
+  }
+
+  // Scale A, A_T, c and the bounds
+  for (size_t s = 0; s < shards_.size(); ++s) {
+    auto& shard = *shards_[s];
+    raft::device_setter device_guard{shard.device_id};
+    const auto stream_view = shard.stream.view();
+    auto& problem          = shard.problem;
+    shard_scale_matrix_kernel<i_t, f_t>
+      <<<raft::ceildiv<i_t>(shard.n_rows, block_size),
+         std::min(n, (i_t)block_size),
+         0,
+         stream_view>>>(shard.n_rows,
+                        problem.offsets.data(),
+                        problem.variables.data(),
+                        problem.coefficients.data(),
+                        shard.constraint_scaling.data(),
+                        shard.variable_scaling.data());
+    RAFT_CUDA_TRY(cudaPeekAtLastError());
+    shard_scale_matrix_kernel<i_t, f_t>
+      <<<raft::ceildiv<i_t>(n, block_size),
+         std::min(shard.n_rows, (i_t)block_size),
+         0,
+         stream_view>>>(n,
+                        problem.reverse_offsets.data(),
+                        problem.reverse_constraints.data(),
+                        problem.reverse_coefficients.data(),
+                        shard.variable_scaling.data(),
+                        shard.constraint_scaling.data());
+    RAFT_CUDA_TRY(cudaPeekAtLastError());
+
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(problem.objective_coefficients.data(), shard.variable_scaling.data()),
+      problem.objective_coefficients.data(),
+      n,
+      cuda::std::multiplies<f_t>{},
+      stream_view);
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(problem.variable_bounds.data(), shard.variable_scaling.data()),
+      problem.variable_bounds.data(),
+      n,
+      divide_check_zero<f_t, f_t2>(),
+      stream_view);
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(problem.constraint_lower_bounds.data(),
+                            problem.constraint_upper_bounds.data(),
+                            shard.constraint_scaling.data()),
+      thrust::make_zip_iterator(problem.constraint_lower_bounds.data(),
+                                problem.constraint_upper_bounds.data()),
+      shard.n_rows,
+      [] __device__(f_t lower, f_t upper, f_t scaling) -> thrust::tuple<f_t, f_t> {
+        return {lower * scaling, upper * scaling};
+      },
+      stream_view);
+
+    // Norms of the scaled bounds and objective for the bound and objective rescaling
+    RAFT_CUDA_TRY(cudaMemsetAsync(
+      shard.partials.data(), 0, sizeof(f_t) * shard.partials.size(), stream_view));
+    transform_sum(
+      shard.n_rows,
+      [lower = problem.constraint_lower_bounds.data(),
+       upper = problem.constraint_upper_bounds.data(),
+       bound_op] HD(i_t i) { return bound_op(lower[i], upper[i]); },
+      shard.partials.data() + constraint_bound_norm,
+      shard.reduce_storage,
+      stream_view);
+    if (s == 0) {
+      transform_sum(
+        n,
+        [c = problem.objective_coefficients.data()] HD(i_t j) { return c[j] * c[j]; },
+        shard.partials.data() + objective_norm,
+        shard.reduce_storage,
+        stream_view);
+    }
+  }
+
+  norms            = all_reduce_partials();
+  bound_rescaling_ = f_t(1) / (std::sqrt(norms[constraint_bound_norm]) + f_t(1));
+  objective_rescaling_ =
+    f_t(1) / (std::sqrt(hyper_params_.initial_primal_weight_c_scaling * norms[objective_norm]) +
+              f_t(1));
+
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    auto& problem          = shard->problem;
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(problem.constraint_lower_bounds.data(),
+                            problem.constraint_upper_bounds.data()),
+      thrust::make_zip_iterator(problem.constraint_lower_bounds.data(),
+                                problem.constraint_upper_bounds.data()),
+      shard->n_rows,
+      [bound_rescaling = bound_rescaling_] __device__(f_t lower,
+                                                      f_t upper) -> thrust::tuple<f_t, f_t> {
+        return {lower * bound_rescaling, upper * bound_rescaling};
+      },
+      stream_view);
+    cub::DeviceTransform::Transform(
+      problem.variable_bounds.data(),
+      problem.variable_bounds.data(),
+      n,
+      [bound_rescaling = bound_rescaling_] __device__(f_t2 bounds) -> f_t2 {
+        return {bounds.x * bound_rescaling, bounds.y * bound_rescaling};
+      },
+      stream_view);
+    cub::DeviceTransform::Transform(
+      problem.objective_coefficients.data(),
+      problem.objective_coefficients.data(),
+      n,
+      [objective_rescaling = objective_rescaling_] __device__(f_t c) {
+        return c * objective_rescaling;
+      },
+      stream_view);
+  }
+}
+
+template <typename i_t, typename f_t>
+f_t row_partitioned_pdlp_t<i_t, f_t>::compute_squared_operator_norm()
+{
+  raft::common::nvtx::range fun_scope("compute_squared_operator_norm");
+
+  // Power iteration on A_T @ A, same largest eigenvalue as A @ A_T but over the replicated primal
+  // vectors: primal holds q, Ax holds A @ q and next_AtY holds z
+  constexpr i_t max_iterations = 5000;
+  constexpr f_t tolerance      = 1e-4;
+  const i_t n                  = problem_.n_variables;
+
+  // Same random start on every device
+  std::vector<f_t> initial_z(n);
+  std::mt19937 gen(1);
+  std::normal_distribution<f_t> dist(f_t(0.0), f_t(1.0));
+  for (i_t j = 0; j < n; ++j) {
+    initial_z[j] = dist(gen);
+  }
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    raft::copy(shard->next_AtY.data(), initial_z.data(), n, shard->stream.view());
+  }
+
+  f_t squared_norm = 0;
+  for (i_t i = 0; i < max_iterations; ++i) {
+    for (auto& shard : shards_) {
+      raft::device_setter device_guard{shard->device_id};
+      const auto stream_view = shard->stream.view();
+      f_t* partials          = shard->partials.data();
+      RAFT_CUDA_TRY(
+        cudaMemsetAsync(partials, 0, sizeof(f_t) * shard->partials.size(), stream_view));
+      // q = z / ||z||, computed by every device on its copy of z
+      transform_sum(
+        n,
+        [z = shard->next_AtY.data()] HD(i_t j) { return z[j] * z[j]; },
+        partials + power_iteration_norm,
+        shard->reduce_storage,
+        stream_view);
+      cub::DeviceTransform::Transform(
+        shard->next_AtY.data(),
+        shard->primal.data(),
+        n,
+        [norm = partials + power_iteration_norm] __device__(f_t z) { return z / raft::sqrt(*norm); },
+        stream_view);
+
+      RAFT_CUSPARSE_TRY(
+        raft::sparse::detail::cusparsespmv(shard->handle.get_cusparse_handle(),
+                                           CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                           shard->one.data(),
+                                           shard->cusparse_view.A,
+                                           shard->primal_descr,
+                                           shard->zero.data(),
+                                           shard->cusparse_view.tmp_dual,
+                                           CUSPARSE_SPMV_CSR_ALG2,
+                                           (f_t*)shard->cusparse_view.buffer_non_transpose.data(),
+                                           stream_view));
+      RAFT_CUSPARSE_TRY(
+        raft::sparse::detail::cusparsespmv(shard->handle.get_cusparse_handle(),
+                                           CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                           shard->one.data(),
+                                           shard->cusparse_view.A_T,
+                                           shard->cusparse_view.tmp_dual,
+                                           shard->zero.data(),
+                                           shard->cusparse_view.tmp_primal,
+                                           CUSPARSE_SPMV_CSR_ALG2,
+                                           (f_t*)shard->cusparse_view.buffer_transpose.data(),
+                                           stream_view));
+    }
+    all_reduce(&shard_t::next_AtY, ncclSum);
+
+    // sigma_max_sq = dot(q, z) and the residual ||z - sigma_max_sq * q||, on the first device
+    auto& shard            = *shards_.front();
+    const auto stream_view = shard.stream.view();
+    raft::device_setter device_guard{shard.device_id};
+    f_t* partials = shard.partials.data();
+    transform_sum(
+      n,
+      [q = shard.primal.data(), z = shard.next_AtY.data()] HD(i_t j) { return q[j] * z[j]; },
+      partials + power_iteration_eigenvalue,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      n,
+      [q = shard.primal.data(), z = shard.next_AtY.data(), partials] __device__(i_t j) {
+        const f_t residual = z[j] - partials[power_iteration_eigenvalue] * q[j];
+        return residual * residual;
+      },
+      partials + power_iteration_residual,
+      shard.reduce_storage,
+      stream_view);
+    const auto values = host_copy(shard.partials, stream_view);
+    squared_norm      = values[power_iteration_eigenvalue];
+    if (std::sqrt(values[power_iteration_residual]) < tolerance) { break; }
+  }
+  return squared_norm;
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::take_step()
+{
+  using f_t2                 = typename type_2<f_t>::type;
+  const f_t primal_step_size = step_size_ / primal_weight_;
+  const f_t dual_step_size   = step_size_ * primal_weight_;
+
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    auto& problem          = shard->problem;
+
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(shard->primal.data(),
+                            problem.objective_coefficients.data(),
+                            shard->current_AtY.data(),
+                            problem.variable_bounds.data()),
+      thrust::make_zip_iterator(shard->potential_next_primal.data(),
+                                shard->dual_slack.data(),
+                                shard->reflected_primal.data()),
+      problem.n_variables,
+      [primal_step_size] __device__(
+        f_t current_primal, f_t objective, f_t Aty, f_t2 bounds) -> thrust::tuple<f_t, f_t, f_t> {
+        const f_t next         = current_primal - primal_step_size * (objective - Aty);
+        const f_t next_clamped = raft::max<f_t>(raft::min<f_t>(next, bounds.y), bounds.x);
+        return {next_clamped,
+                (next_clamped - next) / primal_step_size,
+                f_t(2.0) * next_clamped - current_primal};
+      },
+      stream_view);
+
+    // A @ reflected primal for the rows of the shard
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv(shard->handle.get_cusparse_handle(),
+                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                         shard->one.data(),
+                                         shard->cusparse_view.A,
+                                         shard->cusparse_view.primal_solution,
+                                         shard->zero.data(),
+                                         shard->cusparse_view.tmp_dual,
+                                         CUSPARSE_SPMV_CSR_ALG2,
+                                         (f_t*)shard->cusparse_view.buffer_non_transpose.data(),
+                                         stream_view));
+
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(shard->dual.data(),
+                            shard->Ax.data(),
+                            problem.constraint_lower_bounds.data(),
+                            problem.constraint_upper_bounds.data()),
+      thrust::make_zip_iterator(shard->potential_next_dual.data(), shard->reflected_dual.data()),
+      shard->n_rows,
+      [dual_step_size] __device__(
+        f_t current_dual, f_t Ax, f_t lower_bound, f_t upper_bound) -> thrust::tuple<f_t, f_t> {
+        const f_t tmp       = current_dual / dual_step_size - Ax;
+        const f_t tmp_proj  = raft::max<f_t>(-upper_bound, raft::min<f_t>(tmp, -lower_bound));
+        const f_t next_dual = (tmp - tmp_proj) * dual_step_size;
+        return {next_dual, f_t(2.0) * next_dual - current_dual};
+      },
+      stream_view);
+  }
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::halpern_update()
+{
+  const f_t weight = f_t(iterations_since_last_restart_ + 1) / f_t(iterations_since_last_restart_ + 2);
+  const f_t reflection_coefficient = hyper_params_.reflection_coefficient;
+  auto update = [weight, reflection_coefficient] __device__(
+                  f_t reflected, f_t current, f_t initial) {
+    return weight * (reflection_coefficient * reflected +
+                     (f_t(1.0) - reflection_coefficient) * current) +
+           (f_t(1.0) - weight) * initial;
+  };
+
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    cub::DeviceTransform::Transform(cuda::std::make_tuple(shard->reflected_primal.data(),
+                                                          shard->primal.data(),
+                                                          shard->last_restart_primal.data()),
+                                    shard->primal.data(),
+                                    shard->primal.size(),
+                                    update,
+                                    stream_view);
+    cub::DeviceTransform::Transform(cuda::std::make_tuple(shard->reflected_dual.data(),
+                                                          shard->dual.data(),
+                                                          shard->last_restart_dual.data()),
+                                    shard->dual.data(),
+                                    shard->dual.size(),
+                                    update,
+                                    stream_view);
+  }
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::compute_current_AtY()
+{
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv(shard->handle.get_cusparse_handle(),
+                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                         shard->one.data(),
+                                         shard->cusparse_view.A_T,
+                                         shard->dual_descr,
+                                         shard->zero.data(),
+                                         shard->current_AtY_descr,
+                                         CUSPARSE_SPMV_CSR_ALG2,
+                                         (f_t*)shard->cusparse_view.buffer_transpose.data(),
+                                         shard->stream.view()));
+  }
+  all_reduce(&shard_t::current_AtY, ncclSum);
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::compute_next_AtY(bool from_reflected_dual)
+{
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmv(
+      shard->handle.get_cusparse_handle(),
+      CUSPARSE_OPERATION_NON_TRANSPOSE,
+      shard->one.data(),
+      shard->cusparse_view.A_T,
+      from_reflected_dual ? shard->reflected_dual_descr : shard->cusparse_view.dual_solution,
+      shard->zero.data(),
+      shard->cusparse_view.tmp_primal,
+      CUSPARSE_SPMV_CSR_ALG2,
+      (f_t*)shard->cusparse_view.buffer_transpose.data(),
+      shard->stream.view()));
+  }
+  all_reduce(&shard_t::next_AtY, ncclSum);
+}
+
+template <typename i_t, typename f_t>
+f_t row_partitioned_pdlp_t<i_t, f_t>::compute_fixed_point_error()
+{
+  raft::common::nvtx::range fun_scope("compute_fixed_point_error");
+
+  // Interaction is (x' - x)^T (A_T @ y' - A_T @ y) with the reflected solutions as x' and y'
+  compute_next_AtY(true);
+  for (size_t s = 0; s < shards_.size(); ++s) {
+    auto& shard = *shards_[s];
+    raft::device_setter device_guard{shard.device_id};
+    const auto stream_view = shard.stream.view();
+    f_t* partials          = shard.partials.data();
+    RAFT_CUDA_TRY(
+      cudaMemsetAsync(partials, 0, sizeof(f_t) * shard.partials.size(), stream_view));
+    transform_sum(
+      shard.n_rows,
+      [reflected = shard.reflected_dual.data(), current = shard.dual.data()] HD(i_t i) {
+        return (reflected[i] - current[i]) * (reflected[i] - current[i]);
+      },
+      partials + delta_dual,
+      shard.reduce_storage,
+      stream_view);
+    // Primal terms are replicated, only counted once
+    if (s != 0) { continue; }
+    transform_sum(
+      problem_.n_variables,
+      [reflected = shard.reflected_primal.data(), current = shard.primal.data()] HD(i_t j) {
+        return (reflected[j] - current[j]) * (reflected[j] - current[j]);
+      },
+      partials + delta_primal,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      problem_.n_variables,
+      [reflected   = shard.reflected_primal.data(),
+       current     = shard.primal.data(),
+       next_AtY    = shard.next_AtY.data(),
+       current_AtY = shard.current_AtY.data()] HD(i_t j) {
+        return (reflected[j] - current[j]) * (next_AtY[j] - current_AtY[j]);
+      },
+      partials + interaction,
+      shard.reduce_storage,
+      stream_view);
+  }
+  const auto sums = all_reduce_partials();
+
+  const f_t movement =
+    sums[delta_primal] * primal_weight_ + sums[delta_dual] / primal_weight_;
+  const f_t computed_interaction = f_t(2.0) * sums[interaction] * step_size_;
+  return std::sqrt(std::max(f_t(0.0), movement + computed_interaction));
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::compute_convergence_information()
+{
+  raft::common::nvtx::range fun_scope("compute_convergence_information");
+
+  // Residuals of the potential next solution, unscaled on the fly
+  compute_next_AtY(false);
+  const f_t bound_rescaling     = bound_rescaling_;
+  const f_t objective_rescaling = objective_rescaling_;
+  for (size_t s = 0; s < shards_.size(); ++s) {
+    auto& shard = *shards_[s];
+    raft::device_setter device_guard{shard.device_id};
+    const auto stream_view = shard.stream.view();
+    auto& problem          = shard.problem;
+    f_t* partials          = shard.partials.data();
+    RAFT_CUDA_TRY(
+      cudaMemsetAsync(partials, 0, sizeof(f_t) * shard.partials.size(), stream_view));
+
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv(shard.handle.get_cusparse_handle(),
+                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                         shard.one.data(),
+                                         shard.cusparse_view.A,
+                                         shard.potential_next_primal_descr,
+                                         shard.zero.data(),
+                                         shard.cusparse_view.tmp_dual,
+                                         CUSPARSE_SPMV_CSR_ALG2,
+                                         (f_t*)shard.cusparse_view.buffer_non_transpose.data(),
+                                         stream_view));
+    transform_sum(
+      shard.n_rows,
+      [Ax          = shard.Ax.data(),
+       lower       = problem.constraint_lower_bounds.data(),
+       upper       = problem.constraint_upper_bounds.data(),
+       row_scaling = shard.constraint_scaling.data(),
+       bound_rescaling] __device__(i_t i) {
+        const f_t residual = (Ax[i] - raft::min<f_t>(raft::max<f_t>(Ax[i], lower[i]), upper[i])) /
+                             (row_scaling[i] * bound_rescaling);
+        return residual * residual;
+      },
+      partials + primal_residual,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      shard.n_rows,
+      [dual  = shard.potential_next_dual.data(),
+       lower = problem.constraint_lower_bounds.data(),
+       upper = problem.constraint_upper_bounds.data()] __device__(i_t i) {
+        const f_t finite_lower = isfinite(lower[i]) ? lower[i] : f_t(0);
+        const f_t finite_upper = isfinite(upper[i]) ? upper[i] : f_t(0);
+        return raft::max<f_t>(dual[i], f_t(0)) * finite_lower +
+               raft::min<f_t>(dual[i], f_t(0)) * finite_upper;
+      },
+      partials + constraint_bound_objective,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      shard.n_rows,
+      [next = shard.potential_next_dual.data(), last = shard.last_restart_dual.data()] HD(i_t i) {
+        return (next[i] - last[i]) * (next[i] - last[i]);
+      },
+      partials + dual_distance,
+      shard.reduce_storage,
+      stream_view);
+
+    // Primal terms are replicated, only counted once
+    if (s != 0) { continue; }
+    transform_sum(
+      problem.n_variables,
+      [objective          = problem.objective_coefficients.data(),
+       AtY                = shard.next_AtY.data(),
+       dual_slack         = shard.dual_slack.data(),
+       variable_scaling   = shard.variable_scaling.data(),
+       objective_rescaling] __device__(i_t j) {
+        const f_t residual = (objective[j] - AtY[j] - dual_slack[j]) /
+                             (variable_scaling[j] * objective_rescaling);
+        return residual * residual;
+      },
+      partials + dual_residual,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      problem.n_variables,
+      [objective = problem.objective_coefficients.data(),
+       primal    = shard.potential_next_primal.data()] HD(i_t j) { return objective[j] * primal[j]; },
+      partials + primal_objective,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      problem.n_variables,
+      [dual_slack = shard.dual_slack.data(), primal = shard.potential_next_primal.data()] HD(
+        i_t j) { return dual_slack[j] * primal[j]; },
+      partials + dual_slack_objective,
+      shard.reduce_storage,
+      stream_view);
+    transform_sum(
+      problem.n_variables,
+      [next = shard.potential_next_primal.data(), last = shard.last_restart_primal.data()] HD(
+        i_t j) { return (next[j] - last[j]) * (next[j] - last[j]); },
+      partials + primal_distance,
+      shard.reduce_storage,
+      stream_view);
+  }
+  const auto sums = all_reduce_partials();
+
+  // Scaled objectives are multiplied by bound_rescaling * objective_rescaling
+  const f_t objective_unscaling = f_t(1) / (bound_rescaling_ * objective_rescaling_);
+  const f_t objective_scaling_factor = problem_.presolve_data.objective_scaling_factor;
+  const f_t objective_offset         = problem_.presolve_data.objective_offset;
+  const f_t primal_objective_value =
+    objective_scaling_factor * (sums[primal_objective] * objective_unscaling + objective_offset);
+  const f_t dual_objective_value =
+    objective_scaling_factor *
+    ((sums[dual_slack_objective] + sums[constraint_bound_objective]) * objective_unscaling +
+     objective_offset);
+
+  auto& info                           = termination_information_;
+  info.number_of_steps_taken           = total_iterations_;
+  info.total_number_of_attempted_steps = total_iterations_;
+  info.l2_primal_residual              = std::sqrt(sums[primal_residual]);
+  info.l2_relative_primal_residual =
+    info.l2_primal_residual / (f_t(1.0) + l2_norm_primal_right_hand_side_);
+  info.l2_dual_residual = std::sqrt(sums[dual_residual]);
+  info.l2_relative_dual_residual =
+    info.l2_dual_residual / (f_t(1.0) + l2_norm_primal_linear_objective_);
+  info.primal_objective = primal_objective_value;
+  info.dual_objective   = dual_objective_value;
+  info.gap              = std::abs(primal_objective_value - dual_objective_value);
+  info.relative_gap     = info.gap / (f_t(1.0) + std::abs(primal_objective_value) +
+                                  std::abs(dual_objective_value));
+  info.solved_by_pdlp   = true;
+
+  primal_distance_ = sums[primal_distance];
+  dual_distance_   = sums[dual_distance];
+}
+
+template <typename i_t, typename f_t>
+bool row_partitioned_pdlp_t<i_t, f_t>::should_restart()
+{
+  // Same criteria as pdlp_restart_strategy_t::should_cupdlpx_restart
+  bool restart = false;
+  if (total_iterations_ == hyper_params_.major_iteration) {
+    restart = true;
+  } else if (total_iterations_ > hyper_params_.major_iteration) {
+    restart =
+      fixed_point_error_ <=
+        hyper_params_.sufficient_reduction_for_restart * initial_fixed_point_error_ ||
+      (fixed_point_error_ <=
+         hyper_params_.necessary_reduction_for_restart * initial_fixed_point_error_ &&
+       fixed_point_error_ > last_trial_fixed_point_error_) ||
+      iterations_since_last_restart_ >=
+        hyper_params_.default_artificial_restart_threshold * total_iterations_;
+  }
+  last_trial_fixed_point_error_ = fixed_point_error_;
+  return restart;
+}
+
+template <typename i_t, typename f_t>
+void row_partitioned_pdlp_t<i_t, f_t>::restart()
+{
+  raft::common::nvtx::range fun_scope("restart");
+
+  // compute_convergence_information filled the residuals and distances of the restart point
+  f_t primal_step_size = 0;
+  f_t dual_step_size   = 0;
+  cupdlpx_new_primal_weight_computation<f_t>(primal_distance_,
+                                             dual_distance_,
+                                             termination_information_.l2_relative_dual_residual,
+                                             termination_information_.l2_relative_primal_residual,
+                                             step_size_,
+                                             &primal_weight_error_sum_,
+                                             &primal_weight_last_error_,
+                                             &primal_weight_,
+                                             &best_primal_weight_,
+                                             &primal_step_size,
+                                             &dual_step_size,
+                                             &best_primal_dual_residual_gap_,
+                                             hyper_params_.restart_k_p,
+                                             hyper_params_.restart_k_i,
+                                             hyper_params_.restart_k_d,
+                                             hyper_params_.restart_i_smooth);
+
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    raft::copy(shard->primal.data(),
+               shard->potential_next_primal.data(),
+               shard->primal.size(),
+               stream_view);
+    raft::copy(shard->last_restart_primal.data(),
+               shard->potential_next_primal.data(),
+               shard->primal.size(),
+               stream_view);
+    raft::copy(
+      shard->dual.data(), shard->potential_next_dual.data(), shard->dual.size(), stream_view);
+    raft::copy(shard->last_restart_dual.data(),
+               shard->potential_next_dual.data(),
+               shard->dual.size(),
+               stream_view);
+  }
+  compute_current_AtY();
+
+  iterations_since_last_restart_ = 0;
+  last_trial_fixed_point_error_  = std::numeric_limits<f_t>::infinity();
+}
+
+template <typename i_t, typename f_t>
+optimization_problem_solution_t<i_t, f_t> row_partitioned_pdlp_t<i_t, f_t>::make_solution(
+  pdlp_termination_status_t status)
+{
+  // Unscale the potential next solution in place: x = x * C / bound_rescaling,
+  // y = y * R / objective_rescaling and reduced cost = dual slack / (C * objective_rescaling)
+  const f_t bound_rescaling     = bound_rescaling_;
+  const f_t objective_rescaling = objective_rescaling_;
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(shard->potential_next_primal.data(),
+                            shard->dual_slack.data(),
+                            shard->variable_scaling.data()),
+      thrust::make_zip_iterator(shard->potential_next_primal.data(), shard->dual_slack.data()),
+      shard->primal.size(),
+      [bound_rescaling, objective_rescaling] __device__(
+        f_t primal, f_t dual_slack, f_t scaling) -> thrust::tuple<f_t, f_t> {
+        return {primal * scaling / bound_rescaling, dual_slack / (scaling * objective_rescaling)};
+      },
+      stream_view);
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(shard->potential_next_dual.data(), shard->constraint_scaling.data()),
+      shard->potential_next_dual.data(),
+      shard->dual.size(),
+      [objective_rescaling] __device__(f_t dual, f_t scaling) {
+        return dual * scaling / objective_rescaling;
+      },
+      stream_view);
+  }
+  sync_shards();
+
+  const auto stream_view = problem_.handle_ptr->get_stream();
+  rmm::device_uvector<f_t> primal_solution(problem_.n_variables, stream_view);
+  rmm::device_uvector<f_t> dual_solution(problem_.n_constraints, stream_view);
+  rmm::device_uvector<f_t> reduced_cost(problem_.n_variables, stream_view);
+  const auto& first_shard = *shards_.front();
+  raft::copy(primal_solution.data(),
+             first_shard.potential_next_primal.data(),
+             primal_solution.size(),
+             stream_view);
+  raft::copy(
+    reduced_cost.data(), first_shard.dual_slack.data(), reduced_cost.size(), stream_view);
+  for (const auto& shard : shards_) {
+    raft::copy(dual_solution.data() + shard->row_begin,
+               shard->potential_next_dual.data(),
+               shard->n_rows,
+               stream_view);
+  }
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view));
+
+  std::vector<typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t>
+    termination_stats{termination_information_};
+  std::vector<pdlp_termination_status_t> termination_status{status};
+  return optimization_problem_solution_t<i_t, f_t>(primal_solution,
+                                                   dual_solution,
+                                                   reduced_cost,
+                                                   problem_.objective_name,
+                                                   problem_.var_names,
+                                                   problem_.row_names,
+                                                   std::move(termination_stats),
+                                                   std::move(termination_status));
+}
+
+template <typename i_t, typename f_t>
+optimization_problem_solution_t<i_t, f_t> row_partitioned_pdlp_t<i_t, f_t>::run_solver(
+  const timer_t& timer)
+{
+  raft::common::nvtx::range fun_scope("row_partitioned_pdlp_t::run_solver");
+  using f_t2 = typename type_2<f_t>::type;
+
+  scale_problem();
+  if (settings_.get_initial_step_size().has_value()) {
+    step_size_ = settings_.get_initial_step_size().value();
+  } else {
+    constexpr f_t scaling_factor = 0.998;
+    step_size_                   = scaling_factor / std::sqrt(compute_squared_operator_norm());
+  }
+  // Bound and objective rescaling starts from a primal weight of 1
+  primal_weight_      = settings_.get_initial_primal_weight().value_or(f_t(1));
+  best_primal_weight_ = primal_weight_;
+
+  // Start from the projection of 0 on the variable bounds and y = 0
+  for (auto& shard : shards_) {
+    raft::device_setter device_guard{shard->device_id};
+    const auto stream_view = shard->stream.view();
+    cub::DeviceTransform::Transform(
+      shard->problem.variable_bounds.data(),
+      shard->primal.data(),
+      shard->primal.size(),
+      [] __device__(f_t2 bounds) {
+        return raft::max<f_t>(raft::min<f_t>(f_t(0), bounds.y), bounds.x);
+      },
+      stream_view);
+    raft::copy(shard->last_restart_primal.data(),
+               shard->primal.data(),
+               shard->primal.size(),
+               stream_view);
+    RAFT_CUDA_TRY(
+      cudaMemsetAsync(shard->dual.data(), 0, sizeof(f_t) * shard->dual.size(), stream_view));
+    RAFT_CUDA_TRY(cudaMemsetAsync(
+      shard->last_restart_dual.data(), 0, sizeof(f_t) * shard->dual.size(), stream_view));
+    RAFT_CUDA_TRY(cudaMemsetAsync(
+      shard->current_AtY.data(), 0, sizeof(f_t) * shard->current_AtY.size(), stream_view));
+  }
+
+  if (!settings_.inside_mip) {
+    CUOPT_LOG_INFO(
+      "   Iter    Primal Obj.      Dual Obj.    Gap        Primal Res.  Dual Res.   Time");
+  }
+  const auto& tolerances                = settings_.tolerances;
+  bool compute_initial_fixed_point_error = false;
+  while (true) {
+    take_step();
+    ++total_iterations_;
+
+    // The fixed point error is needed once after each restart and at each restart check
+    const bool is_major_iteration = total_iterations_ % hyper_params_.major_iteration == 0;
+    if (compute_initial_fixed_point_error || is_major_iteration) {
+      fixed_point_error_ = compute_fixed_point_error();
+      if (compute_initial_fixed_point_error) {
+        initial_fixed_point_error_         = fixed_point_error_;
+        compute_initial_fixed_point_error = false;
+      }
+    }
+
+    const bool is_conditional_major =
+      hyper_params_.use_conditional_major &&
+      total_iterations_ % conditional_major<i_t>(total_iterations_) == 0;
+    const bool iteration_limit_reached = total_iterations_ >= settings_.iteration_limit;
+    const bool time_limit_reached      = timer.check_time_limit();
+    if (is_major_iteration || is_conditional_major || iteration_limit_reached ||
+        time_limit_reached) {
+      compute_convergence_information();
+      const auto& info = termination_information_;
+      CUOPT_LOG_CONDITIONAL_INFO(!settings_.inside_mip,
+                                 "%7ld %+.8e %+.8e  %8.2e   %8.2e     %8.2e   %.3fs",
+                                 static_cast<int64_t>(total_iterations_),
+                                 info.primal_objective,
+                                 info.dual_objective,
+                                 info.gap,
+                                 info.l2_primal_residual,
+                                 info.l2_dual_residual,
+                                 timer.elapsed_time());
+
+      const f_t abs_objective = std::abs(info.primal_objective) + std::abs(info.dual_objective);
+      const bool optimal =
+        info.l2_primal_residual <=
+          tolerances.absolute_primal_tolerance +
+            tolerances.relative_primal_tolerance * l2_norm_primal_right_hand_side_ &&
+        info.l2_dual_residual <=
+          tolerances.absolute_dual_tolerance +
+            tolerances.relative_dual_tolerance * l2_norm_primal_linear_objective_ &&
+        info.gap <=
+          tolerances.absolute_gap_tolerance + tolerances.relative_gap_tolerance * abs_objective;
+      if (optimal) { return make_solution(pdlp_termination_status_t::Optimal); }
+      if (iteration_limit_reached) {
+        return make_solution(pdlp_termination_status_t::IterationLimit);
+      }
+      if (time_limit_reached) { return make_solution(pdlp_termination_status_t::TimeLimit); }
+
+      if (is_major_iteration && should_restart()) {
+        restart();
+        compute_initial_fixed_point_error = true;
+        continue;
+      }
+    }
+
+    halpern_update();
+    ++iterations_since_last_restart_;
+    compute_current_AtY();
+  }
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class row_partitioned_pdlp_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class row_partitioned_pdlp_t<int, double>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class row_partitioned_pdlp_t<int64_t, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,179 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/optimization_problem.hpp>
+#include <cuopt/linear_programming/pdlp/solver_settings.hpp>
+#include <cuopt/linear_programming/pdlp/solver_solution.hpp>
+
+#include <pdlp/cusparse_view.hpp>
+#include <pdlp/pdlp_climber_strategy.hpp>
+
+#include <mip_heuristics/problem/problem.cuh>
+
+#include <utilities/timer.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <nccl.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+/**
+ * @brief PDLP over several GPUs, the constraint matrix is split by rows
+ *
+ * Each device owns a contiguous block of rows of A (balanced by number of non zeros) and the
+ * matching part of the dual vectors, the primal vectors are replicated. A @ x is local to each
+ * device while A_T @ y and the reductions over the rows are summed across devices with NCCL.
+ *
+ * Only the reflected Halpern iteration with the cuPDLP+ restart (Stable3) is implemented, without
+ * infeasibility detection, warm start or initial solutions. The input problem and the returned
+ * solution live on the first device.
+ *
+ * @tparam i_t  Data type of indexes
+ * @tparam f_t  Data type of the variables and their weights in the equations
+ */
+template <typename i_t, typename f_t>
+class row_partitioned_pdlp_t {
+ public:
+  /**
+   * @param[in] problem The problem to solve, on the current device which must be device_ids[0]
+   * @param[in] settings The PDLP settings
+   * @param[in] device_ids The devices to split the rows over, at most one shard per device
+   */
+  row_partitioned_pdlp_t(const problem_t<i_t, f_t>& problem,
+                         const pdlp_solver_settings_t<i_t, f_t>& settings,
+                         const std::vector<int>& device_ids);
+  ~row_partitioned_pdlp_t();
+
+  row_partitioned_pdlp_t(const row_partitioned_pdlp_t&)            = delete;
+  row_partitioned_pdlp_t& operator=(const row_partitioned_pdlp_t&) = delete;
+
+  optimization_problem_solution_t<i_t, f_t> run_solver(const timer_t& timer);
+
+  // Host copy of the input problem the shards are built from
+  struct host_problem_t;
+
+  // Rows [row_begin, row_begin + n_rows) of the problem on one device
+  struct shard_t {
+    shard_t(int device_id,
+            i_t row_begin,
+            i_t n_rows,
+            const host_problem_t& host_problem,
+            const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params);
+
+    int device_id;
+    i_t row_begin;
+    i_t n_rows;
+
+    rmm::cuda_stream stream;
+    raft::handle_t handle;
+    optimization_problem_t<i_t, f_t> op_problem;
+    // Scaled in place: coefficients / reverse_coefficients hold the scaled A and A_T
+    problem_t<i_t, f_t> problem;
+
+    const rmm::device_scalar<f_t> one;
+    const rmm::device_scalar<f_t> zero;
+
+    // Replicated on every device
+    rmm::device_uvector<f_t> primal;
+    rmm::device_uvector<f_t> potential_next_primal;
+    rmm::device_uvector<f_t> reflected_primal;
+    rmm::device_uvector<f_t> last_restart_primal;
+    rmm::device_uvector<f_t> dual_slack;
+    rmm::device_uvector<f_t> current_AtY;
+    rmm::device_uvector<f_t> next_AtY;
+    rmm::device_uvector<f_t> variable_scaling;
+
+    // Rows of the shard only
+    rmm::device_uvector<f_t> dual;
+    rmm::device_uvector<f_t> potential_next_dual;
+    rmm::device_uvector<f_t> reflected_dual;
+    rmm::device_uvector<f_t> last_restart_dual;
+    rmm::device_uvector<f_t> Ax;
+    rmm::device_uvector<f_t> constraint_scaling;
+
+    // Per device partial sums, added up across devices by a single all-reduce
+    rmm::device_uvector<f_t> partials;
+    rmm::device_buffer reduce_storage;
+
+    std::vector<pdlp_climber_strategy_t> climber_strategies;
+    // primal_solution is the reflected primal, dual_solution the potential next dual,
+    // tmp_primal next_AtY and tmp_dual Ax
+    cusparse_view_t<i_t, f_t> cusparse_view;
+    cusparse_dn_vec_descr_wrapper_t<f_t> primal_descr;
+    cusparse_dn_vec_descr_wrapper_t<f_t> potential_next_primal_descr;
+    cusparse_dn_vec_descr_wrapper_t<f_t> dual_descr;
+    cusparse_dn_vec_descr_wrapper_t<f_t> reflected_dual_descr;
+    cusparse_dn_vec_descr_wrapper_t<f_t> current_AtY_descr;
+  };
+
+  // Public for the device lambdas
+  void scale_problem();
+  f_t compute_squared_operator_norm();
+  void take_step();
+  void halpern_update();
+  f_t compute_fixed_point_error();
+  void compute_convergence_information();
+  bool should_restart();
+  void restart();
+  // A_T @ y into current_AtY
+  void compute_current_AtY();
+  // A_T @ reflected dual or A_T @ potential next dual into next_AtY
+  void compute_next_AtY(bool from_reflected_dual);
+  optimization_problem_solution_t<i_t, f_t> make_solution(pdlp_termination_status_t status);
+
+ private:
+  // Sums the partials over the devices and returns them on the host
+  std::vector<f_t> all_reduce_partials();
+  void all_reduce(rmm::device_uvector<f_t> shard_t::* vector, ncclRedOp_t op);
+  void sync_shards();
+
+  const problem_t<i_t, f_t>& problem_;
+  const pdlp_solver_settings_t<i_t, f_t>& settings_;
+  const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params_;
+
+  std::vector<std::unique_ptr<shard_t>> shards_;
+  std::vector<ncclComm_t> comms_;
+
+  // ||b|| and ||c|| of the unscaled problem
+  f_t l2_norm_primal_right_hand_side_{0};
+  f_t l2_norm_primal_linear_objective_{0};
+  f_t bound_rescaling_{1};
+  f_t objective_rescaling_{1};
+
+  f_t step_size_{0};
+  f_t primal_weight_{1};
+  f_t best_primal_weight_{1};
+  f_t primal_weight_error_sum_{0};
+  f_t primal_weight_last_error_{0};
+  f_t best_primal_dual_residual_gap_{std::numeric_limits<f_t>::infinity()};
+
+  i_t total_iterations_{0};
+  i_t iterations_since_last_restart_{0};
+  f_t fixed_point_error_{0};
+  f_t initial_fixed_point_error_{std::numeric_limits<f_t>::infinity()};
+  f_t last_trial_fixed_point_error_{std::numeric_limits<f_t>::infinity()};
+
+  typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t
+    termination_information_;
+  // Squared distances to the last restart point, filled with the convergence information
+  f_t primal_distance_{0};
+  f_t dual_distance_{0};
+};
+
+}  // namespace cuopt::linear_programming::detail
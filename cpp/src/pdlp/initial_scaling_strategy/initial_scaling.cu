@@ -8,6 +8,7 @@
 #include <cuopt/error.hpp>
 
 #include <utilities/copy_helpers.hpp>
+#include <utilities/logger.hpp>
 
 #include <cuopt/linear_programming/pdlp/pdlp_hyper_params.cuh>
 #include <mip_heuristics/mip_constants.hpp>
@@ -37,7 +38,9 @@ pdlp_initial_scaling_strategy_t<i_t, f_t>::pdlp_initial_scaling_strategy_t(
   rmm::device_uvector<i_t>& A_T_indices,
   pdhg_solver_t<i_t, f_t>* pdhg_solver_ptr,
   const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params,
-  bool running_mip)
+  bool running_mip,
+  const rmm::device_uvector<f_t>* initial_variable_scaling,
+  const rmm::device_uvector<f_t>* initial_constraint_scaling)
   : handle_ptr_(handle_ptr),
     stream_view_(handle_ptr_->get_stream()),
     primal_size_h_(op_problem_scaled.n_variables),
@@ -78,6 +81,30 @@ pdlp_initial_scaling_strategy_t<i_t, f_t>::pdlp_initial_scaling_strategy_t(
                cummulative_variable_scaling_.end(),
                f_t(1));
 
+  // Reuse scaling vectors from a previous solve of a structurally identical problem: the scaling
+  // only depends on the constraint matrix so the Ruiz and Pock-Chambolle passes can be skipped
+  if (initial_variable_scaling != nullptr && initial_constraint_scaling != nullptr) {
+    if (initial_variable_scaling->size() == static_cast<size_t>(primal_size_h_) &&
+        initial_constraint_scaling->size() == static_cast<size_t>(dual_size_h_)) {
+      raft::copy(cummulative_variable_scaling_.data(),
+                 initial_variable_scaling->data(),
+                 primal_size_h_,
+                 stream_view_);
+      raft::copy(cummulative_constraint_matrix_scaling_.data(),
+                 initial_constraint_scaling->data(),
+                 dual_size_h_,
+                 stream_view_);
+      return;
+    }
+    CUOPT_LOG_WARN(
+      "Initial scaling vectors sizes (%zu, %zu) do not match the problem (%d, %d), recomputing "
+      "the scaling",
+      initial_variable_scaling->size(),
+      initial_constraint_scaling->size(),
+      primal_size_h_,
+      dual_size_h_);
+  }
+
   compute_scaling_vectors(number_of_ruiz_iterations, alpha);
 }
 
@@ -561,6 +588,14 @@ void pdlp_initial_scaling_strategy_t<i_t, f_t>::scale_problem()
     print("New bounds upper", pdhg_solver_ptr_->get_new_bounds_upper());
   }
 #endif
+  // Q follows c: x = D x' / b and the objective is multiplied by o * b, hence Q' = o / b D Q D
+  if (!running_mip_ && pdhg_solver_ptr_->has_quadratic_objective()) {
+    const f_t quadratic_rescaling = hyper_params_.bound_objective_rescaling
+                                      ? h_objective_rescaling / h_bound_rescaling
+                                      : f_t(1.0);
+    pdhg_solver_ptr_->get_quadratic_objective().scale(cummulative_variable_scaling_,
+                                                      quadratic_rescaling);
+  }
   op_problem_scaled_.is_scaled_ = true;
   if (!running_mip_) {
     scale_solutions(pdhg_solver_ptr_->get_primal_solution(), pdhg_solver_ptr_->get_dual_solution());
@@ -866,4 +901,8 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_initial_scaling_strategy_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
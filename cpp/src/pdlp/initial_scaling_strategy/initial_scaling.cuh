@@ -51,7 +51,11 @@ class pdlp_initial_scaling_strategy_t {
                                   rmm::device_uvector<i_t>& A_T_indices,
                                   pdhg_solver_t<i_t, f_t>* pdhg_solver_ptr,
                                   const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params,
-                                  bool running_mip = false);
+                                  bool running_mip = false,
+                                  const rmm::device_uvector<f_t>* initial_variable_scaling =
+                                    nullptr,
+                                  const rmm::device_uvector<f_t>* initial_constraint_scaling =
+                                    nullptr);
 
   void scale_problem();
 
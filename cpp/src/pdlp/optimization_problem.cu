@@ -6,6 +6,7 @@
 /* clang-format on */
 
 #include <cuopt/error.hpp>
+#include <mps_parser/binary_format.hpp>
 #include <mps_parser/writer.hpp>
 #include <utilities/logger.hpp>
 
@@ -416,6 +417,10 @@ void optimization_problem_t<i_t, f_t>::set_quadratic_objective_matrix(
     cuopt_expects(Q_offsets != nullptr, error_type_t::ValidationError, "Q_offsets cannot be null");
   }
 
+  cuopt_expects(F_values_.empty(),
+                error_type_t::ValidationError,
+                "The quadratic objective can't be set both as a matrix and as a factor");
+
   // Replace Q with Q + Q^T
   i_t qn    = size_offsets - 1;  // Number of variables
   i_t q_nnz = size_indices;
@@ -500,6 +505,36 @@ void optimization_problem_t<i_t, f_t>::set_quadratic_objective_matrix(
   // FIX ME:: check for positive semi definite matrix
 }
 
+template <typename i_t, typename f_t>
+void optimization_problem_t<i_t, f_t>::set_quadratic_objective_factor(const f_t* F_values,
+                                                                      i_t size_values,
+                                                                      const i_t* F_indices,
+                                                                      i_t size_indices,
+                                                                      const i_t* F_offsets,
+                                                                      i_t size_offsets)
+{
+  cuopt_expects(Q_values_.empty(),
+                error_type_t::ValidationError,
+                "The quadratic objective can't be set both as a matrix and as a factor");
+  cuopt_expects(F_values != nullptr, error_type_t::ValidationError, "F_values cannot be null");
+  cuopt_expects(
+    size_values > 0, error_type_t::ValidationError, "size_values must be greater than 0");
+  cuopt_expects(F_indices != nullptr, error_type_t::ValidationError, "F_indices cannot be null");
+  cuopt_expects(size_indices == size_values,
+                error_type_t::ValidationError,
+                "size_indices must be equal to size_values");
+  cuopt_expects(F_offsets != nullptr, error_type_t::ValidationError, "F_offsets cannot be null");
+  cuopt_expects(
+    size_offsets > 1, error_type_t::ValidationError, "size_offsets must be greater than 1");
+  cuopt_expects(F_offsets[0] == 0 && F_offsets[size_offsets - 1] == size_values,
+                error_type_t::ValidationError,
+                "F_offsets must start at 0 and end at size_values");
+
+  F_values_.assign(F_values, F_values + size_values);
+  F_indices_.assign(F_indices, F_indices + size_indices);
+  F_offsets_.assign(F_offsets, F_offsets + size_offsets);
+}
+
 template <typename i_t, typename f_t>
 void optimization_problem_t<i_t, f_t>::set_variable_lower_bounds(const f_t* variable_lower_bounds,
                                                                  i_t size)
@@ -744,6 +779,27 @@ const std::vector<i_t>& optimization_problem_t<i_t, f_t>::get_quadratic_objectiv
   return Q_offsets_;
 }
 
+template <typename i_t, typename f_t>
+const std::vector<f_t>& optimization_problem_t<i_t, f_t>::get_quadratic_objective_factor_values()
+  const
+{
+  return F_values_;
+}
+
+template <typename i_t, typename f_t>
+const std::vector<i_t>& optimization_problem_t<i_t, f_t>::get_quadratic_objective_factor_indices()
+  const
+{
+  return F_indices_;
+}
+
+template <typename i_t, typename f_t>
+const std::vector<i_t>& optimization_problem_t<i_t, f_t>::get_quadratic_objective_factor_offsets()
+  const
+{
+  return F_offsets_;
+}
+
 template <typename i_t, typename f_t>
 const rmm::device_uvector<f_t>& optimization_problem_t<i_t, f_t>::get_variable_lower_bounds() const
 {
@@ -883,6 +939,18 @@ void optimization_problem_t<i_t, f_t>::set_maximize(bool _maximize)
 
 template <typename i_t, typename f_t>
 void optimization_problem_t<i_t, f_t>::write_to_mps(const std::string& mps_file_path)
+{
+  write_to_file(mps_file_path, false);
+}
+
+template <typename i_t, typename f_t>
+void optimization_problem_t<i_t, f_t>::write_to_binary(const std::string& binary_file_path)
+{
+  write_to_file(binary_file_path, true);
+}
+
+template <typename i_t, typename f_t>
+void optimization_problem_t<i_t, f_t>::write_to_file(const std::string& file_path, bool binary)
 {
   cuopt::mps_parser::data_model_view_t<i_t, f_t> data_model_view;
 
@@ -971,7 +1039,11 @@ void optimization_problem_t<i_t, f_t>::write_to_mps(const std::string& mps_file_
 
   if (!get_row_names().empty()) { data_model_view.set_row_names(get_row_names()); }
 
-  cuopt::mps_parser::write_mps(data_model_view, mps_file_path);
+  if (binary) {
+    cuopt::mps_parser::write_binary(data_model_view, file_path);
+  } else {
+    cuopt::mps_parser::write_mps(data_model_view, file_path);
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -1059,7 +1131,13 @@ void optimization_problem_t<i_t, f_t>::print_scaling_information() const
 template <typename i_t, typename f_t>
 bool optimization_problem_t<i_t, f_t>::has_quadratic_objective() const
 {
-  return !Q_values_.empty();
+  return !Q_values_.empty() || !F_values_.empty();
+}
+
+template <typename i_t, typename f_t>
+bool optimization_problem_t<i_t, f_t>::has_factored_quadratic_objective() const
+{
+  return !F_values_.empty();
 }
 // NOTE: Explicitly instantiate all types here in order to avoid linker error
 #if MIP_INSTANTIATE_FLOAT
@@ -1069,6 +1147,10 @@ template class optimization_problem_t<int, float>;
 template class optimization_problem_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class optimization_problem_t<int64_t, double>;
+#endif
+
 // TODO current raft to cusparse wrappers only support int64_t
 // can be CUSPARSE_INDEX_16U, CUSPARSE_INDEX_32I, CUSPARSE_INDEX_64I
 
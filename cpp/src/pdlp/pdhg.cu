@@ -17,6 +17,8 @@
 
 #include <cuopt/error.hpp>
 
+#include <utilities/cuda_helpers.cuh>
+
 #ifdef CUPDLP_DEBUG_MODE
 #include <utilities/copy_helpers.hpp>
 #endif
@@ -82,6 +84,7 @@ pdhg_solver_t<i_t, f_t>::pdhg_solver_t(
     reusable_device_scalar_value_0_{0.0, stream_view_},
     reusable_device_scalar_value_neg_1_{f_t(-1.0), stream_view_},
     reusable_device_scalar_1_{stream_view_},
+    quadratic_objective_{handle_ptr_, op_problem_scaled, climber_strategies.size()},
     // In both multi stream and SpMM PDLP CUDA Graphs are causing issue
     // Currently graph capture is not supported for cuSparse SpMM
     // TODO enable once cuSparse SpMM supports graph capture
@@ -93,7 +96,15 @@ pdhg_solver_t<i_t, f_t>::pdhg_solver_t(
     new_bounds_idx_{new_bounds.size(), stream_view_},
     new_bounds_lower_{new_bounds.size(), stream_view_},
     new_bounds_upper_{new_bounds.size(), stream_view_},
-    batch_size_divisor_(climber_strategies_.size())
+    batch_size_divisor_(climber_strategies_.size()),
+    mixed_precision_A_{0, stream_view_},
+    mixed_precision_A_T_{0, stream_view_},
+    unit_A_signs_{0, stream_view_},
+    unit_A_T_signs_{0, stream_view_},
+    unit_scaled_primal_{0, stream_view_},
+    unit_scaled_dual_{0, stream_view_},
+    fused_spmv_A_split_{stream_view_},
+    fused_spmv_A_T_split_{stream_view_}
 {
   if (!new_bounds.empty()) {
     cuopt_assert(new_bounds.size() == climber_strategies_.size(),
@@ -125,6 +136,21 @@ pdhg_solver_t<i_t, f_t>::pdhg_solver_t(
   thrust::fill(
     handle_ptr->get_thrust_policy(), reflected_dual_.data(), reflected_dual_.end(), f_t(0));
   thrust::fill(handle_ptr->get_thrust_policy(), dual_slack_.data(), dual_slack_.end(), f_t(0));
+
+  if ((hyper_params.use_fused_spmv_projection || hyper_params.use_mixed_precision_spmv ||
+       op_problem.unit_coefficients) &&
+      !batch_mode_) {
+    fused_spmv_A_split_ = fused_spmv_row_split_t<i_t, f_t>(
+      raft::device_span<const i_t>{cusparse_view_.A_offsets_.data(),
+                                   cusparse_view_.A_offsets_.size()},
+      dual_size_h_,
+      stream_view_);
+    fused_spmv_A_T_split_ = fused_spmv_row_split_t<i_t, f_t>(
+      raft::device_span<const i_t>{cusparse_view_.A_T_offsets_.data(),
+                                   cusparse_view_.A_T_offsets_.size()},
+      primal_size_h_,
+      stream_view_);
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -228,6 +254,18 @@ i_t pdhg_solver_t<i_t, f_t>::get_primal_size() const
   return primal_size_h_;
 }
 
+template <typename i_t, typename f_t>
+bool pdhg_solver_t<i_t, f_t>::has_quadratic_objective() const
+{
+  return !quadratic_objective_.empty();
+}
+
+template <typename i_t, typename f_t>
+quadratic_objective_t<i_t, f_t>& pdhg_solver_t<i_t, f_t>::get_quadratic_objective()
+{
+  return quadratic_objective_;
+}
+
 template <typename i_t, typename f_t>
 i_t pdhg_solver_t<i_t, f_t>::get_dual_size() const
 {
@@ -312,6 +350,16 @@ void pdhg_solver_t<i_t, f_t>::compute_At_y()
       (f_t*)cusparse_view_.buffer_transpose_batch_row_row_.data(),
       stream_view_));
   }
+
+  // QP: current_AtY = A_t @ y - Q @ x, the projections then step along c + Q x - A_t y
+  if (!quadratic_objective_.empty()) {
+    quadratic_objective_.multiply(current_saddle_point_state_.get_primal_solution().data(),
+                                  current_saddle_point_state_.get_current_AtY().data(),
+                                  reusable_device_scalar_value_neg_1_.data(),
+                                  reusable_device_scalar_value_1_.data(),
+                                  climber_strategies_.size(),
+                                  CUSPARSE_ORDER_ROW);
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -544,6 +592,100 @@ struct dual_reflected_projection_batch {
   }
 };
 
+// Epilogues of the fused SpMV + projection path (non-batch only)
+// They store the SpMV result (still needed by the step size and convergence computations) and
+// directly apply the projection / reflection on it without a second pass over memory
+template <typename f_t>
+struct fused_primal_reflected_major_epilogue {
+  using f_t2 = typename type_2<f_t>::type;
+  const f_t* primal_solution;
+  const f_t* objective_coefficients;
+  const f_t2* variable_bounds;
+  const f_t* primal_step_size;
+  f_t* current_AtY;
+  f_t* potential_next_primal;
+  f_t* dual_slack;
+  f_t* reflected_primal;
+
+  template <typename i_t>
+  DI void operator()(i_t var_idx, f_t Aty)
+  {
+    current_AtY[var_idx] = Aty;
+    auto [next_clamped, slack, reflected] =
+      primal_reflected_major_projection<f_t>(primal_step_size)(primal_solution[var_idx],
+                                                               objective_coefficients[var_idx],
+                                                               Aty,
+                                                               variable_bounds[var_idx]);
+    potential_next_primal[var_idx] = next_clamped;
+    dual_slack[var_idx]            = slack;
+    reflected_primal[var_idx]      = reflected;
+  }
+};
+
+template <typename f_t>
+struct fused_primal_reflected_epilogue {
+  using f_t2 = typename type_2<f_t>::type;
+  const f_t* primal_solution;
+  const f_t* objective_coefficients;
+  const f_t2* variable_bounds;
+  const f_t* primal_step_size;
+  f_t* current_AtY;
+  f_t* reflected_primal;
+
+  template <typename i_t>
+  DI void operator()(i_t var_idx, f_t Aty)
+  {
+    current_AtY[var_idx]      = Aty;
+    reflected_primal[var_idx] = primal_reflected_projection<f_t>(primal_step_size)(
+      primal_solution[var_idx], objective_coefficients[var_idx], Aty, variable_bounds[var_idx]);
+  }
+};
+
+template <typename f_t>
+struct fused_dual_reflected_major_epilogue {
+  const f_t* dual_solution;
+  const f_t* constraint_lower_bounds;
+  const f_t* constraint_upper_bounds;
+  const f_t* dual_step_size;
+  f_t* dual_gradient;
+  f_t* potential_next_dual;
+  f_t* reflected_dual;
+
+  template <typename i_t>
+  DI void operator()(i_t constraint_idx, f_t Ax)
+  {
+    dual_gradient[constraint_idx] = Ax;
+    auto [next_dual, reflected] =
+      dual_reflected_major_projection<f_t>(dual_step_size)(dual_solution[constraint_idx],
+                                                           Ax,
+                                                           constraint_lower_bounds[constraint_idx],
+                                                           constraint_upper_bounds[constraint_idx]);
+    potential_next_dual[constraint_idx] = next_dual;
+    reflected_dual[constraint_idx]      = reflected;
+  }
+};
+
+template <typename f_t>
+struct fused_dual_reflected_epilogue {
+  const f_t* dual_solution;
+  const f_t* constraint_lower_bounds;
+  const f_t* constraint_upper_bounds;
+  const f_t* dual_step_size;
+  f_t* dual_gradient;
+  f_t* reflected_dual;
+
+  template <typename i_t>
+  DI void operator()(i_t constraint_idx, f_t Ax)
+  {
+    dual_gradient[constraint_idx]  = Ax;
+    reflected_dual[constraint_idx] = dual_reflected_projection<f_t>(dual_step_size)(
+      dual_solution[constraint_idx],
+      Ax,
+      constraint_lower_bounds[constraint_idx],
+      constraint_upper_bounds[constraint_idx]);
+  }
+};
+
 template <typename f_t>
 struct primal_reflected_major_projection_bulk_op {
   using f_t2 = typename type_2<f_t>::type;
@@ -818,6 +960,252 @@ void pdhg_solver_t<i_t, f_t>::refine_initial_primal_projection()
                        stream_view_.value());
 }
 
+template <typename i_t, typename f_t>
+bool pdhg_solver_t<i_t, f_t>::use_fused_spmv_projection() const
+{
+  // SpMM (batch mode) already amortizes the matrix read over all climbers
+  // Mixed precision relies on the custom kernel since cuSPARSE can't mix FP32 A with FP64 vectors
+  // The QP gradient needs Q x next to A^T y, which the fused kernel doesn't compute
+  return (hyper_params_.use_fused_spmv_projection || mixed_precision_active_ ||
+          unit_coefficients_active_) &&
+         !batch_mode_ && quadratic_objective_.empty();
+}
+
+template <typename i_t, typename f_t>
+bool pdhg_solver_t<i_t, f_t>::is_unit_coefficients_active() const
+{
+  return unit_coefficients_active_;
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::enable_unit_coefficients(
+  const rmm::device_uvector<f_t>& constraint_scaling,
+  const rmm::device_uvector<f_t>& variable_scaling)
+{
+  // Same restrictions as mixed precision, the sign matrices are only read by the fused kernels
+  if (!problem_ptr->unit_coefficients || !hyper_params_.use_reflected_primal_dual || batch_mode_ ||
+      !quadratic_objective_.empty()) {
+    return;
+  }
+  cuopt_assert(constraint_scaling.size() == static_cast<size_t>(dual_size_h_),
+               "Constraint scaling size mismatch");
+  cuopt_assert(variable_scaling.size() == static_cast<size_t>(primal_size_h_),
+               "Variable scaling size mismatch");
+  // The scaling factors are positive, the scaled values keep the signs of the original ones
+  unit_A_signs_            = make_sign_mask(make_span(cusparse_view_.A_), stream_view_);
+  unit_A_T_signs_          = make_sign_mask(make_span(cusparse_view_.A_T_), stream_view_);
+  unit_constraint_scaling_ = make_span(constraint_scaling);
+  unit_variable_scaling_   = make_span(variable_scaling);
+  unit_scaled_primal_.resize(primal_size_h_, stream_view_);
+  unit_scaled_dual_.resize(dual_size_h_, stream_view_);
+  unit_coefficients_active_ = true;
+}
+
+template <typename i_t, typename f_t>
+bool pdhg_solver_t<i_t, f_t>::is_mixed_precision_active() const
+{
+  return mixed_precision_active_;
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::enable_mixed_precision()
+{
+  // FP32 matrix is only worth it when iterates are in double, float problems already read FP32
+  if constexpr (std::is_same_v<f_t, double>) {
+    // The sign matrices of a unit coefficient problem are already cheaper to read. The fallback
+    // to the FP64 matrix watches the fixed point error, without it the FP32 floor is never left
+    if (!hyper_params_.use_mixed_precision_spmv || !hyper_params_.use_reflected_primal_dual ||
+        !hyper_params_.use_fixed_point_error || batch_mode_ || !quadratic_objective_.empty() ||
+        unit_coefficients_active_) {
+      return;
+    }
+    // Must be called once the problem is scaled, the copies are not updated afterwards
+    mixed_precision_A_.resize(cusparse_view_.A_.size(), stream_view_);
+    mixed_precision_A_T_.resize(cusparse_view_.A_T_.size(), stream_view_);
+    cub::DeviceTransform::Transform(cusparse_view_.A_.data(),
+                                    mixed_precision_A_.data(),
+                                    mixed_precision_A_.size(),
+                                    [] HD(f_t value) { return static_cast<float>(value); },
+                                    stream_view_.value());
+    cub::DeviceTransform::Transform(cusparse_view_.A_T_.data(),
+                                    mixed_precision_A_T_.data(),
+                                    mixed_precision_A_T_.size(),
+                                    [] HD(f_t value) { return static_cast<float>(value); },
+                                    stream_view_.value());
+    mixed_precision_active_ = true;
+  }
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::disable_mixed_precision()
+{
+  if (!mixed_precision_active_) { return; }
+  mixed_precision_active_ = false;
+  // Captured graphs point to the FP32 matrix, they need to be recaptured
+  graph_all.reset();
+  graph_prim_proj_gradient_dual.reset();
+  // Make sure no graph using the FP32 matrix is still in flight before freeing it
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
+  mixed_precision_A_.resize(0, stream_view_);
+  mixed_precision_A_.shrink_to_fit(stream_view_);
+  mixed_precision_A_T_.resize(0, stream_view_);
+  mixed_precision_A_T_.shrink_to_fit(stream_view_);
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::compute_fused_primal_reflected_projection(
+  rmm::device_uvector<f_t>& primal_step_size, bool should_major)
+{
+  raft::common::nvtx::range fun_scope("compute_fused_primal_reflected_projection");
+  cuopt_assert(!batch_mode_, "Fused SpMV projection is not supported in batch mode");
+
+  // A_t @ y fused with the primal projection, one logical warp per variable
+  const auto A_T_offsets = raft::device_span<const i_t>{cusparse_view_.A_T_offsets_.data(),
+                                                        cusparse_view_.A_T_offsets_.size()};
+  const auto A_T_indices = raft::device_span<const i_t>{cusparse_view_.A_T_indices_.data(),
+                                                        cusparse_view_.A_T_indices_.size()};
+  const f_t* dual_solution = current_saddle_point_state_.get_dual_solution().data();
+
+  auto spmv_projection = [&](auto A_T_values, const f_t* y, auto scale_epilogue) {
+    if (should_major) {
+      fused_csr_spmv(A_T_offsets,
+                     A_T_indices,
+                     A_T_values,
+                     y,
+                     primal_size_h_,
+                     fused_spmv_A_T_split_,
+                     scale_epilogue(fused_primal_reflected_major_epilogue<f_t>{
+                       current_saddle_point_state_.get_primal_solution().data(),
+                       problem_ptr->objective_coefficients.data(),
+                       problem_ptr->variable_bounds.data(),
+                       primal_step_size.data(),
+                       current_saddle_point_state_.get_current_AtY().data(),
+                       potential_next_primal_solution_.data(),
+                       dual_slack_.data(),
+                       reflected_primal_.data()}),
+                     stream_view_);
+    } else {
+      fused_csr_spmv(A_T_offsets,
+                     A_T_indices,
+                     A_T_values,
+                     y,
+                     primal_size_h_,
+                     fused_spmv_A_T_split_,
+                     scale_epilogue(fused_primal_reflected_epilogue<f_t>{
+                       current_saddle_point_state_.get_primal_solution().data(),
+                       problem_ptr->objective_coefficients.data(),
+                       problem_ptr->variable_bounds.data(),
+                       primal_step_size.data(),
+                       current_saddle_point_state_.get_current_AtY().data(),
+                       reflected_primal_.data()}),
+                     stream_view_);
+    }
+  };
+
+  const auto unscaled = [](auto epilogue) { return epilogue; };
+  if (unit_coefficients_active_) {
+    // A_T = D_c S_T D_r: D_r y goes through the sign matrix, D_c is applied to the dot products
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(dual_solution, unit_constraint_scaling_.data()),
+      unit_scaled_dual_.data(),
+      unit_scaled_dual_.size(),
+      cuda::std::multiplies<f_t>{},
+      stream_view_.value());
+    spmv_projection(sign_values_t{make_span(unit_A_T_signs_)},
+                    unit_scaled_dual_.data(),
+                    [this](auto epilogue) {
+                      return row_scaled_epilogue_t<f_t, decltype(epilogue)>{
+                        unit_variable_scaling_.data(), epilogue};
+                    });
+  } else if (mixed_precision_active_) {
+    spmv_projection(
+      raft::device_span<const float>{mixed_precision_A_T_.data(), mixed_precision_A_T_.size()},
+      dual_solution,
+      unscaled);
+  } else {
+    spmv_projection(
+      raft::device_span<const f_t>{cusparse_view_.A_T_.data(), cusparse_view_.A_T_.size()},
+      dual_solution,
+      unscaled);
+  }
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::compute_fused_dual_reflected_projection(
+  rmm::device_uvector<f_t>& dual_step_size, bool should_major)
+{
+  raft::common::nvtx::range fun_scope("compute_fused_dual_reflected_projection");
+  cuopt_assert(!batch_mode_, "Fused SpMV projection is not supported in batch mode");
+
+  // A @ x_reflected fused with the dual projection, one logical warp per constraint
+  const auto A_offsets = raft::device_span<const i_t>{cusparse_view_.A_offsets_.data(),
+                                                      cusparse_view_.A_offsets_.size()};
+  const auto A_indices = raft::device_span<const i_t>{cusparse_view_.A_indices_.data(),
+                                                      cusparse_view_.A_indices_.size()};
+
+  auto spmv_projection = [&](auto A_values, const f_t* x, auto scale_epilogue) {
+    if (should_major) {
+      fused_csr_spmv(A_offsets,
+                     A_indices,
+                     A_values,
+                     x,
+                     dual_size_h_,
+                     fused_spmv_A_split_,
+                     scale_epilogue(fused_dual_reflected_major_epilogue<f_t>{
+                       current_saddle_point_state_.get_dual_solution().data(),
+                       problem_ptr->constraint_lower_bounds.data(),
+                       problem_ptr->constraint_upper_bounds.data(),
+                       dual_step_size.data(),
+                       current_saddle_point_state_.get_dual_gradient().data(),
+                       potential_next_dual_solution_.data(),
+                       reflected_dual_.data()}),
+                     stream_view_);
+    } else {
+      fused_csr_spmv(A_offsets,
+                     A_indices,
+                     A_values,
+                     x,
+                     dual_size_h_,
+                     fused_spmv_A_split_,
+                     scale_epilogue(fused_dual_reflected_epilogue<f_t>{
+                       current_saddle_point_state_.get_dual_solution().data(),
+                       problem_ptr->constraint_lower_bounds.data(),
+                       problem_ptr->constraint_upper_bounds.data(),
+                       dual_step_size.data(),
+                       current_saddle_point_state_.get_dual_gradient().data(),
+                       reflected_dual_.data()}),
+                     stream_view_);
+    }
+  };
+
+  const auto unscaled = [](auto epilogue) { return epilogue; };
+  if (unit_coefficients_active_) {
+    // A = D_r S D_c: D_c x goes through the sign matrix, D_r is applied to the dot products
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(reflected_primal_.data(), unit_variable_scaling_.data()),
+      unit_scaled_primal_.data(),
+      unit_scaled_primal_.size(),
+      cuda::std::multiplies<f_t>{},
+      stream_view_.value());
+    spmv_projection(sign_values_t{make_span(unit_A_signs_)},
+                    unit_scaled_primal_.data(),
+                    [this](auto epilogue) {
+                      return row_scaled_epilogue_t<f_t, decltype(epilogue)>{
+                        unit_constraint_scaling_.data(), epilogue};
+                    });
+  } else if (mixed_precision_active_) {
+    spmv_projection(
+      raft::device_span<const float>{mixed_precision_A_.data(), mixed_precision_A_.size()},
+      reflected_primal_.data(),
+      unscaled);
+  } else {
+    spmv_projection(
+      raft::device_span<const f_t>{cusparse_view_.A_.data(), cusparse_view_.A_.size()},
+      reflected_primal_.data(),
+      unscaled);
+  }
+}
+
 template <typename i_t, typename f_t>
 void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
   rmm::device_uvector<f_t>& primal_step_size,
@@ -834,8 +1222,10 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
     if (!graph_all.is_initialized(should_major)) {
       graph_all.start_capture(should_major);
 
-      compute_At_y();
-      if (!batch_mode_) {
+      if (use_fused_spmv_projection()) {
+        compute_fused_primal_reflected_projection(primal_step_size, should_major);
+      } else if (!batch_mode_) {
+        compute_At_y();
         cub::DeviceTransform::Transform(
           cuda::std::make_tuple(current_saddle_point_state_.get_primal_solution().data(),
                                 problem_ptr->objective_coefficients.data(),
@@ -847,6 +1237,7 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
           primal_reflected_major_projection<f_t>(primal_step_size.data()),
           stream_view_.value());
       } else {
+        compute_At_y();
         cub::DeviceFor::Bulk(potential_next_primal_solution_.size(),
                              primal_reflected_major_projection_bulk_op<f_t>{
                                current_saddle_point_state_.get_primal_solution().data(),
@@ -894,9 +1285,10 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
 #endif
 
       // Compute next dual
-      compute_A_x();
-
-      if (!batch_mode_) {
+      if (use_fused_spmv_projection()) {
+        compute_fused_dual_reflected_projection(dual_step_size, should_major);
+      } else if (!batch_mode_) {
+        compute_A_x();
         cub::DeviceTransform::Transform(
           cuda::std::make_tuple(current_saddle_point_state_.get_dual_solution().data(),
                                 current_saddle_point_state_.get_dual_gradient().data(),
@@ -907,6 +1299,7 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
           dual_reflected_major_projection<f_t>(dual_step_size.data()),
           stream_view_.value());
       } else {
+        compute_A_x();
         cub::DeviceFor::Bulk(potential_next_dual_solution_.size(),
                              dual_reflected_major_projection_bulk_op<f_t>{
                                current_saddle_point_state_.get_dual_solution().data(),
@@ -933,17 +1326,17 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
       graph_all.start_capture(should_major);
 
       // Compute next primal
-      compute_At_y();
-
+      if (use_fused_spmv_projection()) {
+        compute_fused_primal_reflected_projection(primal_step_size, should_major);
+      } else if (!batch_mode_) {
+        compute_At_y();
 #ifdef CUPDLP_DEBUG_MODE
-      print("current_saddle_point_state_.get_primal_solution()",
-            current_saddle_point_state_.get_primal_solution());
-      print("problem_ptr->objective_coefficients", problem_ptr->objective_coefficients);
-      print("current_saddle_point_state_.get_current_AtY()",
-            current_saddle_point_state_.get_current_AtY());
+        print("current_saddle_point_state_.get_primal_solution()",
+              current_saddle_point_state_.get_primal_solution());
+        print("problem_ptr->objective_coefficients", problem_ptr->objective_coefficients);
+        print("current_saddle_point_state_.get_current_AtY()",
+              current_saddle_point_state_.get_current_AtY());
 #endif
-
-      if (!batch_mode_) {
         cub::DeviceTransform::Transform(
           cuda::std::make_tuple(current_saddle_point_state_.get_primal_solution().data(),
                                 problem_ptr->objective_coefficients.data(),
@@ -954,6 +1347,7 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
           primal_reflected_projection<f_t>(primal_step_size.data()),
           stream_view_.value());
       } else {
+        compute_At_y();
         cub::DeviceFor::Bulk(reflected_primal_.size(),
                              primal_reflected_projection_bulk_op<f_t>{
                                current_saddle_point_state_.get_primal_solution().data(),
@@ -1002,9 +1396,10 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
 #endif
 
       // Compute next dual
-      compute_A_x();
-
-      if (!batch_mode_) {
+      if (use_fused_spmv_projection()) {
+        compute_fused_dual_reflected_projection(dual_step_size, should_major);
+      } else if (!batch_mode_) {
+        compute_A_x();
         cub::DeviceTransform::Transform(
           cuda::std::make_tuple(current_saddle_point_state_.get_dual_solution().data(),
                                 current_saddle_point_state_.get_dual_gradient().data(),
@@ -1015,6 +1410,7 @@ void pdhg_solver_t<i_t, f_t>::compute_next_primal_dual_solution_reflected(
           dual_reflected_projection<f_t>(dual_step_size.data()),
           stream_view_.value());
       } else {
+        compute_A_x();
         cub::DeviceFor::Bulk(reflected_dual_.size(),
                              dual_reflected_projection_bulk_op<f_t>{
                                current_saddle_point_state_.get_dual_solution().data(),
@@ -1100,6 +1496,231 @@ void pdhg_solver_t<i_t, f_t>::update_solution(
                            current_saddle_point_state_.dual_solution_.data()));
 }
 
+template <typename i_t, typename f_t>
+pdhg_candidate_steps_t<i_t, f_t>::pdhg_candidate_steps_t(raft::handle_t const* handle_ptr,
+                                                         cusparse_view_t<i_t, f_t>& cusparse_view,
+                                                         i_t primal_size,
+                                                         i_t dual_size,
+                                                         i_t n_candidates)
+  : n_candidates(n_candidates),
+    step_sizes{static_cast<size_t>(n_candidates), handle_ptr->get_stream()},
+    primal_step_sizes{static_cast<size_t>(n_candidates), handle_ptr->get_stream()},
+    dual_step_sizes{static_cast<size_t>(n_candidates), handle_ptr->get_stream()},
+    primal_solutions{static_cast<size_t>(primal_size) * n_candidates, handle_ptr->get_stream()},
+    delta_primals{static_cast<size_t>(primal_size) * n_candidates, handle_ptr->get_stream()},
+    reflected_primals{static_cast<size_t>(primal_size) * n_candidates, handle_ptr->get_stream()},
+    dual_gradients{static_cast<size_t>(dual_size) * n_candidates, handle_ptr->get_stream()},
+    dual_solutions{static_cast<size_t>(dual_size) * n_candidates, handle_ptr->get_stream()},
+    delta_duals{static_cast<size_t>(dual_size) * n_candidates, handle_ptr->get_stream()},
+    next_AtYs{static_cast<size_t>(primal_size) * n_candidates, handle_ptr->get_stream()},
+    buffer_non_transpose{0, handle_ptr->get_stream()},
+    buffer_transpose{0, handle_ptr->get_stream()}
+{
+  reflected_primals_descr.create(
+    primal_size, n_candidates, primal_size, reflected_primals.data(), CUSPARSE_ORDER_COL);
+  dual_gradients_descr.create(
+    dual_size, n_candidates, dual_size, dual_gradients.data(), CUSPARSE_ORDER_COL);
+  dual_solutions_descr.create(
+    dual_size, n_candidates, dual_size, dual_solutions.data(), CUSPARSE_ORDER_COL);
+  next_AtYs_descr.create(
+    primal_size, n_candidates, primal_size, next_AtYs.data(), CUSPARSE_ORDER_COL);
+
+  const rmm::device_scalar<f_t> alpha{1, handle_ptr->get_stream()};
+  const rmm::device_scalar<f_t> beta{0, handle_ptr->get_stream()};
+  size_t buffer_size_non_transpose = 0;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm_bufferSize(handle_ptr->get_cusparse_handle(),
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  alpha.data(),
+                                                  cusparse_view.A,
+                                                  reflected_primals_descr,
+                                                  beta.data(),
+                                                  dual_gradients_descr,
+                                                  CUSPARSE_SPMM_CSR_ALG3,
+                                                  &buffer_size_non_transpose,
+                                                  handle_ptr->get_stream()));
+  buffer_non_transpose.resize(buffer_size_non_transpose, handle_ptr->get_stream());
+
+  size_t buffer_size_transpose = 0;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm_bufferSize(handle_ptr->get_cusparse_handle(),
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  alpha.data(),
+                                                  cusparse_view.A_T,
+                                                  dual_solutions_descr,
+                                                  beta.data(),
+                                                  next_AtYs_descr,
+                                                  CUSPARSE_SPMM_CSR_ALG3,
+                                                  &buffer_size_transpose,
+                                                  handle_ptr->get_stream()));
+  buffer_transpose.resize(buffer_size_transpose, handle_ptr->get_stream());
+}
+
+// Same projection as primal_projection, with the primal step size of the candidate of the column
+template <typename i_t, typename f_t, typename f_t2>
+__global__ void candidate_primal_projection_kernel(const f_t* primal_solution,
+                                                   const f_t* objective_coefficients,
+                                                   const f_t* current_AtY,
+                                                   const f_t2* variable_bounds,
+                                                   const f_t* primal_step_sizes,
+                                                   i_t primal_size,
+                                                   i_t n_candidates,
+                                                   f_t* primal_solutions,
+                                                   f_t* delta_primals,
+                                                   f_t* reflected_primals)
+{
+  const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= static_cast<size_t>(primal_size) * n_candidates) { return; }
+
+  const i_t j        = static_cast<i_t>(idx % primal_size);
+  const f_t primal   = primal_solution[j];
+  const f_t gradient = objective_coefficients[j] - current_AtY[j];
+  f_t next           = primal - primal_step_sizes[idx / primal_size] * gradient;
+  next = raft::max<f_t>(raft::min<f_t>(next, get_upper(variable_bounds[j])),
+                        get_lower(variable_bounds[j]));
+
+  primal_solutions[idx]  = next;
+  delta_primals[idx]     = next - primal;
+  reflected_primals[idx] = next - primal + next;
+}
+
+// Same projection as dual_projection, with the dual step size of the candidate of the column
+template <typename i_t, typename f_t>
+__global__ void candidate_dual_projection_kernel(const f_t* dual_solution,
+                                                 const f_t* constraint_lower_bounds,
+                                                 const f_t* constraint_upper_bounds,
+                                                 const f_t* dual_step_sizes,
+                                                 const f_t* dual_gradients,
+                                                 i_t dual_size,
+                                                 i_t n_candidates,
+                                                 f_t* dual_solutions,
+                                                 f_t* delta_duals)
+{
+  const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= static_cast<size_t>(dual_size) * n_candidates) { return; }
+
+  const i_t j          = static_cast<i_t>(idx % dual_size);
+  const f_t step_size  = dual_step_sizes[idx / dual_size];
+  const f_t dual       = dual_solution[j];
+  const f_t next       = dual - step_size * dual_gradients[idx];
+  const f_t low        = next + step_size * constraint_lower_bounds[j];
+  const f_t up         = next + step_size * constraint_upper_bounds[j];
+  const f_t projection = raft::max<f_t>(low, raft::min<f_t>(up, f_t(0)));
+
+  dual_solutions[idx] = projection;
+  delta_duals[idx]    = projection - dual;
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::take_candidate_steps(pdhg_candidate_steps_t<i_t, f_t>& candidates)
+{
+  raft::common::nvtx::range fun_scope("take_candidate_steps");
+  cuopt_assert(!batch_mode_, "Candidate steps are not supported in batch mode");
+  cuopt_assert(!hyper_params_.use_reflected_primal_dual,
+               "Candidate steps are only supported for non reflected primal dual");
+  cuopt_assert(quadratic_objective_.empty(), "Candidate steps are not supported for QP");
+
+  using f_t2 = typename type_2<f_t>::type;
+
+  // A_t @ y is current: the rejected trial step that precedes the candidates computed it
+  const auto [primal_grid_size, primal_block_size] =
+    kernel_config_from_batch_size(static_cast<size_t>(primal_size_h_) * candidates.n_candidates);
+  candidate_primal_projection_kernel<i_t, f_t, f_t2>
+    <<<primal_grid_size, primal_block_size, 0, stream_view_.value()>>>(
+      current_saddle_point_state_.get_primal_solution().data(),
+      problem_ptr->objective_coefficients.data(),
+      current_saddle_point_state_.get_current_AtY().data(),
+      problem_ptr->variable_bounds.data(),
+      candidates.primal_step_sizes.data(),
+      primal_size_h_,
+      candidates.n_candidates,
+      candidates.primal_solutions.data(),
+      candidates.delta_primals.data(),
+      candidates.reflected_primals.data());
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+
+  // A (2 x' - x) of every candidate
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm(handle_ptr_->get_cusparse_handle(),
+                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                       reusable_device_scalar_value_1_.data(),
+                                       cusparse_view_.A,
+                                       candidates.reflected_primals_descr,
+                                       reusable_device_scalar_value_0_.data(),
+                                       candidates.dual_gradients_descr,
+                                       CUSPARSE_SPMM_CSR_ALG3,
+                                       (f_t*)candidates.buffer_non_transpose.data(),
+                                       stream_view_));
+
+  const auto [dual_grid_size, dual_block_size] =
+    kernel_config_from_batch_size(static_cast<size_t>(dual_size_h_) * candidates.n_candidates);
+  candidate_dual_projection_kernel<i_t, f_t>
+    <<<dual_grid_size, dual_block_size, 0, stream_view_.value()>>>(
+      current_saddle_point_state_.get_dual_solution().data(),
+      problem_ptr->constraint_lower_bounds.data(),
+      problem_ptr->constraint_upper_bounds.data(),
+      candidates.dual_step_sizes.data(),
+      candidates.dual_gradients.data(),
+      dual_size_h_,
+      candidates.n_candidates,
+      candidates.dual_solutions.data(),
+      candidates.delta_duals.data());
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+
+  // A_t @ y' of every candidate, needed for the interaction and reused by the accepted one
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm(handle_ptr_->get_cusparse_handle(),
+                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                       reusable_device_scalar_value_1_.data(),
+                                       cusparse_view_.A_T,
+                                       candidates.dual_solutions_descr,
+                                       reusable_device_scalar_value_0_.data(),
+                                       candidates.next_AtYs_descr,
+                                       CUSPARSE_SPMM_CSR_ALG3,
+                                       (f_t*)candidates.buffer_transpose.data(),
+                                       stream_view_));
+
+  total_pdhg_iterations_ += 1;
+}
+
+template <typename i_t, typename f_t>
+void pdhg_solver_t<i_t, f_t>::accept_candidate_step(
+  const pdhg_candidate_steps_t<i_t, f_t>& candidates, i_t k)
+{
+  cuopt_assert(k >= 0 && k < candidates.n_candidates, "Candidate index is out of bounds");
+
+  const size_t primal_offset = static_cast<size_t>(k) * primal_size_h_;
+  const size_t dual_offset   = static_cast<size_t>(k) * dual_size_h_;
+  raft::copy(potential_next_primal_solution_.data(),
+             candidates.primal_solutions.data() + primal_offset,
+             primal_size_h_,
+             stream_view_);
+  raft::copy(current_saddle_point_state_.get_delta_primal().data(),
+             candidates.delta_primals.data() + primal_offset,
+             primal_size_h_,
+             stream_view_);
+  raft::copy(current_saddle_point_state_.get_next_AtY().data(),
+             candidates.next_AtYs.data() + primal_offset,
+             primal_size_h_,
+             stream_view_);
+  raft::copy(potential_next_dual_solution_.data(),
+             candidates.dual_solutions.data() + dual_offset,
+             dual_size_h_,
+             stream_view_);
+  raft::copy(current_saddle_point_state_.get_delta_dual().data(),
+             candidates.delta_duals.data() + dual_offset,
+             dual_size_h_,
+             stream_view_);
+  raft::copy(current_saddle_point_state_.get_dual_gradient().data(),
+             candidates.dual_gradients.data() + dual_offset,
+             dual_size_h_,
+             stream_view_);
+}
+
 template <typename i_t, typename f_t>
 saddle_point_state_t<i_t, f_t>& pdhg_solver_t<i_t, f_t>::get_saddle_point_state()
 {
@@ -1197,10 +1818,17 @@ rmm::device_uvector<f_t>& pdhg_solver_t<i_t, f_t>::get_dual_solution()
 }
 
 #if MIP_INSTANTIATE_FLOAT
+template struct pdhg_candidate_steps_t<int, float>;
 template class pdhg_solver_t<int, float>;
 #endif
 #if MIP_INSTANTIATE_DOUBLE
+template struct pdhg_candidate_steps_t<int, double>;
 template class pdhg_solver_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template struct pdhg_candidate_steps_t<int64_t, double>;
+template class pdhg_solver_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
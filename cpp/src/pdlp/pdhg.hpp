@@ -10,8 +10,10 @@
 #include <mip_heuristics/problem/problem.cuh>
 #include <pdlp/cusparse_view.hpp>
 #include <pdlp/pdlp_climber_strategy.hpp>
+#include <pdlp/quadratic_objective.hpp>
 #include <pdlp/saddle_point.hpp>
 #include <pdlp/swap_and_resize_helper.cuh>
+#include <pdlp/utilities/fused_spmv_projection.cuh>
 #include <pdlp/utilities/ping_pong_graph.cuh>
 
 #include <raft/core/handle.hpp>
@@ -21,6 +23,43 @@
 #include <rmm/device_uvector.hpp>
 
 namespace cuopt::linear_programming::detail {
+
+// PDHG steps of several candidate step sizes, used by the speculative trials of the adaptive step
+// size strategy. Buffers are column major, column k holding the step of candidate k
+template <typename i_t, typename f_t>
+struct pdhg_candidate_steps_t {
+  pdhg_candidate_steps_t(raft::handle_t const* handle_ptr,
+                         cusparse_view_t<i_t, f_t>& cusparse_view,
+                         i_t primal_size,
+                         i_t dual_size,
+                         i_t n_candidates);
+
+  i_t n_candidates;
+
+  rmm::device_uvector<f_t> step_sizes;
+  rmm::device_uvector<f_t> primal_step_sizes;
+  rmm::device_uvector<f_t> dual_step_sizes;
+
+  rmm::device_uvector<f_t> primal_solutions;
+  rmm::device_uvector<f_t> delta_primals;
+  // 2 x' - x, the SpMM input of the dual step
+  rmm::device_uvector<f_t> reflected_primals;
+  // A (2 x' - x)
+  rmm::device_uvector<f_t> dual_gradients;
+  rmm::device_uvector<f_t> dual_solutions;
+  rmm::device_uvector<f_t> delta_duals;
+  // A_T y', becomes current_AtY if the candidate is accepted
+  rmm::device_uvector<f_t> next_AtYs;
+
+  cusparse_dn_mat_descr_wrapper_t<f_t> reflected_primals_descr;
+  cusparse_dn_mat_descr_wrapper_t<f_t> dual_gradients_descr;
+  cusparse_dn_mat_descr_wrapper_t<f_t> dual_solutions_descr;
+  cusparse_dn_mat_descr_wrapper_t<f_t> next_AtYs_descr;
+
+  rmm::device_uvector<uint8_t> buffer_non_transpose;
+  rmm::device_uvector<uint8_t> buffer_transpose;
+};
+
 template <typename i_t, typename f_t>
 class pdhg_solver_t {
  public:
@@ -50,6 +89,9 @@ class pdhg_solver_t {
   rmm::device_uvector<f_t>& get_dual_solution();
   i_t get_primal_size() const;
   i_t get_dual_size() const;
+  // Quadratic objective of the scaled problem, empty for an LP
+  bool has_quadratic_objective() const;
+  quadratic_objective_t<i_t, f_t>& get_quadratic_objective();
 
   void swap_context(const thrust::universal_host_pinned_vector<swap_pair_t<i_t>>& swap_pairs);
   void resize_context(i_t new_size);
@@ -66,8 +108,27 @@ class pdhg_solver_t {
                  i_t total_pdlp_iterations,
                  bool is_major_iteration);
   void update_solution(cusparse_view_t<i_t, f_t>& current_op_problem_evaluation_cusparse_view_);
+  // Non reflected PDHG step of every candidate at once: the A (2 x' - x) and the A_T y' of all the
+  // candidates are each one SpMM, so the matrix is read once for all of them
+  void take_candidate_steps(pdhg_candidate_steps_t<i_t, f_t>& candidates);
+  // Makes candidate k the potential next solution, as if take_step had used its step size
+  void accept_candidate_step(const pdhg_candidate_steps_t<i_t, f_t>& candidates, i_t k);
   void refine_initial_primal_projection();
 
+  // Mixed precision: PDHG SpMVs read an FP32 copy of A and A_T, see use_mixed_precision_spmv
+  // Copies the scaled matrix, has to be called after the initial scaling
+  void enable_mixed_precision();
+  bool is_mixed_precision_active() const;
+  // Switch PDHG back to the full precision matrix and free the FP32 copies
+  void disable_mixed_precision();
+
+  // When all the coefficients of the original A are +1 or -1, PDHG SpMVs read the signs of A and
+  // A_T as bitmasks instead of their values, the scaled matrix being D_r S D_c.
+  // Has to be called after the initial scaling, takes precedence over mixed precision
+  void enable_unit_coefficients(const rmm::device_uvector<f_t>& constraint_scaling,
+                                const rmm::device_uvector<f_t>& variable_scaling);
+  bool is_unit_coefficients_active() const;
+
   i_t total_pdhg_iterations_;
 
  private:
@@ -86,6 +147,14 @@ class pdhg_solver_t {
   void compute_At_y();
   void compute_A_x();
 
+  // Custom CSR SpMV with the reflected projection fused in the same pass, used instead of
+  // cuSPARSE SpMV + DeviceTransform when hyper_params.use_fused_spmv_projection is set
+  bool use_fused_spmv_projection() const;
+  void compute_fused_primal_reflected_projection(rmm::device_uvector<f_t>& primal_step_size,
+                                                 bool should_major);
+  void compute_fused_dual_reflected_projection(rmm::device_uvector<f_t>& dual_step_size,
+                                               bool should_major);
+
   bool batch_mode_{false};
   raft::handle_t const* handle_ptr_{nullptr};
   rmm::cuda_stream_view stream_view_;
@@ -115,6 +184,9 @@ class pdhg_solver_t {
   const rmm::device_scalar<f_t> reusable_device_scalar_value_neg_1_;
   rmm::device_scalar<f_t> reusable_device_scalar_1_;
 
+  // Q x is accumulated into current_AtY so that the projections see the QP gradient c + Q x - A^T y
+  quadratic_objective_t<i_t, f_t> quadratic_objective_;
+
   // Different graphs for each case
   // Either compute the whole next primal step
   // Or skip the SpMV (most cases) if it was done at the previous iteration
@@ -131,6 +203,26 @@ class pdhg_solver_t {
   rmm::device_uvector<f_t> new_bounds_lower_;
   rmm::device_uvector<f_t> new_bounds_upper_;
   cuda::fast_mod_div<size_t> batch_size_divisor_;
+
+  // FP32 copies of the scaled A and A_T values, only allocated in mixed precision
+  rmm::device_uvector<float> mixed_precision_A_;
+  rmm::device_uvector<float> mixed_precision_A_T_;
+  bool mixed_precision_active_{false};
+
+  // Sign bitmasks of A and A_T and the scaling vectors of the problem they were built for, only
+  // allocated when the coefficients are all +1 or -1
+  rmm::device_uvector<uint32_t> unit_A_signs_;
+  rmm::device_uvector<uint32_t> unit_A_T_signs_;
+  raft::device_span<const f_t> unit_constraint_scaling_;
+  raft::device_span<const f_t> unit_variable_scaling_;
+  // D_c x and D_r y, the SpMV inputs of the sign matrices
+  rmm::device_uvector<f_t> unit_scaled_primal_;
+  rmm::device_uvector<f_t> unit_scaled_dual_;
+  bool unit_coefficients_active_{false};
+
+  // Heavy row split of A and A_T for the fused SpMV, only built when it can be used
+  fused_spmv_row_split_t<i_t, f_t> fused_spmv_A_split_;
+  fused_spmv_row_split_t<i_t, f_t> fused_spmv_A_T_split_;
 };
 
 }  // namespace cuopt::linear_programming::detail
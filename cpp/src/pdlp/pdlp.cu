@@ -19,6 +19,7 @@
 #include "cuopt/linear_programming/pdlp/solver_solution.hpp"
 
 #include <utilities/copy_helpers.hpp>
+#include <utilities/instrumentation.hpp>
 #include <utilities/macros.cuh>
 
 #include <raft/sparse/detail/cusparse_wrappers.h>
@@ -97,7 +98,14 @@ pdlp_solver_t<i_t, f_t>::pdlp_solver_t(problem_t<i_t, f_t>& op_problem,
                               op_problem_scaled_.reverse_offsets,
                               op_problem_scaled_.reverse_constraints,
                               &pdhg_solver_,
-                              settings_.hyper_params},
+                              settings_.hyper_params,
+                              false,
+                              settings_.has_initial_scaling_vectors()
+                                ? &settings_.get_initial_variable_scaling()
+                                : nullptr,
+                              settings_.has_initial_scaling_vectors()
+                                ? &settings_.get_initial_constraint_scaling()
+                                : nullptr},
     average_op_problem_evaluation_cusparse_view_{handle_ptr_,
                                                  op_problem,
                                                  unscaled_primal_avg_solution_,
@@ -152,6 +160,8 @@ pdlp_solver_t<i_t, f_t>::pdlp_solver_t(problem_t<i_t, f_t>& op_problem,
                                   initial_scaling_strategy_,
                                   settings_,
                                   climber_strategies_},
+    unscaled_quadratic_objective_{handle_ptr_, op_problem, climber_strategies_.size()},
+    quadratic_interaction_{0, stream_view_},
     initial_primal_{0, stream_view_},
     initial_dual_{0, stream_view_},
     reusable_device_scalar_value_1_{f_t(1.0), stream_view_},
@@ -166,6 +176,19 @@ pdlp_solver_t<i_t, f_t>::pdlp_solver_t(problem_t<i_t, f_t>& op_problem,
                step_size_.end(),
                (f_t)settings_.hyper_params.initial_step_size_scaling);
 
+  if (!unscaled_quadratic_objective_.empty()) {
+    // The fixed point step sizes and restarts are the ones extended to Q, see
+    // update_quadratic_step_size and compute_fixed_error
+    cuopt_expects(settings_.hyper_params.use_reflected_primal_dual &&
+                    !settings_.hyper_params.use_adaptive_step_size_strategy &&
+                    is_cupdlpx_restart<i_t, f_t>(settings_.hyper_params),
+                  error_type_t::ValidationError,
+                  "Quadratic objectives are only supported by PDLP modes with the reflected "
+                  "iterates and the cuPDLPx restart (Stable3, the default)");
+    average_termination_strategy_.set_quadratic_objective(&unscaled_quadratic_objective_);
+    current_termination_strategy_.set_quadratic_objective(&unscaled_quadratic_objective_);
+  }
+
   if (settings_.has_initial_primal_solution()) {
     auto& primal_sol = settings_.get_initial_primal_solution();
     set_initial_primal_solution(primal_sol);
@@ -552,6 +575,31 @@ void pdlp_solver_t<i_t, f_t>::set_inside_mip(bool inside_mip)
   inside_mip_ = inside_mip;
 }
 
+template <typename i_t, typename f_t>
+void pdlp_solver_t<i_t, f_t>::fill_phase_timings(
+  optimization_problem_solution_t<i_t, f_t>& solution)
+{
+  if (!phase_timers_.is_enabled()) { return; }
+  using phase_t        = pdlp_phase_timers_t::phase_t;
+  const double pdhg    = phase_timers_.get_elapsed_seconds(phase_t::PdhgStep);
+  const double step    = phase_timers_.get_elapsed_seconds(phase_t::StepSize);
+  const double restart = phase_timers_.get_elapsed_seconds(phase_t::Restart);
+  const double check   = phase_timers_.get_elapsed_seconds(phase_t::TerminationCheck);
+  for (auto& info : solution.get_additional_termination_informations()) {
+    info.pdhg_step_time         = pdhg;
+    info.step_size_time         = step;
+    info.restart_time           = restart;
+    info.termination_check_time = check;
+  }
+  CUOPT_LOG_CONDITIONAL_INFO(!inside_mip_,
+                             "PDLP GPU time: PDHG step %.3fs, step size %.3fs, restart %.3fs, "
+                             "termination check %.3fs",
+                             pdhg,
+                             step,
+                             restart,
+                             check);
+}
+
 template <typename i_t, typename f_t>
 void pdlp_solver_t<i_t, f_t>::record_best_primal_so_far(
   const detail::pdlp_termination_strategy_t<i_t, f_t>& current,
@@ -637,7 +685,7 @@ pdlp_warm_start_data_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::get_filled_warmed_star
   if (batch_mode_)
     return pdlp_warm_start_data_t<i_t, f_t>();
   else {
-    return pdlp_warm_start_data_t<i_t, f_t>(
+    pdlp_warm_start_data_t<i_t, f_t> warm_start_data(
       pdhg_solver_.get_primal_solution(),
       pdhg_solver_.get_dual_solution(),
       unscaled_primal_avg_solution_,
@@ -655,6 +703,20 @@ pdlp_warm_start_data_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::get_filled_warmed_star
       restart_strategy_.last_restart_kkt_score,
       restart_strategy_.weighted_average_solution_.sum_primal_solution_weights_.value(stream_view_),
       restart_strategy_.weighted_average_solution_.iterations_since_last_restart_);
+    const auto& variable_scaling = initial_scaling_strategy_.get_variable_scaling_vector();
+    const auto& constraint_scaling =
+      initial_scaling_strategy_.get_constraint_matrix_scaling_vector();
+    warm_start_data.variable_scaling_.resize(variable_scaling.size(), stream_view_);
+    warm_start_data.constraint_scaling_.resize(constraint_scaling.size(), stream_view_);
+    raft::copy(warm_start_data.variable_scaling_.data(),
+               variable_scaling.data(),
+               variable_scaling.size(),
+               stream_view_);
+    raft::copy(warm_start_data.constraint_scaling_.data(),
+               constraint_scaling.data(),
+               constraint_scaling.size(),
+               stream_view_);
+    return warm_start_data;
   }
 }
 
@@ -860,6 +922,8 @@ std::optional<optimization_problem_solution_t<i_t, f_t>> pdlp_solver_t<i_t, f_t>
 
   // Still need to always compute the termination condition for current even if we don't check them
   // after for kkt restart
+  // Both evaluations are on the same stream: if the average one follows, only sync once after it
+  const bool evaluate_average = !settings_.hyper_params.never_restart_to_average;
   current_termination_strategy_.evaluate_termination_criteria(
     pdhg_solver_,
     (settings_.hyper_params.use_adaptive_step_size_strategy)
@@ -873,7 +937,8 @@ std::optional<optimization_problem_solution_t<i_t, f_t>> pdlp_solver_t<i_t, f_t>
     pdhg_solver_.get_saddle_point_state().get_delta_dual(),
     total_pdlp_iterations_,
     problem_ptr->combined_bounds,
-    problem_ptr->objective_coefficients);
+    problem_ptr->objective_coefficients,
+    !evaluate_average);
 #ifdef PDLP_VERBOSE_MODE
   RAFT_CUDA_TRY(cudaDeviceSynchronize());
   printf("Termination criteria current\n");
@@ -882,7 +947,7 @@ std::optional<optimization_problem_solution_t<i_t, f_t>> pdlp_solver_t<i_t, f_t>
 #endif
 
   // Check both average and current solution
-  if (!settings_.hyper_params.never_restart_to_average) {
+  if (evaluate_average) {
     average_termination_strategy_.evaluate_termination_criteria(
       pdhg_solver_,
       unscaled_primal_avg_solution_,
@@ -1437,6 +1502,7 @@ HDI void fixed_error_computation(const f_t norm_squared_delta_primal,
                                  const f_t primal_weight,
                                  const f_t step_size,
                                  const f_t interaction,
+                                 const f_t quadratic_interaction,
                                  f_t* fixed_point_error)
 {
   cuopt_assert(!isnan(norm_squared_delta_primal), "norm_squared_delta_primal must not be NaN");
@@ -1451,7 +1517,8 @@ HDI void fixed_error_computation(const f_t norm_squared_delta_primal,
 
   const f_t movement =
     norm_squared_delta_primal * primal_weight + norm_squared_delta_dual / primal_weight;
-  const f_t computed_interaction = f_t(2.0) * interaction * step_size;
+  // For a QP, interaction includes delta_primal^T Q x from the current_AtY term which is removed
+  const f_t computed_interaction = f_t(2.0) * (interaction - quadratic_interaction) * step_size;
 
   cuopt_assert(movement + computed_interaction >= f_t(0.0),
                "Movement + computed interaction must be >= 0");
@@ -1472,6 +1539,7 @@ __global__ void kernel_compute_fixed_error(raft::device_span<const f_t> norm_squ
                                            raft::device_span<const f_t> primal_weight,
                                            raft::device_span<const f_t> step_size,
                                            raft::device_span<const f_t> interaction,
+                                           raft::device_span<const f_t> quadratic_interaction,
                                            raft::device_span<f_t> fixed_point_error)
 {
   const size_t index = blockIdx.x * blockDim.x + threadIdx.x;
@@ -1479,6 +1547,8 @@ __global__ void kernel_compute_fixed_error(raft::device_span<const f_t> norm_squ
                  norm_squared_delta_primal.size() == primal_weight.size() &&
                  norm_squared_delta_primal.size() == step_size.size() &&
                  norm_squared_delta_primal.size() == interaction.size() &&
+                 (quadratic_interaction.empty() ||
+                  norm_squared_delta_primal.size() == quadratic_interaction.size()) &&
                  norm_squared_delta_primal.size() == fixed_point_error.size(),
                "All vectors must have the same size");
   if (index >= norm_squared_delta_primal.size()) { return; }
@@ -1487,6 +1557,8 @@ __global__ void kernel_compute_fixed_error(raft::device_span<const f_t> norm_squ
                                primal_weight[index],
                                step_size[index],
                                interaction[index],
+                               quadratic_interaction.empty() ? f_t(0.0)
+                                                             : quadratic_interaction[index],
                                &fixed_point_error[index]);
 }
 
@@ -1792,6 +1864,28 @@ void pdlp_solver_t<i_t, f_t>::resize_and_swap_all_context_loop(
   RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
 }
 
+template <typename i_t, typename f_t>
+void pdlp_solver_t<i_t, f_t>::check_mixed_precision_progress()
+{
+  if (batch_mode_ || !pdhg_solver_.is_mixed_precision_active()) { return; }
+
+  // FP32 rounding of A puts a floor on the reachable fixed point error, once it stops
+  // decreasing meaningfully the remaining iterations have to use the full precision matrix
+  constexpr f_t min_relative_decrease = f_t(0.9);
+  const f_t fixed_point_error         = restart_strategy_.fixed_point_error_[0];
+  if (fixed_point_error < mixed_precision_best_fixed_point_error_ * min_relative_decrease) {
+    mixed_precision_best_fixed_point_error_ = fixed_point_error;
+    mixed_precision_stalled_checks_         = 0;
+    return;
+  }
+  if (++mixed_precision_stalled_checks_ < settings_.hyper_params.mixed_precision_stall_checks) {
+    return;
+  }
+  CUOPT_LOG_DEBUG("Fixed point error stalled at %+.2e, switching PDHG to full precision matrix",
+                  fixed_point_error);
+  pdhg_solver_.disable_mixed_precision();
+}
+
 template <typename i_t, typename f_t>
 void pdlp_solver_t<i_t, f_t>::compute_fixed_error(std::vector<int>& has_restarted)
 {
@@ -1849,6 +1943,16 @@ void pdlp_solver_t<i_t, f_t>::compute_fixed_error(std::vector<int>& has_restarte
   step_size_strategy_.compute_interaction_and_movement(
     pdhg_solver_.get_primal_tmp_resource(), cusparse_view, pdhg_solver_.get_saddle_point_state());
 
+  // QP: current_AtY is A^T y - Q x, the interaction picked up delta_primal^T Q x
+  if (pdhg_solver_.has_quadratic_objective()) {
+    quadratic_interaction_.resize(climber_strategies_.size(), stream_view_);
+    pdhg_solver_.get_quadratic_objective().compute_cross_term(
+      pdhg_solver_.get_saddle_point_state().get_delta_primal().data(),
+      pdhg_solver_.get_primal_solution().data(),
+      climber_strategies_.size(),
+      quadratic_interaction_);
+  }
+
   if (batch_mode_) {
     const auto [grid_size, block_size] = kernel_config_from_batch_size(climber_strategies_.size());
     kernel_compute_fixed_error<f_t><<<grid_size, block_size, 0, stream_view_>>>(
@@ -1857,6 +1961,7 @@ void pdlp_solver_t<i_t, f_t>::compute_fixed_error(std::vector<int>& has_restarte
       make_span(primal_weight_),
       make_span(step_size_),
       make_span(step_size_strategy_.get_interaction()),
+      make_span(quadratic_interaction_),
       make_span(restart_strategy_.fixed_point_error_));
     RAFT_CUDA_TRY(cudaStreamSynchronize(
       stream_view_));  // To make sure all the data is written from device to host
@@ -1871,6 +1976,9 @@ void pdlp_solver_t<i_t, f_t>::compute_fixed_error(std::vector<int>& has_restarte
                                  primal_weight_.element(0, stream_view_),
                                  step_size_.element(0, stream_view_),
                                  step_size_strategy_.get_interaction(0),
+                                 pdhg_solver_.has_quadratic_objective()
+                                   ? quadratic_interaction_.element(0, stream_view_)
+                                   : f_t(0.0),
                                  &restart_strategy_.fixed_point_error_[0]);
   }
 
@@ -2089,6 +2197,10 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
     compute_initial_primal_weight();
 
   initial_scaling_strategy_.scale_problem();
+  pdhg_solver_.enable_unit_coefficients(
+    initial_scaling_strategy_.get_constraint_matrix_scaling_vector(),
+    initial_scaling_strategy_.get_variable_scaling_vector());
+  pdhg_solver_.enable_mixed_precision();
 
   if (!settings_.hyper_params.compute_initial_step_size_before_scaling &&
       !settings_.get_initial_step_size().has_value())
@@ -2153,6 +2265,13 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
   // computing/setting the initial primal weight and step size and if they are not recomputed later.
   step_size_strategy_.get_primal_and_dual_stepsizes(primal_step_size_, dual_step_size_);
 
+  // QP: the step size is bounded by both ||A|| and the largest eigenvalue of Q
+  if (pdhg_solver_.has_quadratic_objective()) {
+    quadratic_max_eigenvalue_ = pdhg_solver_.get_quadratic_objective().compute_max_eigenvalue();
+    squared_operator_norm_    = compute_squared_operator_norm();
+    update_quadratic_step_size();
+  }
+
 #ifdef CUPDLP_DEBUG_MODE
   if (initial_primal_.size() != 0 || initial_dual_.size() != 0) {
     std::cout << "Initial primal and dual solution before scaling" << std::endl;
@@ -2276,6 +2395,7 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
       "   Iter    Primal Obj.      Dual Obj.    Gap        Primal Res.  Dual Res.   Time");
   }
   while (true) {
+    CUOPT_NVTX_RANGE(pdlp, "iteration");
 #ifdef CUPDLP_DEBUG_MODE
     printf("Step: %d\n", total_pdlp_iterations_);
 #endif
@@ -2391,7 +2511,9 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
 #endif
 
       // Check for termination
+      phase_timers_.start(pdlp_phase_timers_t::phase_t::TerminationCheck);
       std::optional<optimization_problem_solution_t<i_t, f_t>> solution = check_termination(timer);
+      phase_timers_.stop(pdlp_phase_timers_t::phase_t::TerminationCheck);
 
       if (solution.has_value()) { return std::move(solution.value()); }
 
@@ -2415,6 +2537,7 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
             static_cast<int>(
               detail::pdlp_restart_strategy_t<i_t, f_t>::restart_strategy_t::NO_RESTART) &&
           (is_major_iteration || artificial_restart_check_main_loop)) {
+        phase_timers_.start(pdlp_phase_timers_t::phase_t::Restart);
         restart_strategy_.compute_restart(
           pdhg_solver_,
           unscaled_primal_avg_solution_,
@@ -2429,6 +2552,9 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
           best_primal_weight_,  // Needed for cuPDLP+ restart
           has_restarted         // Needed for cuPDLP+ restart
         );
+        // The restart updates the primal weight which the QP step size depends on
+        if (pdhg_solver_.has_quadratic_objective()) { update_quadratic_step_size(); }
+        phase_timers_.stop(pdlp_phase_timers_t::phase_t::Restart);
       }
 
       if (!settings_.hyper_params.rescale_for_restart) {
@@ -2492,7 +2618,10 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
           transpose_primal_dual_back_to_col(
             pdhg_solver_.get_primal_solution(), pdhg_solver_.get_dual_solution(), dummy);
         }
+        phase_timers_.start(pdlp_phase_timers_t::phase_t::Restart);
         compute_fixed_error(has_restarted);  // May set has_restarted to false
+        phase_timers_.stop(pdlp_phase_timers_t::phase_t::Restart);
+        check_mixed_precision_progress();
         if (batch_mode_) {
           rmm::device_uvector<f_t> dummy(0, stream_view_);
           transpose_primal_dual_to_row(pdhg_solver_.get_reflected_primal(),
@@ -2502,11 +2631,18 @@ optimization_problem_solution_t<i_t, f_t> pdlp_solver_t<i_t, f_t>::run_solver(co
             pdhg_solver_.get_primal_solution(), pdhg_solver_.get_dual_solution(), dummy);
         }
       }
+      phase_timers_.start(pdlp_phase_timers_t::phase_t::Restart);
       halpern_update();
+      phase_timers_.stop(pdlp_phase_timers_t::phase_t::Restart);
     }
 
     ++total_pdlp_iterations_;
     ++internal_solver_iterations_;
+    CUOPT_COUNTER_ADD("pdlp.iterations", 1);
+    // A x and A^T y of every climber, values and column indices of the matrix
+    CUOPT_COUNTER_ADD("pdlp.spmv_bytes",
+                      2 * climber_strategies_.size() * op_problem_scaled_.nnz *
+                        (sizeof(f_t) + sizeof(i_t)));
     if (settings_.hyper_params.never_restart_to_average)
       restart_strategy_.increment_iteration_since_last_restart();
   }
@@ -2520,7 +2656,26 @@ void pdlp_solver_t<i_t, f_t>::take_adaptive_step(i_t total_pdlp_iterations, bool
   // continue testing stepsize until we find a valid one or encounter a numerical error
   step_size_strategy_.set_valid_step_size(0);
 
+  // After a rejection, the trials take several candidate step sizes at once
+  const bool speculative_trials = settings_.hyper_params.speculative_step_size_candidates > 1 &&
+                                  !pdhg_solver_.has_quadratic_objective();
+  bool rejected = false;
+
   while (step_size_strategy_.get_valid_step_size() == 0) {
+    if (rejected && speculative_trials) {
+      phase_timers_.start(pdlp_phase_timers_t::phase_t::StepSize);
+      step_size_strategy_.compute_speculative_step_sizes(
+        pdhg_solver_, primal_step_size_, dual_step_size_);
+      phase_timers_.stop(pdlp_phase_timers_t::phase_t::StepSize);
+      // Every candidate shares the same two reads of the matrix
+      CUOPT_COUNTER_ADD("pdlp.speculative_trials", 1);
+      CUOPT_COUNTER_ADD("pdlp.spmv_bytes",
+                        2 * op_problem_scaled_.nnz * (sizeof(f_t) + sizeof(i_t)));
+      if (step_size_strategy_.get_valid_step_size() == 0) {
+        CUOPT_COUNTER_ADD("pdlp.rejected_steps", 1);
+      }
+      continue;
+    }
 #ifdef PDLP_DEBUG_MODE
     std::cout << "PDHG Iteration:" << std::endl;
     print("primal_weight_", primal_weight_);
@@ -2528,15 +2683,26 @@ void pdlp_solver_t<i_t, f_t>::take_adaptive_step(i_t total_pdlp_iterations, bool
     print("primal_step_size_", primal_step_size_);
     print("dual_step_size_", dual_step_size_);
 #endif
+    phase_timers_.start(pdlp_phase_timers_t::phase_t::PdhgStep);
     pdhg_solver_.take_step(primal_step_size_,
                            dual_step_size_,
                            restart_strategy_.get_iterations_since_last_restart(),
                            restart_strategy_.get_last_restart_was_average(),
                            total_pdlp_iterations,
                            is_major_iteration);
+    phase_timers_.stop(pdlp_phase_timers_t::phase_t::PdhgStep);
 
+    phase_timers_.start(pdlp_phase_timers_t::phase_t::StepSize);
     step_size_strategy_.compute_step_sizes(
       pdhg_solver_, primal_step_size_, dual_step_size_, total_pdlp_iterations);
+    phase_timers_.stop(pdlp_phase_timers_t::phase_t::StepSize);
+    if (step_size_strategy_.get_valid_step_size() == 0) {
+      // A rejected trial costs the same A x and A^T y as an accepted one
+      CUOPT_COUNTER_ADD("pdlp.rejected_steps", 1);
+      CUOPT_COUNTER_ADD("pdlp.spmv_bytes",
+                        2 * op_problem_scaled_.nnz * (sizeof(f_t) + sizeof(i_t)));
+      rejected = true;
+    }
   }
 #ifdef PDLP_DEBUG_MODE
   std::cout << "PDHG Iteration: valid step size found" << std::endl;
@@ -2555,8 +2721,10 @@ void pdlp_solver_t<i_t, f_t>::take_adaptive_step(i_t total_pdlp_iterations, bool
 template <typename i_t, typename f_t>
 void pdlp_solver_t<i_t, f_t>::take_constant_step(bool is_major_iteration)
 {
+  phase_timers_.start(pdlp_phase_timers_t::phase_t::PdhgStep);
   pdhg_solver_.take_step(
     primal_step_size_, dual_step_size_, 0, false, total_pdlp_iterations_, is_major_iteration);
+  phase_timers_.stop(pdlp_phase_timers_t::phase_t::PdhgStep);
 }
 
 template <typename i_t, typename f_t>
@@ -2677,122 +2845,161 @@ void pdlp_solver_t<i_t, f_t>::compute_initial_step_size()
     // Sync since we are using local variable
     RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
   } else {
-    constexpr i_t max_iterations = 5000;
-    constexpr f_t tolerance      = 1e-4;
+    constexpr f_t scaling_factor = 0.998;
+    const f_t step_size          = scaling_factor / std::sqrt(compute_squared_operator_norm());
+    thrust::uninitialized_fill(
+      handle_ptr_->get_thrust_policy(), step_size_.begin(), step_size_.end(), step_size);
+  }
+}
 
-    i_t m = op_problem_scaled_.n_constraints;
-    i_t n = op_problem_scaled_.n_variables;
+template <typename i_t, typename f_t>
+f_t pdlp_solver_t<i_t, f_t>::compute_squared_operator_norm()
+{
+  raft::common::nvtx::range fun_scope("compute_squared_operator_norm");
 
-    std::vector<f_t> z(m);
-    rmm::device_uvector<f_t> d_z(m, stream_view_);
-    rmm::device_uvector<f_t> d_q(m, stream_view_);
-    rmm::device_uvector<f_t> d_atq(n, stream_view_);
+  constexpr i_t max_iterations = 5000;
+  constexpr f_t tolerance      = 1e-4;
 
-    std::mt19937 gen(1);
-    std::normal_distribution<f_t> dist(f_t(0.0), f_t(1.0));
+  i_t m = op_problem_scaled_.n_constraints;
+  i_t n = op_problem_scaled_.n_variables;
 
-    for (int i = 0; i < m; ++i)
-      z[i] = dist(gen);
+  std::vector<f_t> z(m);
+  rmm::device_uvector<f_t> d_z(m, stream_view_);
+  rmm::device_uvector<f_t> d_q(m, stream_view_);
+  rmm::device_uvector<f_t> d_atq(n, stream_view_);
 
-    device_copy(d_z, z, stream_view_);
+  std::mt19937 gen(1);
+  std::normal_distribution<f_t> dist(f_t(0.0), f_t(1.0));
 
-    rmm::device_scalar<f_t> norm_q(stream_view_);
-    rmm::device_scalar<f_t> sigma_max_sq(stream_view_);
-    rmm::device_scalar<f_t> residual_norm(stream_view_);
-    rmm::device_scalar<f_t> reusable_device_scalar_value_1_(1, stream_view_);
-    rmm::device_scalar<f_t> reusable_device_scalar_value_0_(0, stream_view_);
+  for (int i = 0; i < m; ++i)
+    z[i] = dist(gen);
 
-    cusparseDnVecDescr_t vecZ, vecQ, vecATQ;
-    RAFT_CUSPARSE_TRY(
-      raft::sparse::detail::cusparsecreatednvec(&vecZ, m, const_cast<f_t*>(d_z.data())));
-    RAFT_CUSPARSE_TRY(
-      raft::sparse::detail::cusparsecreatednvec(&vecQ, m, const_cast<f_t*>(d_q.data())));
-    RAFT_CUSPARSE_TRY(
-      raft::sparse::detail::cusparsecreatednvec(&vecATQ, n, const_cast<f_t*>(d_atq.data())));
+  device_copy(d_z, z, stream_view_);
 
-    const auto& cusparse_view_ = pdhg_solver_.get_cusparse_view();
+  rmm::device_scalar<f_t> norm_q(stream_view_);
+  rmm::device_scalar<f_t> sigma_max_sq(stream_view_);
+  rmm::device_scalar<f_t> residual_norm(stream_view_);
+  rmm::device_scalar<f_t> reusable_device_scalar_value_1_(1, stream_view_);
+  rmm::device_scalar<f_t> reusable_device_scalar_value_0_(0, stream_view_);
 
-    [[maybe_unused]] int sing_iters = 0;
-    for (int i = 0; i < max_iterations; ++i) {
-      ++sing_iters;
-      // d_q = d_z
-      raft::copy(d_q.data(), d_z.data(), m, stream_view_);
-      // norm_q = l2_norm(d_q)
-      my_l2_norm<i_t, f_t>(d_q, norm_q, handle_ptr_);
+  cusparseDnVecDescr_t vecZ, vecQ, vecATQ;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsecreatednvec(&vecZ, m, const_cast<f_t*>(d_z.data())));
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsecreatednvec(&vecQ, m, const_cast<f_t*>(d_q.data())));
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsecreatednvec(&vecATQ, n, const_cast<f_t*>(d_atq.data())));
 
-      cuopt_assert(norm_q.value(stream_view_) != f_t(0), "norm q can't be 0");
+  const auto& cusparse_view_ = pdhg_solver_.get_cusparse_view();
 
-      // d_q *= 1 / norm_q
-      cub::DeviceTransform::Transform(
-        d_q.data(),
-        d_q.data(),
-        d_q.size(),
-        [norm_q = norm_q.data()] __device__(f_t d_q) { return d_q / *norm_q; },
-        stream_view_.value());
+  [[maybe_unused]] int sing_iters = 0;
+  for (int i = 0; i < max_iterations; ++i) {
+    ++sing_iters;
+    // d_q = d_z
+    raft::copy(d_q.data(), d_z.data(), m, stream_view_);
+    // norm_q = l2_norm(d_q)
+    my_l2_norm<i_t, f_t>(d_q, norm_q, handle_ptr_);
 
-      // A_t_q = A_t @ d_q
-      RAFT_CUSPARSE_TRY(
-        raft::sparse::detail::cusparsespmv(handle_ptr_->get_cusparse_handle(),
-                                           CUSPARSE_OPERATION_NON_TRANSPOSE,
-                                           reusable_device_scalar_value_1_.data(),
-                                           cusparse_view_.A_T,
-                                           vecQ,
-                                           reusable_device_scalar_value_0_.data(),
-                                           vecATQ,
-                                           CUSPARSE_SPMV_CSR_ALG2,
-                                           (f_t*)cusparse_view_.buffer_transpose.data(),
-                                           stream_view_.value()));
-
-      // z = A @ A_t_q
-      RAFT_CUSPARSE_TRY(
-        raft::sparse::detail::cusparsespmv(handle_ptr_->get_cusparse_handle(),
-                                           CUSPARSE_OPERATION_NON_TRANSPOSE,
-                                           reusable_device_scalar_value_1_.data(),  // 1
-                                           cusparse_view_.A,
-                                           vecATQ,
-                                           reusable_device_scalar_value_0_.data(),  // 1
-                                           vecZ,
-                                           CUSPARSE_SPMV_CSR_ALG2,
-                                           (f_t*)cusparse_view_.buffer_non_transpose.data(),
-                                           stream_view_.value()));
-      // sigma_max_sq = dot(q, z)
-      RAFT_CUBLAS_TRY(raft::linalg::detail::cublasdot(handle_ptr_->get_cublas_handle(),
-                                                      m,
-                                                      d_q.data(),
-                                                      primal_stride,
-                                                      d_z.data(),
-                                                      primal_stride,
-                                                      sigma_max_sq.data(),
-                                                      stream_view_.value()));
+    cuopt_assert(norm_q.value(stream_view_) != f_t(0), "norm q can't be 0");
 
-      cub::DeviceTransform::Transform(
-        cuda::std::make_tuple(d_q.data(), d_z.data()),
-        d_q.data(),
-        d_q.size(),
-        [sigma_max_sq = sigma_max_sq.data()] __device__(f_t d_q, f_t d_z) {
-          return d_q * -(*sigma_max_sq) + d_z;
-        },
-        stream_view_.value());
+    // d_q *= 1 / norm_q
+    cub::DeviceTransform::Transform(
+      d_q.data(),
+      d_q.data(),
+      d_q.size(),
+      [norm_q = norm_q.data()] __device__(f_t d_q) { return d_q / *norm_q; },
+      stream_view_.value());
 
-      my_l2_norm<i_t, f_t>(d_q, residual_norm, handle_ptr_);
+    // A_t_q = A_t @ d_q
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv(handle_ptr_->get_cusparse_handle(),
+                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                         reusable_device_scalar_value_1_.data(),
+                                         cusparse_view_.A_T,
+                                         vecQ,
+                                         reusable_device_scalar_value_0_.data(),
+                                         vecATQ,
+                                         CUSPARSE_SPMV_CSR_ALG2,
+                                         (f_t*)cusparse_view_.buffer_transpose.data(),
+                                         stream_view_.value()));
+
+    // z = A @ A_t_q
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv(handle_ptr_->get_cusparse_handle(),
+                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                         reusable_device_scalar_value_1_.data(),  // 1
+                                         cusparse_view_.A,
+                                         vecATQ,
+                                         reusable_device_scalar_value_0_.data(),  // 1
+                                         vecZ,
+                                         CUSPARSE_SPMV_CSR_ALG2,
+                                         (f_t*)cusparse_view_.buffer_non_transpose.data(),
+                                         stream_view_.value()));
+    // sigma_max_sq = dot(q, z)
+    RAFT_CUBLAS_TRY(raft::linalg::detail::cublasdot(handle_ptr_->get_cublas_handle(),
+                                                    m,
+                                                    d_q.data(),
+                                                    primal_stride,
+                                                    d_z.data(),
+                                                    primal_stride,
+                                                    sigma_max_sq.data(),
+                                                    stream_view_.value()));
 
-      if (residual_norm.value(stream_view_) < tolerance) break;
-    }
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(d_q.data(), d_z.data()),
+      d_q.data(),
+      d_q.size(),
+      [sigma_max_sq = sigma_max_sq.data()] __device__(f_t d_q, f_t d_z) {
+        return d_q * -(*sigma_max_sq) + d_z;
+      },
+      stream_view_.value());
+
+    my_l2_norm<i_t, f_t>(d_q, residual_norm, handle_ptr_);
+
+    if (residual_norm.value(stream_view_) < tolerance) break;
+  }
 #ifdef CUPDLP_DEBUG_MODE
-    printf("iter_count %d\n", sing_iters);
+  printf("iter_count %d\n", sing_iters);
 #endif
 
-    constexpr f_t scaling_factor = 0.998;
-    const f_t step_size          = scaling_factor / std::sqrt(sigma_max_sq.value(stream_view_));
-    thrust::uninitialized_fill(
-      handle_ptr_->get_thrust_policy(), step_size_.begin(), step_size_.end(), step_size);
+  const f_t squared_norm = sigma_max_sq.value(stream_view_);
 
-    // Sync since we are using local variable
-    RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
-    RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecZ));
-    RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecQ));
-    RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecATQ));
-  }
+  // Sync since we are using local variable
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
+  RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecZ));
+  RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecQ));
+  RAFT_CUSPARSE_TRY(cusparseDestroyDnVec(vecATQ));
+  return squared_norm;
+}
+
+template <typename f_t>
+__global__ void quadratic_step_size_kernel(raft::device_span<const f_t> primal_weight,
+                                           raft::device_span<f_t> step_size,
+                                           f_t max_eigenvalue,
+                                           f_t squared_operator_norm)
+{
+  const size_t index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (index >= step_size.size()) { return; }
+
+  // Largest eta such that 1 / tau - lambda_max(Q) >= sigma ||A||^2, with tau = eta / omega and
+  // sigma = eta * omega. It reduces to the LP step size 1 / ||A|| when Q = 0
+  constexpr f_t scaling_factor = 0.998;
+  const f_t lambda             = max_eigenvalue / primal_weight[index];
+  const f_t root               = raft::sqrt(lambda * lambda + f_t(4.0) * squared_operator_norm);
+  step_size[index]             = scaling_factor * f_t(2.0) / (lambda + root);
+}
+
+template <typename i_t, typename f_t>
+void pdlp_solver_t<i_t, f_t>::update_quadratic_step_size()
+{
+  const auto [grid_size, block_size] = kernel_config_from_batch_size(climber_strategies_.size());
+  quadratic_step_size_kernel<f_t><<<grid_size, block_size, 0, stream_view_>>>(
+    make_span(primal_weight_),
+    make_span(step_size_),
+    quadratic_max_eigenvalue_,
+    squared_operator_norm_);
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+  step_size_strategy_.get_primal_and_dual_stepsizes(primal_step_size_, dual_step_size_);
 }
 
 template <typename i_t, typename f_t>
@@ -2939,4 +3146,8 @@ template __global__ void compute_weights_initial_primal_weight_from_squared_norm
   const pdlp_hyper_params::pdlp_hyper_params_t hyper_params);
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_solver_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
@@ -14,11 +14,13 @@
 #include <pdlp/initial_scaling_strategy/initial_scaling.cuh>
 #include <pdlp/pdhg.hpp>
 #include <pdlp/pdlp_climber_strategy.hpp>
+#include <pdlp/quadratic_objective.hpp>
 #include <pdlp/restart_strategy/pdlp_restart_strategy.cuh>
 #include <pdlp/step_size_strategy/adaptive_step_size_strategy.hpp>
 #include <pdlp/swap_and_resize_helper.cuh>
 #include <pdlp/termination_strategy/convergence_information.hpp>
 #include <pdlp/termination_strategy/termination_strategy.hpp>
+#include <pdlp/utilities/phase_timers.cuh>
 
 #include <mip_heuristics/problem/problem.cuh>
 
@@ -29,6 +31,7 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <limits>
 #include <optional>
 #include <unordered_set>
 
@@ -97,8 +100,13 @@ class pdlp_solver_t {
 
   void set_inside_mip(bool inside_mip);
 
+  // Fill the per phase GPU times of the solution if collect_phase_timings is set
+  void fill_phase_timings(optimization_problem_solution_t<i_t, f_t>& solution);
+
   void compute_initial_step_size();
   void compute_initial_primal_weight();
+  // Squared largest singular value of the scaled A, estimated with a power iteration
+  f_t compute_squared_operator_norm();
 
  private:
   void print_termination_criteria(const timer_t& timer, bool is_average = false);
@@ -179,6 +187,10 @@ class pdlp_solver_t {
 
  private:
   void compute_fixed_error(std::vector<int>& has_restarted);
+  // QP: largest step size of each climber for which PDHG converges with the Q Lipschitz constant
+  void update_quadratic_step_size();
+  // Falls back to the full precision matrix once the fixed point error stalls
+  void check_mixed_precision_progress();
 
   pdlp_warm_start_data_t<i_t, f_t> get_filled_warmed_start_data();
 
@@ -202,6 +214,14 @@ class pdlp_solver_t {
   detail::pdlp_termination_strategy_t<i_t, f_t> average_termination_strategy_;
   detail::pdlp_termination_strategy_t<i_t, f_t> current_termination_strategy_;
 
+  // Convex QP: Q of the unscaled problem for the termination checks, the scaled one is in PDHG
+  detail::quadratic_objective_t<i_t, f_t> unscaled_quadratic_objective_;
+  // Largest eigenvalue of the scaled Q and squared norm of the scaled A, bound the QP step size
+  f_t quadratic_max_eigenvalue_{0};
+  f_t squared_operator_norm_{0};
+  // delta_primal^T Q x of each climber, current_AtY holds A^T y - Q x in the fixed point error
+  rmm::device_uvector<f_t> quadratic_interaction_;
+
   /* Two counters are necessary because of the PDLP warm start data
    *  total_pdlp_iterations_: total, counting potential previous PDLP iterations
    *    Useful for:
@@ -216,6 +236,13 @@ class pdlp_solver_t {
   i_t total_pdlp_iterations_{0};
   i_t internal_solver_iterations_{0};
 
+  // Mixed precision stall detection
+  f_t mixed_precision_best_fixed_point_error_{std::numeric_limits<f_t>::infinity()};
+  i_t mixed_precision_stalled_checks_{0};
+
+  // Only records if collect_phase_timings is toggled
+  detail::pdlp_phase_timers_t phase_timers_{stream_view_, settings_.collect_phase_timings};
+
   // Initial solution
   rmm::device_uvector<f_t> initial_primal_;
   rmm::device_uvector<f_t> initial_dual_;
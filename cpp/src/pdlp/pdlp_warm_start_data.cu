@@ -159,7 +159,9 @@ pdlp_warm_start_data_t<i_t, f_t>::pdlp_warm_start_data_t(const pdlp_warm_start_d
     last_candidate_kkt_score_(other.last_candidate_kkt_score_),
     last_restart_kkt_score_(other.last_restart_kkt_score_),
     sum_solution_weight_(other.sum_solution_weight_),
-    iterations_since_last_restart_(other.iterations_since_last_restart_)
+    iterations_since_last_restart_(other.iterations_since_last_restart_),
+    variable_scaling_(other.variable_scaling_, other.variable_scaling_.stream()),
+    constraint_scaling_(other.constraint_scaling_, other.constraint_scaling_.stream())
 {
   check_sizes();
 }
@@ -185,4 +187,8 @@ template class pdlp_warm_start_data_t<int, float>;
 #if MIP_INSTANTIATE_DOUBLE
 template class pdlp_warm_start_data_t<int, double>;
 #endif
+
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_warm_start_data_t<int64_t, double>;
+#endif
 }  // namespace cuopt::linear_programming
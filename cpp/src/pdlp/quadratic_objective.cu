@@ -0,0 +1,448 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/error.hpp>
+
+#include <pdlp/pdlp_constants.hpp>
+#include <pdlp/quadratic_objective.hpp>
+#include <pdlp/utils.cuh>
+
+#include <mip_heuristics/mip_constants.hpp>
+
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/sparse/detail/cusparse_wrappers.h>
+#include <raft/core/cusparse_macros.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/linalg/detail/cublas_wrappers.hpp>
+#include <raft/util/cuda_utils.cuh>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+
+#include <cub/cub.cuh>
+
+#include <cmath>
+#include <random>
+
+namespace cuopt::linear_programming::detail {
+
+template <typename i_t, typename f_t>
+__global__ void scale_csr_kernel(raft::device_span<const i_t> offsets,
+                                 raft::device_span<const i_t> indices,
+                                 raft::device_span<f_t> values,
+                                 const f_t* row_scaling,
+                                 const f_t* col_scaling,
+                                 f_t factor)
+{
+  const i_t row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row + 1 >= static_cast<i_t>(offsets.size())) { return; }
+
+  const f_t row_factor = row_scaling == nullptr ? factor : factor * row_scaling[row];
+  for (i_t p = offsets[row]; p < offsets[row + 1]; ++p) {
+    values[p] *= col_scaling == nullptr ? row_factor : row_factor * col_scaling[indices[p]];
+  }
+}
+
+template <typename i_t, typename f_t>
+quadratic_objective_t<i_t, f_t>::quadratic_objective_t(raft::handle_t const* handle_ptr,
+                                                       const problem_t<i_t, f_t>& op_problem,
+                                                       size_t batch_size)
+  : handle_ptr_(handle_ptr),
+    stream_view_(handle_ptr_->get_stream()),
+    n_variables_(op_problem.n_variables),
+    factored_(!op_problem.F_values.empty()),
+    offsets_(0, stream_view_),
+    indices_(0, stream_view_),
+    values_(0, stream_view_),
+    transpose_offsets_(0, stream_view_),
+    transpose_indices_(0, stream_view_),
+    transpose_values_(0, stream_view_),
+    factor_product_(0, stream_view_),
+    product_(0, stream_view_),
+    spmv_buffer_(0, stream_view_),
+    reduce_buffer_(0, stream_view_),
+    reusable_device_scalar_value_1_(f_t(1.0), stream_view_),
+    reusable_device_scalar_value_0_(f_t(0.0), stream_view_)
+{
+  if (op_problem.Q_values.empty() && op_problem.F_values.empty()) { return; }
+
+  product_.resize(batch_size * n_variables_, stream_view_);
+
+  if (!factored_) {
+    offsets_ = device_copy(op_problem.Q_offsets, stream_view_);
+    indices_ = device_copy(op_problem.Q_indices, stream_view_);
+    values_  = device_copy(op_problem.Q_values, stream_view_);
+    matrix_.create(
+      n_variables_, n_variables_, values_.size(), offsets_.data(), indices_.data(), values_.data());
+  } else {
+    // Q = 2 F^T F, sqrt(2) is folded in both F and F^T so that a product is F^T (F x)
+    n_factor_rows_ = static_cast<i_t>(op_problem.F_offsets.size()) - 1;
+    const f_t sqrt_two = std::sqrt(f_t(2.0));
+    std::vector<f_t> F_values(op_problem.F_values);
+    for (auto& value : F_values) {
+      value *= sqrt_two;
+    }
+
+    std::vector<i_t> F_T_offsets(n_variables_ + 1, 0);
+    std::vector<i_t> F_T_indices(F_values.size());
+    std::vector<f_t> F_T_values(F_values.size());
+    for (i_t col : op_problem.F_indices) {
+      ++F_T_offsets[col + 1];
+    }
+    for (i_t j = 0; j < n_variables_; ++j) {
+      F_T_offsets[j + 1] += F_T_offsets[j];
+    }
+    std::vector<i_t> next(F_T_offsets.begin(), F_T_offsets.end() - 1);
+    for (i_t i = 0; i < n_factor_rows_; ++i) {
+      for (i_t p = op_problem.F_offsets[i]; p < op_problem.F_offsets[i + 1]; ++p) {
+        const i_t pos    = next[op_problem.F_indices[p]]++;
+        F_T_indices[pos] = i;
+        F_T_values[pos]  = F_values[p];
+      }
+    }
+
+    offsets_           = device_copy(op_problem.F_offsets, stream_view_);
+    indices_           = device_copy(op_problem.F_indices, stream_view_);
+    values_            = device_copy(F_values, stream_view_);
+    transpose_offsets_ = device_copy(F_T_offsets, stream_view_);
+    transpose_indices_ = device_copy(F_T_indices, stream_view_);
+    transpose_values_  = device_copy(F_T_values, stream_view_);
+    matrix_.create(n_factor_rows_,
+                   n_variables_,
+                   values_.size(),
+                   offsets_.data(),
+                   indices_.data(),
+                   values_.data());
+    transpose_matrix_.create(n_variables_,
+                             n_factor_rows_,
+                             transpose_values_.size(),
+                             transpose_offsets_.data(),
+                             transpose_indices_.data(),
+                             transpose_values_.data());
+    factor_product_.resize(batch_size * n_factor_rows_, stream_view_);
+  }
+
+  // The single vector products run inside the PDHG graphs, their buffer can't be grown there
+  const i_t n_rows = factored_ ? n_factor_rows_ : n_variables_;
+  cusparse_dn_vec_descr_wrapper_t<f_t> x_descr;
+  cusparse_dn_vec_descr_wrapper_t<f_t> y_descr;
+  x_descr.create(n_variables_, product_.data());
+  y_descr.create(n_rows, factored_ ? factor_product_.data() : product_.data());
+  size_t buffer_size = 0;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmv_buffersize(handle_ptr_->get_cusparse_handle(),
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  reusable_device_scalar_value_1_.data(),
+                                                  matrix_,
+                                                  x_descr,
+                                                  reusable_device_scalar_value_0_.data(),
+                                                  y_descr,
+                                                  CUSPARSE_SPMV_CSR_ALG2,
+                                                  &buffer_size,
+                                                  stream_view_));
+  if (factored_) {
+    size_t transpose_buffer_size = 0;
+    RAFT_CUSPARSE_TRY(
+      raft::sparse::detail::cusparsespmv_buffersize(handle_ptr_->get_cusparse_handle(),
+                                                    CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                    reusable_device_scalar_value_1_.data(),
+                                                    transpose_matrix_,
+                                                    y_descr,
+                                                    reusable_device_scalar_value_0_.data(),
+                                                    x_descr,
+                                                    CUSPARSE_SPMV_CSR_ALG2,
+                                                    &transpose_buffer_size,
+                                                    stream_view_));
+    buffer_size = std::max(buffer_size, transpose_buffer_size);
+  }
+  spmv_buffer_.resize(buffer_size, stream_view_);
+}
+
+template <typename i_t, typename f_t>
+bool quadratic_objective_t<i_t, f_t>::empty() const
+{
+  return values_.size() == 0;
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::scale(const rmm::device_uvector<f_t>& variable_scaling,
+                                            f_t factor)
+{
+  if (empty()) { return; }
+  cuopt_assert(variable_scaling.size() == static_cast<size_t>(n_variables_),
+               "variable_scaling size must be equal to the number of variables");
+
+  constexpr int block_size = 256;
+  if (!factored_) {
+    scale_csr_kernel<i_t, f_t>
+      <<<raft::ceildiv(n_variables_, block_size), block_size, 0, stream_view_>>>(
+        make_span(offsets_),
+        make_span(indices_),
+        make_span(values_),
+        variable_scaling.data(),
+        variable_scaling.data(),
+        factor);
+  } else {
+    // f D Q D = 2 (sqrt(f) F D)^T (sqrt(f) F D)
+    const f_t sqrt_factor = std::sqrt(factor);
+    scale_csr_kernel<i_t, f_t>
+      <<<raft::ceildiv(n_factor_rows_, block_size), block_size, 0, stream_view_>>>(
+        make_span(offsets_),
+        make_span(indices_),
+        make_span(values_),
+        nullptr,
+        variable_scaling.data(),
+        sqrt_factor);
+    scale_csr_kernel<i_t, f_t>
+      <<<raft::ceildiv(n_variables_, block_size), block_size, 0, stream_view_>>>(
+        make_span(transpose_offsets_),
+        make_span(transpose_indices_),
+        make_span(transpose_values_),
+        variable_scaling.data(),
+        nullptr,
+        sqrt_factor);
+  }
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::spmv(const cusparse_sp_mat_descr_wrapper_t<i_t, f_t>& matrix,
+                                           int64_t n_rows,
+                                           int64_t n_cols,
+                                           const f_t* x,
+                                           f_t* y,
+                                           const f_t* alpha,
+                                           const f_t* beta,
+                                           size_t batch_size,
+                                           cusparseOrder_t order)
+{
+  if (batch_size == 1) {
+    cusparse_dn_vec_descr_wrapper_t<f_t> x_descr;
+    cusparse_dn_vec_descr_wrapper_t<f_t> y_descr;
+    x_descr.create(n_cols, const_cast<f_t*>(x));
+    y_descr.create(n_rows, y);
+    RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmv(handle_ptr_->get_cusparse_handle(),
+                                                         CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         alpha,
+                                                         matrix,
+                                                         x_descr,
+                                                         beta,
+                                                         y_descr,
+                                                         CUSPARSE_SPMV_CSR_ALG2,
+                                                         (f_t*)spmv_buffer_.data(),
+                                                         stream_view_));
+    return;
+  }
+
+  // Same algorithms as the batch products with A
+  const bool row_major = order == CUSPARSE_ORDER_ROW;
+  const auto algorithm =
+    (!row_major || deterministic_batch_pdlp) ? CUSPARSE_SPMM_CSR_ALG3 : CUSPARSE_SPMM_CSR_ALG2;
+  cusparse_dn_mat_descr_wrapper_t<f_t> x_descr;
+  cusparse_dn_mat_descr_wrapper_t<f_t> y_descr;
+  x_descr.create(n_cols, batch_size, row_major ? batch_size : n_cols, const_cast<f_t*>(x), order);
+  y_descr.create(n_rows, batch_size, row_major ? batch_size : n_rows, y, order);
+  // Batch PDHG runs without graphs, the buffer can be grown here
+  size_t buffer_size = 0;
+  RAFT_CUSPARSE_TRY(
+    raft::sparse::detail::cusparsespmm_bufferSize(handle_ptr_->get_cusparse_handle(),
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                  alpha,
+                                                  matrix,
+                                                  x_descr,
+                                                  beta,
+                                                  y_descr,
+                                                  algorithm,
+                                                  &buffer_size,
+                                                  stream_view_));
+  if (buffer_size > spmv_buffer_.size()) { spmv_buffer_.resize(buffer_size, stream_view_); }
+  RAFT_CUSPARSE_TRY(raft::sparse::detail::cusparsespmm(handle_ptr_->get_cusparse_handle(),
+                                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                       CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                                       alpha,
+                                                       matrix,
+                                                       x_descr,
+                                                       beta,
+                                                       y_descr,
+                                                       algorithm,
+                                                       (f_t*)spmv_buffer_.data(),
+                                                       stream_view_));
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::multiply(const f_t* x,
+                                               f_t* y,
+                                               const f_t* alpha,
+                                               const f_t* beta,
+                                               size_t batch_size,
+                                               cusparseOrder_t order)
+{
+  raft::common::nvtx::range fun_scope("quadratic_objective_multiply");
+  cuopt_assert(!empty(), "multiply called on an empty quadratic objective");
+  cuopt_assert(batch_size * n_variables_ <= product_.size(), "batch_size larger than allocated");
+
+  if (!factored_) {
+    spmv(matrix_, n_variables_, n_variables_, x, y, alpha, beta, batch_size, order);
+  } else {
+    spmv(matrix_,
+         n_factor_rows_,
+         n_variables_,
+         x,
+         factor_product_.data(),
+         reusable_device_scalar_value_1_.data(),
+         reusable_device_scalar_value_0_.data(),
+         batch_size,
+         order);
+    spmv(transpose_matrix_,
+         n_variables_,
+         n_factor_rows_,
+         factor_product_.data(),
+         y,
+         alpha,
+         beta,
+         batch_size,
+         order);
+  }
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::segmented_dot(
+  const f_t* u, const f_t* v, size_t batch_size, f_t* out, f_t factor)
+{
+  auto input = thrust::make_transform_iterator(thrust::make_zip_iterator(u, v),
+                                               tuple_multiplies<f_t>{});
+  size_t temp_storage_bytes = 0;
+  RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+    nullptr, temp_storage_bytes, input, out, batch_size, n_variables_, stream_view_));
+  if (temp_storage_bytes > reduce_buffer_.size()) {
+    reduce_buffer_.resize(temp_storage_bytes, stream_view_);
+  }
+  RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+    reduce_buffer_.data(), temp_storage_bytes, input, out, batch_size, n_variables_, stream_view_));
+  if (factor != f_t(1.0)) {
+    cub::DeviceTransform::Transform(
+      out,
+      out,
+      batch_size,
+      [factor] HD(f_t value) { return factor * value; },
+      stream_view_.value());
+  }
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::compute_quadratic_term(
+  const f_t* x, size_t batch_size, rmm::device_uvector<f_t>& quadratic_term)
+{
+  cuopt_assert(quadratic_term.size() >= batch_size, "quadratic_term too small");
+  multiply(x,
+           product_.data(),
+           reusable_device_scalar_value_1_.data(),
+           reusable_device_scalar_value_0_.data(),
+           batch_size,
+           CUSPARSE_ORDER_COL);
+  segmented_dot(x, product_.data(), batch_size, quadratic_term.data(), f_t(0.5));
+}
+
+template <typename i_t, typename f_t>
+void quadratic_objective_t<i_t, f_t>::compute_cross_term(const f_t* u,
+                                                         const f_t* x,
+                                                         size_t batch_size,
+                                                         rmm::device_uvector<f_t>& cross_term)
+{
+  cuopt_assert(cross_term.size() >= batch_size, "cross_term too small");
+  multiply(x,
+           product_.data(),
+           reusable_device_scalar_value_1_.data(),
+           reusable_device_scalar_value_0_.data(),
+           batch_size,
+           CUSPARSE_ORDER_COL);
+  segmented_dot(u, product_.data(), batch_size, cross_term.data(), f_t(1.0));
+}
+
+template <typename i_t, typename f_t>
+f_t quadratic_objective_t<i_t, f_t>::compute_max_eigenvalue()
+{
+  raft::common::nvtx::range fun_scope("quadratic_objective_max_eigenvalue");
+  if (empty()) { return f_t(0.0); }
+
+  constexpr i_t max_iterations = 5000;
+  constexpr f_t tolerance      = 1e-4;
+
+  std::vector<f_t> z(n_variables_);
+  std::mt19937 gen(1);
+  std::normal_distribution<f_t> dist(f_t(0.0), f_t(1.0));
+  for (auto& value : z) {
+    value = dist(gen);
+  }
+  rmm::device_uvector<f_t> d_q = device_copy(z, stream_view_);
+  rmm::device_uvector<f_t> d_z(n_variables_, stream_view_);
+  rmm::device_scalar<f_t> norm(stream_view_);
+  rmm::device_scalar<f_t> eigenvalue(f_t(0.0), stream_view_);
+
+  for (i_t i = 0; i < max_iterations; ++i) {
+    // q = q / ||q||
+    my_l2_norm<i_t, f_t>(d_q, norm, handle_ptr_);
+    if (norm.value(stream_view_) == f_t(0.0)) { return f_t(0.0); }
+    cub::DeviceTransform::Transform(
+      d_q.data(),
+      d_q.data(),
+      d_q.size(),
+      [norm = norm.data()] __device__(f_t value) { return value / *norm; },
+      stream_view_.value());
+
+    // z = Q q, eigenvalue = q^T z
+    multiply(d_q.data(),
+             d_z.data(),
+             reusable_device_scalar_value_1_.data(),
+             reusable_device_scalar_value_0_.data(),
+             1);
+    RAFT_CUBLAS_TRY(raft::linalg::detail::cublasdot(handle_ptr_->get_cublas_handle(),
+                                                    n_variables_,
+                                                    d_q.data(),
+                                                    primal_stride,
+                                                    d_z.data(),
+                                                    primal_stride,
+                                                    eigenvalue.data(),
+                                                    stream_view_.value()));
+
+    // Residual z - eigenvalue q in q, the next iterate is z
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(d_q.data(), d_z.data()),
+      d_q.data(),
+      d_q.size(),
+      [eigenvalue = eigenvalue.data()] __device__(f_t q, f_t z) { return z - *eigenvalue * q; },
+      stream_view_.value());
+    my_l2_norm<i_t, f_t>(d_q, norm, handle_ptr_);
+    const bool converged = norm.value(stream_view_) < tolerance;
+    std::swap(d_q, d_z);
+    if (converged) { break; }
+  }
+
+  return std::max(eigenvalue.value(stream_view_), f_t(0.0));
+}
+
+template <typename i_t, typename f_t>
+const rmm::device_uvector<f_t>& quadratic_objective_t<i_t, f_t>::get_product() const
+{
+  return product_;
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class quadratic_objective_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class quadratic_objective_t<int, double>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class quadratic_objective_t<int64_t, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,149 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <mip_heuristics/problem/problem.cuh>
+#include <pdlp/cusparse_view.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+namespace cuopt::linear_programming::detail {
+/**
+ * @brief Device operator of the quadratic objective term of a convex QP solved with PDLP
+ *
+ * The objective is 1/2 x^T Q x + c^T x, Q being either held explicitly as a sparse symmetric
+ * matrix or as a factor F such that Q = 2 F^T F. In the latter case Q is never formed and a product
+ * costs two sparse products with F and F^T, which stays linear in nnz(F) when Q would be dense.
+ *
+ * Products work on one vector or, in batch mode, on a n x batch_size matrix with one column per
+ * climber in the given layout.
+ *
+ * @tparam i_t  Data type of indexes
+ * @tparam f_t  Data type of the variables and their weights in the equations
+ */
+template <typename i_t, typename f_t>
+class quadratic_objective_t {
+ public:
+  static_assert(std::is_floating_point<f_t>::value,
+                "'quadratic_objective_t' accepts only floating point types");
+
+  /**
+   * @brief Copies the quadratic objective of the problem to the device
+   *
+   * Leaves the operator empty if the problem has no quadratic objective.
+   *
+   * @param handle_ptr Pointer to library handle (RAFT) containing hardware resources
+   * information. A default handle is valid.
+   * @param op_problem Problem holding the quadratic objective on the host
+   * @param batch_size Largest number of columns of the products
+   */
+  quadratic_objective_t(raft::handle_t const* handle_ptr,
+                        const problem_t<i_t, f_t>& op_problem,
+                        size_t batch_size);
+
+  bool empty() const;
+
+  /**
+   * @brief Rescales the operator to the variables x = D x' of the scaled problem, Q' = f D Q D
+   *
+   * @param variable_scaling Diagonal of D
+   * @param factor Scalar f, the ratio of the objective and bound rescaling of PDLP
+   */
+  void scale(const rmm::device_uvector<f_t>& variable_scaling, f_t factor);
+
+  /**
+   * @brief y = alpha Q x + beta y
+   *
+   * alpha and beta are device pointers. y must not alias x.
+   *
+   * @param order Layout of x and y when batch_size > 1
+   */
+  void multiply(const f_t* x,
+                f_t* y,
+                const f_t* alpha,
+                const f_t* beta,
+                size_t batch_size,
+                cusparseOrder_t order = CUSPARSE_ORDER_COL);
+
+  /**
+   * @brief Computes Q x in the product buffer and 1/2 x^T Q x of each climber in quadratic_term
+   *
+   * x holds one contiguous column per climber.
+   */
+  void compute_quadratic_term(const f_t* x,
+                              size_t batch_size,
+                              rmm::device_uvector<f_t>& quadratic_term);
+
+  /**
+   * @brief Computes u^T Q x of each climber in cross_term, u and x hold one contiguous column per
+   * climber
+   */
+  void compute_cross_term(const f_t* u,
+                          const f_t* x,
+                          size_t batch_size,
+                          rmm::device_uvector<f_t>& cross_term);
+
+  /**
+   * @brief Largest eigenvalue of Q estimated with a power iteration, the Lipschitz constant of the
+   * gradient of the quadratic term
+   */
+  f_t compute_max_eigenvalue();
+
+  /** Result of the last compute_quadratic_term or compute_cross_term, one column per climber */
+  const rmm::device_uvector<f_t>& get_product() const;
+
+ private:
+  void spmv(const cusparse_sp_mat_descr_wrapper_t<i_t, f_t>& matrix,
+            int64_t n_rows,
+            int64_t n_cols,
+            const f_t* x,
+            f_t* y,
+            const f_t* alpha,
+            const f_t* beta,
+            size_t batch_size,
+            cusparseOrder_t order);
+  void segmented_dot(const f_t* u, const f_t* v, size_t batch_size, f_t* out, f_t factor);
+
+  raft::handle_t const* handle_ptr_{nullptr};
+  rmm::cuda_stream_view stream_view_;
+
+  i_t n_variables_{0};
+  // Rows of F, 0 if Q is explicit
+  i_t n_factor_rows_{0};
+  bool factored_{false};
+
+  // Q, or F with sqrt(2) folded in
+  rmm::device_uvector<i_t> offsets_;
+  rmm::device_uvector<i_t> indices_;
+  rmm::device_uvector<f_t> values_;
+  // F^T, only for a factored objective
+  rmm::device_uvector<i_t> transpose_offsets_;
+  rmm::device_uvector<i_t> transpose_indices_;
+  rmm::device_uvector<f_t> transpose_values_;
+
+  cusparse_sp_mat_descr_wrapper_t<i_t, f_t> matrix_;
+  cusparse_sp_mat_descr_wrapper_t<i_t, f_t> transpose_matrix_;
+
+  // F x for a factored objective
+  rmm::device_uvector<f_t> factor_product_;
+  rmm::device_uvector<f_t> product_;
+
+  // Grown on demand outside of the PDHG graphs, sized for a single vector at construction
+  rmm::device_buffer spmv_buffer_;
+  rmm::device_buffer reduce_buffer_;
+
+  const rmm::device_scalar<f_t> reusable_device_scalar_value_1_;
+  const rmm::device_scalar<f_t> reusable_device_scalar_value_0_;
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -151,4 +151,8 @@ template struct localized_duality_gap_container_t<int, float>;
 template struct localized_duality_gap_container_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template struct localized_duality_gap_container_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
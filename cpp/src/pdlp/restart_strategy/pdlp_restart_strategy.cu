@@ -44,6 +44,7 @@
 
 #include <cooperative_groups.h>
 
+#include <array>
 #include <cmath>
 
 namespace cg = cooperative_groups;
@@ -201,6 +202,7 @@ pdlp_restart_strategy_t<i_t, f_t>::pdlp_restart_strategy_t(
     primal_weight_error_sum_(climber_strategies.size()),
     primal_weight_last_error_(climber_strategies.size()),
     best_primal_dual_residual_gap_(climber_strategies.size()),
+    cupdlpx_restart_scalars_(cupdlpx_restart_scalar_count),
     climber_strategies_(climber_strategies),
     hyper_params_(hyper_params)
 {
@@ -754,86 +756,6 @@ void pdlp_restart_strategy_t<i_t, f_t>::should_cupdlpx_restart(i_t total_number_
     fixed_point_error_.begin(), fixed_point_error_.end(), last_trial_fixed_point_error_.begin());
 }
 
-template <typename f_t>
-HDI void cupdlpx_new_primal_weight_computation(const f_t primal_distance,
-                                               const f_t dual_distance,
-                                               const f_t relative_l2_dual_residual_value,
-                                               const f_t relative_l2_primal_residual_value,
-                                               const f_t step_size,
-                                               f_t* primal_weight_error_sum,
-                                               f_t* primal_weight_last_error,
-                                               f_t* primal_weight,
-                                               f_t* best_primal_weight,
-                                               f_t* new_primal_step_size,
-                                               f_t* new_dual_step_size,
-                                               f_t* best_primal_dual_residual_gap,
-                                               const f_t restart_k_p,
-                                               const f_t restart_k_i,
-                                               const f_t restart_k_d,
-                                               const f_t restart_i_smooth)
-{
-  const f_t l2_primal_distance = cuda::std::sqrt(primal_distance);
-  const f_t l2_dual_distance   = cuda::std::sqrt(dual_distance);
-
-#ifdef CUPDLP_DEBUG_MODE
-  printf("l2 primal distance: %lf l2 dual distance %lf\n", l2_primal_distance, l2_dual_distance);
-  printf("relative L2 primal residual %lf relative L2 dual residual %lf\n",
-         relative_l2_primal_residual_value,
-         relative_l2_dual_residual_value);
-#endif
-
-  const f_t ratio_infeas = (relative_l2_primal_residual_value == f_t(0.0))
-                             ? std::numeric_limits<f_t>::infinity()
-                             : relative_l2_dual_residual_value / relative_l2_primal_residual_value;
-
-  if (l2_primal_distance > f_t(1e-16) && l2_dual_distance > f_t(1e-16) &&
-      l2_primal_distance < f_t(1e12) && l2_dual_distance < f_t(1e12) && ratio_infeas > f_t(1e-8) &&
-      ratio_infeas < f_t(1e8)) {
-#ifdef CUPDLP_DEBUG_MODE
-    printf("Compute new primal weight\n");
-#endif
-    const f_t current_primal_weight = *primal_weight;
-    const f_t error = cuda::std::log(l2_dual_distance) - cuda::std::log(l2_primal_distance) -
-                      cuda::std::log(current_primal_weight);
-    const f_t new_primal_weight_error_sum_value =
-      *primal_weight_error_sum * restart_i_smooth + error;
-    *primal_weight_error_sum = new_primal_weight_error_sum_value;
-    const f_t delta_error    = error - *primal_weight_last_error;
-    const f_t computed_new_primal_weight =
-      cuda::std::exp(restart_k_p * error + restart_k_i * new_primal_weight_error_sum_value +
-                     restart_k_d * delta_error) *
-      current_primal_weight;
-    *primal_weight            = computed_new_primal_weight;
-    *primal_weight_last_error = error;
-    *new_primal_step_size     = step_size / computed_new_primal_weight;
-    *new_dual_step_size       = step_size * computed_new_primal_weight;
-  } else {
-#ifdef CUPDLP_DEBUG_MODE
-    printf("Setting new primal weight to best primal weight\n");
-#endif
-    const f_t best_primal_weight_value = *best_primal_weight;
-    *primal_weight                     = best_primal_weight_value;
-    *primal_weight_error_sum           = f_t(0.0);
-    *primal_weight_last_error          = f_t(0.0);
-    *new_primal_step_size              = step_size / best_primal_weight_value;
-    *new_dual_step_size                = step_size * best_primal_weight_value;
-  }
-
-  const f_t primal_dual_residual_gap = cuda::std::abs(cuda::std::log10(ratio_infeas));
-  if (primal_dual_residual_gap < *best_primal_dual_residual_gap) {
-    *best_primal_dual_residual_gap = primal_dual_residual_gap;
-    *best_primal_weight            = *primal_weight;
-  }
-
-#ifdef CUPDLP_DEBUG_MODE
-  printf("New primal weight %lf\n", *primal_weight);
-  printf("New best_primal_weight %lf\n", *best_primal_weight);
-  printf("New primal_weight_error_sum_ %lf\n", *primal_weight_error_sum);
-  printf("New primal_weight_last_error_ %lf\n", *primal_weight_last_error);
-  printf("New best_primal_dual_residual_gap_ %lf\n", *best_primal_dual_residual_gap);
-#endif
-}
-
 template <typename i_t, typename f_t>
 __global__ void kernel_compute_next_cupdlpx_primal_weight(
   typename pdlp_restart_strategy_t<i_t, f_t>::cupdlpx_restart_view_t view, i_t batch_size)
@@ -921,18 +843,41 @@ void pdlp_restart_strategy_t<i_t, f_t>::cupdlpx_restart(
     RAFT_CUDA_TRY(cudaDeviceSynchronize());
 #endif
   } else {
+    // Stage every scalar the host computation needs in pinned memory and sync once, instead of
+    // paying a blocking copy per element read
+    f_t* scalars = thrust::raw_pointer_cast(cupdlpx_restart_scalars_.data());
+    const std::array<const f_t*, cupdlpx_restart_scalar_count> sources{
+      primal_weight.data(),
+      primal_step_size.data(),
+      dual_step_size.data(),
+      best_primal_weight.data(),
+      last_restart_duality_gap_.primal_distance_traveled_.data(),
+      last_restart_duality_gap_.dual_distance_traveled_.data(),
+      step_size.data(),
+      current_convergence_information.get_l2_primal_residual().data(),
+      current_convergence_information.get_l2_dual_residual().data(),
+      current_convergence_information.get_l2_norm_primal_right_hand_side().data(),
+      current_convergence_information.get_l2_norm_primal_linear_objective().data()};
+    for (size_t i = 0; i < sources.size(); ++i) {
+      raft::copy(scalars + i, sources[i], 1, stream_view_);
+    }
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
+
     // Extract those 4 out because the live on the device memory and we write those in the host
     // version of the function
-    f_t primal_weight_value      = primal_weight.element(0, stream_view_);
-    f_t primal_step_size_value   = primal_step_size.element(0, stream_view_);
-    f_t dual_step_size_value     = dual_step_size.element(0, stream_view_);
-    f_t best_primal_weight_value = best_primal_weight.element(0, stream_view_);
+    f_t primal_weight_value      = scalars[0];
+    f_t primal_step_size_value   = scalars[1];
+    f_t dual_step_size_value     = scalars[2];
+    f_t best_primal_weight_value = scalars[3];
+    // Same expressions as get_relative_l2_*_residual_value
+    const f_t relative_l2_primal_residual = scalars[7] / (f_t(1.0) + scalars[9]);
+    const f_t relative_l2_dual_residual   = scalars[8] / (f_t(1.0) + scalars[10]);
     cupdlpx_new_primal_weight_computation<f_t>(
-      last_restart_duality_gap_.primal_distance_traveled_.element(0, stream_view_),
-      last_restart_duality_gap_.dual_distance_traveled_.element(0, stream_view_),
-      current_convergence_information.get_relative_l2_dual_residual_value(0),
-      current_convergence_information.get_relative_l2_primal_residual_value(0),
-      step_size.element(0, stream_view_),
+      scalars[4],
+      scalars[5],
+      relative_l2_dual_residual,
+      relative_l2_primal_residual,
+      scalars[6],
       &view.primal_weight_error_sum[0],
       &view.primal_weight_last_error[0],
       &primal_weight_value,
@@ -2531,4 +2476,8 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_restart_strategy_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
@@ -19,6 +19,8 @@
 
 #include <mip_heuristics/problem/problem.cuh>
 
+#include <utilities/macros.cuh>
+
 #include <raft/core/handle.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -28,6 +30,10 @@
 
 #include <raft/core/device_span.hpp>
 
+#include <cuda/std/cmath>
+
+#include <limits>
+
 namespace cuopt::linear_programming::detail {
 template <typename i_t, typename f_t>
 class pdlp_restart_strategy_t {
@@ -384,6 +390,9 @@ class pdlp_restart_strategy_t {
   thrust::universal_host_pinned_vector<f_t> primal_weight_error_sum_;
   thrust::universal_host_pinned_vector<f_t> primal_weight_last_error_;
   thrust::universal_host_pinned_vector<f_t> best_primal_dual_residual_gap_;
+  // Staging for the scalars read by the non-batch cuPDLP+ restart, allows a single sync
+  static constexpr size_t cupdlpx_restart_scalar_count = 11;
+  thrust::universal_host_pinned_vector<f_t> cupdlpx_restart_scalars_;
 
   const std::vector<pdlp_climber_strategy_t>& climber_strategies_;
   const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params_;
@@ -411,4 +420,85 @@ bool is_cupdlpx_restart(const pdlp_hyper_params::pdlp_hyper_params_t& hyper_para
          static_cast<int>(pdlp_restart_strategy_t<i_t, f_t>::restart_strategy_t::CUPDLPX_RESTART);
 }
 
+// cuPDLP+ PID update of the primal weight from the distances moved since the last restart
+template <typename f_t>
+HDI void cupdlpx_new_primal_weight_computation(const f_t primal_distance,
+                                               const f_t dual_distance,
+                                               const f_t relative_l2_dual_residual_value,
+                                               const f_t relative_l2_primal_residual_value,
+                                               const f_t step_size,
+                                               f_t* primal_weight_error_sum,
+                                               f_t* primal_weight_last_error,
+                                               f_t* primal_weight,
+                                               f_t* best_primal_weight,
+                                               f_t* new_primal_step_size,
+                                               f_t* new_dual_step_size,
+                                               f_t* best_primal_dual_residual_gap,
+                                               const f_t restart_k_p,
+                                               const f_t restart_k_i,
+                                               const f_t restart_k_d,
+                                               const f_t restart_i_smooth)
+{
+  const f_t l2_primal_distance = cuda::std::sqrt(primal_distance);
+  const f_t l2_dual_distance   = cuda::std::sqrt(dual_distance);
+
+#ifdef CUPDLP_DEBUG_MODE
+  printf("l2 primal distance: %lf l2 dual distance %lf\n", l2_primal_distance, l2_dual_distance);
+  printf("relative L2 primal residual %lf relative L2 dual residual %lf\n",
+         relative_l2_primal_residual_value,
+         relative_l2_dual_residual_value);
+#endif
+
+  const f_t ratio_infeas = (relative_l2_primal_residual_value == f_t(0.0))
+                             ? std::numeric_limits<f_t>::infinity()
+                             : relative_l2_dual_residual_value / relative_l2_primal_residual_value;
+
+  if (l2_primal_distance > f_t(1e-16) && l2_dual_distance > f_t(1e-16) &&
+      l2_primal_distance < f_t(1e12) && l2_dual_distance < f_t(1e12) && ratio_infeas > f_t(1e-8) &&
+      ratio_infeas < f_t(1e8)) {
+#ifdef CUPDLP_DEBUG_MODE
+    printf("Compute new primal weight\n");
+#endif
+    const f_t current_primal_weight = *primal_weight;
+    const f_t error = cuda::std::log(l2_dual_distance) - cuda::std::log(l2_primal_distance) -
+                      cuda::std::log(current_primal_weight);
+    const f_t new_primal_weight_error_sum_value =
+      *primal_weight_error_sum * restart_i_smooth + error;
+    *primal_weight_error_sum = new_primal_weight_error_sum_value;
+    const f_t delta_error    = error - *primal_weight_last_error;
+    const f_t computed_new_primal_weight =
+      cuda::std::exp(restart_k_p * error + restart_k_i * new_primal_weight_error_sum_value +
+                     restart_k_d * delta_error) *
+      current_primal_weight;
+    *primal_weight            = computed_new_primal_weight;
+    *primal_weight_last_error = error;
+    *new_primal_step_size     = step_size / computed_new_primal_weight;
+    *new_dual_step_size       = step_size * computed_new_primal_weight;
+  } else {
+#ifdef CUPDLP_DEBUG_MODE
+    printf("Setting new primal weight to best primal weight\n");
+#endif
+    const f_t best_primal_weight_value = *best_primal_weight;
+    *primal_weight                     = best_primal_weight_value;
+    *primal_weight_error_sum           = f_t(0.0);
+    *primal_weight_last_error          = f_t(0.0);
+    *new_primal_step_size              = step_size / best_primal_weight_value;
+    *new_dual_step_size                = step_size * best_primal_weight_value;
+  }
+
+  const f_t primal_dual_residual_gap = cuda::std::abs(cuda::std::log10(ratio_infeas));
+  if (primal_dual_residual_gap < *best_primal_dual_residual_gap) {
+    *best_primal_dual_residual_gap = primal_dual_residual_gap;
+    *best_primal_weight            = *primal_weight;
+  }
+
+#ifdef CUPDLP_DEBUG_MODE
+  printf("New primal weight %lf\n", *primal_weight);
+  printf("New best_primal_weight %lf\n", *best_primal_weight);
+  printf("New primal_weight_error_sum_ %lf\n", *primal_weight_error_sum);
+  printf("New primal_weight_last_error_ %lf\n", *primal_weight_last_error);
+  printf("New best_primal_dual_residual_gap_ %lf\n", *best_primal_dual_residual_gap);
+#endif
+}
+
 }  // namespace cuopt::linear_programming::detail
@@ -13,7 +13,8 @@
 #include <pdlp/utils.cuh>
 
 #include <raft/linalg/binary_op.cuh>
-#include <raft/linalg/divide.cuh>
+
+#include <algorithm>
 
 namespace cuopt::linear_programming::detail {
 template <typename i_t, typename f_t>
@@ -101,6 +102,30 @@ void weighted_average_solution_t<i_t, f_t>::add_current_solution_to_weighted_ave
   iterations_since_last_restart_ += 1;
 }
 
+// Divides the primal and the dual sums by their weight sums, read on the device, in a single pass
+template <typename i_t, typename f_t>
+__global__ void compute_averages_kernel(const f_t* sum_primal_solutions,
+                                        const f_t* sum_dual_solutions,
+                                        const f_t* sum_primal_solution_weights,
+                                        const f_t* sum_dual_solution_weights,
+                                        f_t* avg_primal,
+                                        f_t* avg_dual,
+                                        i_t primal_size,
+                                        i_t dual_size)
+{
+  const f_t primal_weight = *sum_primal_solution_weights;
+  const f_t dual_weight   = *sum_dual_solution_weights;
+  const int64_t size      = int64_t(primal_size) + dual_size;
+  for (int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; i < size;
+       i += int64_t(blockDim.x) * gridDim.x) {
+    if (i < primal_size) {
+      avg_primal[i] = sum_primal_solutions[i] / primal_weight;
+    } else {
+      avg_dual[i - primal_size] = sum_dual_solutions[i - primal_size] / dual_weight;
+    }
+  }
+}
+
 template <typename i_t, typename f_t>
 void weighted_average_solution_t<i_t, f_t>::compute_averages(rmm::device_uvector<f_t>& avg_primal,
                                                              rmm::device_uvector<f_t>& avg_dual)
@@ -114,23 +139,19 @@ void weighted_average_solution_t<i_t, f_t>::compute_averages(rmm::device_uvector
     return;
   }
 
-  // return weight sums to host to fit API call
-  f_t sum_primal_solution_weights_h = sum_primal_solution_weights_.value(stream_view_);
-  f_t sum_dual_solution_weights_h   = sum_dual_solution_weights_.value(stream_view_);
-
-  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
-
-  // compute sum_primal_solutions/primal_size
-  raft::linalg::divideScalar(avg_primal.data(),
-                             sum_primal_solutions_.data(),
-                             sum_primal_solution_weights_h,
-                             primal_size_h_,
-                             stream_view_);
-  raft::linalg::divideScalar(avg_dual.data(),
-                             sum_dual_solutions_.data(),
-                             sum_dual_solution_weights_h,
-                             dual_size_h_,
-                             stream_view_);
+  // The weight sums stay on the device, so the averages need no synchronization with the host
+  const int64_t size = int64_t(primal_size_h_) + dual_size_h_;
+  const int n_blocks = std::min<int64_t>(cuda::ceil_div(size, int64_t(block_size)), 65535);
+  compute_averages_kernel<i_t, f_t><<<n_blocks, block_size, 0, stream_view_>>>(
+    sum_primal_solutions_.data(),
+    sum_dual_solutions_.data(),
+    sum_primal_solution_weights_.data(),
+    sum_dual_solution_weights_.data(),
+    avg_primal.data(),
+    avg_dual.data(),
+    primal_size_h_,
+    dual_size_h_);
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
 }
 
 template <typename i_t, typename f_t>
@@ -157,4 +178,8 @@ template __global__ void add_weight_sums<double>(const double* primal_weight,
 template class weighted_average_solution_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class weighted_average_solution_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
@@ -174,4 +174,8 @@ template class saddle_point_state_t<int, float>;
 template class saddle_point_state_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class saddle_point_state_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
@@ -7,17 +7,23 @@
 
 #include <cuopt/error.hpp>
 #include <pdlp/cusparse_view.hpp>
+#include <pdlp/distributed/row_partitioned_pdlp.cuh>
 #include <pdlp/optimal_batch_size_handler/optimal_batch_size_handler.hpp>
 #include <pdlp/pdlp.cuh>
 #include <pdlp/pdlp_constants.hpp>
 #include <pdlp/restart_strategy/pdlp_restart_strategy.cuh>
 #include <pdlp/step_size_strategy/adaptive_step_size_strategy.hpp>
 #include <pdlp/translate.hpp>
+#include <pdlp/utilities/gpu_presolve.cuh>
+#include <pdlp/utilities/method_selection.cuh>
 #include <pdlp/utilities/ping_pong_graph.cuh>
 #include <pdlp/utilities/problem_checking.cuh>
 #include <pdlp/utils.cuh>
+#include <utilities/device_memory_budget.hpp>
+#include <utilities/instrumentation.hpp>
 #include <utilities/logger.hpp>
 
+#include <math_optimization/warm_start_cache.hpp>
 #include <mip_heuristics/mip_constants.hpp>
 #include <mip_heuristics/presolve/third_party_presolve.hpp>
 #include <mip_heuristics/presolve/trivial_presolve.cuh>
@@ -30,6 +36,7 @@
 
 #include <mps_parser/mps_data_model.hpp>
 #include <utilities/copy_helpers.hpp>
+#include <utilities/cuda_helpers.cuh>
 #include <utilities/version_info.hpp>
 
 #include <barrier/sparse_cholesky.cuh>
@@ -45,7 +52,10 @@
 #include <raft/core/handle.hpp>
 #include <raft/core/nvtx.hpp>
 
+#include <array>
+#include <optional>
 #include <thread>  // For std::thread
+#include <vector>
 
 #define CUOPT_LOG_CONDITIONAL_INFO(condition, ...) \
   if ((condition)) { CUOPT_LOG_INFO(__VA_ARGS__); }
@@ -203,7 +213,13 @@ static void set_Stable3(pdlp_hyper_params::pdlp_hyper_params_t& hyper_params)
   hyper_params.bound_objective_rescaling             = true;
   hyper_params.use_reflected_primal_dual             = true;
   hyper_params.use_fixed_point_error                 = true;
-  hyper_params.use_conditional_major                 = true;
+  hyper_params.reflection_coefficient                = 1.0;
+  // PID controller on the primal weight, applied at each fixed point restart
+  hyper_params.restart_k_p           = 0.99;
+  hyper_params.restart_k_i           = 0.01;
+  hyper_params.restart_k_d           = 0.0;
+  hyper_params.restart_i_smooth      = 0.3;
+  hyper_params.use_conditional_major = true;
 }
 
 // Legacy/Original/Initial PDLP settings
@@ -308,6 +324,28 @@ void set_pdlp_solver_mode(pdlp_solver_settings_t<i_t, f_t>& settings)
 
 std::atomic<int> global_concurrent_halt{0};
 
+// Devices first_device, first_device + 1, ... wrapping around the visible devices
+std::vector<int> get_device_ids(int first_device, int count)
+{
+  const int device_count = raft::device_setter::get_device_count();
+  std::vector<int> device_ids(count);
+  for (int i = 0; i < count; ++i) {
+    device_ids[i] = (first_device + i) % device_count;
+  }
+  return device_ids;
+}
+
+// Fails when fewer than num_gpus devices are visible
+void check_num_gpus(int num_gpus)
+{
+  int device_count = raft::device_setter::get_device_count();
+  cuopt_expects(device_count >= num_gpus,
+                error_type_t::RuntimeError,
+                "Multi-GPU mode requires at least %d GPUs, found %d",
+                num_gpus,
+                device_count);
+}
+
 template <typename f_t>
 void adjust_dual_solution_and_reduced_cost(rmm::device_uvector<f_t>& dual_solution,
                                            rmm::device_uvector<f_t>& reduced_cost,
@@ -417,13 +455,15 @@ template <typename i_t, typename f_t>
 std::tuple<dual_simplex::lp_solution_t<i_t, f_t>, dual_simplex::lp_status_t, f_t, f_t, f_t>
 run_barrier(dual_simplex::user_problem_t<i_t, f_t>& user_problem,
             pdlp_solver_settings_t<i_t, f_t> const& settings,
-            const timer_t& timer)
+            const timer_t& timer,
+            const std::vector<int>& device_ids = {})
 {
   f_t norm_user_objective = dual_simplex::vector_norm2<i_t, f_t>(user_problem.objective);
   f_t norm_rhs            = dual_simplex::vector_norm2<i_t, f_t>(user_problem.rhs);
 
   dual_simplex::simplex_solver_settings_t<i_t, f_t> barrier_settings;
   barrier_settings.num_gpus                        = settings.num_gpus;
+  barrier_settings.barrier_device_ids              = device_ids;
   barrier_settings.time_limit                      = settings.time_limit;
   barrier_settings.iteration_limit                 = settings.iteration_limit;
   barrier_settings.concurrent_halt                 = settings.concurrent_halt;
@@ -436,6 +476,10 @@ run_barrier(dual_simplex::user_problem_t<i_t, f_t>& user_problem,
   barrier_settings.crossover                       = settings.crossover;
   barrier_settings.eliminate_dense_columns         = settings.eliminate_dense_columns;
   barrier_settings.cudss_deterministic             = settings.cudss_deterministic;
+  barrier_settings.cudss_hybrid_memory             = settings.barrier_hybrid_memory;
+  barrier_settings.barrier_pcg                     = settings.barrier_pcg;
+  barrier_settings.barrier_pcg_tolerance           = settings.barrier_pcg_tolerance;
+  barrier_settings.barrier_mixed_precision         = settings.barrier_mixed_precision;
   barrier_settings.barrier_relaxed_feasibility_tol = settings.tolerances.relative_primal_tolerance;
   barrier_settings.barrier_relaxed_optimality_tol  = settings.tolerances.relative_dual_tolerance;
   barrier_settings.barrier_relaxed_complementarity_tol = settings.tolerances.relative_gap_tolerance;
@@ -467,10 +511,19 @@ optimization_problem_solution_t<i_t, f_t> run_barrier(
   pdlp_solver_settings_t<i_t, f_t> const& settings,
   const timer_t& timer)
 {
+  // Barrier alone factorizes with cuDSS on the current device and the next num_gpus - 1 devices
+  std::vector<int> device_ids;
+  if (settings.num_gpus > 1) {
+    check_num_gpus(settings.num_gpus);
+    device_ids = get_device_ids(raft::device_setter::get_current_device(), settings.num_gpus);
+    CUOPT_LOG_CONDITIONAL_INFO(
+      !settings.inside_mip, "Running Barrier on %d GPUs", settings.num_gpus);
+  }
+
   // Convert data structures to dual simplex format and back
   dual_simplex::user_problem_t<i_t, f_t> dual_simplex_problem =
     cuopt_problem_to_simplex_problem<i_t, f_t>(problem.handle_ptr, problem);
-  auto sol_dual_simplex = run_barrier(dual_simplex_problem, settings, timer);
+  auto sol_dual_simplex = run_barrier(dual_simplex_problem, settings, timer, device_ids);
   return convert_dual_simplex_sol(problem,
                                   std::get<0>(sol_dual_simplex),
                                   std::get<1>(sol_dual_simplex),
@@ -487,12 +540,13 @@ void run_barrier_thread(
   std::unique_ptr<
     std::tuple<dual_simplex::lp_solution_t<i_t, f_t>, dual_simplex::lp_status_t, f_t, f_t, f_t>>&
     sol_ptr,
-  const timer_t& timer)
+  const timer_t& timer,
+  const std::vector<int>& device_ids)
 {
   // We will return the solution from the thread as a unique_ptr
   sol_ptr = std::make_unique<
     std::tuple<dual_simplex::lp_solution_t<i_t, f_t>, dual_simplex::lp_status_t, f_t, f_t, f_t>>(
-    run_barrier(problem, settings, timer));
+    run_barrier(problem, settings, timer, device_ids));
 
   // Wait for barrier thread to finish
   problem.handle_ptr->sync_stream();
@@ -511,6 +565,9 @@ run_dual_simplex(dual_simplex::user_problem_t<i_t, f_t>& user_problem,
   dual_simplex_settings.time_limit      = settings.time_limit;
   dual_simplex_settings.iteration_limit = settings.iteration_limit;
   dual_simplex_settings.concurrent_halt = settings.concurrent_halt;
+  // The LP solve owns the CPU, unlike the many concurrent node solves inside branch and bound
+  dual_simplex_settings.lu_num_threads      = dual_simplex_settings.num_threads;
+  dual_simplex_settings.pricing_num_threads = dual_simplex_settings.num_threads;
   if (dual_simplex_settings.concurrent_halt != nullptr) {
     // Don't show the dual simplex log in concurrent mode. Show the PDLP log instead
     dual_simplex_settings.log.log = false;
@@ -552,6 +609,63 @@ optimization_problem_solution_t<i_t, f_t> run_dual_simplex(
                                   0);
 }
 
+// Rough estimate of what a single (non-batch) PDLP solve allocates on top of the input problem
+template <typename i_t, typename f_t>
+static size_t pdlp_memory_estimator(const detail::problem_t<i_t, f_t>& problem,
+                                    pdlp_solver_settings_t<i_t, f_t> const& settings)
+{
+  const size_t nnz         = problem.nnz;
+  const size_t n_variables = problem.n_variables;
+  const size_t n_constrs   = problem.n_constraints;
+
+  size_t total_memory = 0;
+  // Scaled copy of the problem, A and A_T
+  total_memory += 2 * nnz * (sizeof(i_t) + sizeof(f_t));
+  total_memory += 2 * (n_variables + n_constrs + 2) * sizeof(i_t);
+  if constexpr (std::is_same_v<f_t, double>) {
+    if (settings.hyper_params.use_mixed_precision_spmv &&
+        settings.hyper_params.use_fixed_point_error) {
+      total_memory += 2 * nnz * sizeof(float);
+    }
+  }
+  // PDHG, saddle point, restart, step size, termination and solution vectors
+  // About 20 primal sized and 16 dual sized vectors across all of them
+  total_memory += 20 * n_variables * sizeof(f_t);
+  total_memory += 16 * n_constrs * sizeof(f_t);
+
+  // Same 50% overhead as batch PDLP for cuSparse buffers and temporaries
+  total_memory *= 1.5;
+  return total_memory;
+}
+
+// Why the row partitioned multi-GPU PDLP can't run the problem and settings, nullptr if it can
+template <typename i_t, typename f_t>
+static const char* row_partitioned_pdlp_unsupported_reason(
+  const detail::problem_t<i_t, f_t>& problem, pdlp_solver_settings_t<i_t, f_t> const& settings)
+{
+  const auto& hyper_params = settings.hyper_params;
+  if (!problem.Q_offsets.empty() || !problem.F_offsets.empty()) { return "quadratic objective"; }
+  if (!hyper_params.use_reflected_primal_dual || !hyper_params.use_fixed_point_error ||
+      hyper_params.use_adaptive_step_size_strategy ||
+      !detail::is_cupdlpx_restart<i_t, f_t>(hyper_params) ||
+      !hyper_params.bound_objective_rescaling ||
+      hyper_params.initial_primal_weight_combined_bounds) {
+    return "only the Stable3 PDLP solver mode is supported";
+  }
+  if (settings.detect_infeasibility) { return "infeasibility detection"; }
+  if (settings.per_constraint_residual || settings.save_best_primal_so_far ||
+      settings.first_primal_feasible) {
+    return "per constraint residual, save best primal so far and first primal feasible";
+  }
+  if (settings.has_initial_primal_solution() || settings.has_initial_dual_solution() ||
+      settings.get_pdlp_warm_start_data().last_restart_duality_gap_dual_solution_.size() != 0 ||
+      settings.has_initial_scaling_vectors()) {
+    return "initial solutions, warm start and initial scaling vectors";
+  }
+  if (problem.n_constraints < settings.num_gpus) { return "fewer constraints than GPUs"; }
+  return nullptr;
+}
+
 template <typename i_t, typename f_t>
 static optimization_problem_solution_t<i_t, f_t> run_pdlp_solver(
   detail::problem_t<i_t, f_t>& problem,
@@ -566,9 +680,38 @@ static optimization_problem_solution_t<i_t, f_t> run_pdlp_solver(
     return optimization_problem_solution_t<i_t, f_t>{pdlp_termination_status_t::NumericalError,
                                                      problem.handle_ptr->get_stream()};
   }
+  // PDLP alone with CUOPT_NUM_GPUS > 1 splits the rows of the problem over the GPUs
+  if (settings.num_gpus > 1 && settings.method == method_t::PDLP && !is_batch_mode &&
+      !settings.inside_mip) {
+    const char* unsupported_reason = row_partitioned_pdlp_unsupported_reason(problem, settings);
+    if (unsupported_reason == nullptr) {
+      check_num_gpus(settings.num_gpus);
+      const auto device_ids =
+        get_device_ids(raft::device_setter::get_current_device(), settings.num_gpus);
+      CUOPT_LOG_INFO("Running PDLP on %d GPUs", settings.num_gpus);
+      detail::row_partitioned_pdlp_t<i_t, f_t> solver(problem, settings, device_ids);
+      return solver.run_solver(timer);
+    }
+    CUOPT_LOG_WARN("Multi-GPU PDLP does not support %s, running on a single GPU",
+                   unsupported_reason);
+  }
+  if (!is_batch_mode && !settings.inside_mip) {
+    // Only warn, memory cached by the async memory resource is not reported as free
+    const size_t memory_estimate = pdlp_memory_estimator(problem, settings);
+    const size_t free_mem        = get_device_free_memory();
+    if (memory_estimate > free_mem) {
+      CUOPT_LOG_WARN(
+        "PDLP needs about %.2f GiB but only %.2f GiB are free on device %d",
+        memory_estimate / (double)(1 << 30),
+        free_mem / (double)(1 << 30),
+        raft::device_setter::get_current_device());
+    }
+  }
   detail::pdlp_solver_t<i_t, f_t> solver(problem, settings, is_batch_mode);
   if (settings.inside_mip) { solver.set_inside_mip(true); }
-  return solver.run_solver(timer);
+  auto sol = solver.run_solver(timer);
+  solver.fill_phase_timings(sol);
+  return sol;
 }
 
 template <typename i_t, typename f_t>
@@ -600,74 +743,82 @@ optimization_problem_solution_t<i_t, f_t> run_pdlp(detail::problem_t<i_t, f_t>&
 
   const bool do_crossover = settings.crossover;
   i_t crossover_info      = 0;
-  if (do_crossover && sol.get_termination_status() == pdlp_termination_status_t::Optimal) {
-    crossover_info = -1;
-
-    dual_simplex::lp_problem_t<i_t, f_t> lp(problem.handle_ptr, 1, 1, 1);
-    dual_simplex::lp_solution_t<i_t, f_t> initial_solution(1, 1);
-    translate_to_crossover_problem(problem, sol, lp, initial_solution);
-    dual_simplex::simplex_solver_settings_t<i_t, f_t> dual_simplex_settings;
-    dual_simplex_settings.time_limit      = settings.time_limit;
-    dual_simplex_settings.iteration_limit = settings.iteration_limit;
-    dual_simplex_settings.concurrent_halt = settings.concurrent_halt;
-    dual_simplex::lp_solution_t<i_t, f_t> vertex_solution(lp.num_rows, lp.num_cols);
-    std::vector<dual_simplex::variable_status_t> vstatus(lp.num_cols);
-    dual_simplex::crossover_status_t crossover_status = dual_simplex::crossover(
-      lp, dual_simplex_settings, initial_solution, timer.get_tic_start(), vertex_solution, vstatus);
-    pdlp_termination_status_t termination_status = pdlp_termination_status_t::TimeLimit;
-    auto to_termination_status                   = [](dual_simplex::crossover_status_t status) {
-      switch (status) {
-        case dual_simplex::crossover_status_t::OPTIMAL: return pdlp_termination_status_t::Optimal;
-        case dual_simplex::crossover_status_t::PRIMAL_FEASIBLE:
-          return pdlp_termination_status_t::PrimalFeasible;
-        case dual_simplex::crossover_status_t::DUAL_FEASIBLE:
-          return pdlp_termination_status_t::NumericalError;
-        case dual_simplex::crossover_status_t::NUMERICAL_ISSUES:
-          return pdlp_termination_status_t::NumericalError;
-        case dual_simplex::crossover_status_t::CONCURRENT_LIMIT:
-          return pdlp_termination_status_t::ConcurrentLimit;
-        case dual_simplex::crossover_status_t::TIME_LIMIT:
-          return pdlp_termination_status_t::TimeLimit;
-        default: return pdlp_termination_status_t::NumericalError;
-      }
-    };
-    termination_status = to_termination_status(crossover_status);
-    if (crossover_status == dual_simplex::crossover_status_t::OPTIMAL) { crossover_info = 0; }
-    rmm::device_uvector<f_t> final_primal_solution =
-      cuopt::device_copy(vertex_solution.x, problem.handle_ptr->get_stream());
-    rmm::device_uvector<f_t> final_dual_solution =
-      cuopt::device_copy(vertex_solution.y, problem.handle_ptr->get_stream());
-    rmm::device_uvector<f_t> final_reduced_cost =
-      cuopt::device_copy(vertex_solution.z, problem.handle_ptr->get_stream());
-    problem.handle_ptr->sync_stream();
-    // Negate dual variables and reduced costs for maximization problems
-    if (problem.maximize) {
-      adjust_dual_solution_and_reduced_cost(
-        final_dual_solution, final_reduced_cost, problem.handle_ptr->get_stream());
+  // Crossover runs dual simplex, which only has 32-bit indices
+  if constexpr (std::is_same_v<i_t, int>) {
+    if (do_crossover && sol.get_termination_status() == pdlp_termination_status_t::Optimal) {
+      crossover_info = -1;
+
+      dual_simplex::lp_problem_t<i_t, f_t> lp(problem.handle_ptr, 1, 1, 1);
+      dual_simplex::lp_solution_t<i_t, f_t> initial_solution(1, 1);
+      translate_to_crossover_problem(problem, sol, lp, initial_solution);
+      dual_simplex::simplex_solver_settings_t<i_t, f_t> dual_simplex_settings;
+      dual_simplex_settings.time_limit      = settings.time_limit;
+      dual_simplex_settings.iteration_limit = settings.iteration_limit;
+      dual_simplex_settings.concurrent_halt = settings.concurrent_halt;
+      dual_simplex::lp_solution_t<i_t, f_t> vertex_solution(lp.num_rows, lp.num_cols);
+      std::vector<dual_simplex::variable_status_t> vstatus(lp.num_cols);
+      dual_simplex::crossover_status_t crossover_status =
+        dual_simplex::crossover(lp,
+                                dual_simplex_settings,
+                                initial_solution,
+                                timer.get_tic_start(),
+                                vertex_solution,
+                                vstatus);
+      pdlp_termination_status_t termination_status = pdlp_termination_status_t::TimeLimit;
+      auto to_termination_status                   = [](dual_simplex::crossover_status_t status) {
+        switch (status) {
+          case dual_simplex::crossover_status_t::OPTIMAL: return pdlp_termination_status_t::Optimal;
+          case dual_simplex::crossover_status_t::PRIMAL_FEASIBLE:
+            return pdlp_termination_status_t::PrimalFeasible;
+          case dual_simplex::crossover_status_t::DUAL_FEASIBLE:
+            return pdlp_termination_status_t::NumericalError;
+          case dual_simplex::crossover_status_t::NUMERICAL_ISSUES:
+            return pdlp_termination_status_t::NumericalError;
+          case dual_simplex::crossover_status_t::CONCURRENT_LIMIT:
+            return pdlp_termination_status_t::ConcurrentLimit;
+          case dual_simplex::crossover_status_t::TIME_LIMIT:
+            return pdlp_termination_status_t::TimeLimit;
+          default: return pdlp_termination_status_t::NumericalError;
+        }
+      };
+      termination_status = to_termination_status(crossover_status);
+      if (crossover_status == dual_simplex::crossover_status_t::OPTIMAL) { crossover_info = 0; }
+      rmm::device_uvector<f_t> final_primal_solution =
+        cuopt::device_copy(vertex_solution.x, problem.handle_ptr->get_stream());
+      rmm::device_uvector<f_t> final_dual_solution =
+        cuopt::device_copy(vertex_solution.y, problem.handle_ptr->get_stream());
+      rmm::device_uvector<f_t> final_reduced_cost =
+        cuopt::device_copy(vertex_solution.z, problem.handle_ptr->get_stream());
       problem.handle_ptr->sync_stream();
-    }
+      // Negate dual variables and reduced costs for maximization problems
+      if (problem.maximize) {
+        adjust_dual_solution_and_reduced_cost(
+          final_dual_solution, final_reduced_cost, problem.handle_ptr->get_stream());
+        problem.handle_ptr->sync_stream();
+      }
 
-    // Should be filled with more information from dual simplex
-    std::vector<
-      typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t>
-      info(1);
-    info[0].primal_objective      = vertex_solution.user_objective;
-    info[0].number_of_steps_taken = vertex_solution.iterations;
-    auto crossover_end            = std::chrono::high_resolution_clock::now();
-    auto crossover_duration =
-      std::chrono::duration_cast<std::chrono::milliseconds>(crossover_end - start_solver);
-    info[0].solve_time = crossover_duration.count() / 1000.0;
-    auto sol_crossover = optimization_problem_solution_t<i_t, f_t>(final_primal_solution,
-                                                                   final_dual_solution,
-                                                                   final_reduced_cost,
-                                                                   problem.objective_name,
-                                                                   problem.var_names,
-                                                                   problem.row_names,
-                                                                   std::move(info),
-                                                                   {termination_status});
-    sol.copy_from(problem.handle_ptr, sol_crossover);
-    CUOPT_LOG_CONDITIONAL_INFO(
-      !settings.inside_mip, "Crossover status %s", sol.get_termination_status_string().c_str());
+      // Should be filled with more information from dual simplex
+      std::vector<
+        typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t>
+        info(1);
+      info[0].primal_objective      = vertex_solution.user_objective;
+      info[0].number_of_steps_taken = vertex_solution.iterations;
+      auto crossover_end            = std::chrono::high_resolution_clock::now();
+      auto crossover_duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(crossover_end - start_solver);
+      info[0].solve_time = crossover_duration.count() / 1000.0;
+      auto sol_crossover = optimization_problem_solution_t<i_t, f_t>(final_primal_solution,
+                                                                     final_dual_solution,
+                                                                     final_reduced_cost,
+                                                                     problem.objective_name,
+                                                                     problem.var_names,
+                                                                     problem.row_names,
+                                                                     std::move(info),
+                                                                     {termination_status});
+      sol.copy_from(problem.handle_ptr, sol_crossover);
+      CUOPT_LOG_CONDITIONAL_INFO(
+        !settings.inside_mip, "Crossover status %s", sol.get_termination_status_string().c_str());
+    }
   }
   if (settings.method == method_t::Concurrent && settings.concurrent_halt != nullptr &&
       crossover_info == 0 && sol.get_termination_status() == pdlp_termination_status_t::Optimal) {
@@ -765,8 +916,8 @@ optimization_problem_solution_t<i_t, f_t> run_batch_pdlp(
   // Check if we don't hit the limit using max_batch_size
   const size_t memory_estimate =
     batch_pdlp_memory_estimator(problem, max_batch_size, max_batch_size);
-  size_t free_mem, total_mem;
-  RAFT_CUDA_TRY(cudaMemGetInfo(&free_mem, &total_mem));
+  // Capped by the device memory budget of the solve, the batch is shrunk to fit in it
+  const size_t free_mem = get_device_free_memory();
 
   if (memory_estimate > free_mem) {
     use_optimal_batch_size = true;
@@ -841,8 +992,12 @@ optimization_problem_solution_t<i_t, f_t> run_batch_pdlp(
   }
   if (primal_weight_init) { batch_settings.set_initial_primal_weight(initial_primal_weight); }
 
-  for (int i = 0; i < max_batch_size; i += optimal_batch_size) {
-    const int current_batch_size = std::min(optimal_batch_size, max_batch_size - i);
+  // Spread the problems evenly over the chunks instead of leaving a small last chunk: same number
+  // of solves but each one runs at a width at most equal to the optimal one
+  const int nb_chunks        = cuda::ceil_div(max_batch_size, optimal_batch_size);
+  const int chunk_batch_size = cuda::ceil_div(max_batch_size, nb_chunks);
+  for (int i = 0; i < max_batch_size; i += chunk_batch_size) {
+    const int current_batch_size = std::min(chunk_batch_size, max_batch_size - i);
     // Only take the new bounds from [i, i + current_batch_size)
     batch_settings.new_bounds = std::vector<std::tuple<i_t, f_t, f_t>>(
       original_new_bounds.begin() + i, original_new_bounds.begin() + i + current_batch_size);
@@ -953,12 +1108,15 @@ optimization_problem_solution_t<i_t, f_t> run_concurrent(
   // Make sure allocations are done on the original stream
   problem.handle_ptr->sync_stream();
 
+  // PDLP keeps the current device, barrier factorizes with cuDSS on the next num_gpus - 1 devices
+  // and dual simplex runs on the CPU
+  std::vector<int> barrier_device_ids;
   if (settings.num_gpus > 1) {
-    int device_count = raft::device_setter::get_device_count();
+    check_num_gpus(settings.num_gpus);
+    barrier_device_ids =
+      get_device_ids(raft::device_setter::get_current_device() + 1, settings.num_gpus - 1);
     CUOPT_LOG_CONDITIONAL_INFO(
-      !settings.inside_mip, "Running PDLP and Barrier on %d GPUs", device_count);
-    cuopt_expects(
-      device_count > 1, error_type_t::RuntimeError, "Multi-GPU mode requires at least 2 GPUs");
+      !settings.inside_mip, "Running PDLP and Barrier on %d GPUs", settings.num_gpus);
   }
 
   // Initialize the dual simplex structures before we run PDLP.
@@ -993,13 +1151,18 @@ optimization_problem_solution_t<i_t, f_t> run_concurrent(
       run_barrier_thread<i_t, f_t>(std::ref(barrier_problem),
                                    std::ref(settings_pdlp),
                                    std::ref(sol_barrier_ptr),
-                                   std::ref(timer));
+                                   std::ref(timer),
+                                   std::cref(barrier_device_ids));
+      // The barrier handle and problem copy die here, freeing the barrier GPUs even when it loses
     };
 
     if (settings.num_gpus > 1) {
       problem.handle_ptr->sync_stream();
-      raft::device_setter device_setter(1);  // Scoped variable
-      CUOPT_LOG_DEBUG("Barrier device: %d", device_setter.get_current_device());
+      raft::device_setter device_setter(barrier_device_ids.front());  // Scoped variable
+      CUOPT_LOG_DEBUG("Barrier devices: %d to %d (%d GPUs)",
+                      barrier_device_ids.front(),
+                      barrier_device_ids.back(),
+                      (int)barrier_device_ids.size());
       call_barrier_thread();
     } else {
       call_barrier_thread();
@@ -1109,6 +1272,19 @@ optimization_problem_solution_t<i_t, f_t> solve_lp_with_method(
   const timer_t& timer,
   bool is_batch_mode)
 {
+  if (settings.method == method_t::Automatic) {
+    const auto features = detail::compute_lp_features(problem);
+    pdlp_solver_settings_t<i_t, f_t> selected_settings(settings);
+    selected_settings.method = detail::select_lp_method(features);
+    CUOPT_LOG_CONDITIONAL_INFO(
+      !settings.inside_mip,
+      "Automatic method: %s (%lld nonzeros, row length skew %.1f, %lld dense columns)",
+      detail::method_name(selected_settings.method),
+      (long long)features.nnz,
+      features.row_length_skew,
+      (long long)features.n_dense_columns);
+    return solve_lp_with_method(problem, selected_settings, timer, is_batch_mode);
+  }
   if (settings.method == method_t::DualSimplex) {
     return run_dual_simplex(problem, settings, timer);
   } else if (settings.method == method_t::Barrier) {
@@ -1121,7 +1297,7 @@ optimization_problem_solution_t<i_t, f_t> solve_lp_with_method(
 }
 
 template <typename i_t, typename f_t>
-optimization_problem_solution_t<i_t, f_t> solve_lp(
+static optimization_problem_solution_t<i_t, f_t> solve_lp_32bit_indices(
   optimization_problem_t<i_t, f_t>& op_problem,
   pdlp_solver_settings_t<i_t, f_t> const& settings_const,
   bool problem_checking,
@@ -1134,14 +1310,27 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
     pdlp_solver_settings_t<i_t, f_t> settings(settings_const);
     // Create log stream for file logging and add it to default logger
     init_logger_t log(settings.log_file, settings.log_to_console);
+    // Solves inside MIP run under the budget of the MIP solve
+    device_memory_budget_t memory_budget(settings_const.inside_mip
+                                           ? std::numeric_limits<double>::infinity()
+                                           : settings.device_memory_limit);
+    solver_counters_scope_t counters_scope(!settings_const.inside_mip);
 
     // Init libraies before to not include it in solve time
     // This needs to be called before pdlp is initialized
     init_handler(op_problem.get_handle_ptr());
 
     if (op_problem.has_quadratic_objective()) {
-      CUOPT_LOG_INFO("Problem has a quadratic objective. Using Barrier.");
-      settings.method    = method_t::Barrier;
+      // PDLP only reads Q through products, it is the only method for a factored Q
+      if (settings.method == method_t::PDLP || op_problem.has_factored_quadratic_objective()) {
+        CUOPT_LOG_INFO("Problem has a %squadratic objective. Using PDLP.",
+                       op_problem.has_factored_quadratic_objective() ? "factored " : "");
+        settings.method    = method_t::PDLP;
+        settings.crossover = false;
+      } else {
+        CUOPT_LOG_INFO("Problem has a quadratic objective. Using Barrier.");
+        settings.method = method_t::Barrier;
+      }
       settings.presolver = presolver_t::None;
       // check for sense of the problem
       if (op_problem.get_sense()) {
@@ -1178,9 +1367,46 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
                                                        op_problem.get_handle_ptr()->get_stream());
     }
 
+    // The saved solutions are in the space of the original problem, presolve is disabled when
+    // PDLP starts from them
+    std::optional<detail::warm_start_cache_t<i_t, f_t>> warm_start_cache;
+    if (!settings.warm_start_cache_dir.empty() && !settings_const.inside_mip && !is_batch_mode &&
+        !op_problem.has_quadratic_objective()) {
+      warm_start_cache.emplace(settings.warm_start_cache_dir, op_problem);
+      const bool can_warm_start =
+        settings.method == method_t::PDLP &&
+        (settings.presolver == presolver_t::Default || settings.presolver == presolver_t::None) &&
+        !settings.has_initial_primal_solution() && !settings.has_initial_dual_solution() &&
+        settings.get_pdlp_warm_start_data().total_pdlp_iterations_ == -1;
+      std::vector<f_t> primal;
+      std::vector<f_t> dual;
+      if (can_warm_start && warm_start_cache->read(primal, dual)) {
+        CUOPT_LOG_INFO("Starting PDLP from the warm start cache entry %s",
+                       warm_start_cache->path().c_str());
+        auto stream = op_problem.get_handle_ptr()->get_stream();
+        settings.set_initial_primal_solution(primal.data(), primal.size(), stream);
+        if (!dual.empty()) { settings.set_initial_dual_solution(dual.data(), dual.size(), stream); }
+        // the host vectors are freed on return
+        RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+        settings.presolver = presolver_t::None;
+      }
+    }
+
     auto lp_timer = cuopt::timer_t(settings.time_limit);
     detail::problem_t<i_t, f_t> problem(op_problem);
 
+    // A small problem that presolve barely reduces is solved faster without it
+    if (settings.latency_mode && settings.presolver == presolver_t::Default &&
+        !settings_const.inside_mip && !is_batch_mode) {
+      const double reduction =
+        detail::third_party_presolve_t<i_t, f_t>::estimate_reduction(op_problem);
+      if (reduction < detail::latency_mode_min_presolve_reduction) {
+        CUOPT_LOG_INFO("Latency mode: estimated presolve reduction %.1f%%, skipping presolve",
+                       100.0 * reduction);
+        settings.presolver = presolver_t::None;
+      }
+    }
+
     // handle default presolve
     if (settings.presolver == presolver_t::Default) {
       settings.presolver = presolver_t::PSLP;
@@ -1191,7 +1417,11 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
     std::unique_ptr<detail::third_party_presolve_t<i_t, f_t>> presolver;
     auto run_presolve = settings.presolver != presolver_t::None;
     run_presolve = run_presolve && settings.get_pdlp_warm_start_data().total_pdlp_iterations_ == -1;
-    if (!run_presolve && !settings_const.inside_mip) {
+    // Batch solves stay on the original problem, the GPU presolve maps a single solution back
+    const bool run_gpu_presolve =
+      run_presolve && settings.presolver == presolver_t::GPU && !is_batch_mode;
+    run_presolve = run_presolve && settings.presolver != presolver_t::GPU;
+    if (!run_presolve && !run_gpu_presolve && !settings_const.inside_mip) {
       CUOPT_LOG_INFO("Third-party presolve is disabled, skipping");
     }
 
@@ -1273,6 +1503,14 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
                      presolve_time);
     }
 
+    std::unique_ptr<detail::gpu_lp_presolve_t<i_t, f_t>> gpu_presolver;
+    if (run_gpu_presolve) {
+      gpu_presolver = std::make_unique<detail::gpu_lp_presolve_t<i_t, f_t>>(op_problem);
+      if (!gpu_presolver->apply(problem)) { gpu_presolver.reset(); }
+      presolve_time = lp_timer.elapsed_time();
+      CUOPT_LOG_INFO("GPU presolve time: %.2fs", presolve_time);
+    }
+
     if (!settings_const.inside_mip) {
       CUOPT_LOG_INFO("Objective offset %f scaling_factor %f",
                      problem.presolve_data.objective_offset,
@@ -1324,6 +1562,41 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
                                                   std::move(status_vec));
     }
 
+    if (gpu_presolver) {
+      auto stream          = op_problem.get_handle_ptr()->get_stream();
+      auto primal_solution = cuopt::device_copy(solution.get_primal_solution(), stream);
+      auto dual_solution   = cuopt::device_copy(solution.get_dual_solution(), stream);
+      auto reduced_costs   = cuopt::device_copy(solution.get_reduced_cost(), stream);
+
+      gpu_presolver->undo(primal_solution, dual_solution, reduced_costs, stream);
+
+      std::vector<
+        typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t>
+        term_vec = solution.get_additional_termination_informations();
+      std::vector<pdlp_termination_status_t> status_vec = solution.get_terminations_status();
+
+      solution =
+        optimization_problem_solution_t<i_t, f_t>(primal_solution,
+                                                  dual_solution,
+                                                  reduced_costs,
+                                                  std::move(solution.get_pdlp_warm_start_data()),
+                                                  op_problem.get_objective_name(),
+                                                  op_problem.get_variable_names(),
+                                                  op_problem.get_row_names(),
+                                                  std::move(term_vec),
+                                                  std::move(status_vec));
+    }
+
+    if (warm_start_cache &&
+        solution.get_termination_status() == pdlp_termination_status_t::Optimal) {
+      auto stream = op_problem.get_handle_ptr()->get_stream();
+      if (!warm_start_cache->write(cuopt::host_copy(solution.get_primal_solution(), stream),
+                                   cuopt::host_copy(solution.get_dual_solution(), stream))) {
+        CUOPT_LOG_WARN("Could not write the warm start cache entry %s",
+                       warm_start_cache->path().c_str());
+      }
+    }
+
     if (settings.sol_file != "") {
       CUOPT_LOG_INFO("Writing solution to file %s", settings.sol_file.c_str());
       solution.write_to_sol_file(settings.sol_file, op_problem.get_handle_ptr()->get_stream());
@@ -1341,6 +1614,141 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
   }
 }
 
+// Problems with 64-bit indices are solved with PDLP only, and without third-party presolve: they,
+// crossover and the simplex based methods only have 32-bit indices
+template <typename i_t, typename f_t>
+static optimization_problem_solution_t<i_t, f_t> solve_lp_64bit_indices(
+  optimization_problem_t<i_t, f_t>& op_problem,
+  pdlp_solver_settings_t<i_t, f_t> const& settings_const,
+  bool problem_checking,
+  bool use_pdlp_solver_mode)
+{
+  try {
+    print_version_info();
+
+    pdlp_solver_settings_t<i_t, f_t> settings(settings_const);
+    init_logger_t log(settings.log_file, settings.log_to_console);
+    device_memory_budget_t memory_budget(settings.device_memory_limit);
+    solver_counters_scope_t counters_scope;
+
+    init_handler(op_problem.get_handle_ptr());
+
+    if (settings.method != method_t::PDLP || settings.crossover) {
+      CUOPT_LOG_INFO("Problem has 64-bit indices. Using PDLP without crossover.");
+    }
+    settings.method    = method_t::PDLP;
+    settings.crossover = false;
+    if (op_problem.has_quadratic_objective() && op_problem.get_sense()) {
+      CUOPT_LOG_ERROR("Quadratic problems must be minimized");
+      return optimization_problem_solution_t<i_t, f_t>(pdlp_termination_status_t::NumericalError,
+                                                       op_problem.get_handle_ptr()->get_stream());
+    }
+
+    raft::common::nvtx::range fun_scope("Running solver");
+
+    if (problem_checking) {
+      raft::common::nvtx::range fun_scope("Check problem representation");
+      problem_checking_t<i_t, f_t>::check_problem_representation(op_problem);
+      problem_checking_t<i_t, f_t>::check_initial_solution_representation(op_problem, settings);
+    }
+
+    CUOPT_LOG_INFO("Solving a problem with %ld constraints, %ld variables, and %ld nonzeros",
+                   static_cast<int64_t>(op_problem.get_n_constraints()),
+                   static_cast<int64_t>(op_problem.get_n_variables()),
+                   static_cast<int64_t>(op_problem.get_nnz()));
+    op_problem.print_scaling_information();
+
+    if (problem_checking_t<i_t, f_t>::has_crossing_bounds(op_problem)) {
+      return optimization_problem_solution_t<i_t, f_t>(pdlp_termination_status_t::PrimalInfeasible,
+                                                       op_problem.get_handle_ptr()->get_stream());
+    }
+
+    auto lp_timer = cuopt::timer_t(settings.time_limit);
+    detail::problem_t<i_t, f_t> problem(op_problem);
+
+    const bool run_gpu_presolve =
+      settings.presolver == presolver_t::GPU &&
+      settings.get_pdlp_warm_start_data().total_pdlp_iterations_ == -1;
+    if (settings.presolver != presolver_t::None && settings.presolver != presolver_t::GPU) {
+      CUOPT_LOG_INFO("Third-party presolve only supports 32-bit indices, skipping");
+    }
+    std::unique_ptr<detail::gpu_lp_presolve_t<i_t, f_t>> gpu_presolver;
+    if (run_gpu_presolve) {
+      gpu_presolver = std::make_unique<detail::gpu_lp_presolve_t<i_t, f_t>>(op_problem);
+      if (!gpu_presolver->apply(problem)) { gpu_presolver.reset(); }
+      CUOPT_LOG_INFO("GPU presolve time: %.2fs", lp_timer.elapsed_time());
+    }
+
+    if (settings.user_problem_file != "") {
+      CUOPT_LOG_INFO("Writing user problem to file: %s", settings.user_problem_file.c_str());
+      op_problem.write_to_mps(settings.user_problem_file);
+    }
+
+    if (use_pdlp_solver_mode) { set_pdlp_solver_mode(settings); }
+
+    auto solution = run_pdlp(problem, settings, lp_timer, false);
+
+    if (gpu_presolver) {
+      auto stream          = op_problem.get_handle_ptr()->get_stream();
+      auto primal_solution = cuopt::device_copy(solution.get_primal_solution(), stream);
+      auto dual_solution   = cuopt::device_copy(solution.get_dual_solution(), stream);
+      auto reduced_costs   = cuopt::device_copy(solution.get_reduced_cost(), stream);
+
+      gpu_presolver->undo(primal_solution, dual_solution, reduced_costs, stream);
+
+      std::vector<
+        typename optimization_problem_solution_t<i_t, f_t>::additional_termination_information_t>
+        term_vec = solution.get_additional_termination_informations();
+      std::vector<pdlp_termination_status_t> status_vec = solution.get_terminations_status();
+
+      solution =
+        optimization_problem_solution_t<i_t, f_t>(primal_solution,
+                                                  dual_solution,
+                                                  reduced_costs,
+                                                  std::move(solution.get_pdlp_warm_start_data()),
+                                                  op_problem.get_objective_name(),
+                                                  op_problem.get_variable_names(),
+                                                  op_problem.get_row_names(),
+                                                  std::move(term_vec),
+                                                  std::move(status_vec));
+    }
+
+    if (settings.sol_file != "") {
+      CUOPT_LOG_INFO("Writing solution to file %s", settings.sol_file.c_str());
+      solution.write_to_sol_file(settings.sol_file, op_problem.get_handle_ptr()->get_stream());
+    }
+
+    return solution;
+  } catch (const cuopt::logic_error& e) {
+    CUOPT_LOG_ERROR("Error in solve_lp: %s", e.what());
+    return optimization_problem_solution_t<i_t, f_t>{e, op_problem.get_handle_ptr()->get_stream()};
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_ERROR("Error in solve_lp: %s", e.what());
+    return optimization_problem_solution_t<i_t, f_t>{
+      cuopt::logic_error("Memory allocation failed", cuopt::error_type_t::RuntimeError),
+      op_problem.get_handle_ptr()->get_stream()};
+  }
+}
+
+template <typename i_t, typename f_t>
+optimization_problem_solution_t<i_t, f_t> solve_lp(
+  optimization_problem_t<i_t, f_t>& op_problem,
+  pdlp_solver_settings_t<i_t, f_t> const& settings,
+  bool problem_checking,
+  bool use_pdlp_solver_mode,
+  bool is_batch_mode)
+{
+  if constexpr (std::is_same_v<i_t, int>) {
+    return solve_lp_32bit_indices(
+      op_problem, settings, problem_checking, use_pdlp_solver_mode, is_batch_mode);
+  } else {
+    cuopt_expects(!is_batch_mode,
+                  error_type_t::ValidationError,
+                  "Batch PDLP only supports 32-bit indices");
+    return solve_lp_64bit_indices(op_problem, settings, problem_checking, use_pdlp_solver_mode);
+  }
+}
+
 template <typename i_t, typename f_t>
 cuopt::linear_programming::optimization_problem_t<i_t, f_t> mps_data_model_to_optimization_problem(
   raft::handle_t const* handle_ptr, const cuopt::mps_parser::mps_data_model_t<i_t, f_t>& data_model)
@@ -1435,6 +1843,128 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
   return solve_lp(op_problem, settings, problem_checking, use_pdlp_solver_mode);
 }
 
+// Copies of the objective and bound vectors of a problem, written back when the guard goes out of
+// scope, also when a solve throws
+template <typename f_t>
+class problem_vectors_guard_t {
+ public:
+  problem_vectors_guard_t(std::vector<rmm::device_uvector<f_t>*> vectors,
+                          rmm::cuda_stream_view stream)
+    : vectors_(std::move(vectors)), stream_(stream)
+  {
+    for (auto* vec : vectors_) {
+      base_vectors_.emplace_back(*vec, stream_);
+    }
+  }
+  problem_vectors_guard_t(const problem_vectors_guard_t&)            = delete;
+  problem_vectors_guard_t& operator=(const problem_vectors_guard_t&) = delete;
+
+  ~problem_vectors_guard_t()
+  {
+    try {
+      for (size_t k = 0; k < vectors_.size(); ++k) {
+        restore(k);
+      }
+      RAFT_CUDA_TRY(cudaStreamSynchronize(stream_));
+    } catch (const std::exception& e) {
+      CUOPT_LOG_ERROR("Could not restore the vectors of the problem: %s", e.what());
+    }
+  }
+
+  void restore(size_t k)
+  {
+    vectors_[k]->resize(base_vectors_[k].size(), stream_);
+    raft::copy(vectors_[k]->data(), base_vectors_[k].data(), base_vectors_[k].size(), stream_);
+  }
+
+ private:
+  std::vector<rmm::device_uvector<f_t>*> vectors_;
+  std::vector<rmm::device_uvector<f_t>> base_vectors_;
+  rmm::cuda_stream_view stream_;
+};
+
+template <typename i_t, typename f_t>
+void solve_lp_sequence(
+  optimization_problem_t<i_t, f_t>& op_problem,
+  const std::vector<lp_variant_t<i_t, f_t>>& variants,
+  const std::function<void(size_t, optimization_problem_solution_t<i_t, f_t>&)>& on_solution,
+  pdlp_solver_settings_t<i_t, f_t> const& settings_const)
+{
+  rmm::cuda_stream_view stream = op_problem.get_handle_ptr()->get_stream();
+
+  // Only the vectors are swapped between variants, the base ones are restored on return
+  std::vector<rmm::device_uvector<f_t>*> problem_vectors{
+    &op_problem.get_objective_coefficients(),
+    &op_problem.get_constraint_lower_bounds(),
+    &op_problem.get_constraint_upper_bounds(),
+    &op_problem.get_variable_lower_bounds(),
+    &op_problem.get_variable_upper_bounds()};
+  problem_vectors_guard_t<f_t> base_vectors(problem_vectors, stream);
+
+  const size_t n_variables   = op_problem.get_n_variables();
+  const size_t n_constraints = op_problem.get_n_constraints();
+  const std::array<size_t, 5> expected_sizes{
+    n_variables, n_constraints, n_constraints, n_variables, n_variables};
+
+  pdlp_solver_settings_t<i_t, f_t> settings(settings_const);
+  // Previous solution is in the space of the presolved problem otherwise
+  const bool warm_start =
+    settings.method == method_t::PDLP && settings.presolver == presolver_t::None;
+
+  for (size_t v = 0; v < variants.size(); ++v) {
+    const auto& variant = variants[v];
+    const std::array<const std::vector<f_t>*, 5> variant_vectors{&variant.objective_coefficients,
+                                                                 &variant.constraint_lower_bounds,
+                                                                 &variant.constraint_upper_bounds,
+                                                                 &variant.variable_lower_bounds,
+                                                                 &variant.variable_upper_bounds};
+    for (size_t k = 0; k < problem_vectors.size(); ++k) {
+      const std::vector<f_t>* source = variant_vectors[k]->empty() ? nullptr : variant_vectors[k];
+      if (source == nullptr) {
+        base_vectors.restore(k);
+        continue;
+      }
+      cuopt_expects(source->size() == expected_sizes[k],
+                    error_type_t::ValidationError,
+                    "Variant %zu: vector %zu has size %zu instead of %zu",
+                    v,
+                    k,
+                    source->size(),
+                    expected_sizes[k]);
+      problem_vectors[k]->resize(source->size(), stream);
+      raft::copy(problem_vectors[k]->data(), source->data(), source->size(), stream);
+    }
+    // Host vectors of the variant must outlive the copies
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    auto solution = solve_lp(op_problem, settings);
+    if (warm_start && solution.get_primal_solution().size() == n_variables) {
+      settings.set_initial_primal_solution(
+        solution.get_primal_solution().data(), solution.get_primal_solution().size(), stream);
+      settings.set_initial_dual_solution(
+        solution.get_dual_solution().data(), solution.get_dual_solution().size(), stream);
+      // The scaling only depends on the shared matrix, the next solve skips its passes, and starts
+      // from the step size and primal weight the previous one converged to
+      const auto& warm_start_data = solution.get_pdlp_warm_start_data();
+      if (warm_start_data.variable_scaling_.size() == n_variables &&
+          warm_start_data.constraint_scaling_.size() == n_constraints) {
+        settings.set_initial_scaling_vectors(warm_start_data.variable_scaling_.data(),
+                                             n_variables,
+                                             warm_start_data.constraint_scaling_.data(),
+                                             n_constraints,
+                                             stream);
+      }
+      if (warm_start_data.initial_step_size_ > f_t(0)) {
+        settings.set_initial_step_size(warm_start_data.initial_step_size_);
+      }
+      if (warm_start_data.initial_primal_weight_ > f_t(0)) {
+        settings.set_initial_primal_weight(warm_start_data.initial_primal_weight_);
+      }
+    }
+    on_solution(v, solution);
+  }
+}
+
 #define INSTANTIATE(F_TYPE)                                                            \
   template optimization_problem_solution_t<int, F_TYPE> solve_lp(                      \
     optimization_problem_t<int, F_TYPE>& op_problem,                                   \
@@ -1463,6 +1993,13 @@ optimization_problem_solution_t<i_t, f_t> solve_lp(
     const std::vector<F_TYPE>& root_soln_x,                                            \
     pdlp_solver_settings_t<int, F_TYPE> const& settings);                              \
                                                                                        \
+  template void solve_lp_sequence(                                                     \
+    optimization_problem_t<int, F_TYPE>& op_problem,                                   \
+    const std::vector<lp_variant_t<int, F_TYPE>>& variants,                            \
+    const std::function<void(size_t, optimization_problem_solution_t<int, F_TYPE>&)>&  \
+      on_solution,                                                                     \
+    pdlp_solver_settings_t<int, F_TYPE> const& settings);                              \
+                                                                                       \
   template optimization_problem_t<int, F_TYPE> mps_data_model_to_optimization_problem( \
     raft::handle_t const* handle_ptr,                                                  \
     const cuopt::mps_parser::mps_data_model_t<int, F_TYPE>& data_model);               \
@@ -1476,4 +2013,26 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template optimization_problem_solution_t<int64_t, double> solve_lp(
+  optimization_problem_t<int64_t, double>& op_problem,
+  pdlp_solver_settings_t<int64_t, double> const& settings,
+  bool problem_checking,
+  bool use_pdlp_solver_mode,
+  bool is_batch_mode);
+
+template optimization_problem_solution_t<int64_t, double> solve_lp(
+  raft::handle_t const* handle_ptr,
+  const cuopt::mps_parser::mps_data_model_t<int64_t, double>& mps_data_model,
+  pdlp_solver_settings_t<int64_t, double> const& settings,
+  bool problem_checking,
+  bool use_pdlp_solver_mode);
+
+template optimization_problem_t<int64_t, double> mps_data_model_to_optimization_problem(
+  raft::handle_t const* handle_ptr,
+  const cuopt::mps_parser::mps_data_model_t<int64_t, double>& data_model);
+
+template void set_pdlp_solver_mode(pdlp_solver_settings_t<int64_t, double>& settings);
+#endif
+
 }  // namespace cuopt::linear_programming
@@ -58,6 +58,23 @@ void pdlp_solver_settings_t<i_t, f_t>::set_initial_dual_solution(const f_t* init
   raft::copy(initial_dual_solution_.get()->data(), initial_dual_solution, size, stream);
 }
 
+template <typename i_t, typename f_t>
+void pdlp_solver_settings_t<i_t, f_t>::set_initial_scaling_vectors(const f_t* variable_scaling,
+                                                                   i_t primal_size,
+                                                                   const f_t* constraint_scaling,
+                                                                   i_t dual_size,
+                                                                   rmm::cuda_stream_view stream)
+{
+  cuopt_expects(variable_scaling != nullptr && constraint_scaling != nullptr,
+                error_type_t::ValidationError,
+                "initial scaling vectors cannot be null");
+
+  initial_variable_scaling_ = std::make_shared<rmm::device_uvector<f_t>>(primal_size, stream);
+  raft::copy(initial_variable_scaling_.get()->data(), variable_scaling, primal_size, stream);
+  initial_constraint_scaling_ = std::make_shared<rmm::device_uvector<f_t>>(dual_size, stream);
+  raft::copy(initial_constraint_scaling_.get()->data(), constraint_scaling, dual_size, stream);
+}
+
 template <typename i_t, typename f_t>
 void pdlp_solver_settings_t<i_t, f_t>::set_initial_step_size(f_t initial_step_size)
 {
@@ -76,83 +93,89 @@ void pdlp_solver_settings_t<i_t, f_t>::set_pdlp_warm_start_data(
   const rmm::device_uvector<i_t>& var_mapping,
   const rmm::device_uvector<i_t>& constraint_mapping)
 {
-  pdlp_warm_start_data_ = std::move(pdlp_warm_start_data_view);
+  set_pdlp_warm_start_data(std::move(pdlp_warm_start_data_view), var_mapping, constraint_mapping);
+}
+
+template <typename i_t, typename f_t>
+void pdlp_solver_settings_t<i_t, f_t>::set_pdlp_warm_start_data(
+  pdlp_warm_start_data_t<i_t, f_t>&& pdlp_warm_start_data,
+  const rmm::device_uvector<i_t>& var_mapping,
+  const rmm::device_uvector<i_t>& constraint_mapping)
+{
+  // Fresh object so that previous copies of these settings keep their own warm start
+  pdlp_warm_start_data_ =
+    std::make_shared<pdlp_warm_start_data_t<i_t, f_t>>(std::move(pdlp_warm_start_data));
+  auto& warm_start_data = *pdlp_warm_start_data_;
 
   // A var_mapping was given
   if (var_mapping.size() != 0) {
     // If less variables, scatter using the passed argument and reduce the size of all primal
     // related vectors
-    if (var_mapping.size() <
-        pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.size()) {
+    if (var_mapping.size() < warm_start_data.last_restart_duality_gap_primal_solution_.size()) {
       thrust::scatter(rmm::exec_policy(var_mapping.stream()),
-                      pdlp_warm_start_data_.current_primal_solution_.begin(),
-                      pdlp_warm_start_data_.current_primal_solution_.end(),
+                      warm_start_data.current_primal_solution_.begin(),
+                      warm_start_data.current_primal_solution_.end(),
                       var_mapping.begin(),
-                      pdlp_warm_start_data_.current_primal_solution_.begin());
+                      warm_start_data.current_primal_solution_.begin());
       thrust::scatter(rmm::exec_policy(var_mapping.stream()),
-                      pdlp_warm_start_data_.initial_primal_average_.begin(),
-                      pdlp_warm_start_data_.initial_primal_average_.end(),
+                      warm_start_data.initial_primal_average_.begin(),
+                      warm_start_data.initial_primal_average_.end(),
                       var_mapping.begin(),
-                      pdlp_warm_start_data_.initial_primal_average_.begin());
+                      warm_start_data.initial_primal_average_.begin());
       thrust::scatter(rmm::exec_policy(var_mapping.stream()),
-                      pdlp_warm_start_data_.current_ATY_.begin(),
-                      pdlp_warm_start_data_.current_ATY_.end(),
+                      warm_start_data.current_ATY_.begin(),
+                      warm_start_data.current_ATY_.end(),
                       var_mapping.begin(),
-                      pdlp_warm_start_data_.current_ATY_.begin());
+                      warm_start_data.current_ATY_.begin());
       thrust::scatter(rmm::exec_policy(var_mapping.stream()),
-                      pdlp_warm_start_data_.sum_primal_solutions_.begin(),
-                      pdlp_warm_start_data_.sum_primal_solutions_.end(),
+                      warm_start_data.sum_primal_solutions_.begin(),
+                      warm_start_data.sum_primal_solutions_.end(),
                       var_mapping.begin(),
-                      pdlp_warm_start_data_.sum_primal_solutions_.begin());
+                      warm_start_data.sum_primal_solutions_.begin());
       thrust::scatter(rmm::exec_policy(var_mapping.stream()),
-                      pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.begin(),
-                      pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.end(),
+                      warm_start_data.last_restart_duality_gap_primal_solution_.begin(),
+                      warm_start_data.last_restart_duality_gap_primal_solution_.end(),
                       var_mapping.begin(),
-                      pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.begin());
-
-      pdlp_warm_start_data_.current_primal_solution_.resize(var_mapping.size(),
-                                                            var_mapping.stream());
-      pdlp_warm_start_data_.initial_primal_average_.resize(var_mapping.size(),
-                                                           var_mapping.stream());
-      pdlp_warm_start_data_.current_ATY_.resize(var_mapping.size(), var_mapping.stream());
-      pdlp_warm_start_data_.sum_primal_solutions_.resize(var_mapping.size(), var_mapping.stream());
-      pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.resize(var_mapping.size(),
-                                                                             var_mapping.stream());
+                      warm_start_data.last_restart_duality_gap_primal_solution_.begin());
+
+      warm_start_data.current_primal_solution_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.initial_primal_average_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.current_ATY_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.sum_primal_solutions_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.last_restart_duality_gap_primal_solution_.resize(var_mapping.size(),
+                                                                       var_mapping.stream());
     } else if (var_mapping.size() >
-               pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.size()) {
-      const auto previous_size =
-        pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.size();
+               warm_start_data.last_restart_duality_gap_primal_solution_.size()) {
+      const auto previous_size = warm_start_data.last_restart_duality_gap_primal_solution_.size();
 
       // If more variables just pad with 0s
-      pdlp_warm_start_data_.current_primal_solution_.resize(var_mapping.size(),
-                                                            var_mapping.stream());
-      pdlp_warm_start_data_.initial_primal_average_.resize(var_mapping.size(),
-                                                           var_mapping.stream());
-      pdlp_warm_start_data_.current_ATY_.resize(var_mapping.size(), var_mapping.stream());
-      pdlp_warm_start_data_.sum_primal_solutions_.resize(var_mapping.size(), var_mapping.stream());
-      pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.resize(var_mapping.size(),
-                                                                             var_mapping.stream());
+      warm_start_data.current_primal_solution_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.initial_primal_average_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.current_ATY_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.sum_primal_solutions_.resize(var_mapping.size(), var_mapping.stream());
+      warm_start_data.last_restart_duality_gap_primal_solution_.resize(var_mapping.size(),
+                                                                       var_mapping.stream());
 
       thrust::fill(rmm::exec_policy(var_mapping.stream()),
-                   pdlp_warm_start_data_.current_primal_solution_.begin() + previous_size,
-                   pdlp_warm_start_data_.current_primal_solution_.end(),
+                   warm_start_data.current_primal_solution_.begin() + previous_size,
+                   warm_start_data.current_primal_solution_.end(),
                    f_t(0));
       thrust::fill(rmm::exec_policy(var_mapping.stream()),
-                   pdlp_warm_start_data_.initial_primal_average_.begin() + previous_size,
-                   pdlp_warm_start_data_.initial_primal_average_.end(),
+                   warm_start_data.initial_primal_average_.begin() + previous_size,
+                   warm_start_data.initial_primal_average_.end(),
                    f_t(0));
       thrust::fill(rmm::exec_policy(var_mapping.stream()),
-                   pdlp_warm_start_data_.current_ATY_.begin() + previous_size,
-                   pdlp_warm_start_data_.current_ATY_.end(),
+                   warm_start_data.current_ATY_.begin() + previous_size,
+                   warm_start_data.current_ATY_.end(),
                    f_t(0));
       thrust::fill(rmm::exec_policy(var_mapping.stream()),
-                   pdlp_warm_start_data_.sum_primal_solutions_.begin() + previous_size,
-                   pdlp_warm_start_data_.sum_primal_solutions_.end(),
+                   warm_start_data.sum_primal_solutions_.begin() + previous_size,
+                   warm_start_data.sum_primal_solutions_.end(),
                    f_t(0));
       thrust::fill(
         rmm::exec_policy(var_mapping.stream()),
-        pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.begin() + previous_size,
-        pdlp_warm_start_data_.last_restart_duality_gap_primal_solution_.end(),
+        warm_start_data.last_restart_duality_gap_primal_solution_.begin() + previous_size,
+        warm_start_data.last_restart_duality_gap_primal_solution_.end(),
         f_t(0));
     }
   }
@@ -162,68 +185,66 @@ void pdlp_solver_settings_t<i_t, f_t>::set_pdlp_warm_start_data(
     // If less variables, scatter using the passed argument and reduce the size of all dual related
     // vectors
     if (constraint_mapping.size() <
-        pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.size()) {
+        warm_start_data.last_restart_duality_gap_dual_solution_.size()) {
       thrust::scatter(rmm::exec_policy(constraint_mapping.stream()),
-                      pdlp_warm_start_data_.current_dual_solution_.begin(),
-                      pdlp_warm_start_data_.current_dual_solution_.end(),
+                      warm_start_data.current_dual_solution_.begin(),
+                      warm_start_data.current_dual_solution_.end(),
                       constraint_mapping.begin(),
-                      pdlp_warm_start_data_.current_dual_solution_.begin());
+                      warm_start_data.current_dual_solution_.begin());
       thrust::scatter(rmm::exec_policy(constraint_mapping.stream()),
-                      pdlp_warm_start_data_.initial_dual_average_.begin(),
-                      pdlp_warm_start_data_.initial_dual_average_.end(),
+                      warm_start_data.initial_dual_average_.begin(),
+                      warm_start_data.initial_dual_average_.end(),
                       constraint_mapping.begin(),
-                      pdlp_warm_start_data_.initial_dual_average_.begin());
+                      warm_start_data.initial_dual_average_.begin());
       thrust::scatter(rmm::exec_policy(constraint_mapping.stream()),
-                      pdlp_warm_start_data_.sum_dual_solutions_.begin(),
-                      pdlp_warm_start_data_.sum_dual_solutions_.end(),
+                      warm_start_data.sum_dual_solutions_.begin(),
+                      warm_start_data.sum_dual_solutions_.end(),
                       constraint_mapping.begin(),
-                      pdlp_warm_start_data_.sum_dual_solutions_.begin());
+                      warm_start_data.sum_dual_solutions_.begin());
       thrust::scatter(rmm::exec_policy(constraint_mapping.stream()),
-                      pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.begin(),
-                      pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.end(),
+                      warm_start_data.last_restart_duality_gap_dual_solution_.begin(),
+                      warm_start_data.last_restart_duality_gap_dual_solution_.end(),
                       constraint_mapping.begin(),
-                      pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.begin());
-
-      pdlp_warm_start_data_.current_dual_solution_.resize(constraint_mapping.size(),
-                                                          constraint_mapping.stream());
-      pdlp_warm_start_data_.initial_dual_average_.resize(constraint_mapping.size(),
-                                                         constraint_mapping.stream());
-      pdlp_warm_start_data_.sum_dual_solutions_.resize(constraint_mapping.size(),
-                                                       constraint_mapping.stream());
-      pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.resize(
-        constraint_mapping.size(), constraint_mapping.stream());
+                      warm_start_data.last_restart_duality_gap_dual_solution_.begin());
+
+      warm_start_data.current_dual_solution_.resize(constraint_mapping.size(),
+                                                    constraint_mapping.stream());
+      warm_start_data.initial_dual_average_.resize(constraint_mapping.size(),
+                                                   constraint_mapping.stream());
+      warm_start_data.sum_dual_solutions_.resize(constraint_mapping.size(),
+                                                 constraint_mapping.stream());
+      warm_start_data.last_restart_duality_gap_dual_solution_.resize(constraint_mapping.size(),
+                                                                     constraint_mapping.stream());
     } else if (constraint_mapping.size() >
-               pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.size()) {
-      const auto previous_size =
-        pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.size();
+               warm_start_data.last_restart_duality_gap_dual_solution_.size()) {
+      const auto previous_size = warm_start_data.last_restart_duality_gap_dual_solution_.size();
 
       // If more variables just pad with 0s
-      pdlp_warm_start_data_.current_dual_solution_.resize(constraint_mapping.size(),
-                                                          constraint_mapping.stream());
-      pdlp_warm_start_data_.initial_dual_average_.resize(constraint_mapping.size(),
-                                                         constraint_mapping.stream());
-      pdlp_warm_start_data_.sum_dual_solutions_.resize(constraint_mapping.size(),
-                                                       constraint_mapping.stream());
-      pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.resize(
-        constraint_mapping.size(), constraint_mapping.stream());
+      warm_start_data.current_dual_solution_.resize(constraint_mapping.size(),
+                                                    constraint_mapping.stream());
+      warm_start_data.initial_dual_average_.resize(constraint_mapping.size(),
+                                                   constraint_mapping.stream());
+      warm_start_data.sum_dual_solutions_.resize(constraint_mapping.size(),
+                                                 constraint_mapping.stream());
+      warm_start_data.last_restart_duality_gap_dual_solution_.resize(constraint_mapping.size(),
+                                                                     constraint_mapping.stream());
 
       thrust::fill(rmm::exec_policy(constraint_mapping.stream()),
-                   pdlp_warm_start_data_.current_dual_solution_.begin() + previous_size,
-                   pdlp_warm_start_data_.current_dual_solution_.end(),
+                   warm_start_data.current_dual_solution_.begin() + previous_size,
+                   warm_start_data.current_dual_solution_.end(),
                    f_t(0));
       thrust::fill(rmm::exec_policy(constraint_mapping.stream()),
-                   pdlp_warm_start_data_.initial_dual_average_.begin() + previous_size,
-                   pdlp_warm_start_data_.initial_dual_average_.end(),
+                   warm_start_data.initial_dual_average_.begin() + previous_size,
+                   warm_start_data.initial_dual_average_.end(),
                    f_t(0));
       thrust::fill(rmm::exec_policy(constraint_mapping.stream()),
-                   pdlp_warm_start_data_.sum_dual_solutions_.begin() + previous_size,
-                   pdlp_warm_start_data_.sum_dual_solutions_.end(),
+                   warm_start_data.sum_dual_solutions_.begin() + previous_size,
+                   warm_start_data.sum_dual_solutions_.end(),
+                   f_t(0));
+      thrust::fill(rmm::exec_policy(constraint_mapping.stream()),
+                   warm_start_data.last_restart_duality_gap_dual_solution_.begin() + previous_size,
+                   warm_start_data.last_restart_duality_gap_dual_solution_.end(),
                    f_t(0));
-      thrust::fill(
-        rmm::exec_policy(constraint_mapping.stream()),
-        pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.begin() + previous_size,
-        pdlp_warm_start_data_.last_restart_duality_gap_dual_solution_.end(),
-        f_t(0));
     }
   }
 }
@@ -336,6 +357,33 @@ bool pdlp_solver_settings_t<i_t, f_t>::has_initial_dual_solution() const
   return initial_dual_solution_.get() != nullptr;
 }
 
+template <typename i_t, typename f_t>
+const rmm::device_uvector<f_t>& pdlp_solver_settings_t<i_t, f_t>::get_initial_variable_scaling()
+  const
+{
+  cuopt_expects(initial_variable_scaling_.get() != nullptr,
+                error_type_t::ValidationError,
+                "Initial variable scaling was not set, but accessed!");
+  return *initial_variable_scaling_.get();
+}
+
+template <typename i_t, typename f_t>
+const rmm::device_uvector<f_t>& pdlp_solver_settings_t<i_t, f_t>::get_initial_constraint_scaling()
+  const
+{
+  cuopt_expects(initial_constraint_scaling_.get() != nullptr,
+                error_type_t::ValidationError,
+                "Initial constraint scaling was not set, but accessed!");
+  return *initial_constraint_scaling_.get();
+}
+
+template <typename i_t, typename f_t>
+bool pdlp_solver_settings_t<i_t, f_t>::has_initial_scaling_vectors() const
+{
+  return initial_variable_scaling_.get() != nullptr &&
+         initial_constraint_scaling_.get() != nullptr;
+}
+
 template <typename i_t, typename f_t>
 std::optional<f_t> pdlp_solver_settings_t<i_t, f_t>::get_initial_step_size() const
 {
@@ -352,13 +400,13 @@ template <typename i_t, typename f_t>
 const pdlp_warm_start_data_t<i_t, f_t>& pdlp_solver_settings_t<i_t, f_t>::get_pdlp_warm_start_data()
   const noexcept
 {
-  return pdlp_warm_start_data_;
+  return *pdlp_warm_start_data_;
 }
 
 template <typename i_t, typename f_t>
 pdlp_warm_start_data_t<i_t, f_t>& pdlp_solver_settings_t<i_t, f_t>::get_pdlp_warm_start_data()
 {
-  return pdlp_warm_start_data_;
+  return *pdlp_warm_start_data_;
 }
 
 template <typename i_t, typename f_t>
@@ -376,4 +424,8 @@ template class pdlp_solver_settings_t<int, float>;
 template class pdlp_solver_settings_t<int, double>;
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_solver_settings_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming
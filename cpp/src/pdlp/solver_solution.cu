@@ -439,6 +439,15 @@ void optimization_problem_solution_t<i_t, f_t>::write_to_sol_file(
   }
 
   auto objective_value = get_objective_value(0);
+  if (solution_writer_t::is_binary_sol_file(std::string(filename))) {
+    solution_writer_t::write_solution_to_binary_sol_file(std::string(filename),
+                                                         status,
+                                                         objective_value,
+                                                         primal_solution_.data(),
+                                                         primal_solution_.size(),
+                                                         stream_view);
+    return;
+  }
   std::vector<f_t> solution;
   solution.resize(primal_solution_.size());
   raft::copy(
@@ -455,4 +464,8 @@ template class optimization_problem_solution_t<int, float>;
 #if MIP_INSTANTIATE_DOUBLE
 template class optimization_problem_solution_t<int, double>;
 #endif
+
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class optimization_problem_solution_t<int64_t, double>;
+#endif
 }  // namespace cuopt::linear_programming
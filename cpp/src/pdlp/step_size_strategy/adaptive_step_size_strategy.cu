@@ -29,6 +29,7 @@
 #include <cub/cub.cuh>
 
 #include <limits>
+#include <memory>
 
 namespace cuopt::linear_programming::detail {
 
@@ -57,6 +58,11 @@ adaptive_step_size_strategy_t<i_t, f_t>::adaptive_step_size_strategy_t(
     reusable_device_scalar_value_0_{f_t(0.0), stream_view_},
     dot_product_storage(0, stream_view_),
     graph(stream_view_, is_legacy_batch_mode),
+    candidate_interaction_{0, stream_view_},
+    candidate_norm_squared_delta_primal_{0, stream_view_},
+    candidate_norm_squared_delta_dual_{0, stream_view_},
+    candidate_dot_product_storage_(0, stream_view_),
+    accepted_candidate_(1),
     climber_strategies_(climber_strategies),
     hyper_params_(hyper_params)
 {
@@ -343,6 +349,233 @@ void adaptive_step_size_strategy_t<i_t, f_t>::compute_step_sizes(
   RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_.value()));
 }
 
+template <typename i_t, typename f_t>
+__global__ void compute_candidate_step_sizes(
+  typename adaptive_step_size_strategy_t<i_t, f_t>::view_t step_size_strategy_view,
+  raft::device_span<f_t> step_sizes,
+  raft::device_span<f_t> primal_step_sizes,
+  raft::device_span<f_t> dual_step_sizes)
+{
+  if (threadIdx.x + blockIdx.x * blockDim.x > 0) { return; }
+
+  const f_t primal_weight = step_size_strategy_view.primal_weight[0];
+  f_t step_size           = step_size_strategy_view.step_size[0];
+  for (size_t k = 0; k < step_sizes.size(); ++k) {
+    step_sizes[k]        = step_size;
+    primal_step_sizes[k] = step_size / primal_weight;
+    dual_step_sizes[k]   = step_size * primal_weight;
+    step_size *= step_size_strategy_view.hyper_params.speculative_step_size_ratio;
+  }
+}
+
+// A_t @ y' - A_t @ y of every candidate
+template <typename i_t, typename f_t>
+__global__ void candidate_AtY_difference_kernel(const f_t* next_AtYs,
+                                                const f_t* current_AtY,
+                                                i_t primal_size,
+                                                i_t n_candidates,
+                                                f_t* AtY_differences)
+{
+  const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= static_cast<size_t>(primal_size) * n_candidates) { return; }
+
+  AtY_differences[idx] = next_AtYs[idx] - current_AtY[idx % primal_size];
+}
+
+// Same rule as compute_step_sizes_from_movement_and_interaction, applied to the candidates from
+// the largest step size down: the first one within its limit is accepted
+template <typename i_t, typename f_t>
+__global__ void select_candidate_step_size(
+  typename adaptive_step_size_strategy_t<i_t, f_t>::view_t step_size_strategy_view,
+  raft::device_span<const f_t> step_sizes,
+  raft::device_span<const f_t> interaction,
+  raft::device_span<const f_t> norm_squared_delta_primal,
+  raft::device_span<const f_t> norm_squared_delta_dual,
+  f_t* primal_step_size,
+  f_t* dual_step_size,
+  i_t* pdhg_iteration,
+  i_t* accepted_candidate)
+{
+  if (threadIdx.x + blockIdx.x * blockDim.x > 0) { return; }
+
+  const f_t primal_weight = step_size_strategy_view.primal_weight[0];
+
+  *pdhg_iteration += 1;
+  const f_t iteration_coefficient = *pdhg_iteration;
+
+  for (size_t k = 0; k < step_sizes.size(); ++k) {
+    const f_t movement =
+      step_size_strategy_view.hyper_params.primal_distance_smoothing * primal_weight *
+        norm_squared_delta_primal[k] +
+      (step_size_strategy_view.hyper_params.dual_distance_smoothing / primal_weight) *
+        norm_squared_delta_dual[k];
+    if (movement <= 0 || movement >= divergent_movement<f_t>) {
+      *step_size_strategy_view.valid_step_size = -1;
+      return;
+    }
+
+    const f_t candidate_interaction = raft::abs(interaction[k]);
+    const f_t step_size_limit =
+      candidate_interaction > 0.0 ? movement / candidate_interaction : raft::myInf<f_t>();
+    const f_t step_size = step_sizes[k];
+    const bool valid    = step_size <= step_size_limit;
+    if (!valid && k + 1 < step_sizes.size()) { continue; }
+
+    if (valid) {
+      *step_size_strategy_view.valid_step_size           = 1;
+      *accepted_candidate                                = static_cast<i_t>(k);
+      *step_size_strategy_view.interaction               = interaction[k];
+      *step_size_strategy_view.norm_squared_delta_primal = norm_squared_delta_primal[k];
+      *step_size_strategy_view.norm_squared_delta_dual   = norm_squared_delta_dual[k];
+    }
+
+    const f_t potential_new_step_size_1 =
+      (f_t(1.0) - raft::pow<f_t>(iteration_coefficient + f_t(1.0),
+                                 -step_size_strategy_view.hyper_params.reduction_exponent)) *
+      step_size_limit;
+    const f_t potential_new_step_size_2 =
+      (f_t(1.0) + raft::pow<f_t>(iteration_coefficient + f_t(1.0),
+                                 -step_size_strategy_view.hyper_params.growth_exponent)) *
+      step_size;
+    const f_t next_step_size = raft::min<f_t>(potential_new_step_size_1, potential_new_step_size_2);
+
+    *primal_step_size                    = next_step_size / primal_weight;
+    *dual_step_size                      = next_step_size * primal_weight;
+    step_size_strategy_view.step_size[0] = next_step_size;
+    cuopt_assert(!isnan(next_step_size), "step size can't be nan");
+    cuopt_assert(!isinf(next_step_size), "step size can't be inf");
+    return;
+  }
+}
+
+template <typename i_t, typename f_t>
+void adaptive_step_size_strategy_t<i_t, f_t>::compute_speculative_step_sizes(
+  pdhg_solver_t<i_t, f_t>& pdhg_solver,
+  rmm::device_uvector<f_t>& primal_step_size,
+  rmm::device_uvector<f_t>& dual_step_size)
+{
+  raft::common::nvtx::range fun_scope("compute_speculative_step_sizes");
+
+  cuopt_assert(!batch_mode_, "Batch mode is not supported for compute_speculative_step_sizes");
+  cuopt_assert(hyper_params_.speculative_step_size_candidates > 1,
+               "Speculative trials need at least two candidates");
+
+  const i_t n_candidates = hyper_params_.speculative_step_size_candidates;
+  if (!candidate_steps_) {
+    candidate_steps_ = std::make_unique<pdhg_candidate_steps_t<i_t, f_t>>(
+      handle_ptr_, pdhg_solver.get_cusparse_view(), primal_size_, dual_size_, n_candidates);
+    candidate_interaction_.resize(n_candidates, stream_view_);
+    candidate_norm_squared_delta_primal_.resize(n_candidates, stream_view_);
+    candidate_norm_squared_delta_dual_.resize(n_candidates, stream_view_);
+
+    // Pass down any input pointer of the right type, actual pointer does not matter
+    size_t byte_needed = 0;
+    RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+      nullptr,
+      byte_needed,
+      thrust::make_transform_iterator(
+        thrust::make_zip_iterator(candidate_interaction_.data(), candidate_interaction_.data()),
+        tuple_multiplies<f_t>{}),
+      candidate_interaction_.data(),
+      n_candidates,
+      primal_size_,
+      stream_view_.value()));
+    candidate_dot_product_bytes_ = std::max(candidate_dot_product_bytes_, byte_needed);
+
+    RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+      nullptr,
+      byte_needed,
+      thrust::make_transform_iterator(candidate_interaction_.data(), power_two_func_t<f_t>{}),
+      candidate_interaction_.data(),
+      n_candidates,
+      primal_size_,
+      stream_view_.value()));
+    candidate_dot_product_bytes_ = std::max(candidate_dot_product_bytes_, byte_needed);
+
+    RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+      nullptr,
+      byte_needed,
+      thrust::make_transform_iterator(candidate_interaction_.data(), power_two_func_t<f_t>{}),
+      candidate_interaction_.data(),
+      n_candidates,
+      dual_size_,
+      stream_view_.value()));
+    candidate_dot_product_bytes_ = std::max(candidate_dot_product_bytes_, byte_needed);
+
+    candidate_dot_product_storage_.resize(candidate_dot_product_bytes_, stream_view_.value());
+  }
+  auto& candidates = *candidate_steps_;
+
+  compute_candidate_step_sizes<i_t, f_t>
+    <<<1, 1, 0, stream_view_.value()>>>(this->view(),
+                                        make_span(candidates.step_sizes),
+                                        make_span(candidates.primal_step_sizes),
+                                        make_span(candidates.dual_step_sizes));
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+
+  pdhg_solver.take_candidate_steps(candidates);
+
+  // The reflected primals are not needed anymore once A (2 x' - x) is computed, they now hold
+  // A_t @ (y' - y) to compute the interaction (x' - x) . A_t @ (y' - y) as for a single step
+  auto& AtY_differences              = candidates.reflected_primals;
+  const auto [grid_size, block_size] =
+    kernel_config_from_batch_size(static_cast<size_t>(primal_size_) * n_candidates);
+  candidate_AtY_difference_kernel<i_t, f_t><<<grid_size, block_size, 0, stream_view_.value()>>>(
+    candidates.next_AtYs.data(),
+    pdhg_solver.get_saddle_point_state().get_current_AtY().data(),
+    primal_size_,
+    n_candidates,
+    AtY_differences.data());
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+
+  RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+    candidate_dot_product_storage_.data(),
+    candidate_dot_product_bytes_,
+    thrust::make_transform_iterator(
+      thrust::make_zip_iterator(AtY_differences.data(), candidates.delta_primals.data()),
+      tuple_multiplies<f_t>{}),
+    candidate_interaction_.data(),
+    n_candidates,
+    primal_size_,
+    stream_view_.value()));
+
+  RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+    candidate_dot_product_storage_.data(),
+    candidate_dot_product_bytes_,
+    thrust::make_transform_iterator(candidates.delta_primals.data(), power_two_func_t<f_t>{}),
+    candidate_norm_squared_delta_primal_.data(),
+    n_candidates,
+    primal_size_,
+    stream_view_.value()));
+
+  RAFT_CUDA_TRY(cub::DeviceSegmentedReduce::Sum(
+    candidate_dot_product_storage_.data(),
+    candidate_dot_product_bytes_,
+    thrust::make_transform_iterator(candidates.delta_duals.data(), power_two_func_t<f_t>{}),
+    candidate_norm_squared_delta_dual_.data(),
+    n_candidates,
+    dual_size_,
+    stream_view_.value()));
+
+  select_candidate_step_size<i_t, f_t><<<1, 1, 0, stream_view_.value()>>>(
+    this->view(),
+    make_span(candidates.step_sizes),
+    make_span(candidate_interaction_),
+    make_span(candidate_norm_squared_delta_primal_),
+    make_span(candidate_norm_squared_delta_dual_),
+    primal_step_size.data(),
+    dual_step_size.data(),
+    pdhg_solver.get_d_total_pdhg_iterations().data(),
+    thrust::raw_pointer_cast(accepted_candidate_.data()));
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+  // Steam sync so that the host sees valid_step_size and accepted_candidate
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_.value()));
+
+  if (valid_step_size_[0] == 1) {
+    pdhg_solver.accept_candidate_step(candidates, accepted_candidate_[0]);
+  }
+}
+
 template <typename i_t, typename f_t>
 void adaptive_step_size_strategy_t<i_t, f_t>::compute_interaction_and_movement(
   rmm::device_uvector<f_t>& tmp_primal,
@@ -586,4 +819,8 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class adaptive_step_size_strategy_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
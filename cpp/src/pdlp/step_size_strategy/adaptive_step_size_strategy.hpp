@@ -24,6 +24,8 @@
 
 #include <thrust/universal_vector.h>
 
+#include <memory>
+
 namespace cuopt::linear_programming::detail {
 template <typename i_t, typename f_t>
 class adaptive_step_size_strategy_t {
@@ -64,6 +66,17 @@ class adaptive_step_size_strategy_t {
                           rmm::device_uvector<f_t>& dual_step_size,
                           i_t total_pdlp_iterations);
 
+  /**
+   * @brief Speculative trial after a rejected step: takes the PDHG steps of
+   *        hyper_params.speculative_step_size_candidates step sizes at once, the current step size
+   *        times powers of hyper_params.speculative_step_size_ratio, and accepts the largest one
+   *        that satisfies the step size limit. If none does, the next step size is computed from
+   *        the limit of the smallest one, as compute_step_sizes would.
+   */
+  void compute_speculative_step_sizes(pdhg_solver_t<i_t, f_t>& pdhg_solver,
+                                      rmm::device_uvector<f_t>& primal_step_size,
+                                      rmm::device_uvector<f_t>& dual_step_size);
+
   void get_primal_and_dual_stepsizes(rmm::device_uvector<f_t>& primal_step_size,
                                      rmm::device_uvector<f_t>& dual_step_size);
   /**
@@ -117,6 +130,16 @@ class adaptive_step_size_strategy_t {
 
   ping_pong_graph_t<i_t> graph;
 
+  // Only allocated at the first speculative trial
+  std::unique_ptr<pdhg_candidate_steps_t<i_t, f_t>> candidate_steps_;
+  rmm::device_uvector<f_t> candidate_interaction_;
+  rmm::device_uvector<f_t> candidate_norm_squared_delta_primal_;
+  rmm::device_uvector<f_t> candidate_norm_squared_delta_dual_;
+  rmm::device_buffer candidate_dot_product_storage_;
+  size_t candidate_dot_product_bytes_{0};
+  // Index of the candidate accepted by the last speculative trial, written in kernel
+  thrust::universal_host_pinned_vector<i_t> accepted_candidate_;
+
   const std::vector<pdlp_climber_strategy_t>& climber_strategies_;
   const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params_;
 };
@@ -71,6 +71,7 @@ convergence_information_t<i_t, f_t>::convergence_information_t(
     reusable_device_scalar_value_neg_1_{-1.0, stream_view_},
     dual_dot_{climber_strategies.size(), stream_view_},
     sum_primal_slack_{climber_strategies.size(), stream_view_},
+    quadratic_term_{0, stream_view_},
     climber_strategies_(climber_strategies),
     hyper_params_(hyper_params)
 {
@@ -280,6 +281,18 @@ void convergence_information_t<i_t, f_t>::resize_context(i_t new_size)
   abs_objective_.resize(new_size, stream_view_);
   dual_dot_.resize(new_size, stream_view_);
   sum_primal_slack_.resize(new_size, stream_view_);
+  if (quadratic_objective_ != nullptr) { quadratic_term_.resize(new_size, stream_view_); }
+}
+
+template <typename i_t, typename f_t>
+void convergence_information_t<i_t, f_t>::set_quadratic_objective(
+  quadratic_objective_t<i_t, f_t>* quadratic_objective)
+{
+  quadratic_objective_ =
+    (quadratic_objective != nullptr && !quadratic_objective->empty()) ? quadratic_objective
+                                                                        : nullptr;
+  quadratic_term_.resize(quadratic_objective_ != nullptr ? climber_strategies_.size() : 0,
+                         stream_view_);
 }
 
 template <typename i_t, typename f_t>
@@ -308,6 +321,20 @@ f_t convergence_information_t<i_t, f_t>::get_relative_primal_tolerance_factor()
   return l2_norm_primal_right_hand_side_.value(stream_view_);
 }
 
+template <typename i_t, typename f_t>
+const rmm::device_scalar<f_t>&
+convergence_information_t<i_t, f_t>::get_l2_norm_primal_linear_objective() const
+{
+  return l2_norm_primal_linear_objective_;
+}
+
+template <typename i_t, typename f_t>
+const rmm::device_scalar<f_t>&
+convergence_information_t<i_t, f_t>::get_l2_norm_primal_right_hand_side() const
+{
+  return l2_norm_primal_right_hand_side_;
+}
+
 template <typename i_t, typename f_t>
 __global__ void compute_remaining_stats_kernel(
   typename convergence_information_t<i_t, f_t>::view_t convergence_information_view, int batch_size)
@@ -359,6 +386,11 @@ void convergence_information_t<i_t, f_t>::compute_convergence_information(
 
   compute_primal_residual(
     op_problem_cusparse_view_, current_pdhg_solver.get_dual_tmp_resource(), dual_iterate);
+  // QP: Q x and 1/2 x^T Q x, shared by both objectives and the dual residual
+  if (quadratic_objective_ != nullptr) {
+    quadratic_objective_->compute_quadratic_term(
+      primal_iterate.data(), climber_strategies_.size(), quadratic_term_);
+  }
   compute_primal_objective(primal_iterate);
 
 #ifdef CUPDLP_DEBUG_MODE
@@ -615,6 +647,16 @@ void convergence_information_t<i_t, f_t>::compute_primal_objective(
       stream_view_);
   }
 
+  // QP: c^T x + 1/2 x^T Q x
+  if (quadratic_objective_ != nullptr) {
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(primal_objective_.data(), quadratic_term_.data()),
+      primal_objective_.data(),
+      primal_objective_.size(),
+      cuda::std::plus<>{},
+      stream_view_);
+  }
+
   // primal_objective = 1 * (primal_objective + 0) = primal_objective
   if (problem_ptr->presolve_data.objective_scaling_factor != 1 ||
       problem_ptr->presolve_data.objective_offset != 0) {
@@ -648,7 +690,7 @@ void convergence_information_t<i_t, f_t>::compute_dual_residual(
                "dual_residual_ size must be equal to primal_solution size");
 
   raft::common::nvtx::range fun_scope("compute_dual_residual");
-  // compute objective product (Q*x) if QP
+  // The objective product (Q*x) of a QP is computed in compute_convergence_information
 
   // gradient is recomputed with the dual solution that has been computed since the gradient was
   // last computed
@@ -692,6 +734,16 @@ void convergence_information_t<i_t, f_t>::compute_dual_residual(
     cuda::std::minus<>{},
     stream_view_);
 
+  // QP: the primal gradient is c + Q x - K^T y
+  if (quadratic_objective_ != nullptr) {
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(tmp_primal.data(), quadratic_objective_->get_product().data()),
+      tmp_primal.data(),
+      tmp_primal.size(),
+      cuda::std::plus<>{},
+      stream_view_);
+  }
+
   if (hyper_params_.use_reflected_primal_dual) {
     cub::DeviceTransform::Transform(cuda::std::make_tuple(tmp_primal.data(), dual_slack.data()),
                                     dual_residual_.data(),
@@ -722,8 +774,7 @@ void convergence_information_t<i_t, f_t>::compute_dual_objective(
 {
   raft::common::nvtx::range fun_scope("compute_dual_objective");
 
-  // for QP would need to add + problem.objective_constant - 0.5 * objective_product' *
-  // primal_solution
+  // for QP the quadratic term - 0.5 * objective_product' * primal_solution is removed below
 
   // the value of y term in the objective of the dual problem, see[]
   //  (l^c)^T[y]_+ − (u^c)^T[y]_− in the dual objective
@@ -802,6 +853,15 @@ void convergence_information_t<i_t, f_t>::compute_dual_objective(
       stream_view_);
   }
 
+  if (quadratic_objective_ != nullptr) {
+    cub::DeviceTransform::Transform(
+      cuda::std::make_tuple(dual_objective_.data(), quadratic_term_.data()),
+      dual_objective_.data(),
+      dual_objective_.size(),
+      cuda::std::minus<>{},
+      stream_view_);
+  }
+
   // dual_objective = 1 * (dual_objective + 0) = dual_objective
   if (problem_ptr->presolve_data.objective_scaling_factor != 1 ||
       problem_ptr->presolve_data.objective_offset != 0) {
@@ -1012,4 +1072,8 @@ template __global__ void compute_remaining_stats_kernel<int, double>(
   int batch_size);
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class convergence_information_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
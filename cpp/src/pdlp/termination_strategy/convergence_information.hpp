@@ -9,6 +9,7 @@
 #include <pdlp/cusparse_view.hpp>
 #include <pdlp/pdhg.hpp>
 #include <pdlp/pdlp_climber_strategy.hpp>
+#include <pdlp/quadratic_objective.hpp>
 #include <pdlp/saddle_point.hpp>
 #include <pdlp/swap_and_resize_helper.cuh>
 
@@ -63,8 +64,12 @@ class convergence_information_t {
 
   void set_relative_dual_tolerance_factor(f_t dual_tolerance_factor);
   void set_relative_primal_tolerance_factor(f_t primal_tolerance_factor);
+  // Adds the quadratic term of a QP to the objectives and Q x to the dual residual
+  void set_quadratic_objective(quadratic_objective_t<i_t, f_t>* quadratic_objective);
   f_t get_relative_dual_tolerance_factor() const;
   f_t get_relative_primal_tolerance_factor() const;
+  const rmm::device_scalar<f_t>& get_l2_norm_primal_linear_objective() const;
+  const rmm::device_scalar<f_t>& get_l2_norm_primal_right_hand_side() const;
 
   struct view_t {
     i_t primal_size;
@@ -196,6 +201,11 @@ class convergence_information_t {
   rmm::device_uvector<f_t> dual_dot_;
   rmm::device_uvector<f_t> sum_primal_slack_;
 
+  // Only set for a QP, not owned
+  quadratic_objective_t<i_t, f_t>* quadratic_objective_{nullptr};
+  // 1/2 x^T Q x of each climber
+  rmm::device_uvector<f_t> quadratic_term_;
+
   const std::vector<pdlp_climber_strategy_t>& climber_strategies_;
   const pdlp_hyper_params::pdlp_hyper_params_t& hyper_params_;
 };
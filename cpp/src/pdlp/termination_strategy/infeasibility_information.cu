@@ -759,4 +759,8 @@ template __global__ void compute_remaining_stats_kernel<int, double>(
   typename infeasibility_information_t<int, double>::view_t infeasibility_information_view);
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class infeasibility_information_t<int64_t, double>;
+#endif
+
 }  // namespace cuopt::linear_programming::detail
@@ -98,6 +98,14 @@ void pdlp_termination_strategy_t<i_t, f_t>::set_relative_dual_tolerance_factor(
   convergence_information_.set_relative_dual_tolerance_factor(dual_tolerance_factor);
 }
 
+template <typename i_t, typename f_t>
+void pdlp_termination_strategy_t<i_t, f_t>::set_quadratic_objective(
+  quadratic_objective_t<i_t, f_t>* quadratic_objective)
+{
+  has_quadratic_objective_ = quadratic_objective != nullptr && !quadratic_objective->empty();
+  convergence_information_.set_quadratic_objective(quadratic_objective);
+}
+
 template <typename i_t, typename f_t>
 void pdlp_termination_strategy_t<i_t, f_t>::set_relative_primal_tolerance_factor(
   f_t primal_tolerance_factor)
@@ -173,7 +181,8 @@ void pdlp_termination_strategy_t<i_t, f_t>::evaluate_termination_criteria(
   rmm::device_uvector<f_t>& delta_dual_iterate,
   i_t total_pdlp_iterations,
   const rmm::device_uvector<f_t>& combined_bounds,
-  const rmm::device_uvector<f_t>& objective_coefficients)
+  const rmm::device_uvector<f_t>& objective_coefficients,
+  bool synchronize)
 {
   raft::common::nvtx::range fun_scope("Evaluate termination criteria");
 
@@ -201,7 +210,7 @@ void pdlp_termination_strategy_t<i_t, f_t>::evaluate_termination_criteria(
   check_termination_criteria();
 
   // Sync to make sure the termination status is updated
-  RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_));
+  if (synchronize) { RAFT_CUDA_TRY(cudaStreamSynchronize(stream_view_)); }
 }
 
 template <typename i_t, typename f_t>
@@ -226,6 +235,7 @@ __global__ void check_termination_criteria_kernel(
   typename pdlp_solver_settings_t<i_t, f_t>::tolerances_t tolerance,
   bool infeasibility_detection,
   bool per_constraint_residual,
+  bool has_quadratic_objective,
   i_t batch_size)
 {
   const int idx = threadIdx.x + blockIdx.x * blockDim.x;
@@ -363,8 +373,9 @@ __global__ void check_termination_criteria_kernel(
 
     // test for dual infeasibility
     //  for QP add && primal_ray_quadratic_norm / (-primal_ray_linear_objective)
-    //  <=eps_dual_infeasible
-    if (infeasibility_information.primal_ray_linear_objective[idx] < f_t(0.0) &&
+    //  <=eps_dual_infeasible, until then it is not tested for QPs
+    if (!has_quadratic_objective &&
+        infeasibility_information.primal_ray_linear_objective[idx] < f_t(0.0) &&
         infeasibility_information.max_primal_ray_infeasibility[idx] /
             -(infeasibility_information.primal_ray_linear_objective[idx]) <=
           tolerance.dual_infeasible_tolerance) {
@@ -415,6 +426,7 @@ void pdlp_termination_strategy_t<i_t, f_t>::check_termination_criteria()
                                                  settings_.tolerances,
                                                  settings_.detect_infeasibility,
                                                  settings_.per_constraint_residual,
+                                                 has_quadratic_objective_,
                                                  climber_strategies_.size());
   RAFT_CUDA_TRY(cudaPeekAtLastError());
 }
@@ -679,6 +691,7 @@ void pdlp_termination_strategy_t<i_t, f_t>::print_termination_criteria(i_t itera
     typename pdlp_solver_settings_t<int, F_TYPE>::tolerances_t tolerances,                     \
     bool infeasibility_detection,                                                              \
     bool per_constraint_residual,                                                              \
+    bool has_quadratic_objective,                                                              \
     int batch_size);
 
 #if MIP_INSTANTIATE_FLOAT
@@ -689,6 +702,10 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class pdlp_termination_strategy_t<int64_t, double>;
+#endif
+
 #undef INSTANTIATE
 
 }  // namespace cuopt::linear_programming::detail
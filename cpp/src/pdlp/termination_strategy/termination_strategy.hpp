@@ -53,7 +53,8 @@ class pdlp_termination_strategy_t {
     i_t total_pdlp_iterations,
     const rmm::device_uvector<f_t>& combined_bounds,  // Only useful if per_constraint_residual
     const rmm::device_uvector<f_t>&
-      objective_coefficients  // Only useful if per_constraint_residual
+      objective_coefficients,  // Only useful if per_constraint_residual
+    bool synchronize = true    // If false, the caller has to sync before reading the status
   );
 
   // Only useful in batch mode to store information of removed climber faster
@@ -138,6 +139,8 @@ class pdlp_termination_strategy_t {
   void set_relative_primal_tolerance_factor(f_t primal_tolerance_factor);
   f_t get_relative_dual_tolerance_factor() const;
   f_t get_relative_primal_tolerance_factor() const;
+  // Unscaled quadratic objective of a QP, the dual infeasibility test is LP only and is skipped
+  void set_quadratic_objective(quadratic_objective_t<i_t, f_t>* quadratic_objective);
 
   pdlp_termination_status_t get_termination_status(i_t id) const;
   std::vector<pdlp_termination_status_t> get_terminations_status();
@@ -189,5 +192,6 @@ class pdlp_termination_strategy_t {
   thrust::universal_host_pinned_vector<i_t> original_index_;
 
   const std::vector<pdlp_climber_strategy_t>& climber_strategies_;
+  bool has_quadratic_objective_{false};
 };
 }  // namespace cuopt::linear_programming::detail
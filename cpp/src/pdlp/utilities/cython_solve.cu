@@ -16,11 +16,18 @@
 #include <mps_parser/writer.hpp>
 #include <utilities/copy_helpers.hpp>
 
+#include <raft/core/device_setter.hpp>
 #include <raft/core/handle.hpp>
 #include <raft/core/nvtx.hpp>
 
 #include <rmm/device_buffer.hpp>
 
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -222,19 +229,13 @@ mip_ret_t call_solve_mip(
   return mip_ret;
 }
 
-std::unique_ptr<solver_ret_t> call_solve(
-  cuopt::mps_parser::data_model_view_t<int, double>* data_model,
+static std::unique_ptr<solver_ret_t> solve_problem(
+  cuopt::linear_programming::optimization_problem_t<int, double>& op_problem,
   cuopt::linear_programming::solver_settings_t<int, double>* solver_settings,
-  unsigned int flags,
   bool is_batch_mode)
 {
-  raft::common::nvtx::range fun_scope("Call Solve");
-  rmm::cuda_stream stream(static_cast<rmm::cuda_stream::flags>(flags));
-  const raft::handle_t handle_{stream};
-
   solver_ret_t response;
 
-  auto op_problem = data_model_to_optimization_problem(data_model, solver_settings, &handle_);
   if (op_problem.get_problem_category() == linear_programming::problem_category_t::LP) {
     response.lp_ret =
       call_solve_lp(op_problem, solver_settings->get_pdlp_settings(), is_batch_mode);
@@ -283,6 +284,155 @@ std::unique_ptr<solver_ret_t> call_solve(
   return std::make_unique<solver_ret_t>(std::move(response));
 }
 
+std::unique_ptr<solver_ret_t> call_solve(
+  cuopt::mps_parser::data_model_view_t<int, double>* data_model,
+  cuopt::linear_programming::solver_settings_t<int, double>* solver_settings,
+  unsigned int flags,
+  bool is_batch_mode)
+{
+  raft::common::nvtx::range fun_scope("Call Solve");
+  rmm::cuda_stream stream(static_cast<rmm::cuda_stream::flags>(flags));
+  const raft::handle_t handle_{stream};
+
+  auto op_problem = data_model_to_optimization_problem(data_model, solver_settings, &handle_);
+  return solve_problem(op_problem, solver_settings, is_batch_mode);
+}
+
+// Returns the section s of a flat problem, checking that it lies in the buffer
+template <typename T>
+static std::pair<const T*, int> flat_section(const void* buffer,
+                                             std::size_t buffer_size,
+                                             const flat_problem_header_t& header,
+                                             flat_problem_section_t s)
+{
+  const uint64_t offset = header.offsets[static_cast<int>(s)];
+  const uint64_t size   = header.sizes[static_cast<int>(s)];
+  if (size == 0) { return {nullptr, 0}; }
+  cuopt_expects(offset % alignof(T) == 0 && offset <= buffer_size &&
+                  size <= (buffer_size - offset) / sizeof(T) &&
+                  size <= std::numeric_limits<int>::max(),
+                error_type_t::ValidationError,
+                "Section %d of the flat problem is out of the buffer",
+                static_cast<int>(s));
+  return {reinterpret_cast<const T*>(static_cast<const char*>(buffer) + offset),
+          static_cast<int>(size)};
+}
+
+static cuopt::mps_parser::data_model_view_t<int, double> flat_problem_view(
+  const void* buffer, std::size_t buffer_size)
+{
+  using section = flat_problem_section_t;
+  using view_t  = cuopt::mps_parser::data_model_view_t<int, double>;
+  cuopt_expects(buffer != nullptr && buffer_size >= sizeof(flat_problem_header_t),
+                error_type_t::ValidationError,
+                "The flat problem buffer is smaller than its header");
+  flat_problem_header_t header;
+  std::memcpy(&header, buffer, sizeof(header));
+  cuopt_expects(std::memcmp(header.magic, flat_problem_magic, sizeof(header.magic)) == 0 &&
+                  header.version == flat_problem_version,
+                error_type_t::ValidationError,
+                "The buffer is not a flat problem of version %u",
+                flat_problem_version);
+
+  auto doubles = [&](section s) { return flat_section<double>(buffer, buffer_size, header, s); };
+  auto ints    = [&](section s) { return flat_section<int>(buffer, buffer_size, header, s); };
+  auto chars   = [&](section s) { return flat_section<char>(buffer, buffer_size, header, s); };
+
+  view_t view;
+  view.set_maximize(header.maximize != 0);
+  view.set_objective_scaling_factor(header.objective_scaling_factor);
+  view.set_objective_offset(header.objective_offset);
+  auto [A_values, nnz]     = doubles(section::constraint_matrix_values);
+  auto [A_indices, n_idx]  = ints(section::constraint_matrix_indices);
+  auto [A_offsets, n_offs] = ints(section::constraint_matrix_offsets);
+  view.set_csr_constraint_matrix(A_values, nnz, A_indices, n_idx, A_offsets, n_offs);
+  auto [Q_values, q_nnz]     = doubles(section::quadratic_objective_values);
+  auto [Q_indices, q_n_idx]  = ints(section::quadratic_objective_indices);
+  auto [Q_offsets, q_n_offs] = ints(section::quadratic_objective_offsets);
+  if (q_nnz != 0) {
+    view.set_quadratic_objective_matrix(Q_values, q_nnz, Q_indices, q_n_idx, Q_offsets, q_n_offs);
+  }
+  // Empty sections are left unset, as in data_model_to_optimization_problem
+  auto set = [&view](auto setter, auto array) {
+    if (array.second != 0) { (view.*setter)(array.first, array.second); }
+  };
+  set(&view_t::set_constraint_bounds, doubles(section::constraint_bounds));
+  set(&view_t::set_objective_coefficients, doubles(section::objective_coefficients));
+  set(&view_t::set_variable_lower_bounds, doubles(section::variable_lower_bounds));
+  set(&view_t::set_variable_upper_bounds, doubles(section::variable_upper_bounds));
+  set(&view_t::set_constraint_lower_bounds, doubles(section::constraint_lower_bounds));
+  set(&view_t::set_constraint_upper_bounds, doubles(section::constraint_upper_bounds));
+  set(&view_t::set_row_types, chars(section::row_types));
+  set(&view_t::set_variable_types, chars(section::variable_types));
+  return view;
+}
+
+std::unique_ptr<solver_ret_t> call_solve_flat(
+  const void* buffer,
+  std::size_t buffer_size,
+  cuopt::linear_programming::solver_settings_t<int, double>* solver_settings,
+  unsigned int flags)
+{
+  raft::common::nvtx::range fun_scope("Call Solve flat");
+  // Below this size the registration costs more than the staged copy saves
+  constexpr std::size_t min_registered_size = 16 << 20;
+
+  auto view = flat_problem_view(buffer, buffer_size);
+  rmm::cuda_stream stream(static_cast<rmm::cuda_stream::flags>(flags));
+  const raft::handle_t handle_{stream};
+
+  bool registered = false;
+  if (buffer_size >= min_registered_size) {
+    registered = cudaHostRegister(
+                   const_cast<void*>(buffer), buffer_size, cudaHostRegisterDefault) == cudaSuccess;
+    if (!registered) { cudaGetLastError(); }
+  }
+  std::optional<cuopt::linear_programming::optimization_problem_t<int, double>> op_problem;
+  try {
+    op_problem.emplace(data_model_to_optimization_problem(&view, solver_settings, &handle_));
+    // The copies from a registered buffer are asynchronous
+    handle_.sync_stream();
+  } catch (...) {
+    if (registered) {
+      RAFT_CUDA_TRY_NO_THROW(cudaStreamSynchronize(stream.value()));
+      RAFT_CUDA_TRY_NO_THROW(cudaHostUnregister(const_cast<void*>(buffer)));
+    }
+    throw;
+  }
+  if (registered) { RAFT_CUDA_TRY(cudaHostUnregister(const_cast<void*>(buffer))); }
+  return solve_problem(*op_problem, solver_settings, false);
+}
+
+// Replaces the buffers of a result solved on the current device by copies on the given device,
+// on which the caller reads them. The buffers of the current device are released on it
+static void move_to_device(solver_ret_t& ret, int device)
+{
+  auto& lp_ret = ret.lp_ret;
+  for (auto* buffer : {&lp_ret.primal_solution_,
+                       &lp_ret.dual_solution_,
+                       &lp_ret.reduced_cost_,
+                       &lp_ret.current_primal_solution_,
+                       &lp_ret.current_dual_solution_,
+                       &lp_ret.initial_primal_average_,
+                       &lp_ret.initial_dual_average_,
+                       &lp_ret.current_ATY_,
+                       &lp_ret.sum_primal_solutions_,
+                       &lp_ret.sum_dual_solutions_,
+                       &lp_ret.last_restart_duality_gap_primal_solution_,
+                       &lp_ret.last_restart_duality_gap_dual_solution_,
+                       &ret.mip_ret.solution_}) {
+    if (*buffer == nullptr) { continue; }
+    std::unique_ptr<rmm::device_buffer> copy;
+    {
+      raft::device_setter device_guard{device};
+      copy = std::make_unique<rmm::device_buffer>(
+        (*buffer)->data(), (*buffer)->size(), rmm::cuda_stream_per_thread);
+      rmm::cuda_stream_per_thread.synchronize();
+    }
+    *buffer = std::move(copy);
+  }
+}
+
 static int compute_max_thread(
   const std::vector<cuopt::mps_parser::data_model_view_t<int, double>*>& data_models)
 {
@@ -326,7 +476,7 @@ std::pair<std::vector<std::unique_ptr<solver_ret_t>>, double> call_batch_solve(
 
   auto start_solver = std::chrono::high_resolution_clock::now();
 
-  // Limit parallelism as too much stream overlap gets too slow
+  // Limit parallelism on each device as too much stream overlap gets too slow
   const int max_thread = compute_max_thread(data_models);
 
   if (solver_settings->get_parameter<int>(CUOPT_METHOD) == CUOPT_METHOD_CONCURRENT) {
@@ -339,9 +489,44 @@ std::pair<std::vector<std::unique_ptr<solver_ret_t>>, double> call_batch_solve(
 
   const bool is_batch_mode = true;
 
-#pragma omp parallel for num_threads(max_thread)
-  for (std::size_t i = 0; i < size; ++i)
-    list[i] = call_solve(data_models[i], solver_settings, cudaStreamNonBlocking, is_batch_mode);
+  // The problems are spread over all the visible devices, max_thread at a time on each of them.
+  // Each worker picks the next problem not yet taken, so a few long problems don't hold up the
+  // others, and stores its result at the submission index
+  const int calling_device = raft::device_setter::get_current_device();
+  const int device_count   = raft::device_setter::get_device_count();
+  const int n_devices      = std::min<int>(device_count, size);
+  const int n_workers      = std::min<int>(size, n_devices * max_thread);
+  std::atomic<std::size_t> next_problem{0};
+  std::vector<std::exception_ptr> errors(n_workers);
+  std::vector<std::thread> workers;
+  workers.reserve(n_workers);
+  for (int w = 0; w < n_workers; ++w) {
+    const int device = (calling_device + w % n_devices) % device_count;
+    workers.emplace_back([&, w, device]() {
+      try {
+        raft::device_setter device_guard{device};
+        // The data models may be in the memory of the calling device, without peer access they
+        // are still copied, through the host
+        if (device != calling_device &&
+            cudaDeviceEnablePeerAccess(calling_device, 0) != cudaSuccess) {
+          cudaGetLastError();
+        }
+        for (std::size_t i = next_problem++; i < size; i = next_problem++) {
+          list[i] =
+            call_solve(data_models[i], solver_settings, cudaStreamNonBlocking, is_batch_mode);
+          if (device != calling_device) { move_to_device(*list[i], calling_device); }
+        }
+      } catch (...) {
+        errors[w] = std::current_exception();
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
 
   auto end      = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start_solver);
@@ -0,0 +1,325 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <pdlp/pdlp_constants.hpp>
+
+#include <utilities/copy_helpers.hpp>
+#include <utilities/macros.cuh>
+
+#include <raft/core/device_span.hpp>
+#include <raft/util/cuda_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/cub.cuh>
+
+#include <cuda/cmath>
+
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+// Rows longer than this (and much longer than the average row) are split across several blocks
+// instead of being handled by a single logical warp
+inline constexpr int fused_spmv_heavy_row_min_length = 32 * block_size;
+inline constexpr int fused_spmv_heavy_row_avg_factor = 32;
+// Number of nonzeros of a heavy row reduced by one block
+inline constexpr int fused_spmv_heavy_chunk_size = 8 * block_size;
+
+// Row-length statistics based split of a CSR matrix for fused_csr_spmv.
+// Skewed matrices (a few rows with millions of nonzeros, the rest with a handful) leave one warp
+// working on the long rows while all the others are idle. Heavy rows are cut in chunks, each chunk
+// being reduced by its own block (merge-path like), the partial sums are then combined before
+// calling the epilogue.
+// Built once since the sparsity pattern never changes during PDLP. If no row is heavy, nothing
+// extra is launched.
+template <typename i_t, typename f_t>
+struct fused_spmv_row_split_t {
+  explicit fused_spmv_row_split_t(rmm::cuda_stream_view stream_view)
+    : heavy_rows(0, stream_view),
+      heavy_row_chunk_offsets(0, stream_view),
+      chunk_heavy_row(0, stream_view),
+      chunk_begin(0, stream_view),
+      chunk_partial_sums(0, stream_view)
+  {
+  }
+
+  fused_spmv_row_split_t(raft::device_span<const i_t> offsets,
+                         i_t n_rows,
+                         rmm::cuda_stream_view stream_view)
+    : fused_spmv_row_split_t(stream_view)
+  {
+    if (n_rows == 0) { return; }
+    const auto h_offsets    = host_copy(offsets.data(), offsets.size(), stream_view);
+    const size_t nnz        = h_offsets[n_rows] - h_offsets[0];
+    const size_t avg_length = nnz / static_cast<size_t>(n_rows);
+    heavy_row_threshold     = static_cast<i_t>(std::max<size_t>(
+      fused_spmv_heavy_row_min_length, fused_spmv_heavy_row_avg_factor * avg_length));
+
+    std::vector<i_t> h_heavy_rows;
+    std::vector<i_t> h_heavy_row_chunk_offsets{0};
+    std::vector<i_t> h_chunk_heavy_row;
+    std::vector<i_t> h_chunk_begin;
+    size_t heavy_nnz = 0;
+    for (i_t row = 0; row < n_rows; ++row) {
+      const i_t length = h_offsets[row + 1] - h_offsets[row];
+      if (length <= heavy_row_threshold) { continue; }
+      heavy_nnz += length;
+      for (i_t begin = h_offsets[row]; begin < h_offsets[row + 1];
+           begin += fused_spmv_heavy_chunk_size) {
+        h_chunk_heavy_row.push_back(static_cast<i_t>(h_heavy_rows.size()));
+        h_chunk_begin.push_back(begin);
+      }
+      h_heavy_rows.push_back(row);
+      h_heavy_row_chunk_offsets.push_back(static_cast<i_t>(h_chunk_begin.size()));
+    }
+    const size_t n_light_rows = n_rows - h_heavy_rows.size();
+    light_average_row_length  = n_light_rows == 0 ? 0 : (nnz - heavy_nnz) / n_light_rows;
+    if (h_heavy_rows.empty()) { return; }
+
+    heavy_rows              = device_copy(h_heavy_rows, stream_view);
+    heavy_row_chunk_offsets = device_copy(h_heavy_row_chunk_offsets, stream_view);
+    chunk_heavy_row         = device_copy(h_chunk_heavy_row, stream_view);
+    chunk_begin             = device_copy(h_chunk_begin, stream_view);
+    chunk_partial_sums.resize(h_chunk_begin.size(), stream_view);
+    // Host vectors go out of scope
+    stream_view.synchronize();
+  }
+
+  bool has_heavy_rows() const { return heavy_rows.size() > 0; }
+
+  i_t heavy_row_threshold{std::numeric_limits<i_t>::max()};
+  size_t light_average_row_length{0};
+  rmm::device_uvector<i_t> heavy_rows;
+  // Chunks of heavy_rows[h] are [heavy_row_chunk_offsets[h], heavy_row_chunk_offsets[h + 1])
+  rmm::device_uvector<i_t> heavy_row_chunk_offsets;
+  rmm::device_uvector<i_t> chunk_heavy_row;
+  rmm::device_uvector<i_t> chunk_begin;
+  rmm::device_uvector<f_t> chunk_partial_sums;
+};
+
+// Values of a matrix whose nonzeros are all +1 or -1, stored as one bit per nonzero set for -1.
+// The SpMV then streams the column indices and 1/32 of a word per nonzero instead of a full value.
+struct sign_values_t {
+  raft::device_span<const uint32_t> negative;
+
+  __device__ float operator[](size_t j) const
+  {
+    return (negative[j / 32] >> (j % 32)) & 1u ? -1.0f : 1.0f;
+  }
+};
+
+// Sign mask of sign_values_t for the given values, assumed to be nonzero
+template <typename f_t>
+rmm::device_uvector<uint32_t> make_sign_mask(raft::device_span<const f_t> values,
+                                             rmm::cuda_stream_view stream_view)
+{
+  rmm::device_uvector<uint32_t> negative(cuda::ceil_div(values.size(), size_t{32}), stream_view);
+  thrust::tabulate(rmm::exec_policy(stream_view),
+                   negative.begin(),
+                   negative.end(),
+                   [values] __device__(size_t word) {
+                     uint32_t bits    = 0;
+                     const size_t end = min(values.size(), (word + 1) * 32);
+                     for (size_t j = word * 32; j < end; ++j) {
+                       if (values[j] < f_t(0)) { bits |= 1u << (j % 32); }
+                     }
+                     return bits;
+                   });
+  return negative;
+}
+
+// Multiplies the dot product by row_scaling[row] before calling the wrapped epilogue.
+// Used with sign_values_t on a scaled matrix D_r S D_c, S being the sign pattern: x is scaled by
+// D_c beforehand and D_r is applied here.
+template <typename f_t, typename epilogue_t>
+struct row_scaled_epilogue_t {
+  const f_t* row_scaling;
+  epilogue_t epilogue;
+
+  template <typename i_t>
+  DI void operator()(i_t row, f_t dot)
+  {
+    epilogue(row, row_scaling[row] * dot);
+  }
+};
+
+// Row-parallel CSR SpMV where each row is handled by a logical warp of LOGICAL_WARP threads.
+// Once the row dot product is reduced, the first lane of the logical warp calls
+// epilogue(row, dot) which is expected to write both the SpMV result and whatever is derived
+// from it (projection, reflection...).
+// This allows to fuse the SpMV with the element-wise projection that typically follows it in
+// PDHG so that the row result never has to be re-read from global memory by a second kernel.
+// Matrix values can be stored in a lower precision than the vectors, or only as signs (see
+// sign_values_t), values only has to be indexable like a span. Accumulation is always done in f_t.
+// Rows longer than heavy_row_threshold are skipped, they are handled by the heavy row kernels.
+template <int LOGICAL_WARP, typename i_t, typename values_t, typename f_t, typename epilogue_t>
+__global__ void __launch_bounds__(block_size)
+  fused_csr_spmv_kernel(raft::device_span<const i_t> offsets,
+                        raft::device_span<const i_t> indices,
+                        values_t values,
+                        const f_t* __restrict__ x,
+                        i_t n_rows,
+                        i_t heavy_row_threshold,
+                        epilogue_t epilogue)
+{
+  static_assert(block_size % LOGICAL_WARP == 0, "Block size must be a multiple of the warp size");
+  constexpr int rows_per_block = block_size / LOGICAL_WARP;
+  using warp_reduce_t          = cub::WarpReduce<f_t, LOGICAL_WARP>;
+  __shared__ typename warp_reduce_t::TempStorage temp_storage[rows_per_block];
+
+  const int group = threadIdx.x / LOGICAL_WARP;
+  const int lane  = threadIdx.x % LOGICAL_WARP;
+  const i_t row   = static_cast<i_t>(blockIdx.x) * rows_per_block + group;
+  // Whole logical warps exit together, the warp reduce below stays well defined
+  if (row >= n_rows) { return; }
+
+  const i_t row_start = offsets[row];
+  const i_t row_end   = offsets[row + 1];
+  if (row_end - row_start > heavy_row_threshold) { return; }
+  f_t dot = f_t(0);
+  for (i_t j = row_start + lane; j < row_end; j += LOGICAL_WARP) {
+    dot += static_cast<f_t>(values[j]) * x[indices[j]];
+  }
+  dot = warp_reduce_t(temp_storage[group]).Sum(dot);
+  if (lane == 0) { epilogue(row, dot); }
+}
+
+// One block per chunk of fused_spmv_heavy_chunk_size nonzeros of a heavy row
+template <typename i_t, typename values_t, typename f_t>
+__global__ void __launch_bounds__(block_size)
+  fused_csr_spmv_heavy_chunk_kernel(raft::device_span<const i_t> offsets,
+                                    raft::device_span<const i_t> indices,
+                                    values_t values,
+                                    const f_t* __restrict__ x,
+                                    raft::device_span<const i_t> heavy_rows,
+                                    raft::device_span<const i_t> chunk_heavy_row,
+                                    raft::device_span<const i_t> chunk_begin,
+                                    raft::device_span<f_t> chunk_partial_sums)
+{
+  using block_reduce_t = cub::BlockReduce<f_t, block_size>;
+  __shared__ typename block_reduce_t::TempStorage temp_storage;
+
+  const i_t chunk   = blockIdx.x;
+  const i_t row     = heavy_rows[chunk_heavy_row[chunk]];
+  const i_t row_end = offsets[row + 1];
+  const i_t begin   = chunk_begin[chunk];
+  const i_t end     = min(begin + fused_spmv_heavy_chunk_size, row_end);
+  f_t dot           = f_t(0);
+  for (i_t j = begin + threadIdx.x; j < end; j += block_size) {
+    dot += static_cast<f_t>(values[j]) * x[indices[j]];
+  }
+  dot = block_reduce_t(temp_storage).Sum(dot);
+  if (threadIdx.x == 0) { chunk_partial_sums[chunk] = dot; }
+}
+
+// One warp per heavy row, combines the chunk partial sums and calls the epilogue
+template <typename i_t, typename f_t, typename epilogue_t>
+__global__ void __launch_bounds__(block_size)
+  fused_csr_spmv_heavy_epilogue_kernel(raft::device_span<const i_t> heavy_rows,
+                                       raft::device_span<const i_t> heavy_row_chunk_offsets,
+                                       raft::device_span<const f_t> chunk_partial_sums,
+                                       epilogue_t epilogue)
+{
+  constexpr int rows_per_block = block_size / raft::WarpSize;
+  using warp_reduce_t          = cub::WarpReduce<f_t>;
+  __shared__ typename warp_reduce_t::TempStorage temp_storage[rows_per_block];
+
+  const int group = threadIdx.x / raft::WarpSize;
+  const int lane  = threadIdx.x % raft::WarpSize;
+  const i_t h     = static_cast<i_t>(blockIdx.x) * rows_per_block + group;
+  if (h >= static_cast<i_t>(heavy_rows.size())) { return; }
+
+  f_t dot = f_t(0);
+  for (i_t c = heavy_row_chunk_offsets[h] + lane; c < heavy_row_chunk_offsets[h + 1];
+       c += raft::WarpSize) {
+    dot += chunk_partial_sums[c];
+  }
+  dot = warp_reduce_t(temp_storage[group]).Sum(dot);
+  if (lane == 0) { epilogue(heavy_rows[h], dot); }
+}
+
+template <int LOGICAL_WARP, typename i_t, typename values_t, typename f_t, typename epilogue_t>
+void launch_fused_csr_spmv(raft::device_span<const i_t> offsets,
+                           raft::device_span<const i_t> indices,
+                           values_t values,
+                           const f_t* x,
+                           i_t n_rows,
+                           i_t heavy_row_threshold,
+                           epilogue_t epilogue,
+                           rmm::cuda_stream_view stream_view)
+{
+  constexpr int rows_per_block = block_size / LOGICAL_WARP;
+  const auto grid_size         = cuda::ceil_div(static_cast<size_t>(n_rows), rows_per_block);
+  fused_csr_spmv_kernel<LOGICAL_WARP, i_t, values_t, f_t, epilogue_t>
+    <<<grid_size, block_size, 0, stream_view>>>(
+      offsets, indices, values, x, n_rows, heavy_row_threshold, epilogue);
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+}
+
+// Computes y = A @ x on the CSR matrix (offsets, indices, values) and fuses epilogue(row, y[row])
+// into the same pass.
+// The logical warp size is picked from the average (light) row length so that short rows do not
+// leave most of a warp idle. Heavy rows found in row_split are spread over several blocks, their
+// epilogue is called by a second kernel.
+template <typename i_t, typename values_t, typename f_t, typename epilogue_t>
+void fused_csr_spmv(raft::device_span<const i_t> offsets,
+                    raft::device_span<const i_t> indices,
+                    values_t values,
+                    const f_t* x,
+                    i_t n_rows,
+                    fused_spmv_row_split_t<i_t, f_t>& row_split,
+                    epilogue_t epilogue,
+                    rmm::cuda_stream_view stream_view)
+{
+  if (n_rows == 0) { return; }
+  const size_t average_row_length = row_split.light_average_row_length;
+  const i_t threshold             = row_split.heavy_row_threshold;
+  if (average_row_length <= 4) {
+    launch_fused_csr_spmv<4>(offsets, indices, values, x, n_rows, threshold, epilogue, stream_view);
+  } else if (average_row_length <= 8) {
+    launch_fused_csr_spmv<8>(offsets, indices, values, x, n_rows, threshold, epilogue, stream_view);
+  } else if (average_row_length <= 16) {
+    launch_fused_csr_spmv<16>(
+      offsets, indices, values, x, n_rows, threshold, epilogue, stream_view);
+  } else {
+    launch_fused_csr_spmv<raft::WarpSize>(
+      offsets, indices, values, x, n_rows, threshold, epilogue, stream_view);
+  }
+
+  if (!row_split.has_heavy_rows()) { return; }
+  fused_csr_spmv_heavy_chunk_kernel<i_t, values_t, f_t>
+    <<<row_split.chunk_begin.size(), block_size, 0, stream_view>>>(
+      offsets,
+      indices,
+      values,
+      x,
+      make_span(row_split.heavy_rows),
+      make_span(row_split.chunk_heavy_row),
+      make_span(row_split.chunk_begin),
+      make_span(row_split.chunk_partial_sums));
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+  constexpr int heavy_rows_per_block = block_size / raft::WarpSize;
+  const auto heavy_grid_size =
+    cuda::ceil_div(row_split.heavy_rows.size(), static_cast<size_t>(heavy_rows_per_block));
+  fused_csr_spmv_heavy_epilogue_kernel<i_t, f_t, epilogue_t>
+    <<<heavy_grid_size, block_size, 0, stream_view>>>(make_span(row_split.heavy_rows),
+                                                      make_span(row_split.heavy_row_chunk_offsets),
+                                                      make_span(row_split.chunk_partial_sums),
+                                                      epilogue);
+  RAFT_CUDA_TRY(cudaPeekAtLastError());
+}
+
+}  // namespace cuopt::linear_programming::detail
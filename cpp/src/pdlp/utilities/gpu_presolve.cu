@@ -0,0 +1,176 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "gpu_presolve.cuh"
+
+#include <mip_heuristics/mip_constants.hpp>
+#include <mip_heuristics/presolve/trivial_presolve.cuh>
+#include <pdlp/utils.cuh>
+#include <utilities/copy_helpers.hpp>
+#include <utilities/logger.hpp>
+
+#include <raft/core/nvtx.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/scatter.h>
+
+#include <cmath>
+
+namespace cuopt::linear_programming::detail {
+
+template <typename i_t, typename f_t>
+gpu_lp_presolve_t<i_t, f_t>::gpu_lp_presolve_t(const optimization_problem_t<i_t, f_t>& op_problem)
+  : op_problem_(op_problem),
+    variable_mapping_(0, op_problem.get_handle_ptr()->get_stream()),
+    constraint_mapping_(0, op_problem.get_handle_ptr()->get_stream()),
+    fixed_var_assignment_(0, op_problem.get_handle_ptr()->get_stream())
+{
+}
+
+template <typename i_t, typename f_t>
+bool gpu_lp_presolve_t<i_t, f_t>::apply(problem_t<i_t, f_t>& problem)
+{
+  raft::common::nvtx::range fun_scope("gpu_lp_presolve");
+  auto handle_ptr = problem.handle_ptr;
+  auto stream     = handle_ptr->get_stream();
+
+  problem_t<i_t, f_t> reduced(problem);
+  reduced.presolve_data.initialize_var_mapping(reduced, handle_ptr);
+  // Only exactly fixed variables are removed, an LP has no integrality slack to absorb
+  reduced.tolerances.integrality_tolerance = f_t(0);
+  update_from_csr(reduced, false);
+  reduced.tolerances.integrality_tolerance = problem.tolerances.integrality_tolerance;
+
+  if (reduced.n_variables == problem.n_variables &&
+      reduced.n_constraints == problem.n_constraints) {
+    CUOPT_LOG_INFO("GPU presolve found no reduction");
+    return false;
+  }
+  // PDLP cannot run on an empty problem, let the original problem go through
+  if (reduced.n_variables == 0 || reduced.n_constraints == 0) {
+    CUOPT_LOG_INFO("GPU presolve removed the whole problem, solving the original problem");
+    return false;
+  }
+  // An empty column whose objective pushes it to an infinite bound has no finite assignment
+  const bool finite_assignment =
+    std::isfinite(reduced.presolve_data.objective_offset) &&
+    thrust::all_of(handle_ptr->get_thrust_policy(),
+                   reduced.presolve_data.fixed_var_assignment.begin(),
+                   reduced.presolve_data.fixed_var_assignment.end(),
+                   [] __device__(f_t value) { return isfinite(value); });
+  if (!finite_assignment) {
+    CUOPT_LOG_INFO("GPU presolve found an unbounded empty column, solving the original problem");
+    return false;
+  }
+
+  reduced.compute_auxiliary_data();
+  combine_constraint_bounds<i_t, f_t>(reduced, reduced.combined_bounds);
+  cuopt_func_call(reduced.check_problem_representation(true, false));
+
+  auto& presolve_data   = reduced.presolve_data;
+  variable_mapping_     = rmm::device_uvector<i_t>(presolve_data.variable_mapping, stream);
+  constraint_mapping_   = rmm::device_uvector<i_t>(presolve_data.constraint_mapping, stream);
+  fixed_var_assignment_ = rmm::device_uvector<f_t>(presolve_data.fixed_var_assignment, stream);
+
+  CUOPT_LOG_INFO("GPU presolve removed %d rows and %d columns",
+                 problem.n_constraints - reduced.n_constraints,
+                 problem.n_variables - reduced.n_variables);
+  problem = std::move(reduced);
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void gpu_lp_presolve_t<i_t, f_t>::undo(rmm::device_uvector<f_t>& primal_solution,
+                                       rmm::device_uvector<f_t>& dual_solution,
+                                       rmm::device_uvector<f_t>& reduced_costs,
+                                       rmm::cuda_stream_view stream_view) const
+{
+  raft::common::nvtx::range fun_scope("gpu_lp_undo");
+  const i_t n_variables   = op_problem_.get_n_variables();
+  const i_t n_constraints = op_problem_.get_n_constraints();
+  auto policy             = rmm::exec_policy(stream_view);
+
+  // Nothing to map back if the solver did not return a solution of the reduced problem
+  if (primal_solution.size() != variable_mapping_.size() ||
+      dual_solution.size() != constraint_mapping_.size() ||
+      reduced_costs.size() != variable_mapping_.size()) {
+    return;
+  }
+
+  rmm::device_uvector<f_t> full_primal(fixed_var_assignment_, stream_view);
+  thrust::scatter(policy,
+                  primal_solution.begin(),
+                  primal_solution.end(),
+                  variable_mapping_.begin(),
+                  full_primal.begin());
+
+  rmm::device_uvector<f_t> full_dual(n_constraints, stream_view);
+  thrust::fill(policy, full_dual.begin(), full_dual.end(), f_t(0));
+  thrust::scatter(policy,
+                  dual_solution.begin(),
+                  dual_solution.end(),
+                  constraint_mapping_.begin(),
+                  full_dual.begin());
+
+  // Removed variables: c_j - A_j^T y, kept variables: reduced costs returned by the solver
+  rmm::device_uvector<i_t> is_kept(n_variables, stream_view);
+  thrust::fill(policy, is_kept.begin(), is_kept.end(), 0);
+  thrust::scatter(policy,
+                  thrust::make_constant_iterator<i_t>(1),
+                  thrust::make_constant_iterator<i_t>(1) + variable_mapping_.size(),
+                  variable_mapping_.begin(),
+                  is_kept.begin());
+  rmm::device_uvector<f_t> full_reduced_costs(op_problem_.get_objective_coefficients(),
+                                              stream_view);
+  thrust::for_each(policy,
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n_constraints),
+                   [offsets = make_span(op_problem_.get_constraint_matrix_offsets()),
+                    indices = make_span(op_problem_.get_constraint_matrix_indices()),
+                    values  = make_span(op_problem_.get_constraint_matrix_values()),
+                    is_kept = make_span(is_kept),
+                    dual    = make_span(full_dual),
+                    reduced = make_span(full_reduced_costs)] __device__(i_t row) {
+                     const f_t y = dual[row];
+                     if (y == f_t(0)) { return; }
+                     for (i_t k = offsets[row]; k < offsets[row + 1]; ++k) {
+                       const i_t col = indices[k];
+                       if (!is_kept[col]) { atomicAdd(&reduced[col], -values[k] * y); }
+                     }
+                   });
+  thrust::scatter(policy,
+                  reduced_costs.begin(),
+                  reduced_costs.end(),
+                  variable_mapping_.begin(),
+                  full_reduced_costs.begin());
+  RAFT_CHECK_CUDA(stream_view);
+
+  primal_solution = std::move(full_primal);
+  dual_solution   = std::move(full_dual);
+  reduced_costs   = std::move(full_reduced_costs);
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template class gpu_lp_presolve_t<int, float>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template class gpu_lp_presolve_t<int, double>;
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class gpu_lp_presolve_t<int64_t, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,45 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/optimization_problem.hpp>
+#include <mip_heuristics/problem/problem.cuh>
+
+#include <rmm/device_uvector.hpp>
+
+namespace cuopt::linear_programming::detail {
+
+// GPU presolve for LP, built on the MIP trivial presolve kernels
+// Removes fixed variables, empty columns and the rows left without any free variable, entirely on
+// the device. The reduced to original maps are kept on the device so postsolve is a few scatters
+// and no host round trip is needed on either side of the solve
+template <typename i_t, typename f_t>
+class gpu_lp_presolve_t {
+ public:
+  explicit gpu_lp_presolve_t(const optimization_problem_t<i_t, f_t>& op_problem);
+
+  // Reduces problem in place. Returns false, leaving problem untouched, if nothing was removed or
+  // if the reduction cannot be postsolved (an empty column with an unbounded optimal value or a
+  // fully reduced problem)
+  bool apply(problem_t<i_t, f_t>& problem);
+
+  // Maps a solution of the reduced problem back to the original problem
+  // Removed rows get a zero dual and removed variables get the reduced cost c_j - A_j^T y
+  void undo(rmm::device_uvector<f_t>& primal_solution,
+            rmm::device_uvector<f_t>& dual_solution,
+            rmm::device_uvector<f_t>& reduced_costs,
+            rmm::cuda_stream_view stream_view) const;
+
+ private:
+  const optimization_problem_t<i_t, f_t>& op_problem_;
+  rmm::device_uvector<i_t> variable_mapping_;
+  rmm::device_uvector<i_t> constraint_mapping_;
+  rmm::device_uvector<f_t> fixed_var_assignment_;
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,91 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "method_selection.cuh"
+
+#include <mip_heuristics/mip_constants.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <algorithm>
+
+namespace cuopt::linear_programming::detail {
+
+namespace {
+
+// Thresholds of the selection, to be refit when the benchmark suite moves
+// Up to this many nonzeros dual simplex finishes before the GPU methods are set up
+constexpr int64_t small_nnz = 100'000;
+// From this many nonzeros the factorizations of barrier and dual simplex become the bottleneck
+constexpr int64_t large_nnz = 20'000'000;
+// Column length from which barrier handles a column as dense, see find_dense_columns
+constexpr int64_t dense_column_length = 300;
+// Barrier is picked on its own only for rows of comparable lengths: long rows fill the factor
+constexpr double max_barrier_row_length_skew = 50.0;
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+lp_features_t compute_lp_features(const problem_t<i_t, f_t>& problem)
+{
+  auto stream         = problem.handle_ptr->get_stream();
+  auto row_offsets    = cuopt::host_copy(problem.offsets, stream);
+  auto column_offsets = cuopt::host_copy(problem.reverse_offsets, stream);
+
+  lp_features_t features;
+  features.n_rows       = problem.n_constraints;
+  features.n_columns    = problem.n_variables;
+  features.nnz          = problem.nnz;
+  features.has_integers = problem.n_integer_vars > 0;
+  if (features.n_rows > 0 && features.n_columns > 0) {
+    features.density = double(features.nnz) / (double(features.n_rows) * features.n_columns);
+  }
+  int64_t max_row_length = 0;
+  for (size_t i = 0; i + 1 < row_offsets.size(); ++i) {
+    max_row_length = std::max<int64_t>(max_row_length, row_offsets[i + 1] - row_offsets[i]);
+  }
+  if (features.nnz > 0) {
+    features.row_length_skew = max_row_length * double(features.n_rows) / features.nnz;
+  }
+  for (size_t j = 0; j + 1 < column_offsets.size(); ++j) {
+    if (column_offsets[j + 1] - column_offsets[j] >= dense_column_length) {
+      ++features.n_dense_columns;
+    }
+  }
+  return features;
+}
+
+method_t select_lp_method(const lp_features_t& features)
+{
+  if (features.nnz <= small_nnz) { return method_t::DualSimplex; }
+  if (features.nnz >= large_nnz) { return method_t::PDLP; }
+  if (features.n_dense_columns == 0 && features.row_length_skew <= max_barrier_row_length_skew) {
+    return method_t::Barrier;
+  }
+  return method_t::Concurrent;
+}
+
+const char* method_name(method_t method)
+{
+  switch (method) {
+    case method_t::Concurrent: return "Concurrent";
+    case method_t::PDLP: return "PDLP";
+    case method_t::DualSimplex: return "Dual Simplex";
+    case method_t::Barrier: return "Barrier";
+    case method_t::Automatic: return "Automatic";
+  }
+  return "Unknown";
+}
+
+#if MIP_INSTANTIATE_FLOAT
+template lp_features_t compute_lp_features(const problem_t<int, float>& problem);
+#endif
+
+#if MIP_INSTANTIATE_DOUBLE
+template lp_features_t compute_lp_features(const problem_t<int, double>& problem);
+#endif
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,38 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/pdlp/solver_settings.hpp>
+#include <mip_heuristics/problem/problem.cuh>
+
+namespace cuopt::linear_programming::detail {
+
+// Structural features of an LP, cheap to compute from the row and column offsets of A
+struct lp_features_t {
+  int64_t n_rows{0};
+  int64_t n_columns{0};
+  int64_t nnz{0};
+  double density{0};
+  // Ratio of the longest row to the average row length
+  double row_length_skew{0};
+  // Columns long enough to be treated as dense by barrier, they fill the normal equations
+  int64_t n_dense_columns{0};
+  bool has_integers{false};
+};
+
+template <typename i_t, typename f_t>
+lp_features_t compute_lp_features(const problem_t<i_t, f_t>& problem);
+
+// Picks the LP method of CUOPT_METHOD_AUTOMATIC from the features of the problem
+// Clear cases get a single method: dual simplex for small problems, barrier for sparse problems
+// without dense columns, PDLP for very large ones. The others fall back to the concurrent race
+method_t select_lp_method(const lp_features_t& features);
+
+const char* method_name(method_t method);
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,110 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/utilities/phase_timers.cuh>
+
+#include <utilities/macros.cuh>
+
+#include <raft/core/error.hpp>
+
+namespace cuopt::linear_programming::detail {
+
+pdlp_phase_timers_t::pdlp_phase_timers_t(rmm::cuda_stream_view stream_view, bool enabled)
+  : stream_view_(stream_view), enabled_(enabled)
+{
+}
+
+pdlp_phase_timers_t::~pdlp_phase_timers_t()
+{
+  auto destroy = [](const event_pair_t& pair) {
+    RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(pair.start));
+    RAFT_CUDA_TRY_NO_THROW(cudaEventDestroy(pair.stop));
+  };
+  for (int phase = 0; phase < phase_count; ++phase) {
+    if (running_[phase]) { destroy(current_[phase]); }
+    for (const auto& pair : pending_[phase]) {
+      destroy(pair);
+    }
+    for (const auto& pair : free_[phase]) {
+      destroy(pair);
+    }
+  }
+}
+
+bool pdlp_phase_timers_t::is_enabled() const { return enabled_; }
+
+pdlp_phase_timers_t::event_pair_t pdlp_phase_timers_t::acquire(int phase)
+{
+  if (!free_[phase].empty()) {
+    const auto pair = free_[phase].back();
+    free_[phase].pop_back();
+    return pair;
+  }
+  event_pair_t pair;
+  RAFT_CUDA_TRY(cudaEventCreate(&pair.start));
+  RAFT_CUDA_TRY(cudaEventCreate(&pair.stop));
+  return pair;
+}
+
+void pdlp_phase_timers_t::harvest(int phase, bool blocking)
+{
+  auto& pending = pending_[phase];
+  while (!pending.empty()) {
+    const auto& pair = pending.front();
+    if (blocking) {
+      RAFT_CUDA_TRY(cudaEventSynchronize(pair.stop));
+    } else {
+      const cudaError_t status = cudaEventQuery(pair.stop);
+      if (status == cudaErrorNotReady) { break; }
+      RAFT_CUDA_TRY(status);
+    }
+    float ms = 0;
+    RAFT_CUDA_TRY(cudaEventElapsedTime(&ms, pair.start, pair.stop));
+    elapsed_ms_[phase] += ms;
+    free_[phase].push_back(pair);
+    pending.pop_front();
+  }
+}
+
+void pdlp_phase_timers_t::start(phase_t phase)
+{
+  if (!enabled_) { return; }
+  const int id = static_cast<int>(phase);
+  cuopt_assert(!running_[id], "Phase timer started twice");
+
+  harvest(id, false);
+  if (pending_[id].size() >= max_pending_events) {
+    // GPU is far behind the host, wait on the oldest pair to keep the event pool bounded
+    RAFT_CUDA_TRY(cudaEventSynchronize(pending_[id].front().stop));
+    harvest(id, false);
+  }
+
+  current_[id] = acquire(id);
+  running_[id] = true;
+  RAFT_CUDA_TRY(cudaEventRecord(current_[id].start, stream_view_.value()));
+}
+
+void pdlp_phase_timers_t::stop(phase_t phase)
+{
+  if (!enabled_) { return; }
+  const int id = static_cast<int>(phase);
+  cuopt_assert(running_[id], "Phase timer stopped without being started");
+
+  RAFT_CUDA_TRY(cudaEventRecord(current_[id].stop, stream_view_.value()));
+  pending_[id].push_back(current_[id]);
+  running_[id] = false;
+}
+
+double pdlp_phase_timers_t::get_elapsed_seconds(phase_t phase)
+{
+  if (!enabled_) { return 0.0; }
+  const int id = static_cast<int>(phase);
+  harvest(id, true);
+  return elapsed_ms_[id] / 1000.0;
+}
+
+}  // namespace cuopt::linear_programming::detail
@@ -0,0 +1,63 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <deque>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+// Accumulates the GPU time spent in each phase of the PDLP loop using CUDA events
+// Events are recorded around the host calls of each phase (never inside a graph capture) and only
+// read back once the GPU has reached them, so timing adds no synchronization to the loop
+// Disabled timers are a no-op
+class pdlp_phase_timers_t {
+ public:
+  enum class phase_t : int { PdhgStep = 0, StepSize, Restart, TerminationCheck, Count };
+
+  pdlp_phase_timers_t(rmm::cuda_stream_view stream_view, bool enabled);
+  ~pdlp_phase_timers_t();
+  pdlp_phase_timers_t(const pdlp_phase_timers_t&)            = delete;
+  pdlp_phase_timers_t& operator=(const pdlp_phase_timers_t&) = delete;
+
+  void start(phase_t phase);
+  void stop(phase_t phase);
+
+  // Waits for all recorded events and returns the accumulated time in seconds
+  double get_elapsed_seconds(phase_t phase);
+
+  bool is_enabled() const;
+
+ private:
+  struct event_pair_t {
+    cudaEvent_t start;
+    cudaEvent_t stop;
+  };
+  static constexpr int phase_count = static_cast<int>(phase_t::Count);
+  // Bound on the number of event pairs in flight per phase before forcing a wait on the oldest
+  static constexpr size_t max_pending_events = 256;
+
+  // Accumulate the pairs the GPU has already gone through, waiting on all of them if blocking
+  void harvest(int phase, bool blocking);
+  event_pair_t acquire(int phase);
+
+  rmm::cuda_stream_view stream_view_;
+  bool enabled_;
+  std::array<event_pair_t, phase_count> current_{};
+  std::array<bool, phase_count> running_{};
+  std::array<std::deque<event_pair_t>, phase_count> pending_;
+  std::array<std::vector<event_pair_t>, phase_count> free_;
+  std::array<double, phase_count> elapsed_ms_{};
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -95,6 +95,19 @@ bool ping_pong_graph_t<i_t>::is_initialized(i_t total_pdlp_iterations)
   return false;
 }
 
+template <typename i_t>
+void ping_pong_graph_t<i_t>::reset()
+{
+#ifndef CUPDLP_DEBUG_MODE
+  if (!is_legacy_batch_mode_) {
+    if (even_initialized) { RAFT_CUDA_TRY(cudaGraphExecDestroy(even_instance)); }
+    if (odd_initialized) { RAFT_CUDA_TRY(cudaGraphExecDestroy(odd_instance)); }
+  }
+#endif
+  even_initialized = false;
+  odd_initialized  = false;
+}
+
 template class ping_pong_graph_t<int>;
 
 }  // namespace cuopt::linear_programming::detail
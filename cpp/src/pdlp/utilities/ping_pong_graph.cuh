@@ -29,6 +29,9 @@ class ping_pong_graph_t {
   void end_capture(i_t total_pdlp_iterations);
   void launch(i_t total_pdlp_iterations);
   bool is_initialized(i_t total_pdlp_iterations);
+  // Destroy both graphs so that the next call captures them again
+  // Needed when the captured kernels or buffers change
+  void reset();
 
  private:
   cudaGraph_t even_graph;
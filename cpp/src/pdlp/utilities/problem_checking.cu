@@ -348,6 +348,10 @@ INSTANTIATE(float)
 INSTANTIATE(double)
 #endif
 
+#if MIP_INSTANTIATE_DOUBLE && PDLP_INSTANTIATE_INT64
+template class problem_checking_t<int64_t, double>;
+#endif
+
 #undef INSTANTIATE
 
 }  // namespace cuopt::linear_programming
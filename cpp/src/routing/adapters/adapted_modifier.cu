@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -12,6 +12,9 @@
 #include "adapted_modifier.cuh"
 #include "adapted_sol.cuh"
 
+#include <exception>
+#include <thread>
+
 namespace cuopt::routing::detail {
 
 template <typename i_t, typename f_t, request_t REQUEST>
@@ -65,6 +68,57 @@ void adapted_modifier_t<i_t, f_t, REQUEST>::improve(
   pool_allocator.resource_pool->release(index);
 }
 
+template <typename i_t, typename f_t, request_t REQUEST>
+void adapted_modifier_t<i_t, f_t, REQUEST>::improve_concurrently(
+  const std::vector<adapted_sol_t<i_t, f_t, REQUEST>*>& solutions,
+  costs weight,
+  f_t time_limit,
+  bool run_cycle_finder)
+{
+  raft::common::nvtx::range fun_scope("improve_concurrently");
+  auto& lanes = pool_allocator.lanes;
+  cuopt_assert(solutions.size() <= lanes.size(), "More solutions than lanes");
+  auto gpu_weight          = get_cuopt_cost(weight);
+  bool consider_unserviced = true;
+  bool time_limit_enabled  = true;
+
+  for (size_t i = 0; i < solutions.size(); ++i) {
+    lanes[i]->solution.copy_device_solution(solutions[i]->sol);
+    lanes[i]->solution.copy_routes_to_search(solutions[i]->sol);
+  }
+  const i_t device_id = pool_allocator.sol_handles[0]->get_device();
+  std::vector<std::exception_ptr> errors(solutions.size());
+  std::vector<std::thread> threads;
+  threads.reserve(solutions.size());
+  for (size_t i = 0; i < solutions.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      try {
+        RAFT_CUDA_TRY(cudaSetDevice(device_id));
+        auto& ls = lanes[i]->resource->ls;
+        ls.set_active_weights(gpu_weight);
+        ls.start_timer(time_limit);
+        ls.run_best_local_search(
+          lanes[i]->solution, consider_unserviced, time_limit_enabled, run_cycle_finder);
+        lanes[i]->sol_handle->sync_stream();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+  for (size_t i = 0; i < solutions.size(); ++i) {
+    solutions[i]->sol.copy_device_solution(lanes[i]->solution);
+    solutions[i]->populate_host_data(true);
+    solutions[i]->check_device_host_coherence();
+    cuopt_func_call(solutions[i]->sol.check_cost_coherence(gpu_weight));
+  }
+}
+
 // add unserviced pdp requests to the solution
 template <typename i_t, typename f_t, request_t REQUEST>
 void adapted_modifier_t<i_t, f_t, REQUEST>::add_unserviced_request(
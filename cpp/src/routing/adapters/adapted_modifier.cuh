@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -13,6 +13,7 @@
 #include <routing/diversity/macros.hpp>
 
 #include <array>
+#include <vector>
 
 namespace cuopt::routing::detail {
 
@@ -26,6 +27,12 @@ struct adapted_modifier_t {
                costs final_weight,
                f_t time_limit,
                bool run_cycle_finder = true);
+  // improves the solutions side by side, one per lane of the pool allocator
+  void improve_concurrently(const std::vector<adapted_sol_t<i_t, f_t, REQUEST>*>& solutions,
+                            costs final_weight,
+                            f_t time_limit,
+                            bool run_cycle_finder = true);
+  size_t n_lanes() const { return pool_allocator.lanes.size(); }
   void perturbate(adapted_sol_t<i_t, f_t, REQUEST>& adapted_solution,
                   costs final_weight,
                   i_t perturbation_count = 20);
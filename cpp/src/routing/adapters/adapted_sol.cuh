@@ -93,7 +93,7 @@ struct adapted_sol_t {
   bool has_unserviced_nodes = false;
 
   adapted_sol_t(solution_t<i_t, f_t, REQUEST> sol_, const problem_t<i_t, f_t>* problem_)
-    : sol(sol_), problem(problem_)
+    : sol(std::move(sol_)), problem(problem_)
   {
     initialize_host_data();
     populate_host_data(true);
@@ -114,6 +114,7 @@ struct adapted_sol_t {
 
   adapted_sol_t(adapted_sol_t& other_sol)       = default;
   adapted_sol_t(const adapted_sol_t& other_sol) = default;
+  adapted_sol_t(adapted_sol_t&& other_sol)      = default;
 
   adapted_sol_t& operator=(const adapted_sol_t& other_sol)
   {
@@ -74,10 +74,12 @@ assignment_t<i_t> ges_solver_t<i_t, f_t, REQUEST>::get_ges_assignment(
     sol.compute_cost();
     sol.compute_actual_arrival_times();
 
-    n_routes             = sol.get_n_routes();
-    obj_costs            = sol.get_objective_cost();
-    auto obj_weights     = sol.problem_ptr->dimensions_info.objective_weights;
-    total_objective_cost = detail::objective_cost_t::dot(obj_weights, obj_costs);
+    n_routes  = sol.get_n_routes();
+    obj_costs = sol.get_objective_cost();
+    // the cost is recomputed from the exact host matrices when the device ones are rounded
+    const bool exact_cost = problem.fleet_info.matrices_.is_half_precision() &&
+                            problem.dimensions_info.has_objective(objective_t::COST);
+    if (exact_cost) { obj_costs[objective_t::COST] = 0.; }
     for (i_t i = 0; i < sol.get_n_routes(); ++i) {
       const auto& route         = sol.get_route(i);
       auto size_including_depot = route.n_nodes.value(stream) + 1;
@@ -85,6 +87,12 @@ assignment_t<i_t> ges_solver_t<i_t, f_t, REQUEST>::get_ges_assignment(
       auto vehicle_id           = route.vehicle_id.value(stream);
 
       auto node_infos_h = cuopt::host_copy(route.dimensions.requests.node_info, stream);
+      if (exact_cost) {
+        for (i_t k = 0; k + 1 < size_including_depot; ++k) {
+          obj_costs[objective_t::COST] +=
+            problem.distance_between(node_infos_h[k], node_infos_h[k + 1], vehicle_id);
+        }
+      }
       std::vector<double> departure_forward_h(node_infos_h.size(), 0.);
       std::vector<double> actual_arrival_h(node_infos_h.size(), 0.);
       std::vector<double> earliest_arrival_backward_h(node_infos_h.size(), 0.);
@@ -134,6 +142,9 @@ assignment_t<i_t> ges_solver_t<i_t, f_t, REQUEST>::get_ges_assignment(
       offset += size_including_depot;
     }
 
+    auto obj_weights     = sol.problem_ptr->dimensions_info.objective_weights;
+    total_objective_cost = detail::objective_cost_t::dot(obj_weights, obj_costs);
+
     route_out_h.resize(counter);
     route_locations_out_h.resize(counter);
     truck_id_out_h.resize(counter);
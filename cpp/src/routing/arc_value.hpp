@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -54,8 +54,20 @@ static constexpr double get_distance(const NodeInfo<i_t>& l1,
 {
   if (vehicle_info.skip_first_trip && l1.node_type() == node_type_t::DEPOT) { return 0.f; }
   if (vehicle_info.drop_return_trip && l2.node_type() == node_type_t::DEPOT) { return 0.f; }
-  auto matrix = vehicle_info.matrices.get_cost_matrix(vehicle_info.type);
-  return lookup_dist(matrix, l1.location(), l2.location(), vehicle_info.matrices.extent[3]);
+  return vehicle_info.matrices.get_cost_value(vehicle_info.type, l1.location(), l2.location());
+}
+
+// Service time at l1 before leaving for l2
+template <typename i_t, typename f_t, bool is_device = true>
+static constexpr double get_service_time(const NodeInfo<i_t>& l1,
+                                         const NodeInfo<i_t>& l2,
+                                         const VehicleInfo<f_t, is_device>& vehicle_info)
+{
+  if (l1 == l2 || l1.node_type() == node_type_t::DEPOT) { return 0.; }
+  // FIXME:: We are assuming that there is at most one break. So break duration is obtained form
+  // zero dimension
+  return l1.node_type() == node_type_t::BREAK ? vehicle_info.break_durations[l1.node()]
+                                              : vehicle_info.order_service_times[l1.node()];
 }
 
 // All values pre-loaded overload
@@ -68,28 +80,59 @@ static constexpr double get_transit_time(const NodeInfo<i_t>& l1,
   if (vehicle_info.skip_first_trip && l1.node_type() == node_type_t::DEPOT) { return 0.f; }
 
   double transit_time = 0.;
-  if (use_service_time && l1 != l2) {
-    // FIXME:: We are assuming that there is at most one break. So break duration is obtained form
-    // zero dimension
-    double service_time =
-      (l1.node_type() == node_type_t::DEPOT)
-        ? 0.
-        : (l1.node_type() == node_type_t::BREAK ? vehicle_info.break_durations[l1.node()]
-                                                : vehicle_info.order_service_times[l1.node()]);
-    transit_time += service_time;
-  }
+  if (use_service_time) { transit_time += get_service_time(l1, l2, vehicle_info); }
 
   if (vehicle_info.drop_return_trip && l2.node_type() == node_type_t::DEPOT) {
     return transit_time;
   }
 
-  auto matrix = vehicle_info.matrices.get_time_matrix(vehicle_info.type);
   transit_time +=
-    lookup_dist(matrix, l1.location(), l2.location(), vehicle_info.matrices.extent[3]);
+    vehicle_info.matrices.get_time_value(vehicle_info.type, l1.location(), l2.location());
 
   return transit_time;
 }
 
+// Transit time, service time included, when the service at l1 starts at start_time. With time
+// dependent matrices the travel time is the one of the departure after the service
+template <typename i_t, typename f_t, bool is_device = true>
+static constexpr double get_transit_time_at(const NodeInfo<i_t>& l1,
+                                            const NodeInfo<i_t>& l2,
+                                            const VehicleInfo<f_t, is_device>& vehicle_info,
+                                            double start_time)
+{
+  if (!vehicle_info.matrices.is_time_dependent()) {
+    return get_transit_time(l1, l2, vehicle_info, true);
+  }
+  if (vehicle_info.skip_first_trip && l1.node_type() == node_type_t::DEPOT) { return 0.; }
+  const double service_time = get_service_time(l1, l2, vehicle_info);
+  if (vehicle_info.drop_return_trip && l2.node_type() == node_type_t::DEPOT) {
+    return service_time;
+  }
+  return service_time +
+         vehicle_info.matrices.get_time_value_at(
+           vehicle_info.type, l1.location(), l2.location(), start_time + service_time);
+}
+
+// Transit time, service time included, of the latest departure from l1 that reaches l2 by
+// latest_start. It is the backward counterpart of get_transit_time_at
+template <typename i_t, typename f_t, bool is_device = true>
+static constexpr double get_transit_time_before(const NodeInfo<i_t>& l1,
+                                                const NodeInfo<i_t>& l2,
+                                                const VehicleInfo<f_t, is_device>& vehicle_info,
+                                                double latest_start)
+{
+  if (!vehicle_info.matrices.is_time_dependent()) {
+    return get_transit_time(l1, l2, vehicle_info, true);
+  }
+  if (vehicle_info.skip_first_trip && l1.node_type() == node_type_t::DEPOT) { return 0.; }
+  const double service_time = get_service_time(l1, l2, vehicle_info);
+  if (vehicle_info.drop_return_trip && l2.node_type() == node_type_t::DEPOT) {
+    return service_time;
+  }
+  return service_time + vehicle_info.matrices.get_time_value_before(
+                          vehicle_info.type, l1.location(), l2.location(), latest_start);
+}
+
 template <typename i_t, typename f_t>
 static constexpr double get_arc_dimension(dim_t dim,
                                           const NodeInfo<i_t>& l1,
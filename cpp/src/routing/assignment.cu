@@ -102,6 +102,12 @@ double assignment_t<i_t>::get_runtime() const noexcept
   return timer;
 }
 
+template <typename i_t>
+const std::map<std::string, double>& assignment_t<i_t>::get_setup_times() const noexcept
+{
+  return setup_times_;
+}
+
 template <typename i_t>
 rmm::device_uvector<i_t>& assignment_t<i_t>::get_route() noexcept
 {
@@ -223,6 +229,12 @@ void assignment_t<i_t>::set_status(solution_status_t status)
   status_ = status;
 }
 
+template <typename i_t>
+void assignment_t<i_t>::set_setup_times(std::map<std::string, double> setup_times)
+{
+  setup_times_ = std::move(setup_times);
+}
+
 template <typename i_t>
 solution_status_t assignment_t<i_t>::get_status() const
 {
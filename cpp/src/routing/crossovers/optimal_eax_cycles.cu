@@ -1,12 +1,14 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <numeric>
 
 #include "optimal_eax_cycles.cuh"
 
@@ -16,9 +18,14 @@ template <typename i_t, typename f_t, request_t REQUEST>
 optimal_cycles_t<i_t, f_t, REQUEST>::optimal_cycles_t(allocator& pool_allocator_)
   : pool_allocator(pool_allocator_),
     d_cycle(0, pool_allocator_.sol_handles[0]->get_stream()),
+    cycle_offsets(0, pool_allocator_.sol_handles[0]->get_stream()),
+    remaining_cycles(0, pool_allocator_.sol_handles[0]->get_stream()),
+    delta_offsets(0, pool_allocator_.sol_handles[0]->get_stream()),
+    selected_cycles(0, pool_allocator_.sol_handles[0]->get_stream()),
     eax_cycle_delta(0, pool_allocator_.sol_handles[0]->get_stream()),
     d_cub_storage_bytes(0, pool_allocator_.sol_handles[0]->get_stream()),
-    index_delta_pair(pool_allocator_.sol_handles[0]->get_stream()),
+    index_delta_pairs(0, pool_allocator_.sol_handles[0]->get_stream()),
+    best_route_ids(0, pool_allocator_.sol_handles[0]->get_stream()),
     eax_fragment(pool_allocator_.sol_handles[0].get(), pool_allocator_.problem.dimensions_info)
 {
 }
@@ -27,29 +34,47 @@ template <typename i_t, typename f_t>
 __global__ void create_rotations_kernel(
   typename solution_t<i_t, f_t, request_t::VRP>::view_t const sol,
   const raft::device_span<NodeInfo<>> d_cycle,
-  typename dimensions_route_t<i_t, f_t, request_t::VRP>::view_t eax_fragment,
-  i_t n_rotations)
+  typename dimensions_route_t<i_t, f_t, request_t::VRP>::view_t eax_fragment)
 {
-  for (i_t i = threadIdx.x; i < n_rotations; i += blockDim.x) {
+  for (i_t i = threadIdx.x + blockIdx.x * blockDim.x; i < (i_t)d_cycle.size();
+       i += blockDim.x * gridDim.x) {
     auto node_info = d_cycle[i];
     auto node      = create_node<i_t, f_t, request_t::VRP>(sol.problem, node_info, node_info);
     eax_fragment.set_node(i, node);
   }
 }
 
+// Evaluates every rotation of every remaining cycle at every insertion position. The evaluations
+// of the k-th remaining cycle start at delta_offsets[k]
 template <typename i_t, typename f_t>
 __global__ void find_optimal_position_kernel(
   const typename solution_t<i_t, f_t, request_t::VRP>::view_t sol,
   const typename move_candidates_t<i_t, f_t>::view_t move_candidates,
   const typename dimensions_route_t<i_t, f_t, request_t::VRP>::view_t eax_fragment,
-  i_t n_rotations,
+  const raft::device_span<const i_t> cycle_offsets,
+  const raft::device_span<const i_t> remaining_cycles,
+  const raft::device_span<const i_t> delta_offsets,
   raft::device_span<double> eax_cycle_delta)
 {
   i_t th_id = threadIdx.x + blockIdx.x * blockDim.x;
-  if (th_id >= (sol.get_num_orders() + sol.n_routes) * n_rotations) { return; }
-  i_t insertion_node  = th_id / n_rotations;
-  i_t rotation        = th_id % n_rotations;
-  const i_t frag_size = n_rotations;
+  if (th_id >= delta_offsets[remaining_cycles.size()]) { return; }
+  // find the cycle of the thread
+  i_t low = 0, high = remaining_cycles.size();
+  while (high - low > 1) {
+    i_t mid = (low + high) / 2;
+    if (delta_offsets[mid] <= th_id) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  const i_t cycle       = remaining_cycles[low];
+  const i_t frag_start  = cycle_offsets[cycle];
+  const i_t n_rotations = cycle_offsets[cycle + 1] - frag_start;
+  const i_t item        = th_id - delta_offsets[low];
+  i_t insertion_node    = item / n_rotations;
+  i_t rotation          = item % n_rotations;
+  const i_t frag_size   = n_rotations;
   if (insertion_node == 0) {
     eax_cycle_delta[th_id] = std::numeric_limits<double>::max();
     return;
@@ -74,7 +99,7 @@ __global__ void find_optimal_position_kernel(
   for (i_t i = 0; i < frag_size; ++i) {
     // so that reads are coalesced
     i_t rotated_idx = (rotation + i) % n_rotations;
-    auto next_node  = eax_fragment.get_node(rotated_idx);
+    auto next_node  = eax_fragment.get_node(frag_start + rotated_idx);
     temp_node.calculate_forward_all(next_node, route.vehicle_info());
     temp_node = next_node;
   }
@@ -89,17 +114,57 @@ __global__ void find_optimal_position_kernel(
   eax_cycle_delta[th_id] = delta;
 }
 
+template <typename i_t>
+DI thrust::pair<i_t, i_t> get_insertion_node_and_rotation(
+  const raft::device_span<const i_t> cycle_offsets,
+  const raft::device_span<const i_t> remaining_cycles,
+  const cub::KeyValuePair<i_t, double>* index_delta_pairs,
+  i_t remaining_idx)
+{
+  const i_t cycle       = remaining_cycles[remaining_idx];
+  const i_t n_rotations = cycle_offsets[cycle + 1] - cycle_offsets[cycle];
+  // the keys of the segmented reduction are relative to the start of the segments
+  const i_t index = index_delta_pairs[remaining_idx].key;
+  return thrust::make_pair(index / n_rotations, index % n_rotations);
+}
+
+template <typename i_t, typename f_t>
+__global__ void find_best_route_ids_kernel(
+  const typename solution_t<i_t, f_t, request_t::VRP>::view_t sol,
+  const raft::device_span<const i_t> cycle_offsets,
+  const raft::device_span<const i_t> remaining_cycles,
+  const cub::KeyValuePair<i_t, double>* index_delta_pairs,
+  i_t* best_route_ids)
+{
+  for (i_t i = threadIdx.x + blockIdx.x * blockDim.x; i < (i_t)remaining_cycles.size();
+       i += blockDim.x * gridDim.x) {
+    const i_t insertion_node =
+      get_insertion_node_and_rotation(cycle_offsets, remaining_cycles, index_delta_pairs, i).first;
+    best_route_ids[i] = insertion_node >= sol.get_num_orders()
+                          ? insertion_node - sol.get_num_orders()
+                          : sol.route_node_map.route_id_per_node[insertion_node];
+  }
+}
+
+// Each block inserts one of the selected cycles, the selected cycles are inserted to distinct
+// routes
 template <typename i_t, typename f_t>
 __global__ void insert_optimal_rotation_kernel(
   typename solution_t<i_t, f_t, request_t::VRP>::view_t sol,
-  const cub::KeyValuePair<i_t, double>* index_delta_pair,
-  const typename dimensions_route_t<i_t, f_t, request_t::VRP>::view_t eax_fragment,
-  i_t n_rotations)
+  const raft::device_span<const i_t> cycle_offsets,
+  const raft::device_span<const i_t> remaining_cycles,
+  const raft::device_span<const i_t> selected_cycles,
+  const cub::KeyValuePair<i_t, double>* index_delta_pairs,
+  const typename dimensions_route_t<i_t, f_t, request_t::VRP>::view_t eax_fragment)
 {
   extern __shared__ i_t shmem[];
-  i_t index          = index_delta_pair->key;
-  i_t insertion_node = index / n_rotations;
-  i_t rotation       = index % n_rotations;
+  const i_t remaining_idx = selected_cycles[blockIdx.x];
+  const i_t cycle         = remaining_cycles[remaining_idx];
+  const i_t frag_start    = cycle_offsets[cycle];
+  const i_t n_rotations   = cycle_offsets[cycle + 1] - frag_start;
+  i_t insertion_node, rotation;
+  thrust::tie(insertion_node, rotation) = get_insertion_node_and_rotation(
+    cycle_offsets, remaining_cycles, index_delta_pairs, remaining_idx);
   i_t route_id;
   i_t insertion_idx;
   if (insertion_node >= sol.get_num_orders()) {
@@ -122,7 +187,7 @@ __global__ void insert_optimal_rotation_kernel(
   __syncthreads();
   for (i_t i = threadIdx.x; i < n_rotations; i += blockDim.x) {
     i_t rotated_idx = (rotation + i) % n_rotations;
-    s_route.set_node(i + insertion_idx + 1, eax_fragment.get_node(rotated_idx));
+    s_route.set_node(i + insertion_idx + 1, eax_fragment.get_node(frag_start + rotated_idx));
   }
   __syncthreads();
   s_route.copy_from(
@@ -141,51 +206,64 @@ __global__ void insert_optimal_rotation_kernel(
 
 template <typename i_t, typename f_t, request_t REQUEST>
 void optimal_cycles_t<i_t, f_t, REQUEST>::get_min_delta_and_index(
-  adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t num_items)
+  adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t n_cycles)
 {
   raft::common::nvtx::range fun_scope("get_min_delta_and_index");
   // Determine temporary device storage requirements
   size_t temp_storage_bytes = 0;
-  cub::DeviceReduce::ArgMin(static_cast<void*>(nullptr),
-                            temp_storage_bytes,
-                            eax_cycle_delta.data(),
-                            index_delta_pair.data(),
-                            num_items,
-                            sol.sol.sol_handle->get_stream());
+  cub::DeviceSegmentedReduce::ArgMin(static_cast<void*>(nullptr),
+                                     temp_storage_bytes,
+                                     eax_cycle_delta.data(),
+                                     index_delta_pairs.data(),
+                                     n_cycles,
+                                     delta_offsets.data(),
+                                     delta_offsets.data() + 1,
+                                     sol.sol.sol_handle->get_stream());
   // Allocate temporary storage
   if (d_cub_storage_bytes.size() < temp_storage_bytes) {
     d_cub_storage_bytes.resize(temp_storage_bytes, sol.sol.sol_handle->get_stream());
   }
   // Run argmin-reduction
-  cub::DeviceReduce::ArgMin(d_cub_storage_bytes.data(),
-                            temp_storage_bytes,
-                            eax_cycle_delta.data(),
-                            index_delta_pair.data(),
-                            num_items,
-                            sol.sol.sol_handle->get_stream());
+  cub::DeviceSegmentedReduce::ArgMin(d_cub_storage_bytes.data(),
+                                     temp_storage_bytes,
+                                     eax_cycle_delta.data(),
+                                     index_delta_pairs.data(),
+                                     n_cycles,
+                                     delta_offsets.data(),
+                                     delta_offsets.data() + 1,
+                                     sol.sol.sol_handle->get_stream());
 }
 
 template <typename i_t, typename f_t, request_t REQUEST>
-bool optimal_cycles_t<i_t, f_t, REQUEST>::insert_cycle_to_found_position(
-  adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t n_rotations)
+bool optimal_cycles_t<i_t, f_t, REQUEST>::insert_cycles_to_found_positions(
+  adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t n_selected, i_t max_cycle_size)
 {
-  raft::common::nvtx::range fun_scope("insert_cycle_to_found_position");
+  raft::common::nvtx::range fun_scope("insert_cycles_to_found_positions");
   auto& solution    = sol.sol;
-  size_t sh_size    = solution.check_routes_can_insert_and_get_sh_size(n_rotations);
+  size_t sh_size    = solution.check_routes_can_insert_and_get_sh_size(max_cycle_size);
   constexpr i_t TPB = 128;
 
   if (!set_shmem_of_kernel(insert_optimal_rotation_kernel<i_t, f_t>, sh_size)) {
-    cuopt_assert(false, "Not enough shared memory in insert_cycle_to_found_position");
+    cuopt_assert(false, "Not enough shared memory in insert_cycles_to_found_positions");
     return false;
   }
-  // prepare the rotations once and copy them to respective device arrays
-  insert_optimal_rotation_kernel<i_t, f_t><<<1, TPB, sh_size, solution.sol_handle->get_stream()>>>(
-    solution.view(), index_delta_pair.data(), eax_fragment.view(), n_rotations);
+  insert_optimal_rotation_kernel<i_t, f_t>
+    <<<n_selected, TPB, sh_size, solution.sol_handle->get_stream()>>>(
+      solution.view(),
+      raft::device_span<const i_t>(cycle_offsets.data(), cycle_offsets.size()),
+      raft::device_span<const i_t>(remaining_cycles.data(), remaining_cycles.size()),
+      raft::device_span<const i_t>(selected_cycles.data(), n_selected),
+      index_delta_pairs.data(),
+      eax_fragment.view());
   solution.compute_route_id_per_node();
   solution.compute_cost();
   return true;
 }
 
+/*! \brief { Inserts the cycles at their best rotation and position. All the remaining cycles are
+ * evaluated together, then the best cycle of each route is inserted, so that the insertions of a
+ * round are independent. The cycles that lost their route are evaluated again in the next round
+ * }*/
 template <typename i_t, typename f_t, request_t REQUEST>
 template <request_t r_t, std::enable_if_t<r_t == request_t::VRP, bool>>
 bool optimal_cycles_t<i_t, f_t, REQUEST>::add_cycles_request(
@@ -194,52 +272,122 @@ bool optimal_cycles_t<i_t, f_t, REQUEST>::add_cycles_request(
   costs final_weight)
 {
   raft::common::nvtx::range fun_scope("add_cycles_request_vrp");
+  if (cycles.empty()) { return true; }
   auto [resource, index] = pool_allocator.resource_pool->acquire();
   auto gpu_weight        = get_cuopt_cost(final_weight);
   resource.ls.set_active_weights(gpu_weight, std::numeric_limits<f_t>::max());
-  auto& solution      = sol.sol;
-  i_t total_positions = (solution.get_num_orders() + solution.n_routes);
-  for (auto& cycle : cycles) {
-    // dynamic resizing
-    if (d_cycle.size() < cycle.size()) {
-      d_cycle.resize(cycle.size(), solution.sol_handle->get_stream());
-      eax_fragment.resize(cycle.size());
-    }
-    // Number of routes in sol can change after recombination
-    eax_cycle_delta.resize(total_positions * cycle.size(), solution.sol_handle->get_stream());
-
-    // copy cycle to device
-    raft::copy(d_cycle.data(), cycle.data(), cycle.size(), solution.sol_handle->get_stream());
+  auto& solution     = sol.sol;
+  auto stream        = solution.sol_handle->get_stream();
+  const i_t n_cycles = cycles.size();
+
+  std::vector<NodeInfo<>> h_cycles;
+  std::vector<i_t> h_cycle_offsets(1, 0);
+  for (const auto& cycle : cycles) {
+    h_cycles.insert(h_cycles.end(), cycle.begin(), cycle.end());
+    h_cycle_offsets.push_back(h_cycles.size());
+  }
+  // dynamic resizing
+  if (d_cycle.size() < h_cycles.size()) {
+    d_cycle.resize(h_cycles.size(), stream);
+    eax_fragment.resize(h_cycles.size());
+  }
+  cycle_offsets.resize(n_cycles + 1, stream);
+  remaining_cycles.resize(n_cycles, stream);
+  delta_offsets.resize(n_cycles + 1, stream);
+  selected_cycles.resize(n_cycles, stream);
+  index_delta_pairs.resize(n_cycles, stream);
+  best_route_ids.resize(n_cycles, stream);
+  raft::copy(d_cycle.data(), h_cycles.data(), h_cycles.size(), stream);
+  raft::copy(cycle_offsets.data(), h_cycle_offsets.data(), n_cycles + 1, stream);
 
-    const i_t n_rotations = cycle.size();
+  constexpr i_t TPB = 128;
+  // prepare the rotations of all the cycles once
+  create_rotations_kernel<i_t, f_t><<<(h_cycles.size() + TPB - 1) / TPB, TPB, 0, stream>>>(
+    solution.view(),
+    raft::device_span<NodeInfo<>>(d_cycle.data(), h_cycles.size()),
+    eax_fragment.view());
+
+  std::vector<i_t> h_remaining(n_cycles);
+  std::iota(h_remaining.begin(), h_remaining.end(), 0);
+  std::vector<i_t> h_delta_offsets;
+  std::vector<i_t> h_selected;
+  std::vector<i_t> h_order;
+  std::vector<cub::KeyValuePair<i_t, double>> h_index_delta_pairs;
+  std::vector<i_t> h_best_route_ids;
+  std::vector<uint8_t> route_taken;
+  bool success = true;
+  while (!h_remaining.empty() && success) {
+    const i_t n_remaining = h_remaining.size();
+    // Number of routes in sol can change after recombination
     const i_t n_positions = solution.get_num_orders() + solution.n_routes;
-
-    constexpr i_t TPB = 128;
-    // prepare the rotations once and copy them to respective device arrays
-    create_rotations_kernel<i_t, f_t><<<1, TPB, 0, solution.sol_handle->get_stream()>>>(
-      solution.view(),
-      raft::device_span<NodeInfo<>>(d_cycle.data(), d_cycle.size()),
-      eax_fragment.view(),
-      n_rotations);
-
-    i_t n_blocks = (n_rotations * n_positions + TPB - 1) / TPB;
-    find_optimal_position_kernel<i_t, f_t><<<n_blocks, TPB, 0, solution.sol_handle->get_stream()>>>(
+    i_t max_cycle_size    = 0;
+    h_delta_offsets.assign(1, 0);
+    for (auto cycle : h_remaining) {
+      const i_t cycle_size = h_cycle_offsets[cycle + 1] - h_cycle_offsets[cycle];
+      max_cycle_size       = std::max(max_cycle_size, cycle_size);
+      h_delta_offsets.push_back(h_delta_offsets.back() + n_positions * cycle_size);
+    }
+    const i_t n_items = h_delta_offsets.back();
+    eax_cycle_delta.resize(n_items, stream);
+    raft::copy(remaining_cycles.data(), h_remaining.data(), n_remaining, stream);
+    raft::copy(delta_offsets.data(), h_delta_offsets.data(), n_remaining + 1, stream);
+
+    const raft::device_span<const i_t> offsets_span(cycle_offsets.data(), n_cycles + 1);
+    const raft::device_span<const i_t> remaining_span(remaining_cycles.data(), n_remaining);
+    find_optimal_position_kernel<i_t, f_t><<<(n_items + TPB - 1) / TPB, TPB, 0, stream>>>(
       solution.view(),
       resource.ls.move_candidates.view(),
       eax_fragment.view(),
-      n_rotations,
-      raft::device_span<double>(eax_cycle_delta.data(), eax_cycle_delta.size()));
-    get_min_delta_and_index(sol, n_rotations * n_positions);
-    bool success = insert_cycle_to_found_position(sol, n_rotations);
-
-    if (!success) {
-      solution.sol_handle->sync_stream();
-      pool_allocator.resource_pool->release(index);
-      return false;
+      offsets_span,
+      remaining_span,
+      raft::device_span<const i_t>(delta_offsets.data(), n_remaining + 1),
+      raft::device_span<double>(eax_cycle_delta.data(), n_items));
+    get_min_delta_and_index(sol, n_remaining);
+    find_best_route_ids_kernel<i_t, f_t><<<(n_remaining + TPB - 1) / TPB, TPB, 0, stream>>>(
+      solution.view(),
+      offsets_span,
+      remaining_span,
+      index_delta_pairs.data(),
+      best_route_ids.data());
+    h_index_delta_pairs.resize(n_remaining);
+    h_best_route_ids.resize(n_remaining);
+    raft::copy(h_index_delta_pairs.data(), index_delta_pairs.data(), n_remaining, stream);
+    raft::copy(h_best_route_ids.data(), best_route_ids.data(), n_remaining, stream);
+    solution.sol_handle->sync_stream();
+
+    // take the best cycle of every route, the others are evaluated again after the insertions
+    h_order.resize(n_remaining);
+    std::iota(h_order.begin(), h_order.end(), 0);
+    std::stable_sort(h_order.begin(), h_order.end(), [&](i_t lhs, i_t rhs) {
+      return h_index_delta_pairs[lhs].value < h_index_delta_pairs[rhs].value;
+    });
+    route_taken.assign(solution.n_routes, 0);
+    h_selected.clear();
+    std::vector<i_t> next_remaining;
+    for (auto idx : h_order) {
+      const i_t route_id = h_best_route_ids[idx];
+      // no position was found for the cycle
+      if (route_id < 0) {
+        success = false;
+        break;
+      }
+      if (route_taken[route_id]) {
+        next_remaining.push_back(h_remaining[idx]);
+      } else {
+        route_taken[route_id] = 1;
+        h_selected.push_back(idx);
+      }
     }
+    if (!success) { break; }
+    raft::copy(selected_cycles.data(), h_selected.data(), h_selected.size(), stream);
+    success     = insert_cycles_to_found_positions(sol, h_selected.size(), max_cycle_size);
+    h_remaining = std::move(next_remaining);
+    // keep the insertion order of the input
+    std::sort(h_remaining.begin(), h_remaining.end());
   }
   solution.sol_handle->sync_stream();
   pool_allocator.resource_pool->release(index);
+  if (!success) { return false; }
   sol.populate_host_data();
 
   return true;
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -28,8 +28,10 @@ struct optimal_cycles_t {
                           std::vector<std::vector<NodeInfo<>>>& cycles,
                           costs final_weight);
 
-  void get_min_delta_and_index(adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t num_items);
-  bool insert_cycle_to_found_position(adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t cycle_size);
+  void get_min_delta_and_index(adapted_sol_t<i_t, f_t, REQUEST>& sol, i_t n_cycles);
+  bool insert_cycles_to_found_positions(adapted_sol_t<i_t, f_t, REQUEST>& sol,
+                                        i_t n_selected,
+                                        i_t max_cycle_size);
 
   void find_best_rotate_cycle(std::vector<NodeInfo<>>& cycle, adapted_sol_t<i_t, f_t, REQUEST>& s);
 
@@ -42,10 +44,18 @@ struct optimal_cycles_t {
   std::deque<NodeInfo<>> best_so_far;
   std::unordered_map<i_t, size_t> in_cycle;
 
+  //! All the cycles of a request, concatenated, and the offset of each cycle
   rmm::device_uvector<NodeInfo<>> d_cycle;
+  rmm::device_uvector<i_t> cycle_offsets;
+  //! Cycles not inserted yet and the offset of their evaluations in eax_cycle_delta
+  rmm::device_uvector<i_t> remaining_cycles;
+  rmm::device_uvector<i_t> delta_offsets;
+  //! Indices in remaining_cycles of the cycles inserted in the current round
+  rmm::device_uvector<i_t> selected_cycles;
   rmm::device_uvector<double> eax_cycle_delta;
   rmm::device_uvector<std::byte> d_cub_storage_bytes;
-  rmm::device_scalar<cub::KeyValuePair<i_t, double>> index_delta_pair;
+  rmm::device_uvector<cub::KeyValuePair<i_t, double>> index_delta_pairs;
+  rmm::device_uvector<i_t> best_route_ids;
   dimensions_route_t<i_t, f_t, REQUEST> eax_fragment;
 };
 
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -121,6 +121,55 @@ __global__ void bellman_ford_kernel(const typename solution_t<i_t, f_t, REQUEST>
   }
 }
 
+/**
+ * @brief Walks the predecessors back from the last offspring node, so that only the routes of the
+ * shortest path are copied to the host. With the optimal routes search, the number of routes is
+ * the one of the cheapest path among the n_searched computed lengths. Writes -1 routes when no
+ * path reaches the last node, otherwise the start index, bucket and cost of each route from the
+ * last route to the first.
+ */
+template <typename i_t, typename f_t>
+__global__ void extract_shortest_path_kernel(raft::device_span<const f_t> path_cost,
+                                             raft::device_span<const i_t> predecessor,
+                                             raft::device_span<const i_t> predecessor_vehicle,
+                                             raft::device_span<i_t> path_starts,
+                                             raft::device_span<i_t> path_buckets,
+                                             raft::device_span<f_t> path_deltas,
+                                             i_t* n_path_routes,
+                                             i_t row_size,
+                                             i_t routes_number,
+                                             i_t n_searched,
+                                             bool optimal_routes_search)
+{
+  if (threadIdx.x + blockIdx.x * blockDim.x > 0) { return; }
+  i_t n_routes = routes_number;
+  if (optimal_routes_search) {
+    f_t min_cost = std::numeric_limits<f_t>::max();
+    for (i_t i = 1; i <= n_searched; ++i) {
+      f_t cost = path_cost[(i + 1) * row_size - 1];
+      if (cost < min_cost) {
+        min_cost = cost;
+        n_routes = i;
+      }
+    }
+  }
+  if (path_cost[(n_routes + 1) * row_size - 1] == std::numeric_limits<f_t>::max()) {
+    *n_path_routes = -1;
+    return;
+  }
+
+  i_t end_index = row_size - 1;
+  for (i_t i = n_routes; i > 0; --i) {
+    i_t start_index            = predecessor[i * row_size + end_index];
+    path_starts[n_routes - i]  = start_index;
+    path_buckets[n_routes - i] = predecessor_vehicle[i * row_size + end_index];
+    path_deltas[n_routes - i] =
+      path_cost[i * row_size + end_index] - path_cost[(i - 1) * row_size + start_index];
+    end_index = start_index;
+  }
+  *n_path_routes = n_routes;
+}
+
 /**
  * @brief This method fills the graph edges
  *
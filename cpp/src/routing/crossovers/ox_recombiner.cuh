@@ -17,6 +17,7 @@
 #include <random>
 #include <vector>
 
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <cub/cub.cuh>
@@ -46,11 +47,12 @@ struct OX {
 
   // Costs of edges which correspond to routes in the VRP solution
   std::vector<std::vector<std::tuple<int, double, int>>> graph;
-  // Costs of paths of given length path_cost[k][n]  -> min cost path of length 'k' to node 'n'
-  std::vector<std::vector<double>> path_cost;
-  // Vector of parents to recreate optimal path
-  std::vector<std::vector<int>> predcessor;
-  std::vector<std::vector<int>> predcessor_vehicle;
+  // Routes of the shortest path from the last route to the first: start index in the offspring,
+  // bucket and cost. n_path_routes is -1 when there is no path
+  std::vector<int> path_starts;
+  std::vector<int> path_buckets;
+  std::vector<double> path_deltas;
+  int n_path_routes;
 
   std::vector<int> genome_A;
   std::vector<int> genome_B;
@@ -60,7 +62,6 @@ struct OX {
 
   int max_route_len;
   int routes_number;
-  int optimal_routes_number;
   int n_buckets;
 
   std::vector<std::pair<size_t, double>> distances;
@@ -82,6 +83,10 @@ struct OX {
   rmm::device_uvector<double> d_path_cost;
   rmm::device_uvector<int> d_predecessor;
   rmm::device_uvector<int> d_predecessor_vehicle;
+  rmm::device_uvector<int> d_path_starts;
+  rmm::device_uvector<int> d_path_buckets;
+  rmm::device_uvector<double> d_path_deltas;
+  rmm::device_scalar<int> d_n_path_routes;
   rmm::device_uvector<int> d_offspring;
   rmm::device_uvector<int> d_helper_nodes;
   rmm::device_uvector<int> d_vehicle_id_per_bucket;
@@ -98,13 +103,17 @@ struct OX {
     : mt(rd()),
       problem_size(nodes_number),
       graph(problem_size),
-      path_cost(problem_size + 1),
-      predcessor(problem_size + 1),
-      predcessor_vehicle(problem_size + 1),
+      path_starts(problem_size + 1),
+      path_buckets(problem_size + 1),
+      path_deltas(problem_size + 1),
       distances(128),
       d_path_cost(0, stream_view),
       d_predecessor(0, stream_view),
       d_predecessor_vehicle(0, stream_view),
+      d_path_starts(problem_size + 1, stream_view),
+      d_path_buckets(problem_size + 1, stream_view),
+      d_path_deltas(problem_size + 1, stream_view),
+      d_n_path_routes(stream_view),
       d_offspring(problem_size, stream_view),
       d_helper_nodes(3, stream_view),
       d_vehicle_id_per_bucket(0, stream_view),
@@ -125,10 +134,6 @@ struct OX {
 
     for (auto& a : graph)
       a.reserve(problem_size);
-    for (auto& a : path_cost)
-      a.reserve(problem_size);
-    for (auto& a : predcessor)
-      a.reserve(problem_size);
   }
 
   void set_weight(const costs& weight) { weights = weight; }
@@ -211,8 +216,6 @@ struct OX {
 
     routes_number = std::min(routes_number, (int)problem_size);
 
-    optimal_routes_number = routes_number;
-
     if (A.problem->fleet_info.is_homogenous_ && !optimal_routes_search) { run_heuristic = false; }
 
     max_route_len = 1;
@@ -325,27 +328,21 @@ struct OX {
   //! }
   bool recreate_solution(Solution& A)
   {
-    if (path_cost[optimal_routes_number].back() == std::numeric_limits<double>::max()) {
-      return false;
-    }
+    if (n_path_routes < 0) { return false; }
 
     std::vector<std::tuple<int, std::vector<uint32_t>>> tmp_routes;
     std::unordered_set<int> routes_to_remove;
     std::unordered_set<int> vehicle_ids_to_remove;
-    const auto& dimensions_info = A.problem->dimensions_info;
-    int i                       = routes_number;
-    if (optimal_routes_search) { i = optimal_routes_number; }
-    int end_index = offspring.size() - 1;
-    [[maybe_unused]] double cost_n, cost_p, total_delta = 0.;
+    const auto& dimensions_info         = A.problem->dimensions_info;
+    int end_index                       = offspring.size() - 1;
+    [[maybe_unused]] double total_delta = 0.;
 
     std::vector<std::pair<int, std::vector<NodeInfo<>>>> routes_to_add;
     std::vector<uint32_t> tmp_route;
 
-    while (i > 0) {
-      int start_index = predcessor[i][end_index];
-      int bucket      = predcessor_vehicle[i][end_index];
-      cost_n          = path_cost[i][end_index];
-      cost_p          = path_cost[i - 1][start_index];
+    for (int r = 0; r < n_path_routes; ++r) {
+      int start_index = path_starts[r];
+      int bucket      = path_buckets[r];
       for (int k = start_index + 1; k <= end_index; k++) {
         tmp_route.push_back(offspring[k]);
       }
@@ -382,12 +379,11 @@ struct OX {
             }
           }
         }
-        total_delta += (cost_n - cost_p);
+        total_delta += path_deltas[r];
         tmp_routes.push_back({bucket, tmp_route});
       }
       tmp_route.clear();
       end_index = start_index;
-      --i;
     }
 
     if (fixed_route) {
@@ -492,9 +488,11 @@ struct OX {
     }
 
     if (A.problem->fleet_info.is_homogenous_) {
+      auto path_cost = cuopt::host_copy(d_path_cost, A.sol.sol_handle->get_stream());
       for (size_t i = 0; i < h_path_cost.size(); ++i) {
         for (size_t j = 0; j < h_path_cost[i].size(); ++j) {
-          cuopt_assert(std::abs(h_path_cost[i][j] - path_cost[i][j]) < 0.01, "Path cost mismatch");
+          cuopt_assert(std::abs(h_path_cost[i][j] - path_cost[i * offspring.size() + j]) < 0.01,
+                       "Path cost mismatch");
         }
       }
     }
@@ -634,14 +632,13 @@ struct OX {
       raft::device_span<int>(d_predecessor_vehicle.data(), d_predecessor_vehicle.size()));
     RAFT_CHECK_CUDA(A.sol.sol_handle->get_stream());
 
-    constexpr auto const TPB     = 128;
-    auto min_cost_of_last_column = std::numeric_limits<double>::max();
-    auto cost_of_last_column     = std::numeric_limits<double>::max();
-    const auto& dimensions_info  = A.problem->dimensions_info;
+    constexpr auto const TPB    = 128;
+    const auto& dimensions_info = A.problem->dimensions_info;
 
     cuopt::device_copy(
       d_vehicle_availability, vehicle_availability, A.sol.sol_handle->get_stream());
 
+    int n_searched = 0;
     for (int i = 1; i <= routes_number; ++i) {
       auto n_blocks = transpose_graph.get_num_vertices() - i;
       // routes number exceeds num nodes. Stop the search here
@@ -658,49 +655,33 @@ struct OX {
           i,
           run_heuristic);
       RAFT_CHECK_CUDA(A.sol.sol_handle->get_stream());
+      n_searched = i;
+    }
+
+    extract_shortest_path_kernel<int, double><<<1, 1, 0, A.sol.sol_handle->get_stream()>>>(
+      raft::device_span<const double>(d_path_cost.data(), d_path_cost.size()),
+      raft::device_span<const int>(d_predecessor.data(), d_predecessor.size()),
+      raft::device_span<const int>(d_predecessor_vehicle.data(), d_predecessor_vehicle.size()),
+      raft::device_span<int>(d_path_starts.data(), d_path_starts.size()),
+      raft::device_span<int>(d_path_buckets.data(), d_path_buckets.size()),
+      raft::device_span<double>(d_path_deltas.data(), d_path_deltas.size()),
+      d_n_path_routes.data(),
+      row_size,
+      routes_number,
+      n_searched,
+      optimal_routes_search);
+    RAFT_CHECK_CUDA(A.sol.sol_handle->get_stream());
 
-      if (optimal_routes_search) {
-        raft::copy(&cost_of_last_column,
-                   d_path_cost.data() + ((i + 1) * row_size) - 1,
-                   1,
-                   A.sol.sol_handle->get_stream());
-        if (cost_of_last_column < min_cost_of_last_column) {
-          min_cost_of_last_column = cost_of_last_column;
-          optimal_routes_number   = i;
-        }
-      }
-    }
-    A.sol.sol_handle->sync_stream();
-
-    for (size_t i = 0; i < path_cost.size(); ++i) {
-      path_cost[i].resize(row_size);
-    }
-    for (size_t i = 0; i < predcessor.size(); ++i) {
-      predcessor[i].resize(row_size);
-    }
-    for (size_t i = 0; i < predcessor_vehicle.size(); ++i) {
-      predcessor_vehicle[i].resize(row_size);
-    }
-    // Fill cpu structure
-    for (int i = 0; i <= routes_number; ++i) {
-      raft::copy(path_cost[i].data(),
-                 d_path_cost.data() + i * row_size,
-                 row_size,
-                 A.sol.sol_handle->get_stream());
-    }
-
-    for (int i = 0; i <= routes_number; ++i) {
-      raft::copy(predcessor[i].data(),
-                 d_predecessor.data() + i * row_size,
-                 row_size,
-                 A.sol.sol_handle->get_stream());
-    }
-
-    for (int i = 0; i <= routes_number; ++i) {
-      raft::copy(predcessor_vehicle[i].data(),
-                 d_predecessor_vehicle.data() + i * row_size,
-                 row_size,
-                 A.sol.sol_handle->get_stream());
+    // Only the routes of the shortest path are needed on the host
+    n_path_routes = d_n_path_routes.value(A.sol.sol_handle->get_stream());
+    if (n_path_routes > 0) {
+      raft::copy(
+        path_starts.data(), d_path_starts.data(), n_path_routes, A.sol.sol_handle->get_stream());
+      raft::copy(
+        path_buckets.data(), d_path_buckets.data(), n_path_routes, A.sol.sol_handle->get_stream());
+      raft::copy(
+        path_deltas.data(), d_path_deltas.data(), n_path_routes, A.sol.sol_handle->get_stream());
+      A.sol.sol_handle->sync_stream();
     }
 
     cuopt_func_call(test_bellman_ford(A));
@@ -924,7 +905,6 @@ struct OX {
         max_route_len,
         gpu_weight);
     RAFT_CHECK_CUDA(A.sol.sol_handle->get_stream());
-    A.sol.sol_handle->sync_stream();
 
     if (A.problem->data_view_ptr->get_vehicle_locations().first == nullptr) {
       cuopt_func_call(test_fill_edges(A));
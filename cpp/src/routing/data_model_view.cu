@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -55,6 +55,103 @@ void data_model_view_t<i_t, f_t>::add_transit_time_matrix(f_t const* matrix, uin
   transit_time_matrices_[vehicle_type] = matrix;
 }
 
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::add_transit_time_matrix(f_t const* matrices,
+                                                          f_t const* bucket_start_times,
+                                                          i_t n_time_buckets,
+                                                          uint8_t vehicle_type)
+{
+  cuopt_expects(matrices != nullptr && bucket_start_times != nullptr,
+                error_type_t::ValidationError,
+                "Time dependent matrix input cannot be null");
+  cuopt_expects(
+    n_time_buckets > 0, error_type_t::ValidationError, "Number of time buckets must be positive");
+  for (const auto& [vtype, other] : time_dependent_transit_time_matrices_) {
+    cuopt_expects(vtype == vehicle_type || other.get_n_time_buckets() == n_time_buckets,
+                  error_type_t::ValidationError,
+                  "All time dependent matrices must have the same number of time buckets");
+  }
+  cuopt_expects(detail::check_fifo_time_buckets(matrices,
+                                                bucket_start_times,
+                                                (size_t)num_locations_ * num_locations_,
+                                                n_time_buckets,
+                                                handle_ptr_->get_stream()),
+                error_type_t::ValidationError,
+                "Bucket start times must increase and later departures must not arrive earlier");
+  time_dependent_transit_time_matrices_.insert_or_assign(
+    vehicle_type,
+    detail::time_dependent_matrix_t<i_t, f_t>(matrices, bucket_start_times, n_time_buckets));
+}
+
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::add_scaled_matrices(uint8_t base_vehicle_type,
+                                                      f_t cost_scale,
+                                                      f_t cost_offset,
+                                                      f_t time_scale,
+                                                      f_t time_offset,
+                                                      uint8_t vehicle_type)
+{
+  cuopt_expects(base_vehicle_type != vehicle_type,
+                error_type_t::ValidationError,
+                "A vehicle type cannot scale its own matrices");
+  cuopt_expects(cost_scale >= 0 && cost_offset >= 0 && time_scale >= 0 && time_offset >= 0,
+                error_type_t::ValidationError,
+                "Matrix scales and offsets cannot be negative");
+  scaled_matrices_.insert_or_assign(
+    vehicle_type,
+    detail::scaled_matrix_t<i_t, f_t>(
+      base_vehicle_type, cost_scale, cost_offset, time_scale, time_offset));
+}
+
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::set_location_coordinates(f_t const* x_coordinates,
+                                                           f_t const* y_coordinates)
+{
+  cuopt_expects(x_coordinates != nullptr && y_coordinates != nullptr,
+                error_type_t::ValidationError,
+                "Coordinates cannot be null");
+  x_coordinates_ = x_coordinates;
+  y_coordinates_ = y_coordinates;
+}
+
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::add_candidate_cost_matrix(i_t const* neighbors,
+                                                            f_t const* costs,
+                                                            i_t n_neighbors,
+                                                            f_t fallback_factor,
+                                                            uint8_t vehicle_type)
+{
+  cuopt_expects(neighbors != nullptr && costs != nullptr,
+                error_type_t::ValidationError,
+                "Candidate matrix input cannot be null");
+  cuopt_expects(
+    n_neighbors > 0, error_type_t::ValidationError, "Number of neighbors must be positive");
+  cuopt_expects(
+    fallback_factor >= 0, error_type_t::ValidationError, "Fallback factor cannot be negative");
+  candidate_cost_matrices_.insert_or_assign(
+    vehicle_type,
+    detail::candidate_matrix_t<i_t, f_t>(neighbors, costs, n_neighbors, fallback_factor));
+}
+
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::add_candidate_transit_time_matrix(i_t const* neighbors,
+                                                                    f_t const* transit_times,
+                                                                    i_t n_neighbors,
+                                                                    f_t fallback_factor,
+                                                                    uint8_t vehicle_type)
+{
+  cuopt_expects(neighbors != nullptr && transit_times != nullptr,
+                error_type_t::ValidationError,
+                "Candidate matrix input cannot be null");
+  cuopt_expects(
+    n_neighbors > 0, error_type_t::ValidationError, "Number of neighbors must be positive");
+  cuopt_expects(
+    fallback_factor >= 0, error_type_t::ValidationError, "Fallback factor cannot be negative");
+  candidate_transit_time_matrices_.insert_or_assign(
+    vehicle_type,
+    detail::candidate_matrix_t<i_t, f_t>(neighbors, transit_times, n_neighbors, fallback_factor));
+}
+
 template <typename i_t, typename f_t>
 void data_model_view_t<i_t, f_t>::add_initial_solutions(i_t const* vehicle_ids,
                                                         i_t const* routes,
@@ -514,6 +611,48 @@ std::unordered_map<uint8_t, f_t const*> data_model_view_t<i_t, f_t>::get_transit
   return transit_time_matrices_;
 }
 
+template <typename i_t, typename f_t>
+std::pair<f_t const*, f_t const*> data_model_view_t<i_t, f_t>::get_location_coordinates()
+  const noexcept
+{
+  return std::make_pair(x_coordinates_, y_coordinates_);
+}
+
+template <typename i_t, typename f_t>
+const std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>>&
+data_model_view_t<i_t, f_t>::get_candidate_cost_matrices() const noexcept
+{
+  return candidate_cost_matrices_;
+}
+
+template <typename i_t, typename f_t>
+const std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>>&
+data_model_view_t<i_t, f_t>::get_candidate_transit_time_matrices() const noexcept
+{
+  return candidate_transit_time_matrices_;
+}
+
+template <typename i_t, typename f_t>
+const std::unordered_map<uint8_t, detail::time_dependent_matrix_t<i_t, f_t>>&
+data_model_view_t<i_t, f_t>::get_time_dependent_transit_time_matrices() const noexcept
+{
+  return time_dependent_transit_time_matrices_;
+}
+
+template <typename i_t, typename f_t>
+const std::unordered_map<uint8_t, detail::scaled_matrix_t<i_t, f_t>>&
+data_model_view_t<i_t, f_t>::get_scaled_matrices() const noexcept
+{
+  return scaled_matrices_;
+}
+
+template <typename i_t, typename f_t>
+bool data_model_view_t<i_t, f_t>::has_cost_matrix(uint8_t vehicle_type) const noexcept
+{
+  return cost_matrices_.count(vehicle_type) || candidate_cost_matrices_.count(vehicle_type) ||
+         scaled_matrices_.count(vehicle_type);
+}
+
 template <typename i_t, typename f_t>
 std::tuple<raft::device_span<i_t const>,
            raft::device_span<i_t const>,
@@ -571,7 +710,16 @@ i_t data_model_view_t<i_t, f_t>::get_num_requests() const noexcept
 template <typename i_t, typename f_t>
 i_t data_model_view_t<i_t, f_t>::get_num_vehicle_types() const noexcept
 {
-  return cost_matrices_.size();
+  i_t n_vehicle_types = cost_matrices_.size();
+  for (const auto& [vehicle_type, candidates] : candidate_cost_matrices_) {
+    if (!cost_matrices_.count(vehicle_type)) { ++n_vehicle_types; }
+  }
+  for (const auto& [vehicle_type, scaled] : scaled_matrices_) {
+    if (!cost_matrices_.count(vehicle_type) && !candidate_cost_matrices_.count(vehicle_type)) {
+      ++n_vehicle_types;
+    }
+  }
+  return n_vehicle_types;
 }
 
 template <typename i_t, typename f_t>
@@ -711,6 +859,13 @@ raft::handle_t const* data_model_view_t<i_t, f_t>::get_handle_ptr() const noexce
   return handle_ptr_;
 }
 
+template <typename i_t, typename f_t>
+void data_model_view_t<i_t, f_t>::set_handle_ptr(raft::handle_t const* handle_ptr)
+{
+  cuopt_expects(handle_ptr != nullptr, error_type_t::ValidationError, "Handle cannot be null");
+  handle_ptr_ = handle_ptr;
+}
+
 template class data_model_view_t<int, float>;
 }  // namespace routing
 }  // namespace cuopt
@@ -0,0 +1,385 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "decomposition.hpp"
+
+#include <cuopt/error.hpp>
+#include <cuopt/routing/solve.hpp>
+#include <utilities/copy_helpers.hpp>
+#include <utilities/logger.hpp>
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+namespace detail {
+
+// share of the time limit given to the clusters, the rest improves the merged solution
+constexpr double cluster_time_share = 0.7;
+
+// Distance used to cluster the orders: euclidean when the locations have coordinates, the
+// symmetrized cost otherwise
+template <typename i_t, typename f_t>
+struct cluster_distance_t {
+  __device__ f_t operator()(i_t a, i_t b) const
+  {
+    if (x != nullptr) { return hypotf(x[a] - x[b], y[a] - y[b]); }
+    return (matrix[(size_t)a * n_locations + b] + matrix[(size_t)b * n_locations + a]) / 2;
+  }
+
+  f_t const* matrix;
+  f_t const* x;
+  f_t const* y;
+  i_t n_locations;
+};
+
+// Owns the device data of a cluster, the model of the cluster reads it
+template <typename i_t, typename f_t>
+struct sub_model_t {
+  sub_model_t(std::vector<i_t> const& orders_,
+              std::vector<i_t> const& vehicles_,
+              rmm::cuda_stream_view stream)
+    : orders(orders_),
+      vehicles(vehicles_),
+      d_orders(cuopt::device_copy(orders_, stream)),
+      d_vehicles(cuopt::device_copy(vehicles_, stream))
+  {
+  }
+
+  template <typename T>
+  T const* gather(T const* values, bool by_vehicle, rmm::cuda_stream_view stream)
+  {
+    const auto& map = by_vehicle ? d_vehicles : d_orders;
+    auto& gathered =
+      std::get<std::vector<rmm::device_uvector<T>>>(buffers).emplace_back(map.size(), stream);
+    thrust::gather(rmm::exec_policy(stream), map.begin(), map.end(), values, gathered.begin());
+    return gathered.data();
+  }
+
+  f_t const* gather_matrix(f_t const* matrix, i_t n_locations, rmm::cuda_stream_view stream)
+  {
+    const i_t n_sub = orders.size();
+    auto& gathered  = std::get<std::vector<rmm::device_uvector<f_t>>>(buffers).emplace_back(
+      (size_t)n_sub * n_sub, stream);
+    auto orders_ptr = d_orders.data();
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::counting_iterator<size_t>(0),
+                      thrust::counting_iterator<size_t>((size_t)n_sub * n_sub),
+                      gathered.begin(),
+                      [matrix, orders_ptr, n_sub, n_locations] __device__(size_t idx) {
+                        return matrix[(size_t)orders_ptr[idx / n_sub] * n_locations +
+                                      orders_ptr[idx % n_sub]];
+                      });
+    return gathered.data();
+  }
+
+  //! Order of the full model of every order of the cluster, the depot first
+  std::vector<i_t> orders;
+  //! Vehicle of the full model of every vehicle of the cluster
+  std::vector<i_t> vehicles;
+  rmm::device_uvector<i_t> d_orders;
+  rmm::device_uvector<i_t> d_vehicles;
+  std::tuple<std::vector<rmm::device_uvector<i_t>>,
+             std::vector<rmm::device_uvector<f_t>>,
+             std::vector<rmm::device_uvector<bool>>>
+    buffers;
+  raft::handle_t handle;
+  data_model_view_t<i_t, f_t> data_model;
+};
+
+template <typename i_t, typename f_t>
+bool is_decomposable(data_model_view_t<i_t, f_t> const& data_model,
+                     solver_settings_t<i_t, f_t> const& settings)
+{
+  const i_t cluster_size = settings.get_decomposition_cluster_size();
+  if (cluster_size <= 0 || data_model.get_num_orders() - 1 <= cluster_size) { return false; }
+  auto [initial_vehicle_ids, initial_routes, initial_types, initial_offsets] =
+    data_model.get_initial_solutions();
+  auto [vehicle_starts, vehicle_returns] = data_model.get_vehicle_locations();
+  for (const auto& [vehicle_id, service_times] : data_model.get_order_service_times()) {
+    if (vehicle_id != -1) { return false; }
+  }
+  return data_model.get_pickup_delivery_pair().first == nullptr &&
+         data_model.get_order_locations() == nullptr && vehicle_starts == nullptr &&
+         data_model.get_cost_matrices().size() == 1 &&
+         data_model.get_transit_time_matrices().size() <= 1 &&
+         data_model.get_candidate_cost_matrices().empty() &&
+         data_model.get_time_dependent_transit_time_matrices().empty() &&
+         data_model.get_vehicle_types().empty() && !data_model.has_vehicle_breaks() &&
+         data_model.get_order_prizes().empty() && data_model.get_order_precedence().empty() &&
+         data_model.get_vehicle_order_match().empty() &&
+         data_model.get_order_vehicle_match().empty() && initial_vehicle_ids.empty();
+}
+
+// Farthest point seeds, then every order joins the cluster of its closest seed
+template <typename i_t, typename f_t>
+static std::vector<i_t> cluster_orders(data_model_view_t<i_t, f_t> const& data_model,
+                                       i_t n_clusters)
+{
+  auto handle_ptr   = data_model.get_handle_ptr();
+  auto stream       = handle_ptr->get_stream();
+  const i_t n_nodes = data_model.get_num_orders() - 1;
+  auto [x, y]       = data_model.get_location_coordinates();
+  const cluster_distance_t<i_t, f_t> distance{data_model.get_cost_matrices().begin()->second,
+                                              y != nullptr ? x : nullptr,
+                                              y,
+                                              data_model.get_num_locations()};
+
+  rmm::device_uvector<f_t> min_distance(n_nodes, stream);
+  rmm::device_uvector<i_t> seeds(n_clusters, stream);
+  rmm::device_uvector<i_t> labels(n_nodes, stream);
+  // the first seed is the order farthest from the depot
+  thrust::transform(handle_ptr->get_thrust_policy(),
+                    thrust::counting_iterator<i_t>(1),
+                    thrust::counting_iterator<i_t>(n_nodes + 1),
+                    min_distance.begin(),
+                    [distance] __device__(i_t order) { return distance(0, order); });
+  std::vector<i_t> h_seeds;
+  for (i_t c = 0; c < n_clusters; ++c) {
+    auto farthest = thrust::max_element(
+      handle_ptr->get_thrust_policy(), min_distance.begin(), min_distance.end());
+    const i_t seed = 1 + (farthest - min_distance.begin());
+    h_seeds.push_back(seed);
+    auto min_distance_ptr = min_distance.data();
+    thrust::for_each(handle_ptr->get_thrust_policy(),
+                     thrust::counting_iterator<i_t>(0),
+                     thrust::counting_iterator<i_t>(n_nodes),
+                     [distance, min_distance_ptr, seed] __device__(i_t idx) {
+                       min_distance_ptr[idx] = min(min_distance_ptr[idx], distance(seed, idx + 1));
+                     });
+  }
+  raft::copy(seeds.data(), h_seeds.data(), n_clusters, stream);
+
+  auto seeds_ptr = seeds.data();
+  thrust::transform(handle_ptr->get_thrust_policy(),
+                    thrust::counting_iterator<i_t>(1),
+                    thrust::counting_iterator<i_t>(n_nodes + 1),
+                    labels.begin(),
+                    [distance, seeds_ptr, n_clusters] __device__(i_t order) {
+                      i_t best_cluster = 0;
+                      f_t best_dist    = std::numeric_limits<f_t>::max();
+                      for (i_t c = 0; c < n_clusters; ++c) {
+                        const f_t dist = distance(seeds_ptr[c], order);
+                        if (dist < best_dist) {
+                          best_dist    = dist;
+                          best_cluster = c;
+                        }
+                      }
+                      return best_cluster;
+                    });
+  return cuopt::host_copy(labels, stream);
+}
+
+// Every cluster gets one vehicle, the rest of the fleet is split by the demand of the clusters
+template <typename i_t, typename f_t>
+static std::vector<i_t> split_fleet(data_model_view_t<i_t, f_t> const& data_model,
+                                    std::vector<std::vector<i_t>> const& cluster_orders)
+{
+  auto stream             = data_model.get_handle_ptr()->get_stream();
+  const i_t n_clusters    = cluster_orders.size();
+  const auto& capacities  = data_model.get_capacity_dimensions();
+  std::vector<i_t> demand = capacities.empty()
+                              ? std::vector<i_t>(data_model.get_num_orders(), 1)
+                              : cuopt::host_copy(capacities[0].get_demands(),
+                                                 data_model.get_num_orders(),
+                                                 stream);
+  std::vector<double> weights(n_clusters);
+  for (i_t c = 0; c < n_clusters; ++c) {
+    for (auto order : cluster_orders[c]) {
+      weights[c] += std::max<i_t>(demand[order], 1);
+    }
+  }
+  const double total_weight = std::accumulate(weights.begin(), weights.end(), 0.);
+  const i_t n_extra         = data_model.get_fleet_size() - n_clusters;
+  std::vector<i_t> n_vehicles(n_clusters, 1);
+  i_t n_assigned = n_clusters;
+  for (i_t c = 0; c < n_clusters; ++c) {
+    const i_t extra = n_extra * weights[c] / total_weight;
+    n_vehicles[c] += extra;
+    n_assigned += extra;
+  }
+  for (i_t c = 0; n_assigned < data_model.get_fleet_size(); c = (c + 1) % n_clusters) {
+    ++n_vehicles[c];
+    ++n_assigned;
+  }
+  return n_vehicles;
+}
+
+template <typename i_t, typename f_t>
+static std::unique_ptr<sub_model_t<i_t, f_t>> make_sub_model(
+  data_model_view_t<i_t, f_t> const& data_model,
+  std::vector<i_t> const& orders,
+  std::vector<i_t> const& vehicles)
+{
+  auto stream      = data_model.get_handle_ptr()->get_stream();
+  const i_t n_locs = data_model.get_num_locations();
+  auto sub         = std::make_unique<sub_model_t<i_t, f_t>>(orders, vehicles, stream);
+  auto& model      = sub->data_model;
+  model            = data_model_view_t<i_t, f_t>(&sub->handle, orders.size(), vehicles.size());
+
+  model.add_cost_matrix(
+    sub->gather_matrix(data_model.get_cost_matrices().begin()->second, n_locs, stream));
+  for (const auto& [vehicle_type, matrix] : data_model.get_transit_time_matrices()) {
+    model.add_transit_time_matrix(sub->gather_matrix(matrix, n_locs, stream));
+  }
+  i_t dim = 0;
+  for (const auto& capacity : data_model.get_capacity_dimensions()) {
+    model.add_capacity_dimension("demand_" + std::to_string(dim++),
+                                 sub->gather(capacity.get_demands(), false, stream),
+                                 sub->gather(capacity.get_vehicle_capacities(), true, stream),
+                                 false);
+  }
+  auto [earliest, latest] = data_model.get_order_time_windows();
+  if (earliest != nullptr) {
+    model.set_order_time_windows(
+      sub->gather(earliest, false, stream), sub->gather(latest, false, stream), false);
+  }
+  for (const auto& [vehicle_id, service_times] : data_model.get_order_service_times()) {
+    model.set_order_service_times(sub->gather(service_times.data(), false, stream), -1, false);
+  }
+  auto [vehicle_earliest, vehicle_latest] = data_model.get_vehicle_time_windows();
+  if (vehicle_earliest != nullptr) {
+    model.set_vehicle_time_windows(sub->gather(vehicle_earliest, true, stream),
+                                   sub->gather(vehicle_latest, true, stream),
+                                   false);
+  }
+  if (data_model.get_drop_return_trips() != nullptr) {
+    model.set_drop_return_trips(sub->gather(data_model.get_drop_return_trips(), true, stream));
+  }
+  if (data_model.get_skip_first_trips() != nullptr) {
+    model.set_skip_first_trips(sub->gather(data_model.get_skip_first_trips(), true, stream));
+  }
+  if (!data_model.get_vehicle_max_costs().empty()) {
+    model.set_vehicle_max_costs(
+      sub->gather(data_model.get_vehicle_max_costs().data(), true, stream));
+  }
+  if (!data_model.get_vehicle_max_times().empty()) {
+    model.set_vehicle_max_times(
+      sub->gather(data_model.get_vehicle_max_times().data(), true, stream));
+  }
+  if (!data_model.get_vehicle_fixed_costs().empty()) {
+    model.set_vehicle_fixed_costs(
+      sub->gather(data_model.get_vehicle_fixed_costs().data(), true, stream));
+  }
+  auto [objectives, objective_weights, n_objectives] = data_model.get_objective_function();
+  if (n_objectives > 0) {
+    model.set_objective_function(objectives, objective_weights, n_objectives);
+  }
+  return sub;
+}
+
+template <typename i_t, typename f_t>
+assignment_t<i_t> solve_decomposed(data_model_view_t<i_t, f_t> const& data_model,
+                                   solver_settings_t<i_t, f_t> const& settings)
+{
+  auto stream            = data_model.get_handle_ptr()->get_stream();
+  const i_t n_nodes      = data_model.get_num_orders() - 1;
+  const i_t cluster_size = settings.get_decomposition_cluster_size();
+  const i_t n_clusters =
+    std::min((n_nodes + cluster_size - 1) / cluster_size, data_model.get_fleet_size());
+
+  auto full_settings                        = settings;
+  full_settings.decomposition_cluster_size_ = 0;
+  if (full_settings.time_limit_ == std::numeric_limits<f_t>::max()) {
+    full_settings.time_limit_ = data_model.get_num_orders() / 5;
+  }
+  if (n_clusters < 2) { return solve(data_model, full_settings); }
+
+  const auto labels = cluster_orders(data_model, n_clusters);
+  std::vector<std::vector<i_t>> orders(n_clusters, std::vector<i_t>{0});
+  for (i_t idx = 0; idx < n_nodes; ++idx) {
+    orders[labels[idx]].push_back(idx + 1);
+  }
+  // the clusters without orders are dropped
+  orders.erase(std::remove_if(orders.begin(),
+                              orders.end(),
+                              [](const auto& cluster) { return cluster.size() == 1; }),
+               orders.end());
+  const auto n_vehicles = split_fleet(data_model, orders);
+
+  std::vector<std::unique_ptr<sub_model_t<i_t, f_t>>> sub_models;
+  std::vector<data_model_view_t<i_t, f_t>*> sub_model_ptrs;
+  i_t first_vehicle = 0;
+  for (size_t c = 0; c < orders.size(); ++c) {
+    std::vector<i_t> vehicles(n_vehicles[c]);
+    std::iota(vehicles.begin(), vehicles.end(), first_vehicle);
+    first_vehicle += n_vehicles[c];
+    sub_models.push_back(make_sub_model(data_model, orders[c], vehicles));
+    sub_model_ptrs.push_back(&sub_models.back()->data_model);
+  }
+  RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // the clusters beyond the number of threads are solved in later waves
+  const int n_waves        = (orders.size() + omp_get_max_threads() - 1) / omp_get_max_threads();
+  auto sub_settings        = full_settings;
+  sub_settings.time_limit_ = full_settings.time_limit_ * cluster_time_share / n_waves;
+  auto sub_solutions       = batch_solve(sub_model_ptrs, sub_settings);
+
+  // the routes of the clusters in the orders and vehicles of the full model
+  std::vector<i_t> h_vehicle_ids, h_routes;
+  std::vector<node_type_t> h_types;
+  for (size_t c = 0; c < sub_solutions.size(); ++c) {
+    const auto& solution = sub_solutions[c];
+    if (solution.get_status() != solution_status_t::SUCCESS ||
+        !solution.get_unserviced_nodes().is_empty()) {
+      CUOPT_LOG_INFO("Cluster %zu is not solved, solving the full model", c);
+      return solve(data_model, full_settings);
+    }
+    auto route    = cuopt::host_copy(solution.get_route(), stream);
+    auto truck_id = cuopt::host_copy(solution.get_truck_id(), stream);
+    auto types    = cuopt::host_copy(solution.get_node_types(), stream);
+    for (size_t i = 0; i < route.size(); ++i) {
+      if (types[i] == (i_t)node_type_t::DEPOT) { continue; }
+      h_vehicle_ids.push_back(sub_models[c]->vehicles[truck_id[i]]);
+      h_routes.push_back(sub_models[c]->orders[route[i]]);
+      h_types.push_back(node_type_t::DELIVERY);
+    }
+  }
+  std::vector<i_t> h_sol_offsets{0, (i_t)h_routes.size()};
+
+  auto model         = data_model;
+  auto d_vehicle_ids = cuopt::device_copy(h_vehicle_ids, stream);
+  auto d_routes      = cuopt::device_copy(h_routes, stream);
+  auto d_types       = cuopt::device_copy(h_types, stream);
+  auto d_sol_offsets = cuopt::device_copy(h_sol_offsets, stream);
+  model.add_initial_solutions(d_vehicle_ids.data(),
+                              d_routes.data(),
+                              d_types.data(),
+                              d_sol_offsets.data(),
+                              h_routes.size(),
+                              h_sol_offsets.size());
+  full_settings.time_limit_ *= 1. - cluster_time_share;
+  return solve(model, full_settings);
+}
+
+template bool is_decomposable(data_model_view_t<int, float> const& data_model,
+                              solver_settings_t<int, float> const& settings);
+template assignment_t<int> solve_decomposed(data_model_view_t<int, float> const& data_model,
+                                            solver_settings_t<int, float> const& settings);
+
+}  // namespace detail
+}  // namespace routing
+}  // namespace cuopt
@@ -0,0 +1,35 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/routing/assignment.hpp>
+#include <cuopt/routing/data_model_view.hpp>
+#include <cuopt/routing/solver_settings.hpp>
+
+namespace cuopt {
+namespace routing {
+namespace detail {
+
+/*! \brief { Whether the model can be split in independent sub models of clustered orders. Only
+ * the orders visited from a single depot, without pickup and delivery pairs, breaks, prizes,
+ * precedences, vehicle order matches, vehicle types and initial solutions are split } */
+template <typename i_t, typename f_t>
+bool is_decomposable(data_model_view_t<i_t, f_t> const& data_model,
+                     solver_settings_t<i_t, f_t> const& settings);
+
+/*! \brief { Clusters the orders on the device and solves every cluster as an independent sub
+ * model with a share of the fleet, concurrently. The routes of the clusters are then merged into
+ * an initial solution of the full model, whose solve improves the routes across the cluster
+ * borders. The full model is solved from scratch when a cluster cannot serve all of its orders } */
+template <typename i_t, typename f_t>
+assignment_t<i_t> solve_decomposed(data_model_view_t<i_t, f_t> const& data_model,
+                                   solver_settings_t<i_t, f_t> const& settings);
+
+}  // namespace detail
+}  // namespace routing
+}  // namespace cuopt
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -190,6 +190,8 @@ struct time_dimension_info_t {
   HDI bool should_compute_travel_time() const { return has_max_constraint || has_travel_time_obj; }
   bool has_max_constraint  = false;
   bool has_travel_time_obj = false;
+  //! the transit times depend on the departure times, see mdarray_view_t::get_time_value_at
+  bool is_time_dependent = false;
   HDI constexpr bool has_constraints() const { return true; }
 };
 
@@ -0,0 +1,212 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "shortest_paths.hpp"
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_scalar.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cuopt {
+namespace distance_engine {
+namespace detail {
+
+// the labels of a batch are limited to 1GiB
+constexpr size_t max_batch_labels = 1 << 27;
+// number of relaxation rounds launched between two checks of the frontier
+constexpr int rounds_per_check    = 8;
+constexpr float unset_distance    = 1.0e+30;
+constexpr uint32_t no_predecessor = 0xffffffff;
+
+// Non negative floats compare as their bits, so that the distance is in the high bits for the
+// labels to be compared as integers
+__device__ __forceinline__ uint64_t pack_label(float distance, uint32_t predecessor)
+{
+  return ((uint64_t)__float_as_uint(distance) << 32) | predecessor;
+}
+
+__device__ __forceinline__ float label_distance(uint64_t label)
+{
+  return __uint_as_float(label >> 32);
+}
+
+template <typename i_t>
+__global__ void init_labels_kernel(uint64_t* labels,
+                                   uint8_t* frontier,
+                                   uint8_t* next_frontier,
+                                   const i_t* targets,
+                                   i_t first_source,
+                                   i_t n_sources,
+                                   i_t n_vertices)
+{
+  const size_t n_labels = (size_t)n_sources * n_vertices;
+  for (size_t idx = blockIdx.x * (size_t)blockDim.x + threadIdx.x; idx < n_labels;
+       idx += (size_t)gridDim.x * blockDim.x) {
+    const i_t source     = idx / n_vertices;
+    const i_t vertex     = idx % n_vertices;
+    const bool is_source = targets[first_source + source] == vertex;
+    labels[idx]          = pack_label(is_source ? 0.f : unset_distance, no_predecessor);
+    frontier[idx]        = is_source;
+    next_frontier[idx]   = 0;
+  }
+}
+
+// Relaxes the out edges of the vertices of the frontier. A label is only replaced by a strictly
+// shorter distance so that the predecessors form a tree even with zero weight edges
+template <typename i_t, typename f_t>
+__global__ void relax_kernel(uint64_t* labels,
+                             uint8_t* frontier,
+                             uint8_t* next_frontier,
+                             const i_t* offsets,
+                             const i_t* indices,
+                             const f_t* weights,
+                             i_t n_sources,
+                             i_t n_vertices,
+                             int* changed)
+{
+  const size_t n_labels = (size_t)n_sources * n_vertices;
+  for (size_t idx = blockIdx.x * (size_t)blockDim.x + threadIdx.x; idx < n_labels;
+       idx += (size_t)gridDim.x * blockDim.x) {
+    if (!frontier[idx]) { continue; }
+    frontier[idx]      = 0;
+    const i_t u        = idx % n_vertices;
+    const size_t row   = idx - u;
+    const float dist_u = label_distance(labels[idx]);
+    for (i_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+      const i_t v              = indices[e];
+      const float new_dist     = dist_u + weights[e];
+      const uint64_t new_label = pack_label(new_dist, u);
+      uint64_t* label          = &labels[row + v];
+      uint64_t old             = *label;
+      while (label_distance(old) > new_dist) {
+        const uint64_t prev = atomicCAS((unsigned long long*)label, old, new_label);
+        if (prev == old) {
+          next_frontier[row + v] = 1;
+          *changed               = 1;
+          break;
+        }
+        old = prev;
+      }
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+__global__ void extract_kernel(const uint64_t* labels,
+                               const i_t* targets,
+                               f_t* cost_matrix,
+                               int32_t* predecessors,
+                               i_t first_source,
+                               i_t n_sources,
+                               i_t n_targets,
+                               i_t n_vertices)
+{
+  const size_t n_labels = (size_t)n_sources * n_vertices;
+  for (size_t idx = blockIdx.x * (size_t)blockDim.x + threadIdx.x; idx < n_labels;
+       idx += (size_t)gridDim.x * blockDim.x) {
+    predecessors[idx] = (int32_t)(uint32_t)labels[idx];
+  }
+  const size_t n_costs = (size_t)n_sources * n_targets;
+  for (size_t idx = blockIdx.x * (size_t)blockDim.x + threadIdx.x; idx < n_costs;
+       idx += (size_t)gridDim.x * blockDim.x) {
+    const i_t source = idx / n_targets;
+    const i_t target = idx % n_targets;
+    cost_matrix[(size_t)(first_source + source) * n_targets + target] =
+      label_distance(labels[(size_t)source * n_vertices + targets[target]]);
+  }
+}
+
+template <typename i_t, typename f_t>
+shortest_paths_t<i_t, f_t>::shortest_paths_t(raft::handle_t const* handle_ptr_,
+                                             i_t const* offsets_,
+                                             i_t n_vertices_,
+                                             i_t const* indices_,
+                                             f_t const* weights_)
+  : handle_ptr(handle_ptr_),
+    n_vertices(n_vertices_),
+    offsets(n_vertices_ + 1, handle_ptr_->get_stream()),
+    indices(offsets_[n_vertices_], handle_ptr_->get_stream()),
+    weights(offsets_[n_vertices_], handle_ptr_->get_stream()),
+    targets(0, handle_ptr_->get_stream()),
+    labels(0, handle_ptr_->get_stream()),
+    frontier(0, handle_ptr_->get_stream()),
+    next_frontier(0, handle_ptr_->get_stream())
+{
+  static_assert(std::is_same_v<f_t, float>, "The labels pack 32 bit distances");
+  auto stream = handle_ptr->get_stream();
+  raft::copy(offsets.data(), offsets_, offsets.size(), stream);
+  raft::copy(indices.data(), indices_, indices.size(), stream);
+  raft::copy(weights.data(), weights_, weights.size(), stream);
+}
+
+template <typename i_t, typename f_t>
+i_t shortest_paths_t<i_t, f_t>::run_batch(f_t* d_cost_matrix,
+                                          i_t first_source,
+                                          i_t n_target_locations)
+{
+  auto stream           = handle_ptr->get_stream();
+  const i_t max_batch   = std::max<size_t>(1, max_batch_labels / n_vertices);
+  const i_t n_sources   = std::min(max_batch, n_target_locations - first_source);
+  const size_t n_labels = (size_t)n_sources * n_vertices;
+  labels.resize(n_labels, stream);
+  frontier.resize(n_labels, stream);
+  next_frontier.resize(n_labels, stream);
+
+  constexpr i_t TPB  = 256;
+  const i_t max_grid = handle_ptr->get_device_properties().multiProcessorCount * 32;
+  const i_t n_blocks = std::min<size_t>((n_labels + TPB - 1) / TPB, max_grid);
+  init_labels_kernel<i_t><<<n_blocks, TPB, 0, stream>>>(labels.data(),
+                                                        frontier.data(),
+                                                        next_frontier.data(),
+                                                        targets.data(),
+                                                        first_source,
+                                                        n_sources,
+                                                        n_vertices);
+  RAFT_CHECK_CUDA(stream);
+
+  rmm::device_scalar<int> changed(1, stream);
+  while (changed.value(stream)) {
+    changed.set_value_to_zero_async(stream);
+    for (int round = 0; round < rounds_per_check; ++round) {
+      relax_kernel<i_t, f_t><<<n_blocks, TPB, 0, stream>>>(labels.data(),
+                                                           frontier.data(),
+                                                           next_frontier.data(),
+                                                           offsets.data(),
+                                                           indices.data(),
+                                                           weights.data(),
+                                                           n_sources,
+                                                           n_vertices,
+                                                           changed.data());
+      RAFT_CHECK_CUDA(stream);
+      std::swap(frontier, next_frontier);
+    }
+  }
+
+  rmm::device_uvector<int32_t> predecessors(n_labels, stream);
+  extract_kernel<i_t, f_t><<<n_blocks, TPB, 0, stream>>>(labels.data(),
+                                                         targets.data(),
+                                                         d_cost_matrix,
+                                                         predecessors.data(),
+                                                         first_source,
+                                                         n_sources,
+                                                         (i_t)targets.size(),
+                                                         n_vertices);
+  RAFT_CHECK_CUDA(stream);
+  h_predecessors.resize(n_labels);
+  raft::copy(h_predecessors.data(), predecessors.data(), n_labels, stream);
+  handle_ptr->sync_stream();
+  return n_sources;
+}
+
+template class shortest_paths_t<int, float>;
+
+}  // namespace detail
+}  // namespace distance_engine
+}  // namespace cuopt
@@ -0,0 +1,79 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cuopt {
+namespace distance_engine {
+namespace detail {
+
+/*! \brief { Multi source shortest paths on the device. The graph is copied once to the device so
+ * that repeated queries on the same graph skip the transfer. The sources are solved in batches
+ * with a frontier based Bellman-Ford, each batch keeping a distance and a predecessor per source
+ * and vertex } */
+template <typename i_t, typename f_t>
+class shortest_paths_t {
+ public:
+  shortest_paths_t(raft::handle_t const* handle_ptr,
+                   i_t const* offsets,
+                   i_t n_vertices,
+                   i_t const* indices,
+                   f_t const* weights);
+
+  /*! \brief { Writes the distances between the target locations to the device cost matrix.
+   * on_batch is called with the first source of every batch, the number of sources of the batch
+   * and the host predecessors of the batch, one row of n_vertices per source } */
+  template <typename on_batch_t>
+  void compute(f_t* d_cost_matrix,
+               i_t const* target_locations,
+               i_t n_target_locations,
+               on_batch_t&& on_batch);
+
+ private:
+  i_t run_batch(f_t* d_cost_matrix, i_t first_source, i_t n_target_locations);
+
+  raft::handle_t const* handle_ptr{nullptr};
+  i_t n_vertices;
+  rmm::device_uvector<i_t> offsets;
+  rmm::device_uvector<i_t> indices;
+  rmm::device_uvector<f_t> weights;
+  rmm::device_uvector<i_t> targets;
+  // packed distance and predecessor of every vertex for every source of the batch
+  rmm::device_uvector<uint64_t> labels;
+  rmm::device_uvector<uint8_t> frontier;
+  rmm::device_uvector<uint8_t> next_frontier;
+  std::vector<int32_t> h_predecessors;
+};
+
+template <typename i_t, typename f_t>
+template <typename on_batch_t>
+void shortest_paths_t<i_t, f_t>::compute(f_t* d_cost_matrix,
+                                         i_t const* target_locations,
+                                         i_t n_target_locations,
+                                         on_batch_t&& on_batch)
+{
+  auto stream = handle_ptr->get_stream();
+  targets.resize(n_target_locations, stream);
+  raft::copy(targets.data(), target_locations, n_target_locations, stream);
+  for (i_t first_source = 0; first_source < n_target_locations;) {
+    const i_t n_sources = run_batch(d_cost_matrix, first_source, n_target_locations);
+    on_batch(first_source, n_sources, h_predecessors);
+    first_source += n_sources;
+  }
+}
+
+}  // namespace detail
+}  // namespace distance_engine
+}  // namespace cuopt
@@ -8,6 +8,7 @@
 #include <cuopt/error.hpp>
 #include <cuopt/routing/distance_engine/waypoint_matrix.hpp>
 
+#include <routing/distance_engine/shortest_paths.hpp>
 #include <routing/utilities/check_input.hpp>
 
 #include <raft/util/cudart_utils.hpp>
@@ -18,8 +19,8 @@
 #include <limits>
 #include <memory>
 #include <numeric>
-#include <queue>
 #include <stack>
+#include <type_traits>
 #include <vector>
 
 namespace cuopt {
@@ -60,72 +61,10 @@ static void add_path(pm_t& predecessor_matrix,
 }
 
 template <typename i_t, typename f_t>
-static void write_cost_matrix(std::vector<f_t>& cost_matrix,
-                              i_t id_src,
-                              std::vector<f_t> const& dist,
-                              i_t const* target_locations,
-                              i_t n_target_locations)
+void waypoint_matrix_t<i_t, f_t>::mpsp(f_t* d_cost_matrix,
+                                       i_t const* target_locations,
+                                       i_t n_target_locations)
 {
-  for (std::size_t i = 0; i != n_target_locations; ++i)
-    cost_matrix[id_src * n_target_locations + i] = dist[target_locations[i]];
-}
-
-template <typename i_t, typename f_t>
-template <typename pm_t>
-void waypoint_matrix_t<i_t, f_t>::dijkstra(pm_t& predecessor_matrix,
-                                           std::vector<f_t>& cost_matrix,
-                                           i_t src,
-                                           i_t const* target_locations,
-                                           i_t n_target_locations,
-                                           i_t id_src)
-{
-  using node_t = std::pair<f_t, i_t>;
-
-  constexpr f_t unset_val = 1.0e+30;
-
-  std::vector<f_t> dist(n_vertices_, unset_val);
-  std::priority_queue<node_t, std::vector<node_t>, std::greater<node_t>> min_q;
-
-  // Init src in dist array and in priority queue
-  min_q.emplace(static_cast<f_t>(0), src);
-  dist[src] = static_cast<f_t>(0);
-
-  while (!min_q.empty()) {
-    // Get node with minimum distance node out of the priority queue
-    const auto [distance, u] = min_q.top();
-    min_q.pop();
-
-    if (distance > dist[u]) continue;
-
-    const auto nbr_offsets     = offsets_[u];
-    const auto nbr_offset_last = offsets_[u + 1];
-
-    // Loop through neighbor vertices
-    for (auto nbr_offset = nbr_offsets; nbr_offset != nbr_offset_last; ++nbr_offset) {
-      const auto v            = indices_[nbr_offset];
-      const auto new_distance = distance + weights_[nbr_offset];
-      // Update dist array and priority queue structure if new path is smaller
-      if (new_distance < dist[v]) {
-        // Store offset & edge id for easier time matrix computation
-        predecessor_matrix[id_src][v] = u;
-        dist[v]                       = new_distance;
-        min_q.emplace(new_distance, v);
-      }
-    }
-  }
-
-  // Write in cost matrix
-  write_cost_matrix(cost_matrix, id_src, dist, target_locations, n_target_locations);
-}
-
-template <typename i_t, typename f_t>
-std::vector<f_t> waypoint_matrix_t<i_t, f_t>::mpsp(i_t const* target_locations,
-                                                   i_t n_target_locations)
-{
-  // TODO : data is not pinned, passing buffer to vector is not really easy so at worst just use
-  // regular ptr
-  std::vector<f_t> cost_matrix(n_target_locations * n_target_locations);
-
   if (n_vertices_ < std::numeric_limits<uint16_t>::max()) {
     // -1 gets round up to uint16_t::max
     predecessor_matrix16_ = std::vector<std::vector<uint16_t>>(
@@ -136,12 +75,35 @@ std::vector<f_t> waypoint_matrix_t<i_t, f_t>::mpsp(i_t const* target_locations,
       std::vector<std::vector<int32_t>>(n_target_locations, std::vector<int32_t>(n_vertices_, -1));
   }
 
-// Run n_target_locations dijkstras in parallel with each target as source
-#pragma omp parallel for
-  for (std::size_t i = 0; i < n_target_locations; ++i)
-    dispatch(dijkstra, cost_matrix, target_locations[i], target_locations, n_target_locations, i);
+  // The graph is copied to the device on the first query
+  if (!shortest_paths_) {
+    shortest_paths_ = std::make_shared<detail::shortest_paths_t<i_t, f_t>>(
+      handle_ptr_, offsets_, n_vertices_, indices_, weights_);
+  }
 
-  return cost_matrix;
+  // Run the shortest paths on the device with each target as source, the cost matrix is written on
+  // the device and the predecessors of each batch of sources are kept on the host
+  auto copy_predecessors = [](auto& predecessor_matrix,
+                              i_t first_source,
+                              i_t n_sources,
+                              std::vector<int32_t> const& predecessors,
+                              i_t n_vertices) {
+    using value_t = typename std::decay_t<decltype(predecessor_matrix)>::value_type::value_type;
+    for (i_t i = 0; i < n_sources; ++i) {
+      auto row = predecessors.begin() + (std::size_t)i * n_vertices;
+      std::transform(row,
+                     row + n_vertices,
+                     predecessor_matrix[first_source + i].begin(),
+                     [](int32_t pred) { return static_cast<value_t>(pred); });
+    }
+  };
+  shortest_paths_->compute(
+    d_cost_matrix,
+    target_locations,
+    n_target_locations,
+    [&](i_t first_source, i_t n_sources, std::vector<int32_t> const& predecessors) {
+      dispatch(copy_predecessors, first_source, n_sources, predecessors, n_vertices_);
+    });
 }
 
 // Negative values or not sorted or out of bounds (more than edges)
@@ -244,10 +206,7 @@ void waypoint_matrix_t<i_t, f_t>::compute_cost_matrix(f_t* d_cost_matrix,
   // Target locations validity checks
   check_target_locations(target_locations, n_target_locations, n_vertices_);
 
-  std::vector<f_t> cost_matrix = mpsp(target_locations, n_target_locations);
-
-  raft::copy(d_cost_matrix, cost_matrix.data(), cost_matrix.size(), stream_view_);
-  stream_view_.synchronize();
+  mpsp(d_cost_matrix, target_locations, n_target_locations);
 }
 
 // Location values are greater or equal to n_target_locations
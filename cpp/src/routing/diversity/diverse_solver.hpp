@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -9,6 +9,9 @@
 
 #include "diversity_config.hpp"
 #include "helpers.hpp"
+#include "incumbent_stream.hpp"
+#include "island_exchange.hpp"
+#include "operator_bandit.hpp"
 #include "population.hpp"
 
 #include <utilities/seed_generator.cuh>
@@ -24,6 +27,7 @@
 #include <cuda_profiler_api.h>
 
 #include <array>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -80,16 +84,17 @@ struct recombine_stats {
 
   void add_attempt() { ++attempts; }
 
-  void print(const char* recombiner_name, file_buffer_t& f)
+  void print(const char* recombiner_name, double elapsed_seconds, file_buffer_t& f)
   {
     fprintf(f.file_ptr,
             "%s : (better_than_one: %d better_than_both: %d success: %d "
-            "attempts: %d)\t",
+            "attempts: %d attempts_per_second: %f)\t",
             recombiner_name,
             better_than_one,
             better_than_both,
             success,
-            attempts);
+            attempts,
+            elapsed_seconds > 0. ? attempts / elapsed_seconds : 0.);
   }
 };
 
@@ -104,6 +109,8 @@ struct all_recombine_stats {
 
   // enum of the last attempted recombiner
   std::optional<recombiner_t> last_attempt;
+  // start of the counted attempts, for the attempt rates
+  std::chrono::steady_clock::time_point start_time;
 
   void reset()
   {
@@ -111,6 +118,7 @@ struct all_recombine_stats {
       stats[i].reset();
     }
     last_attempt.reset();
+    start_time = std::chrono::steady_clock::now();
   }
 
   void add_attempt(recombiner_t r)
@@ -129,9 +137,11 @@ struct all_recombine_stats {
 
   void print([[maybe_unused]] file_buffer_t& f)
   {
+    [[maybe_unused]] const double elapsed_seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
     benchmark_call(fprintf(f.file_ptr, "Recombiner stats: "));
     for (size_t i = 0; i < recombiner_count; ++i) {
-      benchmark_call(stats[i].print(recombiner_labels[i], f));
+      benchmark_call(stats[i].print(recombiner_labels[i], elapsed_seconds, f));
     }
     benchmark_call(fprintf(f.file_ptr, "\n"));
     benchmark_call(fflush(f.file_ptr));
@@ -184,6 +194,8 @@ struct solve {
   injection_info_t<allocator, solution, problem> injection_info;
 
   all_recombine_stats recombine_stats;
+  //! Picks the recombiners by the improvement per millisecond of their offsprings
+  operator_bandit_t<static_cast<size_t>(recombiner_t::SIZE)> recombiner_bandit;
 
   //! Diversity levels (clearing radius) used in the improvement phase
   std::vector<double> diversity_levels;
@@ -216,12 +228,22 @@ struct solve {
 
   // temporary solution keeps the allocations alive
   std::pair<solution, solution> temp_pair;
+  // offsprings improved side by side when the pool allocator has lanes
+  std::vector<solution> offspring_batch;
   // buffer changer struct in raii style
   file_buffer_t f;
   // random number generator
   std::mt19937 rng;
   // control variable to limit GES time for prize collection
   double ges_time_fraction = 1.0;
+  // set when the islands are solved concurrently on several devices
+  island_exchange_t* island_exchange{nullptr};
+  int island_id{0};
+  std::vector<int> seen_migrant_versions;
+  // set when the best solutions are passed to a callback or dumped to a file
+  incumbent_stream_t* incumbent_stream{nullptr};
+  // only the cost and feasibility of the last streamed solution are kept
+  island_exchange_t::migrant_t streamed_incumbent;
 
   solve(const problem* p_,
         costs& final_weights_,
@@ -283,6 +305,9 @@ struct solve {
     working_population.threshold = diversity_levels.back();
     recombine_stats.reset();
 
+    const int n_lanes = diversity_config_t<int>::concurrent_local_search(p->get_num_orders());
+    if (n_lanes > 1) { pool_allocator.create_lanes(n_lanes); }
+
     if (injection_info.has_info()) { injection_info.load_solutions(); }
     // When we have prize collection, don't spend too much time on ges
     if (p->has_prize_collection()) { ges_time_fraction = 0.1; }
@@ -663,6 +688,9 @@ struct solve {
       // Adjust working population weights:
       working_population.change_weights(weights);
 
+      if (!timer.check_time_limit()) { migrate(); }
+      stream_incumbent();
+
       benchmark_call(display_pool(reserve_population, "Updated reserve: \n"));
       if (reserve_population.current_size() < 5) { refill_reserve(target_vehicle_ids_); }
       recombine_stats.print(f);
@@ -691,6 +719,7 @@ struct solve {
       generate_from_dir(path);
     }
     benchmark_call(display_pool(reserve_population));
+    stream_incumbent();
 
     if (check_reserve_degenerated_or_time_reached()) {
       print_population_best(reserve_population);
@@ -699,9 +728,53 @@ struct solve {
 
     start_reserve_threshold_adjustment();
     run_working_loop();
+    stream_incumbent();
     print_population_best(reserve_population);
   }
 
+  /*! \brief { Hands a host copy of the best solution of the reserve to the incumbent stream when
+   * it improved since the previous call } */
+  void stream_incumbent()
+  {
+    if (incumbent_stream == nullptr || reserve_population.current_size() == 0) { return; }
+    auto best = reserve_population.is_feasible() ? reserve_population.best_feasible()
+                                                 : reserve_population.best();
+    island_exchange_t::migrant_t candidate;
+    candidate.feasible = best.is_feasible();
+    candidate.cost     = best.get_cost(final_weights);
+    if (!candidate.is_better_than(streamed_incumbent)) { return; }
+    streamed_incumbent = candidate;
+    incumbent_stream->publish(to_migrant(best));
+  }
+
+  /*! \brief { Publishes the best solution of the reserve to the other islands and adds the
+   * best solutions they published since the previous call to the reserve } */
+  void migrate()
+  {
+    if (island_exchange == nullptr) { return; }
+    if (reserve_population.current_size() > 0) {
+      auto best = reserve_population.is_feasible() ? reserve_population.best_feasible()
+                                                   : reserve_population.best();
+      island_exchange->publish(island_id, to_migrant(best));
+    }
+    for (auto& migrant : island_exchange->fetch(island_id, seen_migrant_versions)) {
+      if (migrant.routes.empty()) { continue; }
+      auto migrant_sol = from_migrant(migrant);
+      reserve_population.add_solution(timer.elapsed_time(), migrant_sol);
+    }
+  }
+
+  /*! \brief { Host copies of at most n best solutions of the reserve } */
+  std::vector<island_exchange_t::migrant_t> get_elites(int n)
+  {
+    std::vector<island_exchange_t::migrant_t> elites;
+    if (reserve_population.current_size() == 0) { return elites; }
+    for (auto& sol : reserve_population.get_n_best(n)) {
+      elites.push_back(to_migrant(sol));
+    }
+    return elites;
+  }
+
   /*! \brief { Is there soltution in the population? }*/
   bool is_best() { return (reserve_population.current_size() > 0); }
 
@@ -709,6 +782,35 @@ struct solve {
   solution get_best() { return reserve_population.best(); }
 
  private:
+  island_exchange_t::migrant_t to_migrant(solution& sol)
+  {
+    island_exchange_t::migrant_t migrant;
+    migrant.feasible = sol.is_feasible();
+    migrant.cost     = sol.get_cost(final_weights);
+    for (const auto& route : sol.get_routes()) {
+      migrant.vehicle_ids.push_back(route.vehicle_id);
+      auto& nodes = migrant.routes.emplace_back();
+      for (auto node = route.start; !node.is_depot(); node = sol.succ[node.node()]) {
+        nodes.push_back(node);
+      }
+    }
+    return migrant;
+  }
+
+  solution from_migrant(const island_exchange_t::migrant_t& migrant)
+  {
+    std::vector<std::pair<int, std::vector<detail::NodeInfo<>>>> sol_routes;
+    for (size_t i = 0; i < migrant.routes.size(); ++i) {
+      sol_routes.push_back({(int)i, migrant.routes[i]});
+    }
+    solution S(p, pool_allocator.sol_handles[0].get(), migrant.vehicle_ids);
+    std::vector<int> sequence(migrant.routes.size());
+    std::iota(sequence.begin(), sequence.end(), 0);
+    S.remove_routes(sequence);
+    S.add_new_routes(sol_routes);
+    return S;
+  }
+
   /*! \brief { If reserve become to small (possibly due to finding solutions
    * similar to all other) refill with generated ones } */
   void refill_reserve(const std::vector<int>& vehicle_ids, int sols_num = 5)
@@ -1048,6 +1150,15 @@ struct solve {
           run_expensive_recombiners = true;
           run_cycle_finder          = true;
         }
+        if (lm.n_lanes() > 1) {
+          // a batch counts as one try per offspring
+          k -= static_cast<int>(lm.n_lanes()) - 1;
+          if (improve_offspring_batch(p, run_expensive_recombiners, run_cycle_finder)) {
+            improved = true;
+            break;
+          }
+          continue;
+        }
         double cost_first  = temp_pair.first.get_cost(weights);
         double cost_second = temp_pair.second.get_cost(weights);
         bool guiding       = false;
@@ -1056,15 +1167,26 @@ struct solve {
         temp_pair.first.unset_routes_to_search();
         temp_pair.second.unset_routes_to_search();
         int working_insertion_index = -1;
+        const double best_parent_cost = std::min(cost_first, cost_second);
+        double offspring_cost          = best_parent_cost;
+        const auto recombine_start     = std::chrono::steady_clock::now();
+        recombine_stats.last_attempt.reset();
         if (recombine(temp_pair.first, temp_pair.second, guiding, run_expensive_recombiners)) {
           auto& offspring = guiding == false ? temp_pair.first : temp_pair.second;
           if (!feasible_only || offspring.is_feasible()) {
             lm.improve(offspring, weights, improvement_timer.remaining_time(), run_cycle_finder);
-            recombine_stats.update_improve_stats(
-              offspring.get_cost(weights), cost_first, cost_second);
+            offspring_cost = offspring.get_cost(weights);
+            recombine_stats.update_improve_stats(offspring_cost, cost_first, cost_second);
             working_insertion_index = p.add_solution(timer.elapsed_time(), offspring);
           }
         }
+        if (recombine_stats.last_attempt.has_value()) {
+          const double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - recombine_start)
+                                      .count();
+          recombiner_bandit.add_reward(
+            recombine_stats.last_attempt.value(), best_parent_cost, offspring_cost, elapsed_ms);
+        }
         temp_pair.first.set_routes_to_search();
         temp_pair.second.set_routes_to_search();
         // if we have inserted to the first 2 positions
@@ -1076,6 +1198,86 @@ struct solve {
     }
   }
 
+  /*! \brief { Recombines a pair of the population per lane and improves the offsprings side by
+   * side. Returns true when an offspring was inserted in the first positions of p } */
+  bool improve_offspring_batch(population<allocator, solution, problem>& p,
+                               bool run_expensive_recombiners,
+                               bool run_cycle_finder)
+  {
+    raft::common::nvtx::range fun_scope("improve_offspring_batch");
+    const size_t n_lanes = lm.n_lanes();
+    while (offspring_batch.size() < n_lanes) {
+      offspring_batch.emplace_back(p.problem_ptr, pool_allocator.sol_handles[0].get());
+    }
+    struct attempt_t {
+      recombiner_t recombiner;
+      double cost_first;
+      double cost_second;
+      double recombine_ms;
+    };
+    std::vector<solution*> offsprings;
+    std::vector<attempt_t> attempts;
+    for (size_t b = 0; b < n_lanes && p.current_size() >= 2; ++b) {
+      constexpr bool tournament = true;
+      p.get_two_random(temp_pair, tournament);
+      const double cost_first  = temp_pair.first.get_cost(weights);
+      const double cost_second = temp_pair.second.get_cost(weights);
+      bool guiding             = false;
+      temp_pair.first.unset_routes_to_search();
+      temp_pair.second.unset_routes_to_search();
+      const auto recombine_start = std::chrono::steady_clock::now();
+      recombine_stats.last_attempt.reset();
+      bool added = false;
+      if (recombine(temp_pair.first, temp_pair.second, guiding, run_expensive_recombiners)) {
+        auto& offspring = guiding == false ? temp_pair.first : temp_pair.second;
+        if (!feasible_only || offspring.is_feasible()) {
+          auto& copy = offspring_batch[offsprings.size()];
+          copy       = offspring;
+          copy.sol.copy_routes_to_search(offspring.sol);
+          offsprings.push_back(&copy);
+          added = true;
+        }
+      }
+      const double recombine_ms = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - recombine_start)
+                                    .count();
+      if (added) {
+        attempts.push_back(
+          {recombine_stats.last_attempt.value(), cost_first, cost_second, recombine_ms});
+      } else if (recombine_stats.last_attempt.has_value()) {
+        const double best_parent_cost = std::min(cost_first, cost_second);
+        recombiner_bandit.add_reward(
+          recombine_stats.last_attempt.value(), best_parent_cost, best_parent_cost, recombine_ms);
+      }
+      temp_pair.first.set_routes_to_search();
+      temp_pair.second.set_routes_to_search();
+    }
+    if (offsprings.empty()) { return false; }
+
+    const auto improve_start = std::chrono::steady_clock::now();
+    lm.improve_concurrently(
+      offsprings, weights, improvement_timer.remaining_time(), run_cycle_finder);
+    // the lanes share the time of the batch
+    const double improve_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - improve_start)
+                                .count() /
+                              offsprings.size();
+    bool improved = false;
+    for (size_t i = 0; i < offsprings.size(); ++i) {
+      const auto& attempt         = attempts[i];
+      const double offspring_cost = offsprings[i]->get_cost(weights);
+      recombine_stats.last_attempt = attempt.recombiner;
+      recombine_stats.update_improve_stats(offspring_cost, attempt.cost_first, attempt.cost_second);
+      recombiner_bandit.add_reward(attempt.recombiner,
+                                   std::min(attempt.cost_first, attempt.cost_second),
+                                   offspring_cost,
+                                   attempt.recombine_ms + improve_ms);
+      const int insertion_index = p.add_solution(timer.elapsed_time(), *offsprings[i]);
+      if (insertion_index != -1 && insertion_index <= 3) { improved = true; }
+    }
+    return improved;
+  }
+
   void print_route_sizes(solution& a, const char* prefix)
   {
     fprintf(f.file_ptr, "%s : ", prefix);
@@ -1089,8 +1291,8 @@ struct solve {
     fflush(f.file_ptr);
   }
 
-  /*! \brief { Recombining two solutions choosing between EAX and SREX at
-   * probablity 1/2 (a learning policy could be applied here). }*/
+  /*! \brief { Recombining two solutions with the recombiner picked by the bandit among the ones
+   * that apply to the problem }*/
   bool recombine(solution& a,
                  solution& b,
                  bool& guiding,
@@ -1124,14 +1326,10 @@ struct solve {
       }
       if (recombine_options.size() == 0) { return false; }
     }
-    std::uniform_int_distribution<int> dist(0, recombine_options.size() - 1);
-
     const auto& dimensions_info = a.problem->dimensions_info;
 
-    // Pick a random element from set
-    auto recombiner_it = std::begin(recombine_options);
-    std::advance(recombiner_it, dist(rng));
-    auto recombiner = *recombiner_it;
+    auto recombiner = recombiner_bandit.select(
+      std::vector<recombiner_t>(recombine_options.begin(), recombine_options.end()), rng);
     recombine_stats.add_attempt(recombiner);
 
     switch (recombiner) {
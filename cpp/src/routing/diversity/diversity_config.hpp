@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -34,6 +34,13 @@ struct diversity_config_t {
   {
     return 5;
   }
+
+  // A local search on a small instance occupies a small part of the device, so the offsprings
+  // of several recombinations are improved side by side on separate streams
+  static constexpr i_t concurrent_local_search(i_t n_orders)
+  {
+    return n_orders <= 500 ? 4 : 1;
+  }
 };
 
 }  // namespace cuopt::routing
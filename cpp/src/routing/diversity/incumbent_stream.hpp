@@ -0,0 +1,140 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include "island_exchange.hpp"
+
+#include <cuopt/routing/assignment.hpp>
+#include <utilities/logger.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <thread>
+
+namespace cuopt {
+namespace routing {
+
+/*! \brief { Passes the best solutions of the search to the user callback and dumps them to the
+ * best results file from a background thread. The solver only hands over a host copy of the
+ * routes, it never waits for the callback or the file. A solution published while the previous
+ * one is being handled replaces the pending one } */
+class incumbent_stream_t {
+ public:
+  using callback_t = std::function<void(const host_assignment_t<int>&, double)>;
+
+  incumbent_stream_t(callback_t callback_, std::ostream* dump_file_, double dump_interval_)
+    : callback(std::move(callback_)),
+      dump_file(dump_file_),
+      dump_interval(dump_interval_),
+      start(std::chrono::steady_clock::now())
+  {
+    if (dump_file != nullptr) { *dump_file << "elapsed_time,cost,feasible,vehicle_count\n"; }
+    worker = std::thread([this]() { run(); });
+  }
+
+  incumbent_stream_t(const incumbent_stream_t&)            = delete;
+  incumbent_stream_t& operator=(const incumbent_stream_t&) = delete;
+
+  /*! \brief { Handles the pending solution, dumps the last one and joins the thread } */
+  ~incumbent_stream_t()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    cv.notify_one();
+    worker.join();
+  }
+
+  void publish(island_exchange_t::migrant_t migrant)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending = std::move(migrant);
+    }
+    cv.notify_one();
+  }
+
+  static host_assignment_t<int> to_host_assignment(const island_exchange_t::migrant_t& migrant)
+  {
+    host_assignment_t<int> assignment;
+    for (size_t i = 0; i < migrant.routes.size(); ++i) {
+      for (const auto& node : migrant.routes[i]) {
+        assignment.route.push_back(node.node());
+        assignment.truck_id.push_back(migrant.vehicle_ids[i]);
+        assignment.locations.push_back(node.location());
+        assignment.node_types.push_back((int)node.node_type());
+      }
+    }
+    return assignment;
+  }
+
+ private:
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void dump(const island_exchange_t::migrant_t& migrant)
+  {
+    *dump_file << elapsed() << "," << migrant.cost << "," << migrant.feasible << ","
+               << migrant.routes.size() << "\n";
+    dump_file->flush();
+    last_dump = elapsed();
+  }
+
+  void run()
+  {
+    std::optional<island_exchange_t::migrant_t> undumped;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cv.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+        return pending.has_value() || stopping;
+      });
+      auto migrant = std::move(pending);
+      pending.reset();
+      bool stop = stopping && !migrant.has_value();
+      lock.unlock();
+      if (migrant.has_value()) {
+        try {
+          if (callback) { callback(to_host_assignment(*migrant), migrant->cost); }
+        } catch (const std::exception& e) {
+          CUOPT_LOG_ERROR("Error in the incumbent callback: %s", e.what());
+        }
+        if (dump_file != nullptr) { undumped = std::move(migrant); }
+      }
+      if (undumped.has_value() && (stop || elapsed() - last_dump >= dump_interval)) {
+        dump(*undumped);
+        undumped.reset();
+      }
+      if (stop) { return; }
+      lock.lock();
+    }
+  }
+
+  callback_t callback;
+  std::ostream* dump_file;
+  const double dump_interval;
+  const std::chrono::steady_clock::time_point start;
+  double last_dump{0.};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::optional<island_exchange_t::migrant_t> pending;
+  bool stopping{false};
+  // declared last so that it starts once the other members are initialized
+  std::thread worker;
+};
+
+}  // namespace routing
+}  // namespace cuopt
@@ -0,0 +1,105 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include "../structures.hpp"
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+
+/*! \brief { Elite solutions exchanged between islands solved concurrently on different devices.
+ * The solutions are kept on the host as their routes, so that each island rebuilds them on its
+ * own device } */
+struct island_exchange_t {
+  struct migrant_t {
+    bool feasible{false};
+    double cost{std::numeric_limits<double>::max()};
+    std::vector<int> vehicle_ids;
+    std::vector<std::vector<detail::NodeInfo<>>> routes;
+
+    bool is_better_than(const migrant_t& other) const
+    {
+      if (feasible != other.feasible) { return feasible; }
+      return cost < other.cost;
+    }
+  };
+
+  explicit island_exchange_t(int n_islands_)
+    : n_islands(n_islands_), migrants(n_islands_), versions(n_islands_, 0)
+  {
+  }
+
+  /*! \brief { Replaces the migrant of island if the given one is better } */
+  void publish(int island, migrant_t migrant)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (migrants[island].routes.empty() || migrant.is_better_than(migrants[island])) {
+      migrants[island] = std::move(migrant);
+      ++versions[island];
+    }
+  }
+
+  /*! \brief { Returns the migrants of the other islands published since the previous fetch,
+   * seen_versions keeps track of the ones already returned } */
+  std::vector<migrant_t> fetch(int island, std::vector<int>& seen_versions)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    seen_versions.resize(n_islands, 0);
+    std::vector<migrant_t> ret;
+    for (int i = 0; i < n_islands; ++i) {
+      if (i == island || versions[i] == seen_versions[i]) { continue; }
+      seen_versions[i] = versions[i];
+      ret.push_back(migrants[i]);
+    }
+    return ret;
+  }
+
+  /*! \brief { Called once for every island but the first when its search is over, whether it
+   * succeeded or not } */
+  void finish()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++n_finished;
+    }
+    finished_cv.notify_all();
+  }
+
+  /*! \brief { Blocks the first island until the others published their final solutions. The
+   * islands that run until they are stopped see stop_requested from then on } */
+  void wait_for_others()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    stopping = true;
+    finished_cv.wait(lock, [this]() { return n_finished == n_islands - 1; });
+  }
+
+  bool stop_requested()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stopping;
+  }
+
+  const int n_islands;
+
+ private:
+  std::mutex mutex;
+  std::condition_variable finished_cv;
+  std::vector<migrant_t> migrants;
+  std::vector<int> versions;
+  int n_finished{0};
+  bool stopping{false};
+};
+
+}  // namespace routing
+}  // namespace cuopt
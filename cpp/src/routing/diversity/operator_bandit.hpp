@@ -0,0 +1,97 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace cuopt::routing {
+
+/*! \brief { Upper confidence bound bandit scheduling the operators of the search. An arm is
+ * rewarded by the relative cost improvement per millisecond of its pulls, normalized by the best
+ * rate seen so far, and its value is an exponential recency weighted average of the rewards so
+ * that the schedule follows the search as the solutions get harder to improve. } */
+template <size_t n_arms>
+class operator_bandit_t {
+ public:
+  explicit operator_bandit_t(double alpha = 0.05) : alpha_(alpha) {}
+
+  void reset()
+  {
+    arms_.fill(arm_stats_t{});
+    total_pulls_  = 0;
+    reward_scale_ = 0.;
+  }
+
+  /*! \brief { Orders the operators by decreasing upper confidence bound, the operators that were
+   * never pulled come first and ties are broken at random } */
+  template <typename op_t>
+  void order(std::vector<op_t>& ops, std::mt19937& rng) const
+  {
+    std::shuffle(ops.begin(), ops.end(), rng);
+    std::stable_sort(ops.begin(), ops.end(), [this](op_t a, op_t b) {
+      return upper_bound(static_cast<int>(a)) > upper_bound(static_cast<int>(b));
+    });
+  }
+
+  /*! \brief { Operator of largest upper confidence bound among the candidates } */
+  template <typename op_t>
+  op_t select(std::vector<op_t> candidates, std::mt19937& rng) const
+  {
+    order(candidates, rng);
+    return candidates.front();
+  }
+
+  /*! \brief { Rewards a pull of the operator that took elapsed_ms and moved the cost from
+   * cost_before to cost_after } */
+  template <typename op_t>
+  void add_reward(op_t op, double cost_before, double cost_after, double elapsed_ms)
+  {
+    const double gain   = std::max(0., cost_before - cost_after) / (std::abs(cost_before) + 1.);
+    const double rate   = gain / std::max(elapsed_ms, min_elapsed_ms);
+    reward_scale_       = std::max(reward_scale_, rate);
+    const double reward = reward_scale_ > 0. ? rate / reward_scale_ : 0.;
+
+    auto& stats = arms_[static_cast<int>(op)];
+    stats.q_value += alpha_ * (reward - stats.q_value);
+    stats.num_pulls++;
+    total_pulls_++;
+  }
+
+  int num_pulls(int arm) const { return arms_[arm].num_pulls; }
+  double q_value(int arm) const { return arms_[arm].q_value; }
+
+ private:
+  struct arm_stats_t {
+    int num_pulls  = 0;
+    double q_value = 0.5;
+  };
+
+  // Q(a) + sqrt(2 ln(t) / N(a))
+  double upper_bound(int arm) const
+  {
+    const auto& stats = arms_[arm];
+    if (stats.num_pulls == 0) { return std::numeric_limits<double>::infinity(); }
+    return stats.q_value +
+           std::sqrt(2. * std::log(static_cast<double>(total_pulls_)) / stats.num_pulls);
+  }
+
+  // Fast operators can finish faster than the timer resolution
+  static constexpr double min_elapsed_ms = 1e-2;
+
+  std::array<arm_stats_t, n_arms> arms_{};
+  int total_pulls_     = 0;
+  double alpha_        = 0.05;
+  double reward_scale_ = 0.;
+};
+
+}  // namespace cuopt::routing
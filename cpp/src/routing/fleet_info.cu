@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -28,21 +28,52 @@ void populate_matrices(data_model_view_t<i_t, f_t> const& data_model, d_mdarray_
   const auto& cost_matrices         = data_model.get_cost_matrices();
   const auto& transit_time_matrices = data_model.get_transit_time_matrices();
 
-  if (cost_matrices.empty()) { EXE_CUOPT_FAIL("Cost matrix (or matrices) must be specified!"); }
+  const auto& candidate_transit_time_matrices = data_model.get_candidate_transit_time_matrices();
+
+  if (cost_matrices.empty() && data_model.get_candidate_cost_matrices().empty()) {
+    EXE_CUOPT_FAIL("Cost matrix (or matrices) must be specified!");
+  }
 
   for (auto& [vtype, time_matrix] : transit_time_matrices) {
-    if (!cost_matrices.count(vtype)) {
+    if (!data_model.has_cost_matrix(vtype)) {
+      auto msg = std::string("Cost matrix for vehicle type ") + std::to_string(vtype) +
+                 std::string(" is not specified");
+      execute_cuopt_fail(msg);
+    }
+  }
+  for (auto& [vtype, time_matrix] : candidate_transit_time_matrices) {
+    if (!data_model.has_cost_matrix(vtype)) {
+      auto msg = std::string("Cost matrix for vehicle type ") + std::to_string(vtype) +
+                 std::string(" is not specified");
+      execute_cuopt_fail(msg);
+    }
+  }
+  for (auto& [vtype, time_matrix] : data_model.get_time_dependent_transit_time_matrices()) {
+    if (!data_model.has_cost_matrix(vtype)) {
       auto msg = std::string("Cost matrix for vehicle type ") + std::to_string(vtype) +
                  std::string(" is not specified");
       execute_cuopt_fail(msg);
     }
   }
 
+  for (auto& [vtype, scaled] : data_model.get_scaled_matrices()) {
+    if (!has_scaled_matrices(data_model, vtype)) { continue; }
+    cuopt_expects(data_model.get_time_dependent_transit_time_matrices().empty(),
+                  error_type_t::ValidationError,
+                  "Scaled matrices are not supported with time dependent transit times");
+    auto base_type = scaled.get_base_vehicle_type();
+    if (!data_model.has_cost_matrix(base_type) || has_scaled_matrices(data_model, base_type)) {
+      auto msg = std::string("Cost matrix of the base vehicle type ") + std::to_string(base_type) +
+                 std::string(" of scaled matrices is not specified");
+      execute_cuopt_fail(msg);
+    }
+  }
+
   if (n_vehicle_types > 1) {
     const auto& vtypes = data_model.get_vehicle_types();
     auto vtypes_h      = cuopt::host_copy(vtypes, stream_view_);
     for (auto& vtype : vtypes_h) {
-      if (!cost_matrices.count(vtype)) {
+      if (!data_model.has_cost_matrix(vtype)) {
         auto msg = std::string("Cost matrix for vehicle type ") + std::to_string(vtype) +
                    std::string(" is not specified");
         execute_cuopt_fail(msg);
@@ -51,8 +82,9 @@ void populate_matrices(data_model_view_t<i_t, f_t> const& data_model, d_mdarray_
   }
 
   auto n_matrix_types = detail::get_cost_matrix_type_dim<i_t, f_t>(data_model);
-  matrices_ =
-    detail::create_device_mdarray<f_t>(nlocations, n_vehicle_types, n_matrix_types, stream_view_);
+  // the vehicle types with scaled matrices share the matrices of their base types
+  auto n_slots = detail::get_matrix_slots<i_t, f_t>(data_model).size();
+  matrices_ = detail::create_device_mdarray<f_t>(nlocations, n_slots, n_matrix_types, stream_view_);
   detail::fill_mdarray_from_data_model(matrices_, data_model);
 }
 
@@ -209,7 +241,7 @@ void populate_fleet_info(data_model_view_t<i_t, f_t> const& data_model,
 
     std::vector<uint8_t> renumbered_vehicle_types;
     for (auto type : h_vehicle_types) {
-      cuopt_expects(data_model.get_cost_matrix(type) != nullptr,
+      cuopt_expects(data_model.has_cost_matrix(type),
                     error_type_t::ValidationError,
                     "All vehicle cost matrices should be set");
       renumbered_vehicle_types.push_back(vehicle_types_map.at(type));
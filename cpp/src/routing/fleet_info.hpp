@@ -70,7 +70,17 @@ class fleet_info_t {
     v_buckets_.resize(size, stream);
   }
 
-  auto to_host(rmm::cuda_stream_view stream)
+  auto matrices_to_host(rmm::cuda_stream_view stream) const
+  {
+    auto h = detail::create_host_mdarray<f_t>(
+      matrices_.extent[2], matrices_.extent[0], matrices_.extent[1]);
+    raft::copy(h.buffer.data(), matrices_.buffer.data(), matrices_.buffer.size(), stream);
+    h.transforms = host_copy(matrices_.transforms, stream);
+    return h;
+  }
+
+  // The matrices can be left out when they are copied separately, see matrices_to_host
+  auto to_host(rmm::cuda_stream_view stream, bool copy_matrices = true)
   {
     host_t h;
     h.break_offset            = host_copy(v_break_offset_, stream);
@@ -90,9 +100,7 @@ class fleet_info_t {
     h.fleet_order_constraints = fleet_order_constraints_.to_host(stream);
     h.types                   = host_copy(v_types_, stream);
     h.buckets                 = host_copy(v_buckets_, stream);
-    h.matrices                = detail::create_host_mdarray<f_t>(
-      matrices_.extent[2], matrices_.extent[0], matrices_.extent[1]);
-    raft::copy(h.matrices.buffer.data(), matrices_.buffer.data(), matrices_.buffer.size(), stream);
+    if (copy_matrices) { h.matrices = matrices_to_host(stream); }
     return h;
   }
 
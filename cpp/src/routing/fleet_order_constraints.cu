@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -18,7 +18,7 @@ namespace routing {
 namespace detail {
 
 template <typename i_t, typename f_t>
-rmm::device_uvector<bool> generate_vehicle_order_match_matrix(
+rmm::device_uvector<bit_span::word_t> generate_vehicle_order_match_matrix(
   data_model_view_t<i_t, f_t> const& data_model, bool& is_homogenous)
 {
   auto handle_ptr_     = data_model.get_handle_ptr();
@@ -79,22 +79,21 @@ rmm::device_uvector<bool> generate_vehicle_order_match_matrix(
       }
     }
 
-    return cuopt::device_copy(vehicle_order_match_h, stream_view);
+    // one row of packed bits per vehicle
+    const size_t row_words = bit_span::words_for(n_orders);
+    std::vector<bit_span::word_t> packed_order_match_h(row_words * fleet_size, 0);
+    for (i_t vehicle_id = 0; vehicle_id < fleet_size; ++vehicle_id) {
+      for (i_t order_id = 0; order_id < n_orders; ++order_id) {
+        if (vehicle_order_match_h[vehicle_id * n_orders + order_id]) {
+          packed_order_match_h[vehicle_id * row_words + order_id / bit_span::word_bits] |=
+            bit_span::word_t{1} << (order_id % bit_span::word_bits);
+        }
+      }
+    }
+    return cuopt::device_copy(packed_order_match_h, stream_view);
   }
 
-  return rmm::device_uvector<bool>(0, stream_view);
-}
-
-template <typename i_t>
-__global__ void modify_service_times(raft::device_span<i_t> service_times,
-                                     raft::device_span<bool const> order_vehicle_match)
-{
-  cuopt_assert(service_times.size() == order_vehicle_match.size(),
-               "service times and order vehicle match matrix should have same sizes");
-  size_t idx = threadIdx.x + blockDim.x * blockIdx.x;
-  for (; idx < service_times.size(); idx += blockDim.x * gridDim.x) {
-    if (!order_vehicle_match[idx]) { service_times[idx] = std::numeric_limits<i_t>::max(); }
-  }
+  return rmm::device_uvector<bit_span::word_t>(0, stream_view);
 }
 
 template <typename i_t, typename f_t>
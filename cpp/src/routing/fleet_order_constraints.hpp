@@ -8,12 +8,12 @@
 #pragma once
 
 #include <cuopt/routing/data_model_view.hpp>
+#include <utilities/bit_span.hpp>
 #include <utilities/copy_helpers.hpp>
 
 #include <raft/core/span.hpp>
 
 #include <thrust/fill.h>
-#include <thrust/host_vector.h>
 
 #include <vector>
 
@@ -53,16 +53,17 @@ struct fleet_order_constraints_t {
                                               n_orders);
     }
 
-    constexpr auto get_order_match(i_t truck_id) const
+    bit_span get_order_match(i_t truck_id) const
     {
-      if (order_match.empty()) { return raft::span<bool const, is_device>{}; }
-      cuopt_assert(order_match.size() == n_orders * n_vehicles,
+      if (order_match.empty()) { return bit_span{}; }
+      const size_t row_words = bit_span::words_for(n_orders);
+      cuopt_assert(order_match.size() == row_words * n_vehicles,
                    "size mismatch of order_match vector");
-      return raft::span<bool const, is_device>(order_match.data() + truck_id * n_orders, n_orders);
+      return bit_span(order_match.data() + truck_id * row_words, n_orders);
     }
 
     std::vector<i_t> order_service_times;
-    thrust::host_vector<bool> order_match;
+    std::vector<bit_span::word_t> order_match;
     i_t n_orders;
     i_t n_vehicles;
   };
@@ -71,8 +72,7 @@ struct fleet_order_constraints_t {
   {
     host_t h;
     h.order_service_times = host_copy(order_service_times, stream);
-    auto tmp_order_match  = host_copy(order_match, stream);
-    h.order_match         = thrust::host_vector<bool>(tmp_order_match);
+    h.order_match         = host_copy(order_match, stream);
     h.n_orders            = n_orders;
     h.n_vehicles          = n_vehicles;
     return h;
@@ -85,18 +85,20 @@ struct fleet_order_constraints_t {
                                           n_orders);
     }
 
-    raft::device_span<bool const> get_order_match(i_t truck_id) const
+    bit_span get_order_match(i_t truck_id) const
     {
-      if (order_match.empty()) { return raft::device_span<bool const>{}; }
-      cuopt_assert(order_match.size() == n_orders * n_vehicles,
+      if (order_match.empty()) { return bit_span{}; }
+      const size_t row_words = bit_span::words_for(n_orders);
+      cuopt_assert(order_match.size() == row_words * n_vehicles,
                    "size mismatch of order_match vector");
-      return raft::device_span<bool const>(order_match.data() + truck_id * n_orders, n_orders);
+      return bit_span(order_match.data() + truck_id * row_words, n_orders);
     }
 
     i_t n_vehicles{};
     i_t n_orders{};
     raft::device_span<i_t const> order_service_times{};
-    raft::device_span<bool const> order_match{};
+    // one row of packed bits per vehicle, see bit_span
+    raft::device_span<bit_span::word_t const> order_match{};
   };
 
   constexpr raft::device_span<i_t const> get_order_service_times(i_t truck_id) const
@@ -104,12 +106,13 @@ struct fleet_order_constraints_t {
     return raft::device_span<i_t const>(order_service_times.data() + truck_id * n_orders, n_orders);
   }
 
-  raft::device_span<bool const> get_order_match(i_t truck_id) const
+  bit_span get_order_match(i_t truck_id) const
   {
-    if (order_match.is_empty()) { return raft::device_span<bool const>{}; }
-    cuopt_assert(order_match.size() == n_orders * n_vehicles,
+    if (order_match.is_empty()) { return bit_span{}; }
+    const size_t row_words = bit_span::words_for(n_orders);
+    cuopt_assert(order_match.size() == row_words * n_vehicles,
                  "size mismatch of order_match vector");
-    return raft::device_span<bool const>(order_match.data() + truck_id * n_orders, n_orders);
+    return bit_span(order_match.data() + truck_id * row_words, n_orders);
   }
 
   view_t view() const
@@ -117,7 +120,8 @@ struct fleet_order_constraints_t {
     view_t v;
     v.order_service_times =
       raft::device_span<i_t const>(order_service_times.data(), order_service_times.size());
-    v.order_match = raft::device_span<bool const>(order_match.data(), order_match.size());
+    v.order_match =
+      raft::device_span<bit_span::word_t const>(order_match.data(), order_match.size());
     v.n_vehicles  = n_vehicles;
     v.n_orders    = n_orders;
     return v;
@@ -127,7 +131,9 @@ struct fleet_order_constraints_t {
   i_t n_vehicles{};
   i_t n_orders{};
   rmm::device_uvector<i_t> order_service_times;
-  rmm::device_uvector<bool> order_match;
+  // whether a vehicle can serve an order, one row of packed bits per vehicle, see bit_span. Empty
+  // when all the vehicles can serve all the orders
+  rmm::device_uvector<bit_span::word_t> order_match;
 };
 
 /**
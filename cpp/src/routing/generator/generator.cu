@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,8 +8,11 @@
 #include "generator.hpp"
 #include "generator_utils.cuh"
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/sequence.h>
 #include <thrust/shuffle.h>
 #include <thrust/sort.h>
 #include <algorithm>
@@ -30,12 +33,15 @@ dataset_t<i_t, f_t>::dataset_t(rmm::device_uvector<f_t>& x_pos,
                                rmm::device_uvector<f_t>& y_pos,
                                detail::order_info_t<i_t, f_t>& order_info,
                                detail::fleet_info_t<i_t, f_t>& fleet_info,
-                               std::vector<break_dimension_t<i_t>>& break_container)
+                               std::vector<break_dimension_t<i_t>>& break_container,
+                               pickup_delivery_t<i_t>& pickup_delivery)
   : v_x_pos_(std::move(x_pos)),
     v_y_pos_(std::move(y_pos)),
     order_info_(std::move(order_info)),
     fleet_info_(std::move(fleet_info)),
-    break_container_(std::move(break_container))
+    break_container_(std::move(break_container)),
+    v_pickup_indices_(std::move(std::get<0>(pickup_delivery))),
+    v_delivery_indices_(std::move(std::get<1>(pickup_delivery)))
 {
 }
 
@@ -64,6 +70,48 @@ std::vector<break_dimension_t<i_t>>& dataset_t<i_t, f_t>::get_vehicle_breaks()
   return break_container_;
 }
 
+template <typename i_t, typename f_t>
+std::tuple<rmm::device_uvector<i_t>&, rmm::device_uvector<i_t>&>
+dataset_t<i_t, f_t>::get_pickup_delivery_pairs()
+{
+  return std::make_tuple(std::ref(v_pickup_indices_), std::ref(v_delivery_indices_));
+}
+
+template <typename i_t, typename f_t>
+data_model_view_t<i_t, f_t> dataset_t<i_t, f_t>::get_data_model(raft::handle_t const& handle)
+{
+  auto n_locations = order_info_.get_num_orders();
+  auto n_vehicles  = fleet_info_.get_num_vehicles();
+  data_model_view_t<i_t, f_t> data_model(&handle, n_locations, n_vehicles, n_locations);
+
+  detail::fill_data_model_matrices(data_model, fleet_info_.matrices_);
+  data_model.set_location_coordinates(v_x_pos_.data(), v_y_pos_.data());
+  data_model.set_order_time_windows(order_info_.v_earliest_time_.data(),
+                                    order_info_.v_latest_time_.data());
+  i_t dim = order_info_.v_demand_.size() / n_locations;
+  for (i_t i = 0; i < dim; ++i) {
+    data_model.add_capacity_dimension("",
+                                      order_info_.v_demand_.data() + i * n_locations,
+                                      fleet_info_.v_capacities_.data() + i * n_vehicles);
+  }
+  auto& service_times = fleet_info_.fleet_order_constraints_.order_service_times;
+  for (i_t truck_id = 0; truck_id < n_vehicles; ++truck_id) {
+    data_model.set_order_service_times(service_times.data() + truck_id * n_locations, truck_id);
+  }
+  data_model.set_vehicle_time_windows(fleet_info_.v_earliest_time_.data(),
+                                      fleet_info_.v_latest_time_.data());
+  data_model.set_vehicle_types(fleet_info_.v_types_.data());
+  data_model.set_drop_return_trips(fleet_info_.v_drop_return_trip_.data());
+  data_model.set_skip_first_trips(fleet_info_.v_skip_first_trip_.data());
+  for (auto& [earliest, latest, duration] : break_container_) {
+    data_model.add_break_dimension(earliest.data(), latest.data(), duration.data());
+  }
+  if (!v_pickup_indices_.is_empty()) {
+    data_model.set_pickup_delivery_pairs(v_pickup_indices_.data(), v_delivery_indices_.data());
+  }
+  return data_model;
+}
+
 template <typename i_t, typename f_t>
 dataset_t<i_t, f_t> generate_dataset(raft::handle_t const& handle,
                                      dataset_params_t<i_t, f_t> const& params)
@@ -90,29 +138,54 @@ dataset_t<i_t, f_t> generate_dataset(raft::handle_t const& handle,
   cuopt_expects(params.n_matrix_types > 0 && params.n_matrix_types <= 2,
                 error_type_t::ValidationError,
                 "Matrix types supported are cost or transit time only.");
+  cuopt_expects(params.n_vehicles >= 0,
+                error_type_t::ValidationError,
+                "Number of vehicles should be positive");
+  cuopt_expects(!params.pickup_delivery || (params.n_locations - 1) % 2 == 0,
+                error_type_t::ValidationError,
+                "Pickup and delivery needs an even number of orders besides the depot");
 
+  // The coordinates and matrices are the largest pieces, they are built once and shared
   auto coordinates = generate_coordinates<i_t, f_t>(handle, params);
-  auto order_info  = generate_order_info<i_t, f_t>(handle, params);
-  auto fleet_info  = generate_fleet_info<i_t, f_t>(handle, params, order_info);
+  auto matrices    = generate_matrices<i_t, f_t>(handle, params, coordinates);
+  auto order_info  = generate_order_info<i_t, f_t>(handle, params, matrices);
+  pickup_delivery_t<i_t> pickup_delivery{rmm::device_uvector<i_t>(0, handle.get_stream()),
+                                         rmm::device_uvector<i_t>(0, handle.get_stream())};
+  if (params.pickup_delivery) {
+    pickup_delivery =
+      generate_pickup_delivery_pairs<i_t, f_t>(handle, params, order_info, matrices);
+  }
+  auto fleet_info = generate_fleet_info<i_t, f_t>(handle, params, order_info, std::move(matrices));
   auto break_container =
     generate_vehicle_breaks<i_t, f_t>(handle, params, order_info, fleet_info.get_num_vehicles());
 
-  return dataset_t<i_t, f_t>(
-    std::get<0>(coordinates), std::get<1>(coordinates), order_info, fleet_info, break_container);
+  return dataset_t<i_t, f_t>(std::get<0>(coordinates),
+                             std::get<1>(coordinates),
+                             order_info,
+                             fleet_info,
+                             break_container,
+                             pickup_delivery);
 }
+
+template <typename i_t, typename f_t>
+i_t get_fleet_size(dataset_params_t<i_t, f_t> const& params)
+{
+  return params.n_vehicles > 0 ? params.n_vehicles : params.n_locations - 1;
+}
+
 template <typename i_t, typename f_t>
 detail::fleet_order_constraints_t<i_t> generate_fleet_order_constraints(
   raft::handle_t const& handle, dataset_params_t<i_t, f_t> const& params)
 {
   auto n_orders   = params.n_locations;
-  auto n_vehicles = params.n_locations - 1;
+  auto n_vehicles = get_fleet_size(params);
 
   detail::fleet_order_constraints_t<i_t> fleet_order_constraints(&handle, n_orders, n_vehicles);
   fleet_order_constraints.fill(0);
 
   raft::random::RngState r(params.seed, raft::random::GenPhilox);
 
-  for (i_t truck_id = 0; truck_id < params.n_locations - 1; ++truck_id) {
+  for (i_t truck_id = 0; truck_id < n_vehicles; ++truck_id) {
     raft::random::uniformInt(
       r,
       fleet_order_constraints.order_service_times.data() + truck_id * n_orders + 1,
@@ -127,12 +200,12 @@ detail::fleet_order_constraints_t<i_t> generate_fleet_order_constraints(
 template <typename i_t, typename f_t>
 detail::fleet_info_t<i_t, f_t> generate_fleet_info(raft::handle_t const& handle,
                                                    dataset_params_t<i_t, f_t> const& params,
-                                                   detail::order_info_t<i_t, f_t> const& order_info)
+                                                   detail::order_info_t<i_t, f_t> const& order_info,
+                                                   d_mdarray_t<f_t>&& matrices)
 {
-  detail::fleet_info_t<i_t, f_t> fleet_info(&handle, params.n_locations - 1);
+  detail::fleet_info_t<i_t, f_t> fleet_info(&handle, get_fleet_size(params));
 
-  auto coordinates               = generate_coordinates<i_t, f_t>(handle, params);
-  fleet_info.matrices_           = generate_matrices<i_t, f_t>(handle, params, coordinates);
+  fleet_info.matrices_           = std::move(matrices);
   auto fleet_size                = fleet_info.get_num_vehicles();
   fleet_info.v_types_            = generate_vehicle_types<i_t, f_t>(handle, params, fleet_size);
   fleet_info.v_skip_first_trip_  = generate_skip_first_trips<i_t, f_t>(handle, params, fleet_size);
@@ -148,11 +221,12 @@ detail::fleet_info_t<i_t, f_t> generate_fleet_info(raft::handle_t const& handle,
 
 template <typename i_t, typename f_t>
 detail::order_info_t<i_t, f_t> generate_order_info(raft::handle_t const& handle,
-                                                   dataset_params_t<i_t, f_t> const& params)
+                                                   dataset_params_t<i_t, f_t> const& params,
+                                                   d_mdarray_t<f_t>& matrices)
 {
   detail::order_info_t<i_t, f_t> order_info(&handle, params.n_locations - 1);
   order_info.v_demand_             = generate_demands<i_t, f_t>(handle, params);
-  auto [earliest, latest, service] = generate_time_windows<i_t, f_t>(handle, params);
+  auto [earliest, latest, service] = generate_time_windows<i_t, f_t>(handle, params, matrices);
   order_info.v_earliest_time_      = std::move(earliest);
   order_info.v_latest_time_        = std::move(latest);
 
@@ -473,18 +547,12 @@ rmm ::device_uvector<i_t> create_service_time(raft::handle_t const& handle,
 
 template <typename i_t, typename f_t>
 time_window_t<i_t> generate_time_windows(raft::handle_t const& handle,
-                                         dataset_params_t<i_t, f_t> const& params)
+                                         dataset_params_t<i_t, f_t> const& params,
+                                         d_mdarray_t<f_t>& matrices)
 {
   rmm::device_uvector<i_t> v_earliest_time(params.n_locations, handle.get_stream());
   rmm::device_uvector<i_t> v_latest_time(params.n_locations, handle.get_stream());
 
-  auto n_vehicles  = params.n_locations - 1;
-  auto coordinates = generate_coordinates<i_t, f_t>(handle, params);
-  auto matrices    = generate_matrices<i_t, f_t>(handle, params, coordinates);
-
-  data_model_view_t<i_t, f_t> data_model(&handle, params.n_locations, n_vehicles);
-  detail::fill_data_model_matrices<i_t, f_t>(data_model, matrices);
-
   auto time_matrix    = matrices.get_time_matrix(0);
   auto v_service_time = create_service_time<i_t, f_t>(handle, params);
   detail::fill_time_windows<i_t, f_t>
@@ -500,6 +568,51 @@ time_window_t<i_t> generate_time_windows(raft::handle_t const& handle,
     std::move(v_earliest_time), std::move(v_latest_time), std::move(v_service_time));
 }
 
+template <typename i_t, typename f_t>
+pickup_delivery_t<i_t> generate_pickup_delivery_pairs(raft::handle_t const& handle,
+                                                      dataset_params_t<i_t, f_t> const& params,
+                                                      detail::order_info_t<i_t, f_t>& order_info,
+                                                      d_mdarray_t<f_t>& matrices)
+{
+  auto n_requests = (params.n_locations - 1) / 2;
+  rmm::device_uvector<i_t> orders(params.n_locations - 1, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), orders.begin(), orders.end(), 1);
+  thrust::default_random_engine g(params.seed);
+  thrust::shuffle(handle.get_thrust_policy(), orders.begin(), orders.end(), g);
+
+  rmm::device_uvector<i_t> pickup_indices(n_requests, handle.get_stream());
+  rmm::device_uvector<i_t> delivery_indices(n_requests, handle.get_stream());
+  // The delivery unloads what the pickup loaded and stays open long enough to be reached from
+  // the pickup
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(n_requests),
+                   [orders       = orders.data(),
+                    pickups      = pickup_indices.data(),
+                    deliveries   = delivery_indices.data(),
+                    demand       = order_info.v_demand_.data(),
+                    earliest     = order_info.v_earliest_time_.data(),
+                    latest       = order_info.v_latest_time_.data(),
+                    time_matrix  = matrices.get_time_matrix(0),
+                    n_locations  = params.n_locations,
+                    dim          = params.dim,
+                    service_time = params.max_service_time] __device__(i_t request) {
+                     auto pickup         = orders[2 * request];
+                     auto delivery       = orders[2 * request + 1];
+                     pickups[request]    = pickup;
+                     deliveries[request] = delivery;
+                     for (i_t i = 0; i < dim; ++i) {
+                       demand[i * n_locations + delivery] = -demand[i * n_locations + pickup];
+                     }
+                     auto travel_time =
+                       static_cast<i_t>(ceil(time_matrix[pickup * n_locations + delivery]));
+                     i_t arrival      = earliest[pickup] + service_time + travel_time;
+                     latest[delivery] = max(latest[delivery], arrival + 1);
+                   });
+  RAFT_CHECK_CUDA(handle.get_stream());
+  return std::make_tuple(std::move(pickup_indices), std::move(delivery_indices));
+}
+
 template class dataset_t<int, float>;
 template dataset_t<int, float> generate_dataset<int, float>(raft::handle_t const&,
                                                             dataset_params_t<int, float> const&);
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -29,6 +29,9 @@ using break_dimension_t =
 
 template <typename i_t>
 using vehicle_time_window_t = std::tuple<rmm::device_uvector<i_t>, rmm::device_uvector<i_t>>;
+
+template <typename i_t>
+using pickup_delivery_t = std::tuple<rmm::device_uvector<i_t>, rmm::device_uvector<i_t>>;
 /**
  * @brief Container for allocated dataset.
  * @tparam i_t Integer type. Needs to be int (32bit) at the moment. Please open
@@ -42,12 +45,22 @@ class dataset_t {
             rmm::device_uvector<f_t>& y_pos,
             detail::order_info_t<i_t, f_t>& order_info,
             detail::fleet_info_t<i_t, f_t>& fleet_info,
-            std::vector<break_dimension_t<i_t>>& break_container);
+            std::vector<break_dimension_t<i_t>>& break_container,
+            pickup_delivery_t<i_t>& pickup_delivery);
 
   std::tuple<rmm::device_uvector<f_t>&, rmm::device_uvector<f_t>&> get_coordinates();
   detail::order_info_t<i_t, f_t>& get_order_info();
   detail::fleet_info_t<i_t, f_t>& get_fleet_info();
   std::vector<break_dimension_t<i_t>>& get_vehicle_breaks();
+  // Empty unless the dataset was generated with pickup_delivery
+  std::tuple<rmm::device_uvector<i_t>&, rmm::device_uvector<i_t>&> get_pickup_delivery_pairs();
+
+  /**
+   * @brief Builds a data model ready to be solved over the device memory of the dataset, no data
+   * goes through the host. The dataset must outlive the returned view.
+   * @param[in] handle Library handle (RAFT) the data model and the solve run on.
+   */
+  data_model_view_t<i_t, f_t> get_data_model(raft::handle_t const& handle);
 
  private:
   rmm::device_uvector<f_t> v_x_pos_;
@@ -55,11 +68,14 @@ class dataset_t {
   detail::order_info_t<i_t, f_t> order_info_;
   detail::fleet_info_t<i_t, f_t> fleet_info_;
   std::vector<break_dimension_t<i_t>> break_container_;
+  rmm::device_uvector<i_t> v_pickup_indices_;
+  rmm::device_uvector<i_t> v_delivery_indices_;
 };
 
 template <typename i_t, typename f_t>
 detail::order_info_t<i_t, f_t> generate_order_info(raft::handle_t const& handle,
-                                                   dataset_params_t<i_t, f_t> const& params);
+                                                   dataset_params_t<i_t, f_t> const& params,
+                                                   d_mdarray_t<f_t>& matrices);
 
 template <typename i_t, typename f_t>
 detail::fleet_order_constraints_t<i_t> generate_fleet_order_constraints(
@@ -69,7 +85,8 @@ template <typename i_t, typename f_t>
 detail::fleet_info_t<i_t, f_t> generate_fleet_info(
   raft::handle_t const& handle,
   dataset_params_t<i_t, f_t> const& params,
-  detail::order_info_t<i_t, f_t> const& order_info);
+  detail::order_info_t<i_t, f_t> const& order_info,
+  d_mdarray_t<f_t>&& matrices);
 
 template <typename i_t, typename f_t>
 coordinates_t<f_t> generate_coordinates(raft::handle_t const&, dataset_params_t<i_t, f_t> const&);
@@ -90,7 +107,19 @@ rmm::device_uvector<cap_i_t> generate_vehicle_capacities(raft::handle_t const& h
 
 template <typename i_t, typename f_t>
 time_window_t<i_t> generate_time_windows(raft::handle_t const& handle,
-                                         dataset_params_t<i_t, f_t> const& params);
+                                         dataset_params_t<i_t, f_t> const& params,
+                                         d_mdarray_t<f_t>& matrices);
+
+/**
+ * @brief Pairs the orders at random into pickup and delivery requests. The delivery demands
+ * become the opposite of the pickup ones and the delivery time windows are widened so that each
+ * delivery can be reached from its pickup.
+ */
+template <typename i_t, typename f_t>
+pickup_delivery_t<i_t> generate_pickup_delivery_pairs(raft::handle_t const& handle,
+                                                      dataset_params_t<i_t, f_t> const& params,
+                                                      detail::order_info_t<i_t, f_t>& order_info,
+                                                      d_mdarray_t<f_t>& matrices);
 
 template <typename i_t, typename f_t>
 rmm::device_uvector<bool> generate_drop_return_trips(raft::handle_t const& handle,
@@ -107,7 +136,6 @@ vehicle_time_window_t<i_t> generate_vehicle_time_windows(
   raft::handle_t const& handle,
   dataset_params_t<i_t, f_t> const& params,
   detail::order_info_t<i_t, f_t> const& order_info,
-  detail::fleet_order_constraints_t<i_t> const& fleet_order_constraints,
   size_t fleet_size);
 
 template <typename i_t, typename f_t>
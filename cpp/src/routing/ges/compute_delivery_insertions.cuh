@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -235,10 +235,8 @@ DI void find_all_delivery_insertions(typename solution_t<i_t, f_t, REQUEST>::vie
                                      [[maybe_unused]] i_t frag_to_delete = 0,
                                      [[maybe_unused]] i_t frag_step      = 0)
 {
-  raft::random::PCGenerator thread_rng(
-    seed + (threadIdx.x + blockIdx.x * blockDim.x),
-    uint64_t(view.solution_id * (threadIdx.x + blockIdx.x * blockDim.x)),
-    0);
+  auto thread_rng =
+    make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x), view.solution_id);
   [[maybe_unused]] __shared__ i_t atomic_min_random_counter;
   if (threadIdx.x == 0) { atomic_min_random_counter = 1; }
   __syncthreads();
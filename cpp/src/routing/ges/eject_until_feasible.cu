@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -69,10 +69,8 @@ __global__ void eject_until_feasible_kernel(typename solution_t<i_t, f_t, REQUES
   // if single route is not given, it is for all solution
 
   i_t route_id = blockIdx.x;
-  raft::random::PCGenerator thread_rng(
-    seed + (threadIdx.x + blockIdx.x * blockDim.x),
-    uint64_t(solution.solution_id * (threadIdx.x + blockIdx.x * blockDim.x)),
-    0);
+  auto thread_rng =
+    make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x), solution.solution_id);
   auto route = solution.routes[route_id];
   init_shmem(ejection_counter, 0);
   auto sh_route =
@@ -311,8 +309,7 @@ __global__ void populate_ep_with_selected_unserved_kernel(
     }
     *ep_index_out = EP.index_;
     // shuffle EP as much as possible
-    raft::random::PCGenerator thread_rng(
-      seed + (threadIdx.x + blockDim.x * blockIdx.x), unserviced_nodes.size(), 0);
+    auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockDim.x * blockIdx.x));
     for (i_t i = 0; i < unserviced_nodes.size() && EP.index_ > 0; ++i) {
       raft::swapVals(EP.stack_[EP.index_], EP.stack_[thread_rng.next_u32() % (EP.index_)]);
     }
@@ -345,8 +342,7 @@ __global__ void populate_ep_with_selected_unserved_kernel(
 
     i_t n_requests = unserviced_nodes.size() / 2;
     // shuffle EP as much as possible
-    raft::random::PCGenerator thread_rng(
-      seed + (threadIdx.x + blockDim.x * blockIdx.x), n_requests, 0);
+    auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockDim.x * blockIdx.x));
     for (i_t i = 0; i < n_requests && EP.index_ > 0; ++i) {
       raft::swapVals(EP.stack_[EP.index_], EP.stack_[thread_rng.next_u32() % (EP.index_)]);
     }
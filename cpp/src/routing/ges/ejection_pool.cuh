@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -30,7 +30,7 @@ namespace detail {
 template <typename elemt_t>
 __global__ static void device_random_shuffle(elemt_t* data, int size, int64_t seed)
 {
-  raft::random::PCGenerator thread_rng(seed + (threadIdx.x + blockIdx.x * blockDim.x), size, 0);
+  auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x));
   for (int i = 0; i < size * 2; ++i) {
     raft::swapVals(data[size - 1], data[thread_rng.next_u32() % (size - 1)]);
   }
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -68,12 +68,16 @@ guided_ejection_search_t<i_t, f_t, REQUEST>::guided_ejection_search_t(
     best_squeeze_per_cand(solution.get_num_requests(), solution.sol_handle->get_stream()),
     best_squeeze_per_route(solution.problem_ptr->get_fleet_size(),
                            solution.sol_handle->get_stream()),
+    squeeze_cands(0, solution.sol_handle->get_stream()),
+    squeeze_routes_changed(0, solution.sol_handle->get_stream()),
     number_of_inserted(solution.sol_handle->get_stream()),
     global_min_p_(solution.sol_handle->get_stream()),
     global_random_counter_(solution.sol_handle->get_stream()),
     // considering max k_max is 6
     global_sequence_(2 * allowed_max_k_max + lexico_result_buffer_size,
                      solution.sol_handle->get_stream()),
+    lexico_spill_buffer_(0, solution.sol_handle->get_stream()),
+    lexico_spill_locks_(0, solution.sol_handle->get_stream()),
     EP(solution.get_num_orders(), solution.sol_handle->get_stream()),
     intermediate_file(file),
     dump_intermediate(false)
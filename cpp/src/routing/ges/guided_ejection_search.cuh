@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -29,12 +29,13 @@ namespace routing {
 namespace detail {
 
 // TODO move these constants to a better place
-constexpr int allowed_max_k_max         = 6;
-constexpr int lexico_result_buffer_size = 5;
-constexpr int shuffle_interval          = 20;
-constexpr int squeeze_try_interval      = 5;
-constexpr int eject_new_route_threshold = shuffle_interval * 5;
-constexpr auto const insertion_rate     = 0.003;
+constexpr int allowed_max_k_max             = 6;
+constexpr int lexico_result_buffer_size     = 5;
+constexpr int shuffle_interval              = 20;
+constexpr int squeeze_try_interval          = 5;
+constexpr int eject_new_route_threshold     = shuffle_interval * 5;
+constexpr auto const insertion_rate         = 0.003;
+constexpr int max_squeeze_batch_evaluations = 1 << 16;
 
 struct ges_config_t {
   int frag_eject_first = 1;
@@ -108,6 +109,9 @@ class guided_ejection_search_t {
   rmm::device_scalar<uint32_t> global_min_p_;
   rmm::device_scalar<i_t> global_random_counter_;
   rmm::device_uvector<i_t> global_sequence_;
+  // global memory of the lexicographic search stack levels that do not fit in shared memory
+  rmm::device_uvector<uint8_t> lexico_spill_buffer_;
+  rmm::device_uvector<i_t> lexico_spill_locks_;
   solution_t<i_t, f_t, REQUEST>* solution_ptr;
   solution_t<i_t, f_t, REQUEST> ges_loop_save_state;
   local_search_t<i_t, f_t, REQUEST>* local_search_ptr_;
@@ -144,6 +148,9 @@ class guided_ejection_search_t {
 
   rmm::device_uvector<cand_t> best_squeeze_per_cand;
   rmm::device_uvector<cand_t> best_squeeze_per_route;
+  // best insertion of every request and route pair of a batch, kept while the route is unchanged
+  rmm::device_uvector<cand_t> squeeze_cands;
+  rmm::device_uvector<i_t> squeeze_routes_changed;
   // used in squeeze
   rmm::device_uvector<i_t> inserted_requests;
   rmm::device_scalar<i_t> number_of_inserted;
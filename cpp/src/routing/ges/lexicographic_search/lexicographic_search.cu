@@ -110,10 +110,13 @@ DI void get_route_id_and_insertion_idx(
  * @param global_min_p All blocks atomicMin there
  * @param global_sequence Global array of dimension [gridDimx.x * 2k_max + 1 + 2] (last + 2 is for
  * route_id + delivery insertion index)
+ * @param shared_levels Number of stack levels kept in shared memory, the deeper ones are in spill
  */
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void lexicographic_search(typename solution_t<i_t, f_t, REQUEST>::view_t solution,
                                      i_t k_max,
+                                     i_t shared_levels,
+                                     stack_spill_t<i_t> spill,
                                      const request_info_t<i_t, REQUEST>* __restrict__ request_id,
                                      const i_t* __restrict__ p_scores,
                                      uint32_t* __restrict__ global_min_p,
@@ -161,7 +164,15 @@ __global__ void lexicographic_search(typename solution_t<i_t, f_t, REQUEST>::vie
     return;
   }
 
+  __shared__ i_t spill_slot;
+  if (threadIdx.x == 0) {
+    spill_slot = shared_levels < max_neighbors<i_t, REQUEST>(k_max) ? spill.acquire() : -1;
+  }
+  __syncthreads();
+
   node_stack_t<i_t, f_t, REQUEST> node_stack{shmem,
+                                             spill.slot_ptr(spill_slot),
+                                             shared_levels,
                                              k_max,
                                              delivery_insertion_idx_in_permutation,
                                              p_scores[request_id->info.node()],
@@ -493,6 +504,8 @@ __global__ void lexicographic_search(typename solution_t<i_t, f_t, REQUEST>::vie
   block_reduce(thread_p_score, reusable_shmem);
   // reusable_shmem[0] contains the min value
   __syncthreads();
+  // the stack is no longer used, the best sequences are in shared memory
+  if (threadIdx.x == 0) { spill.release(spill_slot); }
   i_t reduction_val = reusable_shmem[0];
   // if no valid move has been found
   // or only delivery insertion is found, we have single insertion kernel that handles this case
@@ -660,6 +673,7 @@ __global__ void execute_lexico_move(
   cuopt_assert(s_route.is_feasible(),
                "The route after the lexicographical move should be feasible!");
   route.copy_from(s_route);
+  if (threadIdx.x == 0) { solution.routes_to_copy[s_route.get_id()] = 1; }
 }
 
 // runs and executes lexicographical search and returns whether the move is executed
@@ -692,19 +706,48 @@ bool guided_ejection_search_t<i_t, f_t, REQUEST>::run_lexicographic_search(
     n_blocks_lexico *= max_neighbors<i_t, REQUEST>(k_max);
   }
 
-  size_t sh_size = 0;
-  bool is_set    = false;
-  while (k_max > 1) {
-    sh_size = node_stack_t<i_t, f_t, REQUEST>::get_shared_size(
-      solution_ptr, 1, k_max, threads_per_block_lexico);
-    if (set_shmem_of_kernel(lexicographic_search<i_t, f_t, REQUEST>, sh_size)) {
-      is_set = true;
-      break;
+  // The deepest stack levels are spilled to global memory when the whole stack does not fit in
+  // shared memory, so that the search depth is kept. k_max is only lowered when even a single
+  // level in shared memory does not fit
+  size_t sh_size    = 0;
+  bool is_set       = false;
+  i_t shared_levels = 0;
+  while (k_max > 1 && !is_set) {
+    for (shared_levels = max_neighbors<i_t, REQUEST>(k_max); shared_levels > 0; --shared_levels) {
+      sh_size = node_stack_t<i_t, f_t, REQUEST>::get_shared_size(
+        solution_ptr, 1, k_max, shared_levels, threads_per_block_lexico);
+      if (set_shmem_of_kernel(lexicographic_search<i_t, f_t, REQUEST>, sh_size)) {
+        is_set = true;
+        break;
+      }
     }
-    k_max--;
+    if (!is_set) { k_max--; }
   }
 
   if (k_max == 1 || !is_set) { return false; }
+
+  stack_spill_t<i_t> spill;
+  spill.slot_size = node_stack_t<i_t, f_t, REQUEST>::get_spill_size(
+    solution_ptr, k_max, shared_levels, threads_per_block_lexico);
+  if (spill.slot_size > 0) {
+    i_t blocks_per_sm = 0;
+    cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_sm,
+                                                  lexicographic_search<i_t, f_t, REQUEST>,
+                                                  threads_per_block_lexico,
+                                                  sh_size);
+    spill.n_slots = std::max(i_t{1}, blocks_per_sm) *
+                    solution_ptr->sol_handle->get_device_properties().multiProcessorCount;
+    if (lexico_spill_locks_.size() < static_cast<size_t>(spill.n_slots)) {
+      lexico_spill_locks_.resize(spill.n_slots, stream);
+    }
+    if (lexico_spill_buffer_.size() < spill.n_slots * spill.slot_size) {
+      lexico_spill_buffer_.resize(spill.n_slots * spill.slot_size, stream);
+    }
+    RAFT_CUDA_TRY(
+      cudaMemsetAsync(lexico_spill_locks_.data(), 0, spill.n_slots * sizeof(i_t), stream));
+    spill.buffer     = lexico_spill_buffer_.data();
+    spill.slot_locks = lexico_spill_locks_.data();
+  }
   // Init global min before call to lexicographic
   const auto max = std::numeric_limits<typename decltype(global_min_p_)::value_type>::max();
   const i_t zero = 0;
@@ -714,6 +757,8 @@ bool guided_ejection_search_t<i_t, f_t, REQUEST>::run_lexicographic_search(
   lexicographic_search<i_t, f_t>
     <<<n_blocks_lexico, threads_per_block_lexico, sh_size, stream>>>(solution_ptr->view(),
                                                                      k_max,
+                                                                     shared_levels,
+                                                                     spill,
                                                                      request_id,
                                                                      p_scores_.data(),
                                                                      global_min_p_.data(),
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -92,9 +92,42 @@ constexpr i_t max_neighbors(i_t k_max)
   return {};
 }
 
+/*
+ * @brief Global memory for the stack levels that do not fit in shared memory. A block borrows one
+ * slot while it runs, so there are only as many slots as blocks that can be resident at once
+ */
+template <typename i_t>
+struct stack_spill_t {
+  uint8_t* buffer{nullptr};
+  i_t* slot_locks{nullptr};
+  i_t n_slots{0};
+  size_t slot_size{0};
+
+  // called by a single thread of the block, a slot is always free as the resident blocks hold at
+  // most n_slots of them
+  DI i_t acquire() const
+  {
+    if (n_slots == 0) { return -1; }
+    i_t slot = blockIdx.x % n_slots;
+    while (atomicCAS(&slot_locks[slot], 0, 1) != 0) {
+      slot = (slot + 1) % n_slots;
+    }
+    return slot;
+  }
+
+  DI void release(i_t slot) const
+  {
+    if (slot >= 0) { atomicExch(&slot_locks[slot], 0); }
+  }
+
+  DI uint8_t* slot_ptr(i_t slot) const { return slot >= 0 ? buffer + slot * slot_size : nullptr; }
+};
+
 template <typename i_t, typename f_t, request_t REQUEST>
 struct node_stack_t {
   DI node_stack_t(i_t* sh_ptr,
+                  uint8_t* spill_ptr,
+                  i_t shared_levels_,
                   i_t k_max_,
                   i_t delivery_insertion_idx_in_permutation_,
                   i_t p_scores_of_pickup_,
@@ -102,6 +135,7 @@ struct node_stack_t {
                   i_t route_length_,
                   typename route_t<i_t, f_t, REQUEST>::view_t& route_)
     : k_max(k_max_),
+      shared_levels(shared_levels_),
       delivery_insertion_idx_in_permutation(delivery_insertion_idx_in_permutation_),
       min_p_score(p_scores_of_pickup_ - 1),
       best_sequence_size(std::numeric_limits<i_t>::max()),
@@ -110,7 +144,9 @@ struct node_stack_t {
       route_length(route_length_),
       thread_rng(2727, uint64_t((threadIdx.x + blockIdx.x * blockDim.x)), 0)
   {
-    sh_ptr  = set_spans(sh_ptr);
+    sh_ptr = set_spans(sh_ptr);
+    set_spill_spans(spill_ptr);
+    set_item_stack_ptrs();
     s_route = route_t<i_t, f_t, REQUEST>::view_t::create_shared_route(sh_ptr, route_, route_length);
     __syncthreads();
     s_route.copy_from(route_);
@@ -156,6 +192,8 @@ struct node_stack_t {
 
   i_t stack_top;
   const i_t k_max;
+  // the levels below are in shared memory, the deeper ones are spilled to global memory
+  const i_t shared_levels;
   i_t current_p_score;
   i_t n_ejected_pickups;
   const i_t delivery_insertion_idx_in_permutation;
@@ -180,29 +218,52 @@ struct node_stack_t {
   raft::device_span<item_t> stack;
   raft::device_span<i_t> gathered;
   raft::device_span<i_t> max_to_node;
+  raft::device_span<item_t> spilled_stack;
+  raft::device_span<i_t> spilled_gathered;
+  raft::device_span<i_t> spilled_max_to_node;
 
   raft::device_span<f_t> dim_buffer_route[size_t(dim_t::SIZE)];
   raft::device_span<f_t> dim_delivery_to_all[size_t(dim_t::SIZE)];
 
+  // stack items and their capacity buffers of n_levels levels
+  static size_t get_stack_size(solution_t<i_t, f_t, REQUEST>* solution_ptr,
+                               int n_levels,
+                               int threads_per_block_lexico)
+  {
+    const auto n_capacity_dimensions =
+      solution_ptr->problem_ptr->dimensions_info.capacity_dim.n_capacity_dimensions;
+    const size_t size_of_stack = sizeof(item_t) * n_levels * threads_per_block_lexico;
+    const size_t size_of_stack_buffers_for_capacity =
+      2 * n_levels * threads_per_block_lexico * sizeof(i_t) * n_capacity_dimensions;
+    return size_of_stack + size_of_stack_buffers_for_capacity;
+  }
+
+  // global memory of one block for the levels from shared_levels to the stack capacity
+  static size_t get_spill_size(solution_t<i_t, f_t, REQUEST>* solution_ptr,
+                               int k_max,
+                               int shared_levels,
+                               int threads_per_block_lexico)
+  {
+    const int spilled_levels = max_neighbors<i_t, REQUEST>(k_max) - shared_levels;
+    if (spilled_levels <= 0) { return 0; }
+    return raft::alignTo(get_stack_size(solution_ptr, spilled_levels, threads_per_block_lexico),
+                         size_t(256));
+  }
+
   static size_t get_shared_size(solution_t<i_t, f_t, REQUEST>* solution_ptr,
                                 int added_size,
                                 int k_max,
+                                int shared_levels,
                                 int threads_per_block_lexico)
   {
-    const auto n_capacity_dimensions =
-      solution_ptr->problem_ptr->dimensions_info.capacity_dim.n_capacity_dimensions;
     const size_t size_of_stack =
-      sizeof(item_t) * max_neighbors<i_t, REQUEST>(k_max) * threads_per_block_lexico;
-    const size_t size_of_stack_buffers_for_capacity = 2 * max_neighbors<i_t, REQUEST>(k_max) *
-                                                      threads_per_block_lexico * sizeof(i_t) *
-                                                      n_capacity_dimensions;
+      get_stack_size(solution_ptr, shared_levels, threads_per_block_lexico);
     const size_t size_of_best_sequence =
       max_neighbors<i_t, REQUEST>(k_max) * threads_per_block_lexico * sizeof(i_t);
     const size_t size_of_p_score =
       solution_ptr->get_max_active_nodes_for_all_routes() * sizeof(i_t);
 
-    size_t sh_size =
-      size_of_stack + size_of_stack_buffers_for_capacity + size_of_best_sequence + size_of_p_score;
+    size_t sh_size = size_of_stack + size_of_best_sequence + size_of_p_score;
 
     if (solution_ptr->problem_ptr->dimensions_info.time_dim.has_constraints()) {
       const size_t shared_for_time_buffers =
@@ -228,7 +289,7 @@ struct node_stack_t {
     auto* shmem                = sh_ptr;
     auto n_capacity_dimensions = delivery_node.capacity_dim.n_capacity_dimensions;
     thrust::tie(stack, sh_ptr) = wrap_ptr_as_span<typename node_stack_t<i_t, f_t, REQUEST>::item_t>(
-      sh_ptr, max_neighbors<i_t, REQUEST>(k_max) * blockDim.x);
+      sh_ptr, shared_levels * blockDim.x);
     thrust::tie(best_sequence, sh_ptr) =
       wrap_ptr_as_span<i_t>(sh_ptr, max_neighbors<i_t, REQUEST>(k_max) * blockDim.x);
 
@@ -247,8 +308,6 @@ struct node_stack_t {
     thrust::tie(max_to_node, sh_ptr) =
       wrap_ptr_as_span<i_t>(sh_ptr, stack.size() * n_capacity_dimensions);
 
-    set_item_stack_ptrs();
-
     auto total_bytes =
       (stack.size() * sizeof(node_stack_t<i_t, f_t, REQUEST>::item_t)) +
       (best_sequence.size() + p_scores.size() + gathered.size() + max_to_node.size()) * sizeof(i_t);
@@ -262,19 +321,47 @@ struct node_stack_t {
     return (i_t*)(((uint8_t*)shmem) + aligned_bytes);
   }
 
-  DI void set_item_stack_ptrs()
+  DI void set_spill_spans(uint8_t* spill_ptr)
   {
-    auto n_capacity_dimensions = gathered.size() / stack.size();
-    for (i_t i = threadIdx.x; i < stack.size(); i += blockDim.x) {
-      size_t offset     = i * n_capacity_dimensions;
-      stack[i].gathered = raft::device_span<i_t>{gathered.data() + offset, n_capacity_dimensions};
-      stack[i].max_to_node =
-        raft::device_span<i_t>{max_to_node.data() + offset, n_capacity_dimensions};
+    const i_t spilled_levels = max_neighbors<i_t, REQUEST>(k_max) - shared_levels;
+    if (spill_ptr == nullptr || spilled_levels <= 0) { return; }
+    auto n_capacity_dimensions = delivery_node.capacity_dim.n_capacity_dimensions;
+    auto* ptr                  = (i_t*)spill_ptr;
+    thrust::tie(spilled_stack, ptr) =
+      wrap_ptr_as_span<item_t>(ptr, spilled_levels * blockDim.x);
+    thrust::tie(spilled_gathered, ptr) =
+      wrap_ptr_as_span<i_t>(ptr, spilled_stack.size() * n_capacity_dimensions);
+    thrust::tie(spilled_max_to_node, ptr) =
+      wrap_ptr_as_span<i_t>(ptr, spilled_stack.size() * n_capacity_dimensions);
+  }
+
+  static DI void set_item_stack_ptrs(raft::device_span<item_t> items,
+                                     raft::device_span<i_t> items_gathered,
+                                     raft::device_span<i_t> items_max_to_node)
+  {
+    if (items.size() == 0) { return; }
+    auto n_capacity_dimensions = items_gathered.size() / items.size();
+    for (i_t i = threadIdx.x; i < items.size(); i += blockDim.x) {
+      size_t offset = i * n_capacity_dimensions;
+      items[i].gathered =
+        raft::device_span<i_t>{items_gathered.data() + offset, n_capacity_dimensions};
+      items[i].max_to_node =
+        raft::device_span<i_t>{items_max_to_node.data() + offset, n_capacity_dimensions};
     }
+  }
+
+  DI void set_item_stack_ptrs()
+  {
+    set_item_stack_ptrs(stack, gathered, max_to_node);
+    set_item_stack_ptrs(spilled_stack, spilled_gathered, spilled_max_to_node);
     __syncthreads();
   }
 
-  DI item_t& get_stack_item(i_t idx) { return stack[threadIdx.x + blockDim.x * idx]; }
+  DI item_t& get_stack_item(i_t idx)
+  {
+    if (idx < shared_levels) { return stack[threadIdx.x + blockDim.x * idx]; }
+    return spilled_stack[threadIdx.x + blockDim.x * (idx - shared_levels)];
+  }
 
   DI i_t& get_best_sequnce(i_t idx) { return best_sequence[threadIdx.x + blockDim.x * idx]; }
 
@@ -718,7 +805,7 @@ struct node_stack_t {
         });
         iter_node = next_node;
         stack_item++;
-        assert(stack_item < stack_top);
+        cuopt_assert(stack_item < stack_top, "stack item out of range");
       } else {
         auto next_node = s_route.get_node(i + 1);
         cuopt_assert(check_dim_between(i, i + 1, iter_node, next_node), "dim buffer mismatch");
@@ -833,7 +920,7 @@ struct node_stack_t {
           iter_node = next_node;
         }
         stack_item++;
-        assert(stack_item < stack_top);
+        cuopt_assert(stack_item < stack_top, "stack item out of range");
       } else {
         auto next_node = s_route.get_node(i + 1);
         cuopt_assert(check_dim_between(i, i + 1, iter_node, next_node), "dim buffer mismatch");
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -74,6 +74,10 @@ i_t guided_ejection_search_t<i_t, f_t, REQUEST>::try_multiple_insert(i_t n_inser
   const i_t n_blocks = solution_ptr->n_routes * n_insertions;
 
   solution_ptr->d_lock.set_value_to_zero_async(stream);
+  // every pair is evaluated in the first round, then only the routes changed by the insertions
+  squeeze_cands.resize(n_blocks, stream);
+  squeeze_routes_changed.resize(solution_ptr->n_routes, stream);
+  async_fill(squeeze_routes_changed, 1, stream);
   int counter = 0;
   while (counter != n_insertions) {
     number_of_inserted.set_value_to_zero_async(stream);
@@ -102,7 +106,9 @@ i_t guided_ejection_search_t<i_t, f_t, REQUEST>::try_multiple_insert(i_t n_inser
                                            weights,
                                            excess_limit,
                                            n_insertions,
-                                           inserted_requests.data());
+                                           inserted_requests.data(),
+                                           cuopt::make_span(squeeze_cands),
+                                           squeeze_routes_changed.data());
     RAFT_CHECK_CUDA(solution_ptr->sol_handle->get_stream());
 
     if constexpr (squeeze_mode) {
@@ -118,13 +124,15 @@ i_t guided_ejection_search_t<i_t, f_t, REQUEST>::try_multiple_insert(i_t n_inser
     is_set =
       set_shmem_of_kernel(execute_all_move<i_t, f_t, REQUEST, squeeze_mode>, shmem_for_route);
     cuopt_expects(is_set, error_type_t::OutOfMemoryError, "Not enough shared memory on device");
+    async_fill(squeeze_routes_changed, 0, stream);
     // execute squeeze moves
     execute_all_move<i_t, f_t, REQUEST, squeeze_mode>
       <<<move_blocks, TPB, shmem_for_route, stream>>>(solution_ptr->view(),
                                                       cuopt::make_span(best_squeeze_per_cand),
                                                       cuopt::make_span(best_squeeze_per_route),
                                                       inserted_requests.data(),
-                                                      number_of_inserted.data());
+                                                      number_of_inserted.data(),
+                                                      squeeze_routes_changed.data());
     RAFT_CHECK_CUDA(stream);
     auto n_inserted = number_of_inserted.value(stream);
 
@@ -192,8 +200,11 @@ void guided_ejection_search_t<i_t, f_t, REQUEST>::squeeze_all_ep()
   async_fill(inserted_requests, 0, solution_ptr->sol_handle->get_stream());
 
   while (run_batches) {
-    // Limit the search to number of routes
-    auto const batch_size = std::min(solution_ptr->get_n_routes(), EP.size());
+    // The whole pool is evaluated at once as long as the number of request and route pairs is
+    // bounded, the unchanged routes are not evaluated again between the rounds of a batch
+    const i_t max_batch_size = std::max(
+      solution_ptr->get_n_routes(), max_squeeze_batch_evaluations / solution_ptr->get_n_routes());
+    auto const batch_size = std::min(max_batch_size, EP.size());
     i_t successful_insertions;
     if (EP.size() < squeeze_size) {
       successful_insertions = try_multiple_insert<true>(batch_size,
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -156,6 +156,7 @@ __global__ void execute_best_empty_route_move(
     temp_route.compute_intra_indices(solution.route_node_map);
     __syncthreads();
     solution.routes[temp_route.get_id()].copy_from(temp_route);
+    if (threadIdx.x == 0) { solution.routes_to_copy[temp_route.get_id()] = 1; }
   }
 
   auto inserting_route = solution.routes[route_id];
@@ -212,7 +213,9 @@ __global__ void find_all_squeeze_pos(
   infeasible_cost_t weights,
   double excess_limit,
   i_t n_insertions,
-  i_t* inserted_requests)
+  i_t* inserted_requests,
+  raft::device_span<cand_t> cands,
+  const i_t* routes_changed)
 {
   extern __shared__ i_t shbuf[];
   cand_t* cand = (cand_t*)shbuf;
@@ -224,8 +227,14 @@ __global__ void find_all_squeeze_pos(
   cuopt_assert(offset >= 0, "Offset should be positive");
   auto request = EP.stack_[offset + ep_idx];
   if (inserted_requests[request.info.node()]) { return; }
-  find_squeeze_pos<i_t, f_t, REQUEST>(
-    solution, &request, cand, shmem, include_objective, weights, excess_limit, route_id);
+  // the insertion found in a previous round is still the best one if the route did not change
+  if (routes_changed[route_id]) {
+    find_squeeze_pos<i_t, f_t, REQUEST>(
+      solution, &request, cand, shmem, include_objective, weights, excess_limit, route_id);
+    if (threadIdx.x == 0) { cands[blockIdx.x] = *cand; }
+  } else if (threadIdx.x == 0) {
+    *cand = cands[blockIdx.x];
+  }
   if (threadIdx.x == 0) {
     // add the route id to which
     if constexpr (squeeze_mode) {
@@ -321,7 +330,8 @@ __global__ void execute_all_move(typename solution_t<i_t, f_t, REQUEST>::view_t
                                  raft::device_span<cand_t> best_per_request,
                                  raft::device_span<cand_t> best_per_route,
                                  i_t* inserted_requests,
-                                 i_t* number_of_inserted)
+                                 i_t* number_of_inserted,
+                                 i_t* routes_changed)
 {
   extern __shared__ i_t shmem[];
   cand_t cand = best_per_route[blockIdx.x];
@@ -360,6 +370,7 @@ __global__ void execute_all_move(typename solution_t<i_t, f_t, REQUEST>::view_t
     auto request = create_request<i_t, f_t, REQUEST>(solution.problem, request_id);
     execute_insert<i_t, f_t, REQUEST>(solution, sh_route, request_locations, &request);
     inserted_requests[request_id.id()] = 1;
+    routes_changed[route_id]           = 1;
     atomicAdd(number_of_inserted, 1);
     cuopt_assert(!orginal_route.dimensions_info().has_dimension(dim_t::TIME) ||
                    abs(orginal_route.template get_dim<dim_t::TIME>()
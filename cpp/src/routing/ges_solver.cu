@@ -66,7 +66,20 @@ assignment_t<i_t> ges_solver_t<i_t, f_t, REQUEST>::compute_ges_solution(
     solver(&(pool_allocator.problem), cpu_weights, pool_allocator, diversity_manager_file, timer);
   bool feasible_only = false;
 
+  solver.island_exchange  = island_exchange;
+  solver.island_id        = island_id;
+  solver.incumbent_stream = incumbent_stream;
   solver.perform_search(expected_route_count, feasible_only);
+  if (island_exchange != nullptr) {
+    // publish the final solution of this island, the first island then collects all of them
+    solver.migrate();
+    if (island_id != 0) {
+      return assignment_t<i_t>(solution_status_t::EMPTY, problem.handle_ptr->get_stream());
+    }
+    island_exchange->wait_for_others();
+    solver.migrate();
+  }
+  if (n_final_elites > 0) { final_elites = solver.get_elites(n_final_elites); }
   if (solver.reserve_population.is_feasible()) {
     auto best_sol = solver.reserve_population.best_feasible().sol;
     return get_ges_assignment(best_sol, solver.injection_info.accepted);
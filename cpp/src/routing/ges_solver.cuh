@@ -1,12 +1,14 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #pragma once
 
+#include "diversity/incumbent_stream.hpp"
+#include "diversity/island_exchange.hpp"
 #include "node/pdp_node.cuh"
 #include "problem/problem.cuh"
 #include "solution/pool_allocator.cuh"
@@ -49,6 +51,15 @@ class ges_solver_t {
   // currently the interval dump time interval is ignored, adjust when we get settings struct
   // keep in mind that currently this is not thread safe, we can adjust it later
   std::ofstream* intermediate_file;
+  // set when the islands are solved concurrently on several devices, only the first island
+  // returns a solution
+  island_exchange_t* island_exchange{nullptr};
+  i_t island_id{0};
+  // set when the best solutions are passed to the incumbent callback or to the best results file
+  incumbent_stream_t* incumbent_stream{nullptr};
+  // when positive, the best solutions of the search are kept in final_elites
+  i_t n_final_elites{0};
+  std::vector<island_exchange_t::migrant_t> final_elites;
 };
 
 }  // namespace routing
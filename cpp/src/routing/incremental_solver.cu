@@ -0,0 +1,176 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/error.hpp>
+#include <cuopt/routing/incremental_solver.hpp>
+#include <routing/solver.hpp>
+#include <utilities/copy_helpers.hpp>
+#include <utilities/logger.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
+namespace cuopt {
+namespace routing {
+
+template <typename i_t, typename f_t>
+incremental_solver_t<i_t, f_t>::incremental_solver_t(solver_settings_t<i_t, f_t> const& settings,
+                                                     i_t max_kept_solutions)
+  : settings_(settings), max_kept_solutions_(max_kept_solutions)
+{
+  cuopt_expects(max_kept_solutions > 0,
+                error_type_t::ValidationError,
+                "Number of kept solutions must be positive");
+}
+
+template <typename i_t, typename f_t>
+assignment_t<i_t> incremental_solver_t<i_t, f_t>::solve(
+  data_model_view_t<i_t, f_t> const& data_model, std::vector<i_t> const& order_ids)
+{
+  auto stream = data_model.get_handle_ptr()->get_stream();
+  try {
+    const i_t n_orders = data_model.get_num_orders();
+    cuopt_expects((i_t)order_ids.size() == n_orders,
+                  error_type_t::ValidationError,
+                  "There should be one id per order");
+    // without order locations, order 0 is the depot
+    const i_t first_order = data_model.get_order_locations() == nullptr ? 1 : 0;
+    std::unordered_map<i_t, i_t> order_of_id;
+    for (i_t order = first_order; order < n_orders; ++order) {
+      cuopt_expects(order_of_id.emplace(order_ids[order], order).second,
+                    error_type_t::ValidationError,
+                    "Order ids should be unique");
+    }
+
+    std::vector<i_t> brother(n_orders, -1);
+    std::vector<bool> is_pickup(n_orders, false);
+    auto [d_pickups, d_deliveries] = data_model.get_pickup_delivery_pair();
+    if (d_pickups != nullptr) {
+      auto pickups    = cuopt::host_copy(d_pickups, data_model.get_num_requests(), stream);
+      auto deliveries = cuopt::host_copy(d_deliveries, data_model.get_num_requests(), stream);
+      for (size_t i = 0; i < pickups.size(); ++i) {
+        brother[pickups[i]]    = deliveries[i];
+        brother[deliveries[i]] = pickups[i];
+        is_pickup[pickups[i]]  = true;
+      }
+    }
+
+    // Translate the kept solutions to the orders of this model. The device arrays must outlive
+    // the solve
+    std::vector<i_t> h_vehicle_ids, h_routes, h_sol_offsets{0};
+    std::vector<node_type_t> h_types;
+    auto [initial_vehicle_ids, initial_routes, initial_types, initial_offsets] =
+      data_model.get_initial_solutions();
+    for (const auto& kept_routes : kept_solutions_) {
+      if (!initial_vehicle_ids.empty()) { break; }
+      std::vector<std::pair<i_t, std::vector<i_t>>> routes;
+      std::vector<i_t> route_of_order(n_orders, -1);
+      for (const auto& kept_route : kept_routes) {
+        if (kept_route.vehicle_id >= data_model.get_fleet_size()) { continue; }
+        auto& [vehicle_id, orders] = routes.emplace_back(kept_route.vehicle_id, std::vector<i_t>{});
+        for (auto id : kept_route.order_ids) {
+          auto it = order_of_id.find(id);
+          if (it == order_of_id.end()) { continue; }
+          orders.push_back(it->second);
+          route_of_order[it->second] = routes.size() - 1;
+        }
+      }
+      if (routes.empty()) { continue; }
+
+      // the requests split between routes are placed again
+      for (auto& [vehicle_id, orders] : routes) {
+        auto split = [&](i_t order) {
+          return brother[order] >= 0 && route_of_order[brother[order]] != route_of_order[order];
+        };
+        std::vector<i_t> split_orders;
+        std::copy_if(orders.begin(), orders.end(), std::back_inserter(split_orders), split);
+        orders.erase(std::remove_if(orders.begin(), orders.end(), split), orders.end());
+        for (auto order : split_orders) {
+          route_of_order[order] = -1;
+        }
+      }
+      for (i_t order = first_order; order < n_orders; ++order) {
+        if (route_of_order[order] >= 0 || (brother[order] >= 0 && !is_pickup[order])) {
+          continue;
+        }
+        auto& orders = std::min_element(routes.begin(), routes.end(), [](auto& a, auto& b) {
+                         return a.second.size() < b.second.size();
+                       })->second;
+        orders.push_back(order);
+        if (brother[order] >= 0) { orders.push_back(brother[order]); }
+      }
+
+      const size_t begin = h_routes.size();
+      for (const auto& [vehicle_id, orders] : routes) {
+        for (auto order : orders) {
+          h_vehicle_ids.push_back(vehicle_id);
+          h_routes.push_back(order);
+          h_types.push_back(is_pickup[order] ? node_type_t::PICKUP : node_type_t::DELIVERY);
+        }
+      }
+      if (h_routes.size() > begin) { h_sol_offsets.push_back(h_routes.size()); }
+    }
+
+    auto model         = data_model;
+    auto d_vehicle_ids = cuopt::device_copy(h_vehicle_ids, stream);
+    auto d_routes      = cuopt::device_copy(h_routes, stream);
+    auto d_types       = cuopt::device_copy(h_types, stream);
+    auto d_sol_offsets = cuopt::device_copy(h_sol_offsets, stream);
+    if (h_sol_offsets.size() > 1) {
+      model.add_initial_solutions(d_vehicle_ids.data(),
+                                  d_routes.data(),
+                                  d_types.data(),
+                                  d_sol_offsets.data(),
+                                  h_routes.size(),
+                                  h_sol_offsets.size());
+    }
+
+    solver_t<i_t, f_t> solver(model, settings_);
+    solver.n_final_elites = max_kept_solutions_;
+    auto assignment       = solver.solve();
+
+    kept_solutions_.clear();
+    for (const auto& elite : solver.final_elites) {
+      auto& kept_routes = kept_solutions_.emplace_back();
+      for (size_t r = 0; r < elite.routes.size(); ++r) {
+        auto& kept_route      = kept_routes.emplace_back();
+        kept_route.vehicle_id = elite.vehicle_ids[r];
+        for (const auto& node : elite.routes[r]) {
+          kept_route.order_ids.push_back(order_ids[node.node()]);
+        }
+      }
+    }
+    return assignment;
+  } catch (const cuopt::logic_error& e) {
+    CUOPT_LOG_ERROR("Error in incremental solve: %s", e.what());
+    return assignment_t<i_t>(e, stream);
+  } catch (const std::bad_alloc& e) {
+    CUOPT_LOG_ERROR("Error in incremental solve: %s", e.what());
+    return assignment_t<i_t>(
+      cuopt::logic_error("Memory allocation failed", cuopt::error_type_t::RuntimeError), stream);
+  }
+}
+
+template <typename i_t, typename f_t>
+i_t incremental_solver_t<i_t, f_t>::get_num_kept_solutions() const noexcept
+{
+  return kept_solutions_.size();
+}
+
+template <typename i_t, typename f_t>
+void incremental_solver_t<i_t, f_t>::clear() noexcept
+{
+  kept_solutions_.clear();
+}
+
+template class incremental_solver_t<int, float>;
+
+}  // namespace routing
+}  // namespace cuopt
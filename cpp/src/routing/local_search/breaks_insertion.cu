@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -15,6 +15,18 @@ namespace cuopt {
 namespace routing {
 namespace detail {
 
+template <typename i_t, typename f_t, request_t REQUEST>
+DI break_search_key_t get_break_search_key(const typename route_t<i_t, f_t, REQUEST>::view_t& route,
+                                           const bool include_objective,
+                                           const infeasible_cost_t& weights)
+{
+  break_search_key_t key;
+  key.cost       = route.get_cost(include_objective, weights);
+  key.n_nodes    = route.get_num_nodes();
+  key.vehicle_id = route.get_vehicle_id();
+  return key;
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void find_break_insertions_kernel(
   typename solution_t<i_t, f_t, REQUEST>::view_t solution,
@@ -34,6 +46,11 @@ __global__ void find_break_insertions_kernel(
   i_t ejected_break_dim = blockIdx.x % n_max_break_dims;
   auto global_route     = solution.routes[route_id];
   if (ejected_break_dim >= global_route.get_num_breaks()) { return; }
+  // the route was already searched in this state without finding an improving move
+  if (breaks_move_candidates.searched_keys[route_id] ==
+      get_break_search_key<i_t, f_t, REQUEST>(global_route, include_objective, weights)) {
+    return;
+  }
 
   for (int i = 0; i < global_route.get_num_nodes(); ++i) {
     auto node = global_route.get_node(i);
@@ -146,6 +163,25 @@ __global__ void find_break_insertions_kernel(
   }
 }
 
+// Records the routes on which no improving break move was found, so that the next searches skip
+// them until they change
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void record_break_searches_kernel(
+  typename solution_t<i_t, f_t, REQUEST>::view_t solution,
+  const bool include_objective,
+  infeasible_cost_t weights,
+  typename breaks_move_candidates_t<i_t, f_t>::view_t breaks_move_candidates)
+{
+  i_t route_id = threadIdx.x + blockIdx.x * blockDim.x;
+  if (route_id >= solution.n_routes) { return; }
+  if (breaks_move_candidates.best_cand_per_route[route_id].cost < -EPSILON) {
+    breaks_move_candidates.searched_keys[route_id] = break_search_key_t{};
+  } else {
+    breaks_move_candidates.searched_keys[route_id] = get_break_search_key<i_t, f_t, REQUEST>(
+      solution.routes[route_id], include_objective, weights);
+  }
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 void find_break_insertions(solution_t<i_t, f_t, REQUEST>& sol,
                            move_candidates_t<i_t, f_t>& move_candidates)
@@ -172,7 +208,18 @@ void find_break_insertions(solution_t<i_t, f_t, REQUEST>& sol,
         move_candidates.include_objective,
         move_candidates.weights,
         move_candidates.breaks_move_candidates.view());
-    RAFT_CUDA_TRY(cudaStreamSynchronize(sol.sol_handle->get_stream()));
+    RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
+
+    constexpr i_t record_TPB = 128;
+    record_break_searches_kernel<i_t, f_t, REQUEST>
+      <<<(sol.get_n_routes() + record_TPB - 1) / record_TPB,
+         record_TPB,
+         0,
+         sol.sol_handle->get_stream()>>>(sol.view(),
+                                         move_candidates.include_objective,
+                                         move_candidates.weights,
+                                         move_candidates.breaks_move_candidates.view());
+    RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
   }
 }
 
@@ -185,7 +232,7 @@ __global__ void execute_break_moves(typename solution_t<i_t, f_t, REQUEST>::view
   i_t route_id         = blockIdx.x;
   auto curr_route_cand = best_cand_per_route[route_id];
 
-  if (curr_route_cand.cost > 0.) { return; }
+  if (curr_route_cand.cost >= -EPSILON) { return; }
 
   extern __shared__ i_t shmem[];
 
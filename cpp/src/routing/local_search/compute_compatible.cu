@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -9,14 +9,27 @@
 #include "compute_compatible.cuh"
 #include "local_search.cuh"
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
 #include <thrust/reduce.h>
 
+#include <cub/device/device_segmented_sort.cuh>
+
 #include <raft/util/cudart_utils.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
 namespace cuopt {
 namespace routing {
 namespace detail {
 
+// The pairs of orders are processed by tiles of rows of at most this many entries, so the grids
+// stay within the index range and the sorts within a bounded temporary memory
+constexpr int max_viable_tile_entries = 1 << 24;
+
 template <typename i_t,
           typename f_t,
           request_t REQUEST,
@@ -229,24 +242,30 @@ DI bool check_compatible(typename problem_t<i_t, f_t>::view_t problem,
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void initialize_incompatible_kernel(
   typename problem_t<i_t, f_t>::view_t problem,
-  uint8_t* compatibility_matrix,
-  const typename solution_t<i_t, f_t, REQUEST>::view_t sol)
+  bit_span::word_t* compatibility_matrix,
+  const typename solution_t<i_t, f_t, REQUEST>::view_t sol,
+  i_t row_begin,
+  i_t n_rows)
 {
   i_t t_id       = threadIdx.x + blockDim.x * blockIdx.x;
   i_t n_requests = problem.order_info.get_num_requests();
 
-  if (t_id >= n_requests * n_requests) return;
+  if (t_id >= n_rows * n_requests) return;
 
-  i_t i = t_id % n_requests;
-  i_t j = t_id / n_requests;
+  i_t i = row_begin + t_id % n_rows;
+  i_t j = t_id / n_rows;
 
   i_t p_i = REQUEST == request_t::PDP ? problem.pickup_indices[i]
                                       : i + (int)problem.order_info.depot_included;
   i_t p_j = REQUEST == request_t::PDP ? problem.pickup_indices[j]
                                       : j + (int)problem.order_info.depot_included;
 
-  uint8_t b = check_compatible<i_t, f_t, REQUEST>(problem, p_i, p_j, sol);
-  compatibility_matrix[p_i * problem.order_info.get_num_orders() + p_j] = b;
+  // the matrix starts all compatible, the threads of a word clear their bits concurrently
+  if (!check_compatible<i_t, f_t, REQUEST>(problem, p_i, p_j, sol)) {
+    const i_t row_words = bit_span::words_for(problem.order_info.get_num_orders());
+    atomicAnd(&compatibility_matrix[p_i * row_words + p_j / bit_span::word_bits],
+              ~(bit_span::word_t{1} << (p_j % bit_span::word_bits)));
+  }
 }
 
 template <typename i_t,
@@ -263,14 +282,16 @@ __global__ void initialize_viable_kernel(typename problem_t<i_t, f_t>::view_t pr
                                          i_t* n_viable_to_deliveries,
                                          i_t* n_viable_from_deliveries,
                                          const typename solution_t<i_t, f_t, REQUEST>::view_t sol,
-                                         bool is_problem_run)
+                                         bool is_problem_run,
+                                         i_t row_begin,
+                                         i_t n_rows)
 {
   i_t t_id     = threadIdx.x + blockDim.x * blockIdx.x;
   i_t n_orders = problem.order_info.get_num_orders();
-  if (t_id >= n_orders * n_orders) return;
+  if (t_id >= n_rows * n_orders) return;
 
-  i_t i = t_id % n_orders;
-  i_t j = t_id / n_orders;
+  i_t i = row_begin + t_id % n_rows;
+  i_t j = t_id / n_rows;
 
   const bool depot_included = problem.order_info.depot_included;
 
@@ -279,6 +300,8 @@ __global__ void initialize_viable_kernel(typename problem_t<i_t, f_t>::view_t pr
     if (i == 0 || j == 0) { return; }
   }
 
+  if (!problem.is_candidate_pair(i, j)) { return; }
+
   // check inserting j after i
   if (check_route_possible<i_t, f_t, REQUEST>(problem, i, j, sol, is_problem_run)) {
     i_t offset = atomicAdd(n_viable_from_pickups + i, 1);
@@ -306,21 +329,25 @@ __global__ void initialize_viable_kernel(typename problem_t<i_t, f_t>::view_t pr
                                          i_t* n_viable_to_deliveries,
                                          i_t* n_viable_from_deliveries,
                                          const typename solution_t<i_t, f_t, REQUEST>::view_t sol,
-                                         bool is_problem_run)
+                                         bool is_problem_run,
+                                         i_t row_begin,
+                                         i_t n_rows)
 {
   i_t t_id     = threadIdx.x + blockDim.x * blockIdx.x;
   i_t n_orders = problem.order_info.get_num_orders();
-  if (t_id >= n_orders * n_orders) return;
+  if (t_id >= n_rows * n_orders) return;
 
   const bool depot_included = problem.order_info.depot_included;
-  i_t i                     = t_id % n_orders;
-  i_t j                     = t_id / n_orders;
+  i_t i                     = row_begin + t_id % n_rows;
+  i_t j                     = t_id / n_rows;
 
   if (depot_included) {
     // we don't access any of them
     if (i == 0 || j == 0) { return; }
   }
 
+  if (!problem.is_candidate_pair(i, j)) { return; }
+
   i_t bi = problem.order_info.pair_indices[i];
   i_t bj = problem.order_info.pair_indices[j];
 
@@ -398,7 +425,7 @@ template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void calculate_route_compatibility_kernel(
   typename solution_t<i_t, f_t, REQUEST>::view_t solution,
   uint8_t* route_compatibility,
-  const uint8_t* compatibility_matrix)
+  const typename viables_t<i_t, f_t>::view_t viables)
 {
   const i_t n_requests = solution.get_num_requests();
   const i_t n_orders   = solution.get_num_orders();
@@ -416,12 +443,12 @@ __global__ void calculate_route_compatibility_kernel(
     if constexpr (REQUEST == request_t::PDP) {
       if (route.requests().node_info[z].is_pickup()) {
         i_t node_id = route.requests().node_info[z].node();
-        if (!compatibility_matrix[node_id * n_orders + p_i]) ++thread_incompatible;
+        if (!viables.is_compatible(node_id, p_i)) ++thread_incompatible;
       }
     } else {
       if (route.requests().node_info[z].is_service_node()) {
         i_t node_id = route.requests().node_info[z].node();
-        if (!compatibility_matrix[node_id * n_orders + p_i]) ++thread_incompatible;
+        if (!viables.is_compatible(node_id, p_i)) ++thread_incompatible;
       }
     }
   }
@@ -449,118 +476,104 @@ void local_search_t<i_t, f_t, REQUEST>::calculate_route_compatibility(
     <<<n_blocks, TPB, 0, sol.sol_handle->get_stream()>>>(
       sol.view(),
       move_candidates.route_compatibility.data(),
-      move_candidates.viables.compatibility_matrix.data());
+      move_candidates.viables.view());
   RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
 }
 
+// Sorts each row of a viable matrix by the distance between the order of the row and its viable
+// orders, the empty entries last. The rows are sorted tile by tile to bound the temporary memory
+template <typename i_t, typename f_t>
+static void sort_viable_rows(rmm::device_uvector<i_t>& viable_matrix,
+                             bool is_from_matrix,
+                             i_t n_orders,
+                             i_t n_requests,
+                             const VehicleInfo<f_t>& vehicle_info,
+                             const typename order_info_t<i_t, f_t>::view_t& order_info,
+                             raft::handle_t const* handle_ptr)
+{
+  auto stream           = handle_ptr->get_stream();
+  const i_t tile_rows   = std::max<i_t>(1, max_viable_tile_entries / n_requests);
+  const size_t tile_len = (size_t)std::min(tile_rows, n_orders) * n_requests;
+  rmm::device_uvector<double> keys(tile_len, stream);
+  rmm::device_uvector<double> sorted_keys(tile_len, stream);
+  rmm::device_uvector<i_t> sorted_values(tile_len, stream);
+  rmm::device_uvector<std::byte> temp_storage(0, stream);
+  auto row_offsets = thrust::make_transform_iterator(
+    thrust::counting_iterator<i_t>(0),
+    [n_requests] __device__(i_t row) { return row * n_requests; });
+
+  for (i_t row_begin = 0; row_begin < n_orders; row_begin += tile_rows) {
+    const i_t n_rows     = std::min(tile_rows, n_orders - row_begin);
+    const size_t n_items = (size_t)n_rows * n_requests;
+    i_t* values          = viable_matrix.data() + (size_t)row_begin * n_requests;
+    thrust::transform(
+      handle_ptr->get_thrust_policy(),
+      thrust::counting_iterator<size_t>(0),
+      thrust::counting_iterator<size_t>(n_items),
+      keys.begin(),
+      [values, row_begin, n_requests, is_from_matrix, vehicle_info, order_info] __device__(
+        size_t idx) -> double {
+        i_t other = values[idx];
+        if (other == -1) { return std::numeric_limits<double>::infinity(); }
+        i_t row = row_begin + idx / n_requests;
+        auto row_info =
+          NodeInfo<i_t>(row, order_info.get_order_location(row), node_type_t::PICKUP);
+        auto other_info =
+          NodeInfo<i_t>(other, order_info.get_order_location(other), node_type_t::PICKUP);
+        return is_from_matrix ? get_distance(row_info, other_info, vehicle_info)
+                              : get_distance(other_info, row_info, vehicle_info);
+      });
+    size_t temp_bytes = 0;
+    RAFT_CUDA_TRY(cub::DeviceSegmentedSort::StableSortPairs(nullptr,
+                                                            temp_bytes,
+                                                            keys.data(),
+                                                            sorted_keys.data(),
+                                                            values,
+                                                            sorted_values.data(),
+                                                            n_items,
+                                                            n_rows,
+                                                            row_offsets,
+                                                            row_offsets + 1,
+                                                            stream));
+    temp_storage.resize(temp_bytes, stream);
+    RAFT_CUDA_TRY(cub::DeviceSegmentedSort::StableSortPairs(temp_storage.data(),
+                                                            temp_bytes,
+                                                            keys.data(),
+                                                            sorted_keys.data(),
+                                                            values,
+                                                            sorted_values.data(),
+                                                            n_items,
+                                                            n_rows,
+                                                            row_offsets,
+                                                            row_offsets + 1,
+                                                            stream));
+    raft::copy(values, sorted_values.data(), n_items, stream);
+  }
+}
+
 // sort the viable matrix according to the distance after the insertion
 template <typename i_t, typename f_t>
 void problem_t<i_t, f_t>::sort_viable_matrix(rmm::device_uvector<i_t>& viable_from_matrix,
                                              rmm::device_uvector<i_t>& viable_to_matrix)
 {
   raft::common::nvtx::range fun_scope("sort_viable_matrix");
-  rmm::device_uvector<i_t> segments(get_num_orders() * get_num_requests(),
-                                    handle_ptr->get_stream());
-  const i_t l_n_requests = get_num_requests();
-
   // FIXME: doing it only for first vehicle, this is wrong
   const auto l_vehicle_info = fleet_info.get_vehicle_info(0, handle_ptr->get_stream());
   auto order_info_view      = this->order_info.view();
-  // create segments
-  thrust::transform(handle_ptr->get_thrust_policy(),
-                    thrust::counting_iterator<i_t>(0),
-                    thrust::counting_iterator<i_t>(0) + get_num_orders() * get_num_requests(),
-                    segments.begin(),
-                    [l_n_requests] __device__(i_t idx) -> i_t {
-                      i_t segment = idx / l_n_requests;
-                      return segment;
-                    });
-  // sort according to distance
-  thrust::stable_sort(
-    handle_ptr->get_thrust_policy(),
-    thrust::make_zip_iterator(viable_from_matrix.begin(), segments.begin()),
-    thrust::make_zip_iterator(viable_from_matrix.end(), segments.end()),
-    [l_vehicle_info, order_info_view] __device__(auto first, auto second) -> bool {
-      i_t to_node_1   = thrust::get<0>(first);
-      i_t to_node_2   = thrust::get<0>(second);
-      i_t from_node_1 = thrust::get<1>(first);
-      i_t from_node_2 = thrust::get<1>(second);
-      if (to_node_1 == -1) return false;
-      if (to_node_2 == -1) return true;
-      auto dist_between_1 = get_distance(
-        NodeInfo<i_t>(
-          from_node_1, order_info_view.get_order_location(from_node_1), node_type_t::PICKUP),
-        NodeInfo<i_t>(
-          to_node_1, order_info_view.get_order_location(to_node_1), node_type_t::PICKUP),
-        l_vehicle_info);
-      auto dist_between_2 = get_distance(
-        NodeInfo<i_t>(
-          from_node_2, order_info_view.get_order_location(from_node_2), node_type_t::PICKUP),
-        NodeInfo<i_t>(
-          to_node_2, order_info_view.get_order_location(to_node_2), node_type_t::PICKUP),
-        l_vehicle_info);
-      return dist_between_1 < dist_between_2;
-    });
-  // sort the segments
-  thrust::stable_sort(handle_ptr->get_thrust_policy(),
-                      thrust::make_zip_iterator(viable_from_matrix.begin(), segments.begin()),
-                      thrust::make_zip_iterator(viable_from_matrix.end(), segments.end()),
-                      [] __device__(auto first, auto second) -> bool {
-                        i_t from_node_1 = thrust::get<1>(first);
-                        i_t from_node_2 = thrust::get<1>(second);
-                        return from_node_1 < from_node_2;
-                      });
-  // create segments again
-  thrust::transform(handle_ptr->get_thrust_policy(),
-                    thrust::counting_iterator<i_t>(0),
-                    thrust::counting_iterator<i_t>(0) + get_num_orders() * get_num_requests(),
-                    segments.begin(),
-                    [l_n_requests] __device__(i_t idx) -> i_t {
-                      i_t segment = idx / l_n_requests;
-                      return segment;
-                    });
-  // sort according to distance
-  thrust::stable_sort(
-    handle_ptr->get_thrust_policy(),
-    thrust::make_zip_iterator(viable_to_matrix.begin(), segments.begin()),
-    thrust::make_zip_iterator(viable_to_matrix.end(), segments.end()),
-    [l_vehicle_info, order_info_view] __device__(auto first, auto second) -> bool {
-      i_t from_node_1 = thrust::get<0>(first);
-      i_t from_node_2 = thrust::get<0>(second);
-      i_t to_node_1   = thrust::get<1>(first);
-      i_t to_node_2   = thrust::get<1>(second);
-      if (from_node_1 == -1) return false;
-      if (from_node_2 == -1) return true;
-      auto dist_between_1 = get_distance(
-        NodeInfo<i_t>(
-          from_node_1, order_info_view.get_order_location(from_node_1), node_type_t::PICKUP),
-        NodeInfo<i_t>(
-          to_node_1, order_info_view.get_order_location(to_node_1), node_type_t::PICKUP),
-        l_vehicle_info);
-      auto dist_between_2 = get_distance(
-        NodeInfo<i_t>(
-          from_node_2, order_info_view.get_order_location(from_node_2), node_type_t::PICKUP),
-        NodeInfo<i_t>(
-          to_node_2, order_info_view.get_order_location(to_node_2), node_type_t::PICKUP),
-        l_vehicle_info);
-      return dist_between_1 < dist_between_2;
-    });
-  // sort the segments again to get back the segmented sorted
-  thrust::stable_sort(handle_ptr->get_thrust_policy(),
-                      thrust::make_zip_iterator(viable_to_matrix.begin(), segments.begin()),
-                      thrust::make_zip_iterator(viable_to_matrix.end(), segments.end()),
-                      [] __device__(auto first, auto second) -> bool {
-                        i_t to_node_1 = thrust::get<1>(first);
-                        i_t to_node_2 = thrust::get<1>(second);
-                        return to_node_1 < to_node_2;
-                      });
-  // raft::print_device_vector(
-  //   "viable_to_matrix:", viable_to_matrix.data(), viable_to_matrix.size(),
-  //   std::cout);
-  // raft::print_device_vector(
-  //   "viable_from_matrix:", viable_from_matrix.data(), viable_from_matrix.size(),
-  //   std::cout);
-  //   printf("\n");
+  sort_viable_rows<i_t, f_t>(viable_from_matrix,
+                             true,
+                             get_num_orders(),
+                             get_num_requests(),
+                             l_vehicle_info,
+                             order_info_view,
+                             handle_ptr);
+  sort_viable_rows<i_t, f_t>(viable_to_matrix,
+                             false,
+                             get_num_orders(),
+                             get_num_requests(),
+                             l_vehicle_info,
+                             order_info_view,
+                             handle_ptr);
   handle_ptr->sync_stream();
 }
 
@@ -576,8 +589,9 @@ void initialize_incompatible(problem_t<i_t, f_t>& problem, solution_t<i_t, f_t,
     is_problem_run = false;
   }
   auto& viables = problem.viables;
-  i_t n_items   = problem.get_num_orders() * problem.get_num_orders();
-  viables.compatibility_matrix.resize(n_items, handle_ptr->get_stream());
+  viables.compatibility_row_words = bit_span::words_for(problem.get_num_orders());
+  viables.compatibility_matrix.resize(problem.get_num_orders() * viables.compatibility_row_words,
+                                      handle_ptr->get_stream());
   viables.viable_to_pickups.resize(problem.get_num_orders() * problem.get_num_requests(),
                                    handle_ptr->get_stream());
   viables.viable_from_pickups.resize(problem.get_num_orders() * problem.get_num_requests(),
@@ -594,7 +608,7 @@ void initialize_incompatible(problem_t<i_t, f_t>& problem, solution_t<i_t, f_t,
   thrust::fill(handle_ptr->get_thrust_policy(),
                viables.compatibility_matrix.begin(),
                viables.compatibility_matrix.end(),
-               uint8_t(1));
+               ~bit_span::word_t{0});
 
   thrust::fill(handle_ptr->get_thrust_policy(),
                viables.viable_to_pickups.begin(),
@@ -629,34 +643,22 @@ void initialize_incompatible(problem_t<i_t, f_t>& problem, solution_t<i_t, f_t,
                viables.n_viable_from_deliveries.begin(),
                viables.n_viable_from_deliveries.end(),
                0);
-  i_t TPB      = 256;
-  i_t n_blocks = (problem.get_num_requests() * problem.get_num_requests() - 1 + TPB) / TPB;
-  if constexpr (REQUEST == request_t::PDP) {
-    initialize_incompatible_kernel<i_t, f_t, request_t::PDP>
+  constexpr i_t TPB    = 256;
+  const i_t n_requests = problem.get_num_requests();
+  const i_t n_orders   = problem.get_num_orders();
+  const i_t tile_rows  = std::max<i_t>(1, max_viable_tile_entries / n_orders);
+  for (i_t row_begin = 0; row_begin < n_requests; row_begin += tile_rows) {
+    const i_t n_rows   = std::min(tile_rows, n_requests - row_begin);
+    const i_t n_blocks = (n_rows * n_requests + TPB - 1) / TPB;
+    initialize_incompatible_kernel<i_t, f_t, REQUEST>
       <<<n_blocks, TPB, 0, handle_ptr->get_stream()>>>(
-        problem.view(), viables.compatibility_matrix.data(), sol_view);
-    RAFT_CUDA_TRY(cudaStreamSynchronize(handle_ptr->get_stream()));
-    n_blocks = (problem.get_num_orders() * problem.get_num_orders() - 1 + TPB) / TPB;
-    initialize_viable_kernel<i_t, f_t, request_t::PDP>
-      <<<n_blocks, TPB, 0, handle_ptr->get_stream()>>>(problem.view(),
-                                                       viables.viable_to_pickups.data(),
-                                                       viables.viable_from_pickups.data(),
-                                                       viables.n_viable_to_pickups.data(),
-                                                       viables.n_viable_from_pickups.data(),
-                                                       viables.viable_to_deliveries.data(),
-                                                       viables.viable_from_deliveries.data(),
-                                                       viables.n_viable_to_deliveries.data(),
-                                                       viables.n_viable_from_deliveries.data(),
-                                                       sol_view,
-                                                       is_problem_run);
-    RAFT_CUDA_TRY(cudaStreamSynchronize(handle_ptr->get_stream()));
-  } else {
-    initialize_incompatible_kernel<i_t, f_t, request_t::VRP>
-      <<<n_blocks, TPB, 0, handle_ptr->get_stream()>>>(
-        problem.view(), viables.compatibility_matrix.data(), sol_view);
-    RAFT_CUDA_TRY(cudaStreamSynchronize(handle_ptr->get_stream()));
-    n_blocks = (problem.get_num_orders() * problem.get_num_orders() - 1 + TPB) / TPB;
-    initialize_viable_kernel<i_t, f_t, request_t::VRP>
+        problem.view(), viables.compatibility_matrix.data(), sol_view, row_begin, n_rows);
+    RAFT_CHECK_CUDA(handle_ptr->get_stream());
+  }
+  for (i_t row_begin = 0; row_begin < n_orders; row_begin += tile_rows) {
+    const i_t n_rows   = std::min(tile_rows, n_orders - row_begin);
+    const i_t n_blocks = (n_rows * n_orders + TPB - 1) / TPB;
+    initialize_viable_kernel<i_t, f_t, REQUEST>
       <<<n_blocks, TPB, 0, handle_ptr->get_stream()>>>(problem.view(),
                                                        viables.viable_to_pickups.data(),
                                                        viables.viable_from_pickups.data(),
@@ -667,8 +669,10 @@ void initialize_incompatible(problem_t<i_t, f_t>& problem, solution_t<i_t, f_t,
                                                        viables.n_viable_to_deliveries.data(),
                                                        viables.n_viable_from_deliveries.data(),
                                                        sol_view,
-                                                       is_problem_run);
-    RAFT_CUDA_TRY(cudaStreamSynchronize(handle_ptr->get_stream()));
+                                                       is_problem_run,
+                                                       row_begin,
+                                                       n_rows);
+    RAFT_CHECK_CUDA(handle_ptr->get_stream());
   }
   problem.sort_viable_matrix(viables.viable_to_pickups, viables.viable_from_pickups);
   problem.sort_viable_matrix(viables.viable_to_deliveries, viables.viable_from_deliveries);
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -162,7 +162,8 @@ filter_viable_requests(const typename solution_t<i_t, f_t, REQUEST>::view_t& sol
       }
       auto pickup_id = curr_req.id();
       // Don't allow inserting of nodes from same route
-      if ((insert_unserviced && !route_node_map.is_node_served(pickup_id)) ||
+      if ((insert_unserviced && !route_node_map.is_node_served(pickup_id) &&
+           solution.problem.is_prize_candidate(pickup_id)) ||
           (!insert_unserviced && route_node_map.is_node_served(pickup_id) &&
            route_id != route_node_map.get_route_id(pickup_id))) {
         compacted_requests[j] = 1;
@@ -245,8 +246,9 @@ filter_viable_requests(const typename solution_t<i_t, f_t, REQUEST>::view_t& sol
       }
 
       if ((!insert_unserviced && route_id_of_inserted == -1) ||
-          // for prize collection, don't consider already serviced nodes
+          // for prize collection, don't consider already serviced nodes nor pruned ones
           (insert_unserviced && route_id_of_inserted >= 0) ||
+          (insert_unserviced && !solution.problem.is_prize_candidate(pickup_id_of_viable_node)) ||
           (route_id_of_inserted == route_id && pickup_id_of_viable_node != ejected_pickup_id)) {
         continue;
       }
@@ -273,9 +275,8 @@ filter_viable_requests(const typename solution_t<i_t, f_t, REQUEST>::view_t& sol
       }
       // 1 request not compatible and we are checking whether that request is ejected
       else if ((is_ejected && (comp_val == 1) &&
-                !move_candidates.viables
-                   .compatibility_matrix[pickup_id_of_viable_node * solution.get_num_orders() +
-                                         ejected_pickup_id])) {
+                !move_candidates.viables.is_compatible(pickup_id_of_viable_node,
+                                                       ejected_pickup_id))) {
         compatible = true;
       } else if (ejected_pickup_id == pickup_id_of_viable_node) {
         compatible = true;
@@ -647,10 +648,8 @@ __global__ void find_insertions_kernel(typename solution_t<i_t, f_t, REQUEST>::v
   i_t route_idx;
   request_id_t<REQUEST> ejected_id;
 
-  [[maybe_unused]] raft::random::PCGenerator thread_rng(
-    seed + (threadIdx.x + blockIdx.x * blockDim.x),
-    uint64_t(solution.solution_id * (threadIdx.x + blockIdx.x * blockDim.x)),
-    0);
+  [[maybe_unused]] auto thread_rng =
+    make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x), solution.solution_id);
 
   auto compacted_requests =
     raft::device_span<uint16_t>((uint16_t*)(shmem), solution.get_num_requests());
@@ -108,7 +108,7 @@ bool ExactCycleFinder<i_t, f_t, max_routes>::call_find(graph_t<i_t, f_t>& graph,
     2 * raft::WarpSize * sizeof(double) + (sizeof(double) + sizeof(i_t)) * max_graph_nodes_per_row;
 
   // cycle_candidates.reset(n_blocks, handle_ptr);
-  bool last_level = level == (max_level - 1);
+  bool last_level = level == (level_limit - 1);
   if (last_level) {
     if (!set_shmem_of_kernel(find_kernel<i_t, f_t, max_routes, true>, sh_size)) { return false; }
     find_kernel<i_t, f_t, max_routes, true>
@@ -136,12 +136,15 @@ bool ExactCycleFinder<i_t, f_t, max_routes>::call_find(graph_t<i_t, f_t>& graph,
 }
 
 template <typename map_key_t, typename value_t>
-void detail::device_map_t<map_key_t, value_t>::clear(rmm::cuda_stream_view stream)
+void detail::device_map_t<map_key_t, value_t>::clear(rmm::cuda_stream_view stream, int n_levels)
 {
-  auto max_vals  = max_level * max_available;
+  auto max_vals  = n_levels * max_available;
   auto n_threads = 256;
   auto n_blocks  = std::min((max_vals + n_threads - 1) / n_threads, max_blocks);
-  clear_map<map_key_t, value_t><<<n_blocks, n_threads, 0, stream>>>(this->view());
+  auto map_view  = this->view();
+  // the levels above n_levels are not used by the search and stay cleared
+  map_view.max_level = n_levels;
+  clear_map<map_key_t, value_t><<<n_blocks, n_threads, 0, stream>>>(map_view);
   RAFT_CHECK_CUDA(stream);
 }
 
@@ -161,10 +164,10 @@ template <typename i_t, typename f_t, size_t max_routes>
 bool ExactCycleFinder<i_t, f_t, max_routes>::find_cycle(graph_t<i_t, f_t>& graph)
 {
   raft::common::nvtx::range fun_scope("find_cycle");
-  d_valid_paths.clear(handle_ptr->get_stream());
+  d_valid_paths.clear(handle_ptr->get_stream(), level_limit);
   cuopt_assert(test_empty<max_routes>(d_valid_paths.subspan(0), handle_ptr->get_stream()), "");
   if (!call_init(graph)) { return false; }
-  for (int i = 1; i < max_level; ++i) {
+  for (int i = 1; i < level_limit; ++i) {
     cuopt_assert(test_empty<max_routes>(d_valid_paths.subspan(i), handle_ptr->get_stream()), "");
     int curr_level_occupied = d_valid_paths.get_size(i - 1, handle_ptr->get_stream());
     if (!curr_level_occupied) break;
@@ -339,10 +342,12 @@ template <typename i_t, typename f_t, size_t max_routes>
 void ExactCycleFinder<i_t, f_t, max_routes>::find_best_cycles(
   graph_t<i_t, f_t>& graph,
   ret_cycles_t<i_t, f_t>& ret,
-  const solution_handle_t<i_t, f_t>* sol_handle)
+  const solution_handle_t<i_t, f_t>* sol_handle,
+  i_t max_cycle_length)
 {
   raft::common::nvtx::range fun_scope("find_best_cycles");
-  handle_ptr = const_cast<solution_handle_t<i_t, f_t>*>(sol_handle);
+  handle_ptr  = const_cast<solution_handle_t<i_t, f_t>*>(sol_handle);
+  level_limit = max_cycle_length > 0 ? std::min(max_cycle_length, max_level) : max_level;
   best_cycles.reset(handle_ptr->get_stream());
   cycle_candidates.reset(graph.get_num_vertices(), handle_ptr);
   if (!find_cycle(graph)) { return; }
@@ -359,9 +364,9 @@ void ExactCycleFinder<i_t, f_t, max_routes>::find_best_cycles(
 }
 
 template void ExactCycleFinder<int, float, 128>::find_best_cycles(
-  graph_t<int, float>&, ret_cycles_t<int, float>&, solution_handle_t<int, float> const* sol_handle);
+  graph_t<int, float>&, ret_cycles_t<int, float>&, solution_handle_t<int, float> const*, int);
 template void ExactCycleFinder<int, float, 1024>::find_best_cycles(
-  graph_t<int, float>&, ret_cycles_t<int, float>&, solution_handle_t<int, float> const* sol_handle);
+  graph_t<int, float>&, ret_cycles_t<int, float>&, solution_handle_t<int, float> const*, int);
 
 }  // namespace detail
 }  // namespace routing
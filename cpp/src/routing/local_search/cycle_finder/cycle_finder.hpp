@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -183,6 +183,7 @@ struct ExactCycleFinder {
                    i_t max_level_    = 10,
                    size_t max_paths_ = 50000)
     : max_level(max_level_),
+      level_limit(max_level_),
       max_paths(max_paths_),
       d_valid_paths(handle_ptr_, max_level_, max_paths_),
       best_cycles(handle_ptr_),
@@ -206,9 +207,13 @@ struct ExactCycleFinder {
 
   bool find_cycle(graph_t<i_t, f_t>& graph);
 
+  /*! \brief { Finds the best disjoint negative cycles of at most max_cycle_length edges. The
+   * length is bounded by the max_level of the construction, a non positive length searches up to
+   * it } */
   void find_best_cycles(graph_t<i_t, f_t>& graph,
                         ret_cycles_t<i_t, f_t>& ret,
-                        solution_handle_t<i_t, f_t> const* sol_handle);
+                        solution_handle_t<i_t, f_t> const* sol_handle,
+                        i_t max_cycle_length = -1);
 
   bool check_cycle(graph_t<i_t, f_t>& graph, ret_cycles_t<i_t, f_t>& ret);
 
@@ -226,6 +231,8 @@ struct ExactCycleFinder {
   rmm::device_uvector<double> copy_cost;
   rmm::device_uvector<int> copy_indices;
   i_t max_level{};
+  // max_level of the current search
+  i_t level_limit{};
   i_t n_occupied_heads;
   size_t max_paths{};
   size_t max_threads{};
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -58,7 +58,8 @@ struct device_map_t {
   {
   }
 
-  void clear(rmm::cuda_stream_view stream);
+  //! Clears the first n_levels levels of the map
+  void clear(rmm::cuda_stream_view stream, int n_levels);
 
   uint32_t get_max_size() const
   {
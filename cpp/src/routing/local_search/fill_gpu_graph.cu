@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -89,9 +89,7 @@ __global__ void fill_intra_candidates(typename solution_t<i_t, f_t, REQUEST>::vi
   __shared__ double shmem[raft::WarpSize * 2];
   __shared__ i_t reduction_idx;
   i_t route_id = blockIdx.x;
-  raft::random::PCGenerator thread_rng(seed + (threadIdx.x + blockIdx.x * blockDim.x),
-                                       uint64_t(route_id * (threadIdx.x + blockIdx.x * blockDim.x)),
-                                       0);
+  auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x));
   double thread_best_cost = std::numeric_limits<double>::max();
   i_t thread_best_node_id = -1;
   i_t counter             = 1;
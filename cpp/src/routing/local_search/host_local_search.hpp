@@ -0,0 +1,174 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include "../diversity/island_exchange.hpp"
+#include "../problem/problem.cuh"
+#include "../solution/solution.cuh"
+
+#include <utilities/timer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+namespace detail {
+
+/*! \brief { Local search run by host threads on the routes of a solution, with the same node
+ * evaluation as the device search. It applies first improving 2-opt, relocate and or-opt moves
+ * until a local optimum or the time limit. Only VRP problems without breaks nor time dependent
+ * transit times are supported, the routes are never emptied so that the vehicle costs stay
+ * constant } */
+template <typename i_t, typename f_t, request_t REQUEST>
+class host_local_search_t {
+  using node_type = node_t<i_t, f_t, REQUEST>;
+  using route_t   = std::vector<NodeInfo<i_t>>;
+
+ public:
+  static constexpr i_t max_segment_size = 3;
+
+  host_local_search_t(const problem_t<i_t, f_t>* problem_) : problem(problem_) {}
+
+  static bool is_supported(const problem_t<i_t, f_t>& problem)
+  {
+    return REQUEST == request_t::VRP && problem.special_nodes.is_empty() &&
+           !problem.dimensions_info.time_dim.is_time_dependent;
+  }
+
+  /*! \brief { Sets the cost and the feasibility of the migrant with the host evaluation } */
+  void evaluate(island_exchange_t::migrant_t& migrant) const
+  {
+    const bool include_objective = false;
+    migrant.cost                 = 0.;
+    migrant.feasible             = true;
+    for (size_t r = 0; r < migrant.routes.size(); ++r) {
+      migrant.cost += route_cost(migrant.vehicle_ids[r], migrant.routes[r]);
+      if (route_cost(migrant.vehicle_ids[r], migrant.routes[r], include_objective) >= EPSILON) {
+        migrant.feasible = false;
+      }
+    }
+  }
+
+  /*! \brief { Improves the routes of the migrant in place, returns true if the cost decreased } */
+  bool improve(island_exchange_t::migrant_t& migrant, const timer_t& timer) const
+  {
+    std::vector<double> costs(migrant.routes.size());
+    for (size_t r = 0; r < migrant.routes.size(); ++r) {
+      costs[r] = route_cost(migrant.vehicle_ids[r], migrant.routes[r]);
+    }
+    bool improved = false;
+    bool found    = true;
+    while (found && !timer.check_time_limit()) {
+      found = run_two_opt(migrant, costs, timer) || run_relocate(migrant, costs, timer);
+      improved |= found;
+    }
+    if (improved) { evaluate(migrant); }
+    return improved;
+  }
+
+ private:
+  // Weighted cost of the route from its start depot to its return depot, without the vehicle cost
+  double route_cost(i_t vehicle_id, const route_t& route, bool include_objective = true) const
+  {
+    auto vehicle_info = problem->get_vehicle_info(vehicle_id);
+    auto start_info   = problem->start_depot_node_infos_h[vehicle_id];
+    auto return_info  = problem->return_depot_node_infos_h[vehicle_id];
+    auto prev = create_depot_node<i_t, f_t, REQUEST>(problem, start_info, return_info, vehicle_id);
+    for (const auto& node_info : route) {
+      auto node = create_node<i_t, f_t, REQUEST>(problem, node_info, node_info);
+      prev.calculate_forward_all(node, vehicle_info);
+      prev = node;
+    }
+    auto return_depot =
+      create_depot_node<i_t, f_t, REQUEST>(problem, return_info, start_info, vehicle_id);
+    return node_type::cost_combine(prev,
+                                   return_depot,
+                                   vehicle_info,
+                                   include_objective,
+                                   weights,
+                                   objective_cost_t{},
+                                   infeasible_cost_t{});
+  }
+
+  // Reverses a segment of a route
+  bool run_two_opt(island_exchange_t::migrant_t& migrant,
+                   std::vector<double>& costs,
+                   const timer_t& timer) const
+  {
+    for (size_t r = 0; r < migrant.routes.size(); ++r) {
+      auto& route = migrant.routes[r];
+      for (size_t i = 0; i + 1 < route.size(); ++i) {
+        if (timer.check_time_limit()) { return false; }
+        for (size_t j = i + 1; j < route.size(); ++j) {
+          auto candidate = route;
+          std::reverse(candidate.begin() + i, candidate.begin() + j + 1);
+          double cost = route_cost(migrant.vehicle_ids[r], candidate);
+          if (cost < costs[r] - EPSILON) {
+            route    = std::move(candidate);
+            costs[r] = cost;
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  // Moves a segment of up to max_segment_size nodes to another position of the same or of another
+  // route. A single node move is a relocate, a longer one an or-opt
+  bool run_relocate(island_exchange_t::migrant_t& migrant,
+                    std::vector<double>& costs,
+                    const timer_t& timer) const
+  {
+    auto& routes = migrant.routes;
+    for (size_t r = 0; r < routes.size(); ++r) {
+      for (size_t i = 0; i < routes[r].size(); ++i) {
+        if (timer.check_time_limit()) { return false; }
+        for (size_t len = 1; len <= (size_t)max_segment_size; ++len) {
+          // the route is kept non empty
+          if (i + len > routes[r].size() || len == routes[r].size()) { break; }
+          route_t segment(routes[r].begin() + i, routes[r].begin() + i + len);
+          route_t removed = routes[r];
+          removed.erase(removed.begin() + i, removed.begin() + i + len);
+          double removed_cost = route_cost(migrant.vehicle_ids[r], removed);
+          for (size_t s = 0; s < routes.size(); ++s) {
+            const auto& target = s == r ? removed : routes[s];
+            double old_cost    = s == r ? costs[r] : costs[r] + costs[s];
+            for (size_t k = 0; k <= target.size(); ++k) {
+              if (s == r && k == i) { continue; }
+              auto candidate = target;
+              candidate.insert(candidate.begin() + k, segment.begin(), segment.end());
+              double cost = route_cost(migrant.vehicle_ids[s], candidate);
+              if (s != r) { cost += removed_cost; }
+              if (cost < old_cost - EPSILON) {
+                if (s != r) {
+                  costs[r]  = removed_cost;
+                  costs[s]  = cost - removed_cost;
+                  routes[r] = std::move(removed);
+                } else {
+                  costs[r] = cost;
+                }
+                routes[s] = std::move(candidate);
+                return true;
+              }
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  const problem_t<i_t, f_t>* problem;
+  const infeasible_cost_t weights{default_weights};
+};
+
+}  // namespace detail
+}  // namespace routing
+}  // namespace cuopt
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -265,6 +265,124 @@ __global__ void update_assignment_kernel(
   }
 }
 
+// Auction assignment of the routes to the vehicles, run on a single block. Each bid is made by one
+// route, its best and second best objects being found by a block reduction over all vehicles.
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void auction_assignment_kernel(
+  typename solution_t<i_t, f_t, REQUEST>::view_t const sol,
+  typename vehicle_assignment_t<i_t, f_t, REQUEST>::view_t vehicle_assignment)
+{
+  __shared__ double reduction_buf[2 * warp_size];
+  __shared__ i_t reduction_index;
+  __shared__ double sh_epsilon;
+  __shared__ double sh_best_value;
+  __shared__ i_t sh_best_object;
+  __shared__ i_t sh_queue_size;
+
+  auto const n_buckets = sol.problem.get_num_buckets();
+  auto const n_routes  = sol.n_routes;
+  auto const n_objects = vehicle_assignment.bucket_offsets[n_buckets];
+  auto const& costs    = vehicle_assignment.route_costs_per_bucket;
+  auto& prices         = vehicle_assignment.auction_prices;
+  auto& owners         = vehicle_assignment.auction_owners;
+  auto& object_bucket  = vehicle_assignment.auction_object_bucket;
+  auto& queue          = vehicle_assignment.auction_queue;
+  auto k_idx           = vehicle_assignment.get_auction_index();
+  auto assignment      = raft::device_span<i_t>(
+    vehicle_assignment.assignments.data() + k_idx * n_routes, n_routes);
+
+  double t_cost_sum = 0.;
+  for (i_t i = threadIdx.x; i < n_routes * n_buckets; i += blockDim.x) {
+    t_cost_sum += fabs(costs[i]);
+  }
+  for (i_t bucket = threadIdx.x; bucket < n_buckets; bucket += blockDim.x) {
+    for (i_t object = vehicle_assignment.bucket_offsets[bucket];
+         object < vehicle_assignment.bucket_offsets[bucket + 1];
+         ++object) {
+      object_bucket[object] = bucket;
+    }
+  }
+  for (i_t object = threadIdx.x; object < n_objects; object += blockDim.x) {
+    prices[object] = 0.;
+    owners[object] = -1;
+  }
+  for (i_t route_id = threadIdx.x; route_id < n_routes; route_id += blockDim.x) {
+    queue[route_id] = route_id;
+  }
+  auto cost_sum = raft::blockReduce(t_cost_sum, (char*)reduction_buf);
+  if (threadIdx.x == 0) {
+    sh_epsilon    = auction_relative_epsilon * cost_sum / (n_routes * n_buckets) + EPSILON;
+    sh_queue_size = n_routes;
+  }
+  __syncthreads();
+
+  auto const no_value = -std::numeric_limits<double>::max();
+  i_t n_bids          = 0;
+  while (sh_queue_size > 0 && n_bids < max_auction_bids_per_route * n_routes) {
+    ++n_bids;
+    auto route_id        = queue[sh_queue_size - 1];
+    double t_best        = no_value;
+    double t_second      = no_value;
+    i_t t_best_object    = -1;
+    auto route_bucket_id = route_id * n_buckets;
+    for (i_t object = threadIdx.x; object < n_objects; object += blockDim.x) {
+      double value = -costs[route_bucket_id + object_bucket[object]] - prices[object];
+      if (value > t_best) {
+        t_second      = t_best;
+        t_best        = value;
+        t_best_object = object;
+      } else if (value > t_second) {
+        t_second = value;
+      }
+    }
+
+    // block_reduce_ranked does a min reduction
+    double neg_value = -t_best;
+    i_t curr_thread  = threadIdx.x;
+    block_reduce_ranked(neg_value, curr_thread, reduction_buf, &reduction_index);
+    bool is_winner = threadIdx.x == reduction_index;
+    if (is_winner) {
+      sh_best_object = t_best_object;
+      sh_best_value  = t_best;
+    }
+    __syncthreads();
+
+    neg_value   = -(is_winner ? t_second : t_best);
+    curr_thread = threadIdx.x;
+    block_reduce_ranked(neg_value, curr_thread, reduction_buf, &reduction_index);
+
+    if (threadIdx.x == 0) {
+      auto object         = sh_best_object;
+      double second_value = -reduction_buf[0];
+      cuopt_assert(object >= 0 && object < n_objects, "A route should find a vehicle");
+      // with a single vehicle left any raise wins it
+      prices[object] +=
+        (second_value == no_value ? 0. : sh_best_value - second_value) + sh_epsilon;
+      --sh_queue_size;
+      auto previous_owner  = owners[object];
+      owners[object]       = route_id;
+      assignment[route_id] = object_bucket[object];
+      if (previous_owner != -1) {
+        assignment[previous_owner] = -1;
+        queue[sh_queue_size++]     = previous_owner;
+      }
+    }
+    __syncthreads();
+  }
+
+  // a route left unassigned discards the auction assignment
+  bool converged      = sh_queue_size == 0;
+  double t_total_cost = 0.;
+  for (i_t route_id = threadIdx.x; converged && route_id < n_routes; route_id += blockDim.x) {
+    t_total_cost += costs[route_id * n_buckets + assignment[route_id]];
+  }
+  auto total_cost = raft::blockReduce(t_total_cost, (char*)reduction_buf);
+  if (threadIdx.x == 0) {
+    vehicle_assignment.assignment_costs[k_idx] =
+      converged ? total_cost : std::numeric_limits<double>::max();
+  }
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void find_best_assignment_kernel(
   typename solution_t<i_t, f_t, REQUEST>::view_t sol,
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,6 +8,8 @@
 #include "regret_kernels.cuh"
 #include "vehicle_assignment.cuh"
 
+#include <thrust/fill.h>
+
 namespace cuopt {
 namespace routing {
 namespace detail {
@@ -103,6 +105,12 @@ void reset(solution_t<i_t, f_t, REQUEST>& sol,
   auto vehicle_availability = sol.problem_ptr->fleet_info_h.vehicle_availability;
   vehicle_assignment.vehicle_buckets.resize(sol.problem_ptr->get_fleet_size(),
                                             sol.sol_handle->get_stream());
+  vehicle_assignment.auction_prices.resize(sol.problem_ptr->get_fleet_size(),
+                                           sol.sol_handle->get_stream());
+  vehicle_assignment.auction_owners.resize(sol.problem_ptr->get_fleet_size(),
+                                           sol.sol_handle->get_stream());
+  vehicle_assignment.auction_object_bucket.resize(sol.problem_ptr->get_fleet_size(),
+                                                  sol.sol_handle->get_stream());
   std::vector<i_t> bucket_offsets(sol.problem_ptr->get_num_buckets() + 1);
   bucket_offsets[0] = 0;
   auto offset       = 0;
@@ -133,6 +141,16 @@ bool compute_assignment(solution_t<i_t, f_t, REQUEST>& sol,
   return true;
 }
 
+template <typename i_t, typename f_t, request_t REQUEST>
+void compute_auction_assignment(solution_t<i_t, f_t, REQUEST>& sol,
+                                vehicle_assignment_t<i_t, f_t, REQUEST>& vehicle_assignment)
+{
+  auto constexpr TPB = 256;
+  auction_assignment_kernel<i_t, f_t, REQUEST>
+    <<<1, TPB, 0, sol.sol_handle->get_stream()>>>(sol.view(), vehicle_assignment.view());
+  RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 auto find_best_assignment(solution_t<i_t, f_t, REQUEST>& sol,
                           vehicle_assignment_t<i_t, f_t, REQUEST>& vehicle_assignment)
@@ -190,7 +208,19 @@ bool run_vehicle_assignment(solution_t<i_t, f_t, REQUEST>& sol,
   reset(sol, vehicle_assignment);
 
   if (!compute_route_costs(sol, move_candidates, vehicle_assignment)) { return false; }
-  if (!compute_assignment(sol, move_candidates, vehicle_assignment)) { return false; }
+  compute_auction_assignment(sol, vehicle_assignment);
+  auto auction_index = vehicle_assignment.get_auction_index();
+  auto auction_cost =
+    vehicle_assignment.assignment_costs.element(auction_index, sol.sol_handle->get_stream());
+  if (auction_cost == std::numeric_limits<double>::max()) {
+    if (!compute_assignment(sol, move_candidates, vehicle_assignment)) { return false; }
+  } else {
+    // the regret assignments are skipped
+    thrust::fill(sol.sol_handle->get_thrust_policy(),
+                 vehicle_assignment.assignment_costs.begin(),
+                 vehicle_assignment.assignment_costs.begin() + auction_index,
+                 std::numeric_limits<double>::max());
+  }
   if (!find_best_assignment(sol, vehicle_assignment)) { return false; }
 
   // On rare cases the assignment can be worsening when OX found a more optimal split.
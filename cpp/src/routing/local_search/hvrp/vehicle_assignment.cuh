@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -17,6 +17,10 @@ namespace detail {
 constexpr int const k_max_regrets      = 2;
 constexpr int const k_min_regrets      = 2;
 constexpr int const min_bucket_entries = 64;
+// The auction bid increment is this fraction of the average route cost
+constexpr double const auction_relative_epsilon = 1e-3;
+// The auction gives up, and the regret heuristic runs instead, past this many bids per route
+constexpr int const max_auction_bids_per_route = 64;
 
 /**
  * @brief
@@ -33,6 +37,14 @@ constexpr int const min_bucket_entries = 64;
  * generalized to k-regret: the sum of differences between assigning k-th best up to second best.
  * Actually we could try to loop this heuristic 4 times: for 2-regret, 3-regret,...,5-regret and
  * choose the best assignment that comes out of them.
+ *
+ * The regret heuristic assigns one route per iteration, so it takes three kernel launches per
+ * route. An auction is run first instead: every vehicle of a type is an object, routes bid for the
+ * object of highest value (minus its route cost on that type and its price) and raise its price by
+ * the value gap to their second choice plus epsilon. The whole auction runs in one block of one
+ * kernel, the bids being computed in parallel over all vehicles. The final assignment is within
+ * n_routes * epsilon of the optimal one. The regret heuristic only runs when the auction does not
+ * converge within the bid budget.
  * @tparam i_t
  * @tparam f_t
  * @tparam REQUEST
@@ -51,6 +63,10 @@ struct vehicle_assignment_t {
       bucket_offsets(0, sol_handle_->get_stream()),
       run_sort(0, sol_handle_->get_stream()),
       assignment_costs(0, sol_handle_->get_stream()),
+      auction_prices(0, sol_handle_->get_stream()),
+      auction_owners(0, sol_handle_->get_stream()),
+      auction_object_bucket(0, sol_handle_->get_stream()),
+      auction_queue(0, sol_handle_->get_stream()),
       best_cost(sol_handle_->get_stream()),
       best_k(sol_handle_->get_stream()),
       gl_lock(sol_handle_->get_stream())
@@ -66,15 +82,18 @@ struct vehicle_assignment_t {
     route_costs_per_bucket.resize(n_routes * n_buckets, stream_view);
     cost_differences.resize(k_iter * n_routes * k_iter, stream_view);
     regret_score_per_route.resize(k_iter * n_routes, stream_view);
-    assignments.resize(k_iter * n_routes, stream_view);
+    // the auction assignment comes after the k_iter regret ones
+    assignments.resize((k_iter + 1) * n_routes, stream_view);
     top_bucket.resize(k_iter * n_routes, stream_view);
     top_cost.resize(k_iter * n_routes, stream_view);
     vehicle_availability.resize(k_iter * n_buckets, stream_view);
     run_sort.resize(k_iter, stream_view);
-    assignment_costs.resize(k_iter, stream_view);
+    assignment_costs.resize(k_iter + 1, stream_view);
+    auction_queue.resize(n_routes, stream_view);
   }
 
   i_t get_k_regrets() const { return k_regrets; }
+  i_t get_auction_index() const { return k_regrets - 1; }
 
   struct view_t {
     constexpr void pop_next_vehicle_id(i_t route_id, i_t bucket, i_t& vehicle_id)
@@ -93,6 +112,7 @@ struct vehicle_assignment_t {
     }
 
     constexpr i_t get_k_regrets() const { return k_regrets; }
+    constexpr i_t get_auction_index() const { return k_regrets - 1; }
 
     raft::device_span<double> route_costs_per_bucket;
     raft::device_span<double> cost_differences;
@@ -105,6 +125,10 @@ struct vehicle_assignment_t {
     raft::device_span<i_t> bucket_offsets;
     raft::device_span<i_t> run_sort;
     raft::device_span<double> assignment_costs;
+    raft::device_span<double> auction_prices;
+    raft::device_span<i_t> auction_owners;
+    raft::device_span<i_t> auction_object_bucket;
+    raft::device_span<i_t> auction_queue;
     double* best_cost;
     i_t* best_k;
     i_t* gl_lock;
@@ -125,6 +149,10 @@ struct vehicle_assignment_t {
     v.bucket_offsets         = cuopt::make_span(bucket_offsets);
     v.run_sort               = cuopt::make_span(run_sort);
     v.assignment_costs       = cuopt::make_span(assignment_costs);
+    v.auction_prices         = cuopt::make_span(auction_prices);
+    v.auction_owners         = cuopt::make_span(auction_owners);
+    v.auction_object_bucket  = cuopt::make_span(auction_object_bucket);
+    v.auction_queue          = cuopt::make_span(auction_queue);
     v.best_cost              = best_cost.data();
     v.best_k                 = best_k.data();
     v.gl_lock                = gl_lock.data();
@@ -143,6 +171,11 @@ struct vehicle_assignment_t {
   rmm::device_uvector<i_t> bucket_offsets;
   rmm::device_uvector<i_t> run_sort;
   rmm::device_uvector<double> assignment_costs;
+  // one entry per vehicle of the fleet, grouped by bucket as in vehicle_buckets
+  rmm::device_uvector<double> auction_prices;
+  rmm::device_uvector<i_t> auction_owners;
+  rmm::device_uvector<i_t> auction_object_bucket;
+  rmm::device_uvector<i_t> auction_queue;
   rmm::device_scalar<double> best_cost;
   rmm::device_scalar<i_t> best_k;
   rmm::device_scalar<i_t> gl_lock;
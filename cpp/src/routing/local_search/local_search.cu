@@ -31,8 +31,8 @@ local_search_t<i_t, f_t, REQUEST>::local_search_t(const solution_handle_t<i_t, f
                                                   i_t max_routes,
                                                   bool depot_included,
                                                   const viables_t<i_t, f_t>& viables_)
-  : cycle_finder_small(sol_handle_, depot_included, 5, 50000),
-    cycle_finder_big(sol_handle_, depot_included, 5, 50000),
+  : cycle_finder_small(sol_handle_, depot_included, max_ejection_chain_length, 50000),
+    cycle_finder_big(sol_handle_, depot_included, max_ejection_chain_length, 50000),
     move_candidates(n_orders, max_routes, sol_handle_, viables_),
     vehicle_assignment(sol_handle_),
     two_opt_cand_data_(0, sol_handle_->get_stream()),
@@ -134,6 +134,26 @@ bool local_search_t<i_t, f_t, REQUEST>::run_cross_search(solution_t<i_t, f_t, RE
   return false;
 }
 
+// Runs a fast operator and rewards it in the bandit with the cost improvement it made per
+// millisecond
+template <typename i_t, typename f_t, request_t REQUEST>
+template <typename run_t>
+bool local_search_t<i_t, f_t, REQUEST>::run_fast_operator(solution_t<i_t, f_t, REQUEST>& sol,
+                                                          fast_operators_t op,
+                                                          run_t&& run)
+{
+  const auto& weights       = move_candidates.weights;
+  const bool with_objective = move_candidates.include_objective;
+  const double cost_before  = sol.get_cost(with_objective, weights);
+  const auto op_start       = std::chrono::steady_clock::now();
+  const bool move_found     = run();
+  const double elapsed_ms =
+    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - op_start).count();
+  const double cost_after = sol.get_cost(with_objective, weights);
+  fast_operator_bandit.add_reward(op, cost_before, cost_after, elapsed_ms);
+  return move_found;
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 template <request_t r_t, std::enable_if_t<r_t == request_t::PDP, bool>>
 bool local_search_t<i_t, f_t, REQUEST>::run_fast_search(solution_t<i_t, f_t, r_t>& sol,
@@ -146,20 +166,24 @@ bool local_search_t<i_t, f_t, REQUEST>::run_fast_search(solution_t<i_t, f_t, r_t
     fast_operators.push_back(fast_operators_t::REGRET);
   }
 
-  std::shuffle(fast_operators.begin(), fast_operators.end(), rng);
+  // the most productive operator per millisecond is tried first
+  fast_operator_bandit.order(fast_operators, rng);
 
   // In PDP mode we do not run the full set
   for (auto const& op : fast_operators) {
     switch (op) {
       case fast_operators_t::SLIDING: {
-        if (run_sliding_search(sol)) { return true; }
+        if (run_fast_operator(sol, op, [&]() { return run_sliding_search(sol); })) { return true; }
         break;
       }
       case fast_operators_t::VRP: {
         break;
       }
       case fast_operators_t::REGRET: {
-        if (run_vehicle_assignment<i_t, f_t, REQUEST>(sol, move_candidates, vehicle_assignment)) {
+        if (run_fast_operator(sol, op, [&]() {
+              return run_vehicle_assignment<i_t, f_t, REQUEST>(
+                sol, move_candidates, vehicle_assignment);
+            })) {
           return true;
         }
         break;
@@ -168,7 +192,7 @@ bool local_search_t<i_t, f_t, REQUEST>::run_fast_search(solution_t<i_t, f_t, r_t
         break;
       }
       case fast_operators_t::CROSS: {
-        if (run_cross_search(sol)) { return true; }
+        if (run_fast_operator(sol, op, [&]() { return run_cross_search(sol); })) { return true; }
         break;
       }
     }
@@ -194,7 +218,8 @@ bool local_search_t<i_t, f_t, REQUEST>::run_fast_search(solution_t<i_t, f_t, r_t
     fast_operators.push_back(fast_operators_t::REGRET);
   }
 
-  std::shuffle(fast_operators.begin(), fast_operators.end(), rng);
+  // the sampled nodes are searched first by the most productive operator per millisecond
+  fast_operator_bandit.order(fast_operators, rng);
 
   auto& nodes_to_search = move_candidates.nodes_to_search;
   // this is activated if we ever want to run with full nodes
@@ -209,21 +234,29 @@ bool local_search_t<i_t, f_t, REQUEST>::run_fast_search(solution_t<i_t, f_t, r_t
   for (auto const& op : fast_operators) {
     switch (op) {
       case fast_operators_t::SLIDING: {
-        move_found = run_sliding_search(sol) || move_found;
+        move_found = run_fast_operator(sol, op, [&]() { return run_sliding_search(sol); }) ||
+                     move_found;
         break;
       }
       case fast_operators_t::VRP: {
-        move_found = perform_vrp_search(sol, move_candidates) || move_found;
+        move_found =
+          run_fast_operator(sol, op, [&]() { return perform_vrp_search(sol, move_candidates); }) ||
+          move_found;
         break;
       }
       case fast_operators_t::REGRET: {
-        move_found =
-          run_vehicle_assignment<i_t, f_t, REQUEST>(sol, move_candidates, vehicle_assignment) ||
-          move_found;
+        move_found = run_fast_operator(sol,
+                                       op,
+                                       [&]() {
+                                         return run_vehicle_assignment<i_t, f_t, REQUEST>(
+                                           sol, move_candidates, vehicle_assignment);
+                                       }) ||
+                     move_found;
         break;
       }
       case fast_operators_t::TWO_OPT: {
-        move_found = run_two_opt_search(sol) || move_found;
+        move_found = run_fast_operator(sol, op, [&]() { return run_two_opt_search(sol); }) ||
+                     move_found;
         break;
       }
       case fast_operators_t::CROSS: {
@@ -268,7 +301,7 @@ void local_search_t<i_t, f_t, REQUEST>::run_best_local_search(solution_t<i_t, f_
     iter++;
     // fast loop, insider this sliding, fast vrp search and fast cross search happens
     while (true) {
-      if (time_limit_enabled && local_search_t<i_t, f_t, REQUEST>::check_time_limit()) { break; }
+      if (time_limit_enabled && check_time_limit()) { break; }
       iter++;
       if (run_fast_search(sol, sol.problem_ptr->is_tsp && iter == 2)) { continue; }
       if (consider_unserviced && sol.problem_ptr->has_prize_collection() &&
@@ -292,15 +325,23 @@ void local_search_t<i_t, f_t, REQUEST>::run_best_local_search(solution_t<i_t, f_
     RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
     sol.sol_handle->sync_stream();
     fill_gpu_graph(sol);
-
-    move_candidates.find_best_negative_cycles(
-      sol.n_routes, cycle_finder_small, cycle_finder_big, sol.sol_handle);
     cuopt_func_call(cost_before =
                       sol.get_cost(move_candidates.include_objective, move_candidates.weights));
 
-    populate_move_path(sol, move_candidates);
-
-    bool improved = move_candidates.move_path.n_insertions.value(sol.sol_handle->get_stream()) != 0;
+    auto find_ejection_chains = [&](i_t max_chain_length) {
+      move_candidates.find_best_negative_cycles(
+        sol.n_routes, cycle_finder_small, cycle_finder_big, sol.sol_handle, max_chain_length);
+      populate_move_path(sol, move_candidates);
+      return move_candidates.move_path.n_insertions.value(sol.sol_handle->get_stream()) != 0;
+    };
+    bool improved = find_ejection_chains(default_ejection_chain_length);
+    // longer chains on the same graph to escape the local optimum of the shorter ones
+    const bool out_of_time = time_limit_enabled && check_time_limit();
+    if (!improved && !out_of_time) {
+      move_candidates.cycles.reset(sol.sol_handle);
+      move_candidates.move_path.reset(sol.sol_handle);
+      improved = find_ejection_chains(max_ejection_chain_length);
+    }
 
     if (improved) {
       // printf("cycle found\n");
@@ -318,8 +359,7 @@ void local_search_t<i_t, f_t, REQUEST>::run_best_local_search(solution_t<i_t, f_
     }
 
     // If there is no improvement at all, break the local search loop
-    bool time_limit_reached =
-      (time_limit_enabled && local_search_t<i_t, f_t, REQUEST>::check_time_limit());
+    bool time_limit_reached = (time_limit_enabled && check_time_limit());
     if (time_limit_reached || !improved) {
       cuopt_func_call(sol.check_cost_coherence(move_candidates.weights));
       break;
@@ -352,8 +392,7 @@ void local_search_t<i_t, f_t, REQUEST>::run_random_local_search(solution_t<i_t,
   sol.sol_handle->sync_stream();
   populate_random_moves(sol);
 
-  bool time_limit_reached =
-    (time_limit_enabled && local_search_t<i_t, f_t, REQUEST>::check_time_limit());
+  bool time_limit_reached = (time_limit_enabled && check_time_limit());
   // if there is no more insertions found
   if (move_candidates.move_path.n_insertions.value(sol.sol_handle->get_stream()) == 0 ||
       time_limit_reached) {
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../cuda_graph.cuh"
+#include "../diversity/operator_bandit.hpp"
 #include "../routing_helpers.cuh"
 #include "../solution/solution.cuh"
 #include "cycle_finder/cycle_graph.hpp"
@@ -23,8 +24,13 @@ namespace routing {
 namespace detail {
 
 constexpr double SLIDING_ASSERT_EPSILON = EPSILON / 2;
+// Ejection chains of the cycle finder are searched with up to default_ejection_chain_length moves,
+// the longer ones only when no shorter chain improves the solution
+constexpr int default_ejection_chain_length = 5;
+constexpr int max_ejection_chain_length     = 7;
 
 enum class fast_operators_t : int { SLIDING, VRP, CROSS, REGRET, TWO_OPT };
+constexpr size_t fast_operators_count = 5;
 
 // Used to store the sliding window candidate
 // Don't need to store window start since it can be found based on the id where you find one
@@ -134,14 +140,15 @@ class local_search_t {
 
   void set_active_weights(const infeasible_cost_t weights, bool include_objective = true);
 
-  static inline void start_timer(f_t time_limit_)
+  // the local searches that run side by side keep their own time limit
+  void start_timer(f_t time_limit_)
   {
     time_limit         = time_limit_;
     start              = std::chrono::steady_clock::now();
     time_limit_reached = false;
   }
 
-  static inline bool get_time_limit_reached()
+  bool get_time_limit_reached()
   {
     bool v;
 #pragma omp atomic read
@@ -149,13 +156,13 @@ class local_search_t {
     return v;
   }
 
-  static inline void set_time_limit_reached()
+  void set_time_limit_reached()
   {
 #pragma omp atomic write
     time_limit_reached = true;
   }
 
-  static inline bool check_time_limit()
+  bool check_time_limit()
   {
     if (get_time_limit_reached()) return true;
     bool this_thread_finished =
@@ -179,6 +186,8 @@ class local_search_t {
   bool run_two_opt_search(solution_t<i_t, f_t, REQUEST>& sol);
   bool run_cross_search(solution_t<i_t, f_t, REQUEST>& sol);
   bool run_inter_search(solution_t<i_t, f_t, REQUEST>& sol);
+  template <typename run_t>
+  bool run_fast_operator(solution_t<i_t, f_t, REQUEST>& sol, fast_operators_t op, run_t&& run);
   template <request_t r_t = REQUEST, std::enable_if_t<r_t == request_t::PDP, bool> = true>
   bool run_fast_search(solution_t<i_t, f_t, r_t>& sol, bool full_set = false);
   template <request_t r_t = REQUEST, std::enable_if_t<r_t == request_t::VRP, bool> = true>
@@ -190,9 +199,9 @@ class local_search_t {
   void fill_pdp_considered_nodes(solution_t<i_t, f_t, REQUEST>& solution,
                                  move_candidates_t<i_t, f_t>& move_candidates);
 
-  static inline f_t time_limit;
-  static inline std::chrono::time_point<std::chrono::steady_clock> start;
-  static inline bool time_limit_reached;
+  f_t time_limit{};
+  std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+  bool time_limit_reached{false};
   ExactCycleFinder<i_t, f_t, 128> cycle_finder_small;
   ExactCycleFinder<i_t, f_t, 1024> cycle_finder_big;
   rmm::device_uvector<found_sliding_solution_t<i_t>> found_sliding_solution_data_;
@@ -203,9 +212,12 @@ class local_search_t {
   rmm::device_uvector<int> locks_;
   // random number generator
   std::mt19937 rng;
+  // orders the fast operators by their improvement per millisecond
+  operator_bandit_t<fast_operators_count> fast_operator_bandit;
 
   // graphs
   cuda_graph_t sliding_cuda_graph;
+  cuda_graph_t two_opt_cuda_graph;
 };
 
 }  // namespace detail
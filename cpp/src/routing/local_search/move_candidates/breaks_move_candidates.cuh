@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -25,6 +25,19 @@ struct __align__(16) break_cand_t {
   double cost{std::numeric_limits<double>::max()};
 };
 
+// Identifies the state of a route when its breaks were last searched without finding an improving
+// move. The weighted cost changes with any change of the route or of the weights.
+struct break_search_key_t {
+  double cost{-std::numeric_limits<double>::max()};
+  int n_nodes{-1};
+  int vehicle_id{-1};
+
+  HDI bool operator==(const break_search_key_t& other) const
+  {
+    return cost == other.cost && n_nodes == other.n_nodes && vehicle_id == other.vehicle_id;
+  }
+};
+
 struct is_break_candidate_improving {
   __device__ bool operator()(const break_cand_t& x) { return x.cost < -EPSILON; }
 };
@@ -34,10 +47,12 @@ class breaks_move_candidates_t {
  public:
   breaks_move_candidates_t(i_t fleet_size, solution_handle_t<i_t, f_t> const* sol_handle)
     : best_cand_per_route(fleet_size, sol_handle->get_stream()),
-      locks_per_route(fleet_size, sol_handle->get_stream())
+      locks_per_route(fleet_size, sol_handle->get_stream()),
+      searched_keys(fleet_size, sol_handle->get_stream())
   {
     async_fill(best_cand_per_route, break_cand_t{}, sol_handle->get_stream());
     async_fill(locks_per_route, 0, sol_handle->get_stream());
+    async_fill(searched_keys, break_search_key_t{}, sol_handle->get_stream());
   }
 
   void reset(solution_handle_t<i_t, f_t> const* sol_handle)
@@ -45,6 +60,7 @@ class breaks_move_candidates_t {
     async_fill(best_cand_per_route, break_cand_t{}, sol_handle->get_stream());
 
     // no need to reset locks because they will be released by threads eventually
+    // searched keys are kept, routes that did not change since are not searched again
   }
 
   bool has_improving_routes(solution_handle_t<i_t, f_t> const* sol_handle) const
@@ -58,6 +74,7 @@ class breaks_move_candidates_t {
   struct view_t {
     raft::device_span<break_cand_t> best_cand_per_route;
     raft::device_span<i_t> locks_per_route;
+    raft::device_span<break_search_key_t> searched_keys;
   };
 
   view_t view()
@@ -66,11 +83,13 @@ class breaks_move_candidates_t {
     v.best_cand_per_route =
       raft::device_span<break_cand_t>{best_cand_per_route.data(), best_cand_per_route.size()};
     v.locks_per_route = raft::device_span<i_t>(locks_per_route.data(), locks_per_route.size());
+    v.searched_keys   = cuopt::make_span(searched_keys);
     return v;
   }
 
   rmm::device_uvector<break_cand_t> best_cand_per_route;
   rmm::device_uvector<i_t> locks_per_route;
+  rmm::device_uvector<break_search_key_t> searched_keys;
 };
 }  // namespace detail
 }  // namespace routing
@@ -335,12 +335,13 @@ class move_candidates_t {
   void find_best_negative_cycles(i_t pseudo_node_number,
                                  ExactCycleFinder<i_t, f_t, 128>& cycle_finder_small,
                                  ExactCycleFinder<i_t, f_t, 1024>& cycle_finder_big,
-                                 solution_handle_t<i_t, f_t> const* sol_handle)
+                                 solution_handle_t<i_t, f_t> const* sol_handle,
+                                 i_t max_cycle_length = -1)
   {
     if (pseudo_node_number > 127) {
-      cycle_finder_big.find_best_cycles(graph, cycles, sol_handle);
+      cycle_finder_big.find_best_cycles(graph, cycles, sol_handle, max_cycle_length);
     } else {
-      cycle_finder_small.find_best_cycles(graph, cycles, sol_handle);
+      cycle_finder_small.find_best_cycles(graph, cycles, sol_handle, max_cycle_length);
     }
     sol_handle->sync_stream();
   }
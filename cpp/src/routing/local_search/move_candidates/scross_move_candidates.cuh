@@ -1,12 +1,13 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #pragma once
 
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 #include "../../solution/solution_handle.cuh"
 #include "cand.cuh"
@@ -23,7 +24,10 @@ class scross_move_candidates_t {
  public:
   scross_move_candidates_t(solution_handle_t<i_t, f_t> const* sol_handle_)
     : scross_best_cand_list(0, sol_handle_->get_stream()),
-      route_pair_locks(0, sol_handle_->get_stream())
+      route_pair_locks(0, sol_handle_->get_stream()),
+      route_best_keys(0, sol_handle_->get_stream()),
+      changed_routes(0, sol_handle_->get_stream()),
+      n_selected_moves(sol_handle_->get_stream())
   {
   }
 
@@ -33,6 +37,7 @@ class scross_move_candidates_t {
                cross_cand_t{0, 0, std::numeric_limits<double>::max(), 0, 0},
                sol_handle->get_stream());
     async_fill(route_pair_locks, 0, sol_handle->get_stream());
+    async_fill(changed_routes, 0, sol_handle->get_stream());
   }
 
   struct view_t {
@@ -45,6 +50,9 @@ class scross_move_candidates_t {
 
     raft::device_span<cross_cand_t> scross_best_cand_list;
     raft::device_span<i_t> route_pair_locks;
+    raft::device_span<uint64_t> route_best_keys;
+    raft::device_span<i_t> changed_routes;
+    i_t* n_selected_moves;
   };
 
   view_t view()
@@ -53,11 +61,19 @@ class scross_move_candidates_t {
     v.scross_best_cand_list =
       raft::device_span<cross_cand_t>{scross_best_cand_list.data(), scross_best_cand_list.size()};
     v.route_pair_locks = raft::device_span<i_t>{route_pair_locks.data(), route_pair_locks.size()};
+    v.route_best_keys =
+      raft::device_span<uint64_t>{route_best_keys.data(), route_best_keys.size()};
+    v.changed_routes   = raft::device_span<i_t>{changed_routes.data(), changed_routes.size()};
+    v.n_selected_moves = n_selected_moves.data();
     return v;
   }
 
   rmm::device_uvector<cross_cand_t> scross_best_cand_list;
   rmm::device_uvector<i_t> route_pair_locks;
+  // best move claiming each route in a selection round and the routes changed by the selected moves
+  rmm::device_uvector<uint64_t> route_best_keys;
+  rmm::device_uvector<i_t> changed_routes;
+  rmm::device_scalar<i_t> n_selected_moves;
 };
 
 }  // namespace detail
@@ -1,11 +1,12 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #include <utilities/cuda_helpers.cuh>
+#include <utilities/instrumentation.hpp>
 #include "compute_ejections.cuh"
 #include "local_search.cuh"
 #include "permutation_helper.cuh"
@@ -313,84 +314,130 @@ __global__ void populate_cross_list_kernel(
   }
 }
 
+// a few rounds select most of the independent moves, the later ones only add a handful
+constexpr int max_cross_selection_rounds = 16;
+
+// Nodes and routes of an improving cross or relocate candidate, false if the candidate cannot be
+// selected anymore
 template <typename i_t, typename f_t, request_t REQUEST>
-__global__ void populate_cross_moves_kernel(
+DI bool get_cross_move_routes(const typename solution_t<i_t, f_t, REQUEST>::view_t& sol,
+                              const cross_cand_t& cand,
+                              raft::device_span<const i_t> changed_routes,
+                              i_t& first_node,
+                              i_t& second_node,
+                              i_t& first_route,
+                              i_t& second_route)
+{
+  if (cand.cost_counter.cost > -EPSILON) { return false; }
+  first_node      = cand.id_1;
+  second_node     = cand.id_2;
+  bool is_ejected = second_node < sol.get_num_orders();
+  if constexpr (REQUEST == request_t::PDP) {
+    // we only have cross on ejected node
+    if (is_ejected) {
+      if (!sol.problem.order_info.is_pickup_index[first_node]) {
+        first_node = sol.problem.order_info.pair_indices[first_node];
+      }
+      if (!sol.problem.order_info.is_pickup_index[second_node]) {
+        second_node = sol.problem.order_info.pair_indices[second_node];
+      }
+    }
+  }
+  first_route  = sol.route_node_map.get_route_id(first_node);
+  second_route = is_ejected ? sol.route_node_map.get_route_id(second_node)
+                            : second_node - sol.get_num_orders();
+  cuopt_assert(first_route != -1 && second_route != -1, "Unrouted node in candidates!");
+  return !changed_routes[first_route] && !changed_routes[second_route];
+}
+
+// Positive floats compare as their bits, so that the best move of a route is the maximum key. The
+// route pair index in the low bits makes the keys unique
+DI uint64_t cross_move_key(double cost, uint32_t route_pair_idx)
+{
+  return ((uint64_t)__float_as_uint((float)-cost) << 32) | route_pair_idx;
+}
+
+// every candidate whose routes are not changed yet claims both of its routes
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void claim_cross_moves_kernel(
   typename solution_t<i_t, f_t, REQUEST>::view_t sol,
   typename move_candidates_t<i_t, f_t>::view_t move_candidates)
 {
-  auto scross_cands         = move_candidates.scross_move_candidates;
-  const i_t matrix_size     = sol.n_routes * sol.n_routes;
-  const i_t special_node_id = sol.n_routes + sol.get_num_orders();
-  extern __shared__ i_t changed_routes[];
-  i_t* route_pair_indices = &changed_routes[sol.n_routes];
-  init_block_shmem(changed_routes, 0, sol.n_routes);
-  block_sequence(route_pair_indices, sol.n_routes * sol.n_routes);
-  __syncthreads();
-  if (threadIdx.x == 0) {
-    raft::random::PCGenerator thread_rng(
-      clock64(), uint64_t((threadIdx.x + blockIdx.x * blockDim.x)), 0);
-    random_shuffle(route_pair_indices, sol.n_routes * sol.n_routes, thread_rng);
-    i_t n_changed_routes = 0;
-    for (i_t i = 0; i < matrix_size; ++i) {
-      i_t curr_idx    = route_pair_indices[i];
-      const auto cand = scross_cands.scross_best_cand_list[curr_idx];
-      if (n_changed_routes >= sol.n_routes - 1) break;
-      if (cand.cost_counter.cost > -EPSILON) continue;
-      i_t first_node                  = cand.id_1;
-      i_t second_node                 = cand.id_2;
-      bool is_ejected                 = second_node < sol.get_num_orders();
-      [[maybe_unused]] i_t matrix_idx = is_ejected ? second_node : special_node_id;
-      cuopt_assert(
-        cand.cost_counter.cost == (move_candidates.cand_matrix.get_cost(first_node, second_node) +
-                                   move_candidates.cand_matrix.get_cost(matrix_idx, first_node)),
-        "Cost mismatch!");
-      if constexpr (REQUEST == request_t::PDP) {
-        // we only have cross on ejected node
-        if (is_ejected) {
-          if (!sol.problem.order_info.is_pickup_index[first_node]) {
-            first_node = sol.problem.order_info.pair_indices[first_node];
-          }
-          if (!sol.problem.order_info.is_pickup_index[second_node]) {
-            second_node = sol.problem.order_info.pair_indices[second_node];
-          }
-        }
-      }
+  auto scross_cands = move_candidates.scross_move_candidates;
+  for (i_t idx = threadIdx.x + blockIdx.x * blockDim.x; idx < sol.n_routes * sol.n_routes;
+       idx += blockDim.x * gridDim.x) {
+    const auto cand = scross_cands.scross_best_cand_list[idx];
+    i_t first_node, second_node, first_route, second_route;
+    if (!get_cross_move_routes<i_t, f_t, REQUEST>(sol,
+                                                  cand,
+                                                  scross_cands.changed_routes,
+                                                  first_node,
+                                                  second_node,
+                                                  first_route,
+                                                  second_route)) {
+      continue;
+    }
+    const uint64_t key = cross_move_key(cand.cost_counter.cost, idx);
+    atomicMax((unsigned long long*)&scross_cands.route_best_keys[first_route], key);
+    atomicMax((unsigned long long*)&scross_cands.route_best_keys[second_route], key);
+  }
+}
 
-      i_t first_route  = sol.route_node_map.get_route_id(first_node);
-      i_t second_route = is_ejected ? sol.route_node_map.get_route_id(second_node)
-                                    : second_node - sol.get_num_orders();
-      cuopt_assert(first_route != -1 && second_route != -1, "Unrouted node in candidates!");
-      if (changed_routes[first_route] || changed_routes[second_route]) continue;
-      i_t insertion_1, insertion_2, insertion_3, insertion_4;
-      double cost_delta;
-      move_candidates_t<i_t, f_t>::get_candidate(
-        cand, insertion_1, insertion_2, insertion_3, insertion_4, cost_delta);
-      cuopt_func_call(*move_candidates.debug_delta -= cost_delta);
-      i_t n_insertions = *move_candidates.move_path.n_insertions;
-      auto move_1      = move_path_t<i_t, f_t>::make_cycle_edge(first_node,   // inserting node
-                                                           second_node,  // ejecting node
-                                                           insertion_1,
-                                                           insertion_2);
-      move_candidates.move_path.path[n_insertions] = move_1;
-      *move_candidates.move_path.n_insertions      = n_insertions + 1;
-      // for cross
-      if (is_ejected) {
-        auto move_2 = move_path_t<i_t, f_t>::make_cycle_edge(second_node,  // inserting node
-                                                             first_node,   // ejecting node
-                                                             insertion_3,
-                                                             insertion_4);
-        move_candidates.move_path.path[n_insertions + 1] = move_2;
-        *move_candidates.move_path.n_insertions          = n_insertions + 2;
-      }
-      // for relcoate
-      else {
-        // mark loop as not closed, so that the ejected route will be saved to global
-        move_candidates.move_path.loop_closed[first_route] = 0;
-      }
-      changed_routes[first_route]  = 1;
-      changed_routes[second_route] = 1;
-      n_changed_routes += 2;
+// The candidates that are the best claim of both of their routes are independent and added to the
+// move path. Repeating the rounds on the remaining routes gives the greedy selection by cost
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void select_cross_moves_kernel(
+  typename solution_t<i_t, f_t, REQUEST>::view_t sol,
+  typename move_candidates_t<i_t, f_t>::view_t move_candidates)
+{
+  auto scross_cands = move_candidates.scross_move_candidates;
+  for (i_t idx = threadIdx.x + blockIdx.x * blockDim.x; idx < sol.n_routes * sol.n_routes;
+       idx += blockDim.x * gridDim.x) {
+    const auto cand = scross_cands.scross_best_cand_list[idx];
+    i_t first_node, second_node, first_route, second_route;
+    if (!get_cross_move_routes<i_t, f_t, REQUEST>(sol,
+                                                  cand,
+                                                  scross_cands.changed_routes,
+                                                  first_node,
+                                                  second_node,
+                                                  first_route,
+                                                  second_route)) {
+      continue;
+    }
+    const uint64_t key = cross_move_key(cand.cost_counter.cost, idx);
+    if (scross_cands.route_best_keys[first_route] != key ||
+        scross_cands.route_best_keys[second_route] != key) {
+      continue;
+    }
+    const bool is_ejected = second_node < sol.get_num_orders();
+    i_t insertion_1, insertion_2, insertion_3, insertion_4;
+    double cost_delta;
+    move_candidates_t<i_t, f_t>::get_candidate(
+      cand, insertion_1, insertion_2, insertion_3, insertion_4, cost_delta);
+    cuopt_func_call(atomicAdd(move_candidates.debug_delta, -cost_delta));
+    i_t n_insertions = atomicAdd(move_candidates.move_path.n_insertions, is_ejected ? 2 : 1);
+    auto move_1      = move_path_t<i_t, f_t>::make_cycle_edge(first_node,   // inserting node
+                                                         second_node,  // ejecting node
+                                                         insertion_1,
+                                                         insertion_2);
+    move_candidates.move_path.path[n_insertions] = move_1;
+    // for cross
+    if (is_ejected) {
+      auto move_2 = move_path_t<i_t, f_t>::make_cycle_edge(second_node,  // inserting node
+                                                           first_node,   // ejecting node
+                                                           insertion_3,
+                                                           insertion_4);
+      move_candidates.move_path.path[n_insertions + 1] = move_2;
     }
+    // for relcoate
+    else {
+      // mark loop as not closed, so that the ejected route will be saved to global
+      move_candidates.move_path.loop_closed[first_route] = 0;
+    }
+    // the routes are only read by the next round
+    scross_cands.changed_routes[first_route]  = 1;
+    scross_cands.changed_routes[second_route] = 1;
+    atomicAdd(scross_cands.n_selected_moves, 1);
   }
 }
 
@@ -404,6 +451,8 @@ void local_search_t<i_t, f_t, REQUEST>::reset_cross_vectors(solution_t<i_t, f_t,
     scross_cands.scross_best_cand_list.resize(solution.n_routes * solution.n_routes,
                                               solution.sol_handle->get_stream());
   }
+  scross_cands.route_best_keys.resize(solution.n_routes, solution.sol_handle->get_stream());
+  scross_cands.changed_routes.resize(solution.n_routes, solution.sol_handle->get_stream());
   scross_cands.reset(solution.sol_handle);
 }
 
@@ -422,14 +471,23 @@ bool local_search_t<i_t, f_t, REQUEST>::populate_cross_moves(
     <<<solution.get_num_orders() - 1, TPB, sh_size, solution.sol_handle->get_stream()>>>(
       solution.view(), move_candidates.view());
 
-  sh_size = sizeof(i_t) * (solution.n_routes + 1) * solution.n_routes;
-
-  if (!set_shmem_of_kernel(populate_cross_moves_kernel<i_t, f_t, REQUEST>, sh_size)) {
-    return false;
+  // the independent moves are selected in parallel by cost, so that large fleets commit a move on
+  // most of their routes at once
+  auto stream               = solution.sol_handle->get_stream();
+  auto& scross_cands        = move_candidates.scross_move_candidates;
+  const i_t n_select_blocks = std::min<i_t>(
+    (solution.n_routes * solution.n_routes + TPB - 1) / TPB,
+    solution.sol_handle->get_device_properties().multiProcessorCount * 8);
+  for (int round = 0; round < max_cross_selection_rounds; ++round) {
+    async_fill(scross_cands.route_best_keys, uint64_t(0), stream);
+    scross_cands.n_selected_moves.set_value_to_zero_async(stream);
+    claim_cross_moves_kernel<i_t, f_t, REQUEST>
+      <<<n_select_blocks, TPB, 0, stream>>>(solution.view(), move_candidates.view());
+    select_cross_moves_kernel<i_t, f_t, REQUEST>
+      <<<n_select_blocks, TPB, 0, stream>>>(solution.view(), move_candidates.view());
+    RAFT_CHECK_CUDA(stream);
+    if (scross_cands.n_selected_moves.value(stream) == 0) { break; }
   }
-  populate_cross_moves_kernel<i_t, f_t, REQUEST>
-    <<<1, TPB, sh_size, solution.sol_handle->get_stream()>>>(solution.view(),
-                                                             move_candidates.view());
   solution.sol_handle->sync_stream();
   return true;
 }
@@ -453,11 +511,13 @@ template <typename i_t, typename f_t, request_t REQUEST>
 void local_search_t<i_t, f_t, REQUEST>::perform_moves(solution_t<i_t, f_t, REQUEST>& solution,
                                                       move_candidates_t<i_t, f_t>& move_candidates)
 {
-  raft::common::nvtx::range fun_scope("perform_moves");
+  CUOPT_NVTX_RANGE(routing, "perform_moves");
   solution.global_runtime_checks(false, false, "perform_moves_start");
   auto stream        = solution.sol_handle->get_stream();
   constexpr i_t TPB  = 32;
   const i_t n_blocks = move_candidates.move_path.n_insertions.value(stream);
+  CUOPT_COUNTER_ADD("routing.local_search_moves", 1);
+  CUOPT_COUNTER_ADD("routing.inserted_requests", n_blocks);
   size_t shared_size = solution.check_routes_can_insert_and_get_sh_size(
     n_insertions_per_move * request_info_t<i_t, REQUEST>::size());
   bool is_set = set_shmem_of_kernel(insert_graph_nodes_kernel<i_t, f_t, REQUEST>, shared_size);
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -121,7 +121,7 @@ __global__ void pick_random_move_per_route_pair_kernel(
     cuopt_assert(offset_begin == 0 && offset_end == 0, "Offsets should zero if not written!");
     return;
   }
-  raft::random::PCGenerator thread_rng(seed + (threadIdx.x + blockIdx.x * blockDim.x), 0, 0);
+  auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x));
   i_t selected_local_idx = thread_rng.next_u32() % n_moves_per_this_route_pair;
   i_t idx_to_write       = atomicAdd(move_candidates.random_move_candidates.n_selected_moves, 1);
   i_t selected_cand_idx =
@@ -148,7 +148,7 @@ __global__ void select_random_route_pairs_kernel(
   if (threadIdx.x == 0) {
     i_t remaining_moves = *move_candidates.random_move_candidates.n_selected_moves;
 
-    raft::random::PCGenerator thread_rng(seed + (threadIdx.x + blockIdx.x * blockDim.x), 0, 0);
+    auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x));
     // we want this loop fast, don't do actual candidate insertion here
     while (found_moves < sol.n_routes / 2 && remaining_moves > 0) {
       i_t curr_idx    = thread_rng.next_u32() % remaining_moves;
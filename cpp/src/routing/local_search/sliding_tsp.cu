@@ -19,6 +19,9 @@ namespace detail {
 
 auto constexpr const max_window_size = 20;
 constexpr int max_n_neighbors        = 128;
+// 2-opt moves are only searched between a node and its nearest neighbors, so that the search of a
+// node does not depend on the tour length
+constexpr int max_two_opt_neighbors = 32;
 
 template <typename i_t, typename f_t, request_t REQUEST>
 DI thrust::pair<double, double> eval_move(
@@ -211,6 +214,85 @@ __global__ void find_sliding_moves_tsp(
   if (threadIdx.x == reduction_index) { sampled_nodes_data[node_info.node()] = sliding_tsp_cand; }
 }
 
+/*! \brief { 2-opt moves of long tours restricted to the nearest neighbors of the sampled nodes. A
+ * 2-opt move is the in place reversal of the segment between the two new arcs, so that the moves
+ * are kept as reversed sliding windows of any size and executed on the linked tour with the sliding
+ * moves. The reversed segments are evaluated from the cumulative distances of the tour, without
+ * copying it to the shared memory } */
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void find_two_opt_moves_tsp(
+  typename solution_t<i_t, f_t, REQUEST>::view_t sol,
+  typename move_candidates_t<i_t, f_t>::view_t move_candidates,
+  raft::device_span<sliding_tsp_cand_t<i_t>> sampled_nodes_data)
+{
+  const auto node_info = move_candidates.nodes_to_search.sampled_nodes_to_search[blockIdx.x];
+  // special node that represent after depot insertion is ignored
+  if (node_info.node() >= sol.get_num_orders()) { return; }
+
+  const auto [route_id, intra_idx] =
+    sol.route_node_map.get_route_id_and_intra_idx(node_info.node());
+  if (route_id == -1) { return; }
+
+  const auto route     = sol.routes[route_id];
+  const auto n_nodes   = route.get_num_nodes();
+  const auto& forward  = route.dimensions.distance_dim.distance_forward;
+  const auto& reversed = route.dimensions.distance_dim.reverse_distance;
+
+  constexpr bool exclude_self_in_neighbors = false;
+  const int max_neighbors                  = min(max_two_opt_neighbors, sol.get_num_orders());
+  // the new arc leaves the node towards a neighbor after it, or enters it from a neighbor before it
+  auto neighbors_after  = move_candidates.viables.get_viable_from_pickups(
+    node_info.node(), sol.get_num_requests(), max_neighbors, exclude_self_in_neighbors);
+  auto neighbors_before = move_candidates.viables.get_viable_to_pickups(
+    node_info.node(), sol.get_num_requests(), max_neighbors, exclude_self_in_neighbors);
+
+  sliding_tsp_cand_t<i_t> two_opt_cand = is_sliding_tsp_uinitialized_t<i_t>::init_data();
+  const i_t n_after                    = neighbors_after.size();
+  const i_t n_candidates               = n_after + neighbors_before.size();
+  for (i_t tid = threadIdx.x; tid < n_candidates; tid += blockDim.x) {
+    const bool after       = tid < n_after;
+    const auto neighbor    = after ? neighbors_after[tid] : neighbors_before[tid - n_after];
+    const i_t neighbor_idx = sol.route_node_map.intra_route_idx_per_node[neighbor];
+    if (after ? neighbor_idx <= intra_idx + 1 : neighbor_idx >= intra_idx - 1) { continue; }
+
+    // the segment [start, end] is reversed between prev and next
+    const i_t prev  = after ? intra_idx : neighbor_idx;
+    const i_t start = prev + 1;
+    const i_t end   = after ? neighbor_idx : intra_idx;
+    cuopt_assert(end + 1 <= n_nodes, "Wrong 2-opt segment");
+
+    const double reversed_dist = reversed[n_nodes - start] - reversed[n_nodes - end];
+    const double prev_end      = get_arc_of_dimension<i_t, f_t, dim_t::DIST>(
+      route.node_info(prev), route.node_info(end), route.vehicle_info());
+    const double start_next    = get_arc_of_dimension<i_t, f_t, dim_t::DIST>(
+      route.node_info(start), route.node_info(end + 1), route.vehicle_info());
+
+    const double delta = prev_end + reversed_dist + start_next - (forward[end + 1] - forward[prev]);
+
+    if (delta > -EPSILON) { continue; }
+    if (delta < two_opt_cand.selection_delta) {
+      two_opt_cand.insertion_pos   = prev;
+      two_opt_cand.window_size     = end - prev;
+      two_opt_cand.window_start    = start;
+      two_opt_cand.reverse         = 1;
+      two_opt_cand.selection_delta = delta;
+    }
+  }
+
+  __shared__ int reduction_index;
+  __shared__ double shbuf[warp_size * 2];
+
+  int idx           = threadIdx.x;
+  double saved_cost = two_opt_cand.selection_delta;
+  block_reduce_ranked(saved_cost, idx, shbuf, &reduction_index);
+
+  // keep the sliding move of the node when it is better
+  if (threadIdx.x == reduction_index &&
+      two_opt_cand.selection_delta < sampled_nodes_data[node_info.node()].selection_delta) {
+    sampled_nodes_data[node_info.node()] = two_opt_cand;
+  }
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 DI void mark_impacted_nodes(const typename route_t<i_t, f_t, REQUEST>::view_t& route,
                             typename move_candidates_t<i_t, f_t>::view_t& move_candidates,
@@ -231,10 +313,14 @@ DI void mark_impacted_nodes(const typename route_t<i_t, f_t, REQUEST>::view_t& r
   // add two more nodes
   i_t end =
     min(best_candidate.window_start + best_candidate.window_size + 1, route.get_num_nodes());
+  // the inner arcs of a long reversed segment are kept, only its ends are searched again
+  const bool long_window = best_candidate.window_size > max_window_size;
   for (i_t i = threadIdx.x + start; i < end; i += blockDim.x) {
     cuopt_assert(moved_regions[route_id * max_active + i] != -1, "Node was already moved");
-    move_candidates.nodes_to_search.active_nodes_impacted[route.node_id(i)] = 1;
-    moved_regions[route_id * max_active + i]                                = -1;
+    if (!long_window || i < start + 2 || i >= end - 2) {
+      move_candidates.nodes_to_search.active_nodes_impacted[route.node_id(i)] = 1;
+    }
+    moved_regions[route_id * max_active + i] = -1;
   }
 
   start = max(best_candidate.insertion_pos, 1);
@@ -520,6 +606,14 @@ bool local_search_t<i_t, f_t, REQUEST>::perform_sliding_tsp(
       cuopt::make_span(locks_));
   RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
 
+  // shorter tours are covered by the reversed sliding windows
+  if (n_nodes > max_window_size) {
+    find_two_opt_moves_tsp<i_t, f_t, REQUEST>
+      <<<n_blocks, n_threads, 0, sol.sol_handle->get_stream()>>>(
+        sol.view(), move_candidates.view(), cuopt::make_span(sampled_tsp_data_));
+    RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
+  }
+
   n_moves_found = thrust::count_if(rmm::exec_policy(sol.sol_handle->get_stream()),
                                    sampled_tsp_data_.begin(),
                                    sampled_tsp_data_.end(),
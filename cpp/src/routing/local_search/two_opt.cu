@@ -7,6 +7,7 @@
 
 #include <utilities/cuda_helpers.cuh>
 #include "../solution/solution.cuh"
+#include "../route/segment_data.cuh"
 #include "../util_kernels/top_k.cuh"
 #include "../utilities/cuopt_utils.cuh"
 #include "local_search.cuh"
@@ -19,6 +20,10 @@ namespace detail {
 auto constexpr items_per_thread = 2;
 auto constexpr top_k_candidates = 64;
 auto constexpr write_diagonal   = false;
+// the reversed route is split in at most max_two_opt_tiles tiles of at least min_two_opt_tile_size
+// nodes, so that a reversal walks O(tile size + number of tiles) nodes
+auto constexpr max_two_opt_tiles     = 32;
+auto constexpr min_two_opt_tile_size = 8;
 
 template <typename i_t, typename f_t, request_t REQUEST>
 DI thrust::pair<double, double> evaluate_two_opt_move(
@@ -41,6 +46,78 @@ DI thrust::pair<double, double> evaluate_two_opt_move(
   return {delta, selection_delta};
 }
 
+// Same evaluation as evaluate_two_opt_move, with the concatenation data of the full tiles of the
+// reversed route. Only the nodes of the partial tiles at both ends of the reversed segment are
+// walked, with the node evaluations specialized on the dimensions supported by the tiles
+template <typename i_t, typename f_t, request_t REQUEST>
+DI thrust::pair<double, double> evaluate_two_opt_tiled_move(
+  typename move_candidates_t<i_t, f_t>::view_t& move_candidates,
+  const typename route_t<i_t, f_t, REQUEST>::view_t& route,
+  i_t first,
+  i_t second,
+  typename dimensions_route_t<i_t, f_t, REQUEST>::view_t const& fragment,
+  const segment_data_t<i_t, f_t>* tiles,
+  i_t tile_size,
+  double excess_limit)
+{
+  constexpr auto dims      = segment_data_t<i_t, f_t>::dimensions_mask;
+  const auto& vehicle_info = route.vehicle_info();
+  // the reversed segment in the reversed route
+  const i_t begin        = route.get_num_nodes() - second;
+  const i_t end          = route.get_num_nodes() - first;
+  const i_t first_tile   = (begin + tile_size - 1) / tile_size;
+  const i_t end_of_tiles = (end / tile_size) * tile_size;
+  auto temp_node         = route.get_node(first);
+  i_t i                  = begin;
+  auto walk              = [&](i_t until) {
+    for (; i < until; ++i) {
+      auto next_node = fragment.get_node(i);
+      temp_node.template calculate_forward_all<dims>(next_node, vehicle_info);
+      temp_node = next_node;
+    }
+  };
+  if (first_tile * tile_size < end_of_tiles) {
+    walk(first_tile * tile_size);
+    for (; i < end_of_tiles; i += tile_size) {
+      auto last_node       = fragment.get_node(i + tile_size - 1);
+      const auto prev_info = temp_node.node_info();
+      const auto tile_info = fragment.node_info(i);
+      double time_between =
+        get_arc_of_dimension<i_t, f_t, dim_t::TIME>(prev_info, tile_info, vehicle_info);
+      double distance_between =
+        get_arc_of_dimension<i_t, f_t, dim_t::DIST>(prev_info, tile_info, vehicle_info);
+      tiles[i / tile_size].apply_forward(temp_node, last_node, time_between, distance_between);
+      temp_node = last_node;
+    }
+  }
+  walk(end);
+  // the excess only grows along the segment, so checking it at its end is enough
+  if (!temp_node.template forward_feasible<dims>(
+        vehicle_info, move_candidates.weights, excess_limit)) {
+    return {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  }
+
+  auto end_node = route.get_node(second + 1);
+  double delta =
+    temp_node.template calculate_forward_all_and_delta<dims>(end_node,
+                                                             vehicle_info,
+                                                             move_candidates.include_objective,
+                                                             move_candidates.weights,
+                                                             route.get_objective_cost(),
+                                                             route.get_infeasibility_cost());
+  if (!end_node.template feasible<dims>(vehicle_info, move_candidates.weights, excess_limit)) {
+    return {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  }
+  double selection_delta =
+    temp_node.template calculate_forward_all_and_delta<dims>(end_node,
+                                                             vehicle_info,
+                                                             move_candidates.include_objective,
+                                                             move_candidates.selection_weights,
+                                                             route.get_objective_cost(),
+                                                             route.get_infeasibility_cost());
+  return {delta, selection_delta};
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 DI thrust::pair<double, double> evaluate_two_opt_cvrp_move(
   typename solution_t<i_t, f_t, REQUEST>::view_t& sol,
@@ -119,6 +196,32 @@ __global__ void find_two_opt_moves(typename solution_t<i_t, f_t, REQUEST>::view_
     __syncthreads();
   }
 
+  // concatenation data of the full tiles of the reversed route, one tile per thread
+  __shared__ segment_data_t<i_t, f_t> sh_tiles[max_two_opt_tiles];
+  const bool use_tiles = !sol.problem.is_cvrp_intra() &&
+                         segment_data_t<i_t, f_t>::is_supported(sol.problem.dimensions_info);
+  const i_t tile_size =
+    max(min_two_opt_tile_size, (route.get_num_nodes() + max_two_opt_tiles) / max_two_opt_tiles);
+  if (use_tiles) {
+    const auto& reversed = sh_reverse_route.dimensions;
+    const i_t n_tiles    = (route.get_num_nodes() + 1) / tile_size;
+    for (i_t t = threadIdx.x; t < n_tiles; t += blockDim.x) {
+      auto node = reversed.get_node(t * tile_size);
+      auto tile = segment_data_t<i_t, f_t>::from_node(node);
+      for (i_t j = t * tile_size + 1; j < (t + 1) * tile_size; ++j) {
+        auto next_node = reversed.get_node(j);
+        tile.append(segment_data_t<i_t, f_t>::from_node(next_node),
+                    get_arc_of_dimension<i_t, f_t, dim_t::TIME>(
+                      node.node_info(), next_node.node_info(), route.vehicle_info()),
+                    get_arc_of_dimension<i_t, f_t, dim_t::DIST>(
+                      node.node_info(), next_node.node_info(), route.vehicle_info()));
+        node = next_node;
+      }
+      sh_tiles[t] = tile;
+    }
+    __syncthreads();
+  }
+
   two_opt_cand_t<i_t> two_opt_cand = is_two_opt_uinitialized_t<i_t>::init_data();
   double cost_delta, selection_delta;
   auto nodes = route.get_num_nodes() - intra_idx;
@@ -132,6 +235,16 @@ __global__ void find_two_opt_moves(typename solution_t<i_t, f_t, REQUEST>::view_
     if (sol.problem.is_cvrp_intra()) {
       thrust::tie(cost_delta, selection_delta) = evaluate_two_opt_cvrp_move<i_t, f_t, REQUEST>(
         sol, move_candidates, route, sh_reverse_route.dimensions, first, second);
+    } else if (use_tiles) {
+      thrust::tie(cost_delta, selection_delta) =
+        evaluate_two_opt_tiled_move<i_t, f_t, REQUEST>(move_candidates,
+                                                       route,
+                                                       first,
+                                                       second,
+                                                       sh_reverse_route.dimensions,
+                                                       sh_tiles,
+                                                       tile_size,
+                                                       excess_limit);
     } else {
       thrust::tie(cost_delta, selection_delta) = evaluate_two_opt_move<i_t, f_t, REQUEST>(
         sol, move_candidates, route, first, second, sh_reverse_route.dimensions, excess_limit);
@@ -377,21 +490,27 @@ bool local_search_t<i_t, f_t, REQUEST>::perform_two_opt(
   cuopt_assert(n_blocks > 0, "n_blocks should be positive");
   cuopt_expects(n_blocks > 0, error_type_t::RuntimeError, "A runtime error occurred!");
 
+  // the buffers are resized before the capture, so that the graph only holds the fills and the
+  // search kernel
   if (sol.problem_ptr->is_cvrp_intra()) {
     sampled_nodes_data_.resize(sol.get_n_routes() * sol.get_num_orders(),
                                sol.sol_handle->get_stream());
-    async_fill(sampled_nodes_data_,
-               is_two_opt_uinitialized_t<i_t>::init_data(),
-               sol.sol_handle->get_stream());
   } else {
     two_opt_cand_data_.resize(sol.get_n_routes(), sol.sol_handle->get_stream());
-    async_fill(locks_, 0, sol.sol_handle->get_stream());
   }
 
   auto sh_size = sol.check_routes_can_insert_and_get_sh_size(0);
 
   if (!set_shmem_of_kernel(find_two_opt_moves<i_t, f_t, REQUEST>, sh_size)) { return false; }
 
+  two_opt_cuda_graph.start_capture(sol.sol_handle->get_stream());
+  if (sol.problem_ptr->is_cvrp_intra()) {
+    async_fill(sampled_nodes_data_,
+               is_two_opt_uinitialized_t<i_t>::init_data(),
+               sol.sol_handle->get_stream());
+  } else {
+    async_fill(locks_, 0, sol.sol_handle->get_stream());
+  }
   find_two_opt_moves<i_t, f_t, REQUEST>
     <<<n_blocks, n_threads, sh_size, sol.sol_handle->get_stream()>>>(
       sol.view(),
@@ -399,6 +518,8 @@ bool local_search_t<i_t, f_t, REQUEST>::perform_two_opt(
       cuopt::make_span(two_opt_cand_data_),
       cuopt::make_span(sampled_nodes_data_),
       cuopt::make_span(locks_));
+  two_opt_cuda_graph.end_capture(sol.sol_handle->get_stream());
+  two_opt_cuda_graph.launch_graph(sol.sol_handle->get_stream());
   RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
 
   n_moves_found = thrust::count_if(sol.sol_handle->get_thrust_policy(),
@@ -52,9 +52,7 @@ __global__ void extract_non_overlapping_moves_kernel(
              vrp_candidates.compacted_move_indices.data(),
              n_best_route_pair_moves);
   __syncthreads();
-  raft::random::PCGenerator thread_rng(seed + (threadIdx.x + blockIdx.x * blockDim.x),
-                                       uint64_t((threadIdx.x + blockIdx.x * blockDim.x)),
-                                       0);
+  auto thread_rng = make_worker_rng(seed, (threadIdx.x + blockIdx.x * blockDim.x));
   if (threadIdx.x == 0) {
     random_shuffle(
       shuffled_route_pair_indices.data(), shuffled_route_pair_indices.size(), thread_rng);
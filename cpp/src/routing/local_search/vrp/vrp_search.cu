@@ -650,10 +650,6 @@ bool find_vrp_moves(solution_t<i_t, f_t, REQUEST>& sol,
   raft::common::nvtx::range fun_scope("find_vrp_moves");
   if (sol.n_routes < 2) { return false; }
 
-  if (sol.problem_ptr->is_cvrp()) {
-    compute_reverse_distances<i_t, f_t, REQUEST>
-      <<<sol.get_n_routes(), 32, 0, sol.sol_handle->get_stream()>>>(sol.view());
-  }
   i_t TPB             = std::min(max_n_neighbors, sol.problem_ptr->get_num_orders());
   size_t size_of_frag = dimensions_route_t<i_t, f_t, REQUEST>::get_shared_size(
     max_fragment_size, sol.problem_ptr->dimensions_info);
@@ -669,14 +665,19 @@ bool find_vrp_moves(solution_t<i_t, f_t, REQUEST>& sol,
   cuopt_assert(n_blocks > 0, "n_blocks should be positive");
   cuopt_expects(n_blocks > 0, error_type_t::RuntimeError, "A runtime error occurred!");
   if (!set_shmem_of_kernel(find_vrp_moves_kernel<i_t, f_t, REQUEST>, sh_size)) { return false; }
+  // the reverse distances, the reset and the search are replayed as a single graph launch
   move_candidates.vrp_move_candidates.find_kernel_graph.start_capture(sol.sol_handle->get_stream());
+  if (sol.problem_ptr->is_cvrp()) {
+    compute_reverse_distances<i_t, f_t, REQUEST>
+      <<<sol.get_n_routes(), 32, 0, sol.sol_handle->get_stream()>>>(sol.view());
+  }
   move_candidates.vrp_move_candidates.reset(sol.sol_handle);
   find_vrp_moves_kernel<i_t, f_t, REQUEST>
     <<<n_blocks, TPB, sh_size, sol.sol_handle->get_stream()>>>(
       sol.view(), move_candidates.view(), recycle);
   move_candidates.vrp_move_candidates.find_kernel_graph.end_capture(sol.sol_handle->get_stream());
   move_candidates.vrp_move_candidates.find_kernel_graph.launch_graph(sol.sol_handle->get_stream());
-  sol.sol_handle->sync_stream();
+  RAFT_CHECK_CUDA(sol.sol_handle->get_stream());
   return true;
 }
 
@@ -0,0 +1,112 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/error.hpp>
+#include <cuopt/routing/matrix_stream.hpp>
+
+#include <raft/util/cudart_utils.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cuopt {
+namespace routing {
+
+template <typename i_t, typename f_t>
+matrix_stream_t<i_t, f_t>::matrix_stream_t(raft::handle_t const* handle_ptr,
+                                           i_t num_locations,
+                                           i_t max_block_rows)
+  : handle_ptr_(handle_ptr),
+    num_locations_(num_locations),
+    max_block_rows_(std::min(max_block_rows, num_locations)),
+    matrix_(0, handle_ptr->get_stream()),
+    added_rows_(num_locations > 0 ? num_locations : 0, false)
+{
+  cuopt_expects(num_locations > 0,
+                error_type_t::ValidationError,
+                "The matrix needs at least one location");
+  cuopt_expects(
+    max_block_rows > 0, error_type_t::ValidationError, "The block size must be positive");
+  matrix_.resize(size_t(num_locations_) * num_locations_, handle_ptr_->get_stream());
+  const size_t staging_bytes = size_t(max_block_rows_) * num_locations_ * sizeof(f_t);
+  for (size_t i = 0; i < staging_.size(); ++i) {
+    RAFT_CUDA_TRY(cudaMallocHost(&staging_[i], staging_bytes));
+    RAFT_CUDA_TRY(cudaEventCreateWithFlags(&uploaded_[i], cudaEventDisableTiming));
+  }
+}
+
+template <typename i_t, typename f_t>
+matrix_stream_t<i_t, f_t>::~matrix_stream_t()
+{
+  for (size_t i = 0; i < staging_.size(); ++i) {
+    // The staging buffers can only be released once their last upload is over
+    if (uploaded_[i] != nullptr) {
+      cudaEventSynchronize(uploaded_[i]);
+      cudaEventDestroy(uploaded_[i]);
+    }
+    if (staging_[i] != nullptr) { cudaFreeHost(staging_[i]); }
+  }
+}
+
+template <typename i_t, typename f_t>
+void matrix_stream_t<i_t, f_t>::add_rows(f_t const* rows, i_t first_row, i_t n_rows)
+{
+  cuopt_expects(rows != nullptr || n_rows == 0,
+                error_type_t::ValidationError,
+                "The rows cannot be null");
+  cuopt_expects(first_row >= 0 && n_rows >= 0 && first_row + n_rows <= num_locations_,
+                error_type_t::ValidationError,
+                "The rows must be in the range [0, num_locations)");
+
+  auto stream = handle_ptr_->get_stream();
+  for (i_t offset = 0; offset < n_rows; offset += max_block_rows_) {
+    const i_t block_rows     = std::min(max_block_rows_, n_rows - offset);
+    const size_t block_size  = size_t(block_rows) * num_locations_;
+    const size_t block_start = size_t(first_row + offset) * num_locations_;
+    auto& staging            = staging_[next_staging_];
+    auto& uploaded           = uploaded_[next_staging_];
+    // Wait for the previous upload out of this buffer, the other one may still be in flight
+    RAFT_CUDA_TRY(cudaEventSynchronize(uploaded));
+    std::memcpy(staging, rows + size_t(offset) * num_locations_, block_size * sizeof(f_t));
+    RAFT_CUDA_TRY(cudaMemcpyAsync(matrix_.data() + block_start,
+                                  staging,
+                                  block_size * sizeof(f_t),
+                                  cudaMemcpyHostToDevice,
+                                  stream.value()));
+    RAFT_CUDA_TRY(cudaEventRecord(uploaded, stream.value()));
+    next_staging_ = 1 - next_staging_;
+  }
+
+  for (i_t row = first_row; row < first_row + n_rows; ++row) {
+    if (!added_rows_[row]) {
+      added_rows_[row] = true;
+      ++n_added_rows_;
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+bool matrix_stream_t<i_t, f_t>::is_complete() const noexcept
+{
+  return n_added_rows_ == num_locations_;
+}
+
+template <typename i_t, typename f_t>
+f_t const* matrix_stream_t<i_t, f_t>::data() const noexcept
+{
+  return matrix_.data();
+}
+
+template <typename i_t, typename f_t>
+i_t matrix_stream_t<i_t, f_t>::get_num_locations() const noexcept
+{
+  return num_locations_;
+}
+
+template class matrix_stream_t<int, float>;
+}  // namespace routing
+}  // namespace cuopt
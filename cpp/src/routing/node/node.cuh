@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -34,7 +34,7 @@ class node_t {
  public:
   DI node_t() = delete;
 
-  DI node_t(const enabled_dimensions_t& dimensions_info_)
+  HDI node_t(const enabled_dimensions_t& dimensions_info_)
     : dimensions_info(dimensions_info_), capacity_dim(dimensions_info_.capacity_dim)
   {
   }
@@ -61,20 +61,27 @@ class node_t {
   HDI NodeInfo<i_t> node_info() const { return request.info; }
 
   // calculates and stores forward data
-  template <bool is_device>
+  template <uint32_t DIMS = all_dimensions_mask, bool is_device>
   constexpr void calculate_forward_all(node_t& next_node,
                                        const VehicleInfo<f_t, is_device>& vehicle_info) const
   {
-    loop_over_dimensions(dimensions_info, [&](auto I) {
-      double arc_value = get_arc_of_dimension<i_t, f_t, I, is_device>(
-        request.info, next_node.request.info, vehicle_info);
+    loop_over_dimensions<DIMS>(dimensions_info, [&](auto I) {
+      double arc_value;
+      // the time dependent transit times are evaluated at the forward departure
+      if constexpr (I == (size_t)dim_t::TIME) {
+        arc_value = get_transit_time_at(
+          request.info, next_node.request.info, vehicle_info, time_dim.departure_forward);
+      } else {
+        arc_value = get_arc_of_dimension<i_t, f_t, I, is_device>(
+          request.info, next_node.request.info, vehicle_info);
+      }
       get_dimension<I>().calculate_forward(next_node.get_dimension<I>(), arc_value);
     });
   }
 
   // returns the cost delta of the new route after if we combine this node and next_node
   // this does not return the forward data but just the total cost of new route minus the old route
-  template <bool is_device>
+  template <uint32_t DIMS = all_dimensions_mask, bool is_device>
   HDI double calculate_forward_all_and_delta(node_t& next_node,
                                              VehicleInfo<f_t, is_device> const& vehicle_info,
                                              bool include_objective,
@@ -82,11 +89,11 @@ class node_t {
                                              objective_cost_t const& old_obj_cost,
                                              infeasible_cost_t const& old_inf_cost) const
   {
-    calculate_forward_all(next_node, vehicle_info);
+    calculate_forward_all<DIMS>(next_node, vehicle_info);
 
     objective_cost_t new_obj_cost;
     infeasible_cost_t new_inf_cost;
-    loop_over_dimensions(dimensions_info, [&](auto I) {
+    loop_over_dimensions<DIMS>(dimensions_info, [&](auto I) {
       const auto& curr_dim = get_dimension<I>();
       next_node.get_dimension<I>().get_cost(
         curr_dim, vehicle_info, dimensions_info.get_dimension<I>(), new_obj_cost, new_inf_cost);
@@ -111,8 +118,15 @@ class node_t {
   DI void calculate_backward_all(node_t& prev_node, const VehicleInfo<f_t>& vehicle_info) const
   {
     loop_over_dimensions(dimensions_info, [&](auto I) {
-      double arc_value =
-        get_arc_of_dimension<i_t, f_t, I>(prev_node.request.info, request.info, vehicle_info);
+      double arc_value;
+      // the time dependent transit times are the ones reaching this node by its backward departure
+      if constexpr (I == (size_t)dim_t::TIME) {
+        arc_value = get_transit_time_before(
+          prev_node.request.info, request.info, vehicle_info, time_dim.departure_backward);
+      } else {
+        arc_value =
+          get_arc_of_dimension<i_t, f_t, I>(prev_node.request.info, request.info, vehicle_info);
+      }
       get_dimension<I>().calculate_backward(prev_node.get_dimension<I>(), arc_value);
     });
   }
@@ -161,7 +175,8 @@ class node_t {
     double time_excess = 0.;
     if (prev.dimensions_info.has_dimension(dim_t::TIME)) {
       if (time_between == -1.0) {
-        time_between = get_transit_time(prev.request.info, next.request.info, vehicle_info, true);
+        time_between = get_transit_time_at(
+          prev.request.info, next.request.info, vehicle_info, prev.time_dim.departure_forward);
       }
       time_excess =
         time_node_t<i_t, f_t>::combine(prev.time_dim, next.time_dim, vehicle_info, time_between);
@@ -228,7 +243,8 @@ class node_t {
                               double excess_limit = 0.)
   {
     if (!prev.dimensions_info.has_dimension(dim_t::TIME)) { return true; }
-    auto time_between = get_transit_time(prev.request.info, next.request.info, vehicle_info, true);
+    auto time_between = get_transit_time_at(
+      prev.request.info, next.request.info, vehicle_info, prev.time_dim.departure_forward);
     return time_node_t<i_t, f_t>::combine(
              prev.time_dim, next.time_dim, vehicle_info, time_between) *
              weights[dim_t::TIME] <=
@@ -243,45 +259,51 @@ class node_t {
     return time_combine(prev, next, vehicle_info, d_default_weights, 0.);
   }
 
+  template <uint32_t DIMS = all_dimensions_mask>
   DI double forward_excess(const VehicleInfo<f_t>& vehicle_info,
                            infeasible_cost_t weights = d_default_weights) const
   {
     double excess = 0.;
-    loop_over_dimensions(dimensions_info, [&](auto I) {
+    loop_over_dimensions<DIMS>(dimensions_info, [&](auto I) {
       excess += get_dimension<I>().forward_excess(vehicle_info) * weights[I];
     });
     return excess;
   }
 
+  template <uint32_t DIMS = all_dimensions_mask>
   DI double backward_excess(const VehicleInfo<f_t>& vehicle_info,
                             infeasible_cost_t weights = d_default_weights) const
   {
     double excess = 0.;
-    loop_over_dimensions(dimensions_info, [&](auto I) {
+    loop_over_dimensions<DIMS>(dimensions_info, [&](auto I) {
       excess += get_dimension<I>().backward_excess(vehicle_info) * weights[I];
     });
     return excess;
   }
 
+  template <uint32_t DIMS = all_dimensions_mask>
   DI bool forward_feasible(const VehicleInfo<f_t>& vehicle_info,
                            infeasible_cost_t weights = d_default_weights,
                            double excess_limit       = 0.) const
   {
-    return forward_excess(vehicle_info, weights) <= excess_limit;
+    return forward_excess<DIMS>(vehicle_info, weights) <= excess_limit;
   }
 
+  template <uint32_t DIMS = all_dimensions_mask>
   DI bool backward_feasible(const VehicleInfo<f_t>& vehicle_info,
                             infeasible_cost_t weights = d_default_weights,
                             double excess_limit       = 0.) const
   {
-    return backward_excess(vehicle_info, weights) <= excess_limit;
+    return backward_excess<DIMS>(vehicle_info, weights) <= excess_limit;
   }
 
+  template <uint32_t DIMS = all_dimensions_mask>
   DI bool feasible(const VehicleInfo<f_t>& vehicle_info,
                    infeasible_cost_t weights = d_default_weights,
                    double excess_limit       = 0.) const
   {
-    return forward_excess(vehicle_info, weights) + backward_excess(vehicle_info, weights) <=
+    return forward_excess<DIMS>(vehicle_info, weights) +
+             backward_excess<DIMS>(vehicle_info, weights) <=
            excess_limit;
   }
 
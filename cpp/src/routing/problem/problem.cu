@@ -7,11 +7,25 @@
 
 #include <utilities/vector_helpers.cuh>
 #include "../local_search/compute_compatible.cuh"
+#include "../utilities/cuopt_utils.cuh"
 #include "problem.cuh"
 
 #include <utilities/vector_helpers.cuh>
 
 #include <utilities/seed_generator.cuh>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+
+#include <chrono>
+#include <future>
+
 namespace cuopt {
 namespace routing {
 namespace detail {
@@ -31,19 +45,50 @@ problem_t<i_t, f_t>::problem_t(const data_model_view_t<i_t, f_t>& data_model_vie
     start_depot_node_infos(0, handle_ptr->get_stream()),
     return_depot_node_infos(0, handle_ptr->get_stream()),
     bucket_to_vehicle_id(0, handle_ptr->get_stream()),
-    special_nodes(handle_ptr)
+    special_nodes(handle_ptr),
+    prize_candidates(0, handle_ptr->get_stream())
 {
+  // every phase synchronizes the stream so that its time includes its device work
+  auto phase_start = std::chrono::steady_clock::now();
+  auto end_phase   = [&](const std::string& phase) {
+    handle_ptr->sync_stream();
+    const auto now     = std::chrono::steady_clock::now();
+    setup_times[phase] = std::chrono::duration<double>(now - phase_start).count();
+    phase_start        = now;
+  };
+
   populate_fleet_info(data_model_view_, fleet_info);
-  populate_order_info(data_model_view_, order_info);
+  end_phase("fleet_info");
+
+  // The host copy of the matrices is the largest transfer of the setup. It runs on its own thread
+  // and stream, overlapped with the setup of the orders and of the vehicle constraints
+  int device = 0;
+  RAFT_CUDA_TRY(cudaGetDevice(&device));
+  auto matrices_h = std::async(std::launch::async, [this, device]() {
+    RAFT_CUDA_TRY(cudaSetDevice(device));
+    rmm::cuda_stream stream;
+    auto matrices = fleet_info.matrices_to_host(stream.view());
+    stream.synchronize();
+    return matrices;
+  });
 
+  populate_order_info(data_model_view_, order_info);
+  end_phase("order_info");
   populate_special_nodes();
+  populate_candidate_graph();
+  end_phase("special_nodes");
   populate_demand_container(data_model_view_, fleet_info, order_info);
   populate_vehicle_order_match(
     data_model_view_, fleet_info.fleet_order_constraints_, fleet_info.is_homogenous_);
   populate_vehicle_infos(data_model_view_, fleet_info);
+  end_phase("vehicle_constraints");
   // populate host vectors
   populate_host_arrays();
   populate_vehicle_buckets();
+  fleet_info_h.matrices = matrices_h.get();
+  end_phase("host_copies");
+  // the host copies keep the exact matrices
+  if (solver_settings_.get_half_precision_matrices()) { fleet_info.matrices_.to_half_precision(); }
 
   initialize_depot_info();
 
@@ -55,18 +100,21 @@ problem_t<i_t, f_t>::problem_t(const data_model_view_t<i_t, f_t>& data_model_vie
              pair_indices_h.size(),
              handle_ptr->get_stream());
 
-  vehicle_types_h = cuopt::host_copy(fleet_info.v_types_, handle_ptr->get_stream());
+  vehicle_types_h     = cuopt::host_copy(fleet_info.v_types_, handle_ptr->get_stream());
+  const auto matrices = fleet_info_h.matrices.view();
   for (auto& vtype : vehicle_types_h) {
     if (!distance_matrices_h.count(vtype)) {
-      auto cost_matrix = fleet_info.matrices_.get_cost_matrix(vtype);
-      auto cost_matrix_h =
-        cuopt::host_copy(cost_matrix, n_locations * n_locations, handle_ptr->get_stream());
+      std::vector<f_t> cost_matrix_h((size_t)n_locations * n_locations);
+      for (size_t idx = 0; idx < cost_matrix_h.size(); ++idx) {
+        cost_matrix_h[idx] = matrices.get_cost_value(vtype, idx / n_locations, idx % n_locations);
+      }
       distance_matrices_h.emplace(vtype, cost_matrix_h);
     }
   }
   handle_ptr->sync_stream();
 
   populate_dimensions_info();
+  populate_prize_candidates();
   auto& problem_ref   = *this;
   auto pickup_indices = data_view_ptr->get_pickup_delivery_pair().first;
   bool is_pdp         = pickup_indices != nullptr;
@@ -76,11 +124,197 @@ problem_t<i_t, f_t>::problem_t(const data_model_view_t<i_t, f_t>& data_model_vie
   } else {
     initialize_incompatible<i_t, f_t, request_t::VRP>(problem_ref);
   }
+  end_phase("compatibility");
 
   seed_generator::set_seed(
     order_info.get_num_requests(), order_info.get_num_orders(), order_info.get_num_orders());
 }
 
+template <typename i_t, typename f_t>
+void problem_t<i_t, f_t>::populate_candidate_graph()
+{
+  std::optional<uint8_t> graph_vehicle_type;
+  for (const auto& [vehicle_type, candidates] : data_view_ptr->get_candidate_cost_matrices()) {
+    if (data_view_ptr->get_cost_matrix(vehicle_type) != nullptr) { continue; }
+    if (!graph_vehicle_type.has_value() || vehicle_type < graph_vehicle_type.value()) {
+      graph_vehicle_type = vehicle_type;
+    }
+  }
+  if (!graph_vehicle_type.has_value()) { return; }
+  const auto& candidates =
+    data_view_ptr->get_candidate_cost_matrices().at(graph_vehicle_type.value());
+  n_candidate_neighbors = candidates.get_n_neighbors();
+  const size_t size     = (size_t)data_view_ptr->get_num_locations() * n_candidate_neighbors;
+  candidate_neighbors   = raft::device_span<const i_t>(candidates.get_neighbors(), size);
+}
+
+// Estimated cost of serving each order: the detour through the order from its two nearest
+// locations. One block per order
+template <typename i_t, typename f_t>
+__global__ void estimate_detours_kernel(typename fleet_info_t<i_t, f_t>::view_t fleet_info,
+                                        typename order_info_t<i_t, f_t>::view_t order_info,
+                                        uint8_t vehicle_type,
+                                        i_t n_locations,
+                                        raft::device_span<double> detours)
+{
+  __shared__ i_t reduction_index;
+  __shared__ double reduction_buf[2 * warp_size];
+
+  const auto& matrices = fleet_info.matrices;
+  const i_t location   = order_info.get_order_location(blockIdx.x);
+  i_t nearest[2];
+  for (i_t k = 0; k < 2; ++k) {
+    double best_dist  = std::numeric_limits<double>::max();
+    i_t best_location = -1;
+    for (i_t other = threadIdx.x; other < n_locations; other += blockDim.x) {
+      if (other == location || (k == 1 && other == nearest[0])) { continue; }
+      double dist = matrices.get_cost_value(vehicle_type, other, location) +
+                    matrices.get_cost_value(vehicle_type, location, other);
+      if (dist < best_dist) {
+        best_dist     = dist;
+        best_location = other;
+      }
+    }
+    block_reduce_ranked(best_dist, best_location, reduction_buf, &reduction_index);
+    nearest[k] = reduction_index;
+  }
+
+  if (threadIdx.x == 0) {
+    double detour = 0.;
+    if (nearest[0] >= 0) {
+      i_t second = nearest[1] >= 0 ? nearest[1] : nearest[0];
+
+      detour = matrices.get_cost_value(vehicle_type, nearest[0], location) +
+               matrices.get_cost_value(vehicle_type, location, second) -
+               matrices.get_cost_value(vehicle_type, nearest[0], second);
+    }
+    detours[blockIdx.x] = max(0., detour);
+  }
+}
+
+template <typename i_t, typename f_t>
+void problem_t<i_t, f_t>::populate_prize_candidates()
+{
+  // The detours are rough estimates of the insertion costs: an order is pruned only when its
+  // prize is clearly below its detour, and twice the fleet capacity worth of orders is kept
+  constexpr double detour_margin   = 0.5;
+  constexpr double capacity_factor = 2.;
+
+  if (!has_prize_collection()) { return; }
+  auto stream          = handle_ptr->get_stream();
+  auto policy          = handle_ptr->get_thrust_policy();
+  const i_t n_orders   = get_num_orders();
+  const i_t n_requests = get_num_requests();
+  const i_t fleet_size = get_fleet_size();
+  const double cost_w  = dimensions_info.objective_weights[objective_t::COST];
+  const double prize_w = dimensions_info.objective_weights[objective_t::PRIZE];
+  const i_t n_cap_dims = dimensions_info.has_dimension(dim_t::CAP)
+                           ? dimensions_info.capacity_dim.n_capacity_dimensions
+                           : 0;
+
+  rmm::device_uvector<double> detours(n_orders, stream);
+  estimate_detours_kernel<i_t, f_t>
+    <<<n_orders, 128, 0, stream>>>(fleet_info.view(),
+                                   order_info.view(),
+                                   vehicle_types_h[0],
+                                   data_view_ptr->get_num_locations(),
+                                   cuopt::make_span(detours));
+  RAFT_CHECK_CUDA(stream);
+
+  // capacity of the whole fleet in each dimension, the weights of the knapsack are relative to it
+  std::vector<double> fleet_capacity_h(n_cap_dims);
+  for (i_t dim = 0; dim < n_cap_dims; ++dim) {
+    auto capacities       = fleet_info.v_capacities_.begin() + dim * fleet_size;
+    fleet_capacity_h[dim] = thrust::reduce(policy, capacities, capacities + fleet_size, 0.);
+  }
+  auto fleet_capacity = cuopt::device_copy(fleet_capacity_h, stream);
+
+  // pickup order of each request
+  rmm::device_uvector<i_t> request_orders(n_requests, stream);
+  if (order_info.is_pdp()) {
+    raft::copy(request_orders.data(),
+               data_view_ptr->get_pickup_delivery_pair().first,
+               n_requests,
+               stream);
+  } else {
+    thrust::sequence(
+      policy, request_orders.begin(), request_orders.end(), (i_t)order_info.depot_included_);
+  }
+
+  rmm::device_uvector<double> ratios(n_requests, stream);
+  rmm::device_uvector<double> weights(n_requests, stream);
+  rmm::device_uvector<uint8_t> profitable(n_requests, stream);
+  thrust::for_each(
+    policy,
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(n_requests),
+    [orders         = cuopt::make_span(request_orders),
+     ratios         = cuopt::make_span(ratios),
+     weights        = cuopt::make_span(weights),
+     profitable     = cuopt::make_span(profitable),
+     detours        = cuopt::make_span(detours),
+     fleet_capacity = cuopt::make_span(fleet_capacity),
+     order_info     = order_info.view(),
+     n_orders,
+     cost_w,
+     prize_w,
+     detour_margin] __device__(i_t request) {
+      i_t pickup    = orders[request];
+      double prize  = order_info.prizes[pickup];
+      double detour = detours[pickup];
+      if (order_info.is_pdp()) {
+        i_t delivery = order_info.pair_indices[pickup];
+        prize += order_info.prizes[delivery];
+        detour += detours[delivery];
+      }
+      double weight = 0.;
+      for (size_t dim = 0; dim < fleet_capacity.size(); ++dim) {
+        weight = max(weight, order_info.demand[dim * n_orders + pickup] / fleet_capacity[dim]);
+      }
+      double value        = prize_w * prize - cost_w * detour;
+      weights[request]    = weight;
+      ratios[request]     = weight > 0. ? value / weight : std::numeric_limits<double>::max();
+      profitable[request] = prize_w * prize > detour_margin * cost_w * detour;
+    });
+
+  // LP relaxation of the knapsack: best profit per unit of capacity first
+  rmm::device_uvector<i_t> ranked(n_requests, stream);
+  thrust::sequence(policy, ranked.begin(), ranked.end());
+  thrust::sort_by_key(
+    policy, ratios.begin(), ratios.end(), ranked.begin(), thrust::greater<double>());
+  rmm::device_uvector<double> used_capacity(n_requests, stream);
+  thrust::gather(policy, ranked.begin(), ranked.end(), weights.begin(), used_capacity.begin());
+  thrust::inclusive_scan(policy, used_capacity.begin(), used_capacity.end(), used_capacity.begin());
+
+  prize_candidates.resize(n_orders, stream);
+  // the depot and the orders that are not requests stay candidates
+  thrust::fill(policy, prize_candidates.begin(), prize_candidates.end(), 1);
+  thrust::for_each(
+    policy,
+    thrust::make_counting_iterator<i_t>(0),
+    thrust::make_counting_iterator<i_t>(n_requests),
+    [orders           = cuopt::make_span(request_orders),
+     ranked           = cuopt::make_span(ranked),
+     weights          = cuopt::make_span(weights),
+     profitable       = cuopt::make_span(profitable),
+     used_capacity    = cuopt::make_span(used_capacity),
+     prize_candidates = cuopt::make_span(prize_candidates),
+     order_info       = order_info.view(),
+     capacity_factor] __device__(i_t rank) {
+      i_t request = ranked[rank];
+      i_t pickup  = orders[request];
+      // the request that crosses the capacity is the fractional item of the relaxation
+      bool fits                = used_capacity[rank] - weights[request] < capacity_factor;
+      prize_candidates[pickup] = profitable[request] && fits;
+      if (order_info.is_pdp()) {
+        prize_candidates[order_info.pair_indices[pickup]] = prize_candidates[pickup];
+      }
+    });
+
+  auto n_candidates = thrust::count(policy, prize_candidates.begin(), prize_candidates.end(), 1);
+  if (n_candidates == n_orders) { prize_candidates.resize(0, stream); }
+}
+
 template <typename i_t, typename f_t>
 VehicleInfo<f_t, false> problem_t<i_t, f_t>::get_vehicle_info(i_t vehicle_id) const
 {
@@ -104,7 +338,8 @@ void problem_t<i_t, f_t>::populate_vehicle_buckets()
 {
   auto fleet_size = data_view_ptr->get_fleet_size();
   vehicle_buckets_h.resize(fleet_size);
-  fleet_info_h = fleet_info.to_host(handle_ptr->get_stream());
+  // the matrices are copied to the host separately, see the constructor
+  fleet_info_h = fleet_info.to_host(handle_ptr->get_stream(), false);
 
   // infer vehicle types from data model
   for (int vehicle_id = 0; vehicle_id < fleet_size; ++vehicle_id) {
@@ -261,7 +496,11 @@ void problem_t<i_t, f_t>::populate_dimensions_info()
 
   bool order_tw_exists = std::get<0>(data_view_ptr->get_order_time_windows()) != nullptr;
 
-  bool time_matrix_exists = data_view_ptr->get_transit_time_matrices().size() > 0;
+  bool time_dependent_matrix_exists =
+    data_view_ptr->get_time_dependent_transit_time_matrices().size() > 0;
+  bool time_matrix_exists = data_view_ptr->get_transit_time_matrices().size() > 0 ||
+                            data_view_ptr->get_candidate_transit_time_matrices().size() > 0 ||
+                            time_dependent_matrix_exists;
 
   bool enable_time_dim = vehicle_max_times_exists || vehicle_tw_exists || travel_time_obj_exists ||
                          order_tw_exists || time_matrix_exists;
@@ -275,6 +514,7 @@ void problem_t<i_t, f_t>::populate_dimensions_info()
     }
 
     if (travel_time_obj_exists) { time_dim_info.has_travel_time_obj = true; }
+    if (time_dependent_matrix_exists) { time_dim_info.is_time_dependent = true; }
   }
 
   // CAP dimensions info
@@ -358,7 +598,7 @@ void problem_t<i_t, f_t>::populate_dimensions_info()
   dimensions_info.is_tsp = is_tsp;
 
   if (!is_tsp) {
-    is_cvrp_ = !is_pdp() && (data_view_ptr->get_cost_matrices().size() == 1);
+    is_cvrp_ = !is_pdp() && (data_view_ptr->get_num_vehicle_types() == 1);
     if (is_cvrp_) {
       loop_over_dimensions(dimensions_info, [&](auto I) {
         if (I != (int)dim_t::DIST && I != (int)dim_t::CAP) { is_cvrp_ = false; }
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -18,6 +18,7 @@
 #include <routing/routing_helpers.cuh>
 #include <routing/structures.hpp>
 #include <routing/utilities/check_input.hpp>
+#include <utilities/bit_span.hpp>
 #include <utilities/seed_generator.cuh>
 
 #include <raft/core/handle.hpp>
@@ -29,7 +30,9 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <map>
 #include <optional>
+#include <string>
 
 namespace cuopt {
 namespace routing {
@@ -111,7 +114,14 @@ struct viables_t {
         &viable_to_deliveries[node * n_requests] + i_t(exclude_self_in_neighbors) + batch_offset,
         (size_t)n_considered};
     }
-    raft::device_span<const uint8_t> compatibility_matrix;
+    // whether the requests of orders i and j can be served by the same route
+    DI bool is_compatible(i_t i, i_t j) const
+    {
+      return bit_span(compatibility_matrix.data() + i * compatibility_row_words,
+                      compatibility_row_words * bit_span::word_bits)[j];
+    }
+    raft::device_span<const bit_span::word_t> compatibility_matrix;
+    i_t compatibility_row_words;
     raft::device_span<const i_t> viable_to_pickups;
     raft::device_span<const i_t> n_viable_to_pickups;
     raft::device_span<const i_t> viable_from_pickups;
@@ -126,8 +136,9 @@ struct viables_t {
   view_t view() const
   {
     view_t v;
-    v.compatibility_matrix =
-      raft::device_span<const uint8_t>{compatibility_matrix.data(), compatibility_matrix.size()};
+    v.compatibility_matrix    = raft::device_span<const bit_span::word_t>{
+      compatibility_matrix.data(), compatibility_matrix.size()};
+    v.compatibility_row_words = compatibility_row_words;
     v.viable_to_pickups =
       raft::device_span<const i_t>{viable_to_pickups.data(), viable_to_pickups.size()};
     v.n_viable_to_pickups =
@@ -148,7 +159,9 @@ struct viables_t {
     return v;
   }
 
-  rmm::device_uvector<uint8_t> compatibility_matrix;
+  // n_orders x n_orders matrix, one row of packed bits per order, see bit_span
+  rmm::device_uvector<bit_span::word_t> compatibility_matrix;
+  i_t compatibility_row_words = 0;
   rmm::device_uvector<i_t> viable_to_pickups;
   rmm::device_uvector<i_t> n_viable_to_pickups;
   rmm::device_uvector<i_t> viable_from_pickups;
@@ -225,6 +238,29 @@ class problem_t {
     }
     DI bool is_cvrp() const { return is_cvrp_; }
 
+    // Whether the orders are connected in the candidate graph, always true when the costs are
+    // given as dense matrices
+    DI bool is_candidate_pair(i_t order_1, i_t order_2) const
+    {
+      if (candidate_neighbors.empty()) { return true; }
+      i_t location_1 = order_info.get_order_location(order_1);
+      i_t location_2 = order_info.get_order_location(order_2);
+      if (location_1 == location_2) { return true; }
+      for (i_t k = 0; k < n_candidate_neighbors; ++k) {
+        if (candidate_neighbors[location_1 * n_candidate_neighbors + k] == location_2 ||
+            candidate_neighbors[location_2 * n_candidate_neighbors + k] == location_1) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Whether prize collection may insert the unserved order, always true without the pre-pass
+    DI bool is_prize_candidate(i_t order) const
+    {
+      return prize_candidates.empty() || prize_candidates[order];
+    }
+
     typename fleet_info_t<i_t, f_t>::view_t fleet_info;
     typename order_info_t<i_t, f_t>::view_t order_info;
     raft::device_span<const i_t> pickup_indices;
@@ -235,6 +271,9 @@ class problem_t {
     raft::device_span<const NodeInfo<>> return_depot_node_infos;
     raft::device_span<const i_t> bucket_to_vehicle_id;
     typename special_nodes_t<i_t>::view_t special_nodes;
+    raft::device_span<const i_t> candidate_neighbors;
+    i_t n_candidate_neighbors{0};
+    raft::device_span<const uint8_t> prize_candidates;
     bool non_uniform_breaks{false};
     bool is_cvrp_{false};
   };
@@ -259,6 +298,9 @@ class problem_t {
                                                                     return_depot_node_infos.size());
     v.bucket_to_vehicle_id    = cuopt::make_span(bucket_to_vehicle_id);
     v.special_nodes           = special_nodes.view();
+    v.candidate_neighbors     = candidate_neighbors;
+    v.n_candidate_neighbors   = n_candidate_neighbors;
+    v.prize_candidates        = cuopt::make_span(prize_candidates);
     v.non_uniform_breaks      = has_non_uniform_breaks();
     v.is_cvrp_                = is_cvrp();
     return v;
@@ -283,6 +325,15 @@ class problem_t {
 
   void populate_special_nodes();
 
+  // Restricts the neighborhoods to the candidate graph of the first vehicle type whose costs are
+  // given as a candidate matrix
+  void populate_candidate_graph();
+
+  // Knapsack relaxation of the prize collection: keeps as candidates the orders whose prize
+  // covers their estimated detour, by decreasing profit per unit of capacity, up to a multiple of
+  // the fleet capacity
+  void populate_prize_candidates();
+
   i_t get_fleet_size() const;
 
   i_t get_max_break_dimensions() const;
@@ -327,9 +378,15 @@ class problem_t {
   rmm::device_uvector<i_t> bucket_to_vehicle_id;
 
   special_nodes_t<i_t> special_nodes;
+  raft::device_span<const i_t> candidate_neighbors;
+  i_t n_candidate_neighbors{0};
+  // one entry per order, empty when all the orders are candidates, see is_prize_candidate
+  rmm::device_uvector<uint8_t> prize_candidates;
   bool is_tsp{false};
   bool is_cvrp_{false};
   bool non_uniform_breaks_{false};
+  //! Wall time of each setup phase in seconds, returned in the assignment
+  std::map<std::string, double> setup_times;
 };
 
 }  // namespace detail
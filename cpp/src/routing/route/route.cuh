@@ -829,10 +829,10 @@ class route_t {
         time_stamp = max(time_stamp, dimensions.time_dim.window_start[i]);
         dimensions.time_dim.actual_arrival[i] = time_stamp;
         if (i != *n_nodes) {
-          time_stamp += get_transit_time(dimensions.requests.node_info[i],
-                                         dimensions.requests.node_info[i + 1],
-                                         vehicle_info(),
-                                         true);
+          time_stamp += get_transit_time_at(dimensions.requests.node_info[i],
+                                            dimensions.requests.node_info[i + 1],
+                                            vehicle_info(),
+                                            time_stamp);
         }
       }
     }
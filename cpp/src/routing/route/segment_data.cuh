@@ -0,0 +1,111 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include "../node/node.cuh"
+
+namespace cuopt {
+namespace routing {
+namespace detail {
+
+/*! \brief { Concatenation data of a sequence of nodes [Vidal et al. 2013]. The sequence can be
+ * appended to the forward data of a node in constant time, so that long segments are evaluated
+ * without walking their nodes. Only the distance, time and capacity dimensions are supported,
+ * without travel time objectives or constraints since the waiting times are not kept, and without
+ * time dependent transit times since the sequence durations are fixed } */
+template <typename i_t, typename f_t>
+struct segment_data_t {
+  static constexpr int max_capacity_dim = default_max_capacity_dim;
+  //! The node evaluations around the segments are specialized on the supported dimensions
+  static constexpr uint32_t dimensions_mask =
+    dimensions_mask_of<dim_t::DIST, dim_t::TIME, dim_t::CAP>;
+
+  static HDI bool is_supported(const enabled_dimensions_t& dimensions_info)
+  {
+    for (size_t i = 0; i < (size_t)dim_t::SIZE; ++i) {
+      if (!((dimensions_mask >> i) & 1u) && dimensions_info.has_dimension((dim_t)i)) {
+        return false;
+      }
+    }
+    return !dimensions_info.time_dim.should_compute_travel_time() &&
+           !dimensions_info.time_dim.is_time_dependent;
+  }
+
+  template <request_t REQUEST>
+  static HDI segment_data_t from_node(const node_t<i_t, f_t, REQUEST>& node)
+  {
+    segment_data_t segment;
+    segment.duration  = 0.;
+    segment.time_warp = 0.;
+    segment.earliest  = node.time_dim.window_start;
+    segment.latest    = node.time_dim.window_end;
+    segment.distance  = 0.;
+    constexpr_for<max_capacity_dim>([&](auto i) {
+      segment.demand[i]   = node.capacity_dim.demand[i];
+      segment.max_load[i] = node.capacity_dim.demand[i];
+    });
+    return segment;
+  }
+
+  /*! \brief { Appends the sequence next, reached from the last node of this one through an arc of
+   * the given transit time and distance } */
+  HDI void append(const segment_data_t& next, double time_between, double distance_between)
+  {
+    const double delta           = duration - time_warp + time_between;
+    const double delta_wait      = max(next.earliest - delta - latest, 0.);
+    const double delta_time_warp = max(earliest + delta - next.latest, 0.);
+    earliest = max(next.earliest - delta, earliest) - delta_wait;
+    latest   = min(next.latest - delta, latest) + delta_time_warp;
+
+    duration += next.duration + time_between + delta_wait;
+    time_warp += next.time_warp + delta_time_warp;
+    distance += distance_between + next.distance;
+    constexpr_for<max_capacity_dim>([&](auto i) {
+      max_load[i] = max(max_load[i], demand[i] + next.max_load[i]);
+      demand[i] += next.demand[i];
+    });
+  }
+
+  /*! \brief { Sets the forward data of last, the last node of the sequence, as if the sequence was
+   * visited after prev through an arc of the given transit time and distance } */
+  template <request_t REQUEST>
+  HDI void apply_forward(const node_t<i_t, f_t, REQUEST>& prev,
+                         node_t<i_t, f_t, REQUEST>& last,
+                         double time_between,
+                         double distance_between) const
+  {
+    const double arrival = prev.time_dim.departure_forward + time_between;
+    last.time_dim.excess_forward =
+      prev.time_dim.excess_forward + time_warp + max(arrival - latest, 0.);
+    last.time_dim.departure_forward = max(earliest, min(arrival, latest)) + duration - time_warp;
+    last.distance_dim.distance_forward =
+      prev.distance_dim.distance_forward + distance_between + distance;
+    constexpr_for<max_capacity_dim>([&](auto i) {
+      if (i < prev.capacity_dim.n_capacity_dimensions) {
+        last.capacity_dim.gathered[i] = prev.capacity_dim.gathered[i] + demand[i];
+        last.capacity_dim.max_to_node[i] =
+          max(prev.capacity_dim.max_to_node[i], prev.capacity_dim.gathered[i] + max_load[i]);
+      }
+    });
+  }
+
+  // no default member initializers, so that the tiles can be kept in shared memory
+  //! [hy] duration, time warp, earliest and latest start of the sequence
+  double duration;
+  double time_warp;
+  double earliest;
+  double latest;
+  double distance;
+  //! Total demand of the sequence and max load within it, relative to the load before it
+  i_t demand[max_capacity_dim];
+  i_t max_load[max_capacity_dim];
+};
+
+}  // namespace detail
+}  // namespace routing
+}  // namespace cuopt
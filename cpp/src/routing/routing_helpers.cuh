@@ -65,26 +65,39 @@ static constexpr void loop_over_all_dimensions(F&& f)
   constexpr_for<(size_t)0, (size_t)dim_t::SIZE, (size_t)1, F>(std::move(f));
 }
 
+//! Compile time set of dimensions, one bit per dimension
+template <dim_t... dims>
+constexpr uint32_t dimensions_mask_of = ((1u << (uint32_t)dims) | ... | 0u);
+
+constexpr uint32_t all_dimensions_mask = (1u << (uint32_t)dim_t::SIZE) - 1;
+
 /**
  * @brief Loop over only active dimensions. Note that except for checking if a dimension
  * exists, everything else is determined at compile time, including the lambda.
  *
- * @note Potentially everything can be done at compile time if enabled_dimensions is compile time
+ * @note The dimensions outside of Mask are skipped at compile time, so that kernels specialized on
+ * a known set of dimensions do not pay for the others
  *
+ * @tparam Mask compile time set of the dimensions that can be active
  * @tparam Start
  * @tparam End
  * @tparam F
  * @param dimensions_info
  * @param f
  */
-template <size_t Start = 0, size_t End = (size_t)dim_t::SIZE, class F>
+template <uint32_t Mask = all_dimensions_mask,
+          size_t Start  = 0,
+          size_t End    = (size_t)dim_t::SIZE,
+          class F>
 static constexpr void loop_over_dimensions(const enabled_dimensions_t& dimensions_info, F&& f)
 {
   if constexpr (Start < End) {
-    if (dimensions_info.has_dimension((dim_t)Start)) {
-      f(std::integral_constant<decltype(Start), Start>());
+    if constexpr ((Mask >> Start) & 1u) {
+      if (dimensions_info.has_dimension((dim_t)Start)) {
+        f(std::integral_constant<decltype(Start), Start>());
+      }
     }
-    loop_over_dimensions<Start + 1, End>(dimensions_info, f);
+    loop_over_dimensions<Mask, Start + 1, End>(dimensions_info, f);
   }
 }
 
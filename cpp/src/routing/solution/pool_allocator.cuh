@@ -14,6 +14,11 @@
 #include "../problem/problem.cuh"
 #include "../routing_helpers.cuh"
 
+#include <rmm/cuda_stream.hpp>
+
+#include <memory>
+#include <vector>
+
 namespace cuopt {
 namespace routing {
 namespace detail {
@@ -72,12 +77,41 @@ class pool_allocator_t {
 
   void sync_all_streams() const { stream.synchronize(); }
 
+  // A lane runs a local search next to the ones of the other lanes, on a stream of its own with
+  // its own local search workspace
+  struct lane_t {
+    lane_t(const Problem* problem_)
+      : lane_stream(),
+        sol_handle(std::make_unique<solution_handle_t<i_t, f_t>>(lane_stream.view())),
+        solution(*problem_, 0, sol_handle.get())
+    {
+      resource = std::make_unique<routing_resource_t<i_t, f_t, Solution, Problem>>(
+        sol_handle.get(), problem_, solution);
+    }
+
+    rmm::cuda_stream lane_stream;
+    std::unique_ptr<solution_handle_t<i_t, f_t>> sol_handle;
+    // working copy of the solution being improved
+    Solution solution;
+    std::unique_ptr<routing_resource_t<i_t, f_t, Solution, Problem>> resource;
+  };
+
+  void create_lanes(i_t n_lanes)
+  {
+    raft::common::nvtx::range fun_scope("create_lanes");
+    for (i_t i = lanes.size(); i < n_lanes; ++i) {
+      lanes.emplace_back(std::make_unique<lane_t>(&problem));
+    }
+  }
+
   // problem description
   rmm::cuda_stream_view stream;
   const Problem& problem;
   std::vector<std::unique_ptr<solution_handle_t<i_t, f_t>>> sol_handles;
   // keep a thread safe pool of local search and ges objects that can be reused
   std::unique_ptr<shared_pool_t<routing_resource_t<i_t, f_t, Solution, Problem>>> resource_pool;
+  // empty unless create_lanes was called
+  std::vector<std::unique_ptr<lane_t>> lanes;
 };
 
 }  // namespace detail
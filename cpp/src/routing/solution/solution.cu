@@ -6,9 +6,13 @@
 /* clang-format on */
 
 #include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <utilities/copy_helpers.hpp>
 #include "solution.cuh"
 #include "solution_kernels.cuh"
+
+#include <atomic>
 namespace cuopt {
 namespace routing {
 namespace detail {
@@ -21,7 +25,8 @@ route_t<i_t, f_t, REQUEST>& solution_t<i_t, f_t, REQUEST>::get_route(i_t route_i
   cuopt_assert(route_id < (i_t)routes.size(),
                "route_id should be less than total number of routes");
   raft::common::nvtx::range fun_scope("get_route");
-  auto idx = route_id_to_idx[route_id];
+  routes_modified_on_host = true;
+  auto idx                = route_id_to_idx[route_id];
   return routes[idx];
 }
 
@@ -76,6 +81,7 @@ void solution_t<i_t, f_t, REQUEST>::add_route(route_t<i_t, f_t, REQUEST>&& route
                                               bool check_size)
 {
   raft::common::nvtx::range fun_scope("add_route");
+  routes_modified_on_host = true;
   cuopt_assert(!check_size || (n_nodes > request_info_t<i_t, REQUEST>::size()),
                "There should be at least one request in the route!");
   cuopt_expects(!check_size || (n_nodes > request_info_t<i_t, REQUEST>::size()),
@@ -109,6 +115,7 @@ void solution_t<i_t, f_t, REQUEST>::add_routes(
   const std::vector<std::pair<int, std::vector<NodeInfo<>>>>& new_routes)
 {
   raft::common::nvtx::range fun_scope("add_routes");
+  routes_modified_on_host = true;
   cuopt_assert(new_routes.size() > 0, "There should be at least one route in the vector!");
   thrust::fill(sol_handle->get_thrust_policy(),
                routes_to_search.data() + n_routes,
@@ -271,6 +278,29 @@ void solution_t<i_t, f_t, REQUEST>::set_routes_to_copy()
   thrust::fill(sol_handle->get_thrust_policy(), routes_to_copy.begin(), routes_to_copy.end(), 1);
 }
 
+template <typename i_t, typename f_t, request_t REQUEST>
+void solution_t<i_t, f_t, REQUEST>::update_route_versions()
+{
+  // versions are unique across all the solutions of the process
+  static std::atomic<uint64_t> next_version{1};
+  if (routes_modified_on_host) {
+    set_routes_to_copy();
+    routes_modified_on_host = false;
+  }
+  const uint64_t first_version = next_version.fetch_add(routes_to_copy.size());
+  thrust::for_each(sol_handle->get_thrust_policy(),
+                   thrust::make_counting_iterator<i_t>(0),
+                   thrust::make_counting_iterator<i_t>(routes_to_copy.size()),
+                   [first_version,
+                    modified = routes_to_copy.data(),
+                    versions = route_versions.data()] __device__(i_t route_id) {
+                     if (modified[route_id]) {
+                       versions[route_id] = first_version + route_id;
+                       modified[route_id] = 0;
+                     }
+                   });
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::unset_routes_to_search()
 {
@@ -285,6 +315,18 @@ void solution_t<i_t, f_t, REQUEST>::set_routes_to_search()
     sol_handle->get_thrust_policy(), routes_to_search.begin(), routes_to_search.end(), 1);
 }
 
+template <typename i_t, typename f_t, request_t REQUEST>
+void solution_t<i_t, f_t, REQUEST>::copy_routes_to_search(
+  const solution_t<i_t, f_t, REQUEST>& src_sol)
+{
+  src_sol.sol_handle->sync_stream();
+  raft::copy(routes_to_search.data(),
+             src_sol.routes_to_search.data(),
+             std::min(routes_to_search.size(), src_sol.routes_to_search.size()),
+             sol_handle->get_stream());
+  sol_handle->sync_stream();
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::set_route_views()
 {
@@ -295,7 +337,7 @@ void solution_t<i_t, f_t, REQUEST>::set_route_views()
   }
 
   for (size_t i = 0; i < routes.size(); ++i) {
-    const auto route_view = get_route(i).view();
+    const auto route_view = routes[route_id_to_idx[i]].view();
     routes_view.set_element_async(i, route_view, sol_handle->get_stream());
   }
 }
@@ -309,11 +351,16 @@ void solution_t<i_t, f_t, REQUEST>::random_init_routes()
   stream.synchronize();
   const i_t one = 1;
   d_sol_found.set_value_async(one, stream);
-  std::vector<i_t> indices(get_num_requests());
   rmm::device_uvector<i_t> d_indices(get_num_requests(), stream);
-  thrust::sequence(indices.begin(), indices.end());
-  std::random_shuffle(indices.begin(), indices.end());
-  raft::copy(d_indices.data(), indices.data(), indices.size(), stream);
+  if (n_routes < get_num_requests()) {
+    // only the first n_routes requests are placed, pick them as seeds
+    sort_requests_by_seed_score(d_indices);
+  } else {
+    std::vector<i_t> indices(get_num_requests());
+    thrust::sequence(indices.begin(), indices.end());
+    std::random_shuffle(indices.begin(), indices.end());
+    raft::copy(d_indices.data(), indices.data(), indices.size(), stream);
+  }
   // Do the updates to n_nodes in host side and device side
   // Other option of copying might be better
   const int n_initial_nodes = 1 + request_info_t<i_t, REQUEST>::size();
@@ -374,11 +421,12 @@ void solution_t<i_t, f_t, REQUEST>::resize_routes(i_t new_size)
 {
   raft::common::nvtx::range fun_scope("resize_routes");
 
+  // resizing keeps the content of the routes, so their versions stay valid
   for (i_t i = 0; i < n_routes; ++i) {
-    auto& route_i = get_route(i);
+    auto& route_i = routes[route_id_to_idx[i]];
     if (route_i.max_nodes_per_route() < new_size) {
       route_i.resize(new_size);
-      const auto route_view = get_route(i).view();
+      const auto route_view = route_i.view();
       routes_view.set_element_async(i, route_view, sol_handle->get_stream());
     }
   }
@@ -511,9 +559,11 @@ void solution_t<i_t, f_t, REQUEST>::copy_device_solution(solution_t<i_t, f_t, RE
 
   if (!src_sol.n_routes) { return; }
   check_and_allocate_routes(src_sol.n_routes);
+  update_route_versions();
+  src_sol.update_route_versions();
 
   for (i_t i = n_routes; i < src_sol.n_routes; ++i) {
-    const auto route_view = get_route(i).view();
+    const auto route_view = routes[route_id_to_idx[i]].view();
     routes_view.set_element_async(i, route_view, sol_handle->get_stream());
   }
 
@@ -523,8 +573,9 @@ void solution_t<i_t, f_t, REQUEST>::copy_device_solution(solution_t<i_t, f_t, RE
   resize_routes(common_max_size);
   const i_t TPB       = 256;
   const auto n_blocks = n_routes;
-  copy_routes<i_t, f_t, REQUEST>
-    <<<n_blocks, TPB, 0, sol_handle->get_stream()>>>(view(), src_sol.view());
+  // only the routes whose version differs are copied
+  copy_routes<i_t, f_t, REQUEST><<<n_blocks, TPB, 0, sol_handle->get_stream()>>>(
+    view(), src_sol.view(), route_versions.data(), src_sol.route_versions.data());
   RAFT_CHECK_CUDA(sol_handle->get_stream());
 
   cuopt_assert(route_node_map.intra_route_idx_per_node.size() == (size_t)get_num_orders(),
@@ -549,7 +600,6 @@ void solution_t<i_t, f_t, REQUEST>::copy_device_solution(solution_t<i_t, f_t, RE
              sol_handle->get_stream());
   raft::copy(
     n_infeasible_routes.data(), src_sol.n_infeasible_routes.data(), 1, sol_handle->get_stream());
-  unset_routes_to_copy();
   sol_handle->sync_stream();
   RAFT_CHECK_CUDA(sol_handle->get_stream());
 }
@@ -590,6 +640,8 @@ void solution_t<i_t, f_t, REQUEST>::shift_move_routes(
 
 {
   raft::common::nvtx::range fun_scope("shift_move_routes");
+  // the routes after the first removed one change ids
+  routes_modified_on_host = true;
   // shift and swap route slots
   i_t remove_counter = 0;
   // this is not super efficient but not significant
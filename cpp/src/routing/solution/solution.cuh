@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -327,7 +327,9 @@ class solution_t {
       route_node_map(problem_.get_num_orders(), sol_handle_->get_stream()),
       routes_to_copy(problem_.get_fleet_size(), sol_handle->get_stream()),
       routes_to_search(problem_.get_fleet_size(), sol_handle->get_stream()),
-      runtime_check_histo(problem_.get_num_orders(), sol_handle->get_stream()),
+      route_versions(problem_.get_fleet_size(), sol_handle->get_stream()),
+      runtime_check_histo(cuopt_checked_build ? problem_.get_num_orders() : 0,
+                          sol_handle->get_stream()),
       // TODO populate fleet info or directly get it from the main solver class
       // even though fleet info is created with the main sol_handle_->get_stream() this will be only
       // constructed once and not copied back and forth, so it is not an issue to pass handle it
@@ -397,7 +399,7 @@ class solution_t {
 
   // Solution only containing information modified during ges loop (route)
   // To be able to restore the state if we need to leave the loop early
-  // TODO get rid of copy constructor
+  // Prefer copy_device_solution into an existing solution, it only copies the modified routes
 
   solution_t(const solution_t& sol)
     : sol_found(sol.sol_found),
@@ -408,6 +410,7 @@ class solution_t {
       route_node_map(sol.route_node_map, sol.sol_handle->get_stream()),
       routes_to_copy(sol.routes_to_copy, sol.sol_handle->get_stream()),
       routes_to_search(sol.routes_to_copy, sol.sol_handle->get_stream()),
+      route_versions(sol.route_versions, sol.sol_handle->get_stream()),
       runtime_check_histo(sol.runtime_check_histo, sol.sol_handle->get_stream()),
       objective_cost(sol.objective_cost, sol.sol_handle->get_stream()),
       infeasibility_cost(sol.infeasibility_cost, sol.sol_handle->get_stream()),
@@ -447,11 +450,16 @@ class solution_t {
     copy_device_solution(const_cast<solution_t&>(sol));
   }
 
+  // the device buffers are moved, the route views stay valid
+  solution_t(solution_t&& sol) = default;
+
   // forward decleration, definition is in different files
   void print() const;
   void copy_device_solution(solution_t<i_t, f_t, REQUEST>& src_sol);
   i_t get_max_route_size() const { return max_nodes_per_route; }
   void set_initial_nodes(const rmm::device_uvector<i_t>& d_indices, i_t desired_n_routes);
+  // Orders the request indices by decreasing randomized seed score, far requests first
+  void sort_requests_by_seed_score(rmm::device_uvector<i_t>& d_indices);
   void set_nodes_data_of_solution();
   void set_nodes_data_of_route(i_t route_id);
   void set_nodes_data_of_new_routes(i_t added_routes, i_t prev_route_size);
@@ -515,11 +523,15 @@ class solution_t {
   void resize_routes(i_t new_size);
   void unset_routes_to_copy();
   void set_routes_to_copy();
+  // gives a new version to the routes modified since the last call
+  void update_route_versions();
   // for now, the default for routes to search will be all, as it is used in GES and other places
   // too routes to search will only explicity used for routes that should not be searched this will
   // be managed within the LS and adapted_solution interface functions
   void unset_routes_to_search();
   void set_routes_to_search();
+  // the device copy leaves the routes to search out, the copies of an offspring need them
+  void copy_routes_to_search(const solution_t<i_t, f_t, REQUEST>& src_sol);
   i_t get_max_active_nodes_for_all_routes() const;
   i_t get_num_orders() const noexcept;
 
@@ -690,7 +702,12 @@ class solution_t {
   rmm::device_uvector<i_t> routes_to_copy;
   // routes that will be searched
   rmm::device_uvector<i_t> routes_to_search;
-  // histogram for global runtime checks
+  // version of the content of every route. The routes with the same version in two solutions are
+  // identical, copy_device_solution skips them
+  rmm::device_uvector<uint64_t> route_versions;
+  // the routes may have been modified through host accessors, all of them get a new version
+  bool routes_modified_on_host{true};
+  // histogram for global runtime checks, empty when they are compiled out
   rmm::device_uvector<i_t> runtime_check_histo;
   // Inital number of routes
   i_t max_nodes_per_route = base_route_size;
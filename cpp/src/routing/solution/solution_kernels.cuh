@@ -386,11 +386,16 @@ __global__ void shift_routes_kernel(typename solution_t<i_t, f_t, REQUEST>::view
 
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void copy_routes(typename solution_t<i_t, f_t, REQUEST>::view_t dst_sol,
-                            const typename solution_t<i_t, f_t, REQUEST>::view_t src_sol)
+                            const typename solution_t<i_t, f_t, REQUEST>::view_t src_sol,
+                            uint64_t* dst_versions,
+                            const uint64_t* src_versions)
 {
   const auto route_id = blockIdx.x;
-  const auto n_nodes  = src_sol.routes[route_id].get_num_nodes();
-  if (n_nodes > 0) { dst_sol.routes[route_id].copy_from(src_sol.routes[route_id]); }
+  const auto n_nodes = src_sol.routes[route_id].get_num_nodes();
+  if (n_nodes == 0 || dst_versions[route_id] == src_versions[route_id]) { return; }
+  dst_sol.routes[route_id].copy_from(src_sol.routes[route_id]);
+  __syncthreads();
+  if (threadIdx.x == 0) { dst_versions[route_id] = src_versions[route_id]; }
 }
 
 template <typename i_t, typename f_t, request_t REQUEST>
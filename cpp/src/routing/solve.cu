@@ -1,14 +1,26 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #include <cuopt/routing/solve.hpp>
+#include <routing/decomposition.hpp>
 #include <routing/solver.hpp>
+#include <utilities/instrumentation.hpp>
 #include <utilities/logger.hpp>
 
+#include <raft/core/handle.hpp>
+#include <raft/util/cudart_utils.hpp>
+
+#include <rmm/cuda_stream_pool.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <optional>
+
 namespace cuopt {
 namespace routing {
 template <typename i_t, typename f_t>
@@ -16,6 +28,10 @@ assignment_t<i_t> solve(data_model_view_t<i_t, f_t> const& data_model,
                         solver_settings_t<i_t, f_t> const& settings)
 {
   try {
+    solver_counters_scope_t counters_scope;
+    if (detail::is_decomposable(data_model, settings)) {
+      return detail::solve_decomposed(data_model, settings);
+    }
     cuopt::routing::solver_t<i_t, f_t> solver(data_model, settings);
     return solver.solve();
   } catch (const cuopt::logic_error& e) {
@@ -29,7 +45,64 @@ assignment_t<i_t> solve(data_model_view_t<i_t, f_t> const& data_model,
   }
 }
 
+template <typename i_t, typename f_t>
+std::vector<assignment_t<i_t>> batch_solve(
+  std::vector<data_model_view_t<i_t, f_t>*> const& data_models,
+  solver_settings_t<i_t, f_t> const& settings)
+{
+  const std::size_t size = data_models.size();
+  if (size == 0) { return {}; }
+  std::vector<std::optional<assignment_t<i_t>>> solutions(size);
+
+  const int max_thread = std::min(static_cast<int>(size), omp_get_max_threads());
+  rmm::cuda_stream_pool stream_pool(size, rmm::cuda_stream::flags::non_blocking);
+
+  int device_id = raft::resource::get_device_id(*(data_models[0]->get_handle_ptr()));
+
+#pragma omp parallel for num_threads(max_thread)
+  for (std::size_t i = 0; i < size; ++i) {
+    // Required in multi-GPU environments to set the device for each thread
+    RAFT_CUDA_TRY(cudaSetDevice(device_id));
+
+    auto handle_ptr = data_models[i]->get_handle_ptr();
+    auto old_stream = handle_ptr->get_stream();
+    // Make sure previous operations are finished
+    handle_ptr->sync_stream();
+
+    // Set new non blocking stream for current data model
+    raft::resource::set_cuda_stream(*handle_ptr, stream_pool.get_stream(i));
+    auto solution = solve(*data_models[i], settings);
+
+    // Make sure current solve is finished
+    stream_pool.get_stream(i).synchronize();
+
+    // Reassociate the buffers with the original stream so they outlive the pool streams
+    solution.get_route().set_stream(old_stream);
+    solution.get_order_locations().set_stream(old_stream);
+    solution.get_arrival_stamp().set_stream(old_stream);
+    solution.get_truck_id().set_stream(old_stream);
+    solution.get_node_types().set_stream(old_stream);
+    solution.get_unserviced_nodes().set_stream(old_stream);
+    solution.get_accepted().set_stream(old_stream);
+    solutions[i].emplace(std::move(solution));
+
+    // Restore the old stream
+    raft::resource::set_cuda_stream(*handle_ptr, old_stream);
+    old_stream.synchronize();
+  }
+
+  std::vector<assignment_t<i_t>> ret;
+  ret.reserve(size);
+  for (auto& solution : solutions) {
+    ret.push_back(std::move(*solution));
+  }
+  return ret;
+}
+
 template assignment_t<int> solve(data_model_view_t<int, float> const& data_model,
                                  solver_settings_t<int, float> const& settings);
+template std::vector<assignment_t<int>> batch_solve(
+  std::vector<data_model_view_t<int, float>*> const& data_models,
+  solver_settings_t<int, float> const& settings);
 }  // namespace routing
 }  // namespace cuopt
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,6 +8,7 @@
 #include <utilities/vector_helpers.cuh>
 #include "routing/fleet_order_info.hpp"
 #include "routing/ges_solver.cuh"
+#include "routing/local_search/host_local_search.hpp"
 #include "routing/solver.hpp"
 #include "routing/utilities/cuopt_utils.cuh"
 #include "routing/utilities/env_utils.hpp"
@@ -17,6 +18,7 @@
 #include <routing/utilities/check_input.hpp>
 #include <utilities/copy_helpers.hpp>
 #include <utilities/high_res_timer.hpp>
+#include <utilities/logger.hpp>
 #include <utilities/vector_helpers.cuh>
 
 #include <raft/util/cudart_utils.hpp>
@@ -31,9 +33,14 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
+#include <algorithm>
 #include <chrono>
+#include <exception>
 #include <limits>
 #include <numeric>
+#include <optional>
+#include <thread>
+#include <utility>
 
 namespace cuopt {
 namespace routing {
@@ -76,6 +83,60 @@ assignment_t<i_t> solver_t<i_t, f_t>::solve()
   return run_ges_solver<request_t::VRP>(target_vehicles);
 }
 
+// Devices other than the current one that can read its memory, at most num_gpus - 1 of them
+static std::vector<int> get_island_devices(int num_gpus)
+{
+  std::vector<int> devices;
+  if (num_gpus <= 1) { return devices; }
+  int current_device = 0;
+  int device_count   = 0;
+  RAFT_CUDA_TRY(cudaGetDevice(&current_device));
+  RAFT_CUDA_TRY(cudaGetDeviceCount(&device_count));
+  for (int device = 0; device < device_count && (int)devices.size() < num_gpus - 1; ++device) {
+    if (device == current_device) { continue; }
+    int can_access = 0;
+    RAFT_CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, device, current_device));
+    if (can_access) { devices.push_back(device); }
+  }
+  return devices;
+}
+
+// Improves the best solutions published by the other islands with the host local search, until
+// the time limit or until the first island stops
+template <typename i_t, typename f_t, request_t REQUEST>
+static void run_host_island(const detail::problem_t<i_t, f_t>& problem,
+                            island_exchange_t& island_exchange,
+                            int island_id,
+                            double time_limit)
+{
+  constexpr double round_time = 1.;
+  detail::host_local_search_t<i_t, f_t, REQUEST> host_search(&problem);
+  timer_t timer(time_limit);
+  std::vector<int> seen_versions;
+  island_exchange_t::migrant_t current;
+  bool local_optimum = true;
+  while (!timer.check_time_limit() && !island_exchange.stop_requested()) {
+    for (auto& migrant : island_exchange.fetch(island_id, seen_versions)) {
+      if (migrant.routes.empty()) { continue; }
+      host_search.evaluate(migrant);
+      if (current.routes.empty() || migrant.is_better_than(current)) {
+        current       = std::move(migrant);
+        local_optimum = false;
+      }
+    }
+    if (local_optimum) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+    // short rounds so that a stop request is seen quickly
+    timer_t round_timer(std::min(round_time, timer.remaining_time()));
+    if (host_search.improve(current, round_timer)) {
+      island_exchange.publish(island_id, current);
+    }
+    local_optimum = !round_timer.check_time_limit();
+  }
+}
+
 template <typename i_t, typename f_t>
 template <request_t REQUEST>
 assignment_t<i_t> solver_t<i_t, f_t>::run_ges_solver(i_t target_vehicles)
@@ -85,9 +146,82 @@ assignment_t<i_t> solver_t<i_t, f_t>::run_ges_solver(i_t target_vehicles)
                                     (double)settings_.time_limit_,
                                     target_vehicles,
                                     &best_result_file_};
-  auto a = s.compute_ges_solution(settings_.best_result_file_name_);
+
+  // The other islands solve a copy of the model on their own device, reading its arrays through
+  // peer access. They only publish their solutions, the first island returns the best of all
+  auto island_devices = get_island_devices(settings_.get_num_gpus());
+  // The host islands improve the solutions of the device islands with a host local search
+  using host_search_t = detail::host_local_search_t<i_t, f_t, REQUEST>;
+  const int n_host_islands =
+    host_search_t::is_supported(s.problem) ? settings_.get_num_cpu_threads() : 0;
+  island_exchange_t island_exchange(island_devices.size() + n_host_islands + 1);
+  std::vector<std::thread> island_threads;
+  int current_device = 0;
+  RAFT_CUDA_TRY(cudaGetDevice(&current_device));
+  for (size_t i = 0; i < island_devices.size(); ++i) {
+    island_threads.emplace_back([&, island_id = (i_t)i + 1, device = island_devices[i]]() {
+      try {
+        RAFT_CUDA_TRY(cudaSetDevice(device));
+        auto status = cudaDeviceEnablePeerAccess(current_device, 0);
+        if (status == cudaErrorPeerAccessAlreadyEnabled) { cudaGetLastError(); }
+        raft::handle_t handle;
+        auto island_data_model = *data_view_ptr_;
+        island_data_model.set_handle_ptr(&handle);
+        ges_solver_t<i_t, f_t, REQUEST> island{island_data_model,
+                                               *solver_settings_ptr_,
+                                               (double)settings_.time_limit_,
+                                               target_vehicles};
+        island.island_exchange = &island_exchange;
+        island.island_id       = island_id;
+        island.compute_ges_solution();
+      } catch (const std::exception& e) {
+        CUOPT_LOG_ERROR("Error in island %d: %s", island_id, e.what());
+      }
+      island_exchange.finish();
+    });
+  }
+  for (int i = 0; i < n_host_islands; ++i) {
+    island_threads.emplace_back([&, island_id = (int)island_devices.size() + i + 1]() {
+      try {
+        run_host_island<i_t, f_t, REQUEST>(
+          s.problem, island_exchange, island_id, (double)settings_.time_limit_);
+      } catch (const std::exception& e) {
+        CUOPT_LOG_ERROR("Error in host island %d: %s", island_id, e.what());
+      }
+      island_exchange.finish();
+    });
+  }
+  if (!island_threads.empty()) { s.island_exchange = &island_exchange; }
+  s.n_final_elites = n_final_elites;
+
+  // The best solutions are handed to the callback and to the best results file from a background
+  // thread, so that the search does not wait for them
+  std::optional<incumbent_stream_t> incumbent_stream;
+  if (settings_.get_incumbent_callback() || settings_.dump_best_results_) {
+    incumbent_stream.emplace(settings_.get_incumbent_callback(),
+                             settings_.dump_best_results_ ? &best_result_file_ : nullptr,
+                             (double)settings_.dump_interval_);
+    s.incumbent_stream = &incumbent_stream.value();
+  }
+
+  std::optional<assignment_t<i_t>> a;
+  std::exception_ptr error;
+  try {
+    // the best results file belongs to the incumbent stream, the diversity manager prints to stdout
+    a.emplace(s.compute_ges_solution());
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (auto& thread : island_threads) {
+    thread.join();
+  }
+  // handles the last solutions before the file is closed
+  incumbent_stream.reset();
+  if (error) { std::rethrow_exception(error); }
+  a->set_setup_times(s.problem.setup_times);
+  final_elites = std::move(s.final_elites);
   if (settings_.dump_best_results_) { best_result_file_.close(); }
-  return a;
+  return std::move(a.value());
 }
 
 template class solver_t<int, float>;
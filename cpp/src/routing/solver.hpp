@@ -11,6 +11,7 @@
 #include <cuopt/routing/data_model_view.hpp>
 #include <cuopt/routing/solver_settings.hpp>
 
+#include <routing/diversity/island_exchange.hpp>
 #include <routing/fleet_info.hpp>
 #include <routing/hyper_params.hpp>
 #include <routing/order_info.hpp>
@@ -56,6 +57,10 @@ class solver_t {
    */
   assignment_t<i_t> solve();
 
+  // When positive, the best solutions found by solve are kept in final_elites
+  i_t n_final_elites{0};
+  std::vector<island_exchange_t::migrant_t> final_elites;
+
  protected:
   template <request_t REQUEST>
   assignment_t<i_t> run_ges_solver(i_t target_vehicles);
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -37,6 +37,44 @@ void solver_settings_t<i_t, f_t>::dump_best_results(const std::string& file_path
   best_result_file_name_ = file_path;
 }
 
+template <typename i_t, typename f_t>
+void solver_settings_t<i_t, f_t>::set_incumbent_callback(
+  std::function<void(const host_assignment_t<i_t>&, double)> callback)
+{
+  incumbent_callback_ = std::move(callback);
+}
+
+template <typename i_t, typename f_t>
+void solver_settings_t<i_t, f_t>::set_half_precision_matrices(bool half_precision)
+{
+  half_precision_matrices_ = half_precision;
+}
+
+template <typename i_t, typename f_t>
+void solver_settings_t<i_t, f_t>::set_num_gpus(i_t num_gpus)
+{
+  cuopt_expects(num_gpus > 0, error_type_t::ValidationError, "Number of GPUs must be positive");
+  num_gpus_ = num_gpus;
+}
+
+template <typename i_t, typename f_t>
+void solver_settings_t<i_t, f_t>::set_num_cpu_threads(i_t num_cpu_threads)
+{
+  cuopt_expects(num_cpu_threads >= 0,
+                error_type_t::ValidationError,
+                "Number of CPU threads must be non-negative");
+  num_cpu_threads_ = num_cpu_threads;
+}
+
+template <typename i_t, typename f_t>
+void solver_settings_t<i_t, f_t>::set_decomposition_cluster_size(i_t cluster_size)
+{
+  cuopt_expects(cluster_size >= 0,
+                error_type_t::ValidationError,
+                "Decomposition cluster size must be non-negative");
+  decomposition_cluster_size_ = cluster_size;
+}
+
 template <typename i_t, typename f_t>
 f_t solver_settings_t<i_t, f_t>::get_time_limit() const noexcept
 {
@@ -55,6 +93,30 @@ bool solver_settings_t<i_t, f_t>::get_error_logging_mode() const noexcept
   return log_errors_;
 }
 
+template <typename i_t, typename f_t>
+bool solver_settings_t<i_t, f_t>::get_half_precision_matrices() const noexcept
+{
+  return half_precision_matrices_;
+}
+
+template <typename i_t, typename f_t>
+i_t solver_settings_t<i_t, f_t>::get_num_gpus() const noexcept
+{
+  return num_gpus_;
+}
+
+template <typename i_t, typename f_t>
+i_t solver_settings_t<i_t, f_t>::get_num_cpu_threads() const noexcept
+{
+  return num_cpu_threads_;
+}
+
+template <typename i_t, typename f_t>
+i_t solver_settings_t<i_t, f_t>::get_decomposition_cluster_size() const noexcept
+{
+  return decomposition_cluster_size_;
+}
+
 template <typename i_t, typename f_t>
 std::tuple<i_t, bool, std::string> solver_settings_t<i_t, f_t>::get_dump_best_results()
   const noexcept
@@ -62,6 +124,13 @@ std::tuple<i_t, bool, std::string> solver_settings_t<i_t, f_t>::get_dump_best_re
   return std::make_tuple(dump_interval_, dump_best_results_, best_result_file_name_);
 }
 
+template <typename i_t, typename f_t>
+const std::function<void(const host_assignment_t<i_t>&, double)>&
+solver_settings_t<i_t, f_t>::get_incumbent_callback() const noexcept
+{
+  return incumbent_callback_;
+}
+
 template class solver_settings_t<int, float>;
 }  // namespace routing
 }  // namespace cuopt
@@ -29,6 +29,49 @@ __global__ void compute_backward_forward_kernel(
   }
 }
 
+// the route is staged in shared memory by the whole block, every field array of a dimension is
+// read with consecutive threads on consecutive nodes. The sequential scan of the first thread then
+// only touches shared memory, and the direction it computed is written back by the whole block
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void compute_backward_forward_shared_kernel(
+  raft::device_span<typename route_t<i_t, f_t, REQUEST>::view_t> routes)
+{
+  extern __shared__ i_t shmem[];
+  const i_t route_id   = blockIdx.x / 2;
+  auto curr_route      = routes[route_id];
+  bool compute_forward = (blockIdx.x % 2) == 0;
+  const i_t n_nodes    = curr_route.get_num_nodes();
+
+  auto s_route =
+    route_t<i_t, f_t, REQUEST>::view_t::create_shared_route(shmem, curr_route, n_nodes);
+  __syncthreads();
+  s_route.copy_fixed_route_data(curr_route, 0, n_nodes + 1, 0);
+  if (compute_forward) {
+    s_route.copy_forward_data(curr_route, 0, n_nodes + 1, 0);
+  } else {
+    s_route.copy_backward_data(curr_route, 0, n_nodes + 1, 0);
+  }
+  __syncthreads();
+
+  if (threadIdx.x == 0) {
+    if (compute_forward) {
+      route_t<i_t, f_t, REQUEST>::view_t::compute_forward(s_route);
+      s_route.compute_cost();
+    } else {
+      route_t<i_t, f_t, REQUEST>::view_t::compute_backward(s_route);
+    }
+  }
+  __syncthreads();
+
+  if (compute_forward) {
+    curr_route.copy_forward_data(s_route, 0, n_nodes + 1, 0);
+    block_copy(curr_route.infeasibility_cost, s_route.infeasibility_cost, 1);
+    block_copy(curr_route.objective_cost, s_route.objective_cost, 1);
+  } else {
+    curr_route.copy_backward_data(s_route, 0, n_nodes + 1, 0);
+  }
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void compute_actual_arrival_kernel(
   raft::device_span<typename route_t<i_t, f_t, REQUEST>::view_t> routes)
@@ -43,10 +86,20 @@ template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::compute_backward_forward()
 {
   raft::common::nvtx::range fun_scope("compute_backward_forward");
-  constexpr i_t TPB = 32;
+  // the data of every route is recomputed, the copies of every route are not up to date anymore
+  routes_modified_on_host = true;
+  constexpr i_t TPB       = 32;
   if (n_routes) {
-    compute_backward_forward_kernel<i_t, f_t, REQUEST>
-      <<<n_routes * 2, TPB, 0, sol_handle->get_stream()>>>(view().routes);
+    compute_max_active();
+    size_t sh_size = get_temp_route_shared_size();
+    // long routes that do not fit in shared memory are scanned in place
+    if (set_shmem_of_kernel(compute_backward_forward_shared_kernel<i_t, f_t, REQUEST>, sh_size)) {
+      compute_backward_forward_shared_kernel<i_t, f_t, REQUEST>
+        <<<n_routes * 2, TPB, sh_size, sol_handle->get_stream()>>>(view().routes);
+    } else {
+      compute_backward_forward_kernel<i_t, f_t, REQUEST>
+        <<<n_routes * 2, TPB, 0, sol_handle->get_stream()>>>(view().routes);
+    }
     sol_handle->sync_stream();
   }
 }
@@ -55,7 +108,9 @@ template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::compute_actual_arrival_times()
 {
   raft::common::nvtx::range fun_scope("compute_backward_forward");
-  constexpr i_t TPB = 32;
+  // the data of every route is recomputed, the copies of every route are not up to date anymore
+  routes_modified_on_host = true;
+  constexpr i_t TPB       = 32;
   if (n_routes && problem_ptr->dimensions_info.has_dimension(dim_t::TIME))
     compute_actual_arrival_kernel<i_t, f_t, REQUEST>
       <<<n_routes, TPB, 0, sol_handle->get_stream()>>>(view().routes);
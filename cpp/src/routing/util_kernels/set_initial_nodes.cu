@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,6 +8,11 @@
 #include "../solution/solution.cuh"
 #include "set_nodes_data.cuh"
 
+#include <utilities/copy_helpers.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+
 namespace cuopt {
 namespace routing {
 namespace detail {
@@ -183,6 +188,53 @@ __global__ void set_initial_nodes_kernel(typename solution_t<i_t, f_t, REQUEST>:
   }
 }
 
+// Scores each request as a route seed: the length of the round trip from the depot that serves it
+// alone, scaled by a random factor in [0.5, 1.5). Far requests are the hardest to insert in an
+// existing route, seeding routes with them gives the insertion phase compact routes to grow
+// around, as in the sequential savings and Solomon constructions. The random factor makes each
+// island start from a different set of seeds.
+template <typename i_t, typename f_t, request_t REQUEST>
+__global__ void compute_seed_scores_kernel(typename solution_t<i_t, f_t, REQUEST>::view_t solution,
+                                           const typename problem_t<i_t, f_t>::view_t problem,
+                                           raft::device_span<f_t> scores,
+                                           int64_t seed)
+{
+  auto th = threadIdx.x + blockIdx.x * blockDim.x;
+  if (th >= scores.size()) { return; }
+  auto thread_rng = make_worker_rng(seed, th, solution.solution_id);
+  const f_t noise = 0.5 + (thread_rng.next_u32() % 1024) / 1024.;
+
+  const auto& order_info = problem.order_info;
+  auto vehicle_id        = solution.routes[0].get_vehicle_id();
+  auto vehicle_info      = problem.fleet_info.get_vehicle_info(vehicle_id);
+  auto start_depot_info  = problem.get_start_depot_node_info(vehicle_id);
+  auto return_depot_info = problem.get_return_depot_node_info(vehicle_id);
+
+  auto request = solution.get_request(th);
+  NodeInfo<i_t> first_info, last_info;
+  if constexpr (REQUEST == request_t::PDP) {
+    first_info = NodeInfo<i_t>(
+      request.pickup, order_info.get_order_location(request.pickup), node_type_t::PICKUP);
+    last_info = NodeInfo<i_t>(
+      request.delivery, order_info.get_order_location(request.delivery), node_type_t::DELIVERY);
+  } else {
+    first_info = NodeInfo<i_t>(
+      request.id(), order_info.get_order_location(request.id()), node_type_t::DELIVERY);
+    last_info = first_info;
+  }
+
+  double round_trip = 1.;
+  if (problem.dimensions_info.has_dimension(dim_t::DIST)) {
+    round_trip =
+      get_arc_of_dimension<i_t, f_t, dim_t::DIST>(start_depot_info, first_info, vehicle_info) +
+      get_arc_of_dimension<i_t, f_t, dim_t::DIST>(last_info, return_depot_info, vehicle_info);
+  } else if (problem.dimensions_info.has_dimension(dim_t::TIME)) {
+    round_trip = get_transit_time(start_depot_info, first_info, vehicle_info, true) +
+                 get_transit_time(last_info, return_depot_info, vehicle_info, true);
+  }
+  scores[th] = round_trip * noise;
+}
+
 // sets the node data of the route that has the node_ids
 template <typename i_t, typename f_t, request_t REQUEST>
 __global__ void set_nodes_data_of_route_kernel(
@@ -217,6 +269,7 @@ template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::set_initial_nodes(const rmm::device_uvector<i_t>& d_indices,
                                                       i_t desired_n_routes)
 {
+  routes_modified_on_host = true;
   thrust::fill(sol_handle->get_thrust_policy(),
                route_node_map.route_id_per_node.begin(),
                route_node_map.route_id_per_node.end(),
@@ -233,9 +286,28 @@ void solution_t<i_t, f_t, REQUEST>::set_initial_nodes(const rmm::device_uvector<
   sol_handle->get_stream().synchronize();
 }
 
+template <typename i_t, typename f_t, request_t REQUEST>
+void solution_t<i_t, f_t, REQUEST>::sort_requests_by_seed_score(rmm::device_uvector<i_t>& d_indices)
+{
+  auto stream = sol_handle->get_stream();
+  rmm::device_uvector<f_t> scores(d_indices.size(), stream);
+  constexpr i_t TPB = 128;
+  i_t n_blocks      = (d_indices.size() + TPB - 1) / TPB;
+  compute_seed_scores_kernel<i_t, f_t, REQUEST><<<n_blocks, TPB, 0, stream>>>(
+    view(), problem_ptr->view(), cuopt::make_span(scores), seed_generator::get_seed());
+  RAFT_CHECK_CUDA(stream);
+  thrust::sequence(sol_handle->get_thrust_policy(), d_indices.begin(), d_indices.end());
+  thrust::sort_by_key(sol_handle->get_thrust_policy(),
+                      scores.begin(),
+                      scores.end(),
+                      d_indices.begin(),
+                      thrust::greater<f_t>());
+}
+
 template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::set_nodes_data_of_solution()
 {
+  routes_modified_on_host = true;
   constexpr i_t TPB = 32;
   i_t n_blocks      = n_routes;
   set_nodes_data_of_solution_kernel<i_t, f_t, REQUEST>
@@ -245,6 +317,7 @@ void solution_t<i_t, f_t, REQUEST>::set_nodes_data_of_solution()
 template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::set_nodes_data_of_route(i_t route_id)
 {
+  routes_modified_on_host = true;
   constexpr i_t TPB = 32;
   set_nodes_data_of_route_kernel<i_t, f_t, REQUEST>
     <<<1, TPB, 0, sol_handle->get_stream()>>>(view(), problem_ptr->view(), route_id);
@@ -254,6 +327,7 @@ template <typename i_t, typename f_t, request_t REQUEST>
 void solution_t<i_t, f_t, REQUEST>::set_nodes_data_of_new_routes(i_t added_routes,
                                                                  i_t prev_route_size)
 {
+  routes_modified_on_host = true;
   constexpr i_t TPB     = 32;
   i_t starting_route_id = prev_route_size;
   set_nodes_data_of_new_routes_kernel<i_t, f_t, REQUEST>
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -229,6 +229,38 @@ bool check_min_max_values(const T* ptr,
   return (min >= static_cast<T>(min_value)) && (max <= static_cast<T>(max_value));
 }
 
+/**
+ * @brief Checks that the bucket start times are strictly increasing and that the arrival time of
+ * every arc is non decreasing with the departure time
+ * @param matrices Transit times of each arc at the bucket start times, bucket minor
+ * @param bucket_start_times Departure times of the buckets
+ * @param n_arcs Number of arcs
+ * @param n_time_buckets Number of time buckets
+ * @param stream_view Stream view
+ */
+template <typename i_t, typename f_t>
+bool check_fifo_time_buckets(f_t const* matrices,
+                             f_t const* bucket_start_times,
+                             size_t n_arcs,
+                             i_t n_time_buckets,
+                             rmm::cuda_stream_view stream_view)
+{
+  if (n_time_buckets == 1) { return true; }
+  const size_t n_pairs = n_arcs * (n_time_buckets - 1);
+  return thrust::all_of(
+    rmm::exec_policy(stream_view),
+    thrust::make_counting_iterator<size_t>(0),
+    thrust::make_counting_iterator<size_t>(n_pairs),
+    [matrices, bucket_start_times, n_time_buckets] __device__(size_t idx) -> bool {
+      const size_t arc = idx / (n_time_buckets - 1);
+      const i_t bucket = idx % (n_time_buckets - 1);
+      const f_t start  = bucket_start_times[bucket];
+      const f_t end    = bucket_start_times[bucket + 1];
+      const f_t* times = matrices + arc * n_time_buckets;
+      return start < end && start + times[bucket] <= end + times[bucket + 1];
+    });
+}
+
 template <typename i_t>
 void check_guess(i_t const* guess_id,
                  i_t const* truck_id,
@@ -413,6 +445,12 @@ template bool check_min_max_values<double, double>(const double* ptr,
                                                    const double max_value,
                                                    rmm::cuda_stream_view stream_view);
 
+template bool check_fifo_time_buckets<int, float>(float const* matrices,
+                                                   float const* bucket_start_times,
+                                                   size_t n_arcs,
+                                                   int n_time_buckets,
+                                                   rmm::cuda_stream_view stream_view);
+
 template void transform_absolute<int>(rmm::device_uvector<int>& v,
                                       rmm::cuda_stream_view stream_view);
 
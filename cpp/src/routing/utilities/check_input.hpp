@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2021-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -39,6 +39,13 @@ bool check_min_max_values(const T* ptr,
                           const RefType max_value,
                           rmm::cuda_stream_view stream_view);
 
+template <typename i_t, typename f_t>
+bool check_fifo_time_buckets(f_t const* matrices,
+                             f_t const* bucket_start_times,
+                             size_t n_arcs,
+                             i_t n_time_buckets,
+                             rmm::cuda_stream_view stream_view);
+
 template <typename i_t>
 void check_guess(i_t const* guess_id,
                  i_t const* truck_id,
@@ -12,7 +12,6 @@
 #include <rmm/device_buffer.hpp>
 #include <routing/generator/generator.hpp>
 
-#include <omp.h>
 #include <chrono>
 
 namespace cuopt {
@@ -101,38 +100,15 @@ std::vector<std::unique_ptr<vehicle_routing_ret_t>> call_batch_solve(
   std::vector<routing::data_model_view_t<int, float>*> data_models,
   routing::solver_settings_t<int, float>* settings)
 {
-  const std::size_t size = data_models.size();
-  std::vector<std::unique_ptr<vehicle_routing_ret_t>> list(size);
+  auto solutions = cuopt::routing::batch_solve(data_models, *settings);
+  std::vector<std::unique_ptr<vehicle_routing_ret_t>> list(solutions.size());
 
-  // Use OpenMP for parallel execution
-  const int max_thread = std::min(static_cast<int>(size), omp_get_max_threads());
-  rmm::cuda_stream_pool stream_pool(size, rmm::cuda_stream::flags::non_blocking);
-
-  int device_id = raft::resource::get_device_id(*(data_models[0]->get_handle_ptr()));
-
-#pragma omp parallel for num_threads(max_thread)
-  for (std::size_t i = 0; i < size; ++i) {
-    // Required in multi-GPU environments to set the device for each thread
-    RAFT_CUDA_TRY(cudaSetDevice(device_id));
-
-    auto old_stream = data_models[i]->get_handle_ptr()->get_stream();
-    // Make sure previous operations are finished
-    data_models[i]->get_handle_ptr()->sync_stream();
-
-    // Set new non blocking stream for current data model
-    raft::resource::set_cuda_stream(*(data_models[i]->get_handle_ptr()), stream_pool.get_stream(i));
-    auto routing_solution = cuopt::routing::solve(*data_models[i], *settings);
-
-    // Make sure current solve is finished
-    stream_pool.get_stream(i).synchronize();
-
-    // Create buffers and reassociate them with the original stream so they
-    // outlive the local stream which will be destroyed at end of loop iteration
-    auto make_buffer = [old_stream = old_stream](rmm::device_buffer&& buf) {
-      buf.set_stream(old_stream);
-      return std::make_unique<rmm::device_buffer>(std::move(buf));
-    };
+  auto make_buffer = [](rmm::device_buffer&& buf) {
+    return std::make_unique<rmm::device_buffer>(std::move(buf));
+  };
 
+  for (std::size_t i = 0; i < solutions.size(); ++i) {
+    auto& routing_solution = solutions[i];
     vehicle_routing_ret_t vr_ret{routing_solution.get_vehicle_count(),
                                  routing_solution.get_total_objective(),
                                  routing_solution.get_objectives(),
@@ -148,10 +124,6 @@ std::vector<std::unique_ptr<vehicle_routing_ret_t>> call_batch_solve(
                                  routing_solution.get_error_status().get_error_type(),
                                  routing_solution.get_error_status().what()};
     list[i] = std::make_unique<vehicle_routing_ret_t>(std::move(vr_ret));
-
-    // Restore the old stream
-    raft::resource::set_cuda_stream(*(data_models[i]->get_handle_ptr()), old_stream);
-    old_stream.synchronize();
   }
 
   return list;
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -10,16 +10,46 @@
 #include <cuopt/error.hpp>
 #include <cuopt/routing/data_model_view.hpp>
 
+#include <cuda_fp16.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <utilities/copy_helpers.hpp>
 #include <utilities/macros.cuh>
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <vector>
 
 namespace cuopt {
 namespace routing {
 
+// Entries above this value are capped, they stand for arcs that cannot be used
+constexpr float max_matrix_value = 1.0e+30;
+// Largest magnitude of an entry once divided by the scale of its matrix in half precision
+constexpr float max_half_matrix_value = 60000.f;
+
+// Matrix of a vehicle type derived from a stored matrix, see add_scaled_matrices. The offset is
+// not added on the diagonal and the capped entries stay capped
+template <typename f_t>
+struct matrix_transform_t {
+  constexpr double apply(double value, size_t i, size_t j) const
+  {
+    if (value >= max_matrix_value) { return max_matrix_value; }
+    return i == j ? value * scale : value * scale + offset;
+  }
+
+  uint8_t slot;
+  f_t scale;
+  f_t offset;
+};
+
 template <typename f_t, size_t NCON_DIMS = 4>
 struct mdarray_view_t {
   constexpr auto get_vehicle_type_matrices(uint8_t vehicle_type) const
@@ -43,8 +73,99 @@ struct mdarray_view_t {
     return get_cost_matrix(vehicle_type, extent[1] - 1);
   }
 
+  constexpr bool is_half_precision() const { return half_buffer_ptr != nullptr; }
+
+  constexpr double get_value(uint8_t vehicle_type, uint8_t matrix_type, size_t i, size_t j) const
+  {
+    if (transforms == nullptr) { return get_stored_value(vehicle_type, matrix_type, i, j); }
+    const auto& transform = transforms[vehicle_type * extent[1] + matrix_type];
+    return transform.apply(get_stored_value(transform.slot, matrix_type, i, j), i, j);
+  }
+
+  constexpr double get_stored_value(uint8_t slot, uint8_t matrix_type, size_t i, size_t j) const
+  {
+    size_t matrix_id = slot * extent[1] + matrix_type;
+    size_t offset    = (matrix_id * extent[2] + i) * extent[3] + j;
+    if (!is_half_precision()) { return buffer_ptr[offset]; }
+    float value = __half2float(half_buffer_ptr[offset]);
+    // the capped entries are stored as infinity
+    if (value > 65504.f) { return max_matrix_value; }
+    return (double)value * scales[matrix_id];
+  }
+
+  constexpr double get_cost_value(uint8_t vehicle_type, size_t i, size_t j) const
+  {
+    return get_value(vehicle_type, 0, i, j);
+  }
+
+  constexpr double get_time_value(uint8_t vehicle_type, size_t i, size_t j) const
+  {
+    return get_value(vehicle_type, extent[1] - 1, i, j);
+  }
+
+  constexpr bool is_time_dependent() const { return n_time_buckets > 0; }
+
+  // Transit time from i to j when departing from i at the given time. The times at the bucket
+  // starts of an arc are contiguous so that an evaluation reads a single row of n_time_buckets
+  constexpr double get_time_value_at(uint8_t vehicle_type,
+                                     size_t i,
+                                     size_t j,
+                                     double departure) const
+  {
+    if (!is_time_dependent()) { return get_time_value(vehicle_type, i, j); }
+    auto times  = bucket_start_times + vehicle_type * n_time_buckets;
+    auto values = time_dependent_ptr + ((vehicle_type * extent[2] + i) * extent[3] + j) *
+                                         (size_t)n_time_buckets;
+    if (departure <= times[0]) { return values[0]; }
+    for (int b = 1; b < n_time_buckets; ++b) {
+      if (departure < times[b]) {
+        const double ratio = (departure - times[b - 1]) / (times[b] - times[b - 1]);
+        return values[b - 1] + ratio * (values[b] - values[b - 1]);
+      }
+    }
+    return values[n_time_buckets - 1];
+  }
+
+  // Transit time from i to j of the latest departure from i that arrives at j by the given time.
+  // The arrival time is non decreasing with the departure time, so the departure is found on the
+  // piece of the arrival times that contains the given arrival
+  constexpr double get_time_value_before(uint8_t vehicle_type,
+                                         size_t i,
+                                         size_t j,
+                                         double arrival) const
+  {
+    if (!is_time_dependent()) { return get_time_value(vehicle_type, i, j); }
+    auto times  = bucket_start_times + vehicle_type * n_time_buckets;
+    auto values = time_dependent_ptr + ((vehicle_type * extent[2] + i) * extent[3] + j) *
+                                         (size_t)n_time_buckets;
+    if (arrival < times[0] + values[0]) { return values[0]; }
+    for (int b = 1; b < n_time_buckets; ++b) {
+      const double arrival_start = times[b - 1] + values[b - 1];
+      const double arrival_end   = times[b] + values[b];
+      if (arrival < arrival_end) {
+        const double ratio     = (arrival - arrival_start) / (arrival_end - arrival_start);
+        const double departure = times[b - 1] + ratio * (times[b] - times[b - 1]);
+        return arrival - departure;
+      }
+    }
+    return values[n_time_buckets - 1];
+  }
+
   f_t const* buffer_ptr{nullptr};
-  // dim4(n_vehicle_types, n_matrix_types, n_loc, n_loc)
+  // set instead of buffer_ptr when the matrices are stored in half precision, an entry is then
+  // its half value times the scale of its matrix
+  half const* half_buffer_ptr{nullptr};
+  f_t const* scales{nullptr};
+  // time dependent transit times, dim4(n_vehicle_types, n_loc, n_loc, n_time_buckets), and the
+  // bucket start times of each vehicle type. The time matrix then holds the smallest transit time
+  // of each arc over the buckets
+  f_t const* time_dependent_ptr{nullptr};
+  f_t const* bucket_start_times{nullptr};
+  int n_time_buckets{0};
+  // dim2(n_vehicle_types, n_matrix_types) when some vehicle types have scaled matrices, the
+  // buffer then only holds the matrices of the stored slots
+  matrix_transform_t<f_t> const* transforms{nullptr};
+  // dim4(n_slots, n_matrix_types, n_loc, n_loc), a slot per vehicle type without transforms
   size_t extent[NCON_DIMS];
 };
 
@@ -84,6 +205,7 @@ struct h_mdarray_t {
   {
     mdarray_view_t<f_t> view;
     view.buffer_ptr = buffer.data();
+    if (!transforms.empty()) { view.transforms = transforms.data(); }
     for (size_t i = 0; i < NCON_DIMS; ++i) {
       view.extent[i] = extent[i];
     }
@@ -91,13 +213,29 @@ struct h_mdarray_t {
   }
   size_t extent[NCON_DIMS];
   std::vector<f_t> buffer;
+  std::vector<matrix_transform_t<f_t>> transforms;
 };
 
 template <typename f_t, size_t NCON_DIMS = 4>
 struct d_mdarray_t {
-  d_mdarray_t(rmm::cuda_stream_view stream_) : buffer(0, stream_), stream(stream_) {}
+  d_mdarray_t(rmm::cuda_stream_view stream_)
+    : buffer(0, stream_),
+      half_buffer(0, stream_),
+      scales(0, stream_),
+      time_dependent_buffer(0, stream_),
+      bucket_start_times(0, stream_),
+      transforms(0, stream_),
+      stream(stream_)
+  {
+  }
   d_mdarray_t(std::vector<size_t> const& extent_, rmm::cuda_stream_view stream_)
-    : buffer(0, stream_), stream(stream_)
+    : buffer(0, stream_),
+      half_buffer(0, stream_),
+      scales(0, stream_),
+      time_dependent_buffer(0, stream_),
+      bucket_start_times(0, stream_),
+      transforms(0, stream_),
+      stream(stream_)
   {
     cuopt_assert(extent_.size() == NCON_DIMS, "Wrong dimensions");
     size_t size = 1;
@@ -126,18 +264,105 @@ struct d_mdarray_t {
     return get_cost_matrix(vehicle_type, extent[1] - 1);
   }
 
+  void resize_time_dependent(int n_time_buckets_)
+  {
+    static_assert(NCON_DIMS == 4);
+    n_time_buckets = n_time_buckets_;
+    time_dependent_buffer.resize(extent[0] * extent[2] * extent[3] * n_time_buckets, stream);
+    bucket_start_times.resize(extent[0] * n_time_buckets, stream);
+  }
+
+  constexpr auto get_time_dependent_matrix(uint8_t vehicle_type)
+  {
+    return time_dependent_buffer.data() + vehicle_type * (extent[2] * extent[3] * n_time_buckets);
+  }
+
+  constexpr auto get_bucket_start_times(uint8_t vehicle_type)
+  {
+    return bucket_start_times.data() + vehicle_type * n_time_buckets;
+  }
+
   auto view() const
   {
     mdarray_view_t<f_t> view;
-    view.buffer_ptr = buffer.data();
+    if (is_half_precision()) {
+      view.half_buffer_ptr = half_buffer.data();
+      view.scales          = scales.data();
+    } else {
+      view.buffer_ptr = buffer.data();
+    }
+    if (n_time_buckets > 0) {
+      view.time_dependent_ptr = time_dependent_buffer.data();
+      view.bucket_start_times = bucket_start_times.data();
+      view.n_time_buckets     = n_time_buckets;
+    }
+    if (transforms.size() > 0) { view.transforms = transforms.data(); }
     for (size_t i = 0; i < NCON_DIMS; ++i) {
       view.extent[i] = extent[i];
     }
     return view;
   }
 
+  bool is_half_precision() const { return half_buffer.size() > 0; }
+
+  // Stores the matrices in half precision with a scale per matrix and releases the full precision
+  // buffer, so the pointers returned by get_cost_matrix are no longer valid. The cost matrices are
+  // rounded to nearest. The time matrices are rounded up, so the time windows satisfied with the
+  // stored times are satisfied with the exact ones
+  void to_half_precision()
+  {
+    static_assert(NCON_DIMS == 4);
+    if (buffer.size() == 0 || is_half_precision()) { return; }
+    const size_t matrix_size = extent[2] * extent[3];
+    const size_t n_matrices  = extent[0] * extent[1];
+    const bool has_time      = extent[1] > 1;
+    const size_t n_types     = extent[1];
+
+    std::vector<f_t> h_scales(n_matrices);
+    for (size_t m = 0; m < n_matrices; ++m) {
+      f_t max_abs = thrust::transform_reduce(
+        rmm::exec_policy(stream),
+        buffer.data() + m * matrix_size,
+        buffer.data() + (m + 1) * matrix_size,
+        [] __device__(f_t x) -> f_t { return x >= max_matrix_value ? f_t{0} : abs(x); },
+        f_t{0},
+        thrust::maximum<f_t>{});
+      h_scales[m] = max_abs > f_t{0} ? max_abs / max_half_matrix_value : f_t{1};
+    }
+    scales = cuopt::device_copy(h_scales, stream);
+
+    half_buffer.resize(buffer.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_t>(0),
+                      thrust::make_counting_iterator<size_t>(buffer.size()),
+                      half_buffer.begin(),
+                      [matrices    = buffer.data(),
+                       scales_ptr  = scales.data(),
+                       matrix_size = matrix_size,
+                       n_types     = n_types,
+                       has_time    = has_time] __device__(size_t idx) -> half {
+                        f_t value = matrices[idx];
+                        if (value >= max_matrix_value) {
+                          return __float2half_rn(std::numeric_limits<float>::infinity());
+                        }
+                        size_t matrix_id = idx / matrix_size;
+                        float scaled     = value / scales_ptr[matrix_id];
+                        bool is_time     = has_time && matrix_id % n_types == n_types - 1;
+                        return is_time ? __float2half_ru(scaled) : __float2half_rn(scaled);
+                      });
+    buffer.resize(0, stream);
+    buffer.shrink_to_fit(stream);
+  }
+
   size_t extent[NCON_DIMS];
   rmm::device_uvector<f_t> buffer;
+  rmm::device_uvector<half> half_buffer;
+  rmm::device_uvector<f_t> scales;
+  // kept in full precision, see mdarray_view_t
+  rmm::device_uvector<f_t> time_dependent_buffer;
+  rmm::device_uvector<f_t> bucket_start_times;
+  int n_time_buckets{0};
+  rmm::device_uvector<matrix_transform_t<f_t>> transforms;
   rmm::cuda_stream_view stream;
 };
 
@@ -147,7 +372,7 @@ template <typename i_t, typename f_t>
 bool limit_matrix_entries(f_t* matrix, i_t width, raft::handle_t const* handle_ptr)
 {
   i_t mat_size  = width * width;
-  f_t max_value = 1.0e+30;
+  f_t max_value = max_matrix_value;
 
   bool exceeds_max =
     thrust::any_of(handle_ptr->get_thrust_policy(),
@@ -221,14 +446,60 @@ inline auto get_unique_vehicle_types(const raft::device_span<uint8_t const>& veh
   return vehicle_types_map;
 }
 
+// Whether the matrices of a vehicle type are derived from the ones of another vehicle type
+template <typename i_t, typename f_t>
+bool has_scaled_matrices(data_model_view_t<i_t, f_t> const& data_model, uint8_t vehicle_type)
+{
+  return data_model.get_scaled_matrices().count(vehicle_type) &&
+         data_model.get_cost_matrix(vehicle_type) == nullptr &&
+         !data_model.get_candidate_cost_matrices().count(vehicle_type);
+}
+
+// Slot of the mdarray of every vehicle type whose matrices are stored: the vehicle types without
+// scaled matrices and the bases of the scaled ones. The slots are the renumbered vehicle types
+// when no vehicle type has scaled matrices
+template <typename i_t, typename f_t>
+auto get_matrix_slots(data_model_view_t<i_t, f_t> const& data_model)
+{
+  auto vehicle_types_map = get_unique_vehicle_types(data_model.get_vehicle_types(),
+                                                    data_model.get_handle_ptr()->get_stream());
+  bool has_scaled_types  = false;
+  std::map<uint8_t, uint8_t> slots;
+  for (auto& [old_type, new_type] : vehicle_types_map) {
+    has_scaled_types = has_scaled_types || has_scaled_matrices(data_model, old_type);
+  }
+  if (!has_scaled_types) { return vehicle_types_map; }
+
+  for (auto& [old_type, new_type] : vehicle_types_map) {
+    if (!has_scaled_matrices(data_model, old_type)) { slots.emplace(old_type, slots.size()); }
+  }
+  for (auto& [old_type, new_type] : vehicle_types_map) {
+    if (!has_scaled_matrices(data_model, old_type)) { continue; }
+    auto base_type = data_model.get_scaled_matrices().at(old_type).get_base_vehicle_type();
+    if (!slots.count(base_type)) { slots.emplace(base_type, slots.size()); }
+  }
+  return slots;
+}
+
 template <typename i_t, typename f_t>
 auto get_cost_matrix_type_dim(data_model_view_t<i_t, f_t> const& data_model)
 {
   auto n_matrix_types    = 1;
   auto vehicle_types_map = get_unique_vehicle_types(data_model.get_vehicle_types(),
                                                     data_model.get_handle_ptr()->get_stream());
+  // a time matrix is kept when the scaled transit times differ from the scaled costs
   for (auto& [old_type, new_type] : vehicle_types_map) {
-    if (data_model.get_transit_time_matrix(old_type)) {
+    if (!has_scaled_matrices(data_model, old_type)) { continue; }
+    const auto& scaled = data_model.get_scaled_matrices().at(old_type);
+    if (scaled.get_time_scale() != scaled.get_cost_scale() ||
+        scaled.get_time_offset() != scaled.get_cost_offset()) {
+      return n_matrix_types + 1;
+    }
+  }
+  for (auto& [old_type, slot] : get_matrix_slots(data_model)) {
+    if (data_model.get_transit_time_matrix(old_type) ||
+        data_model.get_candidate_transit_time_matrices().count(old_type) ||
+        data_model.get_time_dependent_transit_time_matrices().count(old_type)) {
       ++n_matrix_types;
       break;
     }
@@ -236,17 +507,114 @@ auto get_cost_matrix_type_dim(data_model_view_t<i_t, f_t> const& data_model)
   return n_matrix_types;
 }
 
+// Densifies a candidate matrix: the pairs of the candidate graph get their exact values, the
+// others the euclidean distance between the locations times the fallback factor
 template <typename i_t, typename f_t>
-std::tuple<float const*, float const*> get_vehicle_matrices(
-  data_model_view_t<i_t, f_t> const& data_model, uint8_t vehicle_type)
+void fill_matrix_from_candidates(f_t* matrix,
+                                 detail::candidate_matrix_t<i_t, f_t> const& candidates,
+                                 data_model_view_t<i_t, f_t> const& data_model)
 {
-  auto cost_matrix = data_model.get_cost_matrix(vehicle_type);
-  if (!cost_matrix)
-    cuopt_expects(
-      false, error_type_t::ValidationError, "Set vehicle types when using multiple matrices");
-  auto time_matrix = data_model.get_transit_time_matrix(vehicle_type);
-  if (!time_matrix) time_matrix = cost_matrix;
-  return std::make_tuple(cost_matrix, time_matrix);
+  auto [x_coordinates, y_coordinates] = data_model.get_location_coordinates();
+  cuopt_expects(x_coordinates != nullptr && y_coordinates != nullptr,
+                error_type_t::ValidationError,
+                "Location coordinates must be set when using candidate matrices");
+  size_t nlocations = data_model.get_num_locations();
+  auto fallback     = candidates.get_fallback_factor();
+  auto handle_ptr   = data_model.get_handle_ptr();
+  thrust::tabulate(handle_ptr->get_thrust_policy(),
+                   matrix,
+                   matrix + nlocations * nlocations,
+                   [x = x_coordinates, y = y_coordinates, nlocations, fallback] __device__(
+                     size_t idx) -> f_t {
+                     size_t i = idx / nlocations;
+                     size_t j = idx % nlocations;
+                     if (i == j) { return f_t{0}; }
+                     f_t diff_x = x[i] - x[j];
+                     f_t diff_y = y[i] - y[j];
+                     return fallback * sqrt(diff_x * diff_x + diff_y * diff_y);
+                   });
+  size_t n_neighbors = candidates.get_n_neighbors();
+  thrust::for_each(handle_ptr->get_thrust_policy(),
+                   thrust::make_counting_iterator<size_t>(0),
+                   thrust::make_counting_iterator<size_t>(nlocations * n_neighbors),
+                   [matrix,
+                    neighbors = candidates.get_neighbors(),
+                    values    = candidates.get_values(),
+                    nlocations,
+                    n_neighbors] __device__(size_t idx) {
+                     i_t j = neighbors[idx];
+                     if (j < 0 || j >= (i_t)nlocations) { return; }
+                     matrix[(idx / n_neighbors) * nlocations + j] = values[idx];
+                   });
+}
+
+// Fills the matrix of a vehicle type from the dense matrix if it is set, otherwise from the
+// candidate matrix. Returns false if neither is set
+template <typename i_t, typename f_t>
+bool fill_matrix_from_data_model(
+  f_t* matrix,
+  f_t const* dense_matrix,
+  std::unordered_map<uint8_t, detail::candidate_matrix_t<i_t, f_t>> const& candidate_matrices,
+  uint8_t vehicle_type,
+  data_model_view_t<i_t, f_t> const& data_model)
+{
+  auto nlocations = data_model.get_num_locations();
+  auto stream     = data_model.get_handle_ptr()->get_stream();
+  if (dense_matrix != nullptr) {
+    raft::copy(matrix, dense_matrix, nlocations * nlocations, stream);
+    return true;
+  }
+  if (candidate_matrices.count(vehicle_type)) {
+    fill_matrix_from_candidates(matrix, candidate_matrices.at(vehicle_type), data_model);
+    return true;
+  }
+  return false;
+}
+
+// Copies the time dependent transit times of a vehicle type and sets its time matrix to the
+// smallest transit time of each arc, so that the static evaluations are optimistic. The vehicle
+// types without time dependent times get their time matrix in every bucket
+template <typename i_t, typename f_t>
+void fill_time_dependent_matrix(d_mdarray_t<f_t>& matrices,
+                                data_model_view_t<i_t, f_t> const& data_model,
+                                uint8_t old_type,
+                                uint8_t new_type)
+{
+  auto handle_ptr        = data_model.get_handle_ptr();
+  auto stream            = handle_ptr->get_stream();
+  const size_t n_arcs    = matrices.extent[2] * matrices.extent[3];
+  const i_t n_buckets    = matrices.n_time_buckets;
+  auto time_matrix       = matrices.get_time_matrix(new_type);
+  auto td_matrix         = matrices.get_time_dependent_matrix(new_type);
+  auto bucket_start_time = matrices.get_bucket_start_times(new_type);
+
+  const auto& td_matrices = data_model.get_time_dependent_transit_time_matrices();
+  if (!td_matrices.count(old_type)) {
+    thrust::tabulate(handle_ptr->get_thrust_policy(),
+                     td_matrix,
+                     td_matrix + n_arcs * n_buckets,
+                     [time_matrix, n_buckets] __device__(size_t idx) -> f_t {
+                       return time_matrix[idx / n_buckets];
+                     });
+    thrust::tabulate(handle_ptr->get_thrust_policy(),
+                     bucket_start_time,
+                     bucket_start_time + n_buckets,
+                     [] __device__(i_t b) -> f_t { return b; });
+    return;
+  }
+  const auto& td = td_matrices.at(old_type);
+  raft::copy(td_matrix, td.get_values(), n_arcs * n_buckets, stream);
+  raft::copy(bucket_start_time, td.get_bucket_start_times(), n_buckets, stream);
+  thrust::tabulate(handle_ptr->get_thrust_policy(),
+                   time_matrix,
+                   time_matrix + n_arcs,
+                   [td_matrix, n_buckets] __device__(size_t arc) -> f_t {
+                     f_t min_time = td_matrix[arc * n_buckets];
+                     for (i_t b = 1; b < n_buckets; ++b) {
+                       min_time = min(min_time, td_matrix[arc * n_buckets + b]);
+                     }
+                     return min_time;
+                   });
 }
 
 template <typename i_t, typename f_t>
@@ -258,21 +626,63 @@ void fill_mdarray_from_data_model(d_mdarray_t<f_t>& matrices,
   auto nlocations        = data_model.get_num_locations();
   auto vehicle_types_map = get_unique_vehicle_types(vehicle_types, stream);
 
-  for (auto& [old_type, new_type] : vehicle_types_map) {
-    auto [cost_matrix, time_matrix] = get_vehicle_matrices<i_t, f_t>(data_model, old_type);
-    auto cost_matrix_span           = matrices.get_cost_matrix(new_type);
-    auto time_matrix_span           = matrices.get_time_matrix(new_type);
-    raft::copy(cost_matrix_span, cost_matrix, nlocations * nlocations, stream);
+  const auto& td_matrices = data_model.get_time_dependent_transit_time_matrices();
+  if (!td_matrices.empty()) {
+    matrices.resize_time_dependent(td_matrices.begin()->second.get_n_time_buckets());
+  }
+
+  const auto slots = get_matrix_slots(data_model);
+  for (auto& [old_type, slot] : slots) {
+    auto cost_matrix_span = matrices.get_cost_matrix(slot);
+    auto time_matrix_span = matrices.get_time_matrix(slot);
+    if (!fill_matrix_from_data_model(cost_matrix_span,
+                                     data_model.get_cost_matrix(old_type),
+                                     data_model.get_candidate_cost_matrices(),
+                                     old_type,
+                                     data_model)) {
+      cuopt_expects(
+        false, error_type_t::ValidationError, "Set vehicle types when using multiple matrices");
+    }
 
     if (limit_matrix_entries(cost_matrix_span, nlocations, data_model.get_handle_ptr())) {
       std::cout << "\nMax cost matrix value overriden to 1.0e+30";
     }
 
-    raft::copy(time_matrix_span, time_matrix, nlocations * nlocations, stream);
+    if (time_matrix_span == cost_matrix_span) { continue; }
+    if (!fill_matrix_from_data_model(time_matrix_span,
+                                     data_model.get_transit_time_matrix(old_type),
+                                     data_model.get_candidate_transit_time_matrices(),
+                                     old_type,
+                                     data_model)) {
+      raft::copy(time_matrix_span, cost_matrix_span, nlocations * nlocations, stream);
+    }
     if (limit_matrix_entries(time_matrix_span, nlocations, data_model.get_handle_ptr())) {
       std::cout << "\nMax time matrix value overriden to 1.0e+30";
     }
+    if (!td_matrices.empty()) { fill_time_dependent_matrix(matrices, data_model, old_type, slot); }
+  }
+  if (std::none_of(vehicle_types_map.begin(), vehicle_types_map.end(), [&](const auto& type) {
+        return has_scaled_matrices(data_model, type.first);
+      })) {
+    return;
+  }
+
+  const size_t n_matrix_types = matrices.extent[1];
+  std::vector<matrix_transform_t<f_t>> h_transforms(vehicle_types_map.size() * n_matrix_types);
+  for (auto& [old_type, new_type] : vehicle_types_map) {
+    auto transform = h_transforms.begin() + new_type * n_matrix_types;
+    if (!has_scaled_matrices(data_model, old_type)) {
+      std::fill(
+        transform, transform + n_matrix_types, matrix_transform_t<f_t>{slots.at(old_type), 1, 0});
+      continue;
+    }
+    const auto& scaled = data_model.get_scaled_matrices().at(old_type);
+    const uint8_t slot = slots.at(scaled.get_base_vehicle_type());
+    // with a single matrix type the scaled times are the scaled costs
+    transform[0]                  = {slot, scaled.get_cost_scale(), scaled.get_cost_offset()};
+    transform[n_matrix_types - 1] = {slot, scaled.get_time_scale(), scaled.get_time_offset()};
   }
+  matrices.transforms = cuopt::device_copy(h_transforms, stream);
 }
 
 }  // namespace detail
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -9,6 +9,7 @@
 
 #include <routing/routing_details.hpp>
 #include <routing/utilities/md_utils.hpp>
+#include <utilities/bit_span.hpp>
 #include <utilities/macros.cuh>
 #include <utilities/strided_span.hpp>
 
@@ -35,12 +36,14 @@ struct VehicleInfo {
 
   double get_average_cost() const
   {
-    auto matrix     = matrices.get_cost_matrix(type);
     auto width      = matrices.extent[3];
     double avg_cost = 0.;
 
-    for (size_t i = 0; i < width * width; ++i) {
-      if (matrix[i] != std::numeric_limits<f_t>::max()) { avg_cost += matrix[i]; }
+    for (size_t i = 0; i < width; ++i) {
+      for (size_t j = 0; j < width; ++j) {
+        const double cost = matrices.get_cost_value(type, i, j);
+        if (cost != std::numeric_limits<f_t>::max()) { avg_cost += cost; }
+      }
     }
 
     return avg_cost / (width * width);
@@ -51,7 +54,7 @@ struct VehicleInfo {
   uint8_t type{0};
   mdarray_view_t<f_t> matrices{};
   raft::span<int const, is_device> order_service_times{};
-  raft::span<bool const, is_device> order_match{};
+  bit_span order_match{};
   cuopt::strided_span<cap_i_t const> capacities{};
   raft::span<int const, is_device> break_durations{};
   raft::span<int const, is_device> break_earliest{};
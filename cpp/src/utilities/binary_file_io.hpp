@@ -0,0 +1,62 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+// Raw binary reads and writes of trivially copyable values, used by the files the solver saves
+// between runs. Each returns false as soon as the stream fails
+
+template <typename T>
+inline bool write_values(std::FILE* file, const T* values, size_t count)
+{
+  return std::fwrite(values, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+inline bool write_vector(std::FILE* file, const std::vector<T>& values)
+{
+  const uint64_t size = values.size();
+  return write_values(file, &size, 1) && write_values(file, values.data(), values.size());
+}
+
+template <typename T>
+inline bool read_values(std::FILE* file, T* values, size_t count)
+{
+  return std::fread(values, sizeof(T), count, file) == count;
+}
+
+// Rejects sizes larger than what is left in the file, so a corrupted size cannot trigger a huge
+// allocation
+template <typename T>
+inline bool read_vector(std::FILE* file, int64_t file_size, std::vector<T>& values)
+{
+  uint64_t size = 0;
+  if (!read_values(file, &size, 1)) { return false; }
+  const int64_t position = std::ftell(file);
+  if (position < 0 || size > static_cast<uint64_t>(file_size - position) / sizeof(T)) {
+    return false;
+  }
+  values.resize(size);
+  return read_values(file, values.data(), values.size());
+}
+
+// Size of an open file, the position is left at its start. Returns -1 on failure
+inline int64_t get_file_size(std::FILE* file)
+{
+  std::fseek(file, 0, SEEK_END);
+  const int64_t file_size = std::ftell(file);
+  std::fseek(file, 0, SEEK_SET);
+  return file_size;
+}
+
+}  // namespace cuopt::linear_programming::detail
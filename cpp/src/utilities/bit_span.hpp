@@ -0,0 +1,56 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <utilities/cuda_helpers.cuh>
+
+#include <cassert>
+#include <cstdint>
+
+namespace cuopt {
+
+/**
+ * @brief bit_span container provides a read only view of booleans packed 32 per word, the least
+ * significant bit first. A boolean matrix stored this way takes 8 times less memory than with one
+ * byte per entry. Each row starts on a word boundary, it takes words_for(n_columns) words
+ */
+class bit_span {
+ public:
+  using word_t                   = uint32_t;
+  static constexpr int word_bits = 32;
+
+  static constexpr size_t words_for(size_t n_bits) { return (n_bits + word_bits - 1) / word_bits; }
+
+  bit_span() = default;
+  HDI bit_span(word_t const* words, size_t size) : words_(words), size_(size) {}
+
+  // The unused bits of the last word must be zero
+  bool operator==(bit_span const& rhs) const
+  {
+    if (size_ != rhs.size_) { return false; }
+    for (size_t w = 0; w < words_for(size_); ++w) {
+      if (words_[w] != rhs.words_[w]) { return false; }
+    }
+    return true;
+  }
+
+  HDI bool operator[](size_t i) const
+  {
+    assert(i < size_);
+    return (words_[i / word_bits] >> (i % word_bits)) & 1u;
+  }
+
+  HDI size_t size() const { return size_; }
+  HDI bool empty() const { return size_ == 0; }
+  HDI word_t const* words() const { return words_; }
+
+ private:
+  word_t const* words_ = nullptr;
+  size_t size_         = 0;
+};
+}  // namespace cuopt
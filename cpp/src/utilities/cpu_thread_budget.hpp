@@ -0,0 +1,58 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+namespace cuopt {
+
+/**
+ * @brief Number of CPU threads that the components of a solve may keep busy at the same time
+ *
+ * The limit covers the whole solve rather than each component. Branch-and-bound acquires its
+ * threads first, the CPU heuristics then acquire what is left for the duration of each run and
+ * start fewer climbers when the budget is short. Without a limit every request is granted.
+ */
+class cpu_thread_budget_t {
+ public:
+  void set_limit(int n_threads)
+  {
+    limited_ = true;
+    available_.store(std::max(0, n_threads), std::memory_order_release);
+  }
+
+  bool is_limited() const { return limited_; }
+
+  // Takes up to n_threads threads from the budget and returns how many were granted
+  int acquire(int n_threads)
+  {
+    if (!limited_) { return n_threads; }
+    int available = available_.load(std::memory_order_relaxed);
+    int granted   = std::min(available, n_threads);
+    while (granted > 0 &&
+           !available_.compare_exchange_weak(available, available - granted,
+                                             std::memory_order_acq_rel)) {
+      granted = std::min(available, n_threads);
+    }
+    return std::max(0, granted);
+  }
+
+  void release(int n_threads)
+  {
+    if (limited_ && n_threads > 0) {
+      available_.fetch_add(n_threads, std::memory_order_acq_rel);
+    }
+  }
+
+ private:
+  bool limited_{false};
+  std::atomic<int> available_{0};
+};
+
+}  // namespace cuopt
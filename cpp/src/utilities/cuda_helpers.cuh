@@ -190,8 +190,10 @@ inline bool set_shmem_of_kernel(Function* function, size_t dynamic_request_size)
       if (dynamic_request_size > current_size) {
         cudaFuncSetAttribute(
           function, cudaFuncAttributeMaxDynamicSharedMemorySize, dynamic_request_size);
+        // a size that was refused is not recorded, so that asking for it again fails as well
+        if (cudaSuccess != cudaGetLastError()) { return false; }
         shmem_sizes[function] = dynamic_request_size;
-        return (cudaSuccess == cudaGetLastError());
+        return true;
       }
     }
   }
@@ -231,9 +233,31 @@ inline size_t get_device_memory_size()
            (limiting_adaptor->get_allocation_limit() - limiting_adaptor->get_allocated_bytes()) /
              (double)1e6);
     return std::min(total_mem, limiting_adaptor->get_allocation_limit());
-  } else {
-    return total_mem;
   }
+  // Limit of a solve set by its device memory budget
+  auto budget_adaptor =
+    dynamic_cast<rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource>*>(res);
+  if (budget_adaptor) { return std::min(total_mem, budget_adaptor->get_allocation_limit()); }
+  return total_mem;
+}
+
+/**
+ * @brief Free memory of the current device, capped by what is left of the device memory budget of
+ * the solve when it has one
+ */
+inline size_t get_device_free_memory()
+{
+  size_t free_mem, total_mem;
+  RAFT_CUDA_TRY(cudaMemGetInfo(&free_mem, &total_mem));
+
+  auto res = rmm::mr::get_current_device_resource();
+  auto budget_adaptor =
+    dynamic_cast<rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource>*>(res);
+  if (budget_adaptor) {
+    return std::min(free_mem,
+                    budget_adaptor->get_allocation_limit() - budget_adaptor->get_allocated_bytes());
+  }
+  return free_mem;
 }
 
 }  // namespace cuopt
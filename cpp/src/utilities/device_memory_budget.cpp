@@ -0,0 +1,95 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <utilities/device_memory_budget.hpp>
+#include <utilities/logger.hpp>
+
+#include <rmm/cuda_device.hpp>
+#include <rmm/mr/device_memory_resource.hpp>
+#include <rmm/mr/limiting_resource_adaptor.hpp>
+#include <rmm/mr/per_device_resource.hpp>
+
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cuopt {
+
+namespace {
+
+using limiting_adaptor_t = rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource>;
+
+struct device_budget_state_t {
+  std::unique_ptr<limiting_adaptor_t> adaptor;
+  rmm::mr::device_memory_resource* previous_resource{nullptr};
+  double limit_mb{0.0};
+  int n_solves{0};
+};
+
+std::mutex budget_mutex;
+std::unordered_map<int, device_budget_state_t> budget_states;
+// Adaptors of the ended solves, the buffers they allocated (returned solutions) are freed through
+// them so they are kept until none is left
+std::vector<std::unique_ptr<limiting_adaptor_t>> retired_adaptors;
+
+// Must be called with budget_mutex held
+void prune_retired_adaptors()
+{
+  std::erase_if(retired_adaptors,
+                [](const auto& adaptor) { return adaptor->get_allocated_bytes() == 0; });
+}
+
+}  // namespace
+
+device_memory_budget_t::device_memory_budget_t(double limit_mb)
+{
+  if (!std::isfinite(limit_mb)) { return; }
+  std::lock_guard<std::mutex> lock(budget_mutex);
+  prune_retired_adaptors();
+
+  device_id_  = rmm::get_current_cuda_device().value();
+  auto& state = budget_states[device_id_];
+  if (state.n_solves++ > 0) {
+    if (limit_mb != state.limit_mb) {
+      CUOPT_LOG_WARN(
+        "Device memory limit of %.0f MB ignored, the solves running on device %d share the limit "
+        "of %.0f MB set by the first of them",
+        limit_mb,
+        device_id_,
+        state.limit_mb);
+    }
+    return;
+  }
+  state.previous_resource = rmm::mr::get_per_device_resource(rmm::cuda_device_id{device_id_});
+  state.limit_mb          = limit_mb;
+  state.adaptor           = std::make_unique<limiting_adaptor_t>(
+    state.previous_resource, static_cast<std::size_t>(limit_mb * 1024.0 * 1024.0));
+  rmm::mr::set_per_device_resource(rmm::cuda_device_id{device_id_}, state.adaptor.get());
+  CUOPT_LOG_INFO("Device memory limited to %.0f MB", limit_mb);
+}
+
+device_memory_budget_t::~device_memory_budget_t()
+{
+  if (device_id_ < 0) { return; }
+  std::lock_guard<std::mutex> lock(budget_mutex);
+  auto& state = budget_states[device_id_];
+  if (--state.n_solves > 0) { return; }
+  // A resource installed by the user during the solve is kept
+  const rmm::cuda_device_id device{device_id_};
+  if (rmm::mr::get_per_device_resource(device) == state.adaptor.get()) {
+    rmm::mr::set_per_device_resource(device, state.previous_resource);
+  } else {
+    CUOPT_LOG_WARN("Device %d resource replaced during the solve, the previous one is not restored",
+                   device_id_);
+  }
+  retired_adaptors.push_back(std::move(state.adaptor));
+  prune_retired_adaptors();
+}
+
+}  // namespace cuopt
@@ -0,0 +1,38 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+namespace cuopt {
+
+/**
+ * @brief Caps the memory allocated through RMM on the current device while it is alive
+ *
+ * A limiting adaptor over the current device resource is installed for the duration of the solve,
+ * allocations over the limit throw rmm::out_of_memory. The limit is per device, not per solve: the
+ * solves running at the same time on the device share the adaptor and the limit of the first of
+ * them, a different limit of a later one is ignored with a warning. The previous resource is
+ * restored when the last one ends, unless another resource was installed in the meantime. The
+ * adaptor is kept until the buffers it allocated, e.g., returned solutions, are freed.
+ * Nothing is installed for an infinite limit.
+ */
+class device_memory_budget_t {
+ public:
+  /**
+   * @param limit_mb Limit in MB, infinite for no limit
+   */
+  explicit device_memory_budget_t(double limit_mb);
+  ~device_memory_budget_t();
+
+  device_memory_budget_t(const device_memory_budget_t&)            = delete;
+  device_memory_budget_t& operator=(const device_memory_budget_t&) = delete;
+
+ private:
+  int device_id_{-1};
+};
+
+}  // namespace cuopt
@@ -0,0 +1,99 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <utilities/incumbent_bus.hpp>
+
+#include <cuda_runtime.h>
+
+#include <limits>
+#include <new>
+
+namespace cuopt {
+
+namespace {
+
+// Replaces value by candidate when candidate is smaller, or larger when larger is set
+bool improve(std::atomic<double>& value, double candidate, bool larger)
+{
+  double current = value.load(std::memory_order_relaxed);
+  while (larger ? candidate > current : candidate < current) {
+    if (value.compare_exchange_weak(current, candidate, std::memory_order_acq_rel)) { return true; }
+  }
+  return false;
+}
+
+}  // namespace
+
+static_assert(sizeof(std::atomic<double>) == sizeof(double) &&
+                std::atomic<double>::is_always_lock_free,
+              "The device reads the cutoff as a plain double");
+
+incumbent_bus_t::incumbent_bus_t()
+  : host_cutoff_(std::numeric_limits<double>::infinity()),
+    lower_bound_(-std::numeric_limits<double>::infinity())
+{
+  void* mapped = nullptr;
+  if (cudaHostAlloc(&mapped, sizeof(std::atomic<double>), cudaHostAllocMapped) == cudaSuccess) {
+    cutoff_             = new (mapped) std::atomic<double>(host_cutoff_.load());
+    void* device_cutoff = nullptr;
+    if (cudaHostGetDevicePointer(&device_cutoff, mapped, 0) == cudaSuccess) {
+      device_cutoff_ = static_cast<const volatile double*>(device_cutoff);
+    }
+  } else {
+    cudaGetLastError();
+    cutoff_ = &host_cutoff_;
+  }
+}
+
+incumbent_bus_t::~incumbent_bus_t()
+{
+  if (cutoff_ != &host_cutoff_) { cudaFreeHost(cutoff_); }
+}
+
+void incumbent_bus_t::set_objective_map(double scaling_factor, double offset)
+{
+  scaling_factor_.store(scaling_factor, std::memory_order_release);
+  offset_.store(offset, std::memory_order_release);
+}
+
+double incumbent_bus_t::user_objective(double objective) const
+{
+  return scaling_factor_.load(std::memory_order_acquire) *
+         (objective + offset_.load(std::memory_order_acquire));
+}
+
+double incumbent_bus_t::solver_objective(double user_objective) const
+{
+  return user_objective / scaling_factor_.load(std::memory_order_acquire) -
+         offset_.load(std::memory_order_acquire);
+}
+
+bool incumbent_bus_t::publish_incumbent(double objective)
+{
+  if (!improve(*cutoff_, objective, false)) { return false; }
+  version_.fetch_add(1, std::memory_order_acq_rel);
+  return true;
+}
+
+bool incumbent_bus_t::publish_user_incumbent(double user_objective)
+{
+  return publish_incumbent(solver_objective(user_objective));
+}
+
+bool incumbent_bus_t::publish_lower_bound(double lower_bound)
+{
+  if (!improve(lower_bound_, lower_bound, true)) { return false; }
+  version_.fetch_add(1, std::memory_order_acq_rel);
+  return true;
+}
+
+bool incumbent_bus_t::publish_user_lower_bound(double user_lower_bound)
+{
+  return publish_lower_bound(solver_objective(user_lower_bound));
+}
+
+}  // namespace cuopt
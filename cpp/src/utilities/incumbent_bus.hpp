@@ -0,0 +1,72 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace cuopt {
+
+/**
+ * @brief Lock-free channel through which the MIP solvers share the objective cutoff and the
+ * global lower bound
+ *
+ * Branch-and-bound and the GPU heuristics publish the objective of each new incumbent and the
+ * lower bounds they prove. A publication only lands when it improves the current value, with a
+ * compare and swap, so neither publishers nor readers ever wait. The version counter is bumped on
+ * every improvement, so a subscriber detects news with one load.
+ *
+ * Values are kept in the solver space of the MIP problem, the minimization objective of the
+ * heuristics problem. Branch-and-bound works on another space and exchanges user objectives, which
+ * are mapped with set_objective_map.
+ *
+ * The cutoff lives in mapped pinned memory: GPU kernels read it through device_objective_cutoff()
+ * without any host synchronization. The pointer is null when mapped memory is not available.
+ */
+class incumbent_bus_t {
+ public:
+  incumbent_bus_t();
+  ~incumbent_bus_t();
+
+  incumbent_bus_t(const incumbent_bus_t&)            = delete;
+  incumbent_bus_t& operator=(const incumbent_bus_t&) = delete;
+
+  // user objective = scaling_factor * (solver objective + offset)
+  void set_objective_map(double scaling_factor, double offset);
+
+  // Return true when the value improved the one of the bus
+  bool publish_incumbent(double objective);
+  bool publish_user_incumbent(double user_objective);
+  bool publish_lower_bound(double lower_bound);
+  bool publish_user_lower_bound(double user_lower_bound);
+
+  // +inf before the first incumbent
+  double objective_cutoff() const { return cutoff_->load(std::memory_order_acquire); }
+  double user_objective_cutoff() const { return user_objective(objective_cutoff()); }
+  // -inf before the first bound
+  double lower_bound() const { return lower_bound_.load(std::memory_order_acquire); }
+
+  uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+  const volatile double* device_objective_cutoff() const { return device_cutoff_; }
+
+  double user_objective(double objective) const;
+
+ private:
+  double solver_objective(double user_objective) const;
+
+  std::atomic<double>* cutoff_{nullptr};
+  std::atomic<double> host_cutoff_;  // used when mapped pinned memory is not available
+  const volatile double* device_cutoff_{nullptr};
+  std::atomic<double> lower_bound_;
+  std::atomic<uint64_t> version_{0};
+  std::atomic<double> scaling_factor_{1.0};
+  std::atomic<double> offset_{0.0};
+};
+
+}  // namespace cuopt
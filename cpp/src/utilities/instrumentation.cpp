@@ -0,0 +1,72 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <utilities/instrumentation.hpp>
+
+#ifdef CUOPT_ENABLE_SOLVER_COUNTERS
+
+#include <utilities/logger.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace cuopt {
+
+solver_counters_t& solver_counters_t::instance()
+{
+  static solver_counters_t counters;
+  return counters;
+}
+
+std::atomic<double>& solver_counters_t::get(const char* name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return counters_.try_emplace(name, 0.0).first->second;
+}
+
+void solver_counters_t::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [name, value] : counters_) {
+    value.store(0.0, std::memory_order_relaxed);
+  }
+  start_ = std::chrono::steady_clock::now();
+}
+
+std::string solver_counters_t::to_json() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  char buffer[32];
+  std::snprintf(buffer,
+                sizeof(buffer),
+                "%.17g",
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+  std::string json = std::string("{\n  \"solve_seconds\": ") + buffer;
+  for (const auto& [name, value] : counters_) {
+    std::snprintf(buffer, sizeof(buffer), "%.17g", value.load(std::memory_order_relaxed));
+    json += ",\n  \"" + name + "\": " + buffer;
+  }
+  json += "\n}\n";
+  return json;
+}
+
+void solver_counters_t::export_json() const
+{
+  const char* file_name = std::getenv("CUOPT_COUNTERS_FILE");
+  if (file_name == nullptr) { return; }
+  std::ofstream file(file_name);
+  if (!file) {
+    CUOPT_LOG_WARN("Could not open the counters file %s", file_name);
+    return;
+  }
+  file << to_json();
+}
+
+}  // namespace cuopt
+
+#endif  // CUOPT_ENABLE_SOLVER_COUNTERS
@@ -0,0 +1,132 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+/**
+ * @file instrumentation.hpp
+ * @brief NVTX ranges and counters of the solver hot paths
+ *
+ * Usage:
+ *   - CUOPT_NVTX_RANGE(pdlp, "iteration") opens a range until the end of the scope in the NVTX
+ *     domain of the component, each domain is shown as its own row by Nsight Systems. The ranges
+ *     compile to nothing when NVTX is disabled.
+ *   - CUOPT_COUNTER_ADD("pdlp.iterations", 1) accumulates into a named counter. The counters are
+ *     reset at the start of a solve and written as JSON at its end to the file named by the
+ *     CUOPT_COUNTERS_FILE environment variable. They are only built with
+ *     -DDEFINE_SOLVER_COUNTERS=ON, the CUOPT_COUNTER* macros are no-ops otherwise. The JSON
+ *     also holds the solve_seconds elapsed since the reset, to derive rates such as moves/s.
+ *
+ * Counters are process wide, the ones of solves running at the same time are summed.
+ */
+
+#pragma once
+
+#include <raft/core/nvtx.hpp>
+
+#ifdef CUOPT_ENABLE_SOLVER_COUNTERS
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#endif
+
+namespace cuopt {
+
+namespace nvtx_domain {
+struct pdlp {
+  static constexpr char const* name{"cuopt_pdlp"};
+};
+struct barrier {
+  static constexpr char const* name{"cuopt_barrier"};
+};
+struct dual_simplex {
+  static constexpr char const* name{"cuopt_dual_simplex"};
+};
+struct branch_and_bound {
+  static constexpr char const* name{"cuopt_branch_and_bound"};
+};
+struct mip_heuristics {
+  static constexpr char const* name{"cuopt_mip_heuristics"};
+};
+struct routing {
+  static constexpr char const* name{"cuopt_routing"};
+};
+}  // namespace nvtx_domain
+
+#define CUOPT_NVTX_CONCAT_INNER(a, b) a##b
+#define CUOPT_NVTX_CONCAT(a, b)       CUOPT_NVTX_CONCAT_INNER(a, b)
+#define CUOPT_NVTX_RANGE(domain, name)                      \
+  ::raft::common::nvtx::range<::cuopt::nvtx_domain::domain> \
+  CUOPT_NVTX_CONCAT(cuopt_nvtx_scope_, __LINE__)(name)
+
+#ifdef CUOPT_ENABLE_SOLVER_COUNTERS
+
+class solver_counters_t {
+ public:
+  static solver_counters_t& instance();
+
+  // Counter of that name, created at zero on first use. The reference stays valid
+  std::atomic<double>& get(const char* name);
+  // Sets all counters to zero and restarts the solve_seconds clock
+  void reset();
+  std::string to_json() const;
+  // Writes to_json() to the CUOPT_COUNTERS_FILE file when the variable is set
+  void export_json() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, std::atomic<double>> counters_;
+  std::chrono::steady_clock::time_point start_{std::chrono::steady_clock::now()};
+};
+
+// The counter is looked up once per call site
+#define CUOPT_COUNTER_ADD(name, value)                                               \
+  do {                                                                               \
+    static auto& cuopt_counter_ = ::cuopt::solver_counters_t::instance().get(name);  \
+    cuopt_counter_.fetch_add(static_cast<double>(value), std::memory_order_relaxed); \
+  } while (0)
+#define CUOPT_COUNTER_SET(name, value)                                              \
+  do {                                                                              \
+    static auto& cuopt_counter_ = ::cuopt::solver_counters_t::instance().get(name); \
+    cuopt_counter_.store(static_cast<double>(value), std::memory_order_relaxed);    \
+  } while (0)
+#define CUOPT_COUNTERS_RESET()  ::cuopt::solver_counters_t::instance().reset()
+#define CUOPT_COUNTERS_EXPORT() ::cuopt::solver_counters_t::instance().export_json()
+
+#else  // !CUOPT_ENABLE_SOLVER_COUNTERS
+
+#define CUOPT_COUNTER_ADD(name, value) ((void)0)
+#define CUOPT_COUNTER_SET(name, value) ((void)0)
+#define CUOPT_COUNTERS_RESET()         ((void)0)
+#define CUOPT_COUNTERS_EXPORT()        ((void)0)
+
+#endif  // CUOPT_ENABLE_SOLVER_COUNTERS
+
+/**
+ * @brief Resets the counters when constructed and exports them when destroyed, only for the top
+ * level solves so that the LPs solved inside a MIP are part of the MIP counters
+ */
+class solver_counters_scope_t {
+ public:
+#ifdef CUOPT_ENABLE_SOLVER_COUNTERS
+  explicit solver_counters_scope_t(bool top_level = true) : top_level_(top_level)
+  {
+    if (top_level_) { CUOPT_COUNTERS_RESET(); }
+  }
+  ~solver_counters_scope_t()
+  {
+    if (top_level_) { CUOPT_COUNTERS_EXPORT(); }
+  }
+
+ private:
+  bool top_level_;
+#else
+  explicit solver_counters_scope_t(bool = true) {}
+#endif
+};
+
+}  // namespace cuopt
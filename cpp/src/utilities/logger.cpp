@@ -1,13 +1,18 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
+#include <cuopt/error.hpp>
 #include <utilities/logger.hpp>
 #include <utilities/version_info.hpp>
 
+#include <condition_variable>
+#include <fstream>
+#include <thread>
+
 namespace cuopt {
 
 struct buffered_entry {
@@ -62,6 +67,101 @@ static void buffer_log_callback(int lvl, const char* msg)
   global_log_buffer().log(static_cast<rapids_logger::level_enum>(lvl), msg);
 }
 
+/**
+ * @brief Writes the console and file logs from a background thread.
+ *
+ * The solver threads only format their message and append it to a bounded queue, the writer
+ * thread does the I/O and flushes once the queue is drained. A producer only waits when the writer
+ * falls max_pending messages behind, so no message is ever dropped. The order of the messages is
+ * kept.
+ */
+class async_log_writer {
+ public:
+  static constexpr size_t max_pending = 1 << 14;
+
+  ~async_log_writer() { stop(); }
+
+  void start(bool log_to_console, const std::string& log_file)
+  {
+    stop();
+    to_console = log_to_console;
+    if (!log_file.empty()) {
+      file.open(log_file, std::ios::out | std::ios::trunc);
+      cuopt_expects(file.is_open(),
+                    error_type_t::ValidationError,
+                    "Could not open the log file %s",
+                    log_file.c_str());
+    }
+    stopping = false;
+    worker   = std::thread([this]() { run(); });
+  }
+
+  // Writes the pending messages, closes the file and joins the writer thread
+  void stop()
+  {
+    if (!worker.joinable()) { return; }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    not_empty.notify_one();
+    worker.join();
+    if (file.is_open()) { file.close(); }
+  }
+
+  void push(const char* msg)
+  {
+    if (!msg) return;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      not_full.wait(lock, [this]() { return pending.size() < max_pending || stopping; });
+      pending.emplace_back(msg);
+    }
+    not_empty.notify_one();
+  }
+
+ private:
+  void run()
+  {
+    std::vector<std::string> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      not_empty.wait(lock, [this]() { return !pending.empty() || stopping; });
+      if (pending.empty() && stopping) { return; }
+      batch.swap(pending);
+      lock.unlock();
+      not_full.notify_all();
+      for (const auto& msg : batch) {
+        if (to_console) { std::cout << msg; }
+        if (file.is_open()) { file << msg; }
+      }
+      batch.clear();
+      lock.lock();
+      if (pending.empty()) {
+        if (to_console) { std::cout.flush(); }
+        if (file.is_open()) { file.flush(); }
+      }
+    }
+  }
+
+  bool to_console{false};
+  std::ofstream file;
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::vector<std::string> pending;
+  bool stopping{false};
+  std::thread worker;
+};
+
+async_log_writer& global_log_writer()
+{
+  static async_log_writer writer;
+  return writer;
+}
+
+static void async_log_callback(int, const char* msg) { global_log_writer().push(msg); }
+
 /**
  * @brief Returns the default sink for the global logger.
  *
@@ -139,7 +239,11 @@ void reset_default_logger()
 
 // Guard object whose destructor resets the logger
 struct logger_config_guard {
-  ~logger_config_guard() { cuopt::reset_default_logger(); }
+  ~logger_config_guard()
+  {
+    cuopt::reset_default_logger();
+    global_log_writer().stop();
+  }
 };
 
 // Weak reference to detect if any init_logger_t instance is still alive
@@ -159,15 +263,11 @@ init_logger_t::init_logger_t(std::string log_file, bool log_to_console)
 
   cuopt::default_logger().sinks().clear();
 
-  // re-initialize sinks
-  if (log_to_console) {
-    cuopt::default_logger().sinks().push_back(
-      std::make_shared<rapids_logger::ostream_sink_mt>(std::cout));
-  }
-  if (!log_file.empty()) {
+  // re-initialize sinks, the console and the file are written by the background writer
+  if (log_to_console || !log_file.empty()) {
+    global_log_writer().start(log_to_console, log_file);
     cuopt::default_logger().sinks().push_back(
-      std::make_shared<rapids_logger::basic_file_sink_mt>(log_file, true));
-    cuopt::default_logger().flush_on(rapids_logger::level_enum::debug);
+      std::make_shared<rapids_logger::callback_sink_mt>(async_log_callback));
   }
 
 #if CUOPT_LOG_ACTIVE_LEVEL >= RAPIDS_LOGGER_LOG_LEVEL_INFO
@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -16,9 +16,12 @@
 #include <cassert>
 #define cuopt_assert(val, msg) assert(val&& msg)
 #define cuopt_func_call(func)  func;
+// set in the checked builds, where the assertions and the runtime checks are compiled in
+constexpr bool cuopt_checked_build = true;
 #else
 #define cuopt_assert(val, msg)
 #define cuopt_func_call(func) ;
+constexpr bool cuopt_checked_build = false;
 #endif
 
 #ifdef BENCHMARK
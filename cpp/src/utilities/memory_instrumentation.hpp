@@ -12,9 +12,12 @@
  * This file provides wrapper classes for tracking memory reads and writes.
  *
  * Usage:
- *   - Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to enable tracking
- *   - When undefined, all instrumentation becomes zero-overhead passthrough
- *     (record_*() calls inline away, no counter storage overhead)
+ *   - Build with -DDEFINE_MEMORY_INSTRUMENTATION=ON (CUOPT_ENABLE_MEMORY_INSTRUMENTATION=1) to
+ *     count the bytes loaded and stored through ins_vector, instrumentation_aggregator_t::report()
+ *     then gives the bytes touched per data structure
+ *   - Otherwise ins_vector is a zero-overhead passthrough (no record_*() calls, no counter
+ *     storage overhead)
+ *   - counted_vector always counts, for the work estimates derived from the counters
  *
  * Example:
  *   ins_vector<int> vec;  // Instrumented std::vector<int>
@@ -26,15 +29,20 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
-#define CUOPT_ENABLE_MEMORY_INSTRUMENTATION 1
+// Set by the DEFINE_MEMORY_INSTRUMENTATION build option for profiling builds
+#ifndef CUOPT_ENABLE_MEMORY_INSTRUMENTATION
+#define CUOPT_ENABLE_MEMORY_INSTRUMENTATION 0
+#endif
 
 #ifdef __NVCC__
 #define HDI inline __host__ __device__
@@ -44,12 +52,11 @@
 
 namespace cuopt {
 
-// Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to 1 to enable memory tracking
-// When 0, instrumentation becomes a zero-overhead passthrough
+// Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to 1 to count the accesses of ins_vector
+// When 0, ins_vector becomes a zero-overhead passthrough, counted_vector always counts
 
 // Base class for memory operation instrumentation
 struct memory_instrumentation_base_t {
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
   HDI void reset_counters() const { byte_loads = byte_stores = 0; }
 
   template <typename T>
@@ -73,26 +80,8 @@ struct memory_instrumentation_base_t {
 
   mutable size_t byte_loads{0};
   mutable size_t byte_stores{0};
-#else
-  // No-op methods when instrumentation is disabled - these inline away to zero overhead
-  HDI void reset_counters() const {}
-  template <typename T>
-  HDI void record_load() const
-  {
-  }
-  template <typename T>
-  HDI void record_store() const
-  {
-  }
-  template <typename T>
-  HDI void record_rmw() const
-  {
-  }
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
 };
 
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // aggregator class to collect statistics from multiple instrumented objects
 class instrumentation_aggregator_t {
  public:
@@ -157,31 +146,32 @@ class instrumentation_aggregator_t {
     }
   }
 
+  // Bytes touched per wrapper, the largest first, one "name loads=<bytes> stores=<bytes>" line each
+  std::string report() const
+  {
+    std::vector<std::tuple<size_t, std::string, size_t, size_t>> entries;
+    entries.reserve(instrumented_.size());
+    for (const auto& [name, instr] : instrumented_) {
+      const size_t loads  = instr.get().byte_loads;
+      const size_t stores = instr.get().byte_stores;
+      entries.emplace_back(loads + stores, name, loads, stores);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+      return std::get<0>(a) > std::get<0>(b);
+    });
+    std::string result;
+    for (const auto& [total, name, loads, stores] : entries) {
+      result +=
+        name + " loads=" + std::to_string(loads) + " stores=" + std::to_string(stores) + "\n";
+    }
+    return result;
+  }
+
  private:
   std::unordered_map<std::string, std::reference_wrapper<const memory_instrumentation_base_t>>
     instrumented_;
 };
 
-#else
-
-// No-op aggregator when instrumentation is disabled
-class instrumentation_aggregator_t {
- public:
-  instrumentation_aggregator_t() = default;
-  instrumentation_aggregator_t(
-    std::initializer_list<
-      std::pair<std::string, std::reference_wrapper<const memory_instrumentation_base_t>>>)
-  {
-  }
-  void add(const std::string&, const memory_instrumentation_base_t&) {}
-  std::pair<size_t, size_t> collect() { return {0, 0}; }
-  std::vector<std::tuple<std::string, size_t, size_t>> collect_per_wrapper() { return {}; }
-  std::pair<size_t, size_t> collect_and_flush() { return {0, 0}; }
-  void flush() {}
-};
-
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // Helper traits to detect container capabilities
 namespace type_traits_utils {
 
@@ -265,11 +255,13 @@ struct has_back<T, std::void_t<decltype(std::declval<T>().back())>> : std::true_
 
 }  // namespace type_traits_utils
 
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
+// Memory operation instrumentation wrapper for container-like types, the accesses are only
+// counted when Instrumented is true
+template <typename T, bool Instrumented = CUOPT_ENABLE_MEMORY_INSTRUMENTATION>
+struct memop_instrumentation_wrapper_t;
 
-// Memory operation instrumentation wrapper for container-like types
 template <typename T>
-struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
+struct memop_instrumentation_wrapper_t<T, true> : public memory_instrumentation_base_t {
   // Standard container type traits
   using value_type      = std::remove_reference_t<decltype(std::declval<T>()[0])>;
   using size_type       = std::size_t;
@@ -405,9 +397,7 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
     auto operator*() const
     {
       if constexpr (IsConst) {
-#ifdef CUOPT_ENABLE_MEMORY_INSTRUMENTATION
         wrapper_->byte_loads += sizeof(value_type);
-#endif
         return *iter_;
       } else {
         return element_proxy_t(*iter_, *wrapper_);
@@ -711,13 +701,11 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
   T array_;
 };
 
-#else  // !CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // Zero-overhead passthrough wrapper when instrumentation is disabled
 // Provides the same interface as the instrumented version but just forwards to the underlying
 // container
 template <typename T>
-struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
+struct memop_instrumentation_wrapper_t<T, false> {
   using value_type             = typename T::value_type;
   using size_type              = typename T::size_type;
   using difference_type        = typename T::difference_type;
@@ -835,10 +823,13 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
   T array_;
 };
 
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
 
 // Convenience alias for instrumented std::vector
 template <typename T>
 using ins_vector = memop_instrumentation_wrapper_t<std::vector<T>>;
 
+// std::vector whose accesses are always counted, for the work estimates derived from the counters
+template <typename T>
+using counted_vector = memop_instrumentation_wrapper_t<std::vector<T>, true>;
+
 }  // namespace cuopt
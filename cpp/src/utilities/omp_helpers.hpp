@@ -10,6 +10,7 @@
 #ifdef _OPENMP
 
 #include <omp.h>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -126,6 +127,40 @@ class omp_atomic_t {
 #endif
 };
 
+// omp_mutex_t that accumulates the time the threads spent blocked on it. An uncontended lock only
+// costs a try_lock, so it can stay enabled in production builds
+class omp_timed_mutex_t : public omp_mutex_t {
+ public:
+  void lock()
+  {
+    if (omp_mutex_t::try_lock()) { return; }
+    const double start = omp_get_wtime();
+    omp_mutex_t::lock();
+    wait_time += omp_get_wtime() - start;
+    ++num_contended;
+  }
+
+  double get_wait_time() const { return wait_time.load(); }
+  int64_t get_num_contended() const { return num_contended.load(); }
+
+ private:
+  omp_atomic_t<double> wait_time{0.0};
+  omp_atomic_t<int64_t> num_contended{0};
+};
+
+// Runs func(i) for i in [0, n) as tasks of the current team and waits for all of them. The memory
+// that func allocates and writes is first touched by the thread that runs the task, so it ends up
+// on the NUMA node of that thread instead of the one of the caller. Outside of a parallel region,
+// the calls run in order on the calling thread.
+template <typename func_t>
+void omp_first_touch_for(int n, func_t&& func)
+{
+#pragma omp taskloop grainsize(1)
+  for (int i = 0; i < n; ++i) {
+    func(i);
+  }
+}
+
 // Atomic CAS are only supported in OpenMP v5.1
 // (gcc 12+ or clang 14+), however, nvcc (or the host compiler) cannot
 // parse it correctly yet
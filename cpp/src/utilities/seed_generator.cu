@@ -1,10 +1,10 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 
 #include <utilities/seed_generator.cuh>
 
-int64_t cuopt::seed_generator::seed_ = 0;
+std::atomic<int64_t> cuopt::seed_generator::seed_{0};
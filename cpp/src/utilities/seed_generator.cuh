@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -9,20 +9,22 @@
 #include <raft/random/rng_device.cuh>
 #include <utilities/cuda_helpers.cuh>
 
+#include <atomic>
+
 namespace cuopt {
 
 // TODO: should be thread local?
 class seed_generator {
-  static int64_t seed_;
+  static std::atomic<int64_t> seed_;
 
  public:
   template <typename seed_t>
   static void set_seed(seed_t seed)
   {
 #ifdef BENCHMARK
-    seed_ = std::random_device{}();
+    seed_.store(std::random_device{}());
 #else
-    seed_ = static_cast<int64_t>(seed);
+    seed_.store(static_cast<int64_t>(seed));
 #endif
   }
   template <typename arg0, typename arg1, typename... args>
@@ -31,11 +33,33 @@ class seed_generator {
     set_seed(seed1 + ((seed0 + seed1) * (seed0 + seed1 + 1) / 2), seeds...);
   }
 
-  static int64_t get_seed() { return seed_++; }
+  static int64_t get_seed() { return seed_.fetch_add(1); }
 
  public:
   seed_generator(seed_generator const&) = delete;
   void operator=(seed_generator const&) = delete;
 };
 
+// splitmix64 finalizer, consecutive inputs give unrelated outputs
+HDI uint64_t mix_seed(uint64_t x)
+{
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Random stream of one worker (thread, block) of a parallel kernel.
+ *
+ * The stream only depends on its key: the seed of the launch, the worker id and an iteration (a
+ * solution or route id for instance). No state is kept in global memory and the numbers do not
+ * depend on the order in which the workers run. The worker selects a PCG subsequence, so
+ * consecutive seeds never share a stream, as happened with seed + worker.
+ */
+HDI raft::random::PCGenerator make_worker_rng(int64_t seed, uint64_t worker, uint64_t iteration = 0)
+{
+  return raft::random::PCGenerator(mix_seed(uint64_t(seed) ^ mix_seed(iteration)), worker, 0);
+}
+
 }  // namespace cuopt
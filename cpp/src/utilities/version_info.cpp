@@ -1,11 +1,12 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2024-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
 #include "version_info.hpp"
 
+#include <cuda.h>
 #include <cuda_runtime.h>
 
 #include <cuopt/version_config.hpp>
@@ -163,6 +164,21 @@ static double get_available_memory_gb()
   return kb / (1024.0 * 1024.0);  // Convert KB to GB
 }
 
+const char* get_cuda_module_loading_mode()
+{
+  // Queried through the runtime so that the library does not need to link the driver
+  void* func = nullptr;
+  cudaDriverEntryPointQueryResult status;
+  cudaGetDriverEntryPointByVersion(
+    "cuModuleGetLoadingMode", &func, 11070, cudaEnableDefault, &status);
+  if (status != cudaDriverEntryPointSuccess || func == nullptr) { return "unknown"; }
+  CUmoduleLoadingMode mode;
+  if (reinterpret_cast<decltype(::cuModuleGetLoadingMode)*>(func)(&mode) != CUDA_SUCCESS) {
+    return "unknown";
+  }
+  return mode == CU_MODULE_LAZY_LOADING ? "lazy" : "eager";
+}
+
 void print_version_info()
 {
   int device_id = 0;
@@ -206,12 +222,13 @@ void print_version_info()
                  get_physical_cores(),
                  std::thread::hardware_concurrency(),
                  get_available_memory_gb());
-  CUOPT_LOG_INFO("CUDA %d.%d, device: %s (ID %d), VRAM: %.2f GiB",
+  CUOPT_LOG_INFO("CUDA %d.%d, device: %s (ID %d), VRAM: %.2f GiB, module loading: %s",
                  major,
                  minor,
                  device_prop.name,
                  device_id,
-                 (double)device_prop.totalGlobalMem / (1024.0 * 1024.0 * 1024.0));
+                 (double)device_prop.totalGlobalMem / (1024.0 * 1024.0 * 1024.0),
+                 get_cuda_module_loading_mode());
   CUOPT_LOG_INFO("CUDA device UUID: %s\n", uuid_str);
 }
 
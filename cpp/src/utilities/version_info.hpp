@@ -1,6 +1,6 @@
 /* clang-format off */
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  */
 /* clang-format on */
@@ -8,4 +8,7 @@
 
 namespace cuopt {
 void print_version_info();
+// "lazy" when the kernels are only loaded at their first launch (CUDA_MODULE_LOADING=LAZY, the
+// default since CUDA 12.2), "eager" when all the kernels are loaded with the context
+const char* get_cuda_module_loading_mode();
 }
@@ -0,0 +1,122 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include "work_unit_calibration.hpp"
+
+#include <mip_heuristics/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace cuopt {
+
+namespace {
+
+// Work estimates of the producers, see record_work_sync_on_horizon and cpu_fj
+constexpr double nnz_per_lp_work_unit   = 1e8;
+constexpr double bytes_per_fj_work_unit = 1e10;
+constexpr int n_repetitions             = 3;
+constexpr size_t n_rows                 = size_t(1) << 16;
+constexpr size_t nnz_per_row            = 16;
+constexpr size_t n_cols                 = size_t(1) << 20;
+constexpr size_t n_updates              = size_t(1) << 22;
+constexpr size_t bytes_per_update       = sizeof(int32_t) + 3 * sizeof(double);
+
+template <typename func_t>
+double min_time(func_t&& func)
+{
+  double best = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < n_repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    best = std::min(
+      best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+}  // namespace
+
+work_unit_calibration_t work_unit_calibration_t::calibrate()
+{
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int32_t> column(0, n_cols - 1);
+
+  // Sparse row products with scattered columns, like the LPs and the bounds strengthening
+  std::vector<int32_t> indices(n_rows * nnz_per_row);
+  std::vector<double> values(indices.size(), 1.0);
+  std::vector<double> x(n_cols, 1.0);
+  std::vector<double> y(n_rows);
+  for (auto& index : indices) {
+    index = column(rng);
+  }
+  const double lp_time = min_time([&]() {
+    for (size_t row = 0; row < n_rows; ++row) {
+      double sum = 0.;
+      for (size_t k = row * nnz_per_row; k < (row + 1) * nnz_per_row; ++k) {
+        sum += values[k] * x[indices[k]];
+      }
+      y[row] = sum;
+    }
+  });
+
+  // Scattered read-modify-writes, like the score and violation updates of the climbers
+  std::vector<int32_t> targets(n_updates);
+  std::vector<double> deltas(n_updates, 1e-3);
+  for (auto& target : targets) {
+    target = column(rng);
+  }
+  const double fj_time = min_time([&]() {
+    for (size_t i = 0; i < n_updates; ++i) {
+      x[targets[i]] += deltas[i];
+    }
+  });
+
+  const double lp_unit_time = lp_time / double(indices.size()) * nnz_per_lp_work_unit;
+  const double fj_unit_time =
+    fj_time / double(n_updates * bytes_per_update) * bytes_per_fj_work_unit;
+
+  work_unit_calibration_t calibration;
+  // keep y and x alive so that the loops are not optimized away
+  if (lp_unit_time > 0. && fj_unit_time > 0. && y[0] + x[0] > 0.) {
+    calibration.cpu_fj_scale = fj_unit_time / lp_unit_time;
+  }
+  CUOPT_LOG_DEBUG("Work unit calibration: %.3fs per B&B unit, %.3fs per CPUFJ unit, scale %g",
+                  lp_unit_time,
+                  fj_unit_time,
+                  calibration.cpu_fj_scale);
+  return calibration;
+}
+
+work_unit_calibration_t work_unit_calibration_t::load_or_calibrate(const std::string& file)
+{
+  work_unit_calibration_t calibration;
+  {
+    std::ifstream in(file);
+    std::string key;
+    double value;
+    if (in >> key >> value && key == "cpu_fj_scale" && value > 0.) {
+      calibration.cpu_fj_scale = value;
+      return calibration;
+    }
+  }
+
+  calibration = calibrate();
+  std::ofstream out(file, std::ios::out | std::ios::trunc);
+  out.precision(17);
+  if (!(out << "cpu_fj_scale " << calibration.cpu_fj_scale << "\n")) {
+    CUOPT_LOG_WARN("Could not write the work unit calibration file %s", file.c_str());
+  }
+  return calibration;
+}
+
+}  // namespace cuopt
@@ -0,0 +1,36 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <string>
+
+namespace cuopt {
+
+/**
+ * @brief Scale of the work estimates of the deterministic producers on this machine
+ *
+ * Branch-and-bound counts its work in nonzeros processed by the LPs and the bounds strengthening,
+ * the CPU climbers in bytes loaded and stored. How long one unit of each takes depends on the
+ * memory system of the host, so on some machines one producer keeps waiting for the others at the
+ * sync barriers. calibrate() times a small kernel of each kind and scales the work of the climbers
+ * so that a work unit of theirs, before the bias that keeps them ahead, takes as long as one of
+ * branch-and-bound. The work units of branch-and-bound, and so the meaning of the work limit, are
+ * left as they are.
+ *
+ * A run is only deterministic for fixed factors: they are measured once and cached in a file.
+ */
+struct work_unit_calibration_t {
+  double cpu_fj_scale{1.0};
+
+  static work_unit_calibration_t calibrate();
+
+  // Reads the factors from the file, or calibrates and writes them when it cannot be read
+  static work_unit_calibration_t load_or_calibrate(const std::string& file);
+};
+
+}  // namespace cuopt
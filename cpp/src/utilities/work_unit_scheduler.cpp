@@ -87,7 +87,7 @@ void work_unit_scheduler_t::wait_for_next_sync(work_limit_context_t& ctx)
 double work_unit_scheduler_t::current_sync_target() const
 {
   if (sync_interval_ <= 0) return std::numeric_limits<double>::infinity();
-  return (barrier_generation_ + 1) * sync_interval_;
+  return current_sync_target_ + sync_interval_;
 }
 
 void work_unit_scheduler_t::wait_at_sync_point(work_limit_context_t& ctx, double sync_target)
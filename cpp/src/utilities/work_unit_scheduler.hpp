@@ -57,6 +57,8 @@ class work_unit_scheduler_t {
   std::vector<std::reference_wrapper<work_limit_context_t>> contexts_;
 
   size_t barrier_generation_{0};
+  // Last sync point reached. The next one is sync_interval_ past it, so the interval can change
+  // between two sync points
   double current_sync_target_{0};
 
   // Sync callback - executed when all contexts reach sync point
@@ -0,0 +1,175 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/bounds_strengthening.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// A chain x[k + 1] <= x[k] over num_chain integer variables, closed by x[0] + x[last] >= 4, and a
+// continuous y <= 2 * x[3] + 2 * x[4]. All variables start in [0, 10], y in [0, 100]
+struct chain_problem_t {
+  static constexpr int num_chain = 15;
+  static constexpr int n         = num_chain + 1;
+  static constexpr int y         = num_chain;
+
+  std::vector<std::vector<double>> rows;
+  std::vector<char> row_sense;
+  std::vector<double> rhs;
+  std::vector<variable_type_t> var_types;
+  std::vector<double> lower;
+  std::vector<double> upper;
+
+  chain_problem_t() : var_types(n, variable_type_t::INTEGER), lower(n, 0.0), upper(n, 10.0)
+  {
+    for (int k = 0; k + 1 < num_chain; ++k) {
+      add_row({{k + 1, 1.0}, {k, -1.0}}, 'L', 0.0);
+    }
+    add_row({{0, 1.0}, {num_chain - 1, 1.0}}, 'G', 4.0);
+    add_row({{y, 1.0}, {3, -2.0}, {4, -2.0}}, 'L', 0.0);
+    var_types[y] = variable_type_t::CONTINUOUS;
+    upper[y]     = 100.0;
+  }
+
+  void add_row(const std::vector<std::pair<int, double>>& coefficients, char sense, double b)
+  {
+    std::vector<double> row(n, 0.0);
+    for (const auto& [j, a] : coefficients) {
+      row[j] = a;
+    }
+    rows.push_back(row);
+    row_sense.push_back(sense);
+    rhs.push_back(b);
+  }
+
+  lp_problem_t<int, double> to_lp() const
+  {
+    const int m = rows.size();
+    int nz      = 0;
+    for (const auto& row : rows) {
+      nz += std::count_if(row.begin(), row.end(), [](double a) { return a != 0.0; });
+    }
+    lp_problem_t<int, double> lp(nullptr, m, n, nz);
+    lp.rhs   = rhs;
+    lp.lower = lower;
+    lp.upper = upper;
+    int p    = 0;
+    for (int j = 0; j < n; ++j) {
+      lp.A.col_start[j] = p;
+      for (int i = 0; i < m; ++i) {
+        if (rows[i][j] == 0.0) { continue; }
+        lp.A.i[p] = i;
+        lp.A.x[p] = rows[i][j];
+        ++p;
+      }
+    }
+    lp.A.col_start[n] = p;
+    return lp;
+  }
+
+  // The propagation as it was before the row queue: full sweeps over every row, repeated until
+  // no bound changes
+  bool full_sweep(std::vector<double>& lb, std::vector<double>& ub, double tol) const
+  {
+    for (bool changed = true; changed;) {
+      changed = false;
+      for (size_t i = 0; i < rows.size(); ++i) {
+        double min_a = 0.0;
+        double max_a = 0.0;
+        for (int j = 0; j < n; ++j) {
+          min_a += rows[i][j] > 0 ? rows[i][j] * lb[j] : rows[i][j] * ub[j];
+          max_a += rows[i][j] > 0 ? rows[i][j] * ub[j] : rows[i][j] * lb[j];
+        }
+        const double row_lb = row_sense[i] == 'L' ? -inf : rhs[i];
+        const double row_ub = row_sense[i] == 'G' ? inf : rhs[i];
+        if (min_a > row_ub + tol || max_a < row_lb - tol) { return false; }
+        for (int j = 0; j < n; ++j) {
+          const double a = rows[i][j];
+          if (a == 0.0) { continue; }
+          // Activity of the other variables of the row
+          const double rest_min = min_a - (a > 0 ? a * lb[j] : a * ub[j]);
+          const double rest_max = max_a - (a > 0 ? a * ub[j] : a * lb[j]);
+          double new_lb = a > 0 ? (row_lb - rest_max) / a : (row_ub - rest_min) / a;
+          double new_ub = a > 0 ? (row_ub - rest_min) / a : (row_lb - rest_max) / a;
+          if (var_types[j] == variable_type_t::INTEGER) {
+            new_lb = std::ceil(new_lb - tol);
+            new_ub = std::floor(new_ub + tol);
+          }
+          if (new_lb > lb[j]) {
+            lb[j]   = new_lb;
+            changed = true;
+          }
+          if (new_ub < ub[j]) {
+            ub[j]   = new_ub;
+            changed = true;
+          }
+          if (lb[j] > ub[j] + tol) { return false; }
+        }
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(bounds_strengthening, row_queue_matches_full_sweep)
+{
+  const chain_problem_t problem;
+  const auto lp = problem.to_lp();
+  csr_matrix_t<int, double> Arow(0, 0, 0);
+  lp.A.to_compressed_row(Arow);
+  simplex_solver_settings_t<int, double> settings;
+  bounds_strengthening_t<int, double> strengthening(lp, Arow, problem.row_sense, problem.var_types);
+
+  // Branching x[0] <= 3 runs down the whole chain, longer than the old limit of 10 passes
+  auto lower       = problem.lower;
+  auto upper       = problem.upper;
+  upper[0]         = 3.0;
+  auto sweep_lower = lower;
+  auto sweep_upper = upper;
+  auto all_lower   = lower;
+  auto all_upper   = upper;
+  ASSERT_TRUE(problem.full_sweep(sweep_lower, sweep_upper, settings.primal_tol));
+
+  std::vector<bool> bounds_changed(chain_problem_t::n, false);
+  bounds_changed[0] = true;
+  ASSERT_TRUE(strengthening.bounds_strengthening(settings, bounds_changed, lower, upper));
+  // Without changed bounds, every row is propagated
+  ASSERT_TRUE(strengthening.bounds_strengthening(settings, {}, all_lower, all_upper));
+  for (int j = 0; j < chain_problem_t::n; ++j) {
+    EXPECT_NEAR(lower[j], sweep_lower[j], settings.primal_tol) << "variable " << j;
+    EXPECT_NEAR(upper[j], sweep_upper[j], settings.primal_tol) << "variable " << j;
+    EXPECT_NEAR(all_lower[j], sweep_lower[j], settings.primal_tol) << "variable " << j;
+    EXPECT_NEAR(all_upper[j], sweep_upper[j], settings.primal_tol) << "variable " << j;
+  }
+  EXPECT_EQ(upper[chain_problem_t::num_chain - 1], 3.0);
+  EXPECT_EQ(lower[0], 1.0);
+  EXPECT_NEAR(upper[chain_problem_t::y], 12.0, settings.primal_tol);
+
+  // The chain also carries the infeasibility of x[last] >= 5
+  constexpr int last   = chain_problem_t::num_chain - 1;
+  lower                = problem.lower;
+  upper                = problem.upper;
+  upper[0]             = 3.0;
+  lower[last]          = 5.0;
+  sweep_lower          = lower;
+  sweep_upper          = upper;
+  bounds_changed[last] = true;
+  EXPECT_FALSE(problem.full_sweep(sweep_lower, sweep_upper, settings.primal_tol));
+  EXPECT_FALSE(strengthening.bounds_strengthening(settings, bounds_changed, lower, upper));
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,245 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/checkpoint.hpp>
+#include <branch_and_bound/node_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+std::string temp_file_path(const std::string& name)
+{
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+bnb_checkpoint_t<int, double> make_checkpoint(int num_open_nodes)
+{
+  bnb_checkpoint_t<int, double> checkpoint;
+  checkpoint.problem_hash = 0x12345678u;
+  checkpoint.incumbent    = {1.0, 0.0, 2.5};
+  checkpoint.pseudo_costs =
+    pseudo_cost_snapshot_t<int, double>({0.5, 1.0, 0.0}, {2.0, 0.25, 0.0}, {1, 4, 0}, {3, 1, 0});
+  for (int k = 0; k < num_open_nodes; ++k) {
+    checkpoint_node_t<int, double> node;
+    // bounds out of order, so that the split has to sort them
+    node.lower_bound        = (k * 7) % num_open_nodes;
+    node.objective_estimate = node.lower_bound + 0.5;
+    node.path.push_back({k % 3, rounding_direction_t::DOWN, 0.0, 0.0});
+    node.path.push_back({(k + 1) % 3, rounding_direction_t::UP, 1.0 + k, 10.0});
+    checkpoint.open_nodes.push_back(node);
+  }
+  return checkpoint;
+}
+
+void expect_same_nodes(const std::vector<checkpoint_node_t<int, double>>& expected,
+                       const std::vector<checkpoint_node_t<int, double>>& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t k = 0; k < expected.size(); ++k) {
+    EXPECT_EQ(expected[k].lower_bound, actual[k].lower_bound);
+    EXPECT_EQ(expected[k].objective_estimate, actual[k].objective_estimate);
+    ASSERT_EQ(expected[k].path.size(), actual[k].path.size());
+    for (size_t p = 0; p < expected[k].path.size(); ++p) {
+      EXPECT_EQ(expected[k].path[p].variable, actual[k].path[p].variable);
+      EXPECT_EQ(expected[k].path[p].direction, actual[k].path[p].direction);
+      EXPECT_EQ(expected[k].path[p].lower, actual[k].path[p].lower);
+      EXPECT_EQ(expected[k].path[p].upper, actual[k].path[p].upper);
+    }
+  }
+}
+
+void expect_same_checkpoint(const bnb_checkpoint_t<int, double>& expected,
+                            const bnb_checkpoint_t<int, double>& actual)
+{
+  EXPECT_EQ(expected.problem_hash, actual.problem_hash);
+  EXPECT_EQ(expected.part_index, actual.part_index);
+  EXPECT_EQ(expected.num_parts, actual.num_parts);
+  EXPECT_EQ(expected.incumbent, actual.incumbent);
+  EXPECT_EQ(expected.pseudo_costs.sum_down_, actual.pseudo_costs.sum_down_);
+  EXPECT_EQ(expected.pseudo_costs.sum_up_, actual.pseudo_costs.sum_up_);
+  EXPECT_EQ(expected.pseudo_costs.num_down_, actual.pseudo_costs.num_down_);
+  EXPECT_EQ(expected.pseudo_costs.num_up_, actual.pseudo_costs.num_up_);
+  expect_same_nodes(expected.open_nodes, actual.open_nodes);
+}
+
+std::vector<variable_status_t> make_basis(int n, int shift)
+{
+  const variable_status_t statuses[] = {variable_status_t::BASIC,
+                                        variable_status_t::NONBASIC_LOWER,
+                                        variable_status_t::NONBASIC_UPPER,
+                                        variable_status_t::NONBASIC_FREE,
+                                        variable_status_t::NONBASIC_FIXED,
+                                        variable_status_t::SUPERBASIC};
+  std::vector<variable_status_t> basis(n);
+  for (int j = 0; j < n; ++j) {
+    basis[j] = statuses[(j + shift) % 6];
+  }
+  return basis;
+}
+
+}  // namespace
+
+TEST(branch_and_bound, checkpoint_write_read_split)
+{
+  const auto checkpoint = make_checkpoint(10);
+  const auto path       = temp_file_path("bnb_checkpoint");
+  ASSERT_TRUE(checkpoint.write(path));
+  bnb_checkpoint_t<int, double> read_checkpoint;
+  ASSERT_TRUE(read_checkpoint.read(path));
+  EXPECT_FALSE(read_checkpoint.is_part());
+  expect_same_checkpoint(checkpoint, read_checkpoint);
+
+  constexpr int num_parts = 3;
+  const auto parts        = split_checkpoint(read_checkpoint, num_parts);
+  ASSERT_EQ(parts.size(), size_t{num_parts});
+  size_t num_split_nodes = 0;
+  for (int k = 0; k < num_parts; ++k) {
+    const auto& part = parts[k];
+    EXPECT_TRUE(part.is_part());
+    EXPECT_EQ(part.part_index, uint32_t(k));
+    EXPECT_EQ(part.num_parts, uint32_t(num_parts));
+    EXPECT_EQ(part.incumbent, checkpoint.incumbent);
+    // Every part gets one of the most promising nodes, dealt in order of their bounds
+    ASSERT_FALSE(part.open_nodes.empty());
+    EXPECT_EQ(part.open_nodes.front().lower_bound, double(k));
+    for (size_t i = 1; i < part.open_nodes.size(); ++i) {
+      EXPECT_LE(part.open_nodes[i - 1].lower_bound, part.open_nodes[i].lower_bound);
+    }
+    num_split_nodes += part.open_nodes.size();
+
+    const auto part_path = path + "." + std::to_string(k);
+    ASSERT_TRUE(part.write(part_path));
+    bnb_checkpoint_t<int, double> read_part;
+    ASSERT_TRUE(read_part.read(part_path));
+    expect_same_checkpoint(part, read_part);
+    std::remove(part_path.c_str());
+  }
+  EXPECT_EQ(num_split_nodes, checkpoint.open_nodes.size());
+
+  // A truncated file is not a checkpoint
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+  bnb_checkpoint_t<int, double> truncated;
+  EXPECT_FALSE(truncated.read(path));
+  EXPECT_TRUE(truncated.open_nodes.empty());
+  std::remove(path.c_str());
+  EXPECT_FALSE(truncated.read(path));
+}
+
+TEST(branch_and_bound, checkpoint_restore_and_collect_open_nodes)
+{
+  constexpr int num_vars = 3;
+  lp_problem_t<int, double> lp(nullptr, 0, num_vars, 0);
+  std::fill(lp.lower.begin(), lp.lower.end(), 0.0);
+  std::fill(lp.upper.begin(), lp.upper.end(), 10.0);
+  const auto basis = make_basis(num_vars, 0);
+
+  // Open nodes sharing the prefix of their paths, siblings have the bound of their parent
+  const std::vector<std::vector<checkpoint_branch_t<int, double>>> paths = {
+    {{0, rounding_direction_t::DOWN, 0.0, 4.0}, {1, rounding_direction_t::DOWN, 0.0, 2.0}},
+    {{0, rounding_direction_t::DOWN, 0.0, 4.0}, {1, rounding_direction_t::UP, 3.0, 10.0}},
+    {{0, rounding_direction_t::UP, 5.0, 10.0},
+     {2, rounding_direction_t::DOWN, 0.0, 7.0},
+     {1, rounding_direction_t::UP, 6.0, 10.0}},
+    {{0, rounding_direction_t::UP, 5.0, 10.0}, {2, rounding_direction_t::UP, 8.0, 10.0}}};
+  const std::vector<double> lower_bounds = {1.5, 1.5, 2.0, 1.0};
+  bnb_checkpoint_t<int, double> checkpoint;
+  for (size_t k = 0; k < paths.size(); ++k) {
+    checkpoint.open_nodes.push_back({lower_bounds[k], lower_bounds[k] + 0.5, paths[k]});
+  }
+  // A node branching on a variable out of range is dropped
+  checkpoint.open_nodes.push_back({0.0, 0.0, {{num_vars, rounding_direction_t::DOWN, 0.0, 0.0}}});
+
+  search_tree_t<int, double> tree(mip_node_t<int, double>(0.0, basis));
+  const auto leaves = restore_open_nodes(tree, lp, checkpoint.open_nodes, basis);
+  ASSERT_EQ(leaves.size(), checkpoint.open_nodes.size() - 1);
+  for (auto* leaf : leaves) {
+    EXPECT_EQ(leaf->status, node_status_t::PENDING);
+    ASSERT_TRUE(leaf->unpack_vstatus());
+    EXPECT_EQ(leaf->vstatus, basis);
+  }
+
+  // Collecting the open nodes of the restored tree gives back the same nodes
+  std::vector<checkpoint_node_t<int, double>> open_nodes;
+  collect_open_nodes(tree.root, open_nodes);
+  checkpoint.open_nodes.pop_back();
+  const auto by_path = [](const auto& a, const auto& b) {
+    return std::lexicographical_compare(
+      a.path.begin(), a.path.end(), b.path.begin(), b.path.end(), [](const auto& x, const auto& y) {
+        return std::tie(x.variable, x.direction, x.lower, x.upper) <
+               std::tie(y.variable, y.direction, y.lower, y.upper);
+      });
+  };
+  std::sort(checkpoint.open_nodes.begin(), checkpoint.open_nodes.end(), by_path);
+  std::sort(open_nodes.begin(), open_nodes.end(), by_path);
+  expect_same_nodes(checkpoint.open_nodes, open_nodes);
+}
+
+TEST(branch_and_bound, node_queue_spill_and_reload)
+{
+  // An odd number of variables, so that the last packed byte is half used
+  constexpr int num_vars = 9;
+  std::vector<std::vector<variable_status_t>> bases;
+  for (int k = 0; k < 3; ++k) {
+    bases.push_back(make_basis(num_vars, k));
+  }
+  std::vector<std::shared_ptr<const packed_vstatus_t>> packed;
+  for (const auto& basis : bases) {
+    packed.push_back(std::make_shared<const packed_vstatus_t>(basis));
+  }
+  const size_t basis_bytes = packed[0]->bytes();
+
+  // Nodes #2 and #3 are siblings sharing the packed basis of their parent
+  const std::vector<int> basis_of_node = {0, 1, 2, 2};
+  std::vector<std::unique_ptr<mip_node_t<int, double>>> nodes;
+  node_queue_t<int, double> queue;
+  for (size_t k = 0; k < basis_of_node.size(); ++k) {
+    nodes.push_back(
+      std::make_unique<mip_node_t<int, double>>(k, std::vector<variable_status_t>{}));
+    nodes[k]->packed_vstatus = packed[basis_of_node[k]];
+    queue.push(nodes[k].get());
+  }
+  EXPECT_EQ(queue.queued_basis_bytes(), nodes.size() * basis_bytes);
+
+  // The siblings have the worst bounds and go first, with a single record for both
+  auto file = std::make_shared<node_spill_file_t>();
+  EXPECT_EQ(queue.spill_bases(2 * basis_bytes, file), 2);
+  EXPECT_EQ(queue.queued_basis_bytes(), 2 * basis_bytes);
+  EXPECT_EQ(file->size(), int64_t(basis_bytes));
+  EXPECT_TRUE(nodes[2]->packed_vstatus->is_spilled());
+  EXPECT_EQ(nodes[2]->packed_vstatus, nodes[3]->packed_vstatus);
+  EXPECT_FALSE(nodes[1]->packed_vstatus->is_spilled());
+
+  // Nodes already spilled are not written again
+  EXPECT_EQ(queue.spill_bases(0, file), 2);
+  EXPECT_EQ(queue.queued_basis_bytes(), size_t{0});
+  EXPECT_EQ(file->size(), int64_t(3 * basis_bytes));
+  EXPECT_EQ(queue.spill_bases(0, file), 0);
+
+  // The nodes come back in best-first order with the bases read back from the file
+  for (size_t k = 0; k < nodes.size(); ++k) {
+    auto node = queue.pop_best_first();
+    ASSERT_TRUE(node.has_value());
+    ASSERT_EQ(node.value(), nodes[k].get());
+    ASSERT_TRUE(node.value()->unpack_vstatus());
+    EXPECT_EQ(node.value()->vstatus, bases[basis_of_node[k]]);
+    EXPECT_EQ(node.value()->packed_vstatus, nullptr);
+  }
+  EXPECT_FALSE(queue.pop_best_first().has_value());
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
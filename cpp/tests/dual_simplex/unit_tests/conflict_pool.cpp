@@ -0,0 +1,192 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/bounds_strengthening.hpp>
+#include <dual_simplex/conflict_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// minimize x0 + 3 x1 + x2 / 2 with x0 + x1 + x2 - s = 0, the x integer in [0, 3] and the slack s
+// continuous in [0, 9]
+struct small_problem_t {
+  static constexpr int n = 4;
+  static constexpr int s = 3;
+
+  small_problem_t() : lp(nullptr, 1, n, n)
+  {
+    lp.rhs       = {0.0};
+    lp.objective = {1.0, 3.0, 0.5, 0.0};
+    lp.lower     = {0.0, 0.0, 0.0, 0.0};
+    lp.upper     = {3.0, 3.0, 3.0, 9.0};
+    for (int j = 0; j < n; ++j) {
+      lp.A.col_start[j] = j;
+      lp.A.i[j]         = 0;
+      lp.A.x[j]         = j == s ? -1.0 : 1.0;
+    }
+    lp.A.col_start[n] = n;
+  }
+
+  // The node problem of lp with these bounds
+  lp_problem_t<int, double> node(const std::vector<double>& lower,
+                                 const std::vector<double>& upper) const
+  {
+    lp_problem_t<int, double> node_problem = lp;
+    node_problem.lower                     = lower;
+    node_problem.upper                     = upper;
+    return node_problem;
+  }
+
+  lp_problem_t<int, double> lp;
+  std::vector<variable_type_t> var_types{variable_type_t::INTEGER,
+                                         variable_type_t::INTEGER,
+                                         variable_type_t::INTEGER,
+                                         variable_type_t::CONTINUOUS};
+};
+
+std::vector<conflict_literal_t<int, double>> conflicts_of(const conflict_pool_t<int, double>& pool,
+                                                          std::vector<int>& starts)
+{
+  std::vector<conflict_literal_t<int, double>> literals;
+  starts.assign(1, 0);
+  pool.copy(0, starts, literals);
+  return literals;
+}
+
+}  // namespace
+
+TEST(conflict_pool, lagrangian_bound_conflict)
+{
+  const small_problem_t problem;
+  simplex_solver_settings_t<int, double> settings;
+  conflict_pool_t<int, double> pool;
+  const std::vector<double> y{0.0};
+  constexpr double cutoff = 3.5;
+
+  // Nothing is collected before the pool is activated
+  auto lower = problem.lp.lower;
+  auto upper = problem.lp.upper;
+  lower[0]   = 1.0;
+  lower[1]   = 1.0;
+  lower[2]   = 2.0;
+  EXPECT_FALSE(pool.analyze(problem.node(lower, upper), y, problem.var_types, cutoff, settings));
+  pool.activate(problem.lp.lower, problem.lp.upper);
+  ASSERT_TRUE(pool.active());
+
+  // The root bounds give no conflict, and neither does a node whose bound is below the cutoff
+  EXPECT_FALSE(pool.analyze(problem.lp, y, problem.var_types, cutoff, settings));
+  auto weak_lower = problem.lp.lower;
+  weak_lower[1]   = 1.0;
+  EXPECT_FALSE(
+    pool.analyze(problem.node(weak_lower, upper), y, problem.var_types, cutoff, settings));
+  EXPECT_EQ(pool.size(), 0);
+
+  // The node bound is 1 + 3 + 1 = 5. Relaxing x0 to its root bound still leaves 4 > 3.5, but also
+  // relaxing x2 would leave 3, so the conflict is x1 >= 1 and x2 >= 2
+  ASSERT_TRUE(pool.analyze(problem.node(lower, upper), y, problem.var_types, cutoff, settings));
+  ASSERT_EQ(pool.size(), 1);
+  std::vector<int> starts;
+  const auto literals = conflicts_of(pool, starts);
+  ASSERT_EQ(starts, (std::vector<int>{0, 2}));
+  std::vector<double> conflict_lower = problem.lp.lower;
+  for (const auto& literal : literals) {
+    EXPECT_TRUE(literal.is_lower);
+    EXPECT_NE(literal.j, 0);
+    EXPECT_EQ(literal.bound, lower[literal.j]);
+    conflict_lower[literal.j] = literal.bound;
+  }
+
+  // Every integer point within the root bounds that satisfies the conflict is above the cutoff
+  for (int x0 = 0; x0 <= 3; ++x0) {
+    for (int x1 = 0; x1 <= 3; ++x1) {
+      for (int x2 = 0; x2 <= 3; ++x2) {
+        const bool satisfies =
+          x0 >= conflict_lower[0] && x1 >= conflict_lower[1] && x2 >= conflict_lower[2];
+        const double objective = x0 + 3.0 * x1 + 0.5 * x2;
+        if (satisfies) { EXPECT_GT(objective, cutoff) << x0 << " " << x1 << " " << x2; }
+      }
+    }
+  }
+
+  // Activating again starts from an empty pool
+  pool.activate(problem.lp.lower, problem.lp.upper);
+  EXPECT_EQ(pool.size(), 0);
+}
+
+TEST(conflict_pool, conflicts_propagate_with_bounds)
+{
+  const small_problem_t problem;
+  simplex_solver_settings_t<int, double> settings;
+  conflict_pool_t<int, double> pool;
+  pool.activate(problem.lp.lower, problem.lp.upper);
+
+  csr_matrix_t<int, double> Arow(0, 0, 0);
+  problem.lp.A.to_compressed_row(Arow);
+  const std::vector<char> row_sense(problem.lp.num_rows, 'E');
+  bounds_strengthening_t<int, double> plain(problem.lp, Arow, row_sense, problem.var_types);
+  bounds_strengthening_t<int, double> with_conflicts(
+    problem.lp, Arow, row_sense, problem.var_types);
+  with_conflicts.set_conflict_pool(&pool);
+
+  // Learn x1 >= 1 and x2 >= 2 after the pool is set, the next call copies it
+  auto node_lower = problem.lp.lower;
+  node_lower[0]   = 1.0;
+  node_lower[1]   = 1.0;
+  node_lower[2]   = 2.0;
+  ASSERT_TRUE(pool.analyze(
+    problem.node(node_lower, problem.lp.upper), {0.0}, problem.var_types, 3.5, settings));
+
+  // Branching on x1 >= 1 leaves x2 >= 2 as the only open literal, so x2 <= 1, and the row then
+  // bounds the slack by 3 + 3 + 1
+  std::vector<bool> bounds_changed(small_problem_t::n, false);
+  auto lower        = problem.lp.lower;
+  auto upper        = problem.lp.upper;
+  lower[1]          = 1.0;
+  bounds_changed[1] = true;
+  auto plain_lower  = lower;
+  auto plain_upper  = upper;
+  ASSERT_TRUE(plain.bounds_strengthening(settings, bounds_changed, plain_lower, plain_upper));
+  ASSERT_TRUE(with_conflicts.bounds_strengthening(settings, bounds_changed, lower, upper));
+  EXPECT_EQ(plain_upper[2], 3.0);
+  EXPECT_EQ(upper[2], 1.0);
+  EXPECT_EQ(plain_upper[small_problem_t::s], 9.0);
+  EXPECT_EQ(upper[small_problem_t::s], 7.0);
+  EXPECT_EQ(lower, plain_lower);
+  EXPECT_EQ(upper[0], plain_upper[0]);
+  EXPECT_EQ(upper[1], plain_upper[1]);
+
+  // A node with both literals is pruned, which the rows alone do not show
+  lower             = problem.lp.lower;
+  upper             = problem.lp.upper;
+  lower[1]          = 1.0;
+  lower[2]          = 2.0;
+  bounds_changed[2] = true;
+  plain_lower       = lower;
+  plain_upper       = upper;
+  EXPECT_TRUE(plain.bounds_strengthening(settings, bounds_changed, plain_lower, plain_upper));
+  EXPECT_FALSE(with_conflicts.bounds_strengthening(settings, bounds_changed, lower, upper));
+
+  // A node that already violates a literal is left to the rows
+  lower             = problem.lp.lower;
+  upper             = problem.lp.upper;
+  upper[2]          = 1.0;
+  bounds_changed.assign(small_problem_t::n, false);
+  bounds_changed[2] = true;
+  plain_lower       = lower;
+  plain_upper       = upper;
+  ASSERT_TRUE(plain.bounds_strengthening(settings, bounds_changed, plain_lower, plain_upper));
+  ASSERT_TRUE(with_conflicts.bounds_strengthening(settings, bounds_changed, lower, upper));
+  EXPECT_EQ(lower, plain_lower);
+  EXPECT_EQ(upper, plain_upper);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
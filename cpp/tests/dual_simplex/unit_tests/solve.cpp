@@ -18,6 +18,9 @@
 
 #include <mps_parser/parser.hpp>
 
+#include <cmath>
+#include <vector>
+
 namespace cuopt::linear_programming::dual_simplex::test {
 
 TEST(dual_simplex, chess_set)
@@ -326,4 +329,87 @@ TEST(dual_simplex, dual_variable_greater_than)
   EXPECT_NEAR(solution.z[1], 0.0, 1e-6);
 }
 
+TEST(dual_simplex, host_pdhg_transportation)
+{
+  // Ship from 3 plants to 4 markets at the lowest cost. The costs and the bounds are picked so
+  // that both the primal and the dual optimum are unique
+  // minimize   sum_ij cost[i][j] * x[i][j]
+  // subject to sum_j x[i][j] <= supply[i]
+  //            sum_i x[i][j] >= demand[j]
+  //            0 <= x[i][j] <= 42
+  constexpr int num_plants  = 3;
+  constexpr int num_markets = 4;
+  const std::vector<double> supply({50, 60, 50});
+  const std::vector<double> demand({30, 40, 35, 45});
+  const std::vector<std::vector<double>> cost(
+    {{4.1, 6.3, 9.2, 5.4}, {7.5, 3.2, 4.7, 8.1}, {6.6, 5.9, 3.3, 7.8}});
+
+  raft::handle_t handle{};
+  dual_simplex::user_problem_t<int, double> user_problem(&handle);
+  constexpr int m  = num_plants + num_markets;
+  constexpr int n  = num_plants * num_markets;
+  constexpr int nz = 2 * n;
+
+  user_problem.num_rows = m;
+  user_problem.num_cols = n;
+  user_problem.objective.resize(n);
+  user_problem.A.m      = m;
+  user_problem.A.n      = n;
+  user_problem.A.nz_max = nz;
+  user_problem.A.reallocate(nz);
+  user_problem.A.col_start.resize(n + 1);
+  user_problem.lower.assign(n, 0.0);
+  user_problem.upper.assign(n, 42.0);
+  for (int i = 0; i < num_plants; ++i) {
+    for (int j = 0; j < num_markets; ++j) {
+      const int k                 = i * num_markets + j;
+      user_problem.objective[k]   = cost[i][j];
+      user_problem.A.col_start[k] = 2 * k;
+      user_problem.A.i[2 * k]     = i;
+      user_problem.A.x[2 * k]     = 1.0;
+      user_problem.A.i[2 * k + 1] = num_plants + j;
+      user_problem.A.x[2 * k + 1] = 1.0;
+    }
+  }
+  user_problem.A.col_start[n] = nz;
+  user_problem.rhs.resize(m);
+  user_problem.row_sense.resize(m);
+  for (int i = 0; i < num_plants; ++i) {
+    user_problem.rhs[i]       = supply[i];
+    user_problem.row_sense[i] = 'L';
+  }
+  for (int j = 0; j < num_markets; ++j) {
+    user_problem.rhs[num_plants + j]       = demand[j];
+    user_problem.row_sense[num_plants + j] = 'G';
+  }
+  user_problem.num_range_rows = 0;
+  user_problem.problem_name   = "transportation";
+  user_problem.obj_constant   = 0.0;
+  user_problem.var_types.assign(n, dual_simplex::variable_type_t::CONTINUOUS);
+
+  dual_simplex::simplex_solver_settings_t<int, double> settings;
+  dual_simplex::lp_solution_t<int, double> simplex(user_problem.num_rows, user_problem.num_cols);
+  ASSERT_EQ((dual_simplex::solve_linear_program(user_problem, settings, simplex)),
+            dual_simplex::lp_status_t::OPTIMAL);
+
+  // The host PDHG reaches the simplex optimum, whatever the number of threads the products are
+  // split over
+  settings.pdhg_relative_tol = 1e-8;
+  for (const int num_threads : {1, 4}) {
+    settings.num_threads = num_threads;
+    dual_simplex::lp_solution_t<int, double> pdhg(user_problem.num_rows, user_problem.num_cols);
+    ASSERT_EQ((dual_simplex::solve_linear_program_with_pdhg(
+                user_problem, settings, dual_simplex::tic(), pdhg)),
+              dual_simplex::lp_status_t::OPTIMAL)
+      << num_threads << " threads";
+    EXPECT_NEAR(pdhg.objective, simplex.objective, 1e-6 * std::abs(simplex.objective));
+    for (int k = 0; k < n; ++k) {
+      EXPECT_NEAR(pdhg.x[k], simplex.x[k], 1e-4) << "x" << k << ", " << num_threads << " threads";
+    }
+    for (int i = 0; i < m; ++i) {
+      EXPECT_NEAR(pdhg.y[i], simplex.y[i], 1e-4) << "y" << i << ", " << num_threads << " threads";
+    }
+  }
+}
+
 }  // namespace cuopt::linear_programming::dual_simplex::test
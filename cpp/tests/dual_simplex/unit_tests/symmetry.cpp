@@ -0,0 +1,317 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/bounds_strengthening.hpp>
+#include <dual_simplex/symmetry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// Equality rows over integer columns and the continuous slacks, as the rows of the problem that
+// branch-and-bound detects the symmetries on
+struct standard_form_t {
+  int n{0};
+  std::vector<std::vector<std::pair<int, double>>> rows;
+  std::vector<double> rhs;
+  std::vector<variable_type_t> var_types;
+  std::vector<double> objective;
+  std::vector<double> lower;
+  std::vector<double> upper;
+
+  int add_column(variable_type_t type, double cost, double lb, double ub)
+  {
+    var_types.push_back(type);
+    objective.push_back(cost);
+    lower.push_back(lb);
+    upper.push_back(ub);
+    return n++;
+  }
+
+  lp_problem_t<int, double> to_lp() const
+  {
+    const int m = rows.size();
+    std::vector<std::vector<std::pair<int, double>>> columns(n);
+    int nz = 0;
+    for (int i = 0; i < m; ++i) {
+      for (const auto& [j, a] : rows[i]) {
+        columns[j].emplace_back(i, a);
+        ++nz;
+      }
+    }
+    lp_problem_t<int, double> lp(nullptr, m, n, nz);
+    lp.rhs       = rhs;
+    lp.objective = objective;
+    lp.lower     = lower;
+    lp.upper     = upper;
+    int p        = 0;
+    for (int j = 0; j < n; ++j) {
+      lp.A.col_start[j] = p;
+      for (const auto& [i, a] : columns[j]) {
+        lp.A.i[p] = i;
+        lp.A.x[p] = a;
+        ++p;
+      }
+    }
+    lp.A.col_start[n] = p;
+    return lp;
+  }
+};
+
+// num_pigeons pigeons in num_holes holes: each pigeon in exactly one hole and at most one pigeon
+// per hole. Any permutation of the pigeons and of the holes is a symmetry
+struct pigeonhole_t : standard_form_t {
+  static constexpr int num_pigeons = 4;
+  static constexpr int num_holes   = 3;
+
+  pigeonhole_t()
+  {
+    for (int k = 0; k < num_pigeons * num_holes; ++k) {
+      add_column(variable_type_t::INTEGER, 0.0, 0.0, 1.0);
+    }
+    for (int p = 0; p < num_pigeons; ++p) {
+      rows.emplace_back();
+      for (int h = 0; h < num_holes; ++h) {
+        rows.back().emplace_back(x(p, h), 1.0);
+      }
+      rhs.push_back(1.0);
+    }
+    for (int h = 0; h < num_holes; ++h) {
+      rows.emplace_back();
+      for (int p = 0; p < num_pigeons; ++p) {
+        rows.back().emplace_back(x(p, h), 1.0);
+      }
+      rows.back().emplace_back(add_column(variable_type_t::CONTINUOUS, 0.0, 0.0, inf), 1.0);
+      rhs.push_back(1.0);
+    }
+  }
+
+  static int x(int p, int h) { return p * num_holes + h; }
+};
+
+// Items of distinct weights packed in identical bins, minimizing the number of bins used. Any
+// permutation of the bins is a symmetry. The columns are y[b] whether bin b is used, x[i][b]
+// whether item i is in bin b, then the slacks of the capacities
+struct bin_packing_t : standard_form_t {
+  static constexpr int num_bins             = 3;
+  static constexpr int num_items            = 4;
+  static constexpr double capacity          = 7.0;
+  static constexpr double weight[num_items] = {5.0, 4.0, 3.0, 2.0};
+
+  bin_packing_t()
+  {
+    for (int b = 0; b < num_bins; ++b) {
+      add_column(variable_type_t::INTEGER, 1.0, 0.0, 1.0);
+    }
+    for (int i = 0; i < num_items; ++i) {
+      for (int b = 0; b < num_bins; ++b) {
+        add_column(variable_type_t::INTEGER, 0.0, 0.0, 1.0);
+      }
+    }
+    for (int i = 0; i < num_items; ++i) {
+      rows.emplace_back();
+      for (int b = 0; b < num_bins; ++b) {
+        rows.back().emplace_back(x(i, b), 1.0);
+      }
+      rhs.push_back(1.0);
+    }
+    for (int b = 0; b < num_bins; ++b) {
+      rows.emplace_back();
+      for (int i = 0; i < num_items; ++i) {
+        rows.back().emplace_back(x(i, b), weight[i]);
+      }
+      rows.back().emplace_back(y(b), -capacity);
+      rows.back().emplace_back(add_column(variable_type_t::CONTINUOUS, 0.0, 0.0, inf), 1.0);
+      rhs.push_back(0.0);
+    }
+  }
+
+  static int y(int b) { return b; }
+  static int x(int i, int b) { return num_bins + i * num_bins + b; }
+  // Index of the item of an x column, -1 for the y columns
+  static int item(int j) { return j < num_bins ? -1 : (j - num_bins) / num_bins; }
+  static int bin(int j) { return j < num_bins ? j : (j - num_bins) % num_bins; }
+
+  // Fewest bins over every assignment of the items and every choice of the used bins, with or
+  // without the orderings
+  static int min_bins(const symmetry_orderings_t<int>* orderings)
+  {
+    constexpr int num_integers = num_bins + num_items * num_bins;
+    int best                   = num_bins + 1;
+    std::vector<int> assignment(num_items, 0);
+    std::vector<double> value(num_integers);
+    while (true) {
+      for (int used = 0; used < (1 << num_bins); ++used) {
+        std::fill(value.begin(), value.end(), 0.0);
+        bool feasible = true;
+        int num_used  = 0;
+        for (int b = 0; b < num_bins; ++b) {
+          value[y(b)] = (used >> b) & 1;
+          num_used += (used >> b) & 1;
+          double load = 0.0;
+          for (int i = 0; i < num_items; ++i) {
+            if (assignment[i] == b) {
+              value[x(i, b)] = 1.0;
+              load += weight[i];
+            }
+          }
+          feasible = feasible && load <= capacity * value[y(b)];
+        }
+        for (int k = 0; orderings != nullptr && k < orderings->num_orderings(); ++k) {
+          feasible = feasible && value[orderings->leader[k]] >= value[orderings->follower[k]];
+        }
+        if (feasible) { best = std::min(best, num_used); }
+      }
+      int i = 0;
+      while (i < num_items && ++assignment[i] == num_bins) {
+        assignment[i++] = 0;
+      }
+      if (i == num_items) { break; }
+    }
+    return best;
+  }
+};
+
+symmetry_orderings_t<int> detect(const standard_form_t& problem)
+{
+  const auto lp = problem.to_lp();
+  csr_matrix_t<int, double> Arow(0, 0, 0);
+  lp.A.to_compressed_row(Arow);
+  simplex_solver_settings_t<int, double> settings;
+  symmetry_orderings_t<int> orderings;
+  detect_symmetry(lp, Arow, problem.var_types, settings, orderings);
+  return orderings;
+}
+
+// The orderings of each column list exactly the orderings it is the leader or the follower of
+void expect_consistent_index(const symmetry_orderings_t<int>& orderings, int n)
+{
+  ASSERT_EQ(orderings.col_start.size(), size_t(n + 1));
+  ASSERT_EQ(orderings.index.size(), size_t(2 * orderings.num_orderings()));
+  for (int j = 0; j < n; ++j) {
+    std::set<int> expected;
+    for (int k = 0; k < orderings.num_orderings(); ++k) {
+      if (orderings.leader[k] == j || orderings.follower[k] == j) { expected.insert(k); }
+    }
+    const std::set<int> actual(orderings.index.begin() + orderings.begin(j),
+                               orderings.index.begin() + orderings.end(j));
+    EXPECT_EQ(actual, expected) << "column " << j;
+  }
+}
+
+}  // namespace
+
+TEST(symmetry, pigeonhole_orbit)
+{
+  const pigeonhole_t problem;
+  const auto orderings = detect(problem);
+  ASSERT_FALSE(orderings.empty());
+  expect_consistent_index(orderings, problem.n);
+
+  // The pigeons and the holes are both permuted, so the first leader has every other x in its
+  // orbit, and the slacks are never ordered
+  constexpr int num_x = pigeonhole_t::num_pigeons * pigeonhole_t::num_holes;
+  std::vector<std::set<int>> followers(problem.n);
+  for (int k = 0; k < orderings.num_orderings(); ++k) {
+    const int leader   = orderings.leader[k];
+    const int follower = orderings.follower[k];
+    EXPECT_NE(leader, follower);
+    EXPECT_LT(leader, num_x);
+    EXPECT_LT(follower, num_x);
+    followers[leader].insert(follower);
+  }
+  const auto first =
+    std::max_element(followers.begin(), followers.end(), [](const auto& a, const auto& b) {
+      return a.size() < b.size();
+    });
+  EXPECT_EQ(first->size(), size_t(num_x - 1));
+  EXPECT_GE(orderings.num_levels, 2);
+}
+
+TEST(symmetry, bin_packing_orderings)
+{
+  const bin_packing_t problem;
+  const auto orderings = detect(problem);
+  ASSERT_FALSE(orderings.empty());
+  expect_consistent_index(orderings, problem.n);
+
+  // Only the bins are symmetric: an ordering is between the y of two bins or the x of one item
+  // in two bins
+  std::set<std::pair<int, int>> pairs;
+  for (int k = 0; k < orderings.num_orderings(); ++k) {
+    const int leader   = orderings.leader[k];
+    const int follower = orderings.follower[k];
+    ASSERT_LT(leader, bin_packing_t::x(bin_packing_t::num_items, 0));
+    ASSERT_LT(follower, bin_packing_t::x(bin_packing_t::num_items, 0));
+    EXPECT_EQ(bin_packing_t::item(leader), bin_packing_t::item(follower));
+    EXPECT_NE(bin_packing_t::bin(leader), bin_packing_t::bin(follower));
+    pairs.emplace(leader, follower);
+  }
+  // The stabilizer chain of the bins fixes one bin per level, and the bins are used in order
+  EXPECT_EQ(orderings.num_levels, bin_packing_t::num_bins - 1);
+  for (int b = 0; b < bin_packing_t::num_bins; ++b) {
+    for (int c = b + 1; c < bin_packing_t::num_bins; ++c) {
+      EXPECT_TRUE(pairs.count({bin_packing_t::y(b), bin_packing_t::y(c)}))
+        << "y" << b << " >= y" << c;
+    }
+  }
+
+  // Some optimal packing satisfies every ordering
+  EXPECT_EQ(bin_packing_t::min_bins(nullptr), 2);
+  EXPECT_EQ(bin_packing_t::min_bins(&orderings), bin_packing_t::min_bins(nullptr));
+}
+
+TEST(symmetry, orderings_propagate_leader_and_follower)
+{
+  const bin_packing_t problem;
+  const auto orderings = detect(problem);
+  ASSERT_FALSE(orderings.empty());
+  const auto lp = problem.to_lp();
+  csr_matrix_t<int, double> Arow(0, 0, 0);
+  lp.A.to_compressed_row(Arow);
+  const std::vector<char> row_sense(lp.num_rows, 'E');
+  simplex_solver_settings_t<int, double> settings;
+  bounds_strengthening_t<int, double> plain(lp, Arow, row_sense, problem.var_types);
+  bounds_strengthening_t<int, double> ordered(lp, Arow, row_sense, problem.var_types);
+  ordered.set_orderings(&orderings);
+  std::vector<bool> bounds_changed(problem.n, false);
+
+  // Using the last bin raises the lower bound of its leaders, the first bins
+  constexpr int last                     = bin_packing_t::num_bins - 1;
+  auto lower                             = problem.lower;
+  auto upper                             = problem.upper;
+  lower[bin_packing_t::y(last)]          = 1.0;
+  bounds_changed[bin_packing_t::y(last)] = true;
+  auto plain_lower                       = lower;
+  auto plain_upper                       = upper;
+  ASSERT_TRUE(plain.bounds_strengthening(settings, bounds_changed, plain_lower, plain_upper));
+  ASSERT_TRUE(ordered.bounds_strengthening(settings, bounds_changed, lower, upper));
+  for (int b = 0; b < last; ++b) {
+    EXPECT_EQ(plain_lower[bin_packing_t::y(b)], 0.0);
+    EXPECT_EQ(lower[bin_packing_t::y(b)], 1.0) << "bin " << b;
+  }
+
+  // Leaving the first bin empty empties every bin, and no item fits anywhere
+  lower                      = problem.lower;
+  upper                      = problem.upper;
+  upper[bin_packing_t::y(0)] = 0.0;
+  bounds_changed.assign(problem.n, false);
+  bounds_changed[bin_packing_t::y(0)] = true;
+  plain_lower                         = lower;
+  plain_upper                         = upper;
+  EXPECT_TRUE(plain.bounds_strengthening(settings, bounds_changed, plain_lower, plain_upper));
+  EXPECT_FALSE(ordered.bounds_strengthening(settings, bounds_changed, lower, upper));
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
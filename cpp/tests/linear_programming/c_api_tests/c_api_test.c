@@ -1039,6 +1039,375 @@ DONE:
   return status;
 }
 
+// Copies size bytes from host to a new device array, NULL on failure
+static void* copy_to_device(const void* host, size_t size)
+{
+  void* device = NULL;
+  if (cudaMalloc(&device, size) != cudaSuccess) { return NULL; }
+  if (cudaMemcpy(device, host, size, cudaMemcpyHostToDevice) != cudaSuccess) {
+    cudaFree(device);
+    return NULL;
+  }
+  return device;
+}
+
+// Builds the problem of test_ranged_problem from device arrays, with
+// cuOptCreateRangedProblemFromDevice when ranged is set and with cuOptCreateProblemFromDevice
+// otherwise, and solves it
+cuopt_int_t test_problem_from_device(cuopt_int_t ranged,
+                                     cuopt_int_t* termination_status_ptr,
+                                     cuopt_float_t* objective_ptr)
+{
+  cuOptOptimizationProblem problem = NULL;
+  cuOptSolverSettings settings = NULL;
+  cuOptSolution solution = NULL;
+  cudaStream_t stream = NULL;
+
+  // maximize obj: 5 * x + 8 * y;
+  // subject to c1: 2*x + 3*y <= 12;
+  // subject to c2: 3*x + y <= 6;
+  // subject to c3: 2 <= x + 2*y <= 8 (x + 2*y <= 8 when not ranged);
+  // subject to x_limit: 0 <= x <= 10;
+  // subject to y_limit: 0 <= y <= 10;
+
+  cuopt_int_t num_variables = 2;
+  cuopt_int_t num_constraints = 3;
+  cuopt_float_t objective_coefficients[] = {5.0, 8.0};
+  cuopt_int_t row_offsets[] = {0, 2, 4, 6};
+  cuopt_int_t column_indices[] = {0, 1, 0, 1, 0, 1};
+  cuopt_float_t values[] = {2.0, 3.0, 3.0, 1.0, 1.0, 2.0};
+  cuopt_float_t constraint_lower_bounds[] = {-CUOPT_INFINITY, -CUOPT_INFINITY, 2.0};
+  cuopt_float_t constraint_upper_bounds[] = {12.0, 6.0, 8.0};
+  char constraint_sense[] = {CUOPT_LESS_THAN, CUOPT_LESS_THAN, CUOPT_LESS_THAN};
+  cuopt_float_t variable_lower_bounds[] = {0.0, 0.0};
+  cuopt_float_t variable_upper_bounds[] = {10.0, 10.0};
+  char variable_types[] = {CUOPT_CONTINUOUS, CUOPT_CONTINUOUS};
+  cuopt_int_t status;
+
+  cuopt_float_t* d_objective_coefficients =
+    copy_to_device(objective_coefficients, sizeof(objective_coefficients));
+  cuopt_int_t* d_row_offsets = copy_to_device(row_offsets, sizeof(row_offsets));
+  cuopt_int_t* d_column_indices = copy_to_device(column_indices, sizeof(column_indices));
+  cuopt_float_t* d_values = copy_to_device(values, sizeof(values));
+  cuopt_float_t* d_constraint_lower_bounds =
+    copy_to_device(constraint_lower_bounds, sizeof(constraint_lower_bounds));
+  cuopt_float_t* d_constraint_upper_bounds =
+    copy_to_device(constraint_upper_bounds, sizeof(constraint_upper_bounds));
+  char* d_constraint_sense = copy_to_device(constraint_sense, sizeof(constraint_sense));
+  cuopt_float_t* d_variable_lower_bounds =
+    copy_to_device(variable_lower_bounds, sizeof(variable_lower_bounds));
+  cuopt_float_t* d_variable_upper_bounds =
+    copy_to_device(variable_upper_bounds, sizeof(variable_upper_bounds));
+  char* d_variable_types = copy_to_device(variable_types, sizeof(variable_types));
+
+  if (d_objective_coefficients == NULL || d_row_offsets == NULL || d_column_indices == NULL ||
+      d_values == NULL || d_constraint_lower_bounds == NULL || d_constraint_upper_bounds == NULL ||
+      d_constraint_sense == NULL || d_variable_lower_bounds == NULL ||
+      d_variable_upper_bounds == NULL || d_variable_types == NULL ||
+      cudaStreamCreate(&stream) != cudaSuccess) {
+    printf("Error copying the problem to the device\n");
+    status = -1;
+    goto DONE;
+  }
+
+  // A missing array is rejected
+  status = cuOptCreateRangedProblemFromDevice(num_constraints,
+                                              num_variables,
+                                              CUOPT_MAXIMIZE,
+                                              0.0,
+                                              d_objective_coefficients,
+                                              d_row_offsets,
+                                              d_column_indices,
+                                              d_values,
+                                              d_constraint_lower_bounds,
+                                              d_constraint_upper_bounds,
+                                              d_variable_lower_bounds,
+                                              NULL,
+                                              d_variable_types,
+                                              stream,
+                                              &problem);
+  if (status != CUOPT_INVALID_ARGUMENT) {
+    printf("Error: expected CUOPT_INVALID_ARGUMENT for a missing array, got %d\n", status);
+    status = -1;
+    goto DONE;
+  }
+
+  if (ranged) {
+    status = cuOptCreateRangedProblemFromDevice(num_constraints,
+                                                num_variables,
+                                                CUOPT_MAXIMIZE,
+                                                0.0,
+                                                d_objective_coefficients,
+                                                d_row_offsets,
+                                                d_column_indices,
+                                                d_values,
+                                                d_constraint_lower_bounds,
+                                                d_constraint_upper_bounds,
+                                                d_variable_lower_bounds,
+                                                d_variable_upper_bounds,
+                                                d_variable_types,
+                                                stream,
+                                                &problem);
+  } else {
+    status = cuOptCreateProblemFromDevice(num_constraints,
+                                          num_variables,
+                                          CUOPT_MAXIMIZE,
+                                          0.0,
+                                          d_objective_coefficients,
+                                          d_row_offsets,
+                                          d_column_indices,
+                                          d_values,
+                                          d_constraint_sense,
+                                          d_constraint_upper_bounds,
+                                          d_variable_lower_bounds,
+                                          d_variable_upper_bounds,
+                                          d_variable_types,
+                                          stream,
+                                          &problem);
+  }
+  if (status != CUOPT_SUCCESS) {
+    printf("Error creating problem from device arrays\n");
+    goto DONE;
+  }
+
+  // The problem holds its own copy, the device arrays can go
+  cudaFree(d_objective_coefficients);
+  cudaFree(d_row_offsets);
+  cudaFree(d_column_indices);
+  cudaFree(d_values);
+  cudaFree(d_constraint_lower_bounds);
+  cudaFree(d_constraint_upper_bounds);
+  cudaFree(d_constraint_sense);
+  cudaFree(d_variable_lower_bounds);
+  cudaFree(d_variable_upper_bounds);
+  cudaFree(d_variable_types);
+  d_objective_coefficients = NULL;
+  d_row_offsets = NULL;
+  d_column_indices = NULL;
+  d_values = NULL;
+  d_constraint_lower_bounds = NULL;
+  d_constraint_upper_bounds = NULL;
+  d_constraint_sense = NULL;
+  d_variable_lower_bounds = NULL;
+  d_variable_upper_bounds = NULL;
+  d_variable_types = NULL;
+
+  status = cuOptCreateSolverSettings(&settings);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error creating solver settings\n");
+    goto DONE;
+  }
+
+  status = cuOptSetIntegerParameter(settings, CUOPT_METHOD, CUOPT_METHOD_DUAL_SIMPLEX);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error setting parameter\n");
+    goto DONE;
+  }
+
+  status = cuOptSolve(problem, settings, &solution);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error solving problem\n");
+    goto DONE;
+  }
+
+  status = cuOptGetTerminationStatus(solution, termination_status_ptr);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error getting termination status\n");
+    goto DONE;
+  }
+
+  status = cuOptGetObjectiveValue(solution, objective_ptr);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error getting objective value\n");
+    goto DONE;
+  }
+
+DONE:
+  cuOptDestroyProblem(&problem);
+  cuOptDestroySolverSettings(&settings);
+  cuOptDestroySolution(&solution);
+  cudaFree(d_objective_coefficients);
+  cudaFree(d_row_offsets);
+  cudaFree(d_column_indices);
+  cudaFree(d_values);
+  cudaFree(d_constraint_lower_bounds);
+  cudaFree(d_constraint_upper_bounds);
+  cudaFree(d_constraint_sense);
+  cudaFree(d_variable_lower_bounds);
+  cudaFree(d_variable_upper_bounds);
+  cudaFree(d_variable_types);
+  if (stream != NULL) { cudaStreamDestroy(stream); }
+
+  return status;
+}
+
+// Solves the problem of test_ranged_problem, as a MIP when test_mip is set, lowers the upper
+// bound of y to 3, solves it again, then solves a problem of another size with the same settings.
+// The objective of the second solve is returned. The last solve only succeeds if the warm start
+// of the second solve did not leave its initial solution in the settings
+cuopt_int_t test_modify_and_resolve(cuopt_int_t test_mip,
+                                    cuopt_int_t* termination_status_ptr,
+                                    cuopt_float_t* objective_ptr)
+{
+  cuOptOptimizationProblem problem = NULL;
+  cuOptOptimizationProblem other_problem = NULL;
+  cuOptSolverSettings settings = NULL;
+  cuOptSolution solution = NULL;
+
+  // maximize obj: 5 * x + 8 * y;
+  // subject to c1: 2*x + 3*y <= 12;
+  // subject to c2: 3*x + y <= 6;
+  // subject to c3: 2 <= x + 2*y <= 8;
+  // subject to x_limit: 0 <= x <= 10;
+  // subject to y_limit: 0 <= y <= 10, then 0 <= y <= 3;
+
+  cuopt_int_t num_variables = 2;
+  cuopt_int_t num_constraints = 3;
+  cuopt_float_t objective_coefficients[] = {5.0, 8.0};
+  cuopt_int_t row_offsets[] = {0, 2, 4, 6};
+  cuopt_int_t column_indices[] = {0, 1, 0, 1, 0, 1};
+  cuopt_float_t values[] = {2.0, 3.0, 3.0, 1.0, 1.0, 2.0};
+  cuopt_float_t constraint_lower_bounds[] = {-CUOPT_INFINITY, -CUOPT_INFINITY, 2.0};
+  cuopt_float_t constraint_upper_bounds[] = {12.0, 6.0, 8.0};
+  cuopt_float_t variable_lower_bounds[] = {0.0, 0.0};
+  cuopt_float_t variable_upper_bounds[] = {10.0, 10.0};
+  char variable_types[] = {CUOPT_CONTINUOUS, CUOPT_CONTINUOUS};
+  cuopt_int_t modified_index = 1;
+  cuopt_float_t modified_lower_bound = 0.0;
+  cuopt_float_t modified_upper_bound = 3.0;
+
+  // maximize x1 + x2 + x3 subject to x1 + x2 + x3 <= 2, 0 <= x <= 1
+  cuopt_float_t other_objective_coefficients[] = {1.0, 1.0, 1.0};
+  cuopt_int_t other_row_offsets[] = {0, 3};
+  cuopt_int_t other_column_indices[] = {0, 1, 2};
+  cuopt_float_t other_values[] = {1.0, 1.0, 1.0};
+  char other_constraint_sense[] = {CUOPT_LESS_THAN};
+  cuopt_float_t other_rhs[] = {2.0};
+  cuopt_float_t other_lower_bounds[] = {0.0, 0.0, 0.0};
+  cuopt_float_t other_upper_bounds[] = {1.0, 1.0, 1.0};
+  char other_variable_types[] = {CUOPT_CONTINUOUS, CUOPT_CONTINUOUS, CUOPT_CONTINUOUS};
+  cuopt_float_t other_objective;
+  cuopt_int_t status;
+
+  if (test_mip) {
+    variable_types[0] = CUOPT_INTEGER;
+    variable_types[1] = CUOPT_INTEGER;
+    other_variable_types[0] = CUOPT_INTEGER;
+    other_variable_types[1] = CUOPT_INTEGER;
+    other_variable_types[2] = CUOPT_INTEGER;
+  }
+
+  status = cuOptCreateRangedProblem(num_constraints,
+                                    num_variables,
+                                    CUOPT_MAXIMIZE,
+                                    0.0,
+                                    objective_coefficients,
+                                    row_offsets,
+                                    column_indices,
+                                    values,
+                                    constraint_lower_bounds,
+                                    constraint_upper_bounds,
+                                    variable_lower_bounds,
+                                    variable_upper_bounds,
+                                    variable_types,
+                                    &problem);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error creating problem\n");
+    goto DONE;
+  }
+
+  status = cuOptCreateSolverSettings(&settings);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error creating solver settings\n");
+    goto DONE;
+  }
+
+  if (!test_mip) {
+    status = cuOptSetIntegerParameter(settings, CUOPT_METHOD, CUOPT_METHOD_DUAL_SIMPLEX);
+    if (status != CUOPT_SUCCESS) {
+      printf("Error setting parameter\n");
+      goto DONE;
+    }
+  }
+
+  status = cuOptSolve(problem, settings, &solution);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error solving problem\n");
+    goto DONE;
+  }
+  cuOptDestroySolution(&solution);
+
+  status = cuOptSetVariableBounds(
+    problem, 1, &modified_index, &modified_lower_bound, &modified_upper_bound);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error setting variable bounds\n");
+    goto DONE;
+  }
+
+  status = cuOptSolve(problem, settings, &solution);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error solving modified problem\n");
+    goto DONE;
+  }
+
+  status = cuOptGetTerminationStatus(solution, termination_status_ptr);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error getting termination status\n");
+    goto DONE;
+  }
+
+  status = cuOptGetObjectiveValue(solution, objective_ptr);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error getting objective value\n");
+    goto DONE;
+  }
+  cuOptDestroySolution(&solution);
+
+  status = cuOptCreateProblem(1,
+                              3,
+                              CUOPT_MAXIMIZE,
+                              0.0,
+                              other_objective_coefficients,
+                              other_row_offsets,
+                              other_column_indices,
+                              other_values,
+                              other_constraint_sense,
+                              other_rhs,
+                              other_lower_bounds,
+                              other_upper_bounds,
+                              other_variable_types,
+                              &other_problem);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error creating other problem\n");
+    goto DONE;
+  }
+
+  status = cuOptSolve(other_problem, settings, &solution);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error solving other problem with the same settings\n");
+    goto DONE;
+  }
+
+  status = cuOptGetObjectiveValue(solution, &other_objective);
+  if (status != CUOPT_SUCCESS) {
+    printf("Error getting objective value\n");
+    goto DONE;
+  }
+  if (other_objective < 2.0 - 1e-3 || other_objective > 2.0 + 1e-3) {
+    printf("Error: expected objective 2 for the other problem, but got %f\n", other_objective);
+    status = -1;
+    goto DONE;
+  }
+
+DONE:
+  cuOptDestroyProblem(&problem);
+  cuOptDestroyProblem(&other_problem);
+  cuOptDestroySolverSettings(&settings);
+  cuOptDestroySolution(&solution);
+
+  return status;
+}
+
 // Test invalid bounds scenario (what MOI wrapper was producing)
 cuopt_int_t test_invalid_bounds(cuopt_int_t test_mip)
 {
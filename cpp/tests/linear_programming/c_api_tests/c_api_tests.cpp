@@ -16,6 +16,9 @@
 #include <utilities/common_utils.hpp>
 #include <utilities/error.hpp>
 
+#include <rmm/cuda_device.hpp>
+#include <rmm/mr/per_device_resource.hpp>
+
 #include <gtest/gtest.h>
 
 TEST(c_api, int_size) { EXPECT_EQ(test_int_size(), sizeof(int32_t)); }
@@ -111,6 +114,29 @@ TEST(c_api, test_ranged_problem)
   EXPECT_NEAR(objective, 32.0, 1e-3);
 }
 
+TEST(c_api, test_problem_from_device)
+{
+  for (cuopt_int_t ranged : {0, 1}) {
+    cuopt_int_t termination_status;
+    cuopt_float_t objective;
+    EXPECT_EQ(test_problem_from_device(ranged, &termination_status, &objective), CUOPT_SUCCESS);
+    EXPECT_EQ(termination_status, CUOPT_TERIMINATION_STATUS_OPTIMAL);
+    EXPECT_NEAR(objective, 32.0, 1e-3);
+  }
+}
+
+TEST(c_api, test_modify_and_resolve)
+{
+  // Test LP codepath, then MIP codepath
+  for (cuopt_int_t test_mip : {0, 1}) {
+    cuopt_int_t termination_status;
+    cuopt_float_t objective;
+    EXPECT_EQ(test_modify_and_resolve(test_mip, &termination_status, &objective), CUOPT_SUCCESS);
+    EXPECT_EQ(termination_status, CUOPT_TERIMINATION_STATUS_OPTIMAL);
+    EXPECT_NEAR(objective, 29.0, 1e-3);
+  }
+}
+
 TEST(c_api, test_invalid_bounds)
 {
   // Test LP codepath
@@ -164,6 +190,107 @@ TEST(c_api, test_maximize_problem_dual_variables)
   }
 }
 
+// Solves maximize x1 + x2 + x3 subject to x1 + x2 + x3 <= 2, 0 <= x <= 1 in the current context
+static cuopt_int_t solve_in_current_context(cuopt_float_t* objective_ptr)
+{
+  cuopt_float_t objective_coefficients[] = {1.0, 1.0, 1.0};
+  cuopt_int_t row_offsets[]              = {0, 3};
+  cuopt_int_t column_indices[]           = {0, 1, 2};
+  cuopt_float_t values[]                 = {1.0, 1.0, 1.0};
+  char constraint_sense[]                = {CUOPT_LESS_THAN};
+  cuopt_float_t rhs[]                    = {2.0};
+  cuopt_float_t lower_bounds[]           = {0.0, 0.0, 0.0};
+  cuopt_float_t upper_bounds[]           = {1.0, 1.0, 1.0};
+  char variable_types[]                  = {CUOPT_CONTINUOUS, CUOPT_CONTINUOUS, CUOPT_CONTINUOUS};
+
+  cuOptOptimizationProblem problem = nullptr;
+  cuOptSolverSettings settings     = nullptr;
+  cuOptSolution solution           = nullptr;
+  cuopt_int_t status               = cuOptCreateProblem(1,
+                                                        3,
+                                                        CUOPT_MAXIMIZE,
+                                                        0.0,
+                                                        objective_coefficients,
+                                                        row_offsets,
+                                                        column_indices,
+                                                        values,
+                                                        constraint_sense,
+                                                        rhs,
+                                                        lower_bounds,
+                                                        upper_bounds,
+                                                        variable_types,
+                                                        &problem);
+  if (status == CUOPT_SUCCESS) { status = cuOptCreateSolverSettings(&settings); }
+  if (status == CUOPT_SUCCESS) {
+    status = cuOptSetIntegerParameter(settings, CUOPT_METHOD, CUOPT_METHOD_DUAL_SIMPLEX);
+  }
+  if (status == CUOPT_SUCCESS) { status = cuOptSolve(problem, settings, &solution); }
+  if (status == CUOPT_SUCCESS) { status = cuOptGetObjectiveValue(solution, objective_ptr); }
+  cuOptDestroySolution(&solution);
+  cuOptDestroySolverSettings(&settings);
+  cuOptDestroyProblem(&problem);
+  return status;
+}
+
+TEST(c_api, two_solver_contexts)
+{
+  const auto device                 = rmm::get_current_cuda_device();
+  auto* const original_resource     = rmm::mr::get_per_device_resource(device);
+  cuOptSolverContext first_context  = nullptr;
+  cuOptSolverContext second_context = nullptr;
+  ASSERT_EQ(cuOptCreateSolverContext(&first_context), CUOPT_SUCCESS);
+  auto* const pool_resource = rmm::mr::get_per_device_resource(device);
+  EXPECT_NE(pool_resource, original_resource);
+  ASSERT_EQ(cuOptCreateSolverContext(&second_context), CUOPT_SUCCESS);
+  // The contexts of a device share its pool
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), pool_resource);
+
+  for (auto context : {first_context, second_context}) {
+    cuopt_float_t objective;
+    ASSERT_EQ(cuOptSetSolverContext(context), CUOPT_SUCCESS);
+    EXPECT_EQ(solve_in_current_context(&objective), CUOPT_SUCCESS);
+    EXPECT_NEAR(objective, 2.0, 1e-6);
+  }
+
+  cuOptDestroySolverContext(&second_context);
+  EXPECT_EQ(second_context, nullptr);
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), pool_resource);
+  cuOptDestroySolverContext(&first_context);
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), original_resource);
+}
+
+TEST(c_api, solver_contexts_destroyed_out_of_order)
+{
+  const auto device                 = rmm::get_current_cuda_device();
+  auto* const original_resource     = rmm::mr::get_per_device_resource(device);
+  cuOptSolverContext first_context  = nullptr;
+  cuOptSolverContext second_context = nullptr;
+  ASSERT_EQ(cuOptCreateSolverContext(&first_context), CUOPT_SUCCESS);
+  ASSERT_EQ(cuOptCreateSolverContext(&second_context), CUOPT_SUCCESS);
+  auto* const pool_resource = rmm::mr::get_per_device_resource(device);
+
+  // The first context goes before the second, which keeps the pool installed and still solves
+  ASSERT_EQ(cuOptSetSolverContext(first_context), CUOPT_SUCCESS);
+  cuOptDestroySolverContext(&first_context);
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), pool_resource);
+  cuopt_float_t objective;
+  ASSERT_EQ(cuOptSetSolverContext(second_context), CUOPT_SUCCESS);
+  EXPECT_EQ(solve_in_current_context(&objective), CUOPT_SUCCESS);
+  EXPECT_NEAR(objective, 2.0, 1e-6);
+  cuOptDestroySolverContext(&second_context);
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), original_resource);
+
+  // A new context after all of them were destroyed installs a pool again
+  cuOptSolverContext context = nullptr;
+  ASSERT_EQ(cuOptCreateSolverContext(&context), CUOPT_SUCCESS);
+  EXPECT_NE(rmm::mr::get_per_device_resource(device), original_resource);
+  ASSERT_EQ(cuOptSetSolverContext(context), CUOPT_SUCCESS);
+  EXPECT_EQ(solve_in_current_context(&objective), CUOPT_SUCCESS);
+  EXPECT_NEAR(objective, 2.0, 1e-6);
+  cuOptDestroySolverContext(&context);
+  EXPECT_EQ(rmm::mr::get_per_device_resource(device), original_resource);
+}
+
 static bool test_mps_roundtrip(const std::string& mps_file_path)
 {
   using cuopt::linear_programming::problem_and_stream_view_t;
@@ -31,6 +31,12 @@ cuopt_int_t test_bad_parameter_name();
 cuopt_int_t test_mip_get_callbacks_only();
 cuopt_int_t test_mip_get_set_callbacks();
 cuopt_int_t test_ranged_problem(cuopt_int_t* termination_status_ptr, cuopt_float_t* objective_ptr);
+cuopt_int_t test_problem_from_device(cuopt_int_t ranged,
+                                     cuopt_int_t* termination_status_ptr,
+                                     cuopt_float_t* objective_ptr);
+cuopt_int_t test_modify_and_resolve(cuopt_int_t test_mip,
+                                    cuopt_int_t* termination_status_ptr,
+                                    cuopt_float_t* objective_ptr);
 cuopt_int_t test_invalid_bounds(cuopt_int_t test_mip);
 cuopt_int_t test_quadratic_problem(cuopt_int_t* termination_status_ptr,
                                    cuopt_float_t* objective_ptr);
@@ -28,6 +28,7 @@
 
 #include <raft/sparse/detail/cusparse_wrappers.h>
 #include <raft/core/cusparse_macros.hpp>
+#include <raft/core/device_setter.hpp>
 #include <raft/core/handle.hpp>
 #include <raft/util/cudart_utils.hpp>
 
@@ -37,9 +38,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <filesystem>
 #include <sstream>
 #include <vector>
 
@@ -73,6 +76,287 @@ TEST(pdlp_class, run_double)
     afiro_primal_objective, solution.get_additional_termination_information().primal_objective));
 }
 
+TEST(pdlp_class, run_double_fused_spmv_projection)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  auto solver_settings             = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method           = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.pdlp_solver_mode = cuopt::linear_programming::pdlp_solver_mode_t::Stable3;
+
+  optimization_problem_solution_t<int, double> reference_solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+
+  solver_settings.hyper_params.use_fused_spmv_projection = true;
+  optimization_problem_solution_t<int, double> fused_solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+
+  const auto reference_info = reference_solution.get_additional_termination_information();
+  const auto fused_info     = fused_solution.get_additional_termination_information();
+  EXPECT_EQ((int)fused_solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_FALSE(is_incorrect_objective(afiro_primal_objective, fused_info.primal_objective));
+  // Only the summation order differs from cuSPARSE, convergence should be almost identical
+  EXPECT_NEAR(reference_info.number_of_steps_taken,
+              fused_info.number_of_steps_taken,
+              0.1 * reference_info.number_of_steps_taken);
+}
+
+TEST(pdlp_class, run_double_mixed_precision_spmv)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  auto solver_settings             = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method           = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.pdlp_solver_mode = cuopt::linear_programming::pdlp_solver_mode_t::Stable3;
+  solver_settings.hyper_params.use_mixed_precision_spmv = true;
+
+  optimization_problem_solution_t<int, double> solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_FALSE(is_incorrect_objective(
+    afiro_primal_objective, solution.get_additional_termination_information().primal_objective));
+}
+
+TEST(pdlp_class, run_double_multi_gpu)
+{
+  if (raft::device_setter::get_device_count() < 2) { GTEST_SKIP() << "Needs at least 2 GPUs"; }
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  auto solver_settings             = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method           = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.pdlp_solver_mode = cuopt::linear_programming::pdlp_solver_mode_t::Stable3;
+
+  optimization_problem_solution_t<int, double> reference_solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+
+  // Rows split over two GPUs
+  solver_settings.num_gpus = 2;
+  optimization_problem_solution_t<int, double> solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+
+  const auto reference_info = reference_solution.get_additional_termination_information();
+  const auto info           = solution.get_additional_termination_information();
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_FALSE(is_incorrect_objective(afiro_primal_objective, info.primal_objective));
+  EXPECT_FALSE(is_incorrect_objective(reference_info.primal_objective, info.primal_objective));
+  EXPECT_EQ((int)solution.get_primal_solution().size(), op_problem.get_n_variables());
+  EXPECT_EQ((int)solution.get_dual_solution().size(), op_problem.get_n_constraints());
+}
+
+TEST(pdlp_class, run_double_speculative_step_sizes)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  // Stable1 uses the adaptive step size strategy
+  auto solver_settings             = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method           = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.pdlp_solver_mode = cuopt::linear_programming::pdlp_solver_mode_t::Stable1;
+
+  optimization_problem_solution_t<int, double> reference_solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+
+  for (int n_candidates : {2, 3}) {
+    solver_settings.hyper_params.speculative_step_size_candidates = n_candidates;
+    optimization_problem_solution_t<int, double> solution =
+      solve_lp(&handle_, op_problem, solver_settings);
+    EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+    EXPECT_NEAR(reference_solution.get_additional_termination_information().primal_objective,
+                solution.get_additional_termination_information().primal_objective,
+                1e-2 * std::abs(afiro_primal_objective));
+  }
+}
+
+TEST(pdlp_class, run_double_phase_timings)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  auto solver_settings                  = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method                = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver             = presolver_t::None;
+  solver_settings.collect_phase_timings = true;
+
+  optimization_problem_solution_t<int, double> solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  const auto info = solution.get_additional_termination_information();
+  EXPECT_GT(info.pdhg_step_time, 0.0);
+  EXPECT_GT(info.termination_check_time, 0.0);
+  EXPECT_GE(info.restart_time, 0.0);
+  EXPECT_LE(info.pdhg_step_time + info.step_size_time + info.restart_time +
+              info.termination_check_time,
+            info.solve_time);
+}
+
+TEST(pdlp_class, run_double_gpu_presolve)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+  // Fix the first variable so the GPU presolve has a column to remove
+  op_problem.get_variable_upper_bounds()[0] = op_problem.get_variable_lower_bounds()[0];
+
+  auto solver_settings      = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver = presolver_t::None;
+  optimization_problem_solution_t<int, double> reference =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)reference.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+
+  solver_settings.presolver = presolver_t::GPU;
+  optimization_problem_solution_t<int, double> solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_NEAR(solution.get_additional_termination_information().primal_objective,
+              reference.get_additional_termination_information().primal_objective,
+              1e-4 * std::abs(reference.get_additional_termination_information().primal_objective));
+  EXPECT_EQ(solution.get_primal_solution().size(), op_problem.get_objective_coefficients().size());
+  EXPECT_EQ((int)solution.get_dual_solution().size(), op_problem.get_n_constraints());
+  EXPECT_EQ(solution.get_reduced_cost().size(), op_problem.get_objective_coefficients().size());
+}
+
+#if PDLP_INSTANTIATE_INT64
+TEST(pdlp_class, run_double_int64_indices)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  // Same problem with 64-bit offsets and column indices
+  cuopt::mps_parser::mps_data_model_t<int64_t, double> op_problem_64;
+  const std::vector<int64_t> indices(op_problem.get_constraint_matrix_indices().begin(),
+                                     op_problem.get_constraint_matrix_indices().end());
+  const std::vector<int64_t> offsets(op_problem.get_constraint_matrix_offsets().begin(),
+                                     op_problem.get_constraint_matrix_offsets().end());
+  op_problem_64.set_csr_constraint_matrix(op_problem.get_constraint_matrix_values().data(),
+                                          op_problem.get_constraint_matrix_values().size(),
+                                          indices.data(),
+                                          indices.size(),
+                                          offsets.data(),
+                                          offsets.size());
+  op_problem_64.set_constraint_bounds(op_problem.get_constraint_bounds().data(),
+                                      op_problem.get_constraint_bounds().size());
+  op_problem_64.set_row_types(op_problem.get_row_types().data(), op_problem.get_row_types().size());
+  op_problem_64.set_objective_coefficients(op_problem.get_objective_coefficients().data(),
+                                           op_problem.get_objective_coefficients().size());
+  op_problem_64.set_objective_offset(op_problem.get_objective_offset());
+  op_problem_64.set_variable_lower_bounds(op_problem.get_variable_lower_bounds().data(),
+                                          op_problem.get_variable_lower_bounds().size());
+  op_problem_64.set_variable_upper_bounds(op_problem.get_variable_upper_bounds().data(),
+                                          op_problem.get_variable_upper_bounds().size());
+  op_problem_64.set_maximize(op_problem.get_sense());
+
+  auto solver_settings      = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver = presolver_t::None;
+  optimization_problem_solution_t<int, double> reference =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)reference.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+
+  auto solver_settings_64      = pdlp_solver_settings_t<int64_t, double>{};
+  solver_settings_64.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings_64.presolver = presolver_t::None;
+  optimization_problem_solution_t<int64_t, double> solution =
+    solve_lp(&handle_, op_problem_64, solver_settings_64);
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+
+  // Only the index type of the products differs, the iterates should follow the 32-bit run
+  const auto reference_info = reference.get_additional_termination_information();
+  const auto info           = solution.get_additional_termination_information();
+  EXPECT_NEAR(info.primal_objective,
+              reference_info.primal_objective,
+              1e-4 * std::abs(reference_info.primal_objective));
+  EXPECT_NEAR(info.number_of_steps_taken,
+              reference_info.number_of_steps_taken,
+              0.1 * reference_info.number_of_steps_taken);
+  const auto primal           = host_copy(solution.get_primal_solution(), handle_.get_stream());
+  const auto reference_primal = host_copy(reference.get_primal_solution(), handle_.get_stream());
+  ASSERT_EQ(primal.size(), reference_primal.size());
+  for (size_t j = 0; j < primal.size(); ++j) {
+    EXPECT_NEAR(
+      primal[j], reference_primal[j], 1e-3 * std::max(1.0, std::abs(reference_primal[j])))
+      << "variable " << j;
+  }
+}
+#endif
+
+TEST(pdlp_class, run_double_lp_sequence)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> mps_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+  auto op_problem = mps_data_model_to_optimization_problem(&handle_, mps_problem);
+
+  auto solver_settings      = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver = cuopt::linear_programming::presolver_t::None;
+
+  // Base problem then twice the same problem with a doubled objective
+  std::vector<lp_variant_t<int, double>> variants(3);
+  variants[1].objective_coefficients = mps_problem.get_objective_coefficients();
+  for (auto& c : variants[1].objective_coefficients) {
+    c *= 2;
+  }
+  variants[2] = variants[1];
+
+  std::vector<double> objectives(variants.size(), 0.0);
+  std::vector<int> iterations(variants.size(), 0);
+  solve_lp_sequence<int, double>(
+    op_problem,
+    variants,
+    [&](size_t v, optimization_problem_solution_t<int, double>& solution) {
+      EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+      objectives[v] = solution.get_additional_termination_information().primal_objective;
+      iterations[v] = solution.get_additional_termination_information().number_of_steps_taken;
+    },
+    solver_settings);
+  EXPECT_FALSE(is_incorrect_objective(afiro_primal_objective, objectives[0]));
+  EXPECT_FALSE(is_incorrect_objective(2 * afiro_primal_objective, objectives[1]));
+  EXPECT_FALSE(is_incorrect_objective(2 * afiro_primal_objective, objectives[2]));
+  // Started from the scaling, solutions and step size of the same problem, it converges quicker
+  EXPECT_LT(iterations[2], iterations[0]);
+
+  // Base problem is restored
+  auto restored_objective =
+    host_copy(op_problem.get_objective_coefficients(), handle_.get_stream());
+  EXPECT_EQ(restored_objective, mps_problem.get_objective_coefficients());
+
+  // Also when a variant is rejected after the objective was already swapped
+  variants[1].variable_lower_bounds.assign(1, 0.0);
+  EXPECT_ANY_THROW((solve_lp_sequence<int, double>(
+    op_problem,
+    variants,
+    [](size_t, optimization_problem_solution_t<int, double>&) {},
+    solver_settings)));
+  restored_objective = host_copy(op_problem.get_objective_coefficients(), handle_.get_stream());
+  EXPECT_EQ(restored_objective, mps_problem.get_objective_coefficients());
+}
+
 TEST(pdlp_class, run_double_very_low_accuracy)
 {
   const raft::handle_t handle_{};
@@ -121,6 +405,78 @@ TEST(pdlp_class, run_double_initial_solution)
     afiro_primal_objective, solution.get_additional_termination_information().primal_objective));
 }
 
+// Number of entries in a warm start cache directory
+static int count_warm_start_entries(const std::filesystem::path& directory)
+{
+  int count = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.path().extension() == ".warm") { ++count; }
+  }
+  return count;
+}
+
+TEST(pdlp_class, run_double_warm_start_cache)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  const auto cache_dir = std::filesystem::temp_directory_path() / "cuopt_pdlp_warm_start_cache";
+  std::filesystem::remove_all(cache_dir);
+
+  auto solver_settings      = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver = presolver_t::None;
+  optimization_problem_solution_t<int, double> reference =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)reference.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  const auto reference_info = reference.get_additional_termination_information();
+
+  // Without an entry the solve is a cold one, and it saves its optimal solution
+  auto cache_settings                 = solver_settings;
+  cache_settings.warm_start_cache_dir = cache_dir.string();
+  optimization_problem_solution_t<int, double> cold =
+    solve_lp(&handle_, op_problem, cache_settings);
+  EXPECT_EQ((int)cold.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_NEAR(cold.get_additional_termination_information().primal_objective,
+              reference_info.primal_objective,
+              1e-4 * std::abs(reference_info.primal_objective));
+  ASSERT_EQ(count_warm_start_entries(cache_dir), 1);
+
+  // Starting from the saved solution reaches the same optimum in fewer steps
+  optimization_problem_solution_t<int, double> warm =
+    solve_lp(&handle_, op_problem, cache_settings);
+  EXPECT_EQ((int)warm.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  const auto warm_info = warm.get_additional_termination_information();
+  EXPECT_NEAR(warm_info.primal_objective,
+              reference_info.primal_objective,
+              1e-4 * std::abs(reference_info.primal_objective));
+  EXPECT_LT(warm_info.number_of_steps_taken, reference_info.number_of_steps_taken);
+
+  // New costs keep the structure, so the same entry starts the solve, which must still reach the
+  // optimum of the new costs
+  auto perturbed_problem = op_problem;
+  for (auto& c : perturbed_problem.get_objective_coefficients()) {
+    c *= 1.1;
+  }
+  optimization_problem_solution_t<int, double> perturbed_reference =
+    solve_lp(&handle_, perturbed_problem, solver_settings);
+  EXPECT_EQ((int)perturbed_reference.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  optimization_problem_solution_t<int, double> perturbed_warm =
+    solve_lp(&handle_, perturbed_problem, cache_settings);
+  EXPECT_EQ((int)perturbed_warm.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  const double perturbed_objective =
+    perturbed_reference.get_additional_termination_information().primal_objective;
+  EXPECT_NEAR(perturbed_warm.get_additional_termination_information().primal_objective,
+              perturbed_objective,
+              1e-4 * std::abs(perturbed_objective));
+  EXPECT_EQ(count_warm_start_entries(cache_dir), 1);
+
+  std::filesystem::remove_all(cache_dir);
+}
+
 TEST(pdlp_class, run_iteration_limit)
 {
   const raft::handle_t handle_{};
@@ -900,6 +1256,40 @@ TEST(pdlp_class, warm_start_stable3_not_supported)
   EXPECT_EQ(solution2.get_termination_status(), pdlp_termination_status_t::NoTermination);
 }
 
+TEST(pdlp_class, reuse_scaling_vectors)
+{
+  const raft::handle_t handle{};
+
+  auto path                 = make_path_absolute("linear_programming/afiro_original.mps");
+  auto solver_settings      = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method    = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.presolver = presolver_t::None;
+
+  cuopt::mps_parser::mps_data_model_t<int, double> mps_data_model =
+    cuopt::mps_parser::parse_mps<int, double>(path);
+  auto op_problem = cuopt::linear_programming::mps_data_model_to_optimization_problem<int, double>(
+    &handle, mps_data_model);
+  optimization_problem_solution_t<int, double> solution1 = solve_lp(op_problem, solver_settings);
+  EXPECT_EQ(solution1.get_termination_status(), pdlp_termination_status_t::Optimal);
+
+  const auto& warm_start_data = solution1.get_pdlp_warm_start_data();
+  EXPECT_EQ(warm_start_data.variable_scaling_.size(), (size_t)op_problem.get_n_variables());
+  EXPECT_EQ(warm_start_data.constraint_scaling_.size(),
+            (size_t)op_problem.get_n_constraints());
+
+  // Same scaling is used so the second solve should follow the exact same path
+  solver_settings.set_initial_scaling_vectors(warm_start_data.variable_scaling_.data(),
+                                              (int)warm_start_data.variable_scaling_.size(),
+                                              warm_start_data.constraint_scaling_.data(),
+                                              (int)warm_start_data.constraint_scaling_.size(),
+                                              handle.get_stream());
+  optimization_problem_solution_t<int, double> solution2 = solve_lp(op_problem, solver_settings);
+  EXPECT_EQ(solution2.get_termination_status(), pdlp_termination_status_t::Optimal);
+  EXPECT_EQ(solution1.get_additional_termination_information().number_of_steps_taken,
+            solution2.get_additional_termination_information().number_of_steps_taken);
+  EXPECT_NEAR(solution1.get_objective_value(), solution2.get_objective_value(), 1e-6);
+}
+
 TEST(pdlp_class, dual_postsolve_size)
 {
   const raft::handle_t handle_{};
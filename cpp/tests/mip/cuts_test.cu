@@ -9,6 +9,7 @@
 #include "mip_utils.cuh"
 
 #include <cuopt/linear_programming/solve.hpp>
+#include <cuts/cuts.hpp>
 #include <mps_parser/parser.hpp>
 #include <utilities/common_utils.hpp>
 #include <utilities/error.hpp>
@@ -18,6 +19,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
 #include <limits>
@@ -165,4 +167,154 @@ TEST(cuts, test_cuts_2)
   EXPECT_EQ(solution.get_num_nodes(), 0);
 }
 
+namespace {
+
+// A problem with the rows given densely over the structural variables. The rows with a sense get a
+// slack column s >= 0 appended, a'*x + s = b for 'L' and a'*x - s = b for 'G', as the cut
+// generators see them
+struct slack_problem_t {
+  dual_simplex::lp_problem_t<int, double> lp;
+  dual_simplex::csr_matrix_t<int, double> Arow;
+  std::vector<int> new_slacks;
+  std::vector<dual_simplex::variable_type_t> var_types;
+
+  slack_problem_t(const std::vector<std::vector<double>>& rows,
+                  const std::vector<char>& senses,
+                  const std::vector<double>& rhs,
+                  const std::vector<dual_simplex::variable_type_t>& structural_types,
+                  const std::vector<double>& upper)
+    : lp(nullptr, 0, 0, 0), Arow(0, 0, 0)
+  {
+    const int m = rows.size();
+    const int n = structural_types.size();
+    var_types   = structural_types;
+    lp.lower.assign(n, 0.0);
+    lp.upper = upper;
+    Arow.row_start.assign(1, 0);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        if (rows[i][j] == 0.0) { continue; }
+        Arow.j.push_back(j);
+        Arow.x.push_back(rows[i][j]);
+      }
+      if (senses[i] != 'E') {
+        new_slacks.push_back(var_types.size());
+        Arow.j.push_back(var_types.size());
+        Arow.x.push_back(senses[i] == 'L' ? 1.0 : -1.0);
+        var_types.push_back(dual_simplex::variable_type_t::CONTINUOUS);
+        lp.lower.push_back(0.0);
+        lp.upper.push_back(std::numeric_limits<double>::infinity());
+      }
+      Arow.row_start.push_back(Arow.j.size());
+    }
+    Arow.m      = m;
+    Arow.n      = var_types.size();
+    Arow.nz_max = Arow.j.size();
+    lp.num_rows = m;
+    lp.num_cols = var_types.size();
+    lp.rhs      = rhs;
+  }
+};
+
+}  // namespace
+
+TEST(cuts, clique_conflict_graph)
+{
+  using dual_simplex::variable_type_t;
+  constexpr auto I = variable_type_t::INTEGER;
+  constexpr auto C = variable_type_t::CONTINUOUS;
+  // The conflicts of x0..x3 make them one clique, built from smaller ones:
+  //   x0 + x1 + x2 <= 1           set packing, clique {0, 1, 2}
+  //   3 x2 + 3 x3 + x4 <= 4       knapsack, clique of the big items {2, 3}
+  //   x0 + x3 = 1                 set partitioning, clique {0, 3}
+  //   x1 + x3 <= 1                clique {1, 3}
+  //   x4 + x5 <= 2                no conflict
+  //   x5 + x6 <= 1                x6 is continuous, no conflict
+  slack_problem_t problem({{1, 1, 1, 0, 0, 0, 0},
+                           {0, 0, 3, 3, 1, 0, 0},
+                           {1, 0, 0, 1, 0, 0, 0},
+                           {0, 1, 0, 1, 0, 0, 0},
+                           {0, 0, 0, 0, 1, 1, 0},
+                           {0, 0, 0, 0, 0, 1, 1}},
+                          {'L', 'L', 'E', 'L', 'L', 'L'},
+                          {1, 4, 1, 1, 2, 1},
+                          {I, I, I, I, I, I, C},
+                          {1, 1, 1, 1, 1, 1, 1});
+  dual_simplex::simplex_solver_settings_t<int, double> settings;
+  dual_simplex::clique_generation_t<int, double> cliques(
+    problem.lp, settings, problem.Arow, problem.new_slacks, problem.var_types);
+  EXPECT_EQ(cliques.num_cliques(), 4);
+
+  // x0 + x2 + x3 = 1.5 is violated. x1 is at zero and is lifted into the cut, x4 and x5 are
+  // fractional but conflict with nothing
+  std::vector<double> xstar(problem.lp.num_cols, 0.0);
+  xstar[0] = xstar[2] = xstar[3] = xstar[4] = xstar[5] = 0.5;
+  std::vector<dual_simplex::sparse_vector_t<int, double>> cuts;
+  std::vector<double> cut_rhs;
+  cliques.generate_clique_cuts(problem.lp, settings, xstar, cuts, cut_rhs);
+  ASSERT_EQ(cuts.size(), size_t{1});
+  EXPECT_EQ(cuts[0].i, std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(cuts[0].x, std::vector<double>(4, -1.0));
+  EXPECT_EQ(cut_rhs[0], -1.0);
+
+  // A point within the cliques gives no cut
+  std::fill(xstar.begin(), xstar.end(), 0.0);
+  xstar[0] = xstar[1] = 0.5;
+  cliques.generate_clique_cuts(problem.lp, settings, xstar, cuts, cut_rhs);
+  EXPECT_TRUE(cuts.empty());
+}
+
+TEST(cuts, cut_pool_deduplication)
+{
+  constexpr int n = 4;
+  dual_simplex::simplex_solver_settings_t<int, double> settings;
+  dual_simplex::cut_pool_t<int, double> pool(n, settings);
+  auto make_cut = [](const std::vector<int>& i, const std::vector<double>& x) {
+    dual_simplex::sparse_vector_t<int, double> cut(n, 0);
+    cut.i = i;
+    cut.x = x;
+    return cut;
+  };
+
+  pool.add_cut(dual_simplex::MIXED_INTEGER_GOMORY, make_cut({0, 1}, {1.0, 1.0}), 1.0);
+  // The same cut scaled and with its coefficients out of order, with a stronger right-hand side
+  pool.add_cut(dual_simplex::MIXED_INTEGER_ROUNDING, make_cut({1, 0}, {2.0, 2.0}), 3.0);
+  // Weaker, with an explicit zero, or with a rounding difference
+  pool.add_cut(dual_simplex::KNAPSACK, make_cut({0, 1}, {3.0, 3.0}), 3.0);
+  pool.add_cut(dual_simplex::KNAPSACK, make_cut({0, 1, 2}, {1.0, 1.0, 0.0}), 1.0);
+  pool.add_cut(dual_simplex::KNAPSACK, make_cut({0, 1}, {1.0, 1.0 + 1e-13}), 1.0);
+  EXPECT_EQ(pool.pool_size(), 1);
+
+  // Different cuts, one of them nearly parallel to the first
+  pool.add_cut(dual_simplex::MIXED_INTEGER_GOMORY, make_cut({0, 1}, {1.0, -1.0}), 0.5);
+  pool.add_cut(dual_simplex::MIXED_INTEGER_GOMORY, make_cut({2, 3}, {1.0, 1.0}), 1.0);
+  pool.add_cut(dual_simplex::MIXED_INTEGER_GOMORY, make_cut({0, 1}, {1.0, 1.01}), 1.0);
+  EXPECT_EQ(pool.pool_size(), 4);
+
+  // The nearly parallel cut is filtered out by the selection
+  std::vector<double> x_relax(n, 0.25);
+  pool.score_cuts(x_relax, std::vector<double>(n, 0.0), 10);
+  dual_simplex::csr_matrix_t<int, double> best_cuts(0, 0, 0);
+  std::vector<double> best_rhs;
+  std::vector<dual_simplex::cut_type_t> best_cut_types;
+  ASSERT_EQ(pool.get_best_cuts(best_cuts, best_rhs, best_cut_types), 3);
+
+  // The duplicates left the first cut with the strongest right-hand side, 2 x0 + 2 x1 >= 3, as
+  // -x0 - x1 <= -1.5 and from the cut that gave it
+  bool found = false;
+  for (int k = 0; k < best_cuts.m; ++k) {
+    const int start = best_cuts.row_start[k];
+    if (best_cuts.row_start[k + 1] - start != 2 || best_cuts.j[start] != 0 ||
+        best_cuts.x[start] != best_cuts.x[start + 1]) {
+      continue;
+    }
+    EXPECT_FALSE(found);
+    found = true;
+    EXPECT_EQ(best_cuts.x[start], -1.0);
+    EXPECT_NEAR(best_rhs[k], -1.5, 1e-12);
+    EXPECT_EQ(best_cut_types[k], dual_simplex::MIXED_INTEGER_ROUNDING);
+  }
+  EXPECT_TRUE(found);
+}
+
 }  // namespace cuopt::linear_programming::test
@@ -19,7 +19,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -224,6 +230,229 @@ TEST(ErrorTest, TestError)
             cuopt::linear_programming::mip_termination_status_t::NoTermination);
 }
 
+// Bin packing of the items into num_bins identical bins of the given capacity, minimizing the
+// number of bins used. Columns are y[b] whether bin b is used, then x[i][b] whether item i is in
+// bin b. Any permutation of the bins is a symmetry
+mps_parser::mps_data_model_t<int, double> create_bin_packing_problem(
+  const std::vector<double>& weights, int num_bins, double capacity)
+{
+  mps_parser::mps_data_model_t<int, double> problem;
+  const int num_items = weights.size();
+  const int n         = num_bins + num_items * num_bins;
+  auto x              = [num_bins](int i, int b) { return num_bins + i * num_bins + b; };
+
+  std::vector<int> offsets = {0};
+  std::vector<int> indices;
+  std::vector<double> coefficients;
+  std::vector<double> lower_bounds;
+  std::vector<double> upper_bounds;
+  // Each item in exactly one bin
+  for (int i = 0; i < num_items; ++i) {
+    for (int b = 0; b < num_bins; ++b) {
+      indices.push_back(x(i, b));
+      coefficients.push_back(1.0);
+    }
+    offsets.push_back(indices.size());
+    lower_bounds.push_back(1.0);
+    upper_bounds.push_back(1.0);
+  }
+  // The items of a bin fit in it only if it is used
+  for (int b = 0; b < num_bins; ++b) {
+    indices.push_back(b);
+    coefficients.push_back(-capacity);
+    for (int i = 0; i < num_items; ++i) {
+      indices.push_back(x(i, b));
+      coefficients.push_back(weights[i]);
+    }
+    offsets.push_back(indices.size());
+    lower_bounds.push_back(-std::numeric_limits<double>::infinity());
+    upper_bounds.push_back(0.0);
+  }
+  problem.set_csr_constraint_matrix(coefficients.data(),
+                                    coefficients.size(),
+                                    indices.data(),
+                                    indices.size(),
+                                    offsets.data(),
+                                    offsets.size());
+  problem.set_constraint_lower_bounds(lower_bounds.data(), lower_bounds.size());
+  problem.set_constraint_upper_bounds(upper_bounds.data(), upper_bounds.size());
+
+  std::vector<double> var_lower(n, 0.0);
+  std::vector<double> var_upper(n, 1.0);
+  problem.set_variable_lower_bounds(var_lower.data(), var_lower.size());
+  problem.set_variable_upper_bounds(var_upper.data(), var_upper.size());
+  std::vector<double> objective(n, 0.0);
+  std::fill(objective.begin(), objective.begin() + num_bins, 1.0);
+  problem.set_objective_coefficients(objective.data(), objective.size());
+  std::vector<char> var_types(n, 'I');
+  problem.set_variable_types(var_types);
+  problem.set_maximize(false);
+  return problem;
+}
+
+// Breaking the symmetries of the bins in branch-and-bound keeps the optimal number of bins
+TEST(mip_symmetry, bin_packing_same_objective)
+{
+  raft::handle_t handle;
+  // 30 units of weight need at least 3 bins of 10, and {7, 3}, {6, 4}, {5, 3, 2} is a packing
+  auto problem = create_bin_packing_problem({7.0, 6.0, 5.0, 4.0, 3.0, 3.0, 2.0}, 6, 10.0);
+
+  std::vector<double> objectives;
+  for (int symmetry : {0, 1}) {
+    cuopt::linear_programming::mip_solver_settings_t<int, double> settings{};
+    settings.time_limit = 30;
+    settings.presolver  = cuopt::linear_programming::presolver_t::None;
+    settings.symmetry   = symmetry;
+    auto result         = cuopt::linear_programming::solve_mip(&handle, problem, settings);
+    EXPECT_EQ(result.get_termination_status(),
+              cuopt::linear_programming::mip_termination_status_t::Optimal)
+      << "mip_symmetry " << symmetry;
+    objectives.push_back(result.get_objective_value());
+  }
+  EXPECT_NEAR(objectives[0], 3.0, 1e-6);
+  EXPECT_NEAR(objectives[1], objectives[0], 1e-6);
+}
+
+// The conflicts learned from the pruned nodes only cut off packings that are no better than the
+// incumbent, so the optimal number of bins is the same with or without them
+TEST(mip_conflict_analysis, bin_packing_same_objective)
+{
+  raft::handle_t handle;
+  // 46 units of weight need at least 5 bins of 10, and {9, 1}, {8, 2}, {7, 3}, {6, 4}, {5, 1}
+  // is a packing
+  auto problem =
+    create_bin_packing_problem({9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 1.0}, 8, 10.0);
+
+  std::vector<double> objectives;
+  for (int conflict_analysis : {0, 1}) {
+    cuopt::linear_programming::mip_solver_settings_t<int, double> settings{};
+    settings.time_limit        = 30;
+    settings.presolver         = cuopt::linear_programming::presolver_t::None;
+    settings.conflict_analysis = conflict_analysis;
+    auto result = cuopt::linear_programming::solve_mip(&handle, problem, settings);
+    EXPECT_EQ(result.get_termination_status(),
+              cuopt::linear_programming::mip_termination_status_t::Optimal)
+      << "mip_conflict_analysis " << conflict_analysis;
+    objectives.push_back(result.get_objective_value());
+  }
+  EXPECT_NEAR(objectives[0], 5.0, 1e-6);
+  EXPECT_NEAR(objectives[1], objectives[0], 1e-6);
+}
+
+// The warm start cache gives the saved solution as an initial one, which must not change the
+// optimum, including when the coefficients changed since it was saved or the entry is damaged
+TEST(mip_warm_start_cache, matches_cold_solve)
+{
+  raft::handle_t handle;
+  const auto cache_dir = std::filesystem::temp_directory_path() / "cuopt_mip_warm_start_cache";
+  std::filesystem::remove_all(cache_dir);
+  auto entries = [&cache_dir]() {
+    std::vector<std::filesystem::path> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(cache_dir)) {
+      if (entry.path().extension() == ".warm") { paths.push_back(entry.path()); }
+    }
+    return paths;
+  };
+
+  cuopt::linear_programming::mip_solver_settings_t<int, double> settings{};
+  settings.time_limit                 = 30;
+  auto cache_settings                 = settings;
+  cache_settings.warm_start_cache_dir = cache_dir.string();
+  auto expect_same_optimum = [&](const mps_parser::mps_data_model_t<int, double>& problem) {
+    auto cold = cuopt::linear_programming::solve_mip(&handle, problem, settings);
+    auto warm = cuopt::linear_programming::solve_mip(&handle, problem, cache_settings);
+    ASSERT_EQ(cold.get_termination_status(),
+              cuopt::linear_programming::mip_termination_status_t::Optimal);
+    EXPECT_EQ(warm.get_termination_status(),
+              cuopt::linear_programming::mip_termination_status_t::Optimal);
+    EXPECT_NEAR(warm.get_objective_value(), cold.get_objective_value(), 1e-6);
+  };
+
+  // The first solve saves its solution, the second one starts from it
+  auto problem = create_bin_packing_problem({7.0, 6.0, 5.0, 4.0, 3.0, 3.0, 2.0}, 6, 10.0);
+  expect_same_optimum(problem);
+  ASSERT_EQ(entries().size(), 1u);
+  expect_same_optimum(problem);
+
+  // Other weights keep the structure and the entry, whose packing may no longer fit
+  auto reweighted = create_bin_packing_problem({7.0, 6.0, 6.0, 5.0, 4.0, 3.0, 2.0}, 6, 10.0);
+  expect_same_optimum(reweighted);
+  EXPECT_EQ(entries().size(), 1u);
+
+  // Another number of bins is another structure
+  auto more_bins = create_bin_packing_problem({7.0, 6.0, 5.0, 4.0, 3.0, 3.0, 2.0}, 7, 10.0);
+  expect_same_optimum(more_bins);
+  EXPECT_EQ(entries().size(), 2u);
+
+  // A damaged entry is ignored
+  for (const auto& path : entries()) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a warm start";
+  }
+  expect_same_optimum(problem);
+
+  std::filesystem::remove_all(cache_dir);
+}
+
+// The batch runs 8 solves at a time on the shared logger and device memory budget, each one must
+// reach the same optimum as solving the problem alone
+TEST(mip_batch, matches_solve_mip)
+{
+  constexpr int num_problems = 12;
+  std::vector<mps_parser::mps_data_model_t<int, double>> problems;
+  for (int k = 0; k < num_problems; ++k) {
+    std::vector<double> weights;
+    for (int i = 0; i < 6; ++i) {
+      weights.push_back(2 + (k * 5 + i * 3) % 7);
+    }
+    problems.push_back(create_bin_packing_problem(weights, weights.size(), 10.0));
+  }
+  std::vector<const mps_parser::mps_data_model_t<int, double>*> problem_ptrs;
+  for (const auto& problem : problems) {
+    problem_ptrs.push_back(&problem);
+  }
+
+  const auto log_file =
+    (std::filesystem::temp_directory_path() / "cuopt_mip_batch_test.log").string();
+  std::filesystem::remove(log_file);
+  cuopt::linear_programming::mip_solver_settings_t<int, double> settings{};
+  settings.time_limit          = 30;
+  settings.presolver           = cuopt::linear_programming::presolver_t::None;
+  settings.num_cpu_threads     = 16;
+  settings.device_memory_limit = 4096;
+  settings.log_file            = log_file;
+
+  std::mutex mutex;
+  std::vector<int> num_calls(num_problems, 0);
+  std::vector<cuopt::linear_programming::mip_termination_status_t> statuses(num_problems);
+  std::vector<double> objectives(num_problems);
+  cuopt::linear_programming::solve_mip_batch(
+    problem_ptrs,
+    std::function<void(size_t, cuopt::linear_programming::mip_solution_t<int, double>&)>(
+      [&](size_t i, cuopt::linear_programming::mip_solution_t<int, double>& solution) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++num_calls[i];
+        statuses[i]   = solution.get_termination_status();
+        objectives[i] = solution.get_objective_value();
+      }),
+    settings);
+
+  std::ifstream log(log_file);
+  std::stringstream log_content;
+  log_content << log.rdbuf();
+  EXPECT_NE(log_content.str().find("Solving 12 MIPs, 8 at a time"), std::string::npos);
+
+  raft::handle_t handle;
+  settings.log_file.clear();
+  for (int k = 0; k < num_problems; ++k) {
+    EXPECT_EQ(num_calls[k], 1) << "problem " << k;
+    auto reference = cuopt::linear_programming::solve_mip(&handle, problems[k], settings);
+    ASSERT_EQ(reference.get_termination_status(),
+              cuopt::linear_programming::mip_termination_status_t::Optimal);
+    EXPECT_EQ(statuses[k], reference.get_termination_status()) << "problem " << k;
+    EXPECT_NEAR(objectives[k], reference.get_objective_value(), 1e-6) << "problem " << k;
+  }
+}
+
 class MILPTestParams
   : public testing::TestWithParam<
       std::tuple<bool, bool, bool, cuopt::linear_programming::mip_termination_status_t>> {};
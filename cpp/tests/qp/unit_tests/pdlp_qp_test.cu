@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved. SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <utilities/common_utils.hpp>
+
+#include <cuopt/linear_programming/optimization_problem.hpp>
+#include <cuopt/linear_programming/pdlp/solver_settings.hpp>
+#include <cuopt/linear_programming/solve.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+namespace cuopt::linear_programming {
+
+namespace {
+
+// Long only portfolio over 3 assets: minimize x^T F^T F x - mu^T x with sum x = 1 and x0 + x1 >=
+// 0.3. F holds two factor loadings rows and the specific risks
+constexpr int num_assets = 3;
+const std::vector<std::vector<double>> F{{0.3, 0.2, 0.1},
+                                         {0.0, 0.2, 0.4},
+                                         {0.1, 0.0, 0.0},
+                                         {0.0, 0.1, 0.0},
+                                         {0.0, 0.0, 0.1}};
+const std::vector<double> mu{0.10, 0.12, 0.08};
+
+optimization_problem_t<int, double> make_portfolio(raft::handle_t const* handle)
+{
+  auto op_problem = optimization_problem_t<int, double>(handle);
+
+  double A_host[]    = {1.0, 1.0, 1.0, 1.0, 1.0};
+  int indices_host[] = {0, 1, 2, 0, 1};
+  int offset_host[]  = {0, 3, 5};
+  op_problem.set_csr_constraint_matrix(A_host, 5, indices_host, 5, offset_host, 3);
+
+  double cnstr_lb_host[] = {1.0, 0.3};
+  double cnstr_ub_host[] = {1.0, std::numeric_limits<double>::infinity()};
+  op_problem.set_constraint_lower_bounds(cnstr_lb_host, 2);
+  op_problem.set_constraint_upper_bounds(cnstr_ub_host, 2);
+
+  double lb_host[] = {0.0, 0.0, 0.0};
+  double ub_host[] = {1.0, 1.0, 1.0};
+  op_problem.set_variable_lower_bounds(lb_host, num_assets);
+  op_problem.set_variable_upper_bounds(ub_host, num_assets);
+
+  std::vector<double> c_host(num_assets);
+  for (int j = 0; j < num_assets; ++j) {
+    c_host[j] = -mu[j];
+  }
+  op_problem.set_objective_coefficients(c_host.data(), num_assets);
+  return op_problem;
+}
+
+// Q = F^T F as a dense CSR matrix
+void set_quadratic_matrix(optimization_problem_t<int, double>& op_problem)
+{
+  std::vector<double> Q_values;
+  std::vector<int> Q_indices;
+  std::vector<int> Q_offsets{0};
+  for (int i = 0; i < num_assets; ++i) {
+    for (int j = 0; j < num_assets; ++j) {
+      double q = 0.0;
+      for (const auto& row : F) {
+        q += row[i] * row[j];
+      }
+      Q_values.push_back(q);
+      Q_indices.push_back(j);
+    }
+    Q_offsets.push_back(Q_values.size());
+  }
+  op_problem.set_quadratic_objective_matrix(Q_values.data(),
+                                            Q_values.size(),
+                                            Q_indices.data(),
+                                            Q_indices.size(),
+                                            Q_offsets.data(),
+                                            Q_offsets.size());
+}
+
+void set_quadratic_factor(optimization_problem_t<int, double>& op_problem)
+{
+  std::vector<double> F_values;
+  std::vector<int> F_indices;
+  std::vector<int> F_offsets{0};
+  for (const auto& row : F) {
+    for (int j = 0; j < num_assets; ++j) {
+      if (row[j] == 0.0) { continue; }
+      F_values.push_back(row[j]);
+      F_indices.push_back(j);
+    }
+    F_offsets.push_back(F_values.size());
+  }
+  op_problem.set_quadratic_objective_factor(F_values.data(),
+                                            F_values.size(),
+                                            F_indices.data(),
+                                            F_indices.size(),
+                                            F_offsets.data(),
+                                            F_offsets.size());
+}
+
+pdlp_solver_settings_t<int, double> settings_for(method_t method)
+{
+  auto settings   = pdlp_solver_settings_t<int, double>();
+  settings.method = method;
+  settings.set_optimality_tolerance(1e-8);
+  return settings;
+}
+
+void expect_same_solution(optimization_problem_solution_t<int, double>& solution,
+                          optimization_problem_solution_t<int, double>& reference,
+                          raft::handle_t const& handle)
+{
+  ASSERT_EQ(solution.get_termination_status(), pdlp_termination_status_t::Optimal);
+  ASSERT_EQ(reference.get_termination_status(), pdlp_termination_status_t::Optimal);
+  EXPECT_NEAR(solution.get_objective_value(), reference.get_objective_value(), 1e-5);
+  auto x     = cuopt::host_copy(solution.get_primal_solution(), handle.get_stream());
+  auto x_ref = cuopt::host_copy(reference.get_primal_solution(), handle.get_stream());
+  ASSERT_EQ(x.size(), x_ref.size());
+  for (size_t j = 0; j < x.size(); ++j) {
+    EXPECT_NEAR(x[j], x_ref[j], 1e-4) << "asset " << j;
+  }
+}
+
+}  // namespace
+
+TEST(pdlp_qp, two_variable_matches_barrier)
+{
+  raft::handle_t handle;
+
+  // optimize: -8x1 - 16x2 + x1^2 + 4x2^2 with x1 + x2 >= 5, whose optimum is (4, 2)
+  auto op_problem    = optimization_problem_t<int, double>(&handle);
+  double A_host[]    = {1.0, 1.0};
+  int indices_host[] = {0, 1};
+  int offset_host[]  = {0, 2};
+  op_problem.set_csr_constraint_matrix(A_host, 2, indices_host, 2, offset_host, 2);
+
+  double cnstr_lb_host[] = {5.0};
+  double cnstr_ub_host[] = {std::numeric_limits<double>::infinity()};
+  op_problem.set_constraint_lower_bounds(cnstr_lb_host, 1);
+  op_problem.set_constraint_upper_bounds(cnstr_ub_host, 1);
+
+  double lb_host[] = {0.0, 0.0};
+  double ub_host[] = {10.0, 10.0};
+  op_problem.set_variable_lower_bounds(lb_host, 2);
+  op_problem.set_variable_upper_bounds(ub_host, 2);
+
+  double c_host[] = {-8.0, -16.0};
+  op_problem.set_objective_coefficients(c_host, 2);
+
+  double Q_values_host[] = {1.0, 4.0};
+  int Q_indices_host[]   = {0, 1};
+  int Q_offsets_host[]   = {0, 1, 2};
+  op_problem.set_quadratic_objective_matrix(Q_values_host, 2, Q_indices_host, 2, Q_offsets_host, 3);
+
+  auto barrier = solve_lp(op_problem, settings_for(method_t::Barrier));
+  auto pdlp    = solve_lp(op_problem, settings_for(method_t::PDLP));
+  expect_same_solution(pdlp, barrier, handle);
+  EXPECT_NEAR(pdlp.get_objective_value(), -32.0, 1e-5);
+}
+
+TEST(pdlp_qp, portfolio_matches_barrier)
+{
+  raft::handle_t handle;
+
+  auto op_problem = make_portfolio(&handle);
+  set_quadratic_matrix(op_problem);
+  auto barrier = solve_lp(op_problem, settings_for(method_t::Barrier));
+  auto pdlp    = solve_lp(op_problem, settings_for(method_t::PDLP));
+  expect_same_solution(pdlp, barrier, handle);
+}
+
+TEST(pdlp_qp, factored_objective_matches_matrix)
+{
+  raft::handle_t handle;
+
+  auto matrix_problem = make_portfolio(&handle);
+  set_quadratic_matrix(matrix_problem);
+  auto barrier = solve_lp(matrix_problem, settings_for(method_t::Barrier));
+
+  // The factored objective goes to PDLP whatever the method
+  auto factor_problem = make_portfolio(&handle);
+  set_quadratic_factor(factor_problem);
+  EXPECT_TRUE(factor_problem.has_factored_quadratic_objective());
+  auto factored = solve_lp(factor_problem, settings_for(method_t::Concurrent));
+  expect_same_solution(factored, barrier, handle);
+}
+
+}  // namespace cuopt::linear_programming
@@ -13,6 +13,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <vector>
 
 namespace cuopt {
@@ -84,6 +85,64 @@ TEST(batch_tsp, varying_sizes)
   }
 }
 
+/**
+ * @brief Test that batch_solve matches solving each problem on its own, and leaves the stream of
+ * each handle unchanged
+ */
+TEST(batch_tsp, batch_solve_matches_solve)
+{
+  std::vector<i_t> tsp_sizes = {5, 8, 10, 6, 7, 9, 12, 4};
+  const i_t n_problems       = static_cast<i_t>(tsp_sizes.size());
+
+  std::vector<std::unique_ptr<raft::handle_t>> handles;
+  std::vector<rmm::cuda_stream_view> streams;
+  std::vector<rmm::device_uvector<f_t>> cost_matrices_d;
+  std::vector<std::unique_ptr<cuopt::routing::data_model_view_t<i_t, f_t>>> data_models;
+  std::vector<cuopt::routing::data_model_view_t<i_t, f_t>*> data_model_ptrs;
+
+  for (i_t i = 0; i < n_problems; ++i) {
+    handles.push_back(std::make_unique<raft::handle_t>());
+    auto& handle = *handles.back();
+    streams.push_back(handle.get_stream());
+
+    auto cost_matrix_h = create_small_tsp_cost_matrix(tsp_sizes[i]);
+    cost_matrices_d.push_back(cuopt::device_copy(cost_matrix_h, handle.get_stream()));
+
+    data_models.push_back(std::make_unique<cuopt::routing::data_model_view_t<i_t, f_t>>(
+      &handle, tsp_sizes[i], 1, tsp_sizes[i]));
+    data_models.back()->add_cost_matrix(cost_matrices_d.back().data());
+    data_model_ptrs.push_back(data_models.back().get());
+  }
+
+  cuopt::routing::solver_settings_t<i_t, f_t> settings;
+  settings.set_time_limit(5);
+
+  auto solutions = cuopt::routing::batch_solve(data_model_ptrs, settings);
+
+  ASSERT_EQ(solutions.size(), n_problems);
+  for (i_t i = 0; i < n_problems; ++i) {
+    EXPECT_EQ(handles[i]->get_stream(), streams[i]) << "TSP " << i;
+    auto reference = cuopt::routing::solve(*data_models[i], settings);
+    handles[i]->sync_stream();
+    ASSERT_EQ(reference.get_status(), cuopt::routing::solution_status_t::SUCCESS);
+    ASSERT_EQ(solutions[i].get_status(), cuopt::routing::solution_status_t::SUCCESS)
+      << "TSP " << i << " (size " << tsp_sizes[i] << ") failed";
+    // Out and back along the line
+    EXPECT_FLOAT_EQ(solutions[i].get_total_objective(), 2 * (tsp_sizes[i] - 1)) << "TSP " << i;
+    EXPECT_FLOAT_EQ(solutions[i].get_total_objective(), reference.get_total_objective())
+      << "TSP " << i;
+    EXPECT_EQ(solutions[i].get_vehicle_count(), reference.get_vehicle_count()) << "TSP " << i;
+    // The route buffers were moved back to the stream of the handle
+    EXPECT_EQ(solutions[i].get_route().stream(), streams[i]) << "TSP " << i;
+    auto route = cuopt::host_copy(solutions[i].get_route(), streams[i]);
+    EXPECT_EQ(route.size(), tsp_sizes[i] + 1) << "TSP " << i;
+  }
+
+  EXPECT_TRUE(cuopt::routing::batch_solve(
+                std::vector<cuopt::routing::data_model_view_t<i_t, f_t>*>{}, settings)
+                .empty());
+}
+
 }  // namespace test
 }  // namespace routing
 }  // namespace cuopt
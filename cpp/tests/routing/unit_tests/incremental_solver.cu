@@ -0,0 +1,126 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/routing/incremental_solver.hpp>
+#include <cuopt/routing/solve.hpp>
+#include <routing/utilities/check_constraints.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+namespace test {
+
+/**
+ * @brief Capacitated model of unit demands on a line: the depot is at 0 and the order of id k at
+ * position k. The device data must outlive the model.
+ */
+struct line_model_t {
+  line_model_t(raft::handle_t const& handle, std::vector<int> const& ids)
+    : n_locations(ids.size() + 1),
+      cost_matrix(0, handle.get_stream()),
+      demands(0, handle.get_stream()),
+      capacities(0, handle.get_stream()),
+      data_model(&handle, n_locations, n_vehicles, n_locations)
+  {
+    auto stream = handle.get_stream();
+    std::vector<float> position{0.f};
+    position.insert(position.end(), ids.begin(), ids.end());
+    std::vector<float> h_cost_matrix(n_locations * n_locations);
+    for (int i = 0; i < n_locations; ++i) {
+      for (int j = 0; j < n_locations; ++j) {
+        h_cost_matrix[i * n_locations + j] = std::abs(position[i] - position[j]);
+      }
+    }
+    std::vector<int> h_demands(n_locations, 1);
+    h_demands[0] = 0;
+    cost_matrix  = cuopt::device_copy(h_cost_matrix, stream);
+    demands      = cuopt::device_copy(h_demands, stream);
+    capacities   = cuopt::device_copy(std::vector<int>(n_vehicles, capacity), stream);
+    data_model.add_cost_matrix(cost_matrix.data());
+    data_model.add_capacity_dimension("demand", demands.data(), capacities.data());
+
+    order_ids.push_back(-1);
+    order_ids.insert(order_ids.end(), ids.begin(), ids.end());
+  }
+
+  static constexpr int n_vehicles = 5;
+  static constexpr int capacity   = 4;
+
+  int n_locations;
+  rmm::device_uvector<float> cost_matrix;
+  rmm::device_uvector<int> demands;
+  rmm::device_uvector<int> capacities;
+  data_model_view_t<int, float> data_model;
+  // Persistent id of each order, the depot id is ignored
+  std::vector<int> order_ids;
+};
+
+TEST(incremental_solver, replan_matches_solve)
+{
+  raft::handle_t handle;
+  solver_settings_t<int, float> settings;
+  settings.set_time_limit(5);
+  incremental_solver_t<int, float> incremental(settings);
+
+  // First plan: nothing is kept yet, so it is a plain solve
+  line_model_t first(handle, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  auto first_reference = solve(first.data_model, settings);
+  auto first_solution  = incremental.solve(first.data_model, first.order_ids);
+  handle.sync_stream();
+  ASSERT_EQ(first_reference.get_status(), solution_status_t::SUCCESS);
+  ASSERT_EQ(first_solution.get_status(), solution_status_t::SUCCESS);
+  check_route(first.data_model, first_solution);
+  EXPECT_FLOAT_EQ(first_solution.get_total_objective(), first_reference.get_total_objective());
+  EXPECT_EQ(first_solution.get_vehicle_count(), first_reference.get_vehicle_count());
+  EXPECT_GT(incremental.get_num_kept_solutions(), 0);
+
+  // Re-plan: orders 2 and 5 were served and orders 11 and 12 came in. The kept routes are
+  // translated to the new model and must lead to the same optimum as a solve from scratch
+  line_model_t second(handle, {1, 3, 4, 6, 7, 8, 9, 10, 11, 12});
+  auto second_reference = solve(second.data_model, settings);
+  auto second_solution  = incremental.solve(second.data_model, second.order_ids);
+  handle.sync_stream();
+  ASSERT_EQ(second_reference.get_status(), solution_status_t::SUCCESS);
+  ASSERT_EQ(second_solution.get_status(), solution_status_t::SUCCESS);
+  check_route(second.data_model, second_solution);
+  EXPECT_FLOAT_EQ(second_solution.get_total_objective(), second_reference.get_total_objective());
+  EXPECT_EQ(second_solution.get_vehicle_count(), second_reference.get_vehicle_count());
+
+  incremental.clear();
+  EXPECT_EQ(incremental.get_num_kept_solutions(), 0);
+}
+
+TEST(incremental_solver, invalid_order_ids)
+{
+  raft::handle_t handle;
+  solver_settings_t<int, float> settings;
+  settings.set_time_limit(1);
+  incremental_solver_t<int, float> incremental(settings);
+
+  line_model_t model(handle, {1, 2, 3, 4});
+  auto duplicate_ids          = model.order_ids;
+  duplicate_ids[2]            = duplicate_ids[1];
+  auto duplicate_ids_solution = incremental.solve(model.data_model, duplicate_ids);
+  EXPECT_EQ(duplicate_ids_solution.get_status(), solution_status_t::ERROR);
+
+  auto missing_ids = model.order_ids;
+  missing_ids.pop_back();
+  auto missing_ids_solution = incremental.solve(model.data_model, missing_ids);
+  EXPECT_EQ(missing_ids_solution.get_status(), solution_status_t::ERROR);
+  EXPECT_EQ(incremental.get_num_kept_solutions(), 0);
+}
+
+}  // namespace test
+}  // namespace routing
+}  // namespace cuopt
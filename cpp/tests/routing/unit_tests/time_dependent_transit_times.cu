@@ -0,0 +1,194 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/error.hpp>
+#include <cuopt/routing/solve.hpp>
+#include <routing/utilities/check_constraints.hpp>
+#include <utilities/copy_helpers.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace cuopt {
+namespace routing {
+namespace test {
+
+// Distances between the locations of a line
+static std::vector<float> line_matrix(int n_locations)
+{
+  std::vector<float> matrix(n_locations * n_locations);
+  for (int i = 0; i < n_locations; ++i) {
+    for (int j = 0; j < n_locations; ++j) {
+      matrix[i * n_locations + j] = std::abs(i - j);
+    }
+  }
+  return matrix;
+}
+
+// Transit time of the arc departing at time t, linearly interpolated between the buckets
+static double transit_time(std::vector<float> const& matrices,
+                           std::vector<float> const& bucket_start_times,
+                           int arc,
+                           double t)
+{
+  const int n_time_buckets = bucket_start_times.size();
+  const float* times       = matrices.data() + arc * n_time_buckets;
+  if (t <= bucket_start_times.front()) { return times[0]; }
+  if (t >= bucket_start_times.back()) { return times[n_time_buckets - 1]; }
+  int b = 0;
+  while (t >= bucket_start_times[b + 1]) {
+    ++b;
+  }
+  const double alpha =
+    (t - bucket_start_times[b]) / (bucket_start_times[b + 1] - bucket_start_times[b]);
+  return (1 - alpha) * times[b] + alpha * times[b + 1];
+}
+
+TEST(time_dependent_transit_times, constant_buckets_match_static)
+{
+  const int n_locations = 8;
+  const int n_vehicles  = 3;
+  auto cost_matrix      = line_matrix(n_locations);
+  auto time_matrix      = cost_matrix;
+  for (auto& time : time_matrix) {
+    time *= 3;
+  }
+  std::vector<int> earliest{0, 0, 10, 0, 5, 0, 20, 0};
+  std::vector<int> latest{100, 40, 60, 30, 50, 80, 70, 90};
+  std::vector<int> demands{0, 1, 1, 1, 1, 1, 1, 1};
+  std::vector<int> capacities(n_vehicles, 3);
+
+  // Every bucket holds the static matrix
+  const std::vector<float> bucket_start_times{0, 25, 50};
+  const int n_time_buckets = bucket_start_times.size();
+  std::vector<float> time_dependent(time_matrix.size() * n_time_buckets);
+  for (size_t arc = 0; arc < time_matrix.size(); ++arc) {
+    for (int b = 0; b < n_time_buckets; ++b) {
+      time_dependent[arc * n_time_buckets + b] = time_matrix[arc];
+    }
+  }
+
+  raft::handle_t handle;
+  auto stream = handle.get_stream();
+
+  auto v_cost_matrix        = cuopt::device_copy(cost_matrix, stream);
+  auto v_time_matrix        = cuopt::device_copy(time_matrix, stream);
+  auto v_time_dependent     = cuopt::device_copy(time_dependent, stream);
+  auto v_bucket_start_times = cuopt::device_copy(bucket_start_times, stream);
+  auto v_earliest           = cuopt::device_copy(earliest, stream);
+  auto v_latest             = cuopt::device_copy(latest, stream);
+  auto v_demands            = cuopt::device_copy(demands, stream);
+  auto v_capacities         = cuopt::device_copy(capacities, stream);
+
+  cuopt::routing::data_model_view_t<int, float> static_model(
+    &handle, n_locations, n_vehicles, n_locations);
+  static_model.add_cost_matrix(v_cost_matrix.data());
+  static_model.set_order_time_windows(v_earliest.data(), v_latest.data());
+  static_model.add_capacity_dimension("demand", v_demands.data(), v_capacities.data());
+  auto time_dependent_model = static_model;
+  static_model.add_transit_time_matrix(v_time_matrix.data());
+  time_dependent_model.add_transit_time_matrix(
+    v_time_dependent.data(), v_bucket_start_times.data(), n_time_buckets);
+
+  cuopt::routing::solver_settings_t<int, float> settings;
+  settings.set_time_limit(5);
+
+  auto static_solution         = cuopt::routing::solve(static_model, settings);
+  auto time_dependent_solution = cuopt::routing::solve(time_dependent_model, settings);
+  handle.sync_stream();
+  ASSERT_EQ(static_solution.get_status(), cuopt::routing::solution_status_t::SUCCESS);
+  ASSERT_EQ(time_dependent_solution.get_status(), cuopt::routing::solution_status_t::SUCCESS);
+  check_route(time_dependent_model, time_dependent_solution);
+  EXPECT_FLOAT_EQ(time_dependent_solution.get_total_objective(),
+                  static_solution.get_total_objective());
+  EXPECT_EQ(time_dependent_solution.get_vehicle_count(), static_solution.get_vehicle_count());
+}
+
+TEST(time_dependent_transit_times, arrival_stamps_follow_buckets)
+{
+  // One vehicle on a line, the arcs take twice their length before time 20 and their length
+  // after, which satisfies FIFO for arcs shorter than 20
+  const int n_locations = 6;
+  auto cost_matrix      = line_matrix(n_locations);
+  const std::vector<float> bucket_start_times{0, 20};
+  const int n_time_buckets = bucket_start_times.size();
+  std::vector<float> time_dependent(cost_matrix.size() * n_time_buckets);
+  for (size_t arc = 0; arc < cost_matrix.size(); ++arc) {
+    time_dependent[arc * n_time_buckets]     = 2 * cost_matrix[arc];
+    time_dependent[arc * n_time_buckets + 1] = cost_matrix[arc];
+  }
+
+  raft::handle_t handle;
+  auto stream = handle.get_stream();
+
+  auto v_cost_matrix        = cuopt::device_copy(cost_matrix, stream);
+  auto v_time_dependent     = cuopt::device_copy(time_dependent, stream);
+  auto v_bucket_start_times = cuopt::device_copy(bucket_start_times, stream);
+
+  cuopt::routing::data_model_view_t<int, float> data_model(&handle, n_locations, 1, n_locations);
+  data_model.add_cost_matrix(v_cost_matrix.data());
+  data_model.add_transit_time_matrix(
+    v_time_dependent.data(), v_bucket_start_times.data(), n_time_buckets);
+
+  cuopt::routing::solver_settings_t<int, float> settings;
+  settings.set_time_limit(2);
+
+  auto routing_solution = cuopt::routing::solve(data_model, settings);
+  handle.sync_stream();
+  ASSERT_EQ(routing_solution.get_status(), cuopt::routing::solution_status_t::SUCCESS);
+  auto host_route = cuopt::routing::host_assignment_t(routing_solution);
+  check_route(data_model, host_route);
+
+  // Each arrival is the previous one plus the transit time at that departure
+  const auto& locations = host_route.locations;
+  const auto& stamp     = host_route.stamp;
+  ASSERT_EQ(locations.size(), n_locations + 1);
+  for (size_t i = 0; i + 1 < locations.size(); ++i) {
+    const int arc = locations[i] * n_locations + locations[i + 1];
+    EXPECT_NEAR(stamp[i + 1],
+                stamp[i] + transit_time(time_dependent, bucket_start_times, arc, stamp[i]),
+                1e-3)
+      << "stop " << i + 1;
+  }
+}
+
+TEST(time_dependent_transit_times, invalid_buckets)
+{
+  const int n_locations = 3;
+  raft::handle_t handle;
+  auto stream = handle.get_stream();
+  cuopt::routing::data_model_view_t<int, float> data_model(&handle, n_locations, 1, n_locations);
+
+  // Departing at 10 arrives at 12, before the arrival at 30 of a departure at 0
+  std::vector<float> not_fifo(n_locations * n_locations * 2, 1);
+  not_fifo[(0 * n_locations + 1) * 2]     = 30;
+  not_fifo[(0 * n_locations + 1) * 2 + 1] = 2;
+
+  auto v_not_fifo           = cuopt::device_copy(not_fifo, stream);
+  auto v_bucket_start_times = cuopt::device_copy(std::vector<float>{0, 10}, stream);
+  EXPECT_THROW(
+    data_model.add_transit_time_matrix(v_not_fifo.data(), v_bucket_start_times.data(), 2),
+    cuopt::logic_error);
+
+  // Bucket start times must increase
+  std::vector<float> constant(n_locations * n_locations * 2, 1);
+  auto v_constant          = cuopt::device_copy(constant, stream);
+  auto v_decreasing_starts = cuopt::device_copy(std::vector<float>{10, 0}, stream);
+  EXPECT_THROW(
+    data_model.add_transit_time_matrix(v_constant.data(), v_decreasing_starts.data(), 2),
+    cuopt::logic_error);
+  EXPECT_NO_THROW(
+    data_model.add_transit_time_matrix(v_constant.data(), v_bucket_start_times.data(), 2));
+}
+
+}  // namespace test
+}  // namespace routing
+}  // namespace cuopt
@@ -178,9 +178,16 @@ cdef extern from "cuopt/linear_programming/utilities/cython_solve.hpp" namespace
         linear_programming_ret_t lp_ret
         mip_ret_t mip_ret
 
+    # Called without the GIL, the Python callbacks take it when they run
     cdef unique_ptr[solver_ret_t] call_solve(
         data_model_view_t[int, double]* data_model,
         solver_settings_t[int, double]* solver_settings,
+    ) except + nogil
+
+    cdef unique_ptr[solver_ret_t] call_solve_flat(
+        const void* buffer,
+        size_t buffer_size,
+        solver_settings_t[int, double]* solver_settings,
     ) except +
 
     cdef pair[vector[unique_ptr[solver_ret_t]], double] call_batch_solve( # noqa
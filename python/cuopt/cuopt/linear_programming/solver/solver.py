@@ -1,4 +1,4 @@
-# SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 
 import os
@@ -122,6 +122,8 @@ def BatchSolve(data_model_list, solver_settings=None):
     The total time to solve the whole batch on the engine side is returned as
     summing up the solutions `get_solve_time` would be incorrect as they are
     solved together in parallel, overlapping multiple solve.
+    The problems are spread over all the visible GPUs, the solutions are
+    returned in the order of `data_model_list` on the current GPU.
     Both primal and dual solutions are zero-initialized.
     For custom initialization, please refer to `set_initial_primal_solution()`
     and `set_initial_dual_solution()` methods.
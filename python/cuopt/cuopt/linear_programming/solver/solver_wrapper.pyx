@@ -495,6 +495,8 @@ def Solve(py_data_model_obj, settings, mip=False):
 
     cdef DataModel data_model_obj = <DataModel>py_data_model_obj
     cdef unique_ptr[solver_settings_t[int, double]] unique_solver_settings
+    cdef data_model_view_t[int, double]* c_data_model_view
+    cdef unique_ptr[solver_ret_t] sol_ret
 
     unique_solver_settings.reset(new solver_settings_t[int, double]())
 
@@ -506,11 +508,16 @@ def Solve(py_data_model_obj, settings, mip=False):
         unique_solver_settings, settings, data_model_obj, mip
     )
     data_model_obj.set_data_model_view()
+    c_data_model_view = data_model_obj.c_data_model_view.get()
 
-    return create_solution(move(call_solve(
-        data_model_obj.c_data_model_view.get(),
-        unique_solver_settings.get(),
-    )), data_model_obj)
+    # The MIP solution callbacks run on solver threads and take the GIL
+    with nogil:
+        sol_ret = move(call_solve(
+            c_data_model_view,
+            unique_solver_settings.get(),
+        ))
+
+    return create_solution(move(sol_ret), data_model_obj)
 
 
 cdef set_and_insert_vector(
@@ -2,6 +2,8 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import os
+import threading
+import time
 
 import cuopt_mps_parser
 import pytest
@@ -121,3 +123,53 @@ def test_incumbent_get_callback(file_name):
 )
 def test_incumbent_get_set_callback(file_name):
     _run_incumbent_solver_callback(file_name, include_set_callback=True)
+
+
+def test_incumbent_callback_threads():
+    # The incumbents are delivered on a solver thread while the solve releases
+    # the GIL: a slow callback and other Python threads keep running
+    class SlowGetSolutionCallback(GetSolutionCallback):
+        def __init__(self):
+            super().__init__()
+            self.thread_ids = set()
+            self.costs = []
+
+        def get_solution(
+            self, solution, solution_cost, solution_bound, user_data
+        ):
+            self.thread_ids.add(threading.get_ident())
+            self.costs.append(float(solution_cost[0]))
+            time.sleep(0.05)
+
+    stop = threading.Event()
+    ticks = []
+
+    def tick():
+        while not stop.is_set():
+            ticks.append(1)
+            time.sleep(0.01)
+
+    file_path = RAPIDS_DATASET_ROOT_DIR + "/mip/swath1.mps"
+    data_model_obj = cuopt_mps_parser.ParseMps(file_path)
+    get_callback = SlowGetSolutionCallback()
+    settings = solver_settings.SolverSettings()
+    settings.set_parameter(CUOPT_TIME_LIMIT, 10)
+    settings.set_mip_callback(get_callback, None)
+
+    ticker = threading.Thread(target=tick)
+    ticker.start()
+    ticks_before_solve = len(ticks)
+    solution = solver.Solve(data_model_obj, settings)
+    stop.set()
+    ticker.join()
+
+    assert solution.get_termination_status() in (
+        MILPTerminationStatus.FeasibleFound,
+        MILPTerminationStatus.Optimal,
+    )
+    assert len(get_callback.costs) > 0
+    assert threading.get_ident() not in get_callback.thread_ids
+    # The incumbents are delivered before Solve returns, none is better than
+    # the returned solution of this minimization
+    assert solution.get_primal_objective() <= min(get_callback.costs) + 1e-6
+    assert len(ticks) > ticks_before_solve + 10
@@ -16,6 +16,7 @@ class SolverMethod(IntEnum):
     PDLP = auto()
     DualSimplex = auto()
     Barrier = auto()
+    Automatic = auto()
 
     def __str__(self):
         """Convert the solver method to a string.
@@ -439,6 +439,8 @@ class SolverConfig(BaseModel):
         "<br>"
         "- Barrier: 3, Barrier method"
         "<br>"
+        "- Automatic: 4, picks a method from the structure of the problem"
+        "<br>"
         "Note: Not supported for MILP. ",
     )
     mip_scaling: Optional[bool] = Field(
@@ -453,7 +455,8 @@ class SolverConfig(BaseModel):
     mip_batch_pdlp_strong_branching: Optional[int] = Field(
         default=0,
         description="Set 1 to enable batch PDLP strong branching "
-        "in the MIP solver, 0 to disable.",
+        "at the root of the MIP solver, 2 to also use it for the "
+        "reliability branching in the tree, 0 to disable.",
     )
     num_cpu_threads: Optional[int] = Field(
         default=None,
@@ -508,7 +511,8 @@ class SolverConfig(BaseModel):
     presolve: Optional[int] = Field(
         default=None,
         description="Set presolve mode: 0 to disable presolve, 1 for Papilo presolve for MIP or LPs, "  # noqa
-        "2 for PSLP LP presolve. Presolve can reduce problem size and improve solve time. "  # noqa
+        "2 for PSLP LP presolve, 3 for GPU LP presolve. "
+        "Presolve can reduce problem size and improve solve time. "
         "Default is 1 for MIP problems and 2 for LP problems.",
     )
     dual_postsolve: Optional[bool] = Field(